@@ -35,6 +35,7 @@ set(KATANA_USE_TUNE "intel;generic;auto" CACHE STRING "Semi-colon separated list
   optimizing for the most common processors and then to optimizing for the processor selected by KATANA_USE_ARCH")
 set(KATANA_USE_SANITIZER "" CACHE STRING "Semi-colon separated list of sanitizers to use (Memory, MemoryWithOrigins, Address, Undefined, Thread)")
 set(KATANA_USE_JEMALLOC OFF CACHE BOOL "Use jemalloc")
+set(KATANA_AUDIT_HOT_ASSERTS OFF CACHE BOOL "Keep hot-path assertions (KATANA_HOT_ASSERT) as full checks in release builds for auditing their cost")
 
 # This option is automatically handled by CMake.
 # It makes add_library build a shared lib unless STATIC is explicitly specified.
@@ -313,6 +314,10 @@ if (KATANA_USE_PAPI)
   add_definitions(-DKATANA_USE_PAPI)
 endif ()
 
+if (KATANA_AUDIT_HOT_ASSERTS)
+  add_definitions(-DKATANA_HOT_ASSERT_AUDIT)
+endif ()
+
 if (KATANA_USE_JEMALLOC)
   find_c_library(NAME jemalloc TARGET jemalloc::jemalloc REQUIRED MAIN_HEADER jemalloc/jemalloc.h)
   link_libraries(jemalloc::jemalloc)
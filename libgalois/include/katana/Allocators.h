@@ -20,6 +20,7 @@
 #ifndef KATANA_LIBGALOIS_KATANA_ALLOCATORS_H_
 #define KATANA_LIBGALOIS_KATANA_ALLOCATORS_H_
 
+#include <atomic>
 #include <cstddef>
 #include <cstdio>
 #include <cstdlib>
@@ -106,6 +107,81 @@ public:
   }
 };
 
+namespace internal {
+//! Implemented in Mem.cpp to avoid a header cycle with Statistics.h
+KATANA_EXPORT void ReportHeapStats(
+    const char* tag, size_t live_bytes, size_t high_water_bytes,
+    size_t total_allocs);
+}  // namespace internal
+
+/**
+ * Wrap a heap with byte accounting for leak attribution. Tracks live
+ * bytes, the high-water mark and the number of allocations under an owner
+ * tag, so RSS growth can be attributed to a subsystem (worklists,
+ * properties, ...) instead of guessed at. Counters are queryable at
+ * runtime through the getters and exported to the statistics subsystem by
+ * reportStats().
+ *
+ * Accounting is per chunk for fixed-chunk source heaps (AllocSize != 0)
+ * because such heaps hand out whole chunks regardless of the requested
+ * size.
+ */
+template <typename SourceHeap>
+class StatsHeap : public SourceHeap {
+  std::atomic<size_t> live_bytes_{0};
+  std::atomic<size_t> high_water_bytes_{0};
+  std::atomic<size_t> total_allocs_{0};
+  const char* tag_;
+
+  static size_t chargeFor(size_t size) {
+    return SourceHeap::AllocSize ? size_t(SourceHeap::AllocSize) : size;
+  }
+
+public:
+  enum { AllocSize = SourceHeap::AllocSize };
+
+  explicit StatsHeap(const char* tag = "untagged") : tag_(tag) {}
+
+  inline void* allocate(size_t size) {
+    void* ptr = SourceHeap::allocate(size);
+    if (ptr) {
+      size_t live = live_bytes_.fetch_add(
+                        chargeFor(size), std::memory_order_relaxed) +
+                    chargeFor(size);
+      total_allocs_.fetch_add(1, std::memory_order_relaxed);
+      size_t high = high_water_bytes_.load(std::memory_order_relaxed);
+      while (live > high && !high_water_bytes_.compare_exchange_weak(
+                                high, live, std::memory_order_relaxed)) {
+      }
+    }
+    return ptr;
+  }
+
+  inline void deallocate(void* ptr) {
+    SourceHeap::deallocate(ptr);
+    if (AllocSize) {
+      live_bytes_.fetch_sub(AllocSize, std::memory_order_relaxed);
+    }
+  }
+
+  const char* tag() const { return tag_; }
+  size_t liveBytes() const {
+    return live_bytes_.load(std::memory_order_relaxed);
+  }
+  size_t highWaterBytes() const {
+    return high_water_bytes_.load(std::memory_order_relaxed);
+  }
+  size_t totalAllocs() const {
+    return total_allocs_.load(std::memory_order_relaxed);
+  }
+
+  //! Export the counters under the MemHeap statistics region.
+  void reportStats() const {
+    internal::ReportHeapStats(
+        tag_, liveBytes(), highWaterBytes(), totalAllocs());
+  }
+};
+
 template <typename SourceHeap>
 class ZeroOut : public SourceHeap {
 public:
@@ -481,6 +557,28 @@ public:
     return retval;
   }
 
+  /**
+   * Rewind the bump pointer, keeping the most recent chunk for reuse.
+   * Older chunks go back to the source heap and malloc fallbacks are
+   * freed, so resetting between iterations touches no allocator in the
+   * steady state where an iteration fits in one chunk.
+   */
+  void reset() {
+    if (head) {
+      while (head->next) {
+        Block* B = head->next;
+        head->next = B->next;
+        SourceHeap::deallocate(B);
+      }
+      offset = sizeof(Block);
+    }
+    while (fallbackHead) {
+      Block* B = fallbackHead;
+      fallbackHead = B->next;
+      free(B);
+    }
+  }
+
   inline void deallocate(void*) {}
 };
 
@@ -596,6 +694,37 @@ struct VariableSizeHeap : public ThreadPrivateHeap<BumpHeap<SystemHeap>> {
   enum { AllocSize = 0 };
 };
 
+/**
+ * Per-thread bump arena for round-structured algorithms. Allocation is a
+ * thread-local pointer bump out of page-pool chunks and deallocate is a
+ * no-op; the owner rewinds the arena wholesale with resetLocal() (from the
+ * owning thread, e.g., after each iteration of a parallel loop) or reset()
+ * (serially, between rounds). Only back containers with it that are
+ * discarded before the next rewind.
+ */
+class PerRoundArenaHeap {
+  PerThreadStorage<BumpWithMallocHeap<SystemHeap>> heaps;
+
+public:
+  enum { AllocSize = 0 };
+
+  inline void* allocate(size_t size) {
+    return heaps.getLocal()->allocate(size);
+  }
+
+  inline void deallocate(void*) {}
+
+  //! Rewind the calling thread's arena, keeping its hot chunk.
+  void resetLocal() { heaps.getLocal()->reset(); }
+
+  //! Rewind every thread's arena; call outside parallel code.
+  void reset() {
+    for (unsigned i = 0; i < heaps.size(); ++i) {
+      heaps.getRemote(i)->reset();
+    }
+  }
+};
+
 //! Main scalable allocator in Galois
 class FixedSizeHeap {
   SizedHeapFactory::SizedHeap* heap;
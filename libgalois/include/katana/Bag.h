@@ -124,6 +124,8 @@ public:
 private:
   katana::FixedSizeHeap heap;
   katana::PerThreadStorage<PerThread> heads;
+  //! Per-thread list of empty chunks recycled by clear_and_keep_capacity()
+  katana::PerThreadStorage<header*> freeChunks;
 
   void insHeader(header* h) {
     PerThread& hpair = *heads.getLocal();
@@ -149,6 +151,13 @@ private:
   }
 
   header* newHeader() {
+    header*& f = *freeChunks.getLocal();
+    if (f) {
+      header* h = f;
+      f = h->next;
+      h->next = 0;
+      return h;
+    }
     if (BlockSize) {
       return newHeaderFromHeap(heap.allocate(BlockSize), BlockSize);
     } else {
@@ -170,6 +179,15 @@ private:
           katana::pagePoolFree(h2);
       }
       hpair.second = 0;
+      header*& f = *freeChunks.getRemote(x);
+      while (f) {
+        header* h2 = f;
+        f = f->next;
+        if (BlockSize)
+          heap.deallocate(h2);
+        else
+          katana::pagePoolFree(h2);
+      }
     }
   }
 
@@ -188,6 +206,15 @@ private:
               katana::pagePoolFree(h2);
           }
           hpair.second = 0;
+          header*& f = *freeChunks.getLocal(tid);
+          while (f) {
+            header* h2 = f;
+            f = f->next;
+            if (BlockSize)
+              heap.deallocate(h2);
+            else
+              katana::pagePoolFree(h2);
+          }
         },
         std::make_tuple(katana::no_stats()));
   }
@@ -201,11 +228,13 @@ public:
   InsertBag(InsertBag&& o) : heap(BlockSize) {
     std::swap(heap, o.heap);
     std::swap(heads, o.heads);
+    std::swap(freeChunks, o.freeChunks);
   }
 
   InsertBag& operator=(InsertBag&& o) {
     std::swap(heap, o.heap);
     std::swap(heads, o.heads);
+    std::swap(freeChunks, o.freeChunks);
     return *this;
   }
 
@@ -218,9 +247,37 @@ public:
 
   void clear_serial() { destruct_serial(); }
 
+  /**
+   * Empty the bag but keep its chunks on per-thread free lists for reuse by
+   * later pushes. Round-based algorithms that double-buffer frontiers (clear
+   * one bag, refill the other, swap) should prefer this over clear(): it
+   * avoids returning header pages to the page pool and reallocating them
+   * every round, keeping the same hot pages in play. Chunks are recycled by
+   * the thread that owns them, so NUMA placement is preserved.
+   */
+  void clear_and_keep_capacity() {
+    katana::on_each_gen(
+        [this](const unsigned int tid, const unsigned int) {
+          PerThread& hpair = *heads.getLocal(tid);
+          header*& h = hpair.first;
+          header*& f = *freeChunks.getLocal(tid);
+          while (h) {
+            uninitialized_destroy(h->dbegin, h->dend);
+            header* h2 = h;
+            h = h->next;
+            h2->dend = h2->dbegin;
+            h2->next = f;
+            f = h2;
+          }
+          hpair.second = 0;
+        },
+        std::make_tuple(katana::no_stats()));
+  }
+
   void swap(InsertBag& o) {
     std::swap(heap, o.heap);
     std::swap(heads, o.heads);
+    std::swap(freeChunks, o.freeChunks);
   }
 
   typedef T value_type;
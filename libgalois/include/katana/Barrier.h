@@ -79,6 +79,16 @@ KATANA_EXPORT std::unique_ptr<Barrier> CreateDisseminationBarrier(unsigned);
  */
 KATANA_EXPORT std::unique_ptr<Barrier> CreateSimpleBarrier(unsigned);
 
+/**
+ * Create the barrier best suited to the current machine: the topology-aware
+ * barrier on multi-socket machines, the dissemination barrier for large
+ * single-socket thread counts and the counting barrier for small ones. The
+ * choice can be overridden with the environment variable KATANA_BARRIER
+ * (topo, mcs, counting, dissemination or simple). Used by the runtime at
+ * startup to install the global barrier returned by GetBarrier().
+ */
+KATANA_EXPORT std::unique_ptr<Barrier> CreateBarrier(unsigned active_threads);
+
 namespace internal {
 
 void SetBarrier(Barrier* barrier);
@@ -0,0 +1,273 @@
+#ifndef KATANA_LIBGALOIS_KATANA_CONCURRENTHASHMAP_H_
+#define KATANA_LIBGALOIS_KATANA_CONCURRENTHASHMAP_H_
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "katana/Allocators.h"
+#include "katana/CacheLineStorage.h"
+#include "katana/SimpleLock.h"
+#include "katana/config.h"
+
+namespace katana {
+
+/**
+ * A concurrent hash map for shared algorithm scratch state.
+ *
+ * Separate chaining with 128 cache-line padded lock stripes: an
+ * operation takes exactly one stripe, chosen by the low bits of the
+ * key's hash, so threads working on different keys almost never
+ * serialize. Chain nodes come from the per-thread FixedSizeAllocator
+ * pools, so inserts in a parallel region never contend on a global
+ * allocator and the map composes with PerThreadStorage.
+ *
+ * Use this instead of per-thread gstl::UnorderedMap plus a merge phase
+ * when threads must observe each other's updates (community counters
+ * in Louvain/CDLP, dedup sets). For thread-private scratch state the
+ * per-thread maps are still faster since they take no locks at all.
+ *
+ * Size the map at construction with the expected number of keys to
+ * avoid growth; the table doubles automatically past a load factor of
+ * one, which briefly blocks all stripes. Erase is not provided: scratch
+ * maps are cleared between rounds with Clear(), which also keeps chain
+ * traversal free of tombstone checks.
+ *
+ * Insert, Upsert, Find, and WithValue may be called concurrently.
+ * Clear() and ForEach() must not run concurrently with writers.
+ */
+template <
+    typename Key, typename T, typename Hash = std::hash<Key>,
+    typename KeyEqual = std::equal_to<Key>>
+class ConcurrentHashMap {
+  struct Node {
+    std::pair<const Key, T> item;
+    Node* next;
+
+    template <typename... Args>
+    Node(Node* n, const Key& k, Args&&... args)
+        : item(
+              std::piecewise_construct, std::forward_as_tuple(k),
+              std::forward_as_tuple(std::forward<Args>(args)...)),
+          next(n) {}
+  };
+
+  static constexpr size_t kNumStripes = 128;
+  static constexpr size_t kMinBuckets = kNumStripes;
+
+  /// Buckets are a power of two and never fewer than kNumStripes, so
+  /// every key in one bucket shares hash low bits and therefore maps to
+  /// the same stripe no matter how large the table grows. That keeps
+  /// the hash-to-stripe mapping stable across growth: a thread that
+  /// holds the stripe for its key owns its bucket's chain in the old
+  /// and the new table alike.
+  std::vector<Node*> buckets_;
+  std::array<CacheLineStorage<SimpleLock>, kNumStripes> stripes_;
+  std::atomic<size_t> size_{0};
+  FixedSizeAllocator<Node> alloc_;
+  Hash hash_;
+  KeyEqual equal_;
+
+  static size_t NextPow2(size_t n) {
+    size_t p = kMinBuckets;
+    while (p < n) {
+      p <<= 1;
+    }
+    return p;
+  }
+
+  SimpleLock& StripeFor(size_t hash) {
+    return stripes_[hash & (kNumStripes - 1)].get();
+  }
+
+  Node*& BucketFor(size_t hash) { return buckets_[hash & (buckets_.size() - 1)]; }
+
+  Node* FindInChain(Node* head, const Key& key) const {
+    for (Node* n = head; n != nullptr; n = n->next) {
+      if (equal_(n->item.first, key)) {
+        return n;
+      }
+    }
+    return nullptr;
+  }
+
+  /// Double the table. Takes every stripe (in index order, so
+  /// concurrent growers cannot deadlock), rechecks the trigger, then
+  /// relinks all nodes into the new buckets; nodes are reused, not
+  /// reallocated.
+  void Grow() {
+    for (auto& stripe : stripes_) {
+      stripe.get().lock();
+    }
+    if (size_.load(std::memory_order_relaxed) > buckets_.size()) {
+      std::vector<Node*> old_buckets(buckets_.size() * 2, nullptr);
+      old_buckets.swap(buckets_);
+      for (Node* head : old_buckets) {
+        while (head != nullptr) {
+          Node* next = head->next;
+          Node*& bucket = BucketFor(hash_(head->item.first));
+          head->next = bucket;
+          bucket = head;
+          head = next;
+        }
+      }
+    }
+    for (auto& stripe : stripes_) {
+      stripe.get().unlock();
+    }
+  }
+
+  void MaybeGrow() {
+    if (size_.load(std::memory_order_relaxed) > buckets_.size()) {
+      Grow();
+    }
+  }
+
+public:
+  explicit ConcurrentHashMap(size_t expected_size = kMinBuckets)
+      : buckets_(NextPow2(expected_size), nullptr) {}
+
+  ConcurrentHashMap(const ConcurrentHashMap&) = delete;
+  ConcurrentHashMap& operator=(const ConcurrentHashMap&) = delete;
+
+  ~ConcurrentHashMap() { Clear(); }
+
+  /**
+   * Insert a value if the key is absent.
+   *
+   * @returns true if this call inserted the value, false if the key was
+   * already present (the existing value is left untouched)
+   */
+  template <typename... Args>
+  bool Insert(const Key& key, Args&&... args) {
+    size_t hash = hash_(key);
+    SimpleLock& stripe = StripeFor(hash);
+    stripe.lock();
+    Node*& bucket = BucketFor(hash);
+    if (FindInChain(bucket, key) != nullptr) {
+      stripe.unlock();
+      return false;
+    }
+    Node* n = alloc_.allocate(1);
+    alloc_.construct(n, bucket, key, std::forward<Args>(args)...);
+    bucket = n;
+    stripe.unlock();
+    size_.fetch_add(1, std::memory_order_relaxed);
+    MaybeGrow();
+    return true;
+  }
+
+  /**
+   * Insert the value if the key is absent, otherwise apply \p update to
+   * the existing value under the key's stripe lock. This is the
+   * accumulate operation for counter maps:
+   *
+   * @code
+   * map.Upsert(community, weight, [&](auto& v) { v += weight; });
+   * @endcode
+   *
+   * @returns true if this call inserted the value
+   */
+  template <typename UpdateFn>
+  bool Upsert(const Key& key, const T& value, UpdateFn&& update) {
+    size_t hash = hash_(key);
+    SimpleLock& stripe = StripeFor(hash);
+    stripe.lock();
+    Node*& bucket = BucketFor(hash);
+    if (Node* n = FindInChain(bucket, key); n != nullptr) {
+      update(n->item.second);
+      stripe.unlock();
+      return false;
+    }
+    Node* n = alloc_.allocate(1);
+    alloc_.construct(n, bucket, key, value);
+    bucket = n;
+    stripe.unlock();
+    size_.fetch_add(1, std::memory_order_relaxed);
+    MaybeGrow();
+    return true;
+  }
+
+  /**
+   * Look up a key and copy out its value.
+   *
+   * @returns the value, or std::nullopt if the key is absent
+   */
+  std::optional<T> Find(const Key& key) {
+    size_t hash = hash_(key);
+    SimpleLock& stripe = StripeFor(hash);
+    stripe.lock();
+    Node* n = FindInChain(BucketFor(hash), key);
+    std::optional<T> result =
+        n != nullptr ? std::optional<T>(n->item.second) : std::nullopt;
+    stripe.unlock();
+    return result;
+  }
+
+  /**
+   * Apply \p fn to the value for \p key under the key's stripe lock,
+   * avoiding the copy Find() makes.
+   *
+   * @returns true if the key was present and fn was applied
+   */
+  template <typename Fn>
+  bool WithValue(const Key& key, Fn&& fn) {
+    size_t hash = hash_(key);
+    SimpleLock& stripe = StripeFor(hash);
+    stripe.lock();
+    Node* n = FindInChain(BucketFor(hash), key);
+    if (n != nullptr) {
+      fn(n->item.second);
+    }
+    stripe.unlock();
+    return n != nullptr;
+  }
+
+  bool Contains(const Key& key) { return WithValue(key, [](const T&) {}); }
+
+  /// Number of entries; exact only when no writers are active.
+  size_t size() const { return size_.load(std::memory_order_relaxed); }
+
+  bool empty() const { return size() == 0; }
+
+  /**
+   * Apply \p fn to every (key, value) pair. Serial; must not run
+   * concurrently with writers. Typical use is the drain at the end of a
+   * round.
+   */
+  template <typename Fn>
+  void ForEach(Fn&& fn) {
+    for (Node* head : buckets_) {
+      for (Node* n = head; n != nullptr; n = n->next) {
+        fn(n->item.first, n->item.second);
+      }
+    }
+  }
+
+  /**
+   * Remove all entries, returning their nodes to the calling thread's
+   * allocator pool. The bucket array keeps its size so the next round
+   * starts with the same capacity. Must not run concurrently with any
+   * other operation.
+   */
+  void Clear() {
+    for (Node*& head : buckets_) {
+      while (head != nullptr) {
+        Node* next = head->next;
+        alloc_.destroy(head);
+        alloc_.deallocate(head, 1);
+        head = next;
+      }
+    }
+    size_.store(0, std::memory_order_relaxed);
+  }
+};
+
+}  // namespace katana
+
+#endif
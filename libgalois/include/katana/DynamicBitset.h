@@ -47,6 +47,20 @@ class KATANA_EXPORT DynamicBitset {
 public:  // types
   using TItem = katana::CopyableAtomic<uint64_t>;
   using iterator = DynamicBitsetIterator<DynamicBitset>;
+  using set_bit_iterator = DynamicBitsetSetBitIterator<DynamicBitset>;
+
+  /// Range over only the set bits of a bitset; see SetBits().
+  class SetBitsRange {
+    set_bit_iterator begin_;
+    set_bit_iterator end_;
+
+  public:
+    SetBitsRange(set_bit_iterator begin, set_bit_iterator end)
+        : begin_(std::move(begin)), end_(std::move(end)) {}
+
+    set_bit_iterator begin() const { return begin_; }
+    set_bit_iterator end() const { return end_; }
+  };
 
 private:  // variables
   katana::PODVector<TItem> bitvec_;
@@ -126,6 +140,17 @@ public:
 
   iterator end() const { return {this, bitvec_.size(), 0}; }
 
+  set_bit_iterator set_bits_begin() const { return {this, 0}; }
+
+  set_bit_iterator set_bits_end() const { return {this, bitvec_.size()}; }
+
+  /**
+   * Returns a range over only the set bits of the bitset, walking word
+   * by word with count-trailing-zeros instead of testing every bit.
+   * Prefer this over begin()/end() for sparse frontiers and masks.
+   */
+  SetBitsRange SetBits() const { return {set_bits_begin(), set_bits_end()}; }
+
   /**
    * Resizes the bitset.
    *
@@ -335,6 +360,23 @@ public:
    */
   void bitwise_and(const DynamicBitset& other1, const DynamicBitset& other2);
 
+  /**
+   * Does an IN-PLACE bitwise and-not (set difference) of this bitset and
+   * another bitset: clears every bit of this bitset that is set in other
+   *
+   * @param other Bitset whose set bits are removed from this one
+   */
+  void bitwise_andnot(const DynamicBitset& other);
+
+  /**
+   * Saves the bitwise and-not of 2 passed in bitsets to this bitset:
+   * the bits set in other1 but not in other2
+   *
+   * @param other1 Bitset to keep bits from
+   * @param other2 Bitset whose set bits are removed from other1
+   */
+  void bitwise_andnot(const DynamicBitset& other1, const DynamicBitset& other2);
+
   /**
    * Does an IN-PLACE bitwise xor of this bitset and another bitset
    *
@@ -359,6 +401,18 @@ public:
    */
   size_t count() const;
 
+  /**
+   * Count how many bits are set in the half-open bit range [begin, end).
+   * Whole words are counted with popcount (which the compiler
+   * vectorizes) and only the partial boundary words are masked. Do not
+   * call in a parallel region as it uses a parallel loop.
+   *
+   * @param begin first bit of the range to count
+   * @param end one past the last bit of the range to count
+   * @returns number of set bits in the range
+   */
+  size_t count(size_t begin, size_t end) const;
+
   /***
    * Count number of set bits in the bitset serially. Useful if
    * you need to count different bitsets on different threads.
@@ -367,6 +421,14 @@ public:
    */
   size_t SerialCount() const;
 
+  /***
+   * Count number of set bits in the half-open bit range [begin, end)
+   * serially. Safe to call from inside a parallel region.
+   *
+   * @returns number of set bits in the range
+   */
+  size_t SerialCount(size_t begin, size_t end) const;
+
   /**
    * Returns a vector containing the set bits in this bitset in order
    * from left to right.
@@ -0,0 +1,210 @@
+#ifndef KATANA_LIBGALOIS_KATANA_EPOCHRECLAMATION_H_
+#define KATANA_LIBGALOIS_KATANA_EPOCHRECLAMATION_H_
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#include "katana/Logging.h"
+#include "katana/PerThreadStorage.h"
+#include "katana/config.h"
+
+namespace katana {
+
+/**
+ * Epoch-based memory reclamation (EBR) for lock-free data structures.
+ *
+ * Lock-free structures cannot free a node the moment it is unlinked:
+ * another thread may still hold a pointer into it. EBR defers the free
+ * until every thread has passed through a grace period. Threads wrap
+ * each operation on the protected structure in a Guard; unlinked nodes
+ * are handed to Retire() instead of deleted. A retired node is freed
+ * once the global epoch has advanced twice past its retirement epoch,
+ * which cannot happen while any guard that might have seen the node is
+ * still open.
+ *
+ * \code
+ * katana::EpochManager epochs;
+ * // inside the parallel region, per operation:
+ * {
+ *   katana::EpochManager::Guard guard(&epochs);
+ *   Node* unlinked = list.remove(key);
+ *   if (unlinked) {
+ *     epochs.Retire(unlinked);
+ *   }
+ * }  // guard closed; the epoch may now advance past this operation
+ * \endcode
+ *
+ * Per-thread state lives in PerThreadStorage, so registration follows
+ * thread pool membership automatically and an advance check is one read
+ * per pool thread. Epoch advancement is lazy: it is attempted when a
+ * thread's retire list reaches a threshold, so quiescent threads cost
+ * nothing and there are no background threads or stalls. Retired nodes
+ * are freed by the thread that retired them, which keeps reclamation
+ * compatible with the per-thread pool allocators.
+ *
+ * Guards must not be nested and must not be held across blocking
+ * operations (barriers, do_all), or the epoch stops advancing and
+ * retired memory accumulates.
+ */
+class KATANA_EXPORT EpochManager {
+  /// A thread with no open guard publishes this instead of an epoch.
+  constexpr static uint64_t kInactive = ~uint64_t{0};
+  /// Retire list length that triggers an advance attempt.
+  constexpr static size_t kAdvanceThreshold = 64;
+
+  struct Retired {
+    void* ptr;
+    void (*deleter)(void*);
+  };
+
+  /// Retired nodes bucketed by retirement epoch modulo 3: nodes from
+  /// epoch e may be freed once the global epoch reaches e + 2, at which
+  /// point bucket (e + 2) % 3 == (e - 1) % 3 is the only one eligible,
+  /// so three buckets always suffice.
+  struct Record {
+    std::atomic<uint64_t> epoch{kInactive};
+    std::array<std::vector<Retired>, 3> limbo;
+    std::array<uint64_t, 3> limbo_epoch{{0, 0, 0}};
+    size_t num_pending{0};
+  };
+
+  std::atomic<uint64_t> global_epoch_{0};
+  PerThreadStorage<Record> records_;
+
+  static void FreeBucket(std::vector<Retired>* bucket) {
+    for (const Retired& r : *bucket) {
+      r.deleter(r.ptr);
+    }
+    bucket->clear();
+  }
+
+  /// Free the calling thread's buckets whose grace period has elapsed.
+  void Collect(Record* record, uint64_t current_epoch) {
+    record->num_pending = 0;
+    for (size_t i = 0; i < record->limbo.size(); ++i) {
+      if (record->limbo[i].empty()) {
+        continue;
+      }
+      if (record->limbo_epoch[i] + 2 <= current_epoch) {
+        FreeBucket(&record->limbo[i]);
+      } else {
+        record->num_pending += record->limbo[i].size();
+      }
+    }
+  }
+
+  /// Advance the global epoch if every thread with an open guard has
+  /// observed the current one. Single CAS attempt; contention means
+  /// someone else advanced, which serves the same purpose.
+  void TryAdvance() {
+    uint64_t current = global_epoch_.load(std::memory_order_acquire);
+    for (unsigned i = 0; i < records_.size(); ++i) {
+      uint64_t seen =
+          records_.getRemote(i)->epoch.load(std::memory_order_acquire);
+      if (seen != kInactive && seen != current) {
+        return;
+      }
+    }
+    global_epoch_.compare_exchange_strong(
+        current, current + 1, std::memory_order_acq_rel);
+  }
+
+public:
+  /// RAII critical section marker; see class comment for usage.
+  class Guard {
+    EpochManager* manager_;
+
+  public:
+    explicit Guard(EpochManager* manager) : manager_(manager) {
+      Record* record = manager_->records_.getLocal();
+      KATANA_LOG_DEBUG_VASSERT(
+          record->epoch.load(std::memory_order_relaxed) == kInactive,
+          "EpochManager guards must not be nested");
+      record->epoch.store(
+          manager_->global_epoch_.load(std::memory_order_acquire),
+          std::memory_order_release);
+    }
+
+    Guard(const Guard&) = delete;
+    Guard& operator=(const Guard&) = delete;
+
+    ~Guard() {
+      manager_->records_.getLocal()->epoch.store(
+          kInactive, std::memory_order_release);
+    }
+  };
+
+  EpochManager() = default;
+
+  EpochManager(const EpochManager&) = delete;
+  EpochManager& operator=(const EpochManager&) = delete;
+
+  ~EpochManager() { DrainAll(); }
+
+  /**
+   * Schedule \p ptr to be deleted once no thread can still hold a
+   * reference to it. Must be called with a Guard open. The node is
+   * freed later by this same thread.
+   */
+  template <typename T>
+  void Retire(T* ptr) {
+    RetireWith(ptr, [](void* p) { delete static_cast<T*>(p); });
+  }
+
+  /**
+   * Like Retire() but with a custom deleter, for nodes that came from a
+   * pool allocator rather than new.
+   */
+  void RetireWith(void* ptr, void (*deleter)(void*)) {
+    Record* record = records_.getLocal();
+    uint64_t epoch = global_epoch_.load(std::memory_order_acquire);
+    size_t bucket = epoch % record->limbo.size();
+    if (!record->limbo[bucket].empty() &&
+        record->limbo_epoch[bucket] != epoch) {
+      // The bucket still holds nodes from three epochs ago; they are
+      // past their grace period by construction.
+      FreeBucket(&record->limbo[bucket]);
+    }
+    record->limbo_epoch[bucket] = epoch;
+    record->limbo[bucket].push_back(Retired{ptr, deleter});
+
+    if (++record->num_pending >= kAdvanceThreshold) {
+      TryAdvance();
+      Collect(record, global_epoch_.load(std::memory_order_acquire));
+    }
+  }
+
+  /// Number of nodes the calling thread has retired but not yet freed.
+  size_t PendingLocal() {
+    size_t pending = 0;
+    for (const auto& bucket : records_.getLocal()->limbo) {
+      pending += bucket.size();
+    }
+    return pending;
+  }
+
+  /**
+   * Free every retired node on all threads. Only safe when no guards
+   * are open and no concurrent Retire() calls are running, e.g. between
+   * parallel phases or at teardown. Runs deleters on the calling
+   * thread, so pool-allocated nodes freed here return to the caller's
+   * pool.
+   */
+  void DrainAll() {
+    for (unsigned i = 0; i < records_.size(); ++i) {
+      Record* record = records_.getRemote(i);
+      KATANA_LOG_DEBUG_ASSERT(
+          record->epoch.load(std::memory_order_relaxed) == kInactive);
+      for (auto& bucket : record->limbo) {
+        FreeBucket(&bucket);
+      }
+      record->num_pending = 0;
+    }
+  }
+};
+
+}  // namespace katana
+
+#endif
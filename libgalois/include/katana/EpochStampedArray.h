@@ -0,0 +1,108 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+#ifndef KATANA_LIBGALOIS_KATANA_EPOCHSTAMPEDARRAY_H_
+#define KATANA_LIBGALOIS_KATANA_EPOCHSTAMPEDARRAY_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "katana/NUMAArray.h"
+#include "katana/ParallelSTL.h"
+#include "katana/config.h"
+
+namespace katana {
+
+/**
+ * A fixed-size array whose entries can all be invalidated in O(1).
+ *
+ * Each entry carries a generation stamp and is valid only while its stamp
+ * matches the array's current epoch. ResetAll() bumps the epoch, so bulk
+ * reinitialization between runs of an analytic (distances back to infinity,
+ * parents back to unset) is a single increment instead of an O(N) fill;
+ * queries that touch a small frontier pay only for the entries they write.
+ * The stamps are refilled in parallel on the rare occasion the 32-bit epoch
+ * wraps.
+ *
+ * Values are NUMA-interleaved like the property arrays they stand in for.
+ * Concurrent accesses to distinct entries are safe; concurrent accesses to
+ * the same entry follow the same rules as NUMAArray. ResetAll() and
+ * allocation must happen on the main thread with no loop in flight.
+ */
+template <typename T>
+class EpochStampedArray {
+  NUMAArray<T> values_;
+  NUMAArray<uint32_t> epochs_;
+  uint32_t epoch_{1};
+  T reset_value_{};
+
+public:
+  EpochStampedArray() = default;
+  explicit EpochStampedArray(const T& reset_value)
+      : reset_value_(reset_value) {}
+
+  //! Allocates n entries interleaved across NUMA sockets; every entry starts
+  //! invalid. The one-time stamp fill also pre-faults the pages.
+  void allocateInterleaved(size_t n) {
+    values_.allocateInterleaved(n);
+    epochs_.allocateInterleaved(n);
+    ParallelSTL::fill(epochs_.begin(), epochs_.end(), uint32_t{0});
+  }
+
+  size_t size() const { return values_.size(); }
+
+  //! The value a stale entry reads as; typically an algorithm's "unvisited"
+  //! sentinel (kDistanceInfinity, kInvalidNode, ...).
+  void SetResetValue(const T& value) { reset_value_ = value; }
+
+  //! True if the entry has been written since the last ResetAll().
+  bool IsSet(size_t i) const { return epochs_[i] == epoch_; }
+
+  //! Current value of the entry; the reset value if it is stale.
+  T Get(size_t i) const { return IsSet(i) ? values_[i] : reset_value_; }
+
+  //! Writes the entry and marks it valid for the current epoch.
+  void Set(size_t i, const T& value) {
+    values_[i] = value;
+    epochs_[i] = epoch_;
+  }
+
+  //! Reference to the entry, first stamping it with the reset value if it is
+  //! stale. Use when the caller updates in place (e.g. min-relaxations).
+  T& Touch(size_t i) {
+    if (epochs_[i] != epoch_) {
+      values_[i] = reset_value_;
+      epochs_[i] = epoch_;
+    }
+    return values_[i];
+  }
+
+  //! Invalidates every entry. O(1) amortized: only a 32-bit epoch wraparound
+  //! triggers a parallel stamp clear.
+  void ResetAll() {
+    if (++epoch_ == 0) {
+      ParallelSTL::fill(epochs_.begin(), epochs_.end(), uint32_t{0});
+      epoch_ = 1;
+    }
+  }
+};
+
+}  // namespace katana
+
+#endif
@@ -20,6 +20,10 @@
 #ifndef KATANA_LIBGALOIS_KATANA_EXECUTORDOALL_H_
 #define KATANA_LIBGALOIS_KATANA_EXECUTORDOALL_H_
 
+#include <atomic>
+#include <chrono>
+#include <limits>
+
 #include "katana/Barrier.h"
 #include "katana/CompilerSpecific.h"
 #include "katana/Executor_OnEach.h"
@@ -49,6 +53,14 @@ class DoAllStealingExec {
   constexpr static const bool MORE_STATS =
       NEED_STATS && has_trait<more_stats_tag, ArgsTuple>();
   constexpr static const bool USE_TERM = false;
+  constexpr static const bool ADAPTIVE =
+      has_trait<adaptive_chunk_size_tag, ArgsTuple>();
+
+  // Adaptive chunk sizing targets per-chunk execution times within this
+  // window; see ThreadContext::doWorkAdaptive.
+  constexpr static const long kChunkTimeLowUsec = 50;
+  constexpr static const long kChunkTimeHighUsec = 200;
+  constexpr static const unsigned kMaxAdaptiveChunk = 1u << 16;
 
   struct ThreadContext {
     alignas(KATANA_CACHE_LINE_SIZE) SimpleLock work_mutex;
@@ -100,6 +112,46 @@ class DoAllStealingExec {
       return didwork;
     }
 
+    /// As doWork, but re-tunes *chunk_io between chunks based on the
+    /// observed per-chunk cost: chunks finishing under kChunkTimeLowUsec
+    /// double (bounded by max_chunk) to amortize scheduling overhead,
+    /// chunks over kChunkTimeHighUsec halve (bounded by min_chunk) so
+    /// expensive iterations stay stealable.
+    bool doWorkAdaptive(
+        F func, const unsigned min_chunk, const unsigned max_chunk,
+        unsigned* chunk_io) {
+      Iter beg(shared_beg);
+      Iter end(shared_end);
+
+      bool didwork = false;
+
+      while (getWork(beg, end, *chunk_io)) {
+        didwork = true;
+
+        const auto chunk_start = std::chrono::steady_clock::now();
+
+        for (; beg != end; ++beg) {
+          if (NEED_STATS) {
+            ++num_iter;
+          }
+          func(*beg);
+        }
+
+        const auto chunk_usec =
+            std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - chunk_start)
+                .count();
+
+        if (chunk_usec < kChunkTimeLowUsec && *chunk_io < max_chunk) {
+          *chunk_io *= 2;
+        } else if (chunk_usec > kChunkTimeHighUsec && *chunk_io > min_chunk) {
+          *chunk_io /= 2;
+        }
+      }
+
+      return didwork;
+    }
+
     bool hasWorkWeak() const { return (m_size > 0); }
 
     bool hasWork() const {
@@ -413,13 +465,23 @@ public:
     ThreadContext& ctx = *workers.getLocal();
     totalTime.start();
 
+    // per-thread tuned chunk size; only read when ADAPTIVE
+    unsigned adaptive_chunk = static_cast<unsigned>(chunk_size);
+
     while (true) {
       bool workHappened = false;
 
       execTime.start();
 
-      if (ctx.doWork(func, chunk_size)) {
-        workHappened = true;
+      if constexpr (ADAPTIVE) {
+        if (ctx.doWorkAdaptive(
+                func, 1u, kMaxAdaptiveChunk, &adaptive_chunk)) {
+          workHappened = true;
+        }
+      } else {
+        if (ctx.doWork(func, chunk_size)) {
+          workHappened = true;
+        }
       }
 
       execTime.stop();
@@ -460,6 +522,223 @@ public:
   }
 };
 
+/**
+ * Deque-style lock-free work stealing executor for random-access ranges.
+ *
+ * Each thread owns an atomically packed [begin, end) window over its local
+ * slice of the range. The owner pops fixed-size chunks from the front and
+ * thieves claim half of the remaining window from the back, each with a
+ * single CAS, removing the per-chunk mutex round trip DoAllStealingExec
+ * pays in ThreadContext::getWork/stealWork. Stolen slices are executed by
+ * the thief directly against the victim's base iterator; since work only
+ * ever shrinks, threads can exit once no window holds work.
+ *
+ * Windows are stored as 32-bit offsets, so each thread's local slice must
+ * hold fewer than 2^32 iterations.
+ */
+template <typename R, typename F, typename ArgsTuple>
+class DoAllDequeStealingExec {
+  typedef typename R::local_iterator Iter;
+  typedef typename std::iterator_traits<Iter>::difference_type Diff_ty;
+
+  constexpr static const bool NEED_STATS =
+      katana::internal::NeedStats<ArgsTuple>::value;
+  constexpr static const bool MORE_STATS =
+      NEED_STATS && has_trait<more_stats_tag, ArgsTuple>();
+
+  struct ThreadContext {
+    alignas(KATANA_CACHE_LINE_SIZE) std::atomic<uint64_t> window;
+    Iter base;
+    unsigned id;
+    size_t num_iter;
+
+    static constexpr uint64_t Pack(uint32_t beg, uint32_t end) {
+      return (static_cast<uint64_t>(beg) << 32) | end;
+    }
+    static constexpr uint32_t Beg(uint64_t w) {
+      return static_cast<uint32_t>(w >> 32);
+    }
+    static constexpr uint32_t End(uint64_t w) {
+      return static_cast<uint32_t>(w);
+    }
+
+    ThreadContext()
+        : window(0),
+          base(),
+          id(GetThreadPool().getMaxThreads()),
+          num_iter(0) {}
+
+    void init(unsigned tid, Iter beg, Iter end) {
+      id = tid;
+      base = beg;
+      Diff_ty size = std::distance(beg, end);
+      KATANA_LOG_VASSERT(
+          size >= 0 &&
+              static_cast<uint64_t>(size) <
+                  std::numeric_limits<uint32_t>::max(),
+          "deque_steal windows hold at most 2^32 - 1 iterations per thread");
+      window.store(Pack(0, static_cast<uint32_t>(size)));
+    }
+
+    bool hasWorkWeak() const {
+      uint64_t w = window.load(std::memory_order_relaxed);
+      return Beg(w) < End(w);
+    }
+
+    /// Owner-side pop of up to chunk iterations from the front.
+    bool popFront(uint32_t chunk, uint32_t* out_beg, uint32_t* out_end) {
+      uint64_t w = window.load(std::memory_order_acquire);
+      while (true) {
+        const uint32_t beg = Beg(w);
+        const uint32_t end = End(w);
+        if (beg >= end) {
+          return false;
+        }
+        const uint32_t n = std::min(chunk, end - beg);
+        if (window.compare_exchange_weak(
+                w, Pack(beg + n, end), std::memory_order_acq_rel)) {
+          *out_beg = beg;
+          *out_end = beg + n;
+          return true;
+        }
+      }
+    }
+
+    /// Thief-side claim of half the remaining window (at least one chunk)
+    /// from the back.
+    bool stealBack(uint32_t chunk, uint32_t* out_beg, uint32_t* out_end) {
+      uint64_t w = window.load(std::memory_order_acquire);
+      while (true) {
+        const uint32_t beg = Beg(w);
+        const uint32_t end = End(w);
+        if (beg >= end) {
+          return false;
+        }
+        const uint32_t avail = end - beg;
+        const uint32_t n = std::min(avail, std::max(avail / 2, chunk));
+        if (window.compare_exchange_weak(
+                w, Pack(beg, end - n), std::memory_order_acq_rel)) {
+          *out_beg = end - n;
+          *out_end = end;
+          return true;
+        }
+      }
+    }
+  };
+
+public:
+  DoAllDequeStealingExec(const R& _range, F _func, const ArgsTuple& argsTuple)
+      : range(_range),
+        func(_func),
+        loopname(katana::internal::getLoopName(argsTuple)),
+        chunk_size(get_trait_value<chunk_size_tag>(argsTuple).value),
+        totalTime(loopname, "Total"),
+        execTime(loopname, "Execute"),
+        stealTime(loopname, "Steal") {
+    KATANA_LOG_DEBUG_ASSERT(chunk_size > 0);
+  }
+
+  // parallel call
+  void initThread(void) {
+    unsigned id = ThreadPool::getTID();
+    workers.getLocal(id)->init(id, range.local_begin(), range.local_end());
+  }
+
+  void operator()(void) {
+    ThreadContext& ctx = *workers.getLocal();
+    totalTime.start();
+
+    const uint32_t chunk = static_cast<uint32_t>(chunk_size);
+    uint32_t beg = 0;
+    uint32_t end = 0;
+
+    // Drain the local window from the front.
+    execTime.start();
+    while (ctx.popFront(chunk, &beg, &end)) {
+      for (uint32_t i = beg; i < end; ++i) {
+        func(*(ctx.base + i));
+      }
+      if (NEED_STATS) {
+        ctx.num_iter += (end - beg);
+      }
+    }
+    execTime.stop();
+
+    // Steal from the back of other windows until no work is visible.
+    // Claimed slices are always executed by the claimant, so an empty scan
+    // means every remaining iteration is already owned by some thread.
+    const unsigned maxT = katana::getActiveThreads();
+    bool sawWork = true;
+    while (sawWork) {
+      sawWork = false;
+      for (unsigned i = 1; i < maxT; ++i) {
+        ThreadContext& rich = *workers.getRemote((ctx.id + i) % maxT);
+        if (!rich.hasWorkWeak()) {
+          continue;
+        }
+        sawWork = true;
+
+        stealTime.start();
+        bool stole = rich.stealBack(chunk, &beg, &end);
+        stealTime.stop();
+
+        if (stole) {
+          execTime.start();
+          for (uint32_t j = beg; j < end; ++j) {
+            func(*(rich.base + j));
+          }
+          execTime.stop();
+          if (NEED_STATS) {
+            ctx.num_iter += (end - beg);
+          }
+        }
+      }
+      if (sawWork) {
+        asmPause();
+      }
+    }
+
+    totalTime.stop();
+
+    if (NEED_STATS) {
+      katana::ReportStatSum(loopname, "Iterations", ctx.num_iter);
+    }
+  }
+
+private:
+  R range;
+  F func;
+  const char* loopname;
+  Diff_ty chunk_size;
+  PerThreadStorage<ThreadContext> workers;
+
+  PerThreadTimer<MORE_STATS> totalTime;
+  PerThreadTimer<MORE_STATS> execTime;
+  PerThreadTimer<MORE_STATS> stealTime;
+};
+
+struct ChooseDoAllDequeImpl {
+  template <typename R, typename F, typename ArgsT>
+  static void call(const R& range, F&& func, const ArgsT& argsTuple) {
+    static_assert(
+        std::is_base_of<
+            std::random_access_iterator_tag,
+            typename std::iterator_traits<
+                typename R::local_iterator>::iterator_category>::value,
+        "deque_steal requires a random-access range");
+
+    DoAllDequeStealingExec<
+        R, OperatorReferenceType<decltype(std::forward<F>(func))>, ArgsT>
+        exec(range, std::forward<F>(func), argsTuple);
+
+    Barrier& barrier = GetBarrier(activeThreads);
+
+    GetThreadPool().run(
+        activeThreads, [&exec]() { exec.initThread(); },
+        [&barrier]() { barrier.Wait(); }, std::ref(exec));
+  }
+};
+
 template <bool _STEAL>
 struct ChooseDoAllImpl {
   template <typename R, typename F, typename ArgsT>
@@ -545,9 +824,48 @@ do_all_gen(const R& range, F&& func, const ArgsTuple& argsTuple) {
   timer.start();
 
   constexpr bool STEAL = has_trait<steal_tag, ArgsT>();
+  constexpr bool DEQUE_STEAL = has_trait<deque_steal_tag, ArgsT>();
+
+  // Per-invocation thread count: a scoped override of the global setting.
+  // Loops launch from the master thread and the pool runs one region at a
+  // time, so saving and restoring around the dispatch cannot race with
+  // another region. The executors, barrier, termination detection, and the
+  // per-thread range partitioning all read activeThreads below this point.
+  [[maybe_unused]] unsigned saved_active_threads = activeThreads;
+  constexpr bool HAS_WIDTH_OVERRIDE =
+      has_trait<num_threads_tag, ArgsT>() ||
+      has_trait<performance_cores_tag, ArgsT>();
+  if constexpr (HAS_WIDTH_OVERRIDE) {
+    if (!GetThreadPool().isRunning()) {
+      unsigned width = activeThreads;
+      if constexpr (has_trait<num_threads_tag, ArgsT>()) {
+        width = get_trait_value<num_threads_tag>(argsT).value;
+      }
+      if constexpr (has_trait<performance_cores_tag, ArgsT>()) {
+        width = std::min(width, GetThreadPool().getMaxPerformanceThreads());
+      }
+      activeThreads = std::min(
+          std::max(1U, width), GetThreadPool().getMaxUsableThreads());
+    }
+  }
 
   OperatorReferenceType<decltype(std::forward<F>(func))> func_ref = func;
-  internal::ChooseDoAllImpl<STEAL>::call(range, func_ref, argsT);
+  if (GetThreadPool().isRunning()) {
+    // Nested parallel region: the pool's threads are committed to the
+    // enclosing region, so run this loop serially on the calling thread
+    // rather than re-entering the pool.
+    for (auto ii = range.begin(), ei = range.end(); ii != ei; ++ii) {
+      func_ref(*ii);
+    }
+  } else if constexpr (DEQUE_STEAL) {
+    internal::ChooseDoAllDequeImpl::call(range, func_ref, argsT);
+  } else {
+    internal::ChooseDoAllImpl<STEAL>::call(range, func_ref, argsT);
+  }
+
+  if constexpr (HAS_WIDTH_OVERRIDE) {
+    activeThreads = saved_active_threads;
+  }
 
   timer.stop();
 }
@@ -190,6 +190,7 @@ protected:
   FunctionTy origFunction;
   const char* loopname;
   bool broke;
+  SharedLoopProgress loop_progress{loopname};
 
   PerThreadTimer<MORE_STATS> initTime;
   PerThreadTimer<MORE_STATS> execTime;
@@ -303,6 +304,7 @@ protected:
 
     // Thread-local data goes on the local stack to be NUMA friendly
     ThreadLocalData tld(origFunction, loopname);
+    tld.attach_progress(&loop_progress);
     if (needsBreak)
       tld.facing.setBreakFlag(&broke);
     if (couldAbort)
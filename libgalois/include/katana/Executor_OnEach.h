@@ -62,7 +62,15 @@ on_each_impl(FunctionTy&& fn, const ArgsTy& argsTuple) {
   };
 
   timer.start();
-  GetThreadPool().run(numT, runFun);
+  if (GetThreadPool().isRunning()) {
+    // Nested parallel region: run on the calling thread only, presenting a
+    // single-thread team so per-thread partitioning stays correct.
+    execTime.start();
+    fn_ref(0, 1);
+    execTime.stop();
+  } else {
+    GetThreadPool().run(numT, runFun);
+  }
   timer.stop();
 }
 
@@ -25,6 +25,7 @@
 #include <cstdlib>
 #include <ctime>
 #include <deque>
+#include <iosfwd>
 #include <random>
 #include <vector>
 
@@ -43,6 +44,21 @@ namespace katana {
 
 namespace parameter {
 
+// In-memory mirror of the per-step CSV records; feeds the JSON summary
+// written by WriteStatsJson. A record with step == 0 starts a new loop
+// profile.
+KATANA_EXPORT void RecordStep(
+    const char* loopname, size_t step, size_t parallelism, size_t wlSize,
+    size_t nhSize);
+
+/// Write a JSON summary of every loop profiled so far: critical-path
+/// length in steps, total iterations, average and maximum available
+/// parallelism, and the per-step parallelism profile. Written
+/// automatically to $KATANA_PARAMETER_JSON (if set) whenever a profiled
+/// loop finishes, so benchmark harnesses can pick it up without calling
+/// this directly.
+KATANA_EXPORT void WriteStatsJson(std::ostream& out);
+
 struct StepStatsBase {
   static inline void printHeader(FILE* out) {
     fprintf(
@@ -56,6 +72,7 @@ struct StepStatsBase {
     fprintf(
         out, "%s, %zu, %zu, %zu, %zu\n", loopname, step, parallelism, wlSize,
         nhSize);
+    RecordStep(loopname, step, parallelism, wlSize, nhSize);
   }
 };
 
@@ -454,11 +471,12 @@ struct ForEachExecutor<katana::ParaMeter<T>, FunctionTy, ArgsTy>
 template <typename R, typename F, typename ArgsTuple>
 void
 for_each_ParaMeter(const R& range, const F& func, const ArgsTuple& argsTuple) {
-  using T = typename R::values_type;
+  using T = typename R::value_type;
 
-  auto tpl = katana::get_default_trait_values(
-      argsTuple, std::make_tuple(wl_tag{}),
-      std::make_tuple(wl<katana::ParaMeter<>>()));
+  auto tpl = std::tuple_cat(
+      argsTuple, katana::get_default_trait_values(
+                     argsTuple, std::make_tuple(wl_tag{}),
+                     std::make_tuple(wl<katana::ParaMeter<>>())));
 
   using Tpl_ty = decltype(tpl);
 
@@ -468,6 +486,25 @@ for_each_ParaMeter(const R& range, const F& func, const ArgsTuple& argsTuple) {
   exec.execute(range);
 }
 
+//! Profile a do_all style loop with ParaMeter. do_all iterations are
+//! independent by contract, so the entire range is available in a
+//! single step (critical path 1); recording it puts data-parallel
+//! phases in the same JSON summary as the amorphous loops, which is
+//! what matters when judging whether a whole workload can fill a larger
+//! machine.
+template <typename R, typename F, typename ArgsTuple>
+void
+do_all_ParaMeter(const R& range, F&& func, const ArgsTuple& argsTuple) {
+  const char* loopname = internal::getLoopName(argsTuple);
+  size_t size = std::distance(range.begin(), range.end());
+
+  parameter::StepStatsBase::dump(
+      parameter::getStatsFile(), loopname, 0, size, size, 0);
+  parameter::closeStatsFile();
+
+  do_all_gen(range, std::forward<F>(func), argsTuple);
+}
+
 }  // end namespace katana
 #endif
 
@@ -0,0 +1,124 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+#ifndef KATANA_LIBGALOIS_KATANA_EXECUTORPROPAGATIONBLOCKED_H_
+#define KATANA_LIBGALOIS_KATANA_EXECUTORPROPAGATIONBLOCKED_H_
+
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "katana/Loops.h"
+#include "katana/PagePool.h"
+#include "katana/Threads.h"
+
+namespace katana {
+
+/// Number of low destination-ID bits that share a propagation bin. A bin
+/// covers 1 << kPropagationBinBits destination slots, so with 8-byte values
+/// the destination slice a bin touches is 256 KiB -- resident in L2 while
+/// the bin drains.
+constexpr unsigned kPropagationBinBits = 15;
+
+/// Two-phase gather/scatter loop for operators whose only irregular accesses
+/// are updates to a large destination-indexed array (pull-mode pagerank,
+/// degree counting, histogramming over neighbors).
+///
+/// Phase 1 (binning): each thread walks its share of range and calls
+/// emit_fn(item, sink); every sink(dest, value) call appends a (dest, value)
+/// record to a thread-private bin selected by dest >> bin_bits. Records live
+/// in page-sized blocks from the PagePool, so this phase is purely
+/// sequential writes.
+///
+/// Phase 2 (accumulation): bins are distributed over threads with do_all.
+/// Draining one bin replays every thread's records for it, so all
+/// apply_fn(dest, value) calls land in the same (1 << bin_bits)-slot slice
+/// of the destination array and hit cache. Distinct bins cover disjoint
+/// destination ranges and a bin is drained by exactly one thread, so
+/// apply_fn needs no atomics.
+template <typename Value, typename RangeTy, typename EmitFn, typename ApplyFn>
+void
+do_all_propagation_blocked(
+    const RangeTy& range, uint64_t num_dests, EmitFn emit_fn, ApplyFn apply_fn,
+    unsigned bin_bits = kPropagationBinBits) {
+  static_assert(
+      std::is_trivially_copyable<Value>::value,
+      "binned values are stored by memcpy semantics");
+
+  struct Record {
+    uint64_t dest;
+    Value value;
+  };
+  // Block header; records fill the rest of the page.
+  struct Block {
+    Block* next;
+    uint32_t count;
+  };
+  const uint32_t records_per_block =
+      (allocSize() - sizeof(Block)) / sizeof(Record);
+  auto records_of = [](Block* block) {
+    return reinterpret_cast<Record*>(block + 1);
+  };
+
+  const uint64_t num_bins = (num_dests >> bin_bits) + 1;
+  const unsigned num_threads = getActiveThreads();
+
+  std::vector<std::vector<Block*>> bins(
+      num_threads, std::vector<Block*>(num_bins, nullptr));
+
+  on_each([&](unsigned tid, unsigned) {
+    std::vector<Block*>& my_bins = bins[tid];
+    auto sink = [&](uint64_t dest, const Value& value) {
+      Block*& head = my_bins[dest >> bin_bits];
+      if (head == nullptr || head->count == records_per_block) {
+        Block* fresh = static_cast<Block*>(pagePoolAlloc());
+        fresh->next = head;
+        fresh->count = 0;
+        head = fresh;
+      }
+      records_of(head)[head->count++] = Record{dest, value};
+    };
+    for (auto it = range.local_begin(), end = range.local_end(); it != end;
+         ++it) {
+      emit_fn(*it, sink);
+    }
+  });
+
+  do_all(
+      iterate(uint64_t{0}, num_bins),
+      [&](uint64_t bin) {
+        for (unsigned tid = 0; tid < num_threads; ++tid) {
+          Block* block = bins[tid][bin];
+          while (block != nullptr) {
+            const Record* records = records_of(block);
+            for (uint32_t i = 0; i < block->count; ++i) {
+              apply_fn(records[i].dest, records[i].value);
+            }
+            Block* drained = block;
+            block = block->next;
+            pagePoolFree(drained);
+          }
+        }
+      },
+      steal(), no_stats());
+}
+
+}  // namespace katana
+
+#endif
@@ -35,6 +35,7 @@ struct KATANA_EXPORT ThreadTopoInfo {
   unsigned cumulativeMaxSocket;  // max socket id seen from [0, tid]
   unsigned osContext;            // OS ID to use for thread binding
   unsigned osNumaNode;           // OS ID for numa node
+  unsigned coreClass;            // 0 = performance, 1 = efficiency core
 };
 
 struct KATANA_EXPORT MachineTopoInfo {
@@ -42,6 +43,11 @@ struct KATANA_EXPORT MachineTopoInfo {
   unsigned maxCores;
   unsigned maxSockets;
   unsigned maxNumaNodes;
+  // length of the leading run of tids on performance-class cores; on
+  // homogeneous machines this equals maxThreads. Thread numbering places
+  // efficiency cores after the primary contexts of performance cores, so
+  // running a loop on this many threads keeps it off the efficiency cores.
+  unsigned maxPerformanceThreads;
 };
 
 struct KATANA_EXPORT HWTopoInfo {
@@ -66,6 +72,14 @@ KATANA_EXPORT std::vector<int> parseCPUList(const std::string& in);
  */
 KATANA_EXPORT bool bindThreadSelf([[maybe_unused]] unsigned osContext);
 
+/**
+ * bindThreadToCPUSet binds the calling thread to the given set of OS CPU ids
+ * (osContext values), letting the OS schedule it anywhere within the set.
+ * Used when a thread's home core has been excluded from the process's core
+ * set and an exact binding is no longer possible.
+ */
+KATANA_EXPORT bool bindThreadToCPUSet(const std::vector<int>& os_cpus);
+
 }  // namespace katana
 
 #endif
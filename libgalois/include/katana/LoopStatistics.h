@@ -20,11 +20,83 @@
 #ifndef KATANA_LIBGALOIS_KATANA_LOOPSTATISTICS_H_
 #define KATANA_LIBGALOIS_KATANA_LOOPSTATISTICS_H_
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+
+#include "katana/ProgressTracer.h"
 #include "katana/Statistics.h"
+#include "katana/ThreadPool.h"
 #include "katana/config.h"
 
 namespace katana {
 
+/**
+ * Live, loop-wide progress counters for one running parallel loop.
+ *
+ * The per-thread LoopStatistics aggregate only at loop end, which makes
+ * a multi-hour for_each a black box while it runs. Threads attached to
+ * a SharedLoopProgress flush their counter deltas into it in batches
+ * (see LoopStatistics::kProgressFlushPeriod), and the master thread
+ * periodically logs a snapshot — iterations, commits, pushes, conflict
+ * rate, elapsed time — into the active ProgressTracer span. Emission
+ * starts a second into the loop and the interval doubles up to a
+ * minute, so short loops log nothing and long runs converge to one line
+ * a minute rather than spamming the trace.
+ */
+class SharedLoopProgress {
+  std::atomic<uint64_t> iterations_{0};
+  std::atomic<uint64_t> pushes_{0};
+  std::atomic<uint64_t> conflicts_{0};
+  std::chrono::steady_clock::time_point start_;
+  // Only the master thread reads or advances the emission schedule.
+  int64_t next_emit_ms_{1000};
+  int64_t interval_ms_{1000};
+  const char* loopname_;
+
+  static constexpr int64_t kMaxIntervalMs = 60 * 1000;
+
+public:
+  explicit SharedLoopProgress(const char* ln)
+      : start_(std::chrono::steady_clock::now()),
+        loopname_(ln ? ln : "(NULL)") {}
+
+  void Accumulate(uint64_t iterations, uint64_t pushes, uint64_t conflicts) {
+    iterations_.fetch_add(iterations, std::memory_order_relaxed);
+    pushes_.fetch_add(pushes, std::memory_order_relaxed);
+    conflicts_.fetch_add(conflicts, std::memory_order_relaxed);
+  }
+
+  /// Log a snapshot into the active span if this is the master thread
+  /// and the current emission interval has elapsed.
+  void MaybeEmit() {
+    if (ThreadPool::getTID() != 0) {
+      return;
+    }
+    int64_t elapsed_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                             std::chrono::steady_clock::now() - start_)
+                             .count();
+    if (elapsed_ms < next_emit_ms_) {
+      return;
+    }
+    interval_ms_ = std::min(interval_ms_ * 2, kMaxIntervalMs);
+    next_emit_ms_ = elapsed_ms + interval_ms_;
+
+    uint64_t iterations = iterations_.load(std::memory_order_relaxed);
+    uint64_t conflicts = conflicts_.load(std::memory_order_relaxed);
+    GetTracer().GetActiveSpan().Log(
+        "loop progress",
+        {
+            {"loopname", loopname_},
+            {"iterations", iterations},
+            {"commits", iterations - conflicts},
+            {"pushes", pushes_.load(std::memory_order_relaxed)},
+            {"conflicts", conflicts},
+            {"elapsed_ms", elapsed_ms},
+        });
+  }
+};
+
 // Usually instantiated per thread
 template <bool Enabled>
 class LoopStatistics {
@@ -34,6 +106,25 @@ protected:
   size_t m_conflicts;
   const char* loopname;
 
+  SharedLoopProgress* progress_{nullptr};
+  size_t flushed_iterations_{0};
+  size_t flushed_pushes_{0};
+  size_t flushed_conflicts_{0};
+
+  //! Iterations between flushes into the attached SharedLoopProgress;
+  //! amortizes the shared atomics down to noise.
+  static constexpr size_t kProgressFlushPeriod = 1024;
+
+  void flush_progress() {
+    progress_->Accumulate(
+        m_iterations - flushed_iterations_, m_pushes - flushed_pushes_,
+        m_conflicts - flushed_conflicts_);
+    flushed_iterations_ = m_iterations;
+    flushed_pushes_ = m_pushes;
+    flushed_conflicts_ = m_conflicts;
+    progress_->MaybeEmit();
+  }
+
 public:
   explicit LoopStatistics(const char* ln)
       : m_iterations(0), m_pushes(0), m_conflicts(0), loopname(ln) {}
@@ -49,9 +140,17 @@ public:
   size_t pushes() const { return m_pushes; }
   size_t conflicts() const { return m_conflicts; }
 
+  //! Stream live counters into progress; see SharedLoopProgress.
+  void attach_progress(SharedLoopProgress* progress) { progress_ = progress; }
+
   inline void inc_pushes(size_t v) { m_pushes += v; }
 
-  inline void inc_iterations() { ++m_iterations; }
+  inline void inc_iterations() {
+    ++m_iterations;
+    if (progress_ && (m_iterations % kProgressFlushPeriod) == 0) {
+      flush_progress();
+    }
+  }
 
   inline void inc_conflicts() { ++m_conflicts; }
 };
@@ -65,6 +164,8 @@ public:
   size_t pushes() const { return 0; }
   size_t conflicts() const { return 0; }
 
+  void attach_progress(SharedLoopProgress*) const {}
+
   inline void inc_iterations() const {}
   inline void inc_pushes(size_t) const {}
   inline void inc_conflicts() const {}
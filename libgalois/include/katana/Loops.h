@@ -88,6 +88,57 @@ on_each(FunctionTy&& fn, Args&&... args) {
       std::make_tuple(std::forward<Args>(args)...));
 }
 
+//! Block boundaries handed out by @ref do_all_vectorized are multiples of
+//! this many elements, so vector lanes stay aligned for any element width
+//! when the underlying arrays are 64-byte aligned (NUMAArray pages and
+//! arrow buffers both are).
+constexpr size_t kVectorBlockAlign = 64;
+
+/**
+ * Parallel loop for elementwise updates over contiguous arrays (rank
+ * scaling, decay, normalization) that should compile to vector code.
+ *
+ * Operator should conform to <code>fn(size_t begin, size_t end)</code> and
+ * is invoked exactly once per thread with a contiguous, disjoint index
+ * block covering [0, num_items) in total. Because the body is a plain
+ * counted loop written by the caller over raw arrays, there is no
+ * per-element call through the operator indirection and the compiler can
+ * auto-vectorize it; pair with @ref AssumeAligned and restrict-qualified
+ * local pointers for best codegen.
+ *
+ * @param num_items extent of the index space
+ * @param fn operator over an index block
+ * @param args optional arguments to loop, e.g., {@see loopname}
+ */
+template <typename FunctionTy, typename... Args>
+void
+do_all_vectorized(size_t num_items, FunctionTy&& fn, Args&&... args) {
+  on_each(
+      [&fn, num_items](unsigned tid, unsigned total) {
+        size_t block = (num_items + total - 1) / total;
+        block = (block + kVectorBlockAlign - 1) / kVectorBlockAlign *
+                kVectorBlockAlign;
+        size_t begin = std::min(tid * block, num_items);
+        size_t end = std::min(begin + block, num_items);
+        if (begin < end) {
+          fn(begin, end);
+        }
+      },
+      std::forward<Args>(args)...);
+}
+
+/**
+ * Returns ptr annotated with the given byte alignment (a cache line by
+ * default) for the optimizer. Callers of @ref do_all_vectorized use this on
+ * their array bases so the compiler emits aligned vector loads instead of
+ * peeling loops.
+ */
+template <size_t Alignment = 64, typename T>
+inline T*
+AssumeAligned(T* ptr) {
+  return static_cast<T*>(__builtin_assume_aligned(ptr, Alignment));
+}
+
 /**
  * Galois ordered set iterator for stable source algorithms.
  *
@@ -10,11 +10,35 @@
 namespace katana {
 /// Define a memory policy
 
+/// Memory tiers a policy can place regions on. kFarMemory is a CPU-less NUMA
+/// node backed by a CXL expander or similar large-but-slow memory;
+/// kLocalDRAM is the near tier where first-touch places pages by default.
+enum class MemoryTier { kLocalDRAM, kFarMemory };
+
+/// What a region of memory holds, from the tiering policy's point of view.
+enum class MemoryUse { kTopology, kPropertyColumn, kOutOfCoreBuffer };
+
 /// The policy virtual base class
 class KATANA_EXPORT MemoryPolicy {
 public:
   virtual ~MemoryPolicy();
 
+  /// Which tier should memory with the given use live on? The default keeps
+  /// hot topology on local DRAM and places cold property columns and
+  /// out-of-core buffers on the far tier when one is configured; without a
+  /// far tier everything is local.
+  virtual MemoryTier TierFor(MemoryUse use) const;
+
+  /// NUMA node of the far-memory tier, configured with the environment
+  /// variable KATANA_FAR_MEMORY_NODE, or -1 when there is no far tier.
+  static int FarMemoryNode();
+
+  /// Bind the pages of [addr, addr+len) to the given tier, migrating
+  /// already-faulted pages when moving to the far tier. \p addr must be page
+  /// aligned. Fails if no far tier is configured or the platform lacks
+  /// mbind.
+  static Result<void> BindRegion(void* addr, size_t len, MemoryTier tier);
+
   /// Given the current memory counts and whatever OS sources the policy consults,
   /// how much standby memory should we reclaim right now?
   virtual count_t ReclaimForMemoryPressure(count_t standby) const = 0;
@@ -100,6 +124,8 @@ public:
   count_t ReclaimForMemoryPressure(count_t standby) const override;
   bool IsMemoryPressureHigh(count_t standby) const override;
   bool KillSelfForLackOfMemory(count_t standby) const override;
+  /// The null policy never demotes anything to far memory.
+  MemoryTier TierFor(MemoryUse use) const override;
 };
 
 }  // namespace katana
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "katana/Result.h"
+#include "katana/config.h"
+
+namespace katana {
+
+/// Admission control for concurrent queries that would otherwise
+/// oversubscribe memory.
+///
+/// A query declares its estimated working set up front (computed from the
+/// topology size and its Plan) and holds a MemoryReservation for the
+/// duration of its run. The admission controller grants reservations
+/// against a process-wide budget — 80% of physical memory by default,
+/// overridable with KATANA_ADMISSION_BUDGET_BYTES — and queues requests
+/// that do not fit, admitting them FIFO as running queries release their
+/// grants. Queued queries wait instead of allocating, so concurrent
+/// analytics degrade to sequential execution rather than OOM mid-flight.
+///
+/// While a reservation is installed on a thread (see Scope), NUMAArray
+/// allocations on that thread draw against it, which turns the declared
+/// estimate into a measured working set: under-declared queries log a
+/// warning with both numbers so estimates can be fixed rather than
+/// silently trusted.
+class KATANA_EXPORT MemoryReservation {
+public:
+  /// Block until \p estimated_bytes fit in the admission budget.
+  /// A request larger than the whole budget is admitted once it is the
+  /// only query running, with a warning, instead of deadlocking.
+  MemoryReservation(std::string query_name, uint64_t estimated_bytes);
+
+  /// Non-blocking variant; fails with ErrorCode::OutOfMemory when the
+  /// grant does not fit right now or queued queries are ahead of it.
+  static Result<std::unique_ptr<MemoryReservation>> TryMake(
+      std::string query_name, uint64_t estimated_bytes);
+
+  /// Releases the grant and wakes queued queries.
+  ~MemoryReservation();
+
+  MemoryReservation(const MemoryReservation&) = delete;
+  MemoryReservation& operator=(const MemoryReservation&) = delete;
+
+  uint64_t estimated_bytes() const { return estimated_bytes_; }
+
+  /// Bytes of NUMAArray allocations currently drawn against this
+  /// reservation.
+  uint64_t charged_bytes() const;
+
+  /// Installs a reservation as the current thread's account for the
+  /// lifetime of the scope; nested scopes restore the previous one.
+  class KATANA_EXPORT Scope {
+  public:
+    explicit Scope(MemoryReservation* reservation);
+    ~Scope();
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+  private:
+    MemoryReservation* previous_;
+  };
+
+  /// \internal Account \p bytes of allocation against this reservation;
+  /// called through the thread-local hook, not by analytics directly.
+  void Charge(uint64_t bytes);
+  void Release(uint64_t bytes);
+
+private:
+  struct AdmitNow {};
+  MemoryReservation(std::string query_name, uint64_t estimated_bytes, AdmitNow);
+
+  std::string query_name_;
+  uint64_t estimated_bytes_;
+  std::atomic<uint64_t> charged_{0};
+  std::atomic<bool> warned_over_estimate_{false};
+};
+
+namespace internal {
+
+/// Draw \p bytes against the current thread's reservation, if one is
+/// installed. Called by NUMAArray; cheap (a thread-local test) when no
+/// reservation is active.
+KATANA_EXPORT void ChargeCurrentReservation(uint64_t bytes);
+KATANA_EXPORT void ReleaseCurrentReservation(uint64_t bytes);
+
+/// The reservation installed on this thread, or null.
+KATANA_EXPORT MemoryReservation* CurrentReservation();
+
+}  // namespace internal
+
+}  // namespace katana
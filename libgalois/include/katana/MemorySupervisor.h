@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 #include "katana/Cache.h"
 #include "katana/Manager.h"
@@ -67,11 +68,30 @@ public:
   /// aggressively to deallocate.
   void SetPolicy(std::unique_ptr<MemoryPolicy> policy);
 
+  /// Register a manager for another reclaimable resource (e.g., cached
+  /// topology views). The supervisor will ask it to free memory under
+  /// pressure like the managers it creates itself.
+  void RegisterManager(std::unique_ptr<Manager> manager);
+  /// Remove a previously registered manager; any standby memory it still
+  /// reports is dropped from the books.
+  void UnregisterManager(const std::string& name);
+
   /// Provide access to a property manager, which manages the property cache
   PropertyManager* GetPropertyManager();
   CacheStats GetPropertyCacheStats() const;
   void LogMemoryStats(const std::string& message);
 
+  /// Sample memory movement counters and report the deltas since the
+  /// previous call through ReportStatSum under \p region (pass the name
+  /// of the parallel region or phase being measured). Always reports
+  /// the kernel's NUMA page placement counters (local/remote pages and
+  /// a remote percentage); where the integrated memory controller
+  /// uncore PMUs are readable it also reports per-socket bytes moved to
+  /// and from DRAM, which separates bandwidth-bound runs from
+  /// imbalance-bound ones. The first call establishes the baseline and
+  /// reports nothing.
+  void ReportNumaTraffic(const std::string& region);
+
   /// Calls sysconf
   static uint64_t GetTotalSystemMemory();
 
@@ -112,6 +132,23 @@ private:
 
   /// Statistics: bytes reclaimed
   count_t bytes_reclaimed_{};
+
+  /// One open uncore memory-controller counter; socket says which
+  /// socket's DRAM traffic it counts.
+  struct UncoreCounter {
+    int fd{-1};
+    unsigned socket{0};
+  };
+  /// Opens the IMC counters on first use; empty when unavailable.
+  void OpenUncoreCounters();
+  std::vector<UncoreCounter> uncore_counters_;
+  bool uncore_opened_{false};
+
+  /// Previous samples so traffic reports are deltas.
+  std::vector<uint64_t> last_numa_local_;
+  std::vector<uint64_t> last_numa_other_;
+  std::vector<uint64_t> last_uncore_;
+  bool have_traffic_baseline_{false};
 };
 
 }  // namespace katana
@@ -0,0 +1,239 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+#ifndef KATANA_LIBGALOIS_KATANA_MULTIQUEUE_H_
+#define KATANA_LIBGALOIS_KATANA_MULTIQUEUE_H_
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "katana/PaddedLock.h"
+#include "katana/PerThreadStorage.h"
+#include "katana/PriorityQueue.h"
+#include "katana/ThreadPool.h"
+#include "katana/WLCompileCheck.h"
+#include "katana/config.h"
+
+namespace katana {
+
+/**
+ * Relaxed concurrent priority scheduling via a MultiQueue.
+ *
+ * Maintains QueuesPerThread sequential min-heaps per thread, each behind
+ * its own padded lock. A push goes to a random heap; a pop locks two
+ * random heaps and takes from the one with the smaller minimum, so the
+ * popped element is near-minimal with high probability but not exactly
+ * minimal. Threads batch their pushes and pops through thread-local
+ * buffers, amortizing one lock acquisition over BatchSize elements.
+ *
+ * Use this instead of OrderedByIntegerMetric when priorities do not bin
+ * well into a small number of integers — e.g. float edge weights
+ * spanning many orders of magnitude, where OBIM either explodes into
+ * millions of bins or loses all priority resolution:
+ *
+ * \code
+ * katana::for_each(katana::iterate(graph), fn,
+ *     katana::wl<katana::MultiQueue<std::less<UpdateRequest>,
+ *                                   UpdateRequest>>());
+ * \endcode
+ *
+ * Relaxation trades strict priority order for scalability; operators
+ * must tolerate out-of-order execution (true for the usual
+ * label-correcting algorithms such as SSSP and BFS variants).
+ */
+template <
+    class Compare = std::less<int>, typename T = int, bool Concurrent = true,
+    unsigned QueuesPerThread = 4, unsigned BatchSize = 16>
+class MultiQueue {
+  using Heap = MinHeap<T, Compare>;
+  using Lock = PaddedLock<Concurrent>;
+
+  struct Queue {
+    Lock lock;
+    Heap heap;
+  };
+
+  struct ThreadData {
+    /// Elements popped in a batch, consumed front to back so they are
+    /// processed in priority order.
+    std::vector<T> pop_buffer;
+    size_t pop_index = 0;
+    std::vector<T> push_buffer;
+    uint64_t rng_state = 0;
+  };
+
+  /// Retry budget for the optimistic two-choice refill before falling
+  /// back to a full sweep of all queues.
+  constexpr static unsigned kRefillTries = 4;
+
+  std::vector<Queue> queues_;
+  PerThreadStorage<ThreadData> thread_data_;
+
+  static uint64_t NextRandom(ThreadData& data) {
+    // xorshift64; seeded lazily from the thread id so the worklist can
+    // be constructed before the thread pool runs.
+    uint64_t x = data.rng_state;
+    if (x == 0) {
+      x = (ThreadPool::getTID() + 1) * 0x9E3779B97F4A7C15ULL;
+    }
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    data.rng_state = x;
+    return x;
+  }
+
+  size_t RandomQueue(ThreadData& data) {
+    return NextRandom(data) % queues_.size();
+  }
+
+  void Flush(ThreadData& data) {
+    if (data.push_buffer.empty()) {
+      return;
+    }
+    Queue* q = &queues_[RandomQueue(data)];
+    // Prefer an uncontended queue; any queue is correct.
+    if (!q->lock.try_lock()) {
+      q = &queues_[RandomQueue(data)];
+      q->lock.lock();
+    }
+    for (const T& item : data.push_buffer) {
+      q->heap.push(item);
+    }
+    q->lock.unlock();
+    data.push_buffer.clear();
+  }
+
+  /// Pop up to BatchSize elements of q's heap into the pop buffer.
+  /// Caller holds q's lock.
+  void TakeBatch(ThreadData& data, Queue& q) {
+    for (unsigned i = 0; i < BatchSize && !q.heap.empty(); ++i) {
+      data.pop_buffer.push_back(q.heap.pop());
+    }
+  }
+
+  bool Refill(ThreadData& data) {
+    for (unsigned t = 0; t < kRefillTries; ++t) {
+      size_t i1 = RandomQueue(data);
+      size_t i2 = RandomQueue(data);
+      if (i1 > i2) {
+        std::swap(i1, i2);
+      }
+      Queue& q1 = queues_[i1];
+      Queue& q2 = queues_[i2];
+      bool locked1 = q1.lock.try_lock();
+      bool locked2 = i1 != i2 && q2.lock.try_lock();
+
+      Queue* victim = nullptr;
+      if (locked1 && !q1.heap.empty()) {
+        victim = &q1;
+      }
+      if (locked2 && !q2.heap.empty()) {
+        if (victim == nullptr ||
+            Compare()(q2.heap.top(), victim->heap.top())) {
+          victim = &q2;
+        }
+      }
+      if (locked1 && victim != &q1) {
+        q1.lock.unlock();
+      }
+      if (locked2 && victim != &q2) {
+        q2.lock.unlock();
+      }
+      if (victim != nullptr) {
+        TakeBatch(data, *victim);
+        victim->lock.unlock();
+        return true;
+      }
+    }
+
+    // Slow path: sweep every queue so an empty result really means the
+    // worklist holds no elements right now.
+    for (Queue& q : queues_) {
+      q.lock.lock();
+      if (!q.heap.empty()) {
+        TakeBatch(data, q);
+        q.lock.unlock();
+        return true;
+      }
+      q.lock.unlock();
+    }
+    return false;
+  }
+
+public:
+  template <typename Tnew>
+  using retype =
+      MultiQueue<Compare, Tnew, Concurrent, QueuesPerThread, BatchSize>;
+
+  template <bool b>
+  using rethread = MultiQueue<Compare, T, b, QueuesPerThread, BatchSize>;
+
+  typedef T value_type;
+
+  MultiQueue() : queues_(QueuesPerThread * GetThreadPool().getMaxThreads()) {}
+
+  MultiQueue(const MultiQueue&) = delete;
+  MultiQueue& operator=(const MultiQueue&) = delete;
+
+  void push(const value_type& val) {
+    ThreadData& data = *thread_data_.getLocal();
+    data.push_buffer.push_back(val);
+    if (data.push_buffer.size() >= BatchSize) {
+      Flush(data);
+    }
+  }
+
+  template <typename Iter>
+  void push(Iter b, Iter e) {
+    for (; b != e; ++b) {
+      push(*b);
+    }
+  }
+
+  template <typename RangeTy>
+  void push_initial(const RangeTy& range) {
+    push(range.local_begin(), range.local_end());
+    Flush(*thread_data_.getLocal());
+  }
+
+  std::optional<value_type> pop() {
+    ThreadData& data = *thread_data_.getLocal();
+    if (data.pop_index < data.pop_buffer.size()) {
+      return data.pop_buffer[data.pop_index++];
+    }
+    data.pop_buffer.clear();
+    data.pop_index = 0;
+
+    // Make our own deferred pushes visible before declaring emptiness;
+    // without this a thread could starve the pool on work it buffered
+    // itself.
+    Flush(data);
+
+    if (!Refill(data)) {
+      return std::nullopt;
+    }
+    return data.pop_buffer[data.pop_index++];
+  }
+};
+KATANA_WLCOMPILECHECK(MultiQueue)
+
+}  // namespace katana
+#endif
@@ -20,9 +20,11 @@
 #ifndef KATANA_LIBGALOIS_KATANA_NUMAARRAY_H_
 #define KATANA_LIBGALOIS_KATANA_NUMAARRAY_H_
 
+#include <type_traits>
 #include <utility>
 
 #include "katana/Galois.h"
+#include "katana/MemoryReservation.h"
 #include "katana/NumaMem.h"
 #include "katana/ParallelSTL.h"
 #include "katana/config.h"
@@ -52,10 +54,18 @@ class NUMAArray {
   LAptr real_data_;
   T* data_{};
   size_t size_{};
+  /// Admission-control account this allocation was drawn against, if a
+  /// MemoryReservation::Scope was active on the allocating thread. The
+  /// reservation must outlive the array (both are query-scoped).
+  MemoryReservation* reservation_{nullptr};
 
   void Allocate(size_t n, AllocType t) {
     KATANA_LOG_DEBUG_ASSERT(!data_);
     size_ = n;
+    reservation_ = internal::CurrentReservation();
+    if (reservation_) {
+      reservation_->Charge(n * sizeof(T));
+    }
     switch (t) {
     case AllocType::Blocked:
       real_data_ = largeMallocBlocked(n * sizeof(T), activeThreads);
@@ -102,9 +112,13 @@ public:
   NUMAArray() = default;
 
   NUMAArray(NUMAArray&& o) noexcept
-      : real_data_(std::move(o.real_data_)), data_(o.data_), size_(o.size_) {
+      : real_data_(std::move(o.real_data_)),
+        data_(o.data_),
+        size_(o.size_),
+        reservation_(o.reservation_) {
     o.data_ = nullptr;
     o.size_ = 0;
+    o.reservation_ = nullptr;
   }
 
   NUMAArray& operator=(NUMAArray&& o) {
@@ -112,6 +126,7 @@ public:
     std::swap(real_data_, tmp.real_data_);
     std::swap(data_, tmp.data_);
     std::swap(size_, tmp.size_);
+    std::swap(reservation_, tmp.reservation_);
     return *this;
   }
 
@@ -173,6 +188,12 @@ public:
   /**
    * Allocates using no memory policy (no pre alloc)
    *
+   * Construction is O(1): no page is faulted in, so placement follows the
+   * first touch. Combined with constructDefault() this allocates huge
+   * arrays without the page-touching pass the other policies pay up front;
+   * the first parallel traversal places each page on the socket of the
+   * thread that writes it.
+   *
    * @param  n         number of elements to allocate
    */
   void allocateFloating(size_type n) { Allocate(n, AllocType::Floating); }
@@ -195,6 +216,10 @@ public:
         largeMallocSpecified(num * sizeof(T), activeThreads, ranges, sizeof(T));
 
     size_ = num;
+    reservation_ = internal::CurrentReservation();
+    if (reservation_) {
+      reservation_->Charge(num * sizeof(T));
+    }
     data_ = reinterpret_cast<T*>(real_data_.get());
   }
   //! [allocatefunctions]
@@ -211,6 +236,22 @@ public:
     new (&data_[n]) T(std::forward<Args>(args)...);
   }
 
+  /**
+   * Default-initializes all elements instead of value-initializing them
+   * like construct() with no arguments does. For trivially default
+   * constructible T this is a no-op: elements hold indeterminate values,
+   * no page is written, and nothing is zeroed. Use when every element is
+   * overwritten before being read, e.g., adjacency arrays filled by a
+   * build pass.
+   */
+  void constructDefault() {
+    if constexpr (!std::is_trivially_default_constructible_v<T>) {
+      for (T *ii = data_, *ei = data_ + size_; ii != ei; ++ii) {
+        new (ii) T;
+      }
+    }
+  }
+
   //! Allocate and construct
   template <typename... Args>
   void create(size_type n, Args&&... args) {
@@ -219,6 +260,10 @@ public:
   }
 
   void deallocate() {
+    if (reservation_ && real_data_) {
+      reservation_->Release(size_ * sizeof(T));
+    }
+    reservation_ = nullptr;
     real_data_.reset();
     data_ = 0;
     size_ = 0;
@@ -20,11 +20,15 @@
 #ifndef KATANA_LIBGALOIS_KATANA_PARALLELSTL_H_
 #define KATANA_LIBGALOIS_KATANA_PARALLELSTL_H_
 
+#include <algorithm>
+#include <functional>
 #include <iterator>
+#include <vector>
 
 #include "katana/Chunk.h"
 #include "katana/LoopsDecl.h"
 #include "katana/NoDerefIterator.h"
+#include "katana/NumaMem.h"
 #include "katana/Range.h"
 #include "katana/Reduction.h"
 #include "katana/Threads.h"
@@ -525,6 +529,221 @@ copy_if(InputIt first, InputIt last, OutputIt d_first, UnaryPredicate pred) {
   return d_first + prefix_sum.back();
 }
 
+/**
+ * Stream-compacts a bitmap: appends the positions of the set bits of
+ * bitset, in increasing order, to *out.
+ *
+ * Two word-wise passes over the backing words of the bitset. The first
+ * counts each thread's block with popcount (a loop the compiler
+ * vectorizes) to place every block's output cursor; the second walks
+ * each word's set bits with count-trailing-zeros and writes indices at
+ * the cursor. Both passes stream the bitmap once, so conversion of a
+ * dense bitmap into a sparse worklist runs at memory bandwidth instead
+ * of testing one bit at a time.
+ *
+ * Bitset is DynamicBitset (taken as a template parameter to keep this
+ * header out of its include cycle): get_vec() must expose the backing
+ * 64-bit words with the bits past size() zeroed. OutputVector needs
+ * value_type, size(), resize() and operator[]; PODVector is the
+ * intended container because its resize() leaves the appended payload
+ * uninitialized. Do not call in a parallel region.
+ */
+template <class Bitset, class OutputVector>
+void
+copy_set_bits(const Bitset& bitset, OutputVector* out) {
+  using Integer = typename OutputVector::value_type;
+
+  const auto& words = bitset.get_vec();
+  const size_t num_words = words.size();
+  const unsigned num_blocks = getActiveThreads();
+
+  std::vector<size_t> block_counts(num_blocks);
+  on_each([&](unsigned tid, unsigned total) {
+    auto [begin, end] = block_range(size_t{0}, num_words, tid, total);
+    size_t count = 0;
+    for (size_t w = begin; w < end; ++w) {
+      count += __builtin_popcountll(words[w]);
+    }
+    block_counts[tid] = count;
+  });
+
+  // Exclusive scan of the block counts; the thread count is tiny, so
+  // this stays serial.
+  size_t total_bits = 0;
+  for (unsigned t = 0; t < num_blocks; ++t) {
+    size_t count = block_counts[t];
+    block_counts[t] = total_bits;
+    total_bits += count;
+  }
+  if (total_bits == 0) {
+    return;
+  }
+
+  const size_t base = out->size();
+  out->resize(base + total_bits);
+
+  on_each([&](unsigned tid, unsigned total) {
+    auto [begin, end] = block_range(size_t{0}, num_words, tid, total);
+    size_t cursor = base + block_counts[tid];
+    for (size_t w = begin; w < end; ++w) {
+      // Bits past size() are zero by the DynamicBitset invariant, so the
+      // last word needs no masking.
+      uint64_t word = words[w];
+      const Integer word_base = static_cast<Integer>(w * 64);
+      while (word != 0) {
+        (*out)[cursor++] = word_base + __builtin_ctzll(word);
+        word &= word - 1;
+      }
+    }
+  });
+}
+
+/**
+ * Bins the elements of [first, last) in parallel. BinFn must map an
+ * element to a bin index less than num_bins. Each thread counts its
+ * block of the input into a buffer it faults in itself (and which is
+ * therefore local to its socket); the buffers are merged bin-parallel
+ * at the end. Combine with partial_sum to build scatter offsets for
+ * bucketing passes like CSR construction.
+ */
+template <class InputIt, class BinFn>
+std::vector<size_t>
+histogram(InputIt first, InputIt last, size_t num_bins, BinFn bin_fn) {
+  const unsigned num_blocks = getActiveThreads();
+  std::vector<std::vector<size_t>> block_counts(num_blocks);
+
+  on_each([&](unsigned tid, unsigned total) {
+    auto [begin, end] = block_range(first, last, tid, total);
+    auto& counts = block_counts[tid];
+    counts.assign(num_bins, 0);
+    for (; begin != end; ++begin) {
+      ++counts[bin_fn(*begin)];
+    }
+  });
+
+  std::vector<size_t> bins(num_bins);
+  do_all(iterate(size_t{0}, num_bins), [&](size_t b) {
+    size_t sum = 0;
+    for (unsigned t = 0; t < num_blocks; ++t) {
+      sum += block_counts[t][b];
+    }
+    bins[b] = sum;
+  });
+
+  return bins;
+}
+
+/**
+ * Stable parallel sort of [first, last) by an unsigned integral key.
+ *
+ * Least-significant-digit radix sort: one histogram pass and one
+ * scatter pass per occupied 8 bits of key, through an interleaved
+ * scratch buffer of equal size. Runtime is linear in the input rather
+ * than the n log n of sort(), and elements with equal keys keep their
+ * input order, which sort() does not guarantee. Passes over key bytes
+ * that no element uses are skipped, so narrow key ranges cost few
+ * passes even for wide key types. Requires random access iterators and
+ * a trivially copyable value type; small inputs fall back to
+ * std::stable_sort.
+ */
+template <class RandomAccessIterator, class KeyFn>
+void
+stable_sort_by_key(
+    RandomAccessIterator first, RandomAccessIterator last, KeyFn key_fn) {
+  using value_type =
+      typename std::iterator_traits<RandomAccessIterator>::value_type;
+  using key_type = std::decay_t<decltype(key_fn(*first))>;
+  static_assert(
+      std::is_unsigned_v<key_type>,
+      "stable_sort_by_key requires an unsigned integral key");
+  static_assert(
+      std::is_trivially_copyable_v<value_type>,
+      "stable_sort_by_key scatters elements with raw copies");
+
+  constexpr unsigned kDigitBits = 8;
+  constexpr size_t kNumBuckets = size_t{1} << kDigitBits;
+
+  const size_t num_elems = std::distance(first, last);
+  if (num_elems < 1024 || getActiveThreads() == 1) {
+    std::stable_sort(
+        first, last, [&](const value_type& a, const value_type& b) {
+          return key_fn(a) < key_fn(b);
+        });
+    return;
+  }
+
+  // Skip passes over key bytes no element uses.
+  const key_type used_bits = map_reduce(
+      first, last, [&](const value_type& v) { return key_fn(v); },
+      std::bit_or<key_type>(), key_type{0});
+  unsigned num_passes = 0;
+  for (key_type bits = used_bits; bits != 0; bits >>= kDigitBits) {
+    ++num_passes;
+  }
+  if (num_passes == 0) {
+    return;
+  }
+
+  const unsigned num_blocks = getActiveThreads();
+  LAptr scratch_mem =
+      largeMallocInterleaved(num_elems * sizeof(value_type), num_blocks);
+  value_type* scratch = static_cast<value_type*>(scratch_mem.get());
+
+  std::vector<std::vector<size_t>> block_counts(num_blocks);
+  const size_t block_size = (num_elems + num_blocks - 1) / num_blocks;
+
+  for (unsigned pass = 0; pass < num_passes; ++pass) {
+    const unsigned shift = pass * kDigitBits;
+    const bool from_input = (pass % 2 == 0);
+
+    auto src_at = [&](size_t i) -> value_type {
+      return from_input ? first[i] : scratch[i];
+    };
+
+    on_each([&](unsigned tid, unsigned) {
+      const size_t begin = std::min(tid * block_size, num_elems);
+      const size_t end = std::min(begin + block_size, num_elems);
+      auto& counts = block_counts[tid];
+      counts.assign(kNumBuckets, 0);
+      for (size_t i = begin; i < end; ++i) {
+        ++counts[(key_fn(src_at(i)) >> shift) & (kNumBuckets - 1)];
+      }
+    });
+
+    // Exclusive scan in (bucket, block) order: each block's cursor for a
+    // bucket starts after lower buckets and after the same bucket in
+    // earlier blocks, which is what keeps the scatter stable.
+    size_t running = 0;
+    for (size_t b = 0; b < kNumBuckets; ++b) {
+      for (unsigned t = 0; t < num_blocks; ++t) {
+        size_t count = block_counts[t][b];
+        block_counts[t][b] = running;
+        running += count;
+      }
+    }
+
+    on_each([&](unsigned tid, unsigned) {
+      const size_t begin = std::min(tid * block_size, num_elems);
+      const size_t end = std::min(begin + block_size, num_elems);
+      auto& offsets = block_counts[tid];
+      for (size_t i = begin; i < end; ++i) {
+        value_type v = src_at(i);
+        size_t bucket = (key_fn(v) >> shift) & (kNumBuckets - 1);
+        size_t dst = offsets[bucket]++;
+        if (from_input) {
+          scratch[dst] = v;
+        } else {
+          first[dst] = v;
+        }
+      }
+    });
+  }
+
+  if (num_passes % 2 == 1) {
+    copy(scratch, scratch + num_elems, first);
+  }
+}
+
 }  // end namespace ParallelSTL
 }  // end namespace katana
 #endif
@@ -28,6 +28,7 @@
 
 #include <boost/iterator/iterator_facade.hpp>
 
+#include "katana/CacheLineStorage.h"
 #include "katana/HWTopo.h"
 #include "katana/PaddedLock.h"
 #include "katana/ThreadPool.h"
@@ -78,10 +79,14 @@ public:
   void* getLocal(unsigned offset, unsigned id) { return &heads[id][offset]; }
 };
 
-extern thread_local char* ptsBase;
+// The cached per-thread block bases. getLocal() inlines to a single add
+// off these; the initial-exec TLS model keeps the thread-local read
+// itself to one load instead of a __tls_get_addr call, which otherwise
+// shows up in tight operator loops.
+KATANA_TLS_INITIAL_EXEC extern thread_local char* ptsBase;
 KATANA_EXPORT PerBackend& getPTSBackend();
 
-extern thread_local char* pssBase;
+KATANA_TLS_INITIAL_EXEC extern thread_local char* pssBase;
 KATANA_EXPORT PerBackend& getPPSBackend();
 
 KATANA_EXPORT void initPTS(unsigned maxT);
@@ -209,6 +214,17 @@ public:
   local_iterator local_end() { return local_begin() + 1; }
 };
 
+/**
+ * PerThreadStorage whose slot is padded out to a full cache line. All
+ * PerThreadStorage instances carve their slots out of one shared block
+ * per thread, so a small hot slot (a counter bumped every iteration)
+ * can share a line with an unrelated storage and ping-pong when that
+ * storage is read remotely. Wrapping in CacheLineStorage gives the slot
+ * its own line; access the value through getLocal()->data.
+ */
+template <typename T>
+using PaddedPerThreadStorage = PerThreadStorage<CacheLineStorage<T>>;
+
 template <typename T>
 class PerSocketStorage {
   unsigned offset;
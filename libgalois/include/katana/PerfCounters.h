@@ -0,0 +1,76 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+#ifndef KATANA_LIBGALOIS_KATANA_PERFCOUNTERS_H_
+#define KATANA_LIBGALOIS_KATANA_PERFCOUNTERS_H_
+
+#include <cstdint>
+
+#include "katana/PerThreadStorage.h"
+#include "katana/config.h"
+
+namespace katana {
+
+/**
+ * Always-on access to the hardware counters of the calling thread.
+ *
+ * Unlike the VTune and PAPI hooks in Profile.h, which are compiled out
+ * of production builds, this goes through the kernel perf_event
+ * interface directly. A thread's counters are opened the first time it
+ * reads them and stay enabled for the life of the thread, so a read is
+ * one syscall with no state changes — cheap enough to bracket
+ * production loops. When the kernel refuses the events
+ * (perf_event_paranoid, containers, non-Linux builds) every read
+ * returns zeros and IsActive() is false; callers need no fallback path.
+ */
+class KATANA_EXPORT PerfCounters {
+public:
+  struct Sample {
+    uint64_t cycles{0};
+    uint64_t cache_misses{0};
+  };
+
+  static PerfCounters& Get();
+
+  /// Reads the calling thread's counters; zeros when unavailable.
+  Sample Read();
+
+  /// True if the calling thread's counters opened successfully.
+  bool IsActive();
+
+private:
+  static constexpr int kUnopened = -2;
+  static constexpr int kUnavailable = -1;
+
+  struct ThreadState {
+    int cycles_fd{kUnopened};
+    int cache_misses_fd{kUnopened};
+
+    ~ThreadState();
+  };
+
+  PerfCounters() = default;
+
+  void OpenLocal();
+
+  PerThreadStorage<ThreadState> states_;
+};
+
+}  // namespace katana
+#endif
@@ -33,13 +33,76 @@ extern "C" {
 }
 #endif
 
+#include <algorithm>
+#include <vector>
+
 #include "katana/Galois.h"
+#include "katana/PerfCounters.h"
 #include "katana/Timer.h"
 #include "katana/config.h"
 #include "katana/gIO.h"
 
 namespace katana {
 
+/**
+ * Always-available counterpart to profileVtune/profilePapi: runs func
+ * with the per-thread hardware counters from PerfCounters.h sampled
+ * around it and reports, through the statistics machinery, the region's
+ * CPU cycles and cache misses summed over threads plus a
+ * CyclesImbalancePct metric (how far the busiest thread's cycles sit
+ * above the mean). Costs two parallel barriers and a few syscalls per
+ * call regardless of build flags, so it can stay enabled in production;
+ * where perf events are unavailable only the timer is reported.
+ */
+template <typename F>
+void
+profileCounters(const F& func, const char* region) {
+  region = region ? region : "(NULL)";
+
+  KATANA_LOG_VASSERT(
+      katana::ThreadPool::getTID() == 0,
+      "profileCounters can only be called from master thread (thread 0)");
+
+  auto& counters = PerfCounters::Get();
+  const unsigned num_threads = getActiveThreads();
+  std::vector<PerfCounters::Sample> before(num_threads);
+  std::vector<PerfCounters::Sample> after(num_threads);
+
+  katana::on_each(
+      [&](unsigned tid, unsigned) { before[tid] = counters.Read(); });
+
+  {
+    katana::StatTimer timer(region);
+    katana::TimerGuard timer_guard(timer);
+    func();
+  }
+
+  katana::on_each(
+      [&](unsigned tid, unsigned) { after[tid] = counters.Read(); });
+
+  if (!counters.IsActive()) {
+    return;
+  }
+
+  uint64_t total_cycles = 0;
+  uint64_t max_cycles = 0;
+  for (unsigned t = 0; t < num_threads; ++t) {
+    uint64_t cycles = after[t].cycles - before[t].cycles;
+    ReportStatSum(region, "Cycles", cycles);
+    ReportStatSum(
+        region, "CacheMisses", after[t].cache_misses - before[t].cache_misses);
+    total_cycles += cycles;
+    max_cycles = std::max(max_cycles, cycles);
+  }
+
+  uint64_t mean_cycles = total_cycles / num_threads;
+  if (mean_cycles > 0) {
+    ReportStatSingle(
+        region, "CyclesImbalancePct",
+        100 * (max_cycles - mean_cycles) / mean_cycles);
+  }
+}
+
 #ifdef KATANA_USE_VTUNE
 
 template <typename F>
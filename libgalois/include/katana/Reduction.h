@@ -20,10 +20,14 @@
 #ifndef KATANA_LIBGALOIS_KATANA_REDUCTION_H_
 #define KATANA_LIBGALOIS_KATANA_REDUCTION_H_
 
+#include <algorithm>
 #include <functional>
 #include <limits>
 
+#include "katana/Barrier.h"
 #include "katana/PerThreadStorage.h"
+#include "katana/ThreadPool.h"
+#include "katana/Threads.h"
 #include "katana/config.h"
 
 namespace katana {
@@ -72,6 +76,11 @@ class Reducible : public MergeFunc, public IDFunc {
 
   void merge(T& lhs, const T& rhs) { lhs = MergeFunc::operator()(lhs, rhs); }
 
+protected:
+  unsigned numSlots() const { return data_.size(); }
+
+  const T& slot(unsigned i) const { return *data_.getRemote(i); }
+
 public:
   using value_type = T;
 
@@ -109,6 +118,63 @@ public:
     return lhs;
   }
 
+  /**
+   * Returns the final reduction value like reduce(), but merges the
+   * per-thread slots with a parallel tree of merge steps instead of one
+   * serial pass: each thread first folds a strided share of the slots
+   * into its own, then pairs of surviving slots are merged in log2
+   * rounds. Worth it when T is expensive to merge or the reduction runs
+   * every round at high thread counts; for a plain counter the serial
+   * reduce() is usually cheaper. Only valid outside the parallel region
+   * (it runs one of its own).
+   */
+  T& reduceTree() {
+    const unsigned num_slots = data_.size();
+    const unsigned workers = std::min(katana::getActiveThreads(), num_slots);
+    if (workers <= 1) {
+      return reduce();
+    }
+
+    auto& barrier = GetBarrier(workers);
+    GetThreadPool().run(workers, [&]() {
+      unsigned tid = ThreadPool::getTID();
+      T& mine = *data_.getRemote(tid);
+      // Fold the slots beyond the worker range into the worker slots.
+      for (unsigned i = tid + workers; i < num_slots; i += workers) {
+        T& rhs = *data_.getRemote(i);
+        merge(mine, std::move(rhs));
+        rhs = IDFunc::operator()();
+      }
+      // Merge pairs of surviving slots; each round halves their number.
+      for (unsigned stride = 1; stride < workers; stride *= 2) {
+        barrier.Wait();
+        if (tid % (2 * stride) == 0 && tid + stride < workers) {
+          T& rhs = *data_.getRemote(tid + stride);
+          merge(mine, std::move(rhs));
+          rhs = IDFunc::operator()();
+        }
+      }
+    });
+
+    return *data_.getRemote(0);
+  }
+
+  /**
+   * Returns a merged copy of the per-thread values without resetting
+   * them. Unlike reduce(), this may be called from inside the parallel
+   * region; concurrent updates are read without synchronization, so the
+   * result is approximate (and values wider than a word may tear). Use
+   * it for convergence-style checks that tolerate noise, and confirm
+   * with reduce() before acting on the answer.
+   */
+  T peek() {
+    T lhs = IDFunc::operator()();
+    for (unsigned i = 0; i < data_.size(); ++i) {
+      lhs = MergeFunc::operator()(lhs, *data_.getRemote(i));
+    }
+    return lhs;
+  }
+
   void reset() {
     for (unsigned int i = 0; i < data_.size(); ++i) {
       *data_.getRemote(i) = IDFunc::operator()();
@@ -182,6 +248,28 @@ public:
     base_type::update(rhs);
     return *this;
   }
+
+  /**
+   * Sampled approximate sum: reads one in sample_stride of the
+   * per-thread slots without synchronization and scales the partial sum
+   * back up by the sampled fraction. Cheaper than peek() at high thread
+   * counts and callable from inside the parallel region; meant for
+   * per-round convergence checks where a noisy answer only delays the
+   * decision by a round — confirm with reduce() before acting on it.
+   */
+  T estimate(unsigned sample_stride = 4) {
+    const unsigned num_slots = this->numSlots();
+    if (sample_stride <= 1 || sample_stride >= num_slots) {
+      return this->peek();
+    }
+    T sum{0};
+    unsigned sampled = 0;
+    for (unsigned i = 0; i < num_slots; i += sample_stride) {
+      sum += this->slot(i);
+      ++sampled;
+    }
+    return static_cast<T>(sum * static_cast<T>(num_slots) / sampled);
+  }
 };
 
 //! Accumulator for T where accumulation is max
@@ -0,0 +1,220 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+#ifndef KATANA_LIBGALOIS_KATANA_SCHEDULEREPLAY_H_
+#define KATANA_LIBGALOIS_KATANA_SCHEDULEREPLAY_H_
+
+#include <cstdint>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <boost/core/noncopyable.hpp>
+
+#include "katana/ErrorCode.h"
+#include "katana/PerThreadStorage.h"
+#include "katana/Result.h"
+#include "katana/ThreadPool.h"
+#include "katana/config.h"
+
+namespace katana {
+
+/// The per-thread pop order of one for_each run, captured by the
+/// Recording worklist adapter and consumed by the Replay worklist.
+///
+/// Unlike Executor_Deterministic, record/replay does not change how the
+/// recorded run is scheduled: Recording only appends each popped item
+/// to the popping thread's buffer (an amortized vector push_back, cheap
+/// enough for production runs). Replaying hands every thread exactly
+/// its recorded sequence, which pins down the scheduling dimension of a
+/// tail-latency anomaly — e.g. an OBIM priority inversion — so it can
+/// be reproduced under a profiler. Replay reproduces each thread's
+/// pop order, not the cross-thread interleaving in time; aborted and
+/// re-executed iterations appear in the trace once per pop, so traces
+/// from runs with conflict detection replay the retries too.
+template <typename T>
+class ScheduleTrace {
+  static_assert(
+      std::is_trivially_copyable_v<T>,
+      "ScheduleTrace requires trivially copyable work items");
+
+  std::vector<std::vector<T>> pops_;
+
+public:
+  void EnsureThreads(unsigned num_threads) {
+    if (pops_.size() < num_threads) {
+      pops_.resize(num_threads);
+    }
+  }
+
+  unsigned NumThreads() const { return pops_.size(); }
+
+  std::vector<T>& Thread(unsigned tid) { return pops_[tid]; }
+  const std::vector<T>& Thread(unsigned tid) const { return pops_[tid]; }
+
+  uint64_t NumPops() const {
+    uint64_t total = 0;
+    for (const auto& pops : pops_) {
+      total += pops.size();
+    }
+    return total;
+  }
+
+  void Clear() { pops_.clear(); }
+
+  /// Write the trace as a flat binary file (thread count, then each
+  /// thread's length-prefixed item sequence).
+  Result<void> Save(const std::string& path) const {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    uint64_t num_threads = pops_.size();
+    out.write(reinterpret_cast<const char*>(&num_threads), sizeof(num_threads));
+    for (const auto& pops : pops_) {
+      uint64_t count = pops.size();
+      out.write(reinterpret_cast<const char*>(&count), sizeof(count));
+      out.write(
+          reinterpret_cast<const char*>(pops.data()), count * sizeof(T));
+    }
+    if (!out) {
+      return KATANA_ERROR(
+          ErrorCode::LocalStorageError, "writing schedule trace to {}", path);
+    }
+    return ResultSuccess();
+  }
+
+  Result<void> Load(const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    uint64_t num_threads = 0;
+    in.read(reinterpret_cast<char*>(&num_threads), sizeof(num_threads));
+    std::vector<std::vector<T>> pops(num_threads);
+    for (auto& thread_pops : pops) {
+      uint64_t count = 0;
+      in.read(reinterpret_cast<char*>(&count), sizeof(count));
+      thread_pops.resize(count);
+      in.read(reinterpret_cast<char*>(thread_pops.data()), count * sizeof(T));
+    }
+    if (!in) {
+      return KATANA_ERROR(
+          ErrorCode::LocalStorageError, "reading schedule trace from {}",
+          path);
+    }
+    pops_ = std::move(pops);
+    return ResultSuccess();
+  }
+};
+
+/// Worklist adapter that records the pop order of an inner worklist
+/// into a ScheduleTrace; scheduling behavior is otherwise unchanged.
+/// Instantiate with the final work-item type (the same T the loop
+/// iterates over) so the trace pointer type matches after the executor
+/// retypes the worklist:
+///
+///     ScheduleTrace<GNode> trace;
+///     katana::for_each(..., katana::wl<
+///         katana::Recording<OBIM, GNode>>(&trace, indexer));
+template <typename Inner, typename T = typename Inner::value_type>
+class Recording : private boost::noncopyable {
+  Inner inner_;
+  ScheduleTrace<T>* trace_;
+
+public:
+  template <typename _T>
+  using retype = Recording<typename Inner::template retype<_T>, _T>;
+
+  template <bool b>
+  using rethread = Recording<typename Inner::template rethread<b>, T>;
+
+  typedef T value_type;
+
+  template <typename... Args>
+  explicit Recording(ScheduleTrace<T>* trace, Args&&... args)
+      : inner_(std::forward<Args>(args)...), trace_(trace) {
+    trace_->EnsureThreads(GetThreadPool().getMaxThreads());
+  }
+
+  void push(const value_type& val) { inner_.push(val); }
+
+  template <typename Iter>
+  void push(Iter b, Iter e) {
+    inner_.push(b, e);
+  }
+
+  template <typename RangeTy>
+  void push_initial(const RangeTy& range) {
+    inner_.push_initial(range);
+  }
+
+  std::optional<value_type> pop() {
+    std::optional<value_type> item = inner_.pop();
+    if (item) {
+      trace_->Thread(ThreadPool::getTID()).push_back(*item);
+    }
+    return item;
+  }
+};
+
+/// Worklist that replays a recorded ScheduleTrace: each thread pops
+/// exactly the sequence it popped during the recorded run, in order.
+/// Pushes are dropped — every item a push would have produced was
+/// recorded when the original run popped it. Run the replay with the
+/// same thread count as the recording and with conflict detection
+/// disabled — an iteration aborted during replay would be dropped, not
+/// retried.
+template <typename T = int>
+class Replay : private boost::noncopyable {
+  ScheduleTrace<T>* trace_;
+  PerThreadStorage<size_t> cursors_;
+
+public:
+  template <typename _T>
+  using retype = Replay<_T>;
+
+  template <bool b>
+  using rethread = Replay;
+
+  typedef T value_type;
+
+  explicit Replay(ScheduleTrace<T>* trace) : trace_(trace) {}
+
+  void push(const value_type&) {}
+
+  template <typename Iter>
+  void push(Iter, Iter) {}
+
+  template <typename RangeTy>
+  void push_initial(const RangeTy&) {}
+
+  std::optional<value_type> pop() {
+    unsigned tid = ThreadPool::getTID();
+    if (tid >= trace_->NumThreads()) {
+      return std::nullopt;
+    }
+    const std::vector<T>& pops = trace_->Thread(tid);
+    size_t& cursor = *cursors_.getLocal();
+    if (cursor >= pops.size()) {
+      return std::nullopt;
+    }
+    return pops[cursor++];
+  }
+};
+
+}  // end namespace katana
+
+#endif
@@ -337,6 +337,18 @@ protected:
       StatTotal::Type& type, gstl::Vector<Str>& vec) const;
 
 public:
+  /// Index of a stat registered with RegisterHandle. Handles index
+  /// fixed-size per-thread buffers, so adding through one is wait-free:
+  /// no lock, no map lookup, no string work.
+  using HandleId = uint32_t;
+
+  static constexpr HandleId kInvalidHandle =
+      std::numeric_limits<HandleId>::max();
+
+  /// Upper bound on registered handles; per-thread buffers are sized to
+  /// this at startup so the add path never allocates.
+  static constexpr HandleId kMaxHandles = 1024;
+
   StatManager();
 
   StatManager(const StatManager&) = delete;
@@ -359,9 +371,42 @@ public:
   void AddParam(
       const std::string& region, const std::string& category, const Str& val);
 
+  /// Resolves region/category to a fixed slot once; subsequent
+  /// AddToHandle calls touch only the calling thread's buffer. Returns
+  /// the existing handle when the same stat is registered twice. Takes a
+  /// lock; call it outside loops.
+  HandleId RegisterHandle(
+      const std::string& region, const std::string& category,
+      const StatTotal::Type& type);
+
+  /// Wait-free equivalent of AddInt for a registered handle. Per-thread
+  /// values accumulate by addition, as with AddInt; the total type
+  /// declared at registration is applied when merging across threads.
+  void AddToHandle(HandleId handle, int64_t val);
+
   void Print();
 };
 
+/// Pre-resolved stat for hot paths, e.g. per-round counters bumped by
+/// every thread. Registration does the string and map work once; Add is
+/// wait-free and does not perturb the loop it instruments. Falls back to
+/// ReportStat when constructed before the StatManager exists. Must not
+/// outlive the StatManager it registered with.
+class KATANA_EXPORT StatHandle {
+public:
+  StatHandle(
+      std::string region, std::string category,
+      const StatTotal::Type& type = StatTotal::TSUM);
+
+  void Add(int64_t val) const;
+
+private:
+  std::string region_;
+  std::string category_;
+  StatTotal::Type type_;
+  StatManager::HandleId id_;
+};
+
 namespace internal {
 
 KATANA_EXPORT void setSysStatManager(StatManager* sm);
@@ -0,0 +1,90 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+#ifndef KATANA_LIBGALOIS_KATANA_STRIPEDLOCK_H_
+#define KATANA_LIBGALOIS_KATANA_STRIPEDLOCK_H_
+
+#include <array>
+#include <cstdint>
+
+#include "katana/CacheLineStorage.h"
+#include "katana/SimpleLock.h"
+#include "katana/config.h"
+
+namespace katana {
+
+/**
+ * A fixed array of cache-line padded locks, indexed by hashing a key such
+ * as an object address or node id.
+ *
+ * Use this instead of a per-object lock (or instead of spinning a CAS on
+ * data packed next to other hot data) when the protected objects are small
+ * and adjacent in memory: contenders for the same object serialize on a
+ * padded stripe instead of ping-ponging the object's own cache line across
+ * sockets, and the lock overhead is a fixed NumStripes cache lines no
+ * matter how many objects there are. Distinct keys may share a stripe, so
+ * never acquire two stripes at once without ordering them (see get()).
+ */
+template <typename LockTy = SimpleLock, unsigned NumStripes = 128>
+class StripedLock {
+  static_assert(
+      (NumStripes & (NumStripes - 1)) == 0,
+      "NumStripes must be a power of two");
+
+  std::array<CacheLineStorage<LockTy>, NumStripes> locks_;
+
+  static size_t index(uintptr_t key) {
+    // Multiplicative hash (golden ratio) so keys that differ only in low
+    // bits, like adjacent addresses, spread over all stripes.
+    return (key * 0x9E3779B97F4A7C15ULL) >> (64 - log2_stripes());
+  }
+
+  constexpr static unsigned log2_stripes() {
+    unsigned log = 0;
+    for (unsigned n = NumStripes; n > 1; n >>= 1) {
+      ++log;
+    }
+    return log;
+  }
+
+public:
+  StripedLock() = default;
+  StripedLock(const StripedLock&) = delete;
+  StripedLock& operator=(const StripedLock&) = delete;
+
+  /// Return the stripe for \p key, e.g. for use with std::lock_guard.
+  /// Callers that lock stripes for two keys must acquire them in stripe
+  /// order (compare &get(a) and &get(b)) to avoid deadlock.
+  LockTy& get(const void* key) {
+    return locks_[index(reinterpret_cast<uintptr_t>(key))].get();
+  }
+
+  LockTy& get(size_t key) { return locks_[index(key)].get(); }
+
+  void lock(const void* key) { get(key).lock(); }
+  void unlock(const void* key) { get(key).unlock(); }
+  bool try_lock(const void* key) { return get(key).try_lock(); }
+
+  void lock(size_t key) { get(key).lock(); }
+  void unlock(size_t key) { get(key).unlock(); }
+  bool try_lock(size_t key) { return get(key).try_lock(); }
+};
+
+}  // namespace katana
+#endif
@@ -84,13 +84,23 @@ private:
       }
     }
 
-    void wait(bool fastmode) {
+    void wait(bool fastmode, unsigned spin_iters) {
       if (fastmode) {
         while (!fastRelease.load(std::memory_order_relaxed)) {
           asmPause();
         }
         fastRelease = 0;
       } else {
+        // Spin-then-park: briefly poll for the next region before taking the
+        // mutex. Bursts of short parallel regions are released here without
+        // any futex traffic; the condition variable below remains the
+        // fallback, so a wakeup that races with parking is never lost.
+        for (unsigned i = 0; i < spin_iters; ++i) {
+          if (!done.load(std::memory_order_acquire)) {
+            return;
+          }
+          asmPause();
+        }
         std::unique_lock<std::mutex> lg(m);
         cv.wait(lg, [=] { return !done; });
         // start.acquire();
@@ -105,7 +115,8 @@ private:
   std::vector<std::thread> threads;
   unsigned reserved;
   unsigned masterFastmode;
-  bool running;
+  unsigned wakeupSpin;
+  std::atomic<bool> running;
   std::function<void(void)> work;
 
   //! destroy all threads
@@ -165,13 +176,46 @@ public:
   //! run function in a dedicated thread until the threadpool exits
   void runDedicated(std::function<void(void)>& f);
 
+  //! re-pin pool threads to a subset of OS CPU ids at runtime, e.g. after
+  //! the surrounding cgroup's core set changed, without restarting the
+  //! process. Threads whose home core is in the set keep their exact
+  //! binding; the rest float over the whole set. The logical topology
+  //! (socket leaders, per-socket storage layout) is fixed at startup, so
+  //! floated threads keep their original socket association; pair with
+  //! setActiveThreads() to match loop width to the new set. Must not be
+  //! called during a parallel region; dedicated threads are unaffected.
+  void restrictToCores(const std::vector<int>& os_cpus);
+
+  //! restore the original one-thread-per-core binding set up at pool
+  //! creation, undoing restrictToCores().
+  void resetCoreRestriction();
+
   // experimental: busy wait for work
   void burnPower(unsigned num);
   // experimental: leave busy wait
   void beKind();
 
+  //! set how many pause iterations an idle thread polls for the next
+  //! parallel region before parking in the OS. Non-zero values keep the
+  //! pool hot across bursts of short regions without committing to the
+  //! permanent busy wait of burnPower(). Defaults to a small spin;
+  //! overridable with KATANA_WAKEUP_SPIN (0 restores park-immediately).
+  void setWakeupSpin(unsigned iterations) { wakeupSpin = iterations; }
+  unsigned getWakeupSpin() const { return wakeupSpin; }
+
+  //! true while a parallel region is executing on the pool. Loop constructs
+  //! use this to detect nested invocations and degrade to serial execution
+  //! on the calling thread instead of corrupting pool state.
+  bool isRunning() const { return running.load(std::memory_order_relaxed); }
+
   //! return the number of non-reserved threads in the pool
   unsigned getMaxUsableThreads() const { return mi.maxThreads - reserved; }
+  //! return the length of the leading run of threads on performance-class
+  //! cores; equals getMaxThreads() on homogeneous machines. Loops that clamp
+  //! their width to this stay off efficiency cores on hybrid machines.
+  unsigned getMaxPerformanceThreads() const {
+    return mi.maxPerformanceThreads;
+  }
   //! return the number of threads supported by the thread pool on the current
   //! machine
   unsigned getMaxThreads() const { return mi.maxThreads; }
@@ -21,6 +21,7 @@
 #define KATANA_LIBGALOIS_KATANA_TIMER_H_
 
 #include <chrono>
+#include <iosfwd>
 
 #include "katana/config.h"
 #include "katana/gstl.h"
@@ -104,6 +105,45 @@ public:
   uint64_t get_usec() const { return 0; }
 };
 
+//! A scoped timer that knows its place in a hierarchy of timers.
+//!
+//! StatTimer reports flat name/value pairs, so nested phases with the
+//! same name (e.g. "BFS" run inside two different algorithms) collide in
+//! the statistics output. A ScopedStatTimer instead infers its parent
+//! from a per-thread stack of active timers and accounts its time under
+//! the full path "region;outer;inner". On destruction it reports the
+//! inclusive time of its path through the normal statistics machinery
+//! and accumulates its exclusive (self) time into a process-wide table
+//! that PrintCollapsedTimers writes in collapsed-stack format.
+//!
+//! Nested timers inherit the region of the enclosing ScopedStatTimer
+//! when none is given. Each thread has its own stack, so timers may be
+//! nested independently on different threads.
+class KATANA_EXPORT [[nodiscard]] ScopedStatTimer {
+  Timer timer_;
+  uint64_t children_usec_{0};
+  ScopedStatTimer* parent_;
+  gstl::Str path_;
+  gstl::Str region_;
+
+public:
+  ScopedStatTimer(const char* name, const char* region);
+
+  explicit ScopedStatTimer(const char* name) : ScopedStatTimer(name, nullptr) {}
+
+  ScopedStatTimer(const ScopedStatTimer&) = delete;
+  ScopedStatTimer(ScopedStatTimer&&) = delete;
+  ScopedStatTimer& operator=(const ScopedStatTimer&) = delete;
+  ScopedStatTimer& operator=(ScopedStatTimer&&) = delete;
+
+  ~ScopedStatTimer();
+};
+
+/// Write the exclusive times accumulated by ScopedStatTimers, one stack
+/// per line as "region;outer;inner <usec>" — the collapsed-stack format
+/// flamegraph.pl and speedscope consume directly.
+KATANA_EXPORT void PrintCollapsedTimers(std::ostream& out);
+
 //! Start and stop a TimeAccumulator in the scope of the guard.
 template <typename T>
 class [[nodiscard]] TimerGuard {
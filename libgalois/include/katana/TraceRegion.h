@@ -0,0 +1,86 @@
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "katana/Logging.h"
+#include "katana/PerThreadStorage.h"
+#include "katana/ProgressTracer.h"
+#include "katana/ThreadPool.h"
+#include "katana/config.h"
+
+namespace katana {
+
+/// A TraceRegion carries the active ProgressSpan into parallel workers.
+///
+/// The tracer's span stack is single-threaded: spans must be started and
+/// finished on the master thread, and while worker threads can observe
+/// the active span, having every worker call ProgressSpan::Log funnels
+/// them all through the tracer's output path. A TraceRegion is created
+/// on the master thread (typically just before a do_all or for_each),
+/// captures the span that is active at that moment, and gives workers
+/// Log(), which appends to a per-thread buffer without synchronization.
+/// When the region is flushed — explicitly or by the destructor, back on
+/// the master thread after the parallel loop — the buffered events are
+/// emitted into the captured span in thread order, each tagged with the
+/// thread that recorded it and its offset from the start of the region.
+///
+/// Buffered events survive until the flush, so they are not visible in
+/// the trace while the loop runs; use SharedLoopProgress for live
+/// progress and this for attributing events to threads after the fact.
+class TraceRegion {
+  struct Entry {
+    int64_t offset_us;
+    std::string message;
+    Tags tags;
+  };
+
+  ProgressSpan* span_;
+  std::string region_;
+  std::chrono::steady_clock::time_point start_;
+  PerThreadStorage<std::vector<Entry>> buffers_;
+
+public:
+  explicit TraceRegion(std::string region)
+      : span_(&GetTracer().GetActiveSpan()),
+        region_(std::move(region)),
+        start_(std::chrono::steady_clock::now()) {
+    KATANA_LOG_DEBUG_VASSERT(
+        ThreadPool::getTID() == 0,
+        "TraceRegion must be created on the master thread");
+  }
+
+  TraceRegion(const TraceRegion&) = delete;
+  TraceRegion& operator=(const TraceRegion&) = delete;
+
+  ~TraceRegion() { Flush(); }
+
+  /// Record an event from the calling thread. Safe to call from inside
+  /// parallel loops; only touches the calling thread's buffer.
+  void Log(std::string message, Tags tags = {}) {
+    int64_t offset_us = std::chrono::duration_cast<std::chrono::microseconds>(
+                            std::chrono::steady_clock::now() - start_)
+                            .count();
+    buffers_.getLocal()->push_back(
+        Entry{offset_us, std::move(message), std::move(tags)});
+  }
+
+  /// Emit all buffered events into the captured span and clear the
+  /// buffers. Call from the master thread after the parallel loop ends.
+  void Flush() {
+    for (unsigned tid = 0; tid < buffers_.size(); ++tid) {
+      std::vector<Entry>* buffer = buffers_.getRemote(tid);
+      for (Entry& entry : *buffer) {
+        entry.tags.emplace_back("region", region_);
+        entry.tags.emplace_back("tid", tid);
+        entry.tags.emplace_back("offset_us", entry.offset_us);
+        span_->Log(entry.message, entry.tags);
+      }
+      buffer->clear();
+    }
+  }
+};
+
+}  // namespace katana
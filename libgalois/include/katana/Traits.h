@@ -219,6 +219,52 @@ struct loopname : public trait_has_value<const char*>, loopname_tag {
 struct steal_tag {};
 struct steal : public trait_has_type<bool>, steal_tag {};
 
+/**
+ * Indicate that @{link do_all()} loops over random-access ranges should use
+ * the deque-style lock-free stealing executor: owners pop chunks from the
+ * front of their window and thieves take half from the back, each with a
+ * single CAS instead of a mutex round trip per chunk.
+ */
+struct deque_steal_tag {};
+struct deque_steal : public trait_has_type<bool>, deque_steal_tag {};
+
+/**
+ * Run a @{link do_all()} loop on the given number of threads instead of the
+ * global setActiveThreads() setting, e.g.
+ * `katana::do_all(range, fn, katana::num_threads(8))`. The count is scoped
+ * to the one invocation, so callers that mix loops of different widths need
+ * not flip the global setting between them. Values are clamped to
+ * [1, usable pool threads]; ignored inside a nested parallel region.
+ */
+struct num_threads_tag {};
+struct num_threads : public trait_has_value<unsigned>, num_threads_tag {
+  num_threads(unsigned n = 0) : trait_has_value<unsigned>(n) {}
+};
+
+/**
+ * Keep a @{link do_all()} loop off efficiency cores on hybrid (P/E core)
+ * machines by clamping its thread count to the performance-class cores.
+ * Thread numbering places efficiency cores after the primary contexts of
+ * performance cores, so round-based loops annotated with this trait no
+ * longer wait at every barrier for the slowest core class. A no-op on
+ * homogeneous machines; combines with num_threads (the smaller bound
+ * wins).
+ */
+struct performance_cores_tag {};
+struct performance_cores : public trait_has_type<bool>,
+                           performance_cores_tag {};
+
+/**
+ * Indicate that @{link do_all()} should re-tune its chunk size at runtime
+ * from the observed per-chunk execution time, growing chunks of cheap
+ * iterations to cut scheduling overhead and shrinking chunks of expensive
+ * ones to keep stealing effective. The chunk_size trait still supplies the
+ * starting point.
+ */
+struct adaptive_chunk_size_tag {};
+struct adaptive_chunk_size : public trait_has_type<bool>,
+                             adaptive_chunk_size_tag {};
+
 /**
  * Indicates worklist to use. Optional argument to {@link for_each()} loops.
  */
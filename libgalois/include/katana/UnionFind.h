@@ -21,7 +21,12 @@
 #define KATANA_LIBGALOIS_KATANA_UNIONFIND_H_
 
 #include <atomic>
+#include <cstdint>
+#include <utility>
 
+#include "katana/Loops.h"
+#include "katana/NUMAArray.h"
+#include "katana/Reduction.h"
 #include "katana/config.h"
 
 namespace katana {
@@ -61,8 +66,12 @@ public:
 
   T* find() { return findImpl(); }
 
-  //! Compress ONLY node to point directly to the root of the tree;
-  //! nodes on path are not altered
+  //! Compress node to point directly to the root of the tree. Nodes on the
+  //! path are split to point at their grandparent as the walk passes them,
+  //! so repeated compressions over a long chain flatten it instead of
+  //! rewalking it. Splitting only ever moves a non-root pointer to an
+  //! ancestor and roots never regress to non-roots, so concurrent walks and
+  //! merges cannot form a cycle.
   void compress() {
     if (isRep())
       return;
@@ -74,6 +83,9 @@ public:
     while (rep->m_component.load(std::memory_order_relaxed) != rep) {
       // get next parent
       T* next = rep->m_component.load(std::memory_order_relaxed);
+      T* next_next = next->m_component.load(std::memory_order_relaxed);
+      // path splitting: shortcut rep past its parent
+      rep->m_component.store(next_next, std::memory_order_relaxed);
       rep = next;
     }
 
@@ -120,6 +132,175 @@ public:
       }
     }
   }
+
+  //! Merge serialized through a striped lock (\ref StripedLock.h), keyed by
+  //! the losing root. On skewed graphs most merges hit a handful of roots
+  //! whose nodes sit next to unrelated node data; with the lock-free merge
+  //! the losing CASes ping-pong those cache lines across sockets. Here
+  //! contenders for the same root spin on a padded stripe instead and only
+  //! the stripe owner touches the root's line. Returns if merge was done.
+  template <typename StripedLockTy>
+  T* merge(T* b, StripedLockTy& locks) {
+    T* a = m_component.load(std::memory_order_relaxed);
+    while (true) {
+      a = a->findAndCompress();
+      b = b->findAndCompress();
+      if (a == b)
+        return 0;
+      // Avoid cycles by directing edges consistently
+      if (a < b)
+        std::swap(a, b);
+      T* expected = a;
+      locks.lock(static_cast<const void*>(a));
+      bool merged = a->m_component.compare_exchange_strong(expected, b);
+      locks.unlock(static_cast<const void*>(a));
+      if (merged) {
+        return b;
+      }
+      a = expected;
+    }
+  }
+};
+
+/**
+ * Standalone concurrent union-find over dense node ids.
+ *
+ * Unlike the intrusive UnionFindNode, which callers embed in their own
+ * node structs, this owns a NUMA-interleaved parent array indexed by
+ * node id, so it drops into algorithms whose per-node state is plain
+ * property columns. All operations are CAS-only and safe to call
+ * concurrently:
+ *
+ * - linking is by random priority: each id has a fixed hash-derived
+ *   priority and the lower-priority root is linked under the higher.
+ *   Unlike rank counters this needs no extra array and no racy rank
+ *   updates, while giving the same expected tree depth;
+ * - Find uses path splitting, one relaxed store per visited node, so
+ *   concurrent finds over a long chain flatten it without rewalking
+ *   (same argument as UnionFindNode::compress for why no cycle can
+ *   form).
+ *
+ * UniteBatch is the bulk entry point for edge-driven phases like the
+ * link steps of the Afforest connected-components plan: it unites a
+ * whole edge range in one stealing parallel loop.
+ */
+template <typename IndexTy = uint32_t>
+class ParallelUnionFind {
+  NUMAArray<std::atomic<IndexTy>> parent_;
+
+  /// Fixed per-id priority (splitmix64 finalizer); ties broken by id.
+  static uint64_t Priority(IndexTy x) {
+    uint64_t z = static_cast<uint64_t>(x) + 0x9E3779B97F4A7C15ULL;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+  }
+
+  static bool Loses(IndexTy a, IndexTy b) {
+    uint64_t pa = Priority(a);
+    uint64_t pb = Priority(b);
+    return pa < pb || (pa == pb && a < b);
+  }
+
+public:
+  using index_type = IndexTy;
+
+  /// Construct a forest of \p num_nodes singleton sets. Initialization
+  /// is a parallel loop; do not construct inside a parallel region.
+  explicit ParallelUnionFind(size_t num_nodes) {
+    parent_.allocateInterleaved(num_nodes);
+    katana::do_all(katana::iterate(size_t{0}, num_nodes), [&](size_t i) {
+      parent_[i].store(static_cast<IndexTy>(i), std::memory_order_relaxed);
+    });
+  }
+
+  size_t size() const { return parent_.size(); }
+
+  /// Return the representative of x's set, splitting the path walked.
+  IndexTy Find(IndexTy x) {
+    IndexTy cur = x;
+    while (true) {
+      IndexTy parent = parent_[cur].load(std::memory_order_relaxed);
+      if (parent == cur) {
+        return cur;
+      }
+      IndexTy grandparent = parent_[parent].load(std::memory_order_relaxed);
+      if (grandparent == parent) {
+        return parent;
+      }
+      // Path splitting: shortcut cur past its parent. Moving a non-root
+      // pointer to an ancestor cannot create a cycle.
+      parent_[cur].store(grandparent, std::memory_order_relaxed);
+      cur = parent;
+    }
+  }
+
+  /// Unite the sets holding a and b.
+  /// \returns true if this call merged two distinct sets
+  bool Unite(IndexTy a, IndexTy b) {
+    while (true) {
+      a = Find(a);
+      b = Find(b);
+      if (a == b) {
+        return false;
+      }
+      IndexTy loser = Loses(a, b) ? a : b;
+      IndexTy winner = loser == a ? b : a;
+      IndexTy expected = loser;
+      if (parent_[loser].compare_exchange_strong(
+              expected, winner, std::memory_order_relaxed)) {
+        return true;
+      }
+      // Someone merged under us; retry from the new roots.
+      a = loser;
+      b = winner;
+    }
+  }
+
+  /// \returns true if a and b are in the same set. A false result is
+  /// only stable if no concurrent Unite can join them.
+  bool SameSet(IndexTy a, IndexTy b) {
+    while (true) {
+      a = Find(a);
+      b = Find(b);
+      if (a == b) {
+        return true;
+      }
+      // a may have been linked under a new root between the two finds;
+      // only a still-rooted a proves the sets are distinct.
+      if (parent_[a].load(std::memory_order_relaxed) == a) {
+        return false;
+      }
+    }
+  }
+
+  /// Unite an edge range in one stealing parallel loop. The iterators
+  /// must dereference to a pair-like (src, dst) of ids. Do not call
+  /// inside a parallel region.
+  template <typename Iter>
+  void UniteBatch(Iter begin, Iter end) {
+    katana::do_all(
+        katana::iterate(begin, end),
+        [&](const auto& edge) {
+          Unite(
+              static_cast<IndexTy>(std::get<0>(edge)),
+              static_cast<IndexTy>(std::get<1>(edge)));
+        },
+        katana::steal(), katana::loopname("UnionFindUniteBatch"));
+  }
+
+  /// Count the distinct sets with a parallel scan. Do not call inside a
+  /// parallel region or concurrently with Unite.
+  size_t NumSets() {
+    katana::GAccumulator<size_t> num_roots;
+    katana::do_all(katana::iterate(size_t{0}, parent_.size()), [&](size_t i) {
+      if (parent_[i].load(std::memory_order_relaxed) ==
+          static_cast<IndexTy>(i)) {
+        num_roots += 1;
+      }
+    });
+    return num_roots.reduce();
+  }
 };
 }  // namespace katana
 #endif
@@ -54,7 +54,10 @@ protected:
   bool firstPassFlag = false;
   void* localState = nullptr;
 
-  void __resetAlloc() { IterationAllocatorBase.clear(); }
+  // reset() keeps the current chunk, so the per-iteration commit/abort
+  // path is allocation-free; clear() would return it just to take it back
+  // on the next iteration's first allocate.
+  void __resetAlloc() { IterationAllocatorBase.reset(); }
 
   void __setFirstPass(void) { firstPassFlag = true; }
 
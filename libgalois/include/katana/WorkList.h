@@ -25,6 +25,7 @@
 #include "katana/BulkSynchronous.h"
 #include "katana/Chunk.h"
 #include "katana/LocalQueue.h"
+#include "katana/MultiQueue.h"
 #include "katana/Obim.h"
 #include "katana/OrderedList.h"
 #include "katana/OwnerComputes.h"
@@ -38,7 +39,9 @@ namespace katana {
  * Scheduling policies for Galois iterators. Unless you have very specific
  * scheduling requirement, \ref PerSocketChunkLIFO or \ref PerSocketChunkFIFO is
  * a reasonable scheduling policy. If you need approximate priority scheduling,
- * use \ref OrderedByIntegerMetric. For debugging, you may be interested in
+ * use \ref OrderedByIntegerMetric, or \ref MultiQueue when priorities do not
+ * bin well into a small number of integers. For debugging, you may be
+ * interested in
  * \ref FIFO or \ref LIFO, which try to follow serial order exactly.
  *
  * The way to use a worklist is to pass it as a template parameter to
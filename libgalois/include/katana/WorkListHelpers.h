@@ -20,9 +20,13 @@
 #ifndef KATANA_LIBGALOIS_KATANA_WORKLISTHELPERS_H_
 #define KATANA_LIBGALOIS_KATANA_WORKLISTHELPERS_H_
 
+#include <optional>
+
 #include <boost/iterator/iterator_facade.hpp>
 
+#include "katana/PerThreadStorage.h"
 #include "katana/PtrLock.h"
+#include "katana/Simple.h"
 #include "katana/WLCompileCheck.h"
 #include "katana/config.h"
 
@@ -177,6 +181,113 @@ struct DummyIndexer {
   unsigned operator()(const T&) { return 0; }
 };
 
+/**
+ * Two-level work distribution adapter for NUMA machines: one shared
+ * SocketWL per socket plus a global overflow channel.
+ *
+ * Threads push to and pop from their own socket's queue, so stealing
+ * (whatever SocketWL does internally) stays within a socket where a
+ * cache line transfer is cheap. To keep sockets from diverging, one in
+ * every OverflowPeriod pushes is diverted to the global queue, which
+ * idle threads drain before resorting to pulling directly from remote
+ * sockets as a last resort. On a single-socket machine the overflow
+ * ticker and remote scan are skipped entirely and the adapter behaves
+ * like its SocketWL.
+ *
+ * Use by wrapping the worklist you would have used:
+ *
+ * \code
+ * katana::for_each(katana::iterate(graph), fn,
+ *     katana::wl<katana::PerSocketOverflowQueue<
+ *         katana::PerSocketChunkFIFO<32>>>());
+ * \endcode
+ */
+template <
+    typename SocketWL = GFIFO<int>, typename GlobalWL = GFIFO<int>,
+    typename T = int, unsigned OverflowPeriod = 32>
+struct PerSocketOverflowQueue {
+  template <bool _concurrent>
+  using rethread = PerSocketOverflowQueue<SocketWL, GlobalWL, T, OverflowPeriod>;
+
+  template <typename _T>
+  using retype = PerSocketOverflowQueue<
+      typename SocketWL::template retype<_T>,
+      typename GlobalWL::template retype<_T>, _T, OverflowPeriod>;
+
+  template <typename _socket>
+  using with_socket =
+      PerSocketOverflowQueue<_socket, GlobalWL, T, OverflowPeriod>;
+
+  template <typename _global>
+  using with_global =
+      PerSocketOverflowQueue<SocketWL, _global, T, OverflowPeriod>;
+
+  typedef T value_type;
+
+private:
+  PerSocketStorage<SocketWL> socket_queues_;
+  GlobalWL global_;
+  PerThreadStorage<unsigned> push_ticker_;
+
+public:
+  PerSocketOverflowQueue() = default;
+  PerSocketOverflowQueue(const PerSocketOverflowQueue&) = delete;
+  PerSocketOverflowQueue& operator=(const PerSocketOverflowQueue&) = delete;
+
+  void push(const value_type& val) {
+    if (GetThreadPool().getMaxSockets() > 1 &&
+        ++*push_ticker_.getLocal() % OverflowPeriod == 0) {
+      global_.push(val);
+      return;
+    }
+    socket_queues_.getLocal()->push(val);
+  }
+
+  template <typename Iter>
+  void push(Iter b, Iter e) {
+    for (; b != e; ++b) {
+      push(*b);
+    }
+  }
+
+  template <typename RangeTy>
+  void push_initial(const RangeTy& range) {
+    push(range.local_begin(), range.local_end());
+  }
+
+  std::optional<value_type> pop() {
+    std::optional<value_type> ret = socket_queues_.getLocal()->pop();
+    if (ret) {
+      return ret;
+    }
+
+    auto& tp = GetThreadPool();
+    if (tp.getMaxSockets() == 1) {
+      return std::nullopt;
+    }
+
+    ret = global_.pop();
+    if (ret) {
+      return ret;
+    }
+
+    // Last resort: pull from remote sockets so no thread idles while
+    // another socket still holds work.
+    unsigned my_socket = tp.getSocket(ThreadPool::getTID());
+    for (unsigned p = 0; p < tp.getMaxSockets(); ++p) {
+      if (p == my_socket) {
+        continue;
+      }
+      ret = socket_queues_.getRemoteByPkg(p)->pop();
+      if (ret) {
+        return ret;
+      }
+    }
+    return std::nullopt;
+  }
+};
+KATANA_WLCOMPILECHECK(PerSocketOverflowQueue)
+
 }  // end namespace katana
 
 #endif
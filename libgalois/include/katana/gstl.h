@@ -176,12 +176,42 @@ using Map = std::map<K, V, C, FixedSizeAllocator<std::pair<const K, V>>>;
 //! As the memory allocated can be reused for another allocation only by the
 //! thread that deallocated it, this is not suitable for use cases where the
 //! main thread always does the deallocation (after the parallel region).
+//!
+//! This is still a thread-private map; when threads must share one map and
+//! observe each other's updates, see katana::ConcurrentHashMap.
 template <
     typename K, typename V, typename Hash = std::hash<K>,
     typename KeyEqual = std::equal_to<K>>
 using UnorderedMap = std::unordered_map<
     K, V, Hash, KeyEqual, Pow2BlockAllocator<std::pair<const K, V>>>;
 
+//! Allocator handle over a PerRoundArenaHeap: allocation is a thread-local
+//! pointer bump and deallocation is a no-op, so containers using it must be
+//! discarded before their arena is rewound. Pass an instance pointing at the
+//! arena when constructing the container.
+template <typename T>
+using ArenaAlloc = ExternalHeapAllocator<T, PerRoundArenaHeap>;
+
+//! std::map drawing its nodes from a per-thread round arena. Use for
+//! short-lived maps built inside a parallel loop iteration (e.g. the
+//! per-node community weight maps in the clustering move phase) where the
+//! general-purpose allocators still dominate the profile.
+template <typename K, typename V, typename C = std::less<K>>
+using ArenaMap = std::map<K, V, C, ArenaAlloc<std::pair<const K, V>>>;
+
+//! std::unordered_map drawing its memory from a per-thread round arena; see
+//! ArenaMap for the intended lifetime discipline.
+template <
+    typename K, typename V, typename Hash = std::hash<K>,
+    typename KeyEqual = std::equal_to<K>>
+using ArenaUnorderedMap = std::unordered_map<
+    K, V, Hash, KeyEqual, ArenaAlloc<std::pair<const K, V>>>;
+
+//! std::vector drawing its memory from a per-thread round arena; see
+//! ArenaMap for the intended lifetime discipline.
+template <typename T>
+using ArenaVector = std::vector<T, ArenaAlloc<T>>;
+
 //! [STL basic_string using katana Pow2BlockAllocator]
 //! specializes std::basic_string to use katana concurrent, scaleable allocator:
 //! the allocator is composed of thread-local allocators
@@ -19,6 +19,7 @@
 
 #include "katana/Barrier.h"
 
+#include "katana/Env.h"
 #include "katana/Logging.h"
 #include "katana/ThreadPool.h"
 
@@ -41,6 +42,42 @@ katana::internal::SetBarrier(katana::Barrier* barrier) {
   }
 }
 
+std::unique_ptr<katana::Barrier>
+katana::CreateBarrier(unsigned active_threads) {
+  std::string name;
+  if (GetEnv("KATANA_BARRIER", &name)) {
+    if (name == "topo") {
+      return CreateTopoBarrier(active_threads);
+    }
+    if (name == "mcs") {
+      return CreateMCSBarrier(active_threads);
+    }
+    if (name == "counting") {
+      return CreateCountingBarrier(active_threads);
+    }
+    if (name == "dissemination") {
+      return CreateDisseminationBarrier(active_threads);
+    }
+    if (name == "simple") {
+      return CreateSimpleBarrier(active_threads);
+    }
+    KATANA_LOG_WARN(
+        "unknown KATANA_BARRIER value '{}'; choosing by topology", name);
+  }
+
+  // The topology-aware barrier only pays off when there is a socket
+  // hierarchy to exploit; on one socket the flat barriers have less
+  // signaling overhead.
+  if (GetThreadPool().getMaxSockets() > 1) {
+    return CreateTopoBarrier(active_threads);
+  }
+  constexpr unsigned kCountingBarrierMaxThreads = 16;
+  if (active_threads <= kCountingBarrierMaxThreads) {
+    return CreateCountingBarrier(active_threads);
+  }
+  return CreateDisseminationBarrier(active_threads);
+}
+
 katana::Barrier&
 katana::GetBarrier(unsigned active_threads) {
   KATANA_LOG_VASSERT(kBarrier, "Barrier not initialized");
@@ -24,6 +24,7 @@
 #include "katana/DynamicBitset.h"
 
 #include "katana/Galois.h"
+#include "katana/ParallelSTL.h"
 
 KATANA_EXPORT katana::DynamicBitset katana::EmptyBitset;
 
@@ -68,6 +69,31 @@ katana::DynamicBitset::bitwise_and(
       katana::no_stats());
 }
 
+void
+katana::DynamicBitset::bitwise_andnot(const DynamicBitset& other) {
+  KATANA_LOG_DEBUG_ASSERT(size() == other.size());
+  const auto& other_bitvec = other.get_vec();
+  katana::do_all(
+      katana::iterate(size_t{0}, bitvec_.size()),
+      [&](size_t i) { bitvec_[i] &= ~other_bitvec[i]; }, katana::no_stats());
+}
+
+void
+katana::DynamicBitset::bitwise_andnot(
+    const DynamicBitset& other1, const DynamicBitset& other2) {
+  KATANA_LOG_DEBUG_ASSERT(size() == other1.size());
+  KATANA_LOG_DEBUG_ASSERT(size() == other2.size());
+  const auto& other_bitvec1 = other1.get_vec();
+  const auto& other_bitvec2 = other2.get_vec();
+
+  // other1's unused trailing bits are 0, so the result's are too even
+  // though ~other2 sets them.
+  katana::do_all(
+      katana::iterate(size_t{0}, bitvec_.size()),
+      [&](size_t i) { bitvec_[i] = other_bitvec1[i] & ~other_bitvec2[i]; },
+      katana::no_stats());
+}
+
 void
 katana::DynamicBitset::bitwise_xor(const DynamicBitset& other) {
   KATANA_LOG_DEBUG_ASSERT(size() == other.size());
@@ -91,6 +117,19 @@ katana::DynamicBitset::bitwise_xor(
       katana::no_stats());
 }
 
+namespace {
+size_t
+PopCount(uint64_t n) {
+#ifdef __GNUC__
+  return __builtin_popcountll(n);
+#else
+  n = n - ((n >> 1) & 0x5555555555555555UL);
+  n = (n & 0x3333333333333333UL) + ((n >> 2) & 0x3333333333333333UL);
+  return (((n + (n >> 4)) & 0xF0F0F0F0F0F0F0FUL) * 0x101010101010101UL) >> 56;
+#endif
+}
+}  // namespace
+
 size_t
 katana::DynamicBitset::count() const {
   katana::GAccumulator<size_t> ret;
@@ -110,6 +149,37 @@ katana::DynamicBitset::count() const {
   return ret.reduce();
 }
 
+size_t
+katana::DynamicBitset::count(size_t begin, size_t end) const {
+  if (begin >= end) {
+    return 0;
+  }
+  KATANA_LOG_DEBUG_ASSERT(end <= size());
+
+  size_t first_word = begin / kNumBitsInUint64;
+  size_t last_word = (end - 1) / kNumBitsInUint64;
+  uint64_t first_mask = ~uint64_t{0} << (begin % kNumBitsInUint64);
+  size_t end_offset = end % kNumBitsInUint64;
+  uint64_t last_mask =
+      end_offset == 0 ? ~uint64_t{0} : (uint64_t{1} << end_offset) - 1;
+
+  katana::GAccumulator<size_t> ret;
+  katana::do_all(
+      katana::iterate(first_word, last_word + 1),
+      [&](size_t w) {
+        uint64_t word = bitvec_[w];
+        if (w == first_word) {
+          word &= first_mask;
+        }
+        if (w == last_word) {
+          word &= last_mask;
+        }
+        ret += PopCount(word);
+      },
+      katana::no_stats());
+  return ret.reduce();
+}
+
 size_t
 katana::DynamicBitset::SerialCount() const {
   size_t ret = 0;
@@ -125,67 +195,37 @@ katana::DynamicBitset::SerialCount() const {
   return ret;
 }
 
-namespace {
-template <typename Integer>
-void
-ComputeOffsets(
-    const katana::DynamicBitset& bitset, std::vector<Integer>* offsets) {
-  // TODO uint32_t is somewhat dangerous; change in the future
-  uint32_t activeThreads = katana::getActiveThreads();
-  std::vector<Integer> tPrefixBitCounts(activeThreads);
-
-  // count how many bits are set on each thread
-  katana::on_each([&](unsigned tid, unsigned nthreads) {
-    auto [start, end] =
-        katana::block_range(size_t{0}, bitset.size(), tid, nthreads);
-
-    Integer count = 0;
-    for (Integer i = start; i < end; ++i) {
-      if (bitset.test(i)) {
-        ++count;
-      }
-    }
-
-    tPrefixBitCounts[tid] = count;
-  });
-
-  // calculate prefix sum of bits per thread
-  for (uint32_t i = 1; i < activeThreads; ++i) {
-    tPrefixBitCounts[i] += tPrefixBitCounts[i - 1];
+size_t
+katana::DynamicBitset::SerialCount(size_t begin, size_t end) const {
+  if (begin >= end) {
+    return 0;
   }
+  KATANA_LOG_DEBUG_ASSERT(end <= size());
 
-  // total num of set bits
-  Integer bitsetCount = tPrefixBitCounts[activeThreads - 1];
-
-  // calculate the indices of the set bits and save them to the offset
-  // vector
-  if (bitsetCount > 0) {
-    size_t cur_size = offsets->size();
-    offsets->resize(cur_size + bitsetCount);
-    katana::on_each([&](unsigned tid, unsigned nthreads) {
-      auto [start, end] =
-          katana::block_range(size_t{0}, bitset.size(), tid, nthreads);
-      Integer index = cur_size;
-      if (tid != 0) {
-        index += tPrefixBitCounts[tid - 1];
-      }
-
-      for (Integer i = start; i < end; ++i) {
-        if (bitset.test(i)) {
-          offsets->at(index) = i;
-          ++index;
-        }
-      }
-    });
+  size_t first_word = begin / kNumBitsInUint64;
+  size_t last_word = (end - 1) / kNumBitsInUint64;
+  uint64_t first_mask = ~uint64_t{0} << (begin % kNumBitsInUint64);
+  size_t end_offset = end % kNumBitsInUint64;
+  uint64_t last_mask =
+      end_offset == 0 ? ~uint64_t{0} : (uint64_t{1} << end_offset) - 1;
+
+  if (first_word == last_word) {
+    return PopCount(bitvec_[first_word] & first_mask & last_mask);
   }
+
+  size_t ret = PopCount(bitvec_[first_word] & first_mask);
+  for (size_t w = first_word + 1; w < last_word; ++w) {
+    ret += PopCount(bitvec_[w]);
+  }
+  ret += PopCount(bitvec_[last_word] & last_mask);
+  return ret;
 }
-}  //namespace
 
 template <>
 std::vector<uint32_t>
 katana::DynamicBitset::GetOffsets<uint32_t>() const {
   std::vector<uint32_t> offsets;
-  ComputeOffsets<uint32_t>(*this, &offsets);
+  katana::ParallelSTL::copy_set_bits(*this, &offsets);
   return offsets;
 }
 
@@ -193,18 +233,18 @@ template <>
 std::vector<uint64_t>
 katana::DynamicBitset::GetOffsets<uint64_t>() const {
   std::vector<uint64_t> offsets;
-  ComputeOffsets<uint64_t>(*this, &offsets);
+  katana::ParallelSTL::copy_set_bits(*this, &offsets);
   return offsets;
 }
 
 template <>
 void
 katana::DynamicBitset::AppendOffsets(std::vector<uint32_t>* offsets) const {
-  ComputeOffsets<uint32_t>(*this, offsets);
+  katana::ParallelSTL::copy_set_bits(*this, offsets);
 }
 
 template <>
 void
 katana::DynamicBitset::AppendOffsets(std::vector<uint64_t>* offsets) const {
-  ComputeOffsets<uint64_t>(*this, offsets);
+  katana::ParallelSTL::copy_set_bits(*this, offsets);
 }
@@ -20,6 +20,7 @@
 #include "katana/GaloisRuntime.h"
 
 #include <memory>
+#include <vector>
 
 #include "katana/Barrier.h"
 #include "katana/PagePool.h"
@@ -95,41 +96,46 @@ public:
   }
 };
 
-// Dijkstra style 2-pass tree termination detection
+// Dijkstra style 2-pass tree termination detection whose tree shape
+// matches the machine topology: non-leader threads report to their
+// socket leader and socket leaders report to the master. A round is
+// two hops deep instead of a ring lap of active_threads hops, and
+// every up token is written into its author's own cache-line-padded
+// holder, so the only lines that cross sockets are the leaders'.
 class TreeTerminationDetection : public katana::TerminationDetection {
-  static constexpr int kNumChildren = 2;
-
   struct TokenHolder {
-    // incoming from above
-    volatile long down_token;
-    // incoming from below
-    volatile long up_token[kNumChildren];
+    // set by the parent, consumed by this thread
+    std::atomic<long> down_token;
+    // written by this thread, read and reset by the parent;
+    // -1 pending, otherwise the blackness of this subtree
+    std::atomic<long> up_token;
     // my state
     long process_is_black;
     bool has_token;
     bool last_was_white;  // only used by the master
-    int parent;
-    int parent_offset;
-    TokenHolder* child[kNumChildren];
   };
 
   katana::PerThreadStorage<TokenHolder> data_;
 
-  unsigned active_threads_;
+  // Tree shape indexed by tid; rebuilt by Init when the thread count
+  // changes and read-only while a loop runs.
+  std::vector<unsigned> parent_;
+  std::vector<std::vector<unsigned>> children_;
+
+  unsigned active_threads_{0};
 
   void ProcessToken() {
     TokenHolder& th = *data_.getLocal();
-    // int myid = LL::getTID();
+    unsigned tid = katana::ThreadPool::getTID();
     // have all up tokens?
     bool have_all = th.has_token;
     bool black = th.process_is_black;
-    for (int i = 0; i < kNumChildren; ++i) {
-      if (th.child[i]) {
-        if (th.up_token[i] == -1) {
-          have_all = false;
-        } else {
-          black |= th.up_token[i];
-        }
+    for (unsigned c : children_[tid]) {
+      long up = data_.getRemote(c)->up_token;
+      if (up == -1) {
+        have_all = false;
+      } else {
+        black |= up;
       }
     }
     // Have the tokens, propagate
@@ -145,7 +151,7 @@ class TreeTerminationDetection : public katana::TerminationDetection {
         th.last_was_white = !black;
         th.down_token = true;
       } else {
-        data_.getRemote(th.parent)->up_token[th.parent_offset] = black;
+        th.up_token = black;
       }
     }
 
@@ -153,10 +159,10 @@ class TreeTerminationDetection : public katana::TerminationDetection {
     if (th.down_token) {
       th.down_token = false;
       th.has_token = true;
-      for (int i = 0; i < kNumChildren; ++i) {
-        th.up_token[i] = -1;
-        if (th.child[i])
-          th.child[i]->down_token = true;
+      for (unsigned c : children_[tid]) {
+        TokenHolder& ch = *data_.getRemote(c);
+        ch.up_token = -1;
+        ch.down_token = true;
       }
     }
   }
@@ -165,31 +171,34 @@ class TreeTerminationDetection : public katana::TerminationDetection {
 
 protected:
   void Init(unsigned active_threads) override {
+    if (active_threads == active_threads_) {
+      return;
+    }
     active_threads_ = active_threads;
+
+    auto& tp = katana::GetThreadPool();
+    parent_.assign(active_threads, 0);
+    children_.assign(active_threads, {});
+    for (unsigned tid = 1; tid < active_threads; ++tid) {
+      unsigned leader = tp.getLeaderForSocket(tp.getSocket(tid));
+      // Socket leaders (and threads whose leader is inactive) report
+      // straight to the master.
+      unsigned parent =
+          (leader == tid || leader >= active_threads) ? 0 : leader;
+      parent_[tid] = parent;
+      children_[parent].push_back(tid);
+    }
   }
 
 public:
   void InitializeThread() override {
     TokenHolder& th = *data_.getLocal();
     th.down_token = false;
-    for (int i = 0; i < kNumChildren; ++i) {
-      th.up_token[i] = false;
-    }
+    th.up_token = -1;
     th.process_is_black = true;
     th.has_token = false;
     th.last_was_white = false;
     ResetTerminated();
-    auto tid = katana::ThreadPool::getTID();
-    th.parent = (tid - 1) / kNumChildren;
-    th.parent_offset = (tid - 1) % kNumChildren;
-    for (unsigned i = 0; i < kNumChildren; ++i) {
-      unsigned cn = tid * kNumChildren + i + 1;
-      if (cn < active_threads_) {
-        th.child[i] = data_.getRemote(cn);
-      } else {
-        th.child[i] = 0;
-      }
-    }
     if (IsSysMaster()) {
       th.down_token = true;
     }
@@ -207,7 +216,8 @@ public:
 
 struct katana::GaloisRuntime::Impl {
   struct Dependents {
-    LocalTerminationDetection term;
+    LocalTerminationDetection ring_term;
+    TreeTerminationDetection tree_term;
     std::unique_ptr<Barrier> barrier;
     internal::PageAllocState<> page_pool;
     katana::StatManager stat_manager;
@@ -224,10 +234,17 @@ katana::GaloisRuntime::GaloisRuntime() : impl_(std::make_unique<Impl>()) {
   // may call GetThreadPool() in their constructors
   impl_->deps = std::make_unique<Impl::Dependents>();
   impl_->deps->barrier =
-      katana::CreateTopoBarrier(impl_->thread_pool.getMaxUsableThreads());
+      katana::CreateBarrier(impl_->thread_pool.getMaxUsableThreads());
 
   internal::SetBarrier(impl_->deps->barrier.get());
-  internal::SetTerminationDetection(&impl_->deps->term);
+  // On a single socket the ring detector passes its token over lines
+  // that are already local; across sockets the topology-matched tree
+  // keeps token traffic within each socket except for the leaders.
+  if (impl_->thread_pool.getMaxSockets() > 1) {
+    internal::SetTerminationDetection(&impl_->deps->tree_term);
+  } else {
+    internal::SetTerminationDetection(&impl_->deps->ring_term);
+  }
   internal::setPagePoolState(&impl_->deps->page_pool);
   katana::internal::setSysStatManager(&impl_->deps->stat_manager);
 }
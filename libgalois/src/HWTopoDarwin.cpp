@@ -56,6 +56,9 @@ makeHWTopo() {
   mti.maxThreads = getIntValue("hw.logicalcpu_max");
   mti.maxCores = getIntValue("hw.physicalcpu_max");
   mti.maxNumaNodes = mti.maxSockets;
+  // No per-core class information is exposed; treat all cores as
+  // performance class.
+  mti.maxPerformanceThreads = mti.maxThreads;
 
   std::vector<ThreadTopoInfo> tti;
   tti.reserve(mti.maxThreads);
@@ -133,6 +136,16 @@ katana::bindThreadSelf([[maybe_unused]] unsigned osContext) {
   return true;
 }
 
+bool
+katana::bindThreadToCPUSet(const std::vector<int>& os_cpus) {
+  // Mach affinity tags name a single logical context, not a mask; fall back
+  // to the first context in the set.
+  if (os_cpus.empty()) {
+    return false;
+  }
+  return bindThreadSelf(static_cast<unsigned>(os_cpus.front()));
+}
+
 HWTopoInfo
 katana::getHWTopo() {
   static SimpleLock lock;
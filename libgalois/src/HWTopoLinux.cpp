@@ -51,9 +51,11 @@ struct cpuinfo {
   unsigned sib;
   unsigned coreid;
   unsigned cpucores;
-  unsigned numaNode;  // from libnuma
-  bool valid;         // from cpuset
-  bool smt;           // computed
+  unsigned numaNode;    // from libnuma
+  unsigned maxFreqKhz;  // from cpufreq; 0 if not exposed
+  unsigned coreClass;   // computed; 0 = performance, 1 = efficiency
+  bool valid;           // from cpuset
+  bool smt;             // computed
 };
 
 bool
@@ -61,6 +63,12 @@ operator<(const cpuinfo& lhs, const cpuinfo& rhs) {
   if (lhs.smt != rhs.smt) {
     return lhs.smt < rhs.smt;
   }
+  // Within the primary contexts, number performance cores before
+  // efficiency cores so clamping a loop's thread count excludes the
+  // stragglers on hybrid machines.
+  if (lhs.coreClass != rhs.coreClass) {
+    return lhs.coreClass < rhs.coreClass;
+  }
   if (lhs.physid != rhs.physid) {
     return lhs.physid < rhs.physid;
   }
@@ -124,6 +132,18 @@ getNumaNode(const cpuinfo& c) {
 #endif
 }
 
+unsigned
+readMaxFreqKhz(unsigned proc) {
+  std::ifstream freq_file(
+      "/sys/devices/system/cpu/cpu" + std::to_string(proc) +
+      "/cpufreq/cpuinfo_max_freq");
+  unsigned khz = 0;
+  if (freq_file) {
+    freq_file >> khz;
+  }
+  return khz;
+}
+
 //! Parse /proc/cpuinfo
 std::vector<cpuinfo>
 parseCPUInfo() {
@@ -158,6 +178,7 @@ parseCPUInfo() {
 
   for (auto& c : vals) {
     c.numaNode = getNumaNode(c);
+    c.maxFreqKhz = readMaxFreqKhz(c.proc);
   }
 
   return vals;
@@ -236,6 +257,25 @@ parseCPUSet() {
   return katana::parseCPUList(line);
 }
 
+// Classify cores on hybrid (P/E) machines by their maximum frequency.
+// Favored-core turbo leaves a couple of performance cores a bin or two
+// above the rest, so anything within 90% of the fastest core counts as
+// performance class; efficiency cores sit well below that. Machines that
+// do not expose cpufreq report a single class.
+void
+markCoreClass(std::vector<cpuinfo>& info) {
+  unsigned machine_max = 0;
+  for (auto& c : info) {
+    machine_max = std::max(machine_max, c.maxFreqKhz);
+  }
+  for (auto& c : info) {
+    c.coreClass =
+        (c.maxFreqKhz > 0 && c.maxFreqKhz < machine_max - machine_max / 10)
+            ? 1
+            : 0;
+  }
+}
+
 void
 markValid(std::vector<cpuinfo>& info) {
   auto v = parseCPUSet();
@@ -265,12 +305,18 @@ makeHWTopo() {
           info.begin(), info.end(), [](const cpuinfo& c) { return c.valid; }),
       info.end());
 
+  markCoreClass(info);
   std::sort(info.begin(), info.end());
   markSMT(info);
   retMTI.maxSockets = countSockets(info);
   retMTI.maxThreads = info.size();
   retMTI.maxCores = countCores(info);
   retMTI.maxNumaNodes = countNumaNodes(info);
+  retMTI.maxPerformanceThreads = 0;
+  while (retMTI.maxPerformanceThreads < info.size() &&
+         info[retMTI.maxPerformanceThreads].coreClass == 0) {
+    ++retMTI.maxPerformanceThreads;
+  }
 
   std::vector<katana::ThreadTopoInfo> retTTI;
   retTTI.reserve(retMTI.maxThreads);
@@ -296,7 +342,7 @@ makeHWTopo() {
         i, leader, repid,
         (unsigned)std::distance(
             numaNodes.begin(), numaNodes.find(info[i].numaNode)),
-        mid, info[i].proc, info[i].numaNode});
+        mid, info[i].proc, info[i].numaNode, info[i].coreClass});
   }
 
   return {
@@ -344,3 +390,28 @@ katana::bindThreadSelf([[maybe_unused]] unsigned osContext) {
   return false;
 #endif
 }
+
+bool
+katana::bindThreadToCPUSet([[maybe_unused]] const std::vector<int>& os_cpus) {
+#ifdef KATANA_USE_SCHED_SETAFFINITY
+  if (os_cpus.empty()) {
+    return false;
+  }
+  cpu_set_t mask;
+  CPU_ZERO(&mask);
+  for (int cpu : os_cpus) {
+    (void)CPU_SET(cpu, &mask);
+  }
+  if (sched_setaffinity(0, sizeof(mask), &mask) == -1) {
+    katana::gWarn(
+        "Could not set CPU affinity to a set of ", os_cpus.size(), " cpus (",
+        strerror(errno), ")");
+    return false;
+  }
+  return true;
+#else
+  KATANA_WARN_ONCE(
+      "Cannot set cpu affinity on this platform.  Performance will be bad.");
+  return false;
+#endif
+}
@@ -24,6 +24,7 @@
 
 #include "katana/Executor_OnEach.h"
 #include "katana/Mem.h"
+#include "katana/Statistics.h"
 
 void
 katana::Prealloc(size_t pagesPerThread, size_t bytes) {
@@ -69,6 +70,16 @@ katana::EnsurePreallocated(size_t pages) {
   });
 }
 
+void
+katana::internal::ReportHeapStats(
+    const char* tag, size_t live_bytes, size_t high_water_bytes,
+    size_t total_allocs) {
+  std::string category(tag);
+  ReportStatSum("MemHeap", category + "LiveBytes", live_bytes);
+  ReportStatSum("MemHeap", category + "HighWaterBytes", high_water_bytes);
+  ReportStatSum("MemHeap", category + "Allocs", total_allocs);
+}
+
 // Anchor the class
 katana::SystemHeap::SystemHeap() {
   KATANA_LOG_DEBUG_ASSERT(AllocSize == katana::allocSize());
@@ -1,8 +1,18 @@
 #include "katana/MemoryPolicy.h"
 
+#include <cerrno>
+#include <cstring>
 #include <fstream>
 #include <regex>
+#include <vector>
 
+#if __linux__
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "katana/Env.h"
+#include "katana/ErrorCode.h"
 #include "katana/MemoryPolicy.h"
 #include "katana/MemorySupervisor.h"
 #include "katana/ProgressTracer.h"
@@ -235,6 +245,11 @@ katana::MemoryPolicyNull::KillSelfForLackOfMemory(
   return false;
 }
 
+katana::MemoryTier
+katana::MemoryPolicyNull::TierFor([[maybe_unused]] MemoryUse use) const {
+  return MemoryTier::kLocalDRAM;
+}
+
 katana::MemoryPolicyNull::MemoryPolicyNull()
     : MemoryPolicy({
           .high_used_ratio_threshold = 0.85,
@@ -246,6 +261,84 @@ katana::MemoryPolicyNull::MemoryPolicyNull()
 //////////////////////////////////////////////////////////////////////
 // MemoryPolicy
 
+int
+katana::MemoryPolicy::FarMemoryNode() {
+  static int far_node = []() {
+    int node = -1;
+    katana::GetEnv("KATANA_FAR_MEMORY_NODE", &node);
+    return node;
+  }();
+  return far_node;
+}
+
+katana::MemoryTier
+katana::MemoryPolicy::TierFor(MemoryUse use) const {
+  if (FarMemoryNode() < 0) {
+    return MemoryTier::kLocalDRAM;
+  }
+  switch (use) {
+  case MemoryUse::kTopology:
+    return MemoryTier::kLocalDRAM;
+  case MemoryUse::kPropertyColumn:
+  case MemoryUse::kOutOfCoreBuffer:
+    return MemoryTier::kFarMemory;
+  }
+  return MemoryTier::kLocalDRAM;
+}
+
+#if defined(__linux__) && defined(SYS_mbind)
+
+namespace {
+// From linux/mempolicy.h; we call mbind directly rather than adding a
+// libnuma dependency for one syscall.
+constexpr int kMpolDefault = 0;
+constexpr int kMpolBind = 2;
+constexpr unsigned kMpolMfMove = 1U << 1;
+}  // namespace
+
+katana::Result<void>
+katana::MemoryPolicy::BindRegion(void* addr, size_t len, MemoryTier tier) {
+  if (tier == MemoryTier::kLocalDRAM) {
+    // Drop any binding; pages fault locally from here on. Pages already on
+    // the far tier stay there until touched under kernel tiering/migration.
+    if (syscall(SYS_mbind, addr, len, kMpolDefault, nullptr, 0UL, 0U) != 0) {
+      return KATANA_ERROR(
+          ErrorCode::InvalidArgument, "mbind: {}", std::strerror(errno));
+    }
+    return ResultSuccess();
+  }
+
+  int node = FarMemoryNode();
+  if (node < 0) {
+    return KATANA_ERROR(
+        ErrorCode::InvalidArgument,
+        "no far-memory node configured (KATANA_FAR_MEMORY_NODE)");
+  }
+  constexpr size_t kBitsPerLong = 8 * sizeof(unsigned long);
+  std::vector<unsigned long> nodemask(node / kBitsPerLong + 1, 0UL);
+  nodemask[node / kBitsPerLong] = 1UL << (node % kBitsPerLong);
+  if (syscall(
+          SYS_mbind, addr, len, kMpolBind, nodemask.data(),
+          nodemask.size() * kBitsPerLong, kMpolMfMove) != 0) {
+    return KATANA_ERROR(
+        ErrorCode::InvalidArgument, "mbind to node {}: {}", node,
+        std::strerror(errno));
+  }
+  return ResultSuccess();
+}
+
+#else
+
+katana::Result<void>
+katana::MemoryPolicy::BindRegion(
+    [[maybe_unused]] void* addr, [[maybe_unused]] size_t len,
+    [[maybe_unused]] MemoryTier tier) {
+  return KATANA_ERROR(
+      ErrorCode::NotImplemented, "platform does not support mbind");
+}
+
+#endif
+
 katana::MemoryPolicy::MemoryPolicy(
     katana::MemoryPolicy::Thresholds thresholds) {
   physical_ = katana::MemorySupervisor::GetTotalSystemMemory();
@@ -0,0 +1,172 @@
+#include "katana/MemoryReservation.h"
+
+#include <condition_variable>
+#include <cstdlib>
+#include <mutex>
+
+#include "katana/Env.h"
+#include "katana/Logging.h"
+#include "katana/MemorySupervisor.h"
+
+namespace {
+
+/// Grant bookkeeping for the admission controller. Separate from the
+/// MemorySupervisor singleton because admission is inherently concurrent
+/// (queries block here from different threads) while the supervisor is
+/// documented as not thread safe.
+struct AdmissionState {
+  std::mutex lock;
+  std::condition_variable admitted;
+  uint64_t budget;
+  uint64_t granted{0};
+  uint64_t running{0};
+  /// FIFO ticket queue; queries are admitted in arrival order so a stream
+  /// of small queries cannot starve a large one.
+  uint64_t next_ticket{0};
+  uint64_t serving_ticket{0};
+
+  AdmissionState() {
+    uint64_t physical = katana::MemorySupervisor::GetTotalSystemMemory();
+    budget = physical - physical / 5;  // 80%
+    std::string configured;
+    if (katana::GetEnv("KATANA_ADMISSION_BUDGET_BYTES", &configured)) {
+      uint64_t parsed = std::strtoull(configured.c_str(), nullptr, 10);
+      if (parsed > 0) {
+        budget = parsed;
+      } else {
+        KATANA_LOG_WARN(
+            "ignoring unparsable KATANA_ADMISSION_BUDGET_BYTES: {}",
+            configured);
+      }
+    }
+  }
+};
+
+AdmissionState&
+State() {
+  static AdmissionState state;
+  return state;
+}
+
+thread_local katana::MemoryReservation* current_reservation = nullptr;
+
+}  // namespace
+
+katana::MemoryReservation::MemoryReservation(
+    std::string query_name, uint64_t estimated_bytes, AdmitNow)
+    : query_name_(std::move(query_name)), estimated_bytes_(estimated_bytes) {}
+
+katana::MemoryReservation::MemoryReservation(
+    std::string query_name, uint64_t estimated_bytes)
+    : MemoryReservation(std::move(query_name), estimated_bytes, AdmitNow{}) {
+  AdmissionState& state = State();
+  std::unique_lock<std::mutex> guard(state.lock);
+  uint64_t ticket = state.next_ticket++;
+  state.admitted.wait(guard, [&] {
+    if (ticket != state.serving_ticket) {
+      return false;
+    }
+    if (state.granted + estimated_bytes_ <= state.budget) {
+      return true;
+    }
+    // Larger than the whole budget: run it alone rather than deadlock.
+    return estimated_bytes_ > state.budget && state.running == 0;
+  });
+  if (estimated_bytes_ > state.budget) {
+    KATANA_LOG_WARN(
+        "query {} declares {} bytes, more than the {} byte admission "
+        "budget; admitting it alone",
+        query_name_, estimated_bytes_, state.budget);
+  }
+  state.granted += estimated_bytes_;
+  state.running++;
+  state.serving_ticket++;
+  // The next queued query may also fit.
+  state.admitted.notify_all();
+}
+
+katana::Result<std::unique_ptr<katana::MemoryReservation>>
+katana::MemoryReservation::TryMake(
+    std::string query_name, uint64_t estimated_bytes) {
+  AdmissionState& state = State();
+  std::lock_guard<std::mutex> guard(state.lock);
+  if (state.next_ticket != state.serving_ticket ||
+      state.granted + estimated_bytes > state.budget) {
+    return KATANA_ERROR(
+        ErrorCode::OutOfMemory,
+        "admission budget exhausted: {} bytes requested, {} of {} granted",
+        estimated_bytes, state.granted, state.budget);
+  }
+  state.next_ticket++;
+  state.serving_ticket++;
+  state.granted += estimated_bytes;
+  state.running++;
+  return std::unique_ptr<MemoryReservation>(new MemoryReservation(
+      std::move(query_name), estimated_bytes, AdmitNow{}));
+}
+
+katana::MemoryReservation::~MemoryReservation() {
+  uint64_t peak = charged_.load(std::memory_order_relaxed);
+  if (peak > estimated_bytes_) {
+    KATANA_LOG_WARN(
+        "query {} still holds {} bytes against a {} byte estimate at "
+        "release",
+        query_name_, peak, estimated_bytes_);
+  }
+  AdmissionState& state = State();
+  std::lock_guard<std::mutex> guard(state.lock);
+  state.granted -= estimated_bytes_;
+  state.running--;
+  state.admitted.notify_all();
+}
+
+uint64_t
+katana::MemoryReservation::charged_bytes() const {
+  return charged_.load(std::memory_order_relaxed);
+}
+
+void
+katana::MemoryReservation::Charge(uint64_t bytes) {
+  uint64_t now =
+      charged_.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+  if (now > estimated_bytes_ &&
+      !warned_over_estimate_.exchange(true, std::memory_order_relaxed)) {
+    KATANA_LOG_WARN(
+        "query {} exceeded its declared working set: {} bytes allocated "
+        "against a {} byte reservation",
+        query_name_, now, estimated_bytes_);
+  }
+}
+
+void
+katana::MemoryReservation::Release(uint64_t bytes) {
+  charged_.fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+katana::MemoryReservation::Scope::Scope(MemoryReservation* reservation)
+    : previous_(current_reservation) {
+  current_reservation = reservation;
+}
+
+katana::MemoryReservation::Scope::~Scope() {
+  current_reservation = previous_;
+}
+
+void
+katana::internal::ChargeCurrentReservation(uint64_t bytes) {
+  if (current_reservation != nullptr) {
+    current_reservation->Charge(bytes);
+  }
+}
+
+void
+katana::internal::ReleaseCurrentReservation(uint64_t bytes) {
+  if (current_reservation != nullptr) {
+    current_reservation->Release(bytes);
+  }
+}
+
+katana::MemoryReservation*
+katana::internal::CurrentReservation() {
+  return current_reservation;
+}
@@ -1,10 +1,19 @@
 #include "katana/MemorySupervisor.h"
 
+#include <cstring>
 #include <fstream>
+#include <sstream>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 #include "katana/Cache.h"
 #include "katana/MemoryPolicy.h"
 #include "katana/PropertyManager.h"
+#include "katana/Statistics.h"
 #include "katana/Time.h"
 
 using katana::count_t;
@@ -33,6 +42,81 @@ KillCheck(
   }
 }
 
+// The kernel's per-node page placement counters; always readable.
+void
+ReadNumaStat(std::vector<uint64_t>* local, std::vector<uint64_t>* other) {
+  local->clear();
+  other->clear();
+  for (unsigned node = 0;; ++node) {
+    std::ifstream stat(
+        "/sys/devices/system/node/node" + std::to_string(node) + "/numastat");
+    if (!stat) {
+      break;
+    }
+    uint64_t local_pages = 0;
+    uint64_t other_pages = 0;
+    std::string key;
+    uint64_t value;
+    while (stat >> key >> value) {
+      if (key == "local_node") {
+        local_pages = value;
+      } else if (key == "other_node") {
+        other_pages = value;
+      }
+    }
+    local->push_back(local_pages);
+    other->push_back(other_pages);
+  }
+}
+
+#ifdef __linux__
+
+// Parse an uncore event spec like "event=0x04,umask=0x03" into a
+// perf_event_attr config value.
+uint64_t
+ParseEventSpec(const std::string& spec) {
+  uint64_t config = 0;
+  std::stringstream ss(spec);
+  std::string field;
+  while (std::getline(ss, field, ',')) {
+    auto eq = field.find('=');
+    if (eq == std::string::npos) {
+      continue;
+    }
+    std::string name = field.substr(0, eq);
+    uint64_t value = std::strtoull(field.c_str() + eq + 1, nullptr, 0);
+    if (name == "event") {
+      config |= value;
+    } else if (name == "umask") {
+      config |= value << 8;
+    }
+  }
+  return config;
+}
+
+// First CPU of a NUMA node, for pinning that node's uncore counters.
+int
+FirstCpuOfNode(unsigned node) {
+  std::ifstream cpulist(
+      "/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+  int cpu = -1;
+  cpulist >> cpu;
+  return cpu;
+}
+
+int
+OpenUncoreEvent(uint32_t pmu_type, uint64_t config, int cpu) {
+  perf_event_attr attr;
+  std::memset(&attr, 0, sizeof(attr));
+  attr.type = pmu_type;
+  attr.size = sizeof(attr);
+  attr.config = config;
+  // Uncore counters are per-socket, not per-task: pid -1, pinned cpu.
+  return static_cast<int>(syscall(SYS_perf_event_open, &attr, -1, cpu, -1, 0));
+}
+
+#endif
+
 }  // anonymous namespace
 
 void
@@ -175,6 +259,31 @@ katana::MemorySupervisor::StandbyToActive(
   KillCheck(policy_.get(), standby_, bytes_reclaimed_);
 }
 
+void
+katana::MemorySupervisor::RegisterManager(std::unique_ptr<Manager> manager) {
+  const auto& name = manager->Name();
+  if (managers_.count(name) > 0) {
+    KATANA_LOG_WARN("manager with name {} already registered", name);
+    return;
+  }
+  managers_[name].manager_ = std::move(manager);
+}
+
+void
+katana::MemorySupervisor::UnregisterManager(const std::string& name) {
+  auto it = managers_.find(name);
+  if (it == managers_.end()) {
+    KATANA_LOG_WARN("no manager with name {}\n", name);
+    return;
+  }
+  if (it->second.standby != 0) {
+    LogState(unregister_str, standby_, bytes_reclaimed_);
+    StandbyMinus(it->second, it->second.standby);
+  }
+  managers_.erase(it);
+  SanityCheck();
+}
+
 void
 katana::MemorySupervisor::CheckPressure() {
   count_t try_reclaim = policy_->ReclaimForMemoryPressure(standby_);
@@ -204,6 +313,115 @@ katana::MemorySupervisor::GetPropertyCacheStats() const {
 void
 katana::MemorySupervisor::LogMemoryStats(const std::string& message) {
   policy_->LogMemoryStats(message, standby_);
+  ReportNumaTraffic(message);
+}
+
+void
+katana::MemorySupervisor::OpenUncoreCounters() {
+  uncore_opened_ = true;
+#ifdef __linux__
+  std::vector<uint64_t> local;
+  std::vector<uint64_t> other;
+  ReadNumaStat(&local, &other);
+  const unsigned num_nodes = local.size();
+  if (num_nodes == 0) {
+    return;
+  }
+
+  // Each socket's memory controller shows up as one or more
+  // uncore_imc_<n> PMUs; cas_count counts DRAM transfers in 64-byte
+  // lines. Opening can fail for lack of privilege; we simply end up
+  // with no counters and report page placement only.
+  for (unsigned imc = 0; imc < 16; ++imc) {
+    std::string base =
+        "/sys/bus/event_source/devices/uncore_imc_" + std::to_string(imc);
+    uint32_t pmu_type = 0;
+    {
+      std::ifstream type_file(base + "/type");
+      if (!(type_file >> pmu_type)) {
+        continue;
+      }
+    }
+    for (const char* event : {"cas_count_read", "cas_count_write"}) {
+      std::string spec;
+      {
+        std::ifstream spec_file(base + "/events/" + event);
+        if (!std::getline(spec_file, spec)) {
+          continue;
+        }
+      }
+      uint64_t config = ParseEventSpec(spec);
+      for (unsigned node = 0; node < num_nodes; ++node) {
+        int cpu = FirstCpuOfNode(node);
+        if (cpu < 0) {
+          continue;
+        }
+        int fd = OpenUncoreEvent(pmu_type, config, cpu);
+        if (fd >= 0) {
+          uncore_counters_.push_back(UncoreCounter{fd, node});
+        }
+      }
+    }
+  }
+#endif
+}
+
+void
+katana::MemorySupervisor::ReportNumaTraffic(const std::string& region) {
+  if (!uncore_opened_) {
+    OpenUncoreCounters();
+  }
+
+  std::vector<uint64_t> local;
+  std::vector<uint64_t> other;
+  ReadNumaStat(&local, &other);
+
+  std::vector<uint64_t> uncore(uncore_counters_.size(), 0);
+#ifdef __linux__
+  for (size_t i = 0; i < uncore_counters_.size(); ++i) {
+    uint64_t value = 0;
+    if (read(uncore_counters_[i].fd, &value, sizeof(value)) ==
+        static_cast<ssize_t>(sizeof(value))) {
+      uncore[i] = value;
+    }
+  }
+#endif
+
+  if (have_traffic_baseline_ && local.size() == last_numa_local_.size()) {
+    uint64_t local_pages = 0;
+    uint64_t remote_pages = 0;
+    for (size_t n = 0; n < local.size(); ++n) {
+      local_pages += local[n] - last_numa_local_[n];
+      remote_pages += other[n] - last_numa_other_[n];
+    }
+    ReportStatSum(region, "NumaLocalPages", local_pages);
+    ReportStatSum(region, "NumaRemotePages", remote_pages);
+    if (local_pages + remote_pages > 0) {
+      ReportStatSingle(
+          region, "NumaRemotePct",
+          100 * remote_pages / (local_pages + remote_pages));
+    }
+
+    // Sum each socket's IMC channels; counts are 64-byte lines.
+    std::vector<uint64_t> socket_bytes;
+    for (size_t i = 0; i < uncore_counters_.size(); ++i) {
+      unsigned socket = uncore_counters_[i].socket;
+      if (socket_bytes.size() <= socket) {
+        socket_bytes.resize(socket + 1, 0);
+      }
+      socket_bytes[socket] += (uncore[i] - last_uncore_[i]) * 64;
+    }
+    for (unsigned socket = 0; socket < socket_bytes.size(); ++socket) {
+      ReportStatSum(
+          region, "MemBytesSocket" + std::to_string(socket),
+          socket_bytes[socket]);
+    }
+  }
+
+  last_numa_local_ = std::move(local);
+  last_numa_other_ = std::move(other);
+  last_uncore_ = std::move(uncore);
+  have_traffic_baseline_ = true;
 }
 
 katana::PropertyManager*
@@ -19,6 +19,7 @@
 
 #include "katana/PageAlloc.h"
 
+#include <atomic>
 #include <mutex>
 
 #include "katana/Logging.h"
@@ -93,17 +94,35 @@ trymmap(size_t size, int flag) {
   return ptr;
 }
 
+// Whether MAP_HUGETLB allocations succeed on this machine; determined by the
+// first allocation. Once the hugetlb reservation is exhausted or absent,
+// asking again on every allocation just adds a failed mmap syscall.
+static std::atomic<bool> hugeTLBWorks(true);
+
 void*
 katana::allocPages(unsigned num, bool preFault) {
   if (num == 0) {
     return nullptr;
   }
 
-  void* ptr = trymmap(num * hugePageSize, preFault ? _MAP_HUGE_POP : _MAP_HUGE);
+  void* ptr = nullptr;
+  if (hugeTLBWorks.load(std::memory_order_relaxed)) {
+    ptr = trymmap(num * hugePageSize, preFault ? _MAP_HUGE_POP : _MAP_HUGE);
+    if (!ptr) {
+      KATANA_DEBUG_WARN_ONCE(
+          "huge page alloc failed, falling back to regular pages");
+      hugeTLBWorks.store(false, std::memory_order_relaxed);
+    }
+  }
   if (!ptr) {
-    KATANA_DEBUG_WARN_ONCE(
-        "huge page alloc failed, falling back to regular pages");
     ptr = trymmap(num * hugePageSize, preFault ? _MAP_POP : _MAP);
+#ifdef MADV_HUGEPAGE
+    if (ptr) {
+      // Regions are huge-page sized, so ask the kernel to back them with
+      // transparent huge pages even when no hugetlb pages are reserved.
+      madvise(ptr, num * hugePageSize, MADV_HUGEPAGE);
+    }
+#endif
   }
 
   if (!ptr) {
@@ -17,12 +17,78 @@
  * Documentation, or loss or inaccuracy of data of any kind.
  */
 
+#include <array>
 #include <ctime>
+#include <fstream>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <nlohmann/json.hpp>
 
 #include "katana/Env.h"
 #include "katana/Executor_ParaMeter.h"
 #include "katana/gIO.h"
 
+namespace {
+
+// One profiled loop execution: per-step (parallelism, wlSize, nhSize).
+struct LoopProfile {
+  std::string loopname;
+  std::vector<std::array<uint64_t, 3>> steps;
+};
+
+std::mutex profiles_lock;
+std::vector<LoopProfile>&
+Profiles() {
+  static std::vector<LoopProfile> profiles;
+  return profiles;
+}
+
+}  // namespace
+
+void
+katana::parameter::RecordStep(
+    const char* loopname, size_t step, size_t parallelism, size_t wlSize,
+    size_t nhSize) {
+  std::lock_guard<std::mutex> guard(profiles_lock);
+  auto& profiles = Profiles();
+  if (step == 0 || profiles.empty()) {
+    profiles.push_back(LoopProfile{loopname ? loopname : "(NULL)", {}});
+  }
+  profiles.back().steps.push_back({parallelism, wlSize, nhSize});
+}
+
+void
+katana::parameter::WriteStatsJson(std::ostream& out) {
+  nlohmann::json loops = nlohmann::json::array();
+
+  std::lock_guard<std::mutex> guard(profiles_lock);
+  for (const auto& profile : Profiles()) {
+    uint64_t total = 0;
+    uint64_t max_parallelism = 0;
+    nlohmann::json per_step = nlohmann::json::array();
+    for (const auto& step : profile.steps) {
+      total += step[0];
+      max_parallelism = std::max(max_parallelism, step[0]);
+      per_step.push_back(step[0]);
+    }
+    uint64_t num_steps = profile.steps.size();
+    loops.push_back({
+        {"loopname", profile.loopname},
+        {"critical_path_steps", num_steps},
+        {"total_iterations", total},
+        {"avg_parallelism",
+         num_steps ? static_cast<double>(total) / num_steps : 0.0},
+        {"max_parallelism", max_parallelism},
+        {"per_step_parallelism", std::move(per_step)},
+    });
+  }
+
+  out << nlohmann::json{{"loops", std::move(loops)}}.dump(2) << "\n";
+}
+
 struct StatsFileManager {
   bool init = false;
   bool isOpen = false;
@@ -97,4 +163,14 @@ katana::parameter::getStatsFile(void) {
 void
 katana::parameter::closeStatsFile(void) {
   getStatsFileManager().close();
+
+  // Rewrite the cumulative JSON summary after every profiled loop so
+  // harnesses find complete output no matter when the run stops.
+  std::string json_path;
+  if (katana::GetEnv("KATANA_PARAMETER_JSON", &json_path)) {
+    std::ofstream out(json_path, std::ios::trunc);
+    if (out) {
+      WriteStatsJson(out);
+    }
+  }
 }
@@ -20,12 +20,14 @@
 #include "katana/PerThreadStorage.h"
 
 #include <atomic>
+#include <cstring>
 #include <mutex>
 
 #include "katana/PageAlloc.h"
+#include "katana/config.h"
 #include "katana/gIO.h"
 
-KATANA_EXPORT thread_local char* katana::ptsBase;
+KATANA_TLS_INITIAL_EXEC KATANA_EXPORT thread_local char* katana::ptsBase;
 
 katana::PerBackend&
 katana::getPTSBackend() {
@@ -33,7 +35,7 @@ katana::getPTSBackend() {
   return b;
 }
 
-KATANA_EXPORT thread_local char* katana::pssBase;
+KATANA_TLS_INITIAL_EXEC KATANA_EXPORT thread_local char* katana::pssBase;
 
 katana::PerBackend&
 katana::getPPSBackend() {
@@ -44,14 +46,26 @@ katana::getPPSBackend() {
 const size_t ptAllocSize = katana::allocSize();
 inline void*
 alloc() {
-  // alloc a single page, don't prefault
-  void* toReturn = katana::allocPages(1, true);
+  // alloc a single page, don't prefault: the arena faults in as storage is
+  // actually used, so spinning up a thread does not touch the whole page
+  void* toReturn = katana::allocPages(1, false);
   if (toReturn == nullptr) {
     KATANA_DIE("per-thread storage out of memory");
   }
   return toReturn;
 }
 
+// Anonymous mappings are zero-filled by the kernel on first touch, so
+// explicitly zeroing the whole arena at thread startup would only serve to
+// prefault it. Only the jemalloc build, where allocPages comes from the
+// heap, needs the memset.
+inline void
+zeroArenaIfNeeded([[maybe_unused]] char* b) {
+#ifdef KATANA_USE_JEMALLOC
+  memset(b, 0, ptAllocSize);
+#endif
+}
+
 constexpr unsigned MAX_SIZE = 30;
 // PerBackend storage is typically cache-aligned. Simplify bookkeeping at the
 // expense of fragmentation by restricting all allocations to be cache-aligned.
@@ -169,7 +183,7 @@ char*
 katana::PerBackend::initPerThread(unsigned maxT) {
   initCommon(maxT);
   char* b = heads[ThreadPool::getTID()] = (char*)alloc();
-  memset(b, 0, ptAllocSize);
+  zeroArenaIfNeeded(b);
   return b;
 }
 
@@ -180,7 +194,7 @@ katana::PerBackend::initPerSocket(unsigned maxT) {
   unsigned leader = ThreadPool::getLeader();
   if (id == leader) {
     char* b = heads[id] = (char*)alloc();
-    memset(b, 0, ptAllocSize);
+    zeroArenaIfNeeded(b);
     return b;
   }
   char* expected = nullptr;
@@ -0,0 +1,109 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+#include "katana/PerfCounters.h"
+
+#include <cstring>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+#ifdef __linux__
+
+int
+OpenCounter(uint32_t type, uint64_t config) {
+  perf_event_attr attr;
+  std::memset(&attr, 0, sizeof(attr));
+  attr.type = type;
+  attr.size = sizeof(attr);
+  attr.config = config;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  // pid 0, cpu -1: this thread, wherever it runs.
+  return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+}
+
+uint64_t
+ReadCounter(int fd) {
+  uint64_t value = 0;
+  if (fd < 0 || read(fd, &value, sizeof(value)) != sizeof(value)) {
+    return 0;
+  }
+  return value;
+}
+
+#endif
+
+}  // namespace
+
+katana::PerfCounters&
+katana::PerfCounters::Get() {
+  static PerfCounters counters;
+  return counters;
+}
+
+void
+katana::PerfCounters::OpenLocal() {
+  ThreadState& state = *states_.getLocal();
+  if (state.cycles_fd != kUnopened) {
+    return;
+  }
+#ifdef __linux__
+  state.cycles_fd = OpenCounter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+  state.cache_misses_fd =
+      OpenCounter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+#else
+  state.cycles_fd = kUnavailable;
+  state.cache_misses_fd = kUnavailable;
+#endif
+}
+
+katana::PerfCounters::Sample
+katana::PerfCounters::Read() {
+  OpenLocal();
+  Sample sample;
+#ifdef __linux__
+  ThreadState& state = *states_.getLocal();
+  sample.cycles = ReadCounter(state.cycles_fd);
+  sample.cache_misses = ReadCounter(state.cache_misses_fd);
+#endif
+  return sample;
+}
+
+bool
+katana::PerfCounters::IsActive() {
+  OpenLocal();
+  return states_.getLocal()->cycles_fd >= 0;
+}
+
+katana::PerfCounters::ThreadState::~ThreadState() {
+#ifdef __linux__
+  if (cycles_fd >= 0) {
+    close(cycles_fd);
+  }
+  if (cache_misses_fd >= 0) {
+    close(cache_misses_fd);
+  }
+#endif
+}
@@ -22,9 +22,12 @@
 #include <sys/resource.h>
 #include <sys/time.h>
 
+#include <array>
 #include <fstream>
 #include <iostream>
+#include <mutex>
 #include <sstream>
+#include <vector>
 
 #include "katana/Env.h"
 #include "katana/Executor_OnEach.h"
@@ -126,6 +129,20 @@ struct StatImpl {
   }
 };
 
+/// Per-thread accumulator for one registered handle. Slots live in a
+/// fixed array indexed by HandleId, so the add path is a TLS lookup plus
+/// an addition into a private cache line region.
+struct HandleSlot {
+  int64_t val;
+  bool touched;
+};
+
+struct HandleInfo {
+  std::string region;
+  std::string category;
+  katana::StatTotal::Type type;
+};
+
 }  // end unnamed namespace
 
 class katana::StatManager::Impl {
@@ -134,6 +151,52 @@ public:
   StatImpl<double> fp_stats_;
   StatImpl<Str> str_stats_;
   std::string outfile_;
+
+  // Registration is the cold path and takes the lock; AddToHandle only
+  // reads the calling thread's buffer.
+  std::mutex handle_lock_;
+  std::vector<HandleInfo> handle_infos_;
+  PerThreadStorage<std::array<HandleSlot, kMaxHandles>> handle_buffers_;
+  bool handles_merged_{};
+
+  HandleId RegisterHandle(
+      const std::string& region, const std::string& category,
+      const StatTotal::Type& type) {
+    std::lock_guard<std::mutex> guard(handle_lock_);
+    for (size_t i = 0; i < handle_infos_.size(); ++i) {
+      const HandleInfo& info = handle_infos_[i];
+      if (info.region == region && info.category == category &&
+          info.type == type) {
+        return static_cast<HandleId>(i);
+      }
+    }
+    KATANA_LOG_VASSERT(
+        handle_infos_.size() < kMaxHandles,
+        "too many registered stat handles: {}", kMaxHandles);
+    handle_infos_.push_back(HandleInfo{region, category, type});
+    return static_cast<HandleId>(handle_infos_.size() - 1);
+  }
+
+  void MergeHandles() {
+    if (handles_merged_) {
+      return;
+    }
+
+    for (unsigned t = 0; t < handle_buffers_.size(); ++t) {
+      const auto& buffer = *handle_buffers_.getRemote(t);
+      for (size_t h = 0; h < handle_infos_.size(); ++h) {
+        if (!buffer[h].touched) {
+          continue;
+        }
+        const HandleInfo& info = handle_infos_[h];
+        int_stats_.result_.addToStat(
+            gstl::makeStr(info.region), gstl::makeStr(info.category),
+            buffer[h].val, info.type);
+      }
+    }
+
+    handles_merged_ = true;
+  }
 };
 
 katana::StatManager::StatManager() { impl_ = std::make_unique<Impl>(); }
@@ -200,6 +263,7 @@ katana::StatManager::MergeStats() {
   impl_->int_stats_.Merge();
   impl_->fp_stats_.Merge();
   impl_->str_stats_.Merge();
+  impl_->MergeHandles();
 }
 
 void
@@ -246,6 +310,43 @@ katana::StatManager::AddParam(
       gstl::makeStr(region), gstl::makeStr(category), val, StatTotal::SINGLE);
 }
 
+katana::StatManager::HandleId
+katana::StatManager::RegisterHandle(
+    const std::string& region, const std::string& category,
+    const StatTotal::Type& type) {
+  return impl_->RegisterHandle(region, category, type);
+}
+
+void
+katana::StatManager::AddToHandle(HandleId handle, int64_t val) {
+  KATANA_LOG_DEBUG_ASSERT(handle < kMaxHandles);
+  HandleSlot& slot = (*impl_->handle_buffers_.getLocal())[handle];
+  slot.val += val;
+  slot.touched = true;
+}
+
+katana::StatHandle::StatHandle(
+    std::string region, std::string category, const StatTotal::Type& type)
+    : region_(std::move(region)),
+      category_(std::move(category)),
+      type_(type),
+      id_(StatManager::kInvalidHandle) {
+  if (StatManager* sm = internal::sysStatManager(); sm != nullptr) {
+    id_ = sm->RegisterHandle(region_, category_, type_);
+  }
+}
+
+void
+katana::StatHandle::Add(int64_t val) const {
+  StatManager* sm = internal::sysStatManager();
+  if (id_ != StatManager::kInvalidHandle && sm != nullptr) {
+    sm->AddToHandle(id_, val);
+    return;
+  }
+  // Not registered (or the manager is gone); ReportStat handles both.
+  ReportStat(region_, category_, val, type_);
+}
+
 void
 katana::StatManager::Print() {
   if (impl_->outfile_.empty()) {
@@ -38,10 +38,28 @@ using katana::ThreadPool;
 
 thread_local ThreadPool::per_signal ThreadPool::my_box;
 
+namespace {
+
+// ~1k pauses covers the typical gap between back-to-back do_all calls
+// without noticeably delaying the drop to idle for long-running regions.
+constexpr unsigned kDefaultWakeupSpin = 1024;
+
+unsigned
+GetWakeupSpin() {
+  int spin = 0;
+  if (katana::GetEnv("KATANA_WAKEUP_SPIN", &spin) && spin >= 0) {
+    return static_cast<unsigned>(spin);
+  }
+  return kDefaultWakeupSpin;
+}
+
+}  // namespace
+
 ThreadPool::ThreadPool()
     : mi(getHWTopo().machineTopoInfo),
       reserved(0),
       masterFastmode(0),
+      wakeupSpin(GetWakeupSpin()),
       running(false) {
   signals.resize(mi.maxThreads);
   initThread(0);
@@ -158,7 +176,7 @@ ThreadPool::threadLoop(unsigned tid) {
   bool fastmode = false;
   auto& me = my_box;
   do {
-    me.wait(fastmode);
+    me.wait(fastmode, wakeupSpin);
     cascade(fastmode);
     try {
       work();
@@ -279,6 +297,55 @@ ThreadPool::runDedicated(std::function<void(void)>& f) {
   work = nullptr;
 }
 
+void
+ThreadPool::restrictToCores(const std::vector<int>& os_cpus) {
+  KATANA_LOG_VASSERT(
+      !running, "Can't change thread affinity during parallel section");
+  if (os_cpus.empty()) {
+    resetCoreRestriction();
+    return;
+  }
+  if (GetEnv("KATANA_DO_NOT_BIND_THREADS")) {
+    return;
+  }
+  std::vector<int> cpus = os_cpus;
+  std::sort(cpus.begin(), cpus.end());
+  run(getMaxUsableThreads(), [&cpus]() {
+    const auto& topo = my_box.topo;
+    // The master thread is never pinned to a single core; give it (and any
+    // worker whose home core left the set) the run of the whole set.
+    if (topo.tid != 0 &&
+        std::binary_search(
+            cpus.begin(), cpus.end(), static_cast<int>(topo.osContext))) {
+      bindThreadSelf(topo.osContext);
+    } else {
+      bindThreadToCPUSet(cpus);
+    }
+  });
+}
+
+void
+ThreadPool::resetCoreRestriction() {
+  KATANA_LOG_VASSERT(
+      !running, "Can't change thread affinity during parallel section");
+  if (GetEnv("KATANA_DO_NOT_BIND_THREADS")) {
+    return;
+  }
+  std::vector<int> all_cpus;
+  for (const auto& t : getHWTopo().threadTopoInfo) {
+    all_cpus.push_back(static_cast<int>(t.osContext));
+  }
+  const bool bind_main = GetEnv("KATANA_BIND_MAIN_THREAD");
+  run(getMaxUsableThreads(), [&all_cpus, bind_main]() {
+    const auto& topo = my_box.topo;
+    if (topo.tid != 0 || bind_main) {
+      bindThreadSelf(topo.osContext);
+    } else {
+      bindThreadToCPUSet(all_cpus);
+    }
+  });
+}
+
 static katana::ThreadPool* TPOOL = nullptr;
 
 void
@@ -19,10 +19,34 @@
 
 #include "katana/Timer.h"
 
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+
 #include "katana/Statistics.h"
 
 using namespace katana;
 
+namespace {
+
+// Exclusive time per collapsed path, merged across all threads. Guarded
+// by a mutex; timers are created and destroyed at phase granularity, so
+// contention is not a concern.
+std::mutex collapsed_lock;
+std::map<std::string, uint64_t>&
+CollapsedTimes() {
+  static std::map<std::string, uint64_t> times;
+  return times;
+}
+
+// Innermost active ScopedStatTimer on this thread; parent of the next
+// one created here.
+thread_local ScopedStatTimer* active_scoped_timer = nullptr;
+
+}  // namespace
+
 void
 Timer::start() {
   startT = clockTy::now();
@@ -117,3 +141,55 @@ uint64_t
 StatTimer::get_usec() const {
   return TimeAccumulator::get_usec();
 }
+
+ScopedStatTimer::ScopedStatTimer(const char* name, const char* region)
+    : parent_(active_scoped_timer) {
+  const char* n = name ? name : "Time";
+
+  if (region) {
+    region_ = gstl::makeStr(region);
+  } else if (parent_) {
+    region_ = parent_->region_;
+  } else {
+    region_ = gstl::makeStr("(NULL)");
+  }
+
+  if (parent_) {
+    path_ = parent_->path_ + ";" + n;
+  } else {
+    path_ = region_ + ";" + n;
+  }
+
+  active_scoped_timer = this;
+  timer_.start();
+}
+
+ScopedStatTimer::~ScopedStatTimer() {
+  timer_.stop();
+  active_scoped_timer = parent_;
+
+  uint64_t elapsed = timer_.get_usec();
+  if (parent_) {
+    parent_->children_usec_ += elapsed;
+  }
+  uint64_t self = elapsed - std::min(children_usec_, elapsed);
+
+  {
+    std::lock_guard<std::mutex> guard(collapsed_lock);
+    CollapsedTimes()[std::string(path_.c_str())] += self;
+  }
+
+  // The full path as the category keeps same-named nested phases from
+  // colliding; inclusive milliseconds to match StatTimer's unit.
+  if (elapsed / 1000) {
+    katana::ReportStatMax(region_.c_str(), path_.c_str(), elapsed / 1000);
+  }
+}
+
+void
+katana::PrintCollapsedTimers(std::ostream& out) {
+  std::lock_guard<std::mutex> guard(collapsed_lock);
+  for (const auto& [path, usec] : CollapsedTimes()) {
+    out << path << " " << usec << "\n";
+  }
+}
@@ -0,0 +1,42 @@
+#include <atomic>
+#include <vector>
+
+#include "katana/Galois.h"
+#include "katana/HWTopo.h"
+#include "katana/Logging.h"
+
+namespace {
+
+// The pool must stay fully functional across re-pinning.
+void
+RunLoop() {
+  std::atomic<int> count(0);
+  katana::do_all(katana::iterate(0, 1000), [&](int) { count += 1; });
+  KATANA_LOG_ASSERT(count == 1000);
+}
+
+}  // namespace
+
+int
+main() {
+  katana::GaloisRuntime Katana_runtime;
+  katana::setActiveThreads(katana::GetThreadPool().getMaxUsableThreads());
+
+  auto topo = katana::getHWTopo();
+  std::vector<int> half;
+  for (size_t i = 0; i < topo.threadTopoInfo.size(); i += 2) {
+    half.push_back(static_cast<int>(topo.threadTopoInfo[i].osContext));
+  }
+
+  auto& pool = katana::GetThreadPool();
+  pool.restrictToCores(half);
+  RunLoop();
+
+  // An empty set is a reset; both paths restore the original binding.
+  pool.restrictToCores({});
+  RunLoop();
+  pool.resetCoreRestriction();
+  RunLoop();
+
+  return 0;
+}
@@ -0,0 +1,94 @@
+#include "katana/ConcurrentHashMap.h"
+
+#include <vector>
+
+#include "katana/Galois.h"
+#include "katana/Loops.h"
+#include "katana/Reduction.h"
+
+namespace {
+
+constexpr size_t kNumKeys = 10000;
+constexpr size_t kInsertsPerKey = 8;
+
+void
+TestSerial() {
+  katana::ConcurrentHashMap<uint64_t, uint64_t> map(16);
+
+  KATANA_LOG_ASSERT(map.empty());
+  KATANA_LOG_ASSERT(map.Insert(1, 10));
+  KATANA_LOG_ASSERT(!map.Insert(1, 11));
+  KATANA_LOG_ASSERT(map.Contains(1));
+  KATANA_LOG_ASSERT(!map.Contains(2));
+
+  auto found = map.Find(1);
+  KATANA_LOG_ASSERT(found && *found == 10);
+  KATANA_LOG_ASSERT(!map.Find(2));
+
+  map.Upsert(1, 1, [](uint64_t& v) { v += 1; });
+  found = map.Find(1);
+  KATANA_LOG_ASSERT(found && *found == 11);
+  KATANA_LOG_ASSERT(map.size() == 1);
+
+  map.Clear();
+  KATANA_LOG_ASSERT(map.empty());
+  KATANA_LOG_ASSERT(!map.Contains(1));
+}
+
+void
+TestConcurrentInsert() {
+  // Start deliberately undersized so inserts exercise growth.
+  katana::ConcurrentHashMap<uint64_t, uint64_t> map(16);
+
+  katana::GAccumulator<size_t> num_inserted;
+  katana::do_all(
+      katana::iterate(size_t{0}, kNumKeys * kInsertsPerKey), [&](size_t i) {
+        if (map.Insert(i % kNumKeys, i % kNumKeys + 1)) {
+          num_inserted += 1;
+        }
+      });
+
+  KATANA_LOG_ASSERT(num_inserted.reduce() == kNumKeys);
+  KATANA_LOG_ASSERT(map.size() == kNumKeys);
+  for (size_t k = 0; k < kNumKeys; ++k) {
+    auto found = map.Find(k);
+    KATANA_LOG_ASSERT(found && *found == k + 1);
+  }
+
+  size_t num_visited = 0;
+  map.ForEach([&](uint64_t key, uint64_t value) {
+    KATANA_LOG_ASSERT(value == key + 1);
+    ++num_visited;
+  });
+  KATANA_LOG_ASSERT(num_visited == kNumKeys);
+}
+
+void
+TestConcurrentUpsert() {
+  katana::ConcurrentHashMap<uint64_t, uint64_t> map(kNumKeys);
+
+  katana::do_all(
+      katana::iterate(size_t{0}, kNumKeys * kInsertsPerKey), [&](size_t i) {
+        map.Upsert(i % kNumKeys, 1, [](uint64_t& v) { v += 1; });
+      });
+
+  KATANA_LOG_ASSERT(map.size() == kNumKeys);
+  for (size_t k = 0; k < kNumKeys; ++k) {
+    auto found = map.Find(k);
+    KATANA_LOG_ASSERT(found && *found == kInsertsPerKey);
+  }
+}
+
+}  // namespace
+
+int
+main() {
+  katana::GaloisRuntime Katana_runtime;
+  katana::setActiveThreads(4);
+
+  TestSerial();
+  TestConcurrentInsert();
+  TestConcurrentUpsert();
+
+  return 0;
+}
@@ -0,0 +1,58 @@
+#include <atomic>
+#include <vector>
+
+#include "katana/Galois.h"
+#include "katana/Logging.h"
+#include "katana/NUMAArray.h"
+
+namespace {
+
+constexpr size_t kSize = 1000 * 1000 + 37;
+
+// An elementwise rank-decay update written the way do_all_vectorized is
+// meant to be used: raw restrict-qualified pointers and a counted loop.
+void
+Decay(katana::NUMAArray<double>& ranks, double factor) {
+  katana::do_all_vectorized(
+      ranks.size(),
+      [&](size_t begin, size_t end) {
+        double* __restrict__ r = katana::AssumeAligned(&ranks[0]);
+        for (size_t i = begin; i < end; ++i) {
+          r[i] *= factor;
+        }
+      },
+      katana::loopname("Decay"));
+}
+
+}  // namespace
+
+int
+main() {
+  katana::GaloisRuntime Katana_runtime;
+  katana::setActiveThreads(katana::GetThreadPool().getMaxUsableThreads());
+
+  katana::NUMAArray<double> ranks;
+  ranks.allocateInterleaved(kSize);
+  katana::do_all(katana::iterate(size_t{0}, kSize), [&](size_t i) {
+    ranks[i] = static_cast<double>(i);
+  });
+
+  Decay(ranks, 0.5);
+  for (size_t i = 0; i < kSize; ++i) {
+    KATANA_LOG_ASSERT(ranks[i] == static_cast<double>(i) * 0.5);
+  }
+
+  // Every index is covered exactly once even when blocks are rounded to
+  // the alignment quantum.
+  std::vector<std::atomic<uint8_t>> visits(kSize);
+  katana::do_all_vectorized(kSize, [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      visits[i] += 1;
+    }
+  });
+  for (size_t i = 0; i < kSize; ++i) {
+    KATANA_LOG_ASSERT(visits[i] == 1);
+  }
+
+  return 0;
+}
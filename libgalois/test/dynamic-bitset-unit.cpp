@@ -1,4 +1,6 @@
 #include "katana/DynamicBitset.h"
+#include "katana/PODVector.h"
+#include "katana/ParallelSTL.h"
 #include "katana/Result.h"
 
 namespace {
@@ -133,7 +135,170 @@ const Invariant NotValues =
   return katana::ResultSuccess();
 };
 
-const std::vector<Invariant> invariants = {NotAndCount, NotValues};
+const Invariant SetBitsIteration =
+    [](katana::DynamicBitset* test) -> katana::Result<void> {
+  size_t visited = 0;
+  size_t previous_bit = 0;
+  for (uint64_t bit : test->SetBits()) {
+    if (!test->test(bit)) {
+      return KATANA_ERROR(
+          katana::ErrorCode::AssertionFailed,
+          "set bit iterator visited bit {} which is not set", bit);
+    }
+    if (visited > 0 && bit <= previous_bit) {
+      return KATANA_ERROR(
+          katana::ErrorCode::AssertionFailed,
+          "set bit iterator visited bit {} out of order after bit {}", bit,
+          previous_bit);
+    }
+    previous_bit = bit;
+    ++visited;
+  }
+
+  if (visited != test->count()) {
+    return KATANA_ERROR(
+        katana::ErrorCode::AssertionFailed,
+        "set bit iterator visited {} bits but count() is {}", visited,
+        test->count());
+  }
+
+  return katana::ResultSuccess();
+};
+
+const Invariant RangedCount =
+    [](katana::DynamicBitset* test) -> katana::Result<void> {
+  size_t size = test->size();
+  const std::vector<std::pair<size_t, size_t>> ranges = {
+      {0, size}, {0, size / 2}, {size / 2, size}, {1, size}, {3, 67}};
+
+  for (auto [begin, end] : ranges) {
+    if (end > size) {
+      continue;
+    }
+    size_t expected = 0;
+    for (size_t i = begin; i < end; ++i) {
+      if (test->test(i)) {
+        ++expected;
+      }
+    }
+    if (test->count(begin, end) != expected) {
+      return KATANA_ERROR(
+          katana::ErrorCode::AssertionFailed,
+          "count({}, {}) returned {} but {} bits are set in the range", begin,
+          end, test->count(begin, end), expected);
+    }
+    if (test->SerialCount(begin, end) != expected) {
+      return KATANA_ERROR(
+          katana::ErrorCode::AssertionFailed,
+          "SerialCount({}, {}) returned {} but {} bits are set in the range",
+          begin, end, test->SerialCount(begin, end), expected);
+    }
+  }
+
+  return katana::ResultSuccess();
+};
+
+const Invariant AndNotValues =
+    [](katana::DynamicBitset* test) -> katana::Result<void> {
+  katana::DynamicBitset mask;
+  mask.resize(test->size());
+  mask.reset();
+  for (size_t i = 0, size = test->size(); i < size; i += 2) {
+    mask.set(i);
+  }
+
+  katana::DynamicBitset result;
+  result.resize(test->size());
+  result.bitwise_andnot(*test, mask);
+
+  for (size_t i = 0, size = test->size(); i < size; ++i) {
+    bool expected = test->test(i) && !mask.test(i);
+    if (result.test(i) != expected) {
+      return KATANA_ERROR(
+          katana::ErrorCode::AssertionFailed,
+          "bitwise_andnot produced wrong value at bit {} - original: {}, "
+          "mask: {}, result: {}",
+          i, test->test(i), mask.test(i), result.test(i));
+    }
+  }
+
+  katana::DynamicBitset in_place;
+  in_place.resize(test->size());
+  in_place.reset();
+  for (size_t i = 0, size = test->size(); i < size; ++i) {
+    if (test->test(i)) {
+      in_place.set(i);
+    }
+  }
+  in_place.bitwise_andnot(mask);
+
+  if (in_place != result) {
+    return KATANA_ERROR(
+        katana::ErrorCode::AssertionFailed,
+        "in-place bitwise_andnot disagrees with the 2-operand form");
+  }
+
+  return katana::ResultSuccess();
+};
+
+const Invariant CompactSetBits =
+    [](katana::DynamicBitset* test) -> katana::Result<void> {
+  std::vector<uint32_t> expected;
+  for (size_t i = 0, size = test->size(); i < size; ++i) {
+    if (test->test(i)) {
+      expected.push_back(i);
+    }
+  }
+
+  katana::PODVector<uint32_t> compacted;
+  katana::ParallelSTL::copy_set_bits(*test, &compacted);
+
+  if (compacted.size() != expected.size()) {
+    return KATANA_ERROR(
+        katana::ErrorCode::AssertionFailed,
+        "copy_set_bits emitted {} indices but {} bits are set",
+        compacted.size(), expected.size());
+  }
+  for (size_t i = 0; i < expected.size(); ++i) {
+    if (compacted[i] != expected[i]) {
+      return KATANA_ERROR(
+          katana::ErrorCode::AssertionFailed,
+          "copy_set_bits emitted {} at position {}, expected {}", compacted[i],
+          i, expected[i]);
+    }
+  }
+
+  // A second call appends after the existing indices.
+  katana::ParallelSTL::copy_set_bits(*test, &compacted);
+  if (compacted.size() != 2 * expected.size()) {
+    return KATANA_ERROR(
+        katana::ErrorCode::AssertionFailed,
+        "copy_set_bits did not append - size is {}, expected {}",
+        compacted.size(), 2 * expected.size());
+  }
+  for (size_t i = 0; i < expected.size(); ++i) {
+    if (compacted[expected.size() + i] != expected[i]) {
+      return KATANA_ERROR(
+          katana::ErrorCode::AssertionFailed,
+          "appended copy_set_bits emitted {} at position {}, expected {}",
+          compacted[expected.size() + i], i, expected[i]);
+    }
+  }
+
+  // GetOffsets is the same compaction routed through std::vector.
+  std::vector<uint32_t> offsets = test->GetOffsets<uint32_t>();
+  if (offsets != expected) {
+    return KATANA_ERROR(
+        katana::ErrorCode::AssertionFailed,
+        "GetOffsets disagrees with the serial reference");
+  }
+
+  return katana::ResultSuccess();
+};
+
+const std::vector<Invariant> invariants = {
+    NotAndCount, NotValues,    SetBitsIteration,
+    RangedCount, AndNotValues, CompactSetBits};
 
 katana::Result<void>
 TestAll() {
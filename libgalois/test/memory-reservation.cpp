@@ -0,0 +1,75 @@
+#include "katana/MemoryReservation.h"
+
+#include <cstdlib>
+
+#include "katana/Galois.h"
+#include "katana/Logging.h"
+#include "katana/NUMAArray.h"
+
+namespace {
+
+constexpr uint64_t kBudget = 64ULL << 20;
+
+void
+TestTryMakeRespectsBudget() {
+  auto first = katana::MemoryReservation::TryMake("first", kBudget / 2);
+  KATANA_LOG_ASSERT(first);
+
+  // The remaining half does not fit together with another half-plus-one.
+  auto too_big = katana::MemoryReservation::TryMake("too-big", kBudget / 2 + 1);
+  KATANA_LOG_ASSERT(!too_big);
+
+  auto second = katana::MemoryReservation::TryMake("second", kBudget / 2);
+  KATANA_LOG_ASSERT(second);
+
+  // Releasing a grant makes room again.
+  first->reset();
+  auto third = katana::MemoryReservation::TryMake("third", kBudget / 2);
+  KATANA_LOG_ASSERT(third);
+}
+
+void
+TestBlockingAdmission() {
+  // With the budget free, the blocking constructor admits immediately.
+  katana::MemoryReservation reservation("blocking", kBudget / 4);
+  KATANA_LOG_ASSERT(reservation.estimated_bytes() == kBudget / 4);
+  KATANA_LOG_ASSERT(reservation.charged_bytes() == 0);
+}
+
+void
+TestNUMAArrayDrawsAgainstScope() {
+  katana::MemoryReservation reservation("scoped", 1ULL << 20);
+
+  katana::NUMAArray<uint64_t> outside;
+  outside.allocateInterleaved(100);
+  KATANA_LOG_ASSERT(reservation.charged_bytes() == 0);
+
+  {
+    katana::MemoryReservation::Scope scope(&reservation);
+    katana::NUMAArray<uint64_t> inside;
+    inside.allocateInterleaved(100);
+    KATANA_LOG_ASSERT(reservation.charged_bytes() == 100 * sizeof(uint64_t));
+
+    // The charge follows the array through a move, not the thread.
+    katana::NUMAArray<uint64_t> moved = std::move(inside);
+    KATANA_LOG_ASSERT(reservation.charged_bytes() == 100 * sizeof(uint64_t));
+  }
+  // Destruction outside the scope still credits the owning reservation.
+  KATANA_LOG_ASSERT(reservation.charged_bytes() == 0);
+}
+
+}  // namespace
+
+int
+main() {
+  // Pin the budget before the first reservation initializes the controller.
+  setenv("KATANA_ADMISSION_BUDGET_BYTES", std::to_string(kBudget).c_str(), 1);
+
+  katana::GaloisRuntime Katana_runtime;
+
+  TestTryMakeRespectsBudget();
+  TestBlockingAdmission();
+  TestNUMAArrayDrawsAgainstScope();
+
+  return 0;
+}
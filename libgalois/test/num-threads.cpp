@@ -0,0 +1,75 @@
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+#include "katana/Galois.h"
+#include "katana/Logging.h"
+#include "katana/Threads.h"
+
+namespace {
+
+constexpr unsigned kMaxTids = 1024;
+
+// Run a loop and report how many distinct thread ids executed iterations.
+unsigned
+CountParticipants(unsigned num_threads) {
+  std::vector<std::atomic<bool>> seen(kMaxTids);
+  katana::do_all(
+      katana::iterate(0, 100000),
+      [&](int) { seen[katana::ThreadPool::getTID()] = true; },
+      katana::num_threads(num_threads), katana::steal());
+  unsigned participants = 0;
+  for (const auto& s : seen) {
+    participants += s ? 1 : 0;
+  }
+  return participants;
+}
+
+}  // namespace
+
+int
+main() {
+  katana::GaloisRuntime Katana_runtime;
+
+  unsigned max_usable = katana::GetThreadPool().getMaxUsableThreads();
+  katana::setActiveThreads(max_usable);
+
+  // A narrow loop uses only the requested threads.
+  KATANA_LOG_ASSERT(CountParticipants(1) == 1);
+  unsigned narrow = std::min(2U, max_usable);
+  KATANA_LOG_ASSERT(CountParticipants(narrow) <= narrow);
+
+  // Requests beyond the pool are clamped, and 0 means one thread.
+  KATANA_LOG_ASSERT(CountParticipants(kMaxTids * 2) <= max_usable);
+  KATANA_LOG_ASSERT(CountParticipants(0) == 1);
+
+  // performance_cores clamps to the performance-class prefix of the pool;
+  // on homogeneous machines that is every thread.
+  unsigned max_perf = katana::GetThreadPool().getMaxPerformanceThreads();
+  KATANA_LOG_ASSERT(max_perf >= 1 && max_perf <= max_usable);
+  {
+    std::vector<std::atomic<bool>> seen(kMaxTids);
+    katana::do_all(
+        katana::iterate(0, 100000),
+        [&](int) { seen[katana::ThreadPool::getTID()] = true; },
+        katana::performance_cores());
+    for (unsigned tid = max_perf; tid < kMaxTids; ++tid) {
+      KATANA_LOG_ASSERT(!seen[tid]);
+    }
+  }
+
+  // The override is scoped to the invocation: the global setting is intact
+  // afterwards and an unannotated loop still sees all active threads.
+  KATANA_LOG_ASSERT(katana::getActiveThreads() == max_usable);
+  std::vector<std::atomic<bool>> seen(kMaxTids);
+  katana::do_all(katana::iterate(0, 100000), [&](int) {
+    seen[katana::ThreadPool::getTID()] = true;
+  });
+  unsigned participants = 0;
+  for (const auto& s : seen) {
+    participants += s ? 1 : 0;
+  }
+  KATANA_LOG_ASSERT(participants >= 1 && participants <= max_usable);
+
+  return 0;
+}
@@ -0,0 +1,48 @@
+#include <cstdio>
+#include <sstream>
+
+#include "katana/Env.h"
+#include "katana/Executor_ParaMeter.h"
+#include "katana/Galois.h"
+#include "katana/Logging.h"
+#include "katana/Reduction.h"
+#include "katana/Traits.h"
+
+int
+main() {
+  katana::SetEnv("KATANA_PARAMETER_OUTFILE", "parameter-test.csv", true);
+  katana::GaloisRuntime sys;
+
+  constexpr long kSize = 1024;
+  katana::GAccumulator<long> processed;
+
+  // An amorphous loop: each item enables its successor, so the critical
+  // path has one step per generation.
+  katana::for_each_ParaMeter(
+      katana::iterate(0L, 1L),
+      [&](long item, auto& ctx) {
+        processed += 1;
+        if (item + 1 < 8) {
+          ctx.push(item + 1);
+        }
+      },
+      std::make_tuple(
+          katana::loopname("chain"), katana::disable_conflict_detection()));
+  KATANA_LOG_ASSERT(processed.reduce() == 8);
+
+  processed.reset();
+  katana::do_all_ParaMeter(
+      katana::iterate(0L, kSize), [&](long) { processed += 1; },
+      std::make_tuple(katana::loopname("bulk")));
+  KATANA_LOG_ASSERT(processed.reduce() == kSize);
+
+  std::ostringstream out;
+  katana::parameter::WriteStatsJson(out);
+  std::string json = out.str();
+  KATANA_LOG_ASSERT(json.find("\"chain\"") != std::string::npos);
+  KATANA_LOG_ASSERT(json.find("\"bulk\"") != std::string::npos);
+  KATANA_LOG_ASSERT(json.find("critical_path_steps") != std::string::npos);
+
+  std::remove("parameter-test.csv");
+  return 0;
+}
@@ -0,0 +1,153 @@
+#include <benchmark/benchmark.h>
+
+#include "katana/Bag.h"
+#include "katana/Barrier.h"
+#include "katana/Chunk.h"
+#include "katana/Galois.h"
+#include "katana/Logging.h"
+#include "katana/Obim.h"
+#include "katana/PerThreadStorage.h"
+#include "katana/Range.h"
+#include "katana/Reduction.h"
+#include "katana/ThreadPool.h"
+#include "katana/Threads.h"
+#include "katana/Traits.h"
+
+// Microbenchmarks for the runtime primitives everything else is built
+// on: do_all scaling, OBIM throughput, InsertBag push rates, barrier
+// latency and PerThreadStorage access cost. Run with
+// --benchmark_out=... to capture a machine profile (the benchmark
+// context records the CPU; main() adds the thread/socket topology) for
+// comparing hardware generations before migrating workloads.
+
+namespace {
+
+void
+ThreadCounts(benchmark::internal::Benchmark* b) {
+  unsigned max_threads = katana::GetThreadPool().getMaxThreads();
+  for (unsigned t = 1; t <= max_threads; t *= 2) {
+    b->Args({static_cast<long>(t)});
+  }
+  if ((max_threads & (max_threads - 1)) != 0) {
+    b->Args({static_cast<long>(max_threads)});
+  }
+}
+
+void
+DoAllScaling(benchmark::State& state) {
+  constexpr long kSize = 1 << 20;
+  katana::setActiveThreads(state.range(0));
+
+  std::vector<int> output(kSize);
+  for (auto _ : state) {
+    katana::do_all(
+        katana::iterate(0L, kSize), [&](long i) { output[i] += i; },
+        katana::no_stats());
+  }
+
+  state.SetItemsProcessed(state.iterations() * kSize);
+}
+
+void
+InsertBagPush(benchmark::State& state) {
+  constexpr long kSize = 1 << 20;
+  katana::setActiveThreads(state.range(0));
+
+  for (auto _ : state) {
+    katana::InsertBag<long> bag;
+    katana::do_all(
+        katana::iterate(0L, kSize), [&](long i) { bag.push(i); },
+        katana::no_stats());
+    benchmark::DoNotOptimize(bag.begin());
+  }
+
+  state.SetItemsProcessed(state.iterations() * kSize);
+}
+
+void
+ObimThroughput(benchmark::State& state) {
+  constexpr long kSize = 1 << 18;
+  constexpr long kBuckets = 64;
+  katana::setActiveThreads(state.range(0));
+
+  auto indexer = [](long item) { return item % kBuckets; };
+  using PSchunk = katana::PerSocketChunkFIFO<16>;
+  using OBIM = katana::OrderedByIntegerMetric<decltype(indexer), PSchunk>;
+
+  katana::GAccumulator<long> processed;
+  for (auto _ : state) {
+    processed.reset();
+    katana::for_each(
+        katana::iterate(0L, kSize),
+        [&](long, auto&) { processed += 1; }, katana::wl<OBIM>(indexer),
+        katana::disable_conflict_detection(), katana::no_pushes(),
+        katana::no_stats());
+  }
+
+  KATANA_LOG_ASSERT(processed.reduce() == kSize);
+  state.SetItemsProcessed(state.iterations() * kSize);
+}
+
+void
+BarrierLatency(benchmark::State& state) {
+  constexpr long kWaitsPerIteration = 64;
+  unsigned num_threads = state.range(0);
+  katana::setActiveThreads(num_threads);
+  auto& barrier = katana::GetBarrier(num_threads);
+
+  for (auto _ : state) {
+    katana::on_each([&](unsigned, unsigned) {
+      for (long i = 0; i < kWaitsPerIteration; ++i) {
+        barrier.Wait();
+      }
+    });
+  }
+
+  state.SetItemsProcessed(state.iterations() * kWaitsPerIteration);
+}
+
+void
+PerThreadStorageAccess(benchmark::State& state) {
+  constexpr long kAccesses = 1 << 16;
+  katana::setActiveThreads(state.range(0));
+  katana::PerThreadStorage<long> counters;
+
+  for (auto _ : state) {
+    katana::on_each([&](unsigned, unsigned) {
+      for (long i = 0; i < kAccesses; ++i) {
+        *counters.getLocal() += 1;
+      }
+    });
+  }
+
+  long total = 0;
+  for (unsigned i = 0; i < counters.size(); ++i) {
+    total += *counters.getRemote(i);
+  }
+  benchmark::DoNotOptimize(total);
+  state.SetItemsProcessed(state.iterations() * kAccesses * state.range(0));
+}
+
+BENCHMARK(DoAllScaling)->Apply(ThreadCounts)->UseRealTime();
+BENCHMARK(InsertBagPush)->Apply(ThreadCounts)->UseRealTime();
+BENCHMARK(ObimThroughput)->Apply(ThreadCounts)->UseRealTime();
+BENCHMARK(BarrierLatency)->Apply(ThreadCounts)->UseRealTime();
+BENCHMARK(PerThreadStorageAccess)->Apply(ThreadCounts)->UseRealTime();
+
+}  // namespace
+
+int
+main(int argc, char** argv) {
+  ::benchmark::Initialize(&argc, argv);
+  katana::GaloisRuntime G;
+
+  auto& tp = katana::GetThreadPool();
+  ::benchmark::AddCustomContext(
+      "katana_max_threads", std::to_string(tp.getMaxThreads()));
+  ::benchmark::AddCustomContext(
+      "katana_max_cores", std::to_string(tp.getMaxCores()));
+  ::benchmark::AddCustomContext(
+      "katana_max_sockets", std::to_string(tp.getMaxSockets()));
+
+  ::benchmark::RunSpecifiedBenchmarks();
+}
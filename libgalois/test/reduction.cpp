@@ -86,6 +86,21 @@ test_accum() {
   KATANA_LOG_ASSERT(accum.reduce() == num);
 }
 
+void
+test_tree() {
+  katana::GAccumulator<int> accum;
+
+  constexpr int num = 123456;
+
+  katana::do_all(katana::iterate(0, num), [&](int) { accum += 1; });
+
+  // peek and a stride-1 estimate read the slots without consuming them.
+  KATANA_LOG_ASSERT(accum.peek() == num);
+  KATANA_LOG_ASSERT(accum.estimate(1) == num);
+
+  KATANA_LOG_ASSERT(accum.reduceTree() == num);
+}
+
 int
 main() {
   katana::GaloisRuntime sys;
@@ -99,6 +114,7 @@ main() {
   test_move();
   test_max();
   test_accum();
+  test_tree();
 
   return 0;
 }
@@ -0,0 +1,59 @@
+#include "katana/ScheduleReplay.h"
+
+#include <cstdio>
+
+#include "katana/Galois.h"
+#include "katana/Logging.h"
+#include "katana/Reduction.h"
+#include "katana/Simple.h"
+#include "katana/Traits.h"
+
+static constexpr long kSize = 10000;
+static constexpr long kExtraPushes = 16;
+
+int
+main() {
+  katana::GaloisRuntime sys;
+
+  katana::ScheduleTrace<long> trace;
+  katana::GAccumulator<long> recorded_sum;
+
+  katana::for_each(
+      katana::iterate(0L, kSize),
+      [&](long item, auto& ctx) {
+        recorded_sum += item;
+        if (item < kExtraPushes) {
+          ctx.push(item + kSize);
+        }
+      },
+      katana::wl<katana::Recording<katana::FIFO<long>, long>>(&trace),
+      katana::disable_conflict_detection(), katana::no_stats());
+
+  KATANA_LOG_ASSERT(trace.NumPops() == kSize + kExtraPushes);
+
+  // Round-trip the trace through a file.
+  std::string path = "schedule-replay-trace.bin";
+  KATANA_LOG_ASSERT(trace.Save(path));
+  katana::ScheduleTrace<long> loaded;
+  KATANA_LOG_ASSERT(loaded.Load(path));
+  std::remove(path.c_str());
+  KATANA_LOG_ASSERT(loaded.NumPops() == trace.NumPops());
+
+  katana::GAccumulator<long> replayed_sum;
+  katana::GAccumulator<long> replayed_count;
+
+  katana::for_each(
+      katana::iterate(0L, 0L),
+      [&](long item, auto&) {
+        replayed_sum += item;
+        replayed_count += 1;
+      },
+      katana::wl<katana::Replay<long>>(&loaded),
+      katana::disable_conflict_detection(), katana::no_pushes(),
+      katana::no_stats());
+
+  KATANA_LOG_ASSERT(replayed_count.reduce() == kSize + kExtraPushes);
+  KATANA_LOG_ASSERT(replayed_sum.reduce() == recorded_sum.reduce());
+
+  return 0;
+}
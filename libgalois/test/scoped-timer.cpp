@@ -0,0 +1,28 @@
+#include <sstream>
+
+#include "katana/Galois.h"
+#include "katana/Logging.h"
+#include "katana/Timer.h"
+
+int
+main() {
+  katana::GaloisRuntime sys;
+
+  {
+    katana::ScopedStatTimer outer("outer", "test");
+    {
+      katana::ScopedStatTimer inner("inner");
+      katana::Timer t;
+      t.start();
+      t.stop();
+    }
+  }
+
+  std::ostringstream out;
+  katana::PrintCollapsedTimers(out);
+  std::string collapsed = out.str();
+  KATANA_LOG_ASSERT(collapsed.find("test;outer ") != std::string::npos);
+  KATANA_LOG_ASSERT(collapsed.find("test;outer;inner ") != std::string::npos);
+
+  return 0;
+}
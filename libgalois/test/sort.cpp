@@ -164,6 +164,47 @@ do_accumulate() {
   return 0;
 }
 
+int
+do_stable_sort_by_key() {
+  std::cout << "stable_sort_by_key:\n";
+  katana::setActiveThreads(katana::GetThreadPool().getMaxThreads());
+
+  // (key, payload) pairs; payload records the input position so both
+  // sortedness and stability can be checked afterwards.
+  std::vector<std::pair<uint32_t, uint64_t>> V(vectorSize);
+  for (size_t i = 0; i < V.size(); ++i) {
+    V[i] = {static_cast<uint32_t>(RandomNumber() % 1024), i};
+  }
+  std::vector<std::pair<uint32_t, uint64_t>> C = V;
+
+  katana::Timer t;
+  t.start();
+  katana::ParallelSTL::stable_sort_by_key(
+      V.begin(), V.end(), [](const auto& p) { return p.first; });
+  t.stop();
+
+  katana::Timer t2;
+  t2.start();
+  std::stable_sort(C.begin(), C.end(), [](const auto& a, const auto& b) {
+    return a.first < b.first;
+  });
+  t2.stop();
+
+  bool eq = std::equal(C.begin(), C.end(), V.begin());
+  std::cout << "Galois: " << t.get() << " STL: " << t2.get()
+            << " Equal: " << eq << "\n";
+
+  auto bins = katana::ParallelSTL::histogram(
+      V.begin(), V.end(), 1024, [](const auto& p) { return p.first; });
+  size_t total = std::accumulate(bins.begin(), bins.end(), size_t{0});
+  if (total != V.size()) {
+    std::cout << "histogram dropped elements: " << total << "\n";
+    return 1;
+  }
+
+  return eq ? 0 : 1;
+}
+
 int
 main(int argc, char** argv) {
   katana::GaloisRuntime Katana_runtime;
@@ -176,5 +217,6 @@ main(int argc, char** argv) {
   //  ret |= do_sort();
   //  ret |= do_count_if();
   ret |= do_accumulate();
+  ret |= do_stable_sort_by_key();
   return ret;
 }
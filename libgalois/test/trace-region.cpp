@@ -0,0 +1,22 @@
+#include "katana/TraceRegion.h"
+
+#include "katana/Galois.h"
+#include "katana/TextTracer.h"
+
+int
+main() {
+  katana::GaloisRuntime sys;
+  katana::ProgressTracer::Set(katana::TextTracer::Make());
+  auto& tracer = katana::GetTracer();
+
+  auto scope = tracer.StartActiveSpan("trace region test");
+  {
+    katana::TraceRegion region("worker logs");
+    katana::do_all(
+        katana::iterate(0U, katana::getActiveThreads()),
+        [&](unsigned i) { region.Log("worker event", {{"item", i}}); },
+        katana::no_stats());
+  }
+  scope.Close();
+  return 0;
+}
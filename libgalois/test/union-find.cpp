@@ -0,0 +1,66 @@
+#include "katana/UnionFind.h"
+
+#include <utility>
+#include <vector>
+
+#include "katana/Galois.h"
+
+namespace {
+
+constexpr uint32_t kNumNodes = 100000;
+constexpr uint32_t kComponentSize = 100;
+
+void
+TestSerial() {
+  katana::ParallelUnionFind<uint32_t> uf(8);
+
+  KATANA_LOG_ASSERT(uf.size() == 8);
+  KATANA_LOG_ASSERT(uf.NumSets() == 8);
+  KATANA_LOG_ASSERT(!uf.SameSet(0, 1));
+
+  KATANA_LOG_ASSERT(uf.Unite(0, 1));
+  KATANA_LOG_ASSERT(!uf.Unite(0, 1));
+  KATANA_LOG_ASSERT(uf.SameSet(0, 1));
+  KATANA_LOG_ASSERT(uf.NumSets() == 7);
+
+  KATANA_LOG_ASSERT(uf.Unite(1, 2));
+  KATANA_LOG_ASSERT(uf.SameSet(0, 2));
+  KATANA_LOG_ASSERT(!uf.SameSet(0, 3));
+  KATANA_LOG_ASSERT(uf.Find(0) == uf.Find(2));
+}
+
+void
+TestBatch() {
+  // Chain edges partition the ids into kComponentSize-sized components.
+  katana::ParallelUnionFind<uint32_t> uf(kNumNodes);
+
+  std::vector<std::pair<uint32_t, uint32_t>> edges;
+  edges.reserve(kNumNodes);
+  for (uint32_t i = 0; i < kNumNodes; ++i) {
+    if (i % kComponentSize != 0) {
+      edges.emplace_back(i - 1, i);
+    }
+  }
+
+  uf.UniteBatch(edges.begin(), edges.end());
+
+  KATANA_LOG_ASSERT(uf.NumSets() == kNumNodes / kComponentSize);
+  for (uint32_t i = 0; i < kNumNodes; ++i) {
+    KATANA_LOG_ASSERT(
+        uf.Find(i) == uf.Find(i - i % kComponentSize));
+  }
+  KATANA_LOG_ASSERT(!uf.SameSet(0, kComponentSize));
+}
+
+}  // namespace
+
+int
+main() {
+  katana::GaloisRuntime Katana_runtime;
+  katana::setActiveThreads(4);
+
+  TestSerial();
+  TestBatch();
+
+  return 0;
+}
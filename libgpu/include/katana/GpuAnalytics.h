@@ -0,0 +1,25 @@
+#ifndef KATANA_LIBGPU_KATANA_GPUANALYTICS_H_
+#define KATANA_LIBGPU_KATANA_GPUANALYTICS_H_
+
+#include "katana/Result.h"
+#include "katana/config.h"
+
+namespace katana::gpu {
+
+/// Register the CUDA analytics backend with the analytics dispatch layer
+/// (katana::analytics::SetGpuBackend), making plans created with the Gpu()
+/// factories (BfsPlan::Gpu, SsspPlan::Gpu, PagerankPlan::Gpu) run on the
+/// device instead of the CPU.
+///
+/// Call once at startup, after runtime initialization. Fails if no usable
+/// CUDA device is present; in that case nothing is registered and GPU plans
+/// fall back to their CPU algorithms.
+KATANA_EXPORT Result<void> RegisterGpuBackend();
+
+/// Remove the CUDA backend from the dispatch layer. Subsequent GPU plans
+/// fall back to their CPU algorithms.
+KATANA_EXPORT void UnregisterGpuBackend();
+
+}  // namespace katana::gpu
+
+#endif
@@ -0,0 +1,661 @@
+#include "katana/GpuAnalytics.h"
+
+#include <cuda_runtime.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include <arrow/api.h>
+#include <arrow/compute/cast.h>
+
+#include "katana/ErrorCode.h"
+#include "katana/Logging.h"
+#include "katana/PropertyGraph.h"
+#include "katana/Result.h"
+#include "katana/analytics/GpuBackend.h"
+
+namespace {
+
+constexpr uint32_t kInfinity = std::numeric_limits<uint32_t>::max();
+constexpr int kBlockSize = 256;
+
+/// Fraction of free device memory the edge arrays may occupy before we
+/// switch to streaming them through resident windows. The headroom leaves
+/// room for the per-node arrays and the allocator's own slack.
+constexpr double kResidentFraction = 0.8;
+
+/// Edges per streamed window. Two windows are in flight at once, so a
+/// round's kernel for one window overlaps the host-to-device copy of the
+/// next; 64M edges is large enough to amortize launch and copy latency and
+/// small enough to fit twice alongside the node arrays on any device we
+/// target.
+constexpr uint64_t kWindowEdges = 64ull * 1024 * 1024;
+
+katana::Result<void>
+CudaToResult(cudaError_t err, const char* what) {
+  if (err != cudaSuccess) {
+    return KATANA_ERROR(
+        katana::ErrorCode::AssertionFailed, "{}: {}", what,
+        cudaGetErrorString(err));
+  }
+  return katana::ResultSuccess();
+}
+
+#define CUDA_CHECKED(expr) KATANA_CHECKED(CudaToResult((expr), #expr))
+
+/// Owning device allocation, freed on destruction.
+template <typename T>
+class DeviceBuffer {
+public:
+  DeviceBuffer() = default;
+  DeviceBuffer(const DeviceBuffer&) = delete;
+  DeviceBuffer& operator=(const DeviceBuffer&) = delete;
+  ~DeviceBuffer() {
+    if (data_ != nullptr) {
+      cudaFree(data_);
+    }
+  }
+
+  katana::Result<void> Allocate(size_t num_elements) {
+    KATANA_LOG_DEBUG_ASSERT(data_ == nullptr);
+    CUDA_CHECKED(cudaMalloc(&data_, num_elements * sizeof(T)));
+    return katana::ResultSuccess();
+  }
+
+  T* data() { return data_; }
+  const T* data() const { return data_; }
+
+private:
+  T* data_ = nullptr;
+};
+
+/// Pins an existing host range for the lifetime of the object so
+/// cudaMemcpyAsync from it is a true DMA transfer that overlaps kernels.
+class PinnedSpan {
+public:
+  PinnedSpan() = default;
+  PinnedSpan(const PinnedSpan&) = delete;
+  PinnedSpan& operator=(const PinnedSpan&) = delete;
+  ~PinnedSpan() {
+    if (ptr_ != nullptr) {
+      cudaHostUnregister(ptr_);
+    }
+  }
+
+  katana::Result<void> Register(const void* ptr, size_t bytes) {
+    KATANA_LOG_DEBUG_ASSERT(ptr_ == nullptr);
+    // The topology arrays are logically const; cudaHostRegister wants a
+    // mutable pointer but only changes page attributes.
+    void* p = const_cast<void*>(ptr);
+    CUDA_CHECKED(cudaHostRegister(p, bytes, cudaHostRegisterDefault));
+    ptr_ = p;
+    return katana::ResultSuccess();
+  }
+
+private:
+  void* ptr_ = nullptr;
+};
+
+/// CSR topology on the device.
+///
+/// The adjacency index array (one uint64 per node) is always resident. The
+/// destination array — and an optional per-edge data array, used for SSSP
+/// weights — is resident when it fits in device memory; otherwise both are
+/// streamed through two fixed windows on two streams, so while the kernel
+/// for one window runs, the copy engine fills the other. Round-based
+/// kernels see each edge exactly once per sweep either way.
+class GpuCsr {
+public:
+  static katana::Result<std::unique_ptr<GpuCsr>> Make(
+      const katana::GraphTopology& topo, const uint32_t* h_edge_data) {
+    std::unique_ptr<GpuCsr> csr(new GpuCsr());
+    csr->num_nodes_ = topo.NumNodes();
+    csr->num_edges_ = topo.NumEdges();
+    csr->h_adj_ = topo.AdjData();
+    csr->h_dests_ = topo.DestData();
+    csr->h_edge_data_ = h_edge_data;
+    KATANA_CHECKED(csr->Init());
+    return std::unique_ptr<GpuCsr>(std::move(csr));
+  }
+
+  uint32_t num_nodes() const { return num_nodes_; }
+  uint64_t num_edges() const { return num_edges_; }
+  const uint64_t* d_adj() const { return d_adj_.data(); }
+
+  /// Run one sweep over every edge. For each resident window, launch is
+  /// called as launch(stream, node_begin, node_end, edge_begin, edge_end,
+  /// d_dests, d_edge_data) and must enqueue its kernel on the given
+  /// stream; window copies are enqueued on the same stream, so the kernel
+  /// for window i overlaps the copy for window i+1. Returns after every
+  /// launched kernel has finished.
+  template <typename LaunchFn>
+  katana::Result<void> ForEachWindow(LaunchFn&& launch) {
+    if (resident_) {
+      launch(
+          streams_[0], uint32_t{0}, num_nodes_, uint64_t{0}, num_edges_,
+          d_dests_.data(), d_edge_data_.data());
+      CUDA_CHECKED(cudaGetLastError());
+      CUDA_CHECKED(cudaStreamSynchronize(streams_[0]));
+      return katana::ResultSuccess();
+    }
+    for (size_t w = 0; w * kWindowEdges < num_edges_; ++w) {
+      uint64_t edge_begin = w * kWindowEdges;
+      uint64_t edge_end = std::min(edge_begin + kWindowEdges, num_edges_);
+      int buf = w % 2;
+      cudaStream_t stream = streams_[buf];
+      CUDA_CHECKED(cudaMemcpyAsync(
+          d_window_dests_[buf].data(), h_dests_ + edge_begin,
+          (edge_end - edge_begin) * sizeof(uint32_t), cudaMemcpyHostToDevice,
+          stream));
+      if (h_edge_data_ != nullptr) {
+        CUDA_CHECKED(cudaMemcpyAsync(
+            d_window_edge_data_[buf].data(), h_edge_data_ + edge_begin,
+            (edge_end - edge_begin) * sizeof(uint32_t),
+            cudaMemcpyHostToDevice, stream));
+      }
+      launch(
+          stream, WindowNodeBegin(edge_begin), WindowNodeEnd(edge_end),
+          edge_begin, edge_end, d_window_dests_[buf].data(),
+          d_window_edge_data_[buf].data());
+      CUDA_CHECKED(cudaGetLastError());
+    }
+    CUDA_CHECKED(cudaStreamSynchronize(streams_[0]));
+    CUDA_CHECKED(cudaStreamSynchronize(streams_[1]));
+    return katana::ResultSuccess();
+  }
+
+  ~GpuCsr() {
+    for (cudaStream_t s : streams_) {
+      if (s != nullptr) {
+        cudaStreamDestroy(s);
+      }
+    }
+  }
+
+private:
+  GpuCsr() = default;
+
+  katana::Result<void> Init() {
+    for (cudaStream_t& s : streams_) {
+      CUDA_CHECKED(cudaStreamCreate(&s));
+    }
+    KATANA_CHECKED(d_adj_.Allocate(num_nodes_));
+    CUDA_CHECKED(cudaMemcpy(
+        d_adj_.data(), h_adj_, num_nodes_ * sizeof(uint64_t),
+        cudaMemcpyHostToDevice));
+
+    size_t free_bytes = 0;
+    size_t total_bytes = 0;
+    CUDA_CHECKED(cudaMemGetInfo(&free_bytes, &total_bytes));
+    size_t edge_arrays = h_edge_data_ != nullptr ? 2 : 1;
+    size_t edge_bytes = num_edges_ * sizeof(uint32_t) * edge_arrays;
+    resident_ = edge_bytes <=
+                static_cast<size_t>(free_bytes * kResidentFraction);
+
+    if (resident_) {
+      KATANA_CHECKED(d_dests_.Allocate(num_edges_));
+      CUDA_CHECKED(cudaMemcpy(
+          d_dests_.data(), h_dests_, num_edges_ * sizeof(uint32_t),
+          cudaMemcpyHostToDevice));
+      if (h_edge_data_ != nullptr) {
+        KATANA_CHECKED(d_edge_data_.Allocate(num_edges_));
+        CUDA_CHECKED(cudaMemcpy(
+            d_edge_data_.data(), h_edge_data_,
+            num_edges_ * sizeof(uint32_t), cudaMemcpyHostToDevice));
+      }
+      return katana::ResultSuccess();
+    }
+
+    KATANA_LOG_WARN(
+        "edge arrays ({} bytes) do not fit in device memory ({} bytes "
+        "free); streaming edges through {}-edge windows",
+        edge_bytes, free_bytes, kWindowEdges);
+    KATANA_CHECKED(pinned_dests_.Register(
+        h_dests_, num_edges_ * sizeof(uint32_t)));
+    for (DeviceBuffer<uint32_t>& w : d_window_dests_) {
+      KATANA_CHECKED(w.Allocate(kWindowEdges));
+    }
+    if (h_edge_data_ != nullptr) {
+      KATANA_CHECKED(pinned_edge_data_.Register(
+          h_edge_data_, num_edges_ * sizeof(uint32_t)));
+      for (DeviceBuffer<uint32_t>& w : d_window_edge_data_) {
+        KATANA_CHECKED(w.Allocate(kWindowEdges));
+      }
+    }
+    return katana::ResultSuccess();
+  }
+
+  /// First node whose edge range intersects [edge_begin, ...). Entry n of
+  /// the adjacency index array ends node n's range, so this is the first
+  /// node with h_adj_[n] > edge_begin.
+  uint32_t WindowNodeBegin(uint64_t edge_begin) const {
+    return std::upper_bound(h_adj_, h_adj_ + num_nodes_, edge_begin) - h_adj_;
+  }
+
+  /// One past the last node whose edge range intersects [..., edge_end).
+  uint32_t WindowNodeEnd(uint64_t edge_end) const {
+    uint32_t n = std::lower_bound(h_adj_, h_adj_ + num_nodes_, edge_end) -
+                 h_adj_;
+    return std::min(n + 1, num_nodes_);
+  }
+
+  uint32_t num_nodes_{};
+  uint64_t num_edges_{};
+  const uint64_t* h_adj_{};
+  const uint32_t* h_dests_{};
+  const uint32_t* h_edge_data_{};
+
+  bool resident_{};
+  DeviceBuffer<uint64_t> d_adj_;
+  DeviceBuffer<uint32_t> d_dests_;
+  DeviceBuffer<uint32_t> d_edge_data_;
+  PinnedSpan pinned_dests_;
+  PinnedSpan pinned_edge_data_;
+  DeviceBuffer<uint32_t> d_window_dests_[2];
+  DeviceBuffer<uint32_t> d_window_edge_data_[2];
+  cudaStream_t streams_[2] = {nullptr, nullptr};
+};
+
+__device__ inline bool
+FrontierTest(const unsigned* frontier, uint32_t n) {
+  return (frontier[n / 32] & (1u << (n % 32))) != 0;
+}
+
+__device__ inline void
+FrontierSet(unsigned* frontier, uint32_t n) {
+  atomicOr(&frontier[n / 32], 1u << (n % 32));
+}
+
+/// Edge range of node n clamped to the resident window.
+__device__ inline void
+NodeEdgeRange(
+    const uint64_t* adj, uint32_t n, uint64_t edge_begin, uint64_t edge_end,
+    uint64_t* start, uint64_t* end) {
+  uint64_t s = (n == 0) ? 0 : adj[n - 1];
+  uint64_t e = adj[n];
+  *start = s > edge_begin ? s : edge_begin;
+  *end = e < edge_end ? e : edge_end;
+}
+
+__global__ void
+BfsRoundKernel(
+    uint32_t node_begin, uint32_t node_end, const uint64_t* adj,
+    const uint32_t* dests, uint64_t edge_begin, uint64_t edge_end,
+    const unsigned* frontier, unsigned* next, uint32_t* parent,
+    int* changed) {
+  uint32_t n = node_begin + blockIdx.x * blockDim.x + threadIdx.x;
+  if (n >= node_end || !FrontierTest(frontier, n)) {
+    return;
+  }
+  uint64_t start;
+  uint64_t end;
+  NodeEdgeRange(adj, n, edge_begin, edge_end, &start, &end);
+  for (uint64_t e = start; e < end; ++e) {
+    uint32_t dest = dests[e - edge_begin];
+    if (atomicCAS(&parent[dest], kInfinity, n) == kInfinity) {
+      FrontierSet(next, dest);
+      *changed = 1;
+    }
+  }
+}
+
+__global__ void
+SsspRoundKernel(
+    uint32_t node_begin, uint32_t node_end, const uint64_t* adj,
+    const uint32_t* dests, const uint32_t* weights, uint64_t edge_begin,
+    uint64_t edge_end, const unsigned* frontier, unsigned* next,
+    uint32_t* dist, int* changed) {
+  uint32_t n = node_begin + blockIdx.x * blockDim.x + threadIdx.x;
+  if (n >= node_end || !FrontierTest(frontier, n)) {
+    return;
+  }
+  uint32_t n_dist = dist[n];
+  if (n_dist == kInfinity) {
+    return;
+  }
+  uint64_t start;
+  uint64_t end;
+  NodeEdgeRange(adj, n, edge_begin, edge_end, &start, &end);
+  for (uint64_t e = start; e < end; ++e) {
+    uint32_t dest = dests[e - edge_begin];
+    uint32_t new_dist = n_dist + weights[e - edge_begin];
+    if (atomicMin(&dist[dest], new_dist) > new_dist) {
+      FrontierSet(next, dest);
+      *changed = 1;
+    }
+  }
+}
+
+__global__ void
+InitSourceKernel(
+    uint32_t source, uint32_t value, uint32_t* node_data,
+    unsigned* frontier) {
+  node_data[source] = value;
+  FrontierSet(frontier, source);
+}
+
+__global__ void
+FillKernel(uint32_t num_nodes, float value, float* data) {
+  uint32_t n = blockIdx.x * blockDim.x + threadIdx.x;
+  if (n < num_nodes) {
+    data[n] = value;
+  }
+}
+
+/// Per-node contribution for one PageRank iteration: alpha * rank / degree.
+__global__ void
+PagerankContribKernel(
+    uint32_t num_nodes, const uint64_t* adj, const float* rank, float alpha,
+    float* contrib) {
+  uint32_t n = blockIdx.x * blockDim.x + threadIdx.x;
+  if (n >= num_nodes) {
+    return;
+  }
+  uint64_t degree = adj[n] - ((n == 0) ? 0 : adj[n - 1]);
+  contrib[n] = degree > 0 ? alpha * rank[n] / degree : 0.0f;
+}
+
+__global__ void
+PagerankScatterKernel(
+    uint32_t node_begin, uint32_t node_end, const uint64_t* adj,
+    const uint32_t* dests, uint64_t edge_begin, uint64_t edge_end,
+    const float* contrib, float* next) {
+  uint32_t n = node_begin + blockIdx.x * blockDim.x + threadIdx.x;
+  if (n >= node_end) {
+    return;
+  }
+  float c = contrib[n];
+  if (c == 0.0f) {
+    return;
+  }
+  uint64_t start;
+  uint64_t end;
+  NodeEdgeRange(adj, n, edge_begin, edge_end, &start, &end);
+  for (uint64_t e = start; e < end; ++e) {
+    atomicAdd(&next[dests[e - edge_begin]], c);
+  }
+}
+
+__global__ void
+PagerankFinishKernel(
+    uint32_t num_nodes, float base, const float* rank, float* next,
+    float* delta) {
+  uint32_t n = blockIdx.x * blockDim.x + threadIdx.x;
+  if (n >= num_nodes) {
+    return;
+  }
+  float value = next[n] + base;
+  next[n] = value;
+  atomicAdd(delta, fabsf(value - rank[n]));
+}
+
+int
+NumBlocks(uint64_t num_items) {
+  return (num_items + kBlockSize - 1) / kBlockSize;
+}
+
+/// Store a device array of T as the node property output_property_name.
+template <typename T, typename BuilderT>
+katana::Result<void>
+StoreNodeProperty(
+    katana::PropertyGraph* pg, const std::string& output_property_name,
+    const T* d_data, katana::TxnContext* txn_ctx) {
+  std::vector<T> host(pg->NumNodes());
+  CUDA_CHECKED(cudaMemcpy(
+      host.data(), d_data, host.size() * sizeof(T), cudaMemcpyDeviceToHost));
+  BuilderT builder;
+  KATANA_CHECKED(builder.AppendValues(host));
+  std::shared_ptr<arrow::Array> array = KATANA_CHECKED(builder.Finish());
+  auto table = arrow::Table::Make(
+      arrow::schema({arrow::field(output_property_name, array->type())}),
+      {array});
+  return pg->AddNodeProperties(table, txn_ctx);
+}
+
+katana::Result<void>
+GpuBfs(
+    katana::PropertyGraph* pg, uint32_t start_node,
+    const std::string& output_property_name, katana::TxnContext* txn_ctx) {
+  const katana::GraphTopology& topo = pg->topology();
+  if (start_node >= topo.NumNodes()) {
+    return KATANA_ERROR(
+        katana::ErrorCode::InvalidArgument, "invalid start node: {}",
+        start_node);
+  }
+
+  std::unique_ptr<GpuCsr> csr = KATANA_CHECKED(GpuCsr::Make(topo, nullptr));
+  uint32_t num_nodes = csr->num_nodes();
+  size_t frontier_words = (num_nodes + 31) / 32;
+
+  DeviceBuffer<uint32_t> d_parent;
+  DeviceBuffer<unsigned> d_frontier;
+  DeviceBuffer<unsigned> d_next;
+  DeviceBuffer<int> d_changed;
+  KATANA_CHECKED(d_parent.Allocate(num_nodes));
+  KATANA_CHECKED(d_frontier.Allocate(frontier_words));
+  KATANA_CHECKED(d_next.Allocate(frontier_words));
+  KATANA_CHECKED(d_changed.Allocate(1));
+
+  // Unvisited parents are all ones, the same sentinel the CPU algorithms
+  // use; the source is its own parent.
+  CUDA_CHECKED(
+      cudaMemset(d_parent.data(), 0xff, num_nodes * sizeof(uint32_t)));
+  CUDA_CHECKED(
+      cudaMemset(d_frontier.data(), 0, frontier_words * sizeof(unsigned)));
+  CUDA_CHECKED(
+      cudaMemset(d_next.data(), 0, frontier_words * sizeof(unsigned)));
+  InitSourceKernel<<<1, 1>>>(
+      start_node, start_node, d_parent.data(), d_frontier.data());
+  CUDA_CHECKED(cudaGetLastError());
+
+  unsigned* frontier = d_frontier.data();
+  unsigned* next = d_next.data();
+  int changed = 1;
+  while (changed != 0) {
+    CUDA_CHECKED(cudaMemset(d_changed.data(), 0, sizeof(int)));
+    KATANA_CHECKED(csr->ForEachWindow([&](cudaStream_t stream,
+                                          uint32_t node_begin,
+                                          uint32_t node_end,
+                                          uint64_t edge_begin,
+                                          uint64_t edge_end,
+                                          const uint32_t* dests,
+                                          const uint32_t*) {
+      BfsRoundKernel<<<
+          NumBlocks(node_end - node_begin), kBlockSize, 0, stream>>>(
+          node_begin, node_end, csr->d_adj(), dests, edge_begin, edge_end,
+          frontier, next, d_parent.data(), d_changed.data());
+    }));
+    CUDA_CHECKED(cudaMemcpy(
+        &changed, d_changed.data(), sizeof(int), cudaMemcpyDeviceToHost));
+    std::swap(frontier, next);
+    CUDA_CHECKED(
+        cudaMemset(next, 0, frontier_words * sizeof(unsigned)));
+  }
+
+  return StoreNodeProperty<uint32_t, arrow::UInt32Builder>(
+      pg, output_property_name, d_parent.data(), txn_ctx);
+}
+
+/// Flatten the named edge property to a uint32 weight per edge.
+katana::Result<std::vector<uint32_t>>
+EdgeWeights(
+    katana::PropertyGraph* pg, const std::string& edge_weight_property_name) {
+  std::shared_ptr<arrow::ChunkedArray> chunked =
+      KATANA_CHECKED(pg->GetEdgeProperty(edge_weight_property_name));
+  arrow::Datum casted =
+      KATANA_CHECKED(arrow::compute::Cast(chunked, arrow::uint32()));
+  std::vector<uint32_t> weights;
+  weights.reserve(pg->NumEdges());
+  for (const std::shared_ptr<arrow::Array>& chunk :
+       casted.chunked_array()->chunks()) {
+    auto typed = std::static_pointer_cast<arrow::UInt32Array>(chunk);
+    if (typed->null_count() != 0) {
+      return KATANA_ERROR(
+          katana::ErrorCode::InvalidArgument,
+          "edge weight property {} has null values",
+          edge_weight_property_name);
+    }
+    weights.insert(
+        weights.end(), typed->raw_values(),
+        typed->raw_values() + typed->length());
+  }
+  return weights;
+}
+
+katana::Result<void>
+GpuSssp(
+    katana::PropertyGraph* pg, size_t start_node,
+    const std::string& edge_weight_property_name,
+    const std::string& output_property_name, katana::TxnContext* txn_ctx) {
+  const katana::GraphTopology& topo = pg->topology();
+  if (start_node >= topo.NumNodes()) {
+    return KATANA_ERROR(
+        katana::ErrorCode::InvalidArgument, "invalid start node: {}",
+        start_node);
+  }
+
+  std::vector<uint32_t> weights;
+  if (edge_weight_property_name.empty()) {
+    weights.assign(topo.NumEdges(), 1);
+  } else {
+    weights = KATANA_CHECKED(EdgeWeights(pg, edge_weight_property_name));
+  }
+
+  std::unique_ptr<GpuCsr> csr =
+      KATANA_CHECKED(GpuCsr::Make(topo, weights.data()));
+  uint32_t num_nodes = csr->num_nodes();
+  size_t frontier_words = (num_nodes + 31) / 32;
+
+  DeviceBuffer<uint32_t> d_dist;
+  DeviceBuffer<unsigned> d_frontier;
+  DeviceBuffer<unsigned> d_next;
+  DeviceBuffer<int> d_changed;
+  KATANA_CHECKED(d_dist.Allocate(num_nodes));
+  KATANA_CHECKED(d_frontier.Allocate(frontier_words));
+  KATANA_CHECKED(d_next.Allocate(frontier_words));
+  KATANA_CHECKED(d_changed.Allocate(1));
+
+  CUDA_CHECKED(cudaMemset(d_dist.data(), 0xff, num_nodes * sizeof(uint32_t)));
+  CUDA_CHECKED(
+      cudaMemset(d_frontier.data(), 0, frontier_words * sizeof(unsigned)));
+  CUDA_CHECKED(
+      cudaMemset(d_next.data(), 0, frontier_words * sizeof(unsigned)));
+  InitSourceKernel<<<1, 1>>>(
+      start_node, 0, d_dist.data(), d_frontier.data());
+  CUDA_CHECKED(cudaGetLastError());
+
+  unsigned* frontier = d_frontier.data();
+  unsigned* next = d_next.data();
+  int changed = 1;
+  while (changed != 0) {
+    CUDA_CHECKED(cudaMemset(d_changed.data(), 0, sizeof(int)));
+    KATANA_CHECKED(csr->ForEachWindow([&](cudaStream_t stream,
+                                          uint32_t node_begin,
+                                          uint32_t node_end,
+                                          uint64_t edge_begin,
+                                          uint64_t edge_end,
+                                          const uint32_t* dests,
+                                          const uint32_t* edge_data) {
+      SsspRoundKernel<<<
+          NumBlocks(node_end - node_begin), kBlockSize, 0, stream>>>(
+          node_begin, node_end, csr->d_adj(), dests, edge_data, edge_begin,
+          edge_end, frontier, next, d_dist.data(), d_changed.data());
+    }));
+    CUDA_CHECKED(cudaMemcpy(
+        &changed, d_changed.data(), sizeof(int), cudaMemcpyDeviceToHost));
+    std::swap(frontier, next);
+    CUDA_CHECKED(
+        cudaMemset(next, 0, frontier_words * sizeof(unsigned)));
+  }
+
+  return StoreNodeProperty<uint32_t, arrow::UInt32Builder>(
+      pg, output_property_name, d_dist.data(), txn_ctx);
+}
+
+katana::Result<void>
+GpuPagerank(
+    katana::PropertyGraph* pg, const std::string& output_property_name,
+    katana::TxnContext* txn_ctx, float tolerance, unsigned max_iterations,
+    float alpha) {
+  const katana::GraphTopology& topo = pg->topology();
+  std::unique_ptr<GpuCsr> csr = KATANA_CHECKED(GpuCsr::Make(topo, nullptr));
+  uint32_t num_nodes = csr->num_nodes();
+  if (num_nodes == 0) {
+    return KATANA_ERROR(katana::ErrorCode::InvalidArgument, "empty graph");
+  }
+
+  DeviceBuffer<float> d_rank;
+  DeviceBuffer<float> d_next;
+  DeviceBuffer<float> d_contrib;
+  DeviceBuffer<float> d_delta;
+  KATANA_CHECKED(d_rank.Allocate(num_nodes));
+  KATANA_CHECKED(d_next.Allocate(num_nodes));
+  KATANA_CHECKED(d_contrib.Allocate(num_nodes));
+  KATANA_CHECKED(d_delta.Allocate(1));
+
+  int blocks = NumBlocks(num_nodes);
+  FillKernel<<<blocks, kBlockSize>>>(
+      num_nodes, 1.0f / num_nodes, d_rank.data());
+  CUDA_CHECKED(cudaGetLastError());
+
+  float* rank = d_rank.data();
+  float* next = d_next.data();
+  float base = (1.0f - alpha) / num_nodes;
+  for (unsigned iter = 0; iter < max_iterations; ++iter) {
+    CUDA_CHECKED(cudaMemset(next, 0, num_nodes * sizeof(float)));
+    CUDA_CHECKED(cudaMemset(d_delta.data(), 0, sizeof(float)));
+    PagerankContribKernel<<<blocks, kBlockSize>>>(
+        num_nodes, csr->d_adj(), rank, alpha, d_contrib.data());
+    CUDA_CHECKED(cudaGetLastError());
+    KATANA_CHECKED(csr->ForEachWindow([&](cudaStream_t stream,
+                                          uint32_t node_begin,
+                                          uint32_t node_end,
+                                          uint64_t edge_begin,
+                                          uint64_t edge_end,
+                                          const uint32_t* dests,
+                                          const uint32_t*) {
+      PagerankScatterKernel<<<
+          NumBlocks(node_end - node_begin), kBlockSize, 0, stream>>>(
+          node_begin, node_end, csr->d_adj(), dests, edge_begin, edge_end,
+          d_contrib.data(), next);
+    }));
+    PagerankFinishKernel<<<blocks, kBlockSize>>>(
+        num_nodes, base, rank, next, d_delta.data());
+    CUDA_CHECKED(cudaGetLastError());
+    float delta = 0;
+    CUDA_CHECKED(cudaMemcpy(
+        &delta, d_delta.data(), sizeof(float), cudaMemcpyDeviceToHost));
+    std::swap(rank, next);
+    if (delta <= tolerance) {
+      break;
+    }
+  }
+
+  return StoreNodeProperty<float, arrow::FloatBuilder>(
+      pg, output_property_name, rank, txn_ctx);
+}
+
+const katana::analytics::GpuBackend kCudaBackend{
+    &GpuBfs, &GpuSssp, &GpuPagerank};
+
+}  // namespace
+
+katana::Result<void>
+katana::gpu::RegisterGpuBackend() {
+  int device_count = 0;
+  KATANA_CHECKED(
+      CudaToResult(cudaGetDeviceCount(&device_count), "cudaGetDeviceCount"));
+  if (device_count == 0) {
+    return KATANA_ERROR(katana::ErrorCode::NotFound, "no CUDA device found");
+  }
+  katana::analytics::SetGpuBackend(&kCudaBackend);
+  return katana::ResultSuccess();
+}
+
+void
+katana::gpu::UnregisterGpuBackend() {
+  katana::analytics::SetGpuBackend(nullptr);
+}
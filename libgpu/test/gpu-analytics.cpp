@@ -0,0 +1,37 @@
+#include "katana/GpuAnalytics.h"
+#include "katana/Logging.h"
+#include "katana/SharedMemSys.h"
+#include "katana/TopologyGeneration.h"
+#include "katana/TxnContext.h"
+#include "katana/analytics/bfs/bfs.h"
+#include "katana/analytics/pagerank/pagerank.h"
+#include "katana/analytics/sssp/sssp.h"
+
+int
+main() {
+  katana::SharedMemSys sys;
+
+  if (auto res = katana::gpu::RegisterGpuBackend(); !res) {
+    KATANA_LOG_WARN("no usable CUDA device, skipping: {}", res.error());
+    return 0;
+  }
+
+  std::unique_ptr<katana::PropertyGraph> pg = katana::MakeGrid(10, 10, false);
+  katana::TxnContext txn_ctx;
+
+  KATANA_LOG_ASSERT(katana::analytics::Bfs(
+      pg.get(), 0, "gpu_parent", &txn_ctx, katana::analytics::BfsPlan::Gpu()));
+  KATANA_LOG_ASSERT(
+      katana::analytics::BfsAssertValid(pg.get(), 0, "gpu_parent"));
+
+  KATANA_LOG_ASSERT(katana::analytics::Sssp(
+      pg.get(), 0, "", "gpu_dist", &txn_ctx,
+      katana::analytics::SsspPlan::Gpu()));
+
+  KATANA_LOG_ASSERT(katana::analytics::Pagerank(
+      pg.get(), "gpu_rank", &txn_ctx, katana::analytics::PagerankPlan::Gpu()));
+
+  katana::gpu::UnregisterGpuBackend();
+
+  return 0;
+}
@@ -0,0 +1,124 @@
+#ifndef KATANA_LIBGRAPH_KATANA_ADJACENCYBLOOMFILTER_H_
+#define KATANA_LIBGRAPH_KATANA_ADJACENCYBLOOMFILTER_H_
+
+#include <cstdint>
+
+#include "katana/GraphTopology.h"
+#include "katana/NUMAArray.h"
+#include "katana/RDGAdjacencyFilter.h"
+#include "katana/Result.h"
+#include "katana/config.h"
+
+namespace katana {
+
+/// Per-node blocked bloom filters over adjacency lists, for workloads
+/// dominated by negative HasEdge probes (link-prediction scoring does
+/// billions of them). EdgeShuffleTopology::HasEdge binary-searches the
+/// destination array; MayHaveEdge answers the common "no such edge" case
+/// from a single 64-byte block without touching dests_ and never returns
+/// a false negative.
+///
+/// Each node owns a power-of-two number of 512-bit blocks sized from its
+/// degree (bits_per_edge bits per out-edge, 12 by default for a ~1% false
+/// positive rate); a probe hashes the destination, picks one of the
+/// node's blocks and tests kProbesPerEdge bits inside it, so the whole
+/// check stays within one cache line regardless of degree.
+///
+/// Filters are built in parallel over nodes and can be persisted as an
+/// RDG sidecar through RDGAdjacencyFilter, so reloading a dataset skips
+/// the build.
+class KATANA_EXPORT AdjacencyBloomFilter : public GraphTopologyTypes {
+public:
+  /// Words per block; one block is exactly one 64-byte cache line.
+  static constexpr uint64_t kWordsPerBlock = 8;
+  static constexpr uint64_t kBitsPerBlock = kWordsPerBlock * 64;
+  /// Bits tested per probe; 6 probes at 12 bits/edge keep the false
+  /// positive rate around 1%.
+  static constexpr uint64_t kProbesPerEdge = 6;
+  static constexpr uint64_t kDefaultBitsPerEdge = 12;
+
+  AdjacencyBloomFilter() = default;
+  AdjacencyBloomFilter(AdjacencyBloomFilter&&) = default;
+  AdjacencyBloomFilter& operator=(AdjacencyBloomFilter&&) = default;
+
+  AdjacencyBloomFilter(const AdjacencyBloomFilter&) = delete;
+  AdjacencyBloomFilter& operator=(const AdjacencyBloomFilter&) = delete;
+
+  /// Builds filters for every node's out-adjacency in parallel.
+  static AdjacencyBloomFilter Make(
+      const PropertyGraph* pg,
+      uint64_t bits_per_edge = kDefaultBitsPerEdge) noexcept;
+
+  /// Rehydrates a filter loaded from storage
+  /// (PropertyGraph::LoadAdjacencyFilter).
+  static Result<AdjacencyBloomFilter> Make(RDGAdjacencyFilter&& rdg_filter);
+
+  /// Converts this filter to its storage form for
+  /// PropertyGraph::WriteAdjacencyFilter.
+  Result<RDGAdjacencyFilter> ToRDGAdjacencyFilter() const;
+
+  uint64_t NumNodes() const noexcept {
+    return block_offsets_.empty() ? 0 : block_offsets_.size() - 1;
+  }
+
+  uint64_t bits_per_edge() const noexcept { return bits_per_edge_; }
+
+  /// \returns false only when the edge (src, dst) definitely does not
+  /// exist; a true result must be confirmed against the topology.
+  bool MayHaveEdge(Node src, Node dst) const noexcept {
+    const uint64_t block_begin = block_offsets_[src];
+    const uint64_t num_blocks = block_offsets_[src + 1] - block_begin;
+    if (num_blocks == 0) {
+      return false;
+    }
+    const uint64_t h = MixHash(dst);
+    // num_blocks is a power of two by construction.
+    const uint64_t* block =
+        &words_[(block_begin + ((h >> 48) & (num_blocks - 1))) *
+                kWordsPerBlock];
+    const uint64_t probe1 = h & (kBitsPerBlock - 1);
+    const uint64_t probe2 = ((h >> 9) & (kBitsPerBlock - 1)) | 1;
+    for (uint64_t i = 0; i < kProbesPerEdge; ++i) {
+      const uint64_t bit = (probe1 + i * probe2) & (kBitsPerBlock - 1);
+      if ((block[bit >> 6] & (uint64_t{1} << (bit & 63))) == 0) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /// Exact HasEdge that consults the topology's binary search only when
+  /// the filter cannot rule the edge out.
+  bool HasEdge(
+      const EdgeShuffleTopology& topo, const Node& src,
+      const Node& dst) const noexcept {
+    return MayHaveEdge(src, dst) && topo.HasEdge(src, dst);
+  }
+
+private:
+  AdjacencyBloomFilter(
+      NUMAArray<uint64_t>&& block_offsets, NUMAArray<uint64_t>&& words,
+      uint64_t bits_per_edge) noexcept
+      : block_offsets_(std::move(block_offsets)),
+        words_(std::move(words)),
+        bits_per_edge_(bits_per_edge) {}
+
+  /// splitmix64 finalizer; every probe of one destination derives from
+  /// this single mix.
+  static uint64_t MixHash(uint64_t x) noexcept {
+    x += UINT64_C(0x9e3779b97f4a7c15);
+    x = (x ^ (x >> 30)) * UINT64_C(0xbf58476d1ce4e5b9);
+    x = (x ^ (x >> 27)) * UINT64_C(0x94d049bb133111eb);
+    return x ^ (x >> 31);
+  }
+
+  /// Block range of node n is [block_offsets_[n], block_offsets_[n + 1]),
+  /// in units of kWordsPerBlock words into words_.
+  NUMAArray<uint64_t> block_offsets_;
+  NUMAArray<uint64_t> words_;
+  uint64_t bits_per_edge_{kDefaultBitsPerEdge};
+};
+
+}  // namespace katana
+
+#endif
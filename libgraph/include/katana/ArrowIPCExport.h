@@ -0,0 +1,60 @@
+#ifndef KATANA_LIBGRAPH_KATANA_ARROWIPCEXPORT_H_
+#define KATANA_LIBGRAPH_KATANA_ARROWIPCEXPORT_H_
+
+/// Export node and edge property selections as Arrow IPC streams.
+///
+/// The IPC stream format references the graph's property buffers
+/// directly, so exports avoid the per-element conversion cost of the
+/// Parquet and Python paths. Payloads can be written to storage or
+/// pushed to an HTTP ingestion endpoint.
+///
+/// \file
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <arrow/api.h>
+
+#include "katana/PropertyGraph.h"
+#include "katana/Result.h"
+#include "katana/URI.h"
+
+namespace katana {
+
+/// Serialize the named node properties of \param pg into an Arrow IPC
+/// stream. An empty \param properties list selects all loaded node
+/// properties.
+KATANA_EXPORT Result<std::shared_ptr<arrow::Buffer>> ExportNodePropertiesIPC(
+    const PropertyGraph& pg, const std::vector<std::string>& properties = {});
+
+/// \see ExportNodePropertiesIPC
+KATANA_EXPORT Result<std::shared_ptr<arrow::Buffer>> ExportEdgePropertiesIPC(
+    const PropertyGraph& pg, const std::vector<std::string>& properties = {});
+
+/// Write the named node properties of \param pg to \param uri in the
+/// Arrow IPC stream format.
+KATANA_EXPORT Result<void> WriteNodePropertiesIPC(
+    const PropertyGraph& pg, const URI& uri,
+    const std::vector<std::string>& properties = {});
+
+/// \see WriteNodePropertiesIPC
+KATANA_EXPORT Result<void> WriteEdgePropertiesIPC(
+    const PropertyGraph& pg, const URI& uri,
+    const std::vector<std::string>& properties = {});
+
+/// POST the named node properties of \param pg to \param url as an
+/// Arrow IPC stream; the receiver reads the body with any Arrow IPC
+/// stream reader.
+KATANA_EXPORT Result<void> PushNodePropertiesIPC(
+    const PropertyGraph& pg, const std::string& url,
+    const std::vector<std::string>& properties = {});
+
+/// \see PushNodePropertiesIPC
+KATANA_EXPORT Result<void> PushEdgePropertiesIPC(
+    const PropertyGraph& pg, const std::string& url,
+    const std::vector<std::string>& properties = {});
+
+}  // namespace katana
+
+#endif
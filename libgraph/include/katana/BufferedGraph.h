@@ -26,11 +26,19 @@
 #ifndef KATANA_LIBGRAPH_KATANA_BUFFEREDGRAPH_H_
 #define KATANA_LIBGRAPH_KATANA_BUFFEREDGRAPH_H_
 
-#include <fstream>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <future>
+#include <vector>
 
 #include <boost/iterator/counting_iterator.hpp>
 
+#include "katana/AsyncIOService.h"
+#include "katana/AtomicHelpers.h"
 #include "katana/Reduction.h"
+#include "katana/Result.h"
 #include "katana/config.h"
 #include "katana/gIO.h"
 
@@ -40,6 +48,12 @@ namespace katana {
  * Class that loads a portion of a Galois graph from disk directly into
  * memory buffers for access.
  *
+ * Reads are submitted to the dedicated I/O thread one read-ahead window
+ * at a time rather than performed synchronously up front; accessors block
+ * only until the window holding the requested node/edge has landed, so
+ * iteration from the front of the loaded range overlaps with the reads
+ * still in flight behind it.
+ *
  * @tparam EdgeDataType type of the edge data
  * @todo version 2 Galois binary graph support; currently only suppports
  * version 1
@@ -74,6 +88,126 @@ private:
   //! specifies whether or not the graph is loaded
   bool graphLoaded = false;
 
+  //! default number of bytes fetched per asynchronous read window
+  static constexpr uint64_t kDefaultLoadWindowBytes = 32 * 1024 * 1024;
+
+  //! file descriptor of the graph being loaded; stays open until all
+  //! outstanding read windows have completed
+  int graphFd = -1;
+  //! bytes fetched per asynchronous read window
+  uint64_t loadWindowBytes = kDefaultLoadWindowBytes;
+
+  //! Read-ahead state for one loaded buffer
+  struct LoadRegion {
+    //! one future per read window, in file order
+    std::vector<std::shared_future<katana::CopyableResult<void>>> windows;
+    //! number of leading windows known to have completed
+    std::atomic<uint64_t> windowsReady{0};
+    //! buffer items covered by each window (the last may cover fewer)
+    uint64_t itemsPerWindow{0};
+  };
+
+  //! read-ahead state for the out index buffer
+  LoadRegion outIndexRegion;
+  //! read-ahead state for the edge dest buffer
+  LoadRegion edgeDestRegion;
+  //! read-ahead state for the edge data buffer
+  LoadRegion edgeDataRegion;
+
+  /**
+   * Submit the asynchronous reads that fill a buffer with a contiguous
+   * byte range of the graph file, one read-ahead window at a time.
+   *
+   * @param region read-ahead state to track the submitted windows in
+   * @param buffer destination buffer; must hold numBytes
+   * @param fileOffset first byte of the file to read
+   * @param numBytes number of bytes to read
+   * @param itemSize size of one buffer item; windows are item-aligned
+   */
+  void startRegionLoad(
+      LoadRegion& region, char* buffer, uint64_t fileOffset, uint64_t numBytes,
+      uint64_t itemSize) {
+    uint64_t window = loadWindowBytes - (loadWindowBytes % itemSize);
+    if (window < itemSize) {
+      window = itemSize;
+    }
+    region.itemsPerWindow = window / itemSize;
+
+    int fd = graphFd;
+    for (uint64_t done = 0; done < numBytes; done += window) {
+      char* dst = buffer + done;
+      uint64_t off = fileOffset + done;
+      uint64_t len = std::min(window, numBytes - done);
+      region.windows.emplace_back(
+          AsyncIOService::Get()
+              .Submit([fd, dst, off, len]() -> katana::CopyableResult<void> {
+                uint64_t bytesRead = 0;
+                while (bytesRead < len) {
+                  ssize_t got = pread(
+                      fd, dst + bytesRead, len - bytesRead, off + bytesRead);
+                  if (got < 0) {
+                    if (errno == EINTR) {
+                      continue;
+                    }
+                    return KATANA_ERROR(
+                        katana::ResultErrno(), "reading graph file");
+                  }
+                  if (got == 0) {
+                    return KATANA_ERROR(
+                        katana::ErrorCode::InvalidArgument,
+                        "unexpected end of graph file");
+                  }
+                  bytesRead += got;
+                }
+                return katana::CopyableResultSuccess();
+              })
+              .share());
+    }
+  }
+
+  /**
+   * Block until every read window covering items [0, localItemID] of a
+   * region has completed. Cheap once the covering windows have been seen
+   * to complete; safe to call concurrently.
+   */
+  void waitForItem(LoadRegion& region, uint64_t localItemID) {
+    if (region.windows.empty()) {
+      return;
+    }
+    uint64_t needed = localItemID / region.itemsPerWindow + 1;
+    if (needed > region.windows.size()) {
+      needed = region.windows.size();
+    }
+    if (region.windowsReady.load(std::memory_order_acquire) >= needed) {
+      return;
+    }
+    for (uint64_t i = 0; i < needed; i++) {
+      const katana::CopyableResult<void>& res = region.windows[i].get();
+      if (!res) {
+        KATANA_DIE("failed to read graph file: ", res.error().message());
+      }
+    }
+    katana::atomicMax(region.windowsReady, needed);
+  }
+
+  /**
+   * Wait for every outstanding read window; reads write into the buffers
+   * and the file descriptor, so both must outlive them.
+   */
+  void waitForOutstandingReads() {
+    for (LoadRegion* region :
+         {&outIndexRegion, &edgeDestRegion, &edgeDataRegion}) {
+      for (const auto& window : region->windows) {
+        if (window.valid()) {
+          window.wait();
+        }
+      }
+      region->windows.clear();
+      region->windowsReady = 0;
+      region->itemsPerWindow = 0;
+    }
+  }
+
   // accumulators for tracking bytes read
   //! number of bytes read related to the out index buffer
   katana::GAccumulator<uint64_t> numBytesReadOutIndex;
@@ -83,15 +217,13 @@ private:
   katana::GAccumulator<uint64_t> numBytesReadEdgeData;
 
   /**
-   * Load the out indices (i.e. where a particular node's edges begin in the
-   * array of edges) from the file.
+   * Start loading the out indices (i.e. where a particular node's edges
+   * begin in the array of edges) from the file.
    *
-   * @param graphFile loaded file for the graph
    * @param nodeStart the first node to load
    * @param numNodesToLoad number of nodes to load
    */
-  void loadOutIndex(
-      std::ifstream& graphFile, uint64_t nodeStart, uint64_t numNodesToLoad) {
+  void loadOutIndex(uint64_t nodeStart, uint64_t numNodesToLoad) {
     if (numNodesToLoad == 0) {
       return;
     }
@@ -102,37 +234,25 @@ private:
       KATANA_DIE("Failed to allocate memory for out index buffer.");
     }
 
-    // position to start of contiguous chunk of nodes to read
+    // position of start of contiguous chunk of nodes to read
     uint64_t readPosition = (4 + nodeStart) * sizeof(uint64_t);
-    graphFile.seekg(readPosition);
-
-    uint64_t numBytesToLoad = numNodesToLoad * sizeof(uint64_t);
-    uint64_t bytesRead = 0;
-
-    while (numBytesToLoad > 0) {
-      graphFile.read(((char*)this->outIndexBuffer) + bytesRead, numBytesToLoad);
-      size_t numRead = graphFile.gcount();
-      numBytesToLoad -= numRead;
-      bytesRead += numRead;
-    }
-
-    KATANA_LOG_DEBUG_ASSERT(numBytesToLoad == 0);
+    startRegionLoad(
+        outIndexRegion, (char*)outIndexBuffer, readPosition,
+        numNodesToLoad * sizeof(uint64_t), sizeof(uint64_t));
 
     nodeOffset = nodeStart;
   }
 
   /**
-   * Load the edge destination information from the file.
+   * Start loading the edge destination information from the file.
    *
-   * @param graphFile loaded file for the graph
    * @param edgeStart the first edge to load
    * @param numEdgesToLoad number of edges to load
    * @param numGlobalNodes total number of nodes in the graph file; needed
    * to determine offset into the file
    */
   void loadEdgeDest(
-      std::ifstream& graphFile, uint64_t edgeStart, uint64_t numEdgesToLoad,
-      uint64_t numGlobalNodes) {
+      uint64_t edgeStart, uint64_t numEdgesToLoad, uint64_t numGlobalNodes) {
     if (numEdgesToLoad == 0) {
       return;
     }
@@ -144,27 +264,19 @@ private:
       KATANA_DIE("Failed to allocate memory for edge dest buffer.");
     }
 
-    // position to start of contiguous chunk of edges to read
+    // position of start of contiguous chunk of edges to read
     uint64_t readPosition = (4 + numGlobalNodes) * sizeof(uint64_t) +
                             (sizeof(uint32_t) * edgeStart);
-    graphFile.seekg(readPosition);
+    startRegionLoad(
+        edgeDestRegion, (char*)edgeDestBuffer, readPosition,
+        numEdgesToLoad * sizeof(uint32_t), sizeof(uint32_t));
 
-    uint64_t numBytesToLoad = numEdgesToLoad * sizeof(uint32_t);
-    uint64_t bytesRead = 0;
-    while (numBytesToLoad > 0) {
-      graphFile.read(((char*)this->edgeDestBuffer) + bytesRead, numBytesToLoad);
-      size_t numRead = graphFile.gcount();
-      numBytesToLoad -= numRead;
-      bytesRead += numRead;
-    }
-
-    KATANA_LOG_DEBUG_ASSERT(numBytesToLoad == 0);
     // save edge offset of this graph for later use
     edgeOffset = edgeStart;
   }
 
   /**
-   * Load the edge data information from the file.
+   * Start loading the edge data information from the file.
    *
    * @tparam EdgeType must be non-void in order to call this function
    *
@@ -179,8 +291,8 @@ private:
       typename EdgeType,
       typename std::enable_if<!std::is_void<EdgeType>::value>::type* = nullptr>
   void loadEdgeData(
-      std::ifstream& graphFile, uint64_t edgeStart, uint64_t numEdgesToLoad,
-      uint64_t numGlobalNodes, uint64_t numGlobalEdges) {
+      uint64_t edgeStart, uint64_t numEdgesToLoad, uint64_t numGlobalNodes,
+      uint64_t numGlobalEdges) {
     katana::gDebug("Loading edge data");
 
     if (numEdgesToLoad == 0) {
@@ -204,21 +316,12 @@ private:
       baseReadPosition += sizeof(uint32_t);
     }
 
-    // jump to first byte of edge data
+    // first byte of edge data
     uint64_t readPosition =
         baseReadPosition + (sizeof(EdgeDataType) * edgeStart);
-    graphFile.seekg(readPosition);
-    uint64_t numBytesToLoad = numEdgesToLoad * sizeof(EdgeDataType);
-    uint64_t bytesRead = 0;
-
-    while (numBytesToLoad > 0) {
-      graphFile.read(((char*)this->edgeDataBuffer) + bytesRead, numBytesToLoad);
-      size_t numRead = graphFile.gcount();
-      numBytesToLoad -= numRead;
-      bytesRead += numRead;
-    }
-
-    KATANA_LOG_DEBUG_ASSERT(numBytesToLoad == 0);
+    startRegionLoad(
+        edgeDataRegion, (char*)edgeDataBuffer, readPosition,
+        numEdgesToLoad * sizeof(EdgeDataType), sizeof(EdgeDataType));
   }
 
   /**
@@ -232,7 +335,7 @@ private:
   template <
       typename EdgeType,
       typename std::enable_if<std::is_void<EdgeType>::value>::type* = nullptr>
-  void loadEdgeData(std::ifstream&, uint64_t, uint64_t, uint64_t, uint64_t) {
+  void loadEdgeData(uint64_t, uint64_t, uint64_t, uint64_t) {
     katana::gDebug("Not loading edge data");
     // do nothing (edge data is void, i.e. no edge data)
   }
@@ -252,9 +355,15 @@ private:
   }
 
   /**
-   * Free all of the buffers in memory.
+   * Free all of the buffers in memory. Waits for outstanding reads first;
+   * they write into the buffers being freed.
    */
   void freeMemory() {
+    waitForOutstandingReads();
+    if (graphFd >= 0) {
+      close(graphFd);
+      graphFd = -1;
+    }
     free(outIndexBuffer);
     outIndexBuffer = nullptr;
     free(edgeDestBuffer);
@@ -263,6 +372,32 @@ private:
     edgeDataBuffer = nullptr;
   }
 
+  /**
+   * Open the graph file and read its 4 word header synchronously.
+   *
+   * @param filename name of graph to open
+   * @param header destination for the 4 header words
+   */
+  void openGraphFile(const std::string& filename, uint64_t* header) {
+    graphFd = open(filename.c_str(), O_RDONLY);
+    if (graphFd < 0) {
+      KATANA_DIE("Failed to open graph file ", filename);
+    }
+    uint64_t headerBytes = 4 * sizeof(uint64_t);
+    uint64_t bytesRead = 0;
+    while (bytesRead < headerBytes) {
+      ssize_t got = pread(
+          graphFd, ((char*)header) + bytesRead, headerBytes - bytesRead,
+          bytesRead);
+      if (got <= 0 && errno != EINTR) {
+        KATANA_DIE("Failed to read graph header of ", filename);
+      }
+      if (got > 0) {
+        bytesRead += got;
+      }
+    }
+  }
+
 public:
   //! Edge iterator typedef
   using EdgeIterator = boost::counting_iterator<uint64_t>;
@@ -306,9 +441,28 @@ public:
   //! @returns node offset of this buffered graph
   uint64_t getNodeOffset() const { return nodeOffset; }
 
+  /**
+   * Set the size of the asynchronous read-ahead window. Must be called
+   * before the graph is loaded.
+   *
+   * @param bytes bytes fetched per read window
+   */
+  void setLoadWindowSize(uint64_t bytes) {
+    if (graphLoaded) {
+      KATANA_DIE("Cannot change the read window of a loaded graph.");
+    }
+    if (bytes == 0) {
+      KATANA_DIE("Read window must be non-zero.");
+    }
+    loadWindowBytes = bytes;
+  }
+
   /**
    * Loads given Galois CSR graph into memory.
    *
+   * Returns once the reads are in flight; accessors block until the
+   * window they touch has landed.
+   *
    * @param filename name of graph to load; should be in Galois binary graph
    * format
    */
@@ -317,21 +471,17 @@ public:
       KATANA_DIE("Cannot load an buffered graph more than once.");
     }
 
-    std::ifstream graphFile(filename.c_str());
     uint64_t header[4];
-    graphFile.read(((char*)header), sizeof(uint64_t) * 4);
+    openGraphFile(filename, header);
 
     numLocalNodes = globalSize = header[2];
     numLocalEdges = globalEdgeSize = header[3];
 
-    loadOutIndex(graphFile, 0, globalSize);
-    loadEdgeDest(graphFile, 0, globalEdgeSize, globalSize);
+    loadOutIndex(0, globalSize);
+    loadEdgeDest(0, globalEdgeSize, globalSize);
     // may or may not do something depending on EdgeDataType
-    loadEdgeData<EdgeDataType>(
-        graphFile, 0, globalEdgeSize, globalSize, globalEdgeSize);
+    loadEdgeData<EdgeDataType>(0, globalEdgeSize, globalSize, globalEdgeSize);
     graphLoaded = true;
-
-    graphFile.close();
   }
 
   /**
@@ -340,6 +490,10 @@ public:
    *
    * @param filename name of graph to load; should be in Galois binary graph
    * format
+   * Returns once the reads are in flight; accessors block until the
+   * window they touch has landed, so edge iteration from nodeStart
+   * forward overlaps with the reads behind it.
+   *
    * @param nodeStart First node to load
    * @param nodeEnd Last node to load, non-inclusive
    * @param edgeStart First edge to load; should correspond to first edge of
@@ -356,25 +510,24 @@ public:
       KATANA_DIE("Cannot load an buffered graph more than once.");
     }
 
-    std::ifstream graphFile(filename.c_str());
+    uint64_t header[4];
+    openGraphFile(filename, header);
 
     globalSize = numGlobalNodes;
     globalEdgeSize = numGlobalEdges;
 
     KATANA_LOG_DEBUG_ASSERT(nodeEnd >= nodeStart);
     numLocalNodes = nodeEnd - nodeStart;
-    loadOutIndex(graphFile, nodeStart, numLocalNodes);
+    loadOutIndex(nodeStart, numLocalNodes);
 
     KATANA_LOG_DEBUG_ASSERT(edgeEnd >= edgeStart);
     numLocalEdges = edgeEnd - edgeStart;
-    loadEdgeDest(graphFile, edgeStart, numLocalEdges, numGlobalNodes);
+    loadEdgeDest(edgeStart, numLocalEdges, numGlobalNodes);
 
     // may or may not do something depending on EdgeDataType
     loadEdgeData<EdgeDataType>(
-        graphFile, edgeStart, numLocalEdges, numGlobalNodes, numGlobalEdges);
+        edgeStart, numLocalEdges, numGlobalNodes, numGlobalEdges);
     graphLoaded = true;
-
-    graphFile.close();
   }
 
   /**
@@ -397,6 +550,7 @@ public:
     KATANA_LOG_DEBUG_ASSERT(globalNodeID < (nodeOffset + numLocalNodes));
 
     uint64_t localNodeID = globalNodeID - nodeOffset;
+    waitForItem(outIndexRegion, localNodeID);
 
     if (localNodeID != 0) {
       numBytesReadOutIndex += sizeof(uint64_t);
@@ -427,6 +581,7 @@ public:
     numBytesReadOutIndex += sizeof(uint64_t);
 
     uint64_t localNodeID = globalNodeID - nodeOffset;
+    waitForItem(outIndexRegion, localNodeID);
     return EdgeIterator(outIndexBuffer[localNodeID]);
   }
 
@@ -450,6 +605,7 @@ public:
     numBytesReadEdgeDest += sizeof(uint32_t);
 
     uint64_t localEdgeID = globalEdgeID - edgeOffset;
+    waitForItem(edgeDestRegion, localEdgeID);
     return edgeDestBuffer[localEdgeID];
   }
 
@@ -480,6 +636,7 @@ public:
     numBytesReadEdgeData += sizeof(EdgeDataType);
 
     uint64_t localEdgeID = globalEdgeID - edgeOffset;
+    waitForItem(edgeDataRegion, localEdgeID);
     return edgeDataBuffer[localEdgeID];
   }
 
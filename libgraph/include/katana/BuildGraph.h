@@ -29,7 +29,7 @@ using NullMaps = std::pair<
     std::unordered_map<int, std::shared_ptr<arrow::Array>>,
     std::unordered_map<int, std::shared_ptr<arrow::Array>>>;
 
-enum SourceType { kGraphml, kKatana };
+enum SourceType { kGraphml, kKatana, kCsv, kJsonl };
 enum SourceDatabase { kNone, kNeo4j, kMongodb, kMysql };
 enum ImportDataType {
   kString,
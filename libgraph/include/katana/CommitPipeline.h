@@ -0,0 +1,104 @@
+#ifndef KATANA_LIBGRAPH_KATANA_COMMITPIPELINE_H_
+#define KATANA_LIBGRAPH_KATANA_COMMITPIPELINE_H_
+
+/// Write-behind durable commits with group commit.
+///
+/// PropertyGraph::Commit blocks the caller for the full storage round
+/// trip, which for remote stores is dominated by latency the writer does
+/// not need to wait on: the sealed in-memory version can be published to
+/// readers (see VersionedGraph) the moment it exists. The pipeline moves
+/// the durable write onto a dedicated thread and batches: every submitted
+/// commit writes the complete current graph state, so when several
+/// versions queue up behind one slow round trip only the newest needs to
+/// reach storage — one data write and one manifest update acknowledge the
+/// whole batch. Callers that need durability (acking an upstream source,
+/// trimming a log) wait on the watermark instead of on each commit.
+///
+/// \file
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+#include "katana/PropertyGraph.h"
+#include "katana/Result.h"
+#include "katana/config.h"
+
+namespace katana {
+
+class KATANA_EXPORT CommitPipeline {
+public:
+  /// A durable commit step. Ops must be cumulative — each writes the
+  /// complete current state, as PropertyGraph::Commit does — because
+  /// group commit runs only the newest op of a drained batch and counts
+  /// the ones it subsumed as durable.
+  typedef std::function<katana::CopyableResult<void>()> Op;
+
+  CommitPipeline(const CommitPipeline&) = delete;
+  CommitPipeline& operator=(const CommitPipeline&) = delete;
+
+  /// Get the process-wide pipeline, starting the dedicated commit thread
+  /// on first use. One pipeline suffices: TxnContext admits one writer.
+  static CommitPipeline& Get();
+
+  /// Queue \p op for durable commit and return its sequence number; the
+  /// caller may publish the corresponding in-memory version to readers
+  /// immediately. State op captures by reference must stay valid until
+  /// the returned sequence number is durable.
+  uint64_t Submit(Op op);
+
+  /// Convenience wrapper queueing pg->Commit. The pipeline shares
+  /// ownership of \p pg until the commit runs; \p txn_ctx must outlive
+  /// it.
+  uint64_t Submit(
+      std::shared_ptr<PropertyGraph> pg, std::string command_line,
+      katana::TxnContext* txn_ctx);
+
+  /// Highest sequence number acknowledged by storage. Everything at or
+  /// below it is durable.
+  uint64_t DurableWatermark();
+
+  /// Block until \p seq is durable. If the commit covering \p seq failed
+  /// and no later submission has succeeded, returns that error; a later
+  /// successful commit supersedes earlier failures because each commit
+  /// writes the full state.
+  katana::Result<void> WaitForDurable(uint64_t seq);
+
+  /// Block until everything submitted so far is durable (or has failed).
+  katana::Result<void> Flush();
+
+  /// Number of commits submitted but not yet attempted; exposed for
+  /// tests and stats.
+  size_t NumPending();
+
+private:
+  CommitPipeline();
+
+  /// Body of the dedicated thread; drains the whole queue each wakeup
+  /// and runs only the newest op. Runs until process exit.
+  void Run();
+
+  struct PendingCommit {
+    uint64_t seq;
+    Op op;
+  };
+
+  std::mutex lock_;
+  std::condition_variable work_ready_;
+  std::condition_variable commit_done_;
+  std::deque<PendingCommit> pending_;
+  uint64_t next_seq_{1};
+  /// Highest seq attempted, durable or not.
+  uint64_t completed_seq_{0};
+  uint64_t durable_seq_{0};
+  /// Error from the newest failed batch; meaningful for seqs in
+  /// (durable_seq_, completed_seq_].
+  katana::CopyableErrorInfo last_error_;
+};
+
+}  // namespace katana
+
+#endif
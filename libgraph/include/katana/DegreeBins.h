@@ -0,0 +1,138 @@
+#ifndef KATANA_LIBGRAPH_KATANA_DEGREEBINS_H_
+#define KATANA_LIBGRAPH_KATANA_DEGREEBINS_H_
+
+#include <array>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include "katana/GraphTopology.h"
+#include "katana/Loops.h"
+#include "katana/NUMAArray.h"
+#include "katana/ParallelSTL.h"
+#include "katana/Range.h"
+#include "katana/config.h"
+
+namespace katana {
+
+/// The nodes of a topology pre-binned by out-degree class.
+///
+/// A uniform operator over a skewed graph carries the degree
+/// distribution into every inner loop: tiny-degree nodes waste the
+/// vector lanes and branch predictions sized for the average, and hubs
+/// blow through the caches. Grouping the nodes by degree class lets
+/// each parallel loop run over nodes with similar trip counts, and lets
+/// the operator body be compiled once per class (see DoAllByDegreeBin).
+///
+/// Within a bin nodes stay in ascending id order, so the property
+/// access pattern of a bin sweep remains mostly sequential. Obtain a
+/// cached instance through PropertyGraph::BuildOrGetDegreeBins.
+class KATANA_EXPORT DegreeBins : public GraphTopologyTypes {
+public:
+  /// Bound of the hub bin; also the "no bound known" tag passed to
+  /// operators running outside any bin.
+  static constexpr uint32_t kUnbounded = std::numeric_limits<uint32_t>::max();
+
+  /// Inclusive upper out-degree of each bin. A node lands in the first
+  /// bin whose bound covers its degree: isolated nodes, then roughly
+  /// one-vector-register, one-cache-line and one-page worth of edges,
+  /// then hubs.
+  static constexpr std::array<uint32_t, 5> kBinMaxDegree = {
+      0, 4, 32, 256, kUnbounded};
+
+  static constexpr size_t kNumBins = kBinMaxDegree.size();
+
+  static constexpr uint32_t BinIndex(uint64_t degree) noexcept {
+    for (uint32_t bin = 0; bin + 1 < kNumBins; ++bin) {
+      if (degree <= kBinMaxDegree[bin]) {
+        return bin;
+      }
+    }
+    return kNumBins - 1;
+  }
+
+  static DegreeBins Make(const GraphTopology& topo) noexcept {
+    DegreeBins bins;
+    bins.num_edges_ = topo.NumEdges();
+    bins.nodes_.allocateInterleaved(topo.NumNodes());
+    ParallelSTL::iota(bins.nodes_.begin(), bins.nodes_.end(), Node{0});
+
+    // One-pass radix sort by bin index; stability keeps each bin in
+    // ascending node id order.
+    ParallelSTL::stable_sort_by_key(
+        bins.nodes_.begin(), bins.nodes_.end(), [&](Node n) {
+          return static_cast<uint8_t>(BinIndex(topo.OutDegree(n)));
+        });
+
+    std::vector<size_t> counts = ParallelSTL::histogram(
+        bins.nodes_.begin(), bins.nodes_.end(), kNumBins,
+        [&](Node n) { return BinIndex(topo.OutDegree(n)); });
+    bins.bin_offsets_[0] = 0;
+    for (size_t b = 0; b < kNumBins; ++b) {
+      bins.bin_offsets_[b + 1] = bins.bin_offsets_[b] + counts[b];
+    }
+    return bins;
+  }
+
+  /// Total nodes across all bins; with NumEdges, how the view cache
+  /// detects bins staled by a topology swap.
+  size_t NumNodes() const noexcept { return nodes_.size(); }
+  size_t NumEdges() const noexcept { return num_edges_; }
+
+  size_t BinSize(size_t bin) const noexcept {
+    return bin_offsets_[bin + 1] - bin_offsets_[bin];
+  }
+
+  /// Nodes of one bin, in ascending node id order.
+  StandardRange<const Node*> BinNodes(size_t bin) const noexcept {
+    return MakeStandardRange(
+        nodes_.data() + bin_offsets_[bin],
+        nodes_.data() + bin_offsets_[bin + 1]);
+  }
+
+private:
+  NUMAArray<Node> nodes_;
+  std::array<uint64_t, kNumBins + 1> bin_offsets_{};
+  uint64_t num_edges_{0};
+};
+
+namespace internal {
+
+template <typename Fn, size_t... Bins, typename... Traits>
+void
+DoAllByDegreeBinImpl(
+    const DegreeBins& bins, Fn& fn, std::index_sequence<Bins...>,
+    const Traits&... traits) {
+  (do_all(
+       iterate(bins.BinNodes(Bins)),
+       [&](const GraphTopologyTypes::Node& n) {
+         fn(n,
+            std::integral_constant<uint32_t, DegreeBins::kBinMaxDegree[Bins]>{});
+       },
+       traits...),
+   ...);
+}
+
+}  // end namespace internal
+
+/// Runs fn over every node, one do_all per degree bin.
+///
+/// fn is called as fn(node, degree_bound) where degree_bound is a
+/// std::integral_constant<uint32_t, B> carrying the bin's inclusive
+/// maximum out-degree (DegreeBins::kUnbounded for the hub bin). The
+/// operator body is therefore instantiated once per degree class, so
+/// degree-dependent decisions - whether to tile a node's edges, whether
+/// a scratch buffer fits on the stack - hoist out of the per-node path
+/// with if constexpr instead of branching on every node. Any do_all
+/// traits (steal, chunk_size, loopname, ...) are forwarded to each
+/// bin's loop.
+template <typename Fn, typename... Traits>
+void
+DoAllByDegreeBin(const DegreeBins& bins, Fn fn, const Traits&... traits) {
+  internal::DoAllByDegreeBinImpl(
+      bins, fn, std::make_index_sequence<DegreeBins::kNumBins>{}, traits...);
+}
+
+}  // end namespace katana
+
+#endif
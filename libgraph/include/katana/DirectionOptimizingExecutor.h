@@ -0,0 +1,183 @@
+#ifndef KATANA_LIBGRAPH_KATANA_DIRECTIONOPTIMIZINGEXECUTOR_H_
+#define KATANA_LIBGRAPH_KATANA_DIRECTIONOPTIMIZINGEXECUTOR_H_
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <utility>
+
+#include "katana/Bag.h"
+#include "katana/DynamicBitset.h"
+#include "katana/GraphTopology.h"
+#include "katana/Loops.h"
+#include "katana/Reduction.h"
+#include "katana/Statistics.h"
+#include "katana/config.h"
+
+namespace katana {
+
+/// The representation a DirectionOptimizingExecutor round runs in.
+enum class Direction {
+  kPush,  ///< iterate the sparse frontier, scatter along out-edges
+  kPull,  ///< iterate all nodes, gather along in-edges
+};
+
+/// Round driver for frontier-based analytics that picks push or pull
+/// per round instead of once per Plan.
+///
+/// This generalizes the direction-switch machinery of BFS
+/// SynchronousDirectOpt: the executor owns the frontier in both
+/// representations (a sparse worklist for push rounds, a bitset for
+/// pull rounds), keeps the per-round occupancy and degree counters the
+/// cost model needs, and hands each round to the caller with the chosen
+/// Direction. The caller's round body iterates FrontierBag() in push
+/// rounds or tests InFrontier() from a whole-graph loop in pull rounds,
+/// and reports next-round activity through Activate().
+///
+/// The cost model is the classic scout-count heuristic: a round pushes
+/// while the frontier's accumulated out-degree stays under
+/// remaining_edges / alpha, switches to pull when the frontier's edge
+/// footprint approaches the cost of one dense sweep, and returns to
+/// push once the frontier both shrinks and drops under
+/// num_nodes / beta. Both representations are maintained incrementally
+/// on Activate, so switching direction never pays a conversion pass.
+///
+/// GraphView must expose NumNodes, NumEdges and OutDegree; edge
+/// iteration happens entirely in the caller's round body, so
+/// bidirectional views are only needed if the caller actually pulls
+/// over in-edges.
+template <typename GraphView>
+class DirectionOptimizingExecutor {
+public:
+  using Node = GraphTopologyTypes::Node;
+
+  // Same thresholds as BfsPlan; they transfer to other frontier
+  // analytics because they compare edge work, not algorithm specifics.
+  static constexpr uint32_t kDefaultAlpha = 15;
+  static constexpr uint32_t kDefaultBeta = 18;
+
+  DirectionOptimizingExecutor(
+      const GraphView& view, uint32_t alpha = kDefaultAlpha,
+      uint32_t beta = kDefaultBeta)
+      : view_(view),
+        alpha_(alpha),
+        beta_(beta),
+        frontier_(std::make_unique<InsertBag<Node>>()),
+        next_frontier_(std::make_unique<InsertBag<Node>>()) {
+    frontier_bits_.resize(view.NumNodes());
+    next_bits_.resize(view.NumNodes());
+    edges_to_check_ = view.NumEdges();
+  }
+
+  /// Marks a node active for the first round. Call before Execute.
+  void ActivateSeed(Node n) { Activate(n); }
+
+  /// Marks a node active for the next round. Thread-safe; duplicate
+  /// activations of the same node are collapsed. Counts the node's
+  /// out-degree into the scout counter the cost model reads.
+  void Activate(Node n) {
+    if (!next_bits_.set(n)) {
+      next_frontier_->push(n);
+      next_size_ += 1;
+      next_out_degree_ += view_.OutDegree(n);
+    }
+  }
+
+  /// Sparse frontier of the current round; iterate this in push rounds.
+  const InsertBag<Node>& FrontierBag() const { return *frontier_; }
+
+  /// Membership test against the current round's frontier; use this
+  /// from whole-graph loops in pull rounds.
+  bool InFrontier(Node n) const { return frontier_bits_.test(n); }
+
+  /// Active nodes entering the current round.
+  uint64_t FrontierSize() const { return frontier_size_; }
+
+  size_t rounds() const { return rounds_; }
+
+  /// Runs round_fn(Direction) until no node is activated or max_rounds
+  /// is hit. The executor swaps frontiers and re-evaluates the cost
+  /// model between rounds.
+  template <typename RoundFn>
+  void Execute(
+      RoundFn&& round_fn,
+      size_t max_rounds = std::numeric_limits<size_t>::max()) {
+    PromoteNextFrontier();
+
+    while (frontier_size_ != 0 && rounds_ < max_rounds) {
+      const Direction dir = ChooseDirection();
+      if (dir == Direction::kPush) {
+        edges_to_check_ -= std::min(frontier_out_degree_, edges_to_check_);
+        push_rounds_ += 1;
+      } else {
+        pull_rounds_ += 1;
+      }
+
+      round_fn(dir);
+
+      last_direction_ = dir;
+      last_size_ = frontier_size_;
+      rounds_ += 1;
+      PromoteNextFrontier();
+    }
+
+    katana::ReportStatSingle(
+        "DirectionOptimizingExecutor", "PushRounds", push_rounds_);
+    katana::ReportStatSingle(
+        "DirectionOptimizingExecutor", "PullRounds", pull_rounds_);
+  }
+
+private:
+  Direction ChooseDirection() const {
+    if (last_direction_ == Direction::kPull) {
+      // Hysteresis: keep pulling while the frontier is still growing or
+      // occupies more than 1/beta of the nodes.
+      if (frontier_size_ >= last_size_ ||
+          frontier_size_ > view_.NumNodes() / beta_) {
+        return Direction::kPull;
+      }
+    }
+    if (frontier_out_degree_ > edges_to_check_ / alpha_) {
+      return Direction::kPull;
+    }
+    return Direction::kPush;
+  }
+
+  void PromoteNextFrontier() {
+    std::swap(frontier_, next_frontier_);
+    next_frontier_->clear_and_keep_capacity();
+    std::swap(frontier_bits_, next_bits_);
+    next_bits_.reset();
+
+    frontier_size_ = next_size_.reduce();
+    frontier_out_degree_ = next_out_degree_.reduce();
+    next_size_.reset();
+    next_out_degree_.reset();
+  }
+
+  const GraphView& view_;
+  const uint32_t alpha_;
+  const uint32_t beta_;
+
+  std::unique_ptr<InsertBag<Node>> frontier_;
+  std::unique_ptr<InsertBag<Node>> next_frontier_;
+  DynamicBitset frontier_bits_;
+  DynamicBitset next_bits_;
+
+  GAccumulator<uint64_t> next_size_;
+  GAccumulator<uint64_t> next_out_degree_;
+
+  uint64_t frontier_size_{0};
+  uint64_t frontier_out_degree_{0};
+  uint64_t last_size_{0};
+  uint64_t edges_to_check_{0};
+  Direction last_direction_{Direction::kPush};
+
+  size_t rounds_{0};
+  uint64_t push_rounds_{0};
+  uint64_t pull_rounds_{0};
+};
+
+}  // namespace katana
+
+#endif
@@ -0,0 +1,43 @@
+#ifndef KATANA_LIBGRAPH_KATANA_EDGELISTIMPORT_H_
+#define KATANA_LIBGRAPH_KATANA_EDGELISTIMPORT_H_
+
+#include <string>
+
+#include "katana/BuildGraph.h"
+#include "katana/config.h"
+
+namespace katana {
+
+/// Input format for ConvertEdgeList.
+enum class EdgeListFormat {
+  /// One edge per line: <src><delim><dst>[<delim><property>...]. The
+  /// delimiter is a comma; blank lines and lines starting with '#' or '%'
+  /// are skipped. A first line whose source field is not an integer is
+  /// treated as a header naming the property columns.
+  kCsv,
+  /// One JSON object per line. The source id is read from "src" or
+  /// "source", the destination from "dst", "dest" or "target"; all other
+  /// fields become edge properties.
+  kJsonl,
+};
+
+/// ConvertEdgeList converts a CSV or JSONL edge list into katana form
+/// using all active threads. The file is split on line boundaries, chunks
+/// are parsed by parallel workers, and the CSR topology is assembled with
+/// a two-pass degree count. Edge property types are inferred from the
+/// values (int64, double, boolean, then string in order of preference).
+///
+/// Node ids must be non-negative integers; the node id space is
+/// [0, max id]. The whole file is held in memory during conversion.
+///
+/// \param infilename Path to the source edge list
+/// \param format Whether lines are CSV fields or JSON objects
+/// \param verbose If true, print progress to the standard out
+/// \returns A collection of Arrow tables of edge properties and CSR
+///     topology, suitable for WritePropertyGraph
+KATANA_EXPORT Result<GraphComponents> ConvertEdgeList(
+    const std::string& infilename, EdgeListFormat format, bool verbose = false);
+
+}  // namespace katana
+
+#endif
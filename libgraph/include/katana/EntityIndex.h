@@ -1,6 +1,7 @@
 #ifndef KATANA_LIBGRAPH_KATANA_ENTITYINDEX_H_
 #define KATANA_LIBGRAPH_KATANA_ENTITYINDEX_H_
 
+#include <algorithm>
 #include <set>
 #include <string>
 #include <variant>
@@ -11,6 +12,8 @@
 #include <boost/iterator/iterator_categories.hpp>
 #include <boost/iterator/iterator_facade.hpp>
 
+#include "katana/NUMAArray.h"
+#include "katana/Range.h"
 #include "katana/Result.h"
 #include "katana/config.h"
 
@@ -107,6 +110,38 @@ public:
   // `key`.
   iterator UpperBound(c_type key) { return iterator(set_.upper_bound(key)); }
 
+  // Iterator over the value-sorted id array. Random access, so ranges built
+  // from it divide evenly across threads.
+  using sorted_iterator = const node_or_edge*;
+
+  // Returns the ids of all entities whose property value lies in
+  // [low, high), ordered by value. The ids are contiguous in memory, so the
+  // result can be passed to katana::do_all directly instead of scanning
+  // every entity.
+  StandardRange<sorted_iterator> Range(c_type low, c_type high) {
+    return MakeStandardRange(SortedLowerBound(low), SortedLowerBound(high));
+  }
+
+  // Returns the first position in the sorted id array whose property value
+  // is greater than or equal to `key`.
+  sorted_iterator SortedLowerBound(c_type key) {
+    return std::lower_bound(
+        sorted_ids_.begin(), sorted_ids_.end(), key,
+        [&](node_or_edge id, c_type k) {
+          return std::less<c_type>{}(property_->Value(id), k);
+        });
+  }
+
+  // Returns the first position in the sorted id array whose property value
+  // is greater than `key`.
+  sorted_iterator SortedUpperBound(c_type key) {
+    return std::upper_bound(
+        sorted_ids_.begin(), sorted_ids_.end(), key,
+        [&](c_type k, node_or_edge id) {
+          return std::less<c_type>{}(k, property_->Value(id));
+        });
+  }
+
 private:
   class PropertyCompare {
   public:
@@ -139,6 +174,7 @@ private:
 
   size_t num_entities_;
   std::shared_ptr<ArrowArrayType> property_;
+  NUMAArray<node_or_edge> sorted_ids_;
   std::multiset<set_key_type, PropertyCompare> set_;
 };
 
@@ -190,6 +226,33 @@ public:
     return iterator(set_.upper_bound(&key));
   }
 
+  // Iterator over the value-sorted id array. Random access, so ranges built
+  // from it divide evenly across threads.
+  using sorted_iterator = const node_or_edge*;
+
+  // Returns the ids of all entities whose property value lies in
+  // [low, high), ordered by value; suitable for katana::do_all.
+  StandardRange<sorted_iterator> Range(
+      std::string_view low, std::string_view high) {
+    return MakeStandardRange(SortedLowerBound(low), SortedLowerBound(high));
+  }
+
+  // Returns the first position in the sorted id array whose property value
+  // is greater than or equal to `key`.
+  sorted_iterator SortedLowerBound(std::string_view key) {
+    return std::lower_bound(
+        sorted_ids_.begin(), sorted_ids_.end(), key,
+        [&](node_or_edge id, std::string_view k) { return View(id) < k; });
+  }
+
+  // Returns the first position in the sorted id array whose property value
+  // is greater than `key`.
+  sorted_iterator SortedUpperBound(std::string_view key) {
+    return std::upper_bound(
+        sorted_ids_.begin(), sorted_ids_.end(), key,
+        [&](std::string_view k, node_or_edge id) { return k < View(id); });
+  }
+
 private:
   class StringCompare {
   public:
@@ -220,8 +283,14 @@ private:
   Result<void> BuildFromProperty() override;
   // virtual Result<void> BuildFromFile(...) override;
 
+  std::string_view View(node_or_edge id) const {
+    arrow::util::string_view arrow_view = property_->GetView(id);
+    return std::string_view(arrow_view.data(), arrow_view.length());
+  }
+
   size_t num_entities_;
   std::shared_ptr<arrow::LargeStringArray> property_;
+  NUMAArray<node_or_edge> sorted_ids_;
   std::multiset<set_key_type, StringCompare> set_;
 };  // namespace katana
 
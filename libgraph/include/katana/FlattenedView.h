@@ -0,0 +1,149 @@
+#ifndef KATANA_LIBGRAPH_KATANA_FLATTENEDVIEW_H_
+#define KATANA_LIBGRAPH_KATANA_FLATTENEDVIEW_H_
+
+#include <tuple>
+#include <utility>
+
+#include "katana/Loops.h"
+#include "katana/NUMAArray.h"
+#include "katana/Properties.h"
+#include "katana/PropertyGraph.h"
+#include "katana/PropertyViews.h"
+#include "katana/Result.h"
+#include "katana/Traits.h"
+
+namespace katana {
+
+namespace internal {
+
+template <typename PropTuple>
+struct FlattenedArrays;
+
+template <typename... Props>
+struct FlattenedArrays<std::tuple<Props...>> {
+  using type = std::tuple<NUMAArray<PropertyValueType<Props>>...>;
+};
+
+}  // namespace internal
+
+/// A structure-of-arrays copy of a graph's node properties.
+///
+/// TypedPropertyGraph reads each property through an arrow-backed view,
+/// which costs an index translation and a view indirection per access and
+/// keeps the compiler from seeing a plain array. For inner loops that hammer
+/// a few columns (e.g. the distance updates in sssp), FlattenedView
+/// materializes the accessed columns into contiguous NUMAArrays once, keyed
+/// directly by node id, so GetData compiles down to raw pointer arithmetic.
+/// Call WriteBack() after the algorithm to copy modified values into the
+/// underlying properties; only values that actually changed are written, so
+/// read-mostly columns do not dirty pages.
+///
+/// Only POD properties (\ref PODProperty and friends) can be flattened:
+/// the copy-in/copy-out passes assign property values by reference.
+///
+/// \tparam NodeProps A tuple of node property types, as for
+/// TypedPropertyGraph
+template <typename NodeProps>
+class FlattenedView {
+  using NodeView = PropertyViewTuple<NodeProps>;
+  using Arrays = typename internal::FlattenedArrays<NodeProps>::type;
+
+  PropertyGraph* pg_;
+  NodeView node_view_;
+  Arrays arrays_;
+
+  FlattenedView(PropertyGraph* pg, NodeView node_view)
+      : pg_(pg), node_view_(std::move(node_view)) {}
+
+  template <size_t I>
+  void CopyColumnIn() {
+    auto& view = std::get<I>(node_view_);
+    auto& array = std::get<I>(arrays_);
+    array.allocateInterleaved(pg_->NumNodes());
+    katana::do_all(
+        katana::iterate(*pg_),
+        [&](const GraphTopology::Node& node) {
+          array[node] = view.GetValue(pg_->GetNodePropertyIndex(node));
+        },
+        katana::no_stats());
+  }
+
+  template <size_t I>
+  void CopyColumnOut() {
+    const auto& array = std::get<I>(arrays_);
+    auto& view = std::get<I>(node_view_);
+    katana::do_all(
+        katana::iterate(*pg_),
+        [&](const GraphTopology::Node& node) {
+          auto& value = view.GetValue(pg_->GetNodePropertyIndex(node));
+          if (value != array[node]) {
+            value = array[node];
+          }
+        },
+        katana::no_stats());
+  }
+
+  template <size_t... I>
+  void CopyIn(std::index_sequence<I...>) {
+    (CopyColumnIn<I>(), ...);
+  }
+
+  template <size_t... I>
+  void CopyOut(std::index_sequence<I...>) {
+    (CopyColumnOut<I>(), ...);
+  }
+
+  static constexpr auto Indices() {
+    return std::make_index_sequence<std::tuple_size_v<NodeProps>>();
+  }
+
+public:
+  using Node = GraphTopology::Node;
+
+  /// Gets the node data from the flattened column.
+  ///
+  /// @param node node to get the data of
+  /// @returns reference to the node data
+  template <typename NodeIndex>
+  PropertyValueType<NodeIndex>& GetData(const Node& node) {
+    constexpr size_t prop_col_index = find_trait<NodeIndex, NodeProps>();
+    return std::get<prop_col_index>(arrays_)[node];
+  }
+
+  template <typename NodeIndex>
+  const PropertyValueType<NodeIndex>& GetData(const Node& node) const {
+    constexpr size_t prop_col_index = find_trait<NodeIndex, NodeProps>();
+    return std::get<prop_col_index>(arrays_)[node];
+  }
+
+  /// Raw pointer to a flattened column, indexed by node id.
+  template <typename NodeIndex>
+  PropertyValueType<NodeIndex>* Data() {
+    constexpr size_t prop_col_index = find_trait<NodeIndex, NodeProps>();
+    return std::get<prop_col_index>(arrays_).data();
+  }
+
+  size_t size() const { return pg_->NumNodes(); }
+
+  /// Copy values that changed since Make() back into the underlying
+  /// properties.
+  void WriteBack() { CopyOut(Indices()); }
+
+  /// Materialize the named node properties of \p pg into contiguous arrays.
+  static Result<FlattenedView<NodeProps>> Make(
+      PropertyGraph* pg, const std::vector<std::string>& node_properties) {
+    auto node_view_result =
+        internal::MakeNodePropertyViews<NodeProps>(pg, node_properties);
+    if (!node_view_result) {
+      return node_view_result.error();
+    }
+
+    FlattenedView view(pg, std::move(node_view_result.value()));
+    view.CopyIn(Indices());
+    return std::move(view);
+  }
+};
+
+}  // namespace katana
+
+#endif
@@ -34,6 +34,23 @@ KATANA_EXPORT katana::Result<katana::GraphComponents> ConvertGraphML(
 KATANA_EXPORT katana::Result<katana::GraphComponents> ConvertGraphML(
     xmlTextReaderPtr reader, size_t chunk_size = 25000, bool verbose = false);
 
+/// ConvertGraphMLParallel converts a GraphML file into katana form using
+/// all active threads. The file is split on element boundaries and the
+/// chunks are parsed by parallel workers, each with its own libxml2
+/// reader; the parsed records are then fed to the graph builder in
+/// document order. Inputs the splitter cannot handle fall back to the
+/// serial converter. The whole file is held in memory during conversion.
+///
+/// \param infilename Path to source graphml file
+/// \param chunk_size Chunk size for in memory representations during conversion
+/// \param verbose If true, print graph data to the standard out while
+///     converting.
+/// \returns A collection of Arrow tables of node properties/labels, edge
+///     properties/types, and CSR topology
+KATANA_EXPORT katana::Result<katana::GraphComponents> ConvertGraphMLParallel(
+    const std::string& infilename, size_t chunk_size = 25000,
+    bool verbose = false);
+
 }  // end namespace katana
 
 #endif
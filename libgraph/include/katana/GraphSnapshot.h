@@ -0,0 +1,37 @@
+#ifndef KATANA_LIBGRAPH_KATANA_GRAPHSNAPSHOT_H_
+#define KATANA_LIBGRAPH_KATANA_GRAPHSNAPSHOT_H_
+
+/// Flat binary snapshots of in-memory PropertyGraph state.
+///
+/// A snapshot is one file holding the raw topology arrays, entity type
+/// arrays, and the property tables as Arrow IPC streams, preceded by a
+/// JSON manifest of section offsets. Writing dumps the arrays with
+/// parallel pwrite; loading mmaps the file, copies the NUMA arrays back
+/// in parallel, and adopts the property buffers zero-copy from the
+/// mapping — no Parquet decode and no Arrow reconstruction.
+///
+/// Snapshots are a failover fast path, not a storage format: they are
+/// tied to the host byte order and make no compatibility promises
+/// across versions. The RDG remains the durable representation.
+///
+/// \file
+
+#include <memory>
+#include <string>
+
+#include "katana/PropertyGraph.h"
+#include "katana/Result.h"
+
+namespace katana {
+
+/// Write a snapshot of \param pg to the local file \param path.
+KATANA_EXPORT Result<void> WriteGraphSnapshot(
+    const PropertyGraph& pg, const std::string& path);
+
+/// Restore a PropertyGraph from a snapshot written by WriteGraphSnapshot.
+KATANA_EXPORT Result<std::unique_ptr<PropertyGraph>> LoadGraphSnapshot(
+    const std::string& path, katana::TxnContext* txn_ctx);
+
+}  // namespace katana
+
+#endif
@@ -1,7 +1,12 @@
 #ifndef KATANA_LIBGRAPH_KATANA_GRAPHTOPOLOGY_H_
 #define KATANA_LIBGRAPH_KATANA_GRAPHTOPOLOGY_H_
 
+#include <atomic>
+#include <limits>
 #include <memory>
+#include <mutex>
+#include <type_traits>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -10,6 +15,7 @@
 #include "arrow/util/bitmap.h"
 #include "katana/CompileTimeIntrospection.h"
 #include "katana/DynamicBitset.h"
+#include "katana/ErrorCode.h"
 #include "katana/Iterators.h"
 #include "katana/Logging.h"
 #include "katana/NUMAArray.h"
@@ -121,7 +127,7 @@ public:
   /// \param node node to get the edge range of
   /// \returns iterable edge range for node.
   edges_range OutEdges(Node node) const noexcept {
-    KATANA_LOG_DEBUG_ASSERT(node <= adj_indices_.size());
+    KATANA_HOT_ASSERT(node <= adj_indices_.size());
     edge_iterator e_beg{node > 0 ? adj_indices_[node - 1] : 0};
     edge_iterator e_end{adj_indices_[node]};
 
@@ -129,7 +135,7 @@ public:
   }
 
   Node OutEdgeDst(Edge edge_id) const noexcept {
-    KATANA_LOG_DEBUG_ASSERT(edge_id < dests_.size());
+    KATANA_HOT_ASSERT(edge_id < dests_.size());
     return dests_[edge_id];
   }
 
@@ -243,6 +249,418 @@ private:
   PropIndexVec node_prop_indices_;
 };
 
+/// A compact, read-only CSR copy of a GraphTopology that stores adjacency
+/// offsets using a narrower integer type than GraphTopologyTypes::Edge.
+///
+/// Most partitions we process have fewer than 2^32 edges, so the usual 64-bit
+/// adj_indices array wastes half of its bits and, more importantly, half of
+/// every cache line touched by the OutEdges() fast path. Building a
+/// NarrowGraphTopologyView and iterating it instead of the source topology
+/// roughly halves the offset-array footprint for such graphs.
+///
+/// The view owns its arrays; it does not keep a pointer to the source
+/// topology (see the note above about movable PropertyGraph).
+template <typename AdjIndexTy>
+class NarrowGraphTopologyView : public GraphTopologyTypes {
+  static_assert(
+      std::is_unsigned<AdjIndexTy>::value &&
+          sizeof(AdjIndexTy) < sizeof(GraphTopologyTypes::Edge),
+      "NarrowGraphTopologyView only makes sense for unsigned types narrower "
+      "than GraphTopologyTypes::Edge");
+
+public:
+  NarrowGraphTopologyView() = default;
+  NarrowGraphTopologyView(NarrowGraphTopologyView&&) = default;
+  NarrowGraphTopologyView& operator=(NarrowGraphTopologyView&&) = default;
+
+  NarrowGraphTopologyView(const NarrowGraphTopologyView&) = delete;
+  NarrowGraphTopologyView& operator=(const NarrowGraphTopologyView&) = delete;
+
+  /// Build a narrow copy of topo. Fails with ErrorCode::InvalidArgument if
+  /// the number of edges does not fit in AdjIndexTy.
+  static Result<NarrowGraphTopologyView> Make(const GraphTopology& topo) {
+    if (topo.NumEdges() > std::numeric_limits<AdjIndexTy>::max()) {
+      return KATANA_ERROR(
+          ErrorCode::InvalidArgument,
+          "topology has {} edges which does not fit in a {}-bit adjacency "
+          "index",
+          topo.NumEdges(), sizeof(AdjIndexTy) * 8);
+    }
+
+    NarrowGraphTopologyView ret;
+    ret.adj_indices_.allocateInterleaved(topo.NumNodes());
+    ret.dests_.allocateInterleaved(topo.NumEdges());
+
+    const Edge* wide_adj = topo.AdjData();
+    katana::do_all(
+        katana::iterate(topo.Nodes()),
+        [&](Node n) {
+          ret.adj_indices_[n] = static_cast<AdjIndexTy>(wide_adj[n]);
+        },
+        katana::no_stats());
+
+    const Node* wide_dests = topo.DestData();
+    katana::do_all(
+        katana::iterate(topo.OutEdges()),
+        [&](Edge e) { ret.dests_[e] = wide_dests[e]; }, katana::no_stats());
+
+    return Result<NarrowGraphTopologyView>(std::move(ret));
+  }
+
+  uint64_t NumNodes() const noexcept { return adj_indices_.size(); }
+
+  uint64_t NumEdges() const noexcept { return dests_.size(); }
+
+  const AdjIndexTy* AdjData() const noexcept { return adj_indices_.data(); }
+
+  const Node* DestData() const noexcept { return dests_.data(); }
+
+  edges_range OutEdges() const noexcept {
+    return MakeStandardRange<edge_iterator>(Edge{0}, Edge{NumEdges()});
+  }
+
+  edges_range OutEdges(Node node) const noexcept {
+    KATANA_HOT_ASSERT(node <= adj_indices_.size());
+    edge_iterator e_beg{node > 0 ? Edge{adj_indices_[node - 1]} : Edge{0}};
+    edge_iterator e_end{Edge{adj_indices_[node]}};
+
+    return MakeStandardRange(e_beg, e_end);
+  }
+
+  Node OutEdgeDst(Edge edge_id) const noexcept {
+    KATANA_HOT_ASSERT(edge_id < dests_.size());
+    return dests_[edge_id];
+  }
+
+  size_t OutDegree(Node node) const noexcept { return OutEdges(node).size(); }
+
+  nodes_range Nodes() const noexcept {
+    return MakeStandardRange<node_iterator>(
+        Node{0}, static_cast<Node>(NumNodes()));
+  }
+
+private:
+  NUMAArray<AdjIndexTy> adj_indices_;
+  NUMAArray<Node> dests_;
+};
+
+/// The common case: 32-bit adjacency offsets for partitions with fewer than
+/// 2^32 edges.
+using Narrow32GraphTopologyView = NarrowGraphTopologyView<uint32_t>;
+
+/// A non-owning, trivially copyable CSR view over a topology's raw arrays.
+///
+/// The layered view wrappers reach the adjacency arrays through a
+/// shared_ptr-held topology object that also carries virtual state queries;
+/// in some analytics kernels that indirection keeps OutEdgeDst() from
+/// inlining. FlatCsrView captures the two raw array pointers once, so its
+/// accessors compile down to plain array indexing -- the same codegen as a
+/// hand-written raw-array loop. Capture one before a hot loop and iterate it
+/// instead of the wrapper.
+///
+/// The view borrows the arrays: it must not outlive the topology it was made
+/// from and goes stale if cached topologies are dropped.
+class FlatCsrView : public GraphTopologyTypes {
+public:
+  FlatCsrView() = default;
+
+  explicit FlatCsrView(const GraphTopology& topo) noexcept
+      : adj_indices_(topo.AdjData()),
+        dests_(topo.DestData()),
+        num_nodes_(topo.NumNodes()),
+        num_edges_(topo.NumEdges()) {}
+
+  uint64_t NumNodes() const noexcept { return num_nodes_; }
+
+  uint64_t NumEdges() const noexcept { return num_edges_; }
+
+  const Edge* AdjData() const noexcept { return adj_indices_; }
+
+  const Node* DestData() const noexcept { return dests_; }
+
+  edges_range OutEdges() const noexcept {
+    return MakeStandardRange<edge_iterator>(Edge{0}, Edge{num_edges_});
+  }
+
+  edges_range OutEdges(Node node) const noexcept {
+    KATANA_HOT_ASSERT(node <= num_nodes_);
+    edge_iterator e_beg{node > 0 ? adj_indices_[node - 1] : Edge{0}};
+    edge_iterator e_end{adj_indices_[node]};
+
+    return MakeStandardRange(e_beg, e_end);
+  }
+
+  Node OutEdgeDst(Edge edge_id) const noexcept {
+    KATANA_HOT_ASSERT(edge_id < num_edges_);
+    return dests_[edge_id];
+  }
+
+  size_t OutDegree(Node node) const noexcept { return OutEdges(node).size(); }
+
+  nodes_range Nodes() const noexcept {
+    return MakeStandardRange<node_iterator>(
+        Node{0}, static_cast<Node>(num_nodes_));
+  }
+
+private:
+  const Edge* adj_indices_{nullptr};
+  const Node* dests_{nullptr};
+  uint64_t num_nodes_{0};
+  uint64_t num_edges_{0};
+};
+
+/// A compressed, read-only adjacency representation of a GraphTopology.
+///
+/// Destinations are stored per node as zig-zag varint deltas from the
+/// previous destination, preceded by a varint degree, so graphs whose
+/// adjacency lists are sorted by destination compress to a few bits per
+/// edge. Iteration decodes sequentially; for graphs that would otherwise
+/// spill out of a NUMA node the sequential decode is cheaper than the DRAM
+/// misses paid on a raw destination array.
+///
+/// The view owns its arrays and shares no state with the source topology.
+class KATANA_EXPORT CompressedGraphTopologyView : public GraphTopologyTypes {
+public:
+  CompressedGraphTopologyView() = default;
+  CompressedGraphTopologyView(CompressedGraphTopologyView&&) = default;
+  CompressedGraphTopologyView& operator=(CompressedGraphTopologyView&&) =
+      default;
+
+  CompressedGraphTopologyView(const CompressedGraphTopologyView&) = delete;
+  CompressedGraphTopologyView& operator=(const CompressedGraphTopologyView&) =
+      delete;
+
+  /// Decode-on-iterate cursor over the destinations of one node.
+  class DecodingEdgeIterator {
+  public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = Node;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const Node*;
+    using reference = Node;
+
+    DecodingEdgeIterator(const uint8_t* cursor, size_t remaining) noexcept
+        : cursor_(cursor), remaining_(remaining) {
+      if (remaining_ > 0) {
+        Advance();
+      }
+    }
+
+    Node operator*() const noexcept { return current_; }
+
+    DecodingEdgeIterator& operator++() noexcept {
+      if (--remaining_ > 0) {
+        Advance();
+      }
+      return *this;
+    }
+
+    bool operator==(const DecodingEdgeIterator& that) const noexcept {
+      return remaining_ == that.remaining_;
+    }
+
+    bool operator!=(const DecodingEdgeIterator& that) const noexcept {
+      return !(*this == that);
+    }
+
+  private:
+    void Advance() noexcept {
+      uint64_t delta = DecodeVarInt(&cursor_);
+      // zig-zag decode: deltas can be negative for unsorted adjacencies
+      int64_t signed_delta =
+          static_cast<int64_t>(delta >> 1) ^ -static_cast<int64_t>(delta & 1);
+      current_ = static_cast<Node>(static_cast<int64_t>(current_) +
+                                   signed_delta);
+    }
+
+    const uint8_t* cursor_{nullptr};
+    size_t remaining_{0};
+    Node current_{0};
+  };
+
+  using decoded_edges_range = StandardRange<DecodingEdgeIterator>;
+
+  /// Build a compressed copy of topo.
+  static CompressedGraphTopologyView Make(const GraphTopology& topo) noexcept;
+
+  uint64_t NumNodes() const noexcept {
+    return offsets_.empty() ? 0 : offsets_.size() - 1;
+  }
+
+  uint64_t NumEdges() const noexcept { return num_edges_; }
+
+  /// Bytes used by the encoded destination arrays; compare against
+  /// NumEdges() * sizeof(Node) for the uncompressed footprint.
+  uint64_t NumAdjBytes() const noexcept { return bytes_.size(); }
+
+  size_t OutDegree(Node node) const noexcept {
+    KATANA_HOT_ASSERT(node + 1 < offsets_.size());
+    const uint8_t* cursor = &bytes_[offsets_[node]];
+    return DecodeVarInt(&cursor);
+  }
+
+  /// Gets out-edge destinations of some node as a decoding range.
+  decoded_edges_range OutEdges(Node node) const noexcept {
+    KATANA_HOT_ASSERT(node + 1 < offsets_.size());
+    const uint8_t* cursor = &bytes_[offsets_[node]];
+    size_t degree = DecodeVarInt(&cursor);
+    return MakeStandardRange(
+        DecodingEdgeIterator(cursor, degree), DecodingEdgeIterator(nullptr, 0));
+  }
+
+  nodes_range Nodes() const noexcept {
+    return MakeStandardRange<node_iterator>(
+        Node{0}, static_cast<Node>(NumNodes()));
+  }
+
+private:
+  static uint64_t DecodeVarInt(const uint8_t** cursor) noexcept {
+    uint64_t val = 0;
+    uint32_t shift = 0;
+    uint8_t byte;
+    do {
+      byte = *(*cursor)++;
+      val |= static_cast<uint64_t>(byte & 0x7F) << shift;
+      shift += 7;
+    } while ((byte & 0x80) != 0);
+    return val;
+  }
+
+  // offsets_[n] is the byte offset of node n's block; offsets_ has
+  // NumNodes() + 1 entries so block sizes need no separate array.
+  NUMAArray<uint64_t> offsets_;
+  NUMAArray<uint8_t> bytes_;
+  uint64_t num_edges_{0};
+};
+
+/// A segmented (blocked) CSR view that splits the 64-bit adj_indices array
+/// into per-block 64-bit bases plus per-node 32-bit relative offsets.
+///
+/// On power-law graphs the offset array dominates the cache traffic of the
+/// OutEdges(node) fast path: every lookup touches two 64-bit entries. With
+/// kBlockSize-node segments the per-node data shrinks to 4 bytes, doubling
+/// the offsets resident per cache line, while each block keeps one 64-bit
+/// base. Construction fails if any single block spans 2^32 or more edges
+/// (only possible when a kBlockSize-node window holds that many edges).
+///
+/// The view keeps a raw pointer to the source topology's destination array;
+/// it must not outlive the topology it was made from.
+class KATANA_EXPORT BlockedCSRTopologyView : public GraphTopologyTypes {
+public:
+  static constexpr Node kBlockSize = 1024;
+
+  BlockedCSRTopologyView() = default;
+  BlockedCSRTopologyView(BlockedCSRTopologyView&&) = default;
+  BlockedCSRTopologyView& operator=(BlockedCSRTopologyView&&) = default;
+
+  BlockedCSRTopologyView(const BlockedCSRTopologyView&) = delete;
+  BlockedCSRTopologyView& operator=(const BlockedCSRTopologyView&) = delete;
+
+  static Result<BlockedCSRTopologyView> Make(const GraphTopology& topo);
+
+  uint64_t NumNodes() const noexcept { return rel_offsets_.size(); }
+
+  uint64_t NumEdges() const noexcept { return num_edges_; }
+
+  edges_range OutEdges(Node node) const noexcept {
+    KATANA_HOT_ASSERT(node < rel_offsets_.size());
+    const Edge base = block_bases_[node / kBlockSize];
+    const Edge beg = (node % kBlockSize == 0)
+                         ? base
+                         : base + rel_offsets_[node - 1];
+    const Edge end = base + rel_offsets_[node];
+
+    return MakeStandardRange(edge_iterator{beg}, edge_iterator{end});
+  }
+
+  Node OutEdgeDst(Edge edge_id) const noexcept {
+    KATANA_HOT_ASSERT(edge_id < num_edges_);
+    return dests_[edge_id];
+  }
+
+  size_t OutDegree(Node node) const noexcept { return OutEdges(node).size(); }
+
+  nodes_range Nodes() const noexcept {
+    return MakeStandardRange<node_iterator>(
+        Node{0}, static_cast<Node>(NumNodes()));
+  }
+
+private:
+  // rel_offsets_[n] is adj_indices[n] - block_bases_[n / kBlockSize], i.e.
+  // the end of node n's edge range relative to the start of its block.
+  NUMAArray<uint32_t> rel_offsets_;
+  NUMAArray<Edge> block_bases_;
+  const Node* dests_{nullptr};
+  uint64_t num_edges_{0};
+};
+
+/// A hybrid CSR+COO view that materializes the per-edge source array for a
+/// GraphTopology.
+///
+/// Edge-parallel kernels (triangle counting, k-truss) that iterate
+/// OutEdges() of the whole graph currently recover the source of an edge
+/// with GraphTopology::GetEdgeSrc, a binary search over adj_indices. This
+/// view pays NumEdges() * sizeof(Node) once so GetEdgeSrc becomes a single
+/// array load in the inner loop.
+///
+/// The view keeps raw pointers into the source topology's arrays; it must
+/// not outlive the topology it was made from.
+class KATANA_EXPORT CSRCOOGraphTopologyView : public GraphTopologyTypes {
+public:
+  CSRCOOGraphTopologyView() = default;
+  CSRCOOGraphTopologyView(CSRCOOGraphTopologyView&&) = default;
+  CSRCOOGraphTopologyView& operator=(CSRCOOGraphTopologyView&&) = default;
+
+  CSRCOOGraphTopologyView(const CSRCOOGraphTopologyView&) = delete;
+  CSRCOOGraphTopologyView& operator=(const CSRCOOGraphTopologyView&) = delete;
+
+  /// Build the COO source array for topo in parallel.
+  static CSRCOOGraphTopologyView Make(const GraphTopology& topo) noexcept;
+
+  uint64_t NumNodes() const noexcept { return num_nodes_; }
+
+  uint64_t NumEdges() const noexcept { return srcs_.size(); }
+
+  /// O(1) edge source lookup; the whole point of this view.
+  Node GetEdgeSrc(const Edge& eid) const noexcept {
+    KATANA_HOT_ASSERT(eid < srcs_.size());
+    return srcs_[eid];
+  }
+
+  Node OutEdgeDst(Edge edge_id) const noexcept {
+    KATANA_HOT_ASSERT(edge_id < srcs_.size());
+    return dests_[edge_id];
+  }
+
+  /// Gets all out-edges; pair with GetEdgeSrc/OutEdgeDst for edge-parallel
+  /// iteration.
+  edges_range OutEdges() const noexcept {
+    return MakeStandardRange<edge_iterator>(Edge{0}, Edge{NumEdges()});
+  }
+
+  /// Node-centric iteration still works through the CSR half.
+  edges_range OutEdges(Node node) const noexcept {
+    KATANA_LOG_DEBUG_ASSERT(node < num_nodes_);
+    edge_iterator e_beg{node > 0 ? adj_indices_[node - 1] : 0};
+    edge_iterator e_end{adj_indices_[node]};
+
+    return MakeStandardRange(e_beg, e_end);
+  }
+
+  size_t OutDegree(Node node) const noexcept { return OutEdges(node).size(); }
+
+  nodes_range Nodes() const noexcept {
+    return MakeStandardRange<node_iterator>(
+        Node{0}, static_cast<Node>(NumNodes()));
+  }
+
+private:
+  NUMAArray<Node> srcs_;
+  const Edge* adj_indices_{nullptr};
+  const Node* dests_{nullptr};
+  uint64_t num_nodes_{0};
+};
+
 // TODO(amber): In the future, when we group properties e.g., by node or edge type,
 // this class might get merged with ShuffleTopology. Not doing it at the moment to
 // avoid having to keep unnecessary arrays like node_property_indices_
@@ -323,6 +741,22 @@ public:
     return FindEdge(src, dst) != OutEdges(src).end();
   }
 
+  /// Incrementally restores this topology's edge sort invariant for just
+  /// the given nodes after their adjacency lists were modified in place.
+  ///
+  /// Re-sorting only the touched lists keeps the topology valid without
+  /// the invalidate()-and-full-rebuild round trip that a small batch of
+  /// edge updates pays today. Nodes not listed are assumed untouched.
+  void ResortEdges(
+      const PropertyGraph* pg, const std::vector<Node>& nodes) noexcept;
+
+  /// Replaces the destination of out-edge eid of node src in place and
+  /// restores src's sort invariant.
+  /// \returns false if eid is not an out-edge of src
+  bool UpdateEdgeDst(
+      const PropertyGraph* pg, const Node& src, const Edge& eid,
+      const Node& new_dst) noexcept;
+
 protected:
   void SortEdgesByDestID() noexcept;
 
@@ -331,6 +765,10 @@ protected:
   void SortEdgesByDestType(
       const PropertyGraph* pg, const PropIndexVec& node_prop_indices) noexcept;
 
+  /// Re-sorts the adjacency list of a single node according to the current
+  /// edge_sort_state(). No-op when the state is kAny.
+  void SortNodeEdges(const PropertyGraph* pg, const Node& node) noexcept;
+
   void sortEdges(
       const PropertyGraph* pg,
       const RDGTopology::EdgeSortKind& edge_sort_todo) noexcept {
@@ -437,9 +875,14 @@ public:
   katana::Result<RDGTopology> ToRDGTopology() const;
 
 private:
-  template <typename CmpFunc>
+  /// KeyFn maps an old node id to an unsigned integral rank; nodes are
+  /// permuted into ascending rank order with a stable radix sort
+  /// (ParallelSTL::stable_sort_by_key), so ties keep ascending node id
+  /// order and topology builds avoid the comparison-sort that used to
+  /// dominate their profile.
+  template <typename KeyFn>
   static std::shared_ptr<ShuffleTopology> MakeNodeSortedTopo(
-      const EdgeShuffleTopology& seed_topo, const CmpFunc& cmp,
+      const EdgeShuffleTopology& seed_topo, const KeyFn& key_fn,
       const RDGTopology::NodeSortKind& node_sort_todo) {
     GraphTopology::PropIndexVec new_to_old;
     new_to_old.allocateInterleaved(seed_topo.NumNodes());
@@ -448,9 +891,9 @@ private:
         new_to_old.begin(), new_to_old.end(),
         GraphTopologyTypes::PropertyIndex{0});
 
-    katana::ParallelSTL::sort(
+    katana::ParallelSTL::stable_sort_by_key(
         new_to_old.begin(), new_to_old.end(),
-        [&](const auto& i1, const auto& i2) { return cmp(i1, i2); });
+        [&](const auto& i) { return key_fn(i); });
 
     GraphTopology::AdjIndexVec degrees;
     degrees.allocateInterleaved(seed_topo.NumNodes());
@@ -885,6 +1328,153 @@ private:
   AdjIndexVec per_type_adj_indices_;
 };
 
+/// A vertex-cut style decomposition of a GraphTopology that splits
+/// huge-degree hub nodes into bounded-size segments.
+///
+/// Power-law graphs hand a node-parallel loop a handful of hub nodes whose
+/// adjacency lists are orders of magnitude longer than the average,
+/// serializing whole rounds behind one thread. This view flattens the node
+/// range into Segments(): every node with OutDegree <= max_segment_size maps
+/// to one segment, hubs are cut into ceil(degree / max_segment_size)
+/// segments that can be processed by different threads, with the caller
+/// combining per-segment partial results for split nodes.
+///
+/// The view owns only the segment array; it must not outlive the topology
+/// it was made from.
+class KATANA_EXPORT HubSegmentedTopologyView : public GraphTopologyTypes {
+public:
+  static constexpr size_t kDefaultMaxSegmentSize = 1024;
+
+  /// A contiguous slice of one node's out-edges.
+  struct Segment {
+    Node node;
+    Edge edges_begin;
+    Edge edges_end;
+
+    edges_range OutEdges() const noexcept {
+      return MakeStandardRange(
+          edge_iterator{edges_begin}, edge_iterator{edges_end});
+    }
+  };
+
+  HubSegmentedTopologyView() = default;
+  HubSegmentedTopologyView(HubSegmentedTopologyView&&) = default;
+  HubSegmentedTopologyView& operator=(HubSegmentedTopologyView&&) = default;
+
+  HubSegmentedTopologyView(const HubSegmentedTopologyView&) = delete;
+  HubSegmentedTopologyView& operator=(const HubSegmentedTopologyView&) =
+      delete;
+
+  static HubSegmentedTopologyView Make(
+      const GraphTopology& topo,
+      size_t max_segment_size = kDefaultMaxSegmentSize) noexcept;
+
+  uint64_t NumSegments() const noexcept { return segments_.size(); }
+
+  const Segment& GetSegment(uint64_t i) const noexcept {
+    KATANA_LOG_DEBUG_ASSERT(i < segments_.size());
+    return segments_[i];
+  }
+
+  /// Iterable segment IDs, intended as the range of an edge-balanced
+  /// do_all in place of Nodes().
+  StandardRange<boost::counting_iterator<uint64_t>> Segments() const noexcept {
+    return MakeStandardRange<boost::counting_iterator<uint64_t>>(
+        uint64_t{0}, NumSegments());
+  }
+
+  /// @returns true iff node was cut into more than one segment
+  bool IsSplit(Node node) const noexcept {
+    return split_nodes_.test(node);
+  }
+
+private:
+  NUMAArray<Segment> segments_;
+  DynamicBitset split_nodes_;
+};
+
+/// A lazily materialized per-type alternative to EdgeTypeAwareTopology.
+///
+/// EdgeTypeAwareTopology eagerly builds NumNodes() * num_unique_types()
+/// adjacency boundaries up front, a whole-graph rebuild even when a query
+/// only ever touches one or two edge types. This view starts empty and
+/// materializes the per-node edge ranges of a type the first time that type
+/// is queried, by binary searching each node's type-sorted adjacency list.
+/// Materialized slices are cached for the lifetime of the view.
+///
+/// Requires a topology with edges sorted by type (kSortedByEdgeType). The
+/// view keeps a pointer to that topology; it must not outlive it.
+class KATANA_EXPORT LazyEdgeTypeAwareView : public GraphTopologyTypes {
+public:
+  LazyEdgeTypeAwareView(LazyEdgeTypeAwareView&&) = default;
+  LazyEdgeTypeAwareView& operator=(LazyEdgeTypeAwareView&&) = default;
+
+  LazyEdgeTypeAwareView(const LazyEdgeTypeAwareView&) = delete;
+  LazyEdgeTypeAwareView& operator=(const LazyEdgeTypeAwareView&) = delete;
+
+  static std::shared_ptr<LazyEdgeTypeAwareView> Make(
+      std::shared_ptr<const CondensedTypeIDMap> edge_type_index,
+      const EdgeShuffleTopology* sorted_topo) noexcept;
+
+  /// @param pg parent graph, used to materialize the slice on first query
+  /// @param node node to get edges for
+  /// @param edge_type edge_type to get edges of
+  /// @returns Range to edges of node that have edge type == edge_type
+  edges_range OutEdges(
+      const PropertyGraph* pg, Node node,
+      const EntityTypeID& edge_type) const noexcept {
+    const auto& slice = GetOrBuildSlice(pg, edge_type);
+    const auto& range = slice.ranges[node];
+    return MakeStandardRange(
+        edge_iterator{range.first}, edge_iterator{range.second});
+  }
+
+  size_t OutDegree(
+      const PropertyGraph* pg, Node node,
+      const EntityTypeID& edge_type) const noexcept {
+    return OutEdges(pg, node, edge_type).size();
+  }
+
+  /// @returns true iff the slice for edge_type has been materialized
+  bool IsMaterialized(const EntityTypeID& edge_type) const noexcept {
+    if (!edge_type_index_->has_edge_type_id(edge_type)) {
+      return false;
+    }
+    return slices_[edge_type_index_->GetIndex(edge_type)]->ready.load(
+        std::memory_order_acquire);
+  }
+
+  auto GetDistinctEdgeTypes() const noexcept {
+    return edge_type_index_->distinct_edge_type_ids();
+  }
+
+private:
+  struct Slice {
+    std::atomic<bool> ready{false};
+    NUMAArray<std::pair<Edge, Edge>> ranges;
+  };
+
+  LazyEdgeTypeAwareView(
+      std::shared_ptr<const CondensedTypeIDMap> edge_type_index,
+      const EdgeShuffleTopology* sorted_topo) noexcept
+      : edge_type_index_(std::move(edge_type_index)), topo_(sorted_topo) {
+    KATANA_LOG_DEBUG_ASSERT(edge_type_index_);
+    KATANA_LOG_DEBUG_ASSERT(topo_);
+    slices_.reserve(edge_type_index_->num_unique_types());
+    for (size_t i = 0; i < edge_type_index_->num_unique_types(); ++i) {
+      slices_.emplace_back(std::make_unique<Slice>());
+    }
+  }
+
+  const Slice& GetOrBuildSlice(
+      const PropertyGraph* pg, const EntityTypeID& edge_type) const noexcept;
+
+  std::shared_ptr<const CondensedTypeIDMap> edge_type_index_;
+  const EdgeShuffleTopology* topo_;
+  mutable std::vector<std::unique_ptr<Slice>> slices_;
+  mutable std::mutex build_lock_;
+};
+
 /****************************/
 /* Topology wrapper classes */
 /****************************/
@@ -926,6 +1516,11 @@ public:
 
   auto Nodes() const noexcept { return topo().Nodes(); }
 
+  /// Captures a FlatCsrView of the wrapped topology for indirection-free
+  /// iteration in hot loops. The view borrows the topology's arrays and must
+  /// not outlive this wrapper.
+  FlatCsrView flat_csr_view() const noexcept { return FlatCsrView{topo()}; }
+
   // Standard container concepts
 
   auto begin() const noexcept { return topo().begin(); }
@@ -1548,6 +2143,8 @@ struct PropertyGraphViews {
       internal::PGViewNodesSortedByDegreeEdgesSortedByDestID;
 };
 
+class DegreeBins;
+
 class KATANA_EXPORT PGViewCache {
   std::shared_ptr<GraphTopology> original_topo_{
       std::make_shared<GraphTopology>()};
@@ -1558,6 +2155,18 @@ class KATANA_EXPORT PGViewCache {
   std::shared_ptr<CondensedTypeIDMap> edge_type_id_map_;
   // TODO(amber): define a node_type_id_map_;
 
+  // Lazily built per-type bitmap indices over nodes and edges. Keyed by
+  // EntityTypeID; entries made stale by a topology swap are detected by
+  // their size and rebuilt.
+  std::unordered_map<EntityTypeID, std::shared_ptr<const DynamicBitset>>
+      node_type_bitmaps_;
+  std::unordered_map<EntityTypeID, std::shared_ptr<const DynamicBitset>>
+      edge_type_bitmaps_;
+
+  // Lazily built degree binning of the default topology; staled by a
+  // topology swap, detected by its node and edge counts.
+  std::shared_ptr<const DegreeBins> degree_bins_;
+
   template <typename>
   friend struct internal::PGViewBuilder;
 
@@ -1566,6 +2175,11 @@ public:
   PGViewCache(GraphTopology&& original_topo)
       : original_topo_(
             std::make_shared<GraphTopology>(std::move(original_topo))) {}
+  /// Adopt an already-shared default topology (structural sharing across
+  /// PropertyGraphs; see SharedTopologyRegistry). The topology must be
+  /// treated as immutable.
+  PGViewCache(std::shared_ptr<GraphTopology> original_topo)
+      : original_topo_(std::move(original_topo)) {}
   PGViewCache(PGViewCache&&) = default;
   PGViewCache& operator=(PGViewCache&&) = default;
 
@@ -1587,12 +2201,34 @@ public:
         pg, node_types, edge_types, *this);
   }
 
+  /// Bitmap with a set bit for every node whose type set includes
+  /// \p type (need not be the most specific type); built on first
+  /// request with one parallel scan and cached. See
+  /// PropertyGraph::GetNodesWithType for the user-facing entry point.
+  std::shared_ptr<const DynamicBitset> BuildOrGetNodeTypeBitmap(
+      const PropertyGraph* pg, EntityTypeID type) noexcept;
+
+  /// As BuildOrGetNodeTypeBitmap, over edges in topology order.
+  std::shared_ptr<const DynamicBitset> BuildOrGetEdgeTypeBitmap(
+      const PropertyGraph* pg, EntityTypeID type) noexcept;
+
+  /// Nodes of the default topology binned by out-degree class; built
+  /// on first request and cached. See DoAllByDegreeBin in DegreeBins.h
+  /// for the execution mode this feeds.
+  std::shared_ptr<const DegreeBins> BuildOrGetDegreeBins(
+      const PropertyGraph* pg) noexcept;
+
   // Avoids a copy of the default topology.
   const GraphTopology& GetDefaultTopologyRef() const noexcept;
 
   // Purge cache and construct an empty topology as the default one.
   void DropAllTopologies() noexcept;
 
+  // Drop cached topologies that no live view references, returning an
+  // estimate of the bytes freed. Used by memory-pressure handlers; dropped
+  // topologies are rebuilt on demand if a view asks for them again.
+  size_t DropUnusedTopologies() noexcept;
+
 private:
   std::shared_ptr<GraphTopology> GetDefaultTopology() const noexcept;
 
@@ -1633,6 +2269,47 @@ private:
 KATANA_EXPORT GraphTopology CreateUniformRandomTopology(
     const size_t num_nodes, const size_t edges_per_node) noexcept;
 
+/// Counts the size of the intersection of the adjacency lists of nodes u and
+/// v. Both lists must be sorted by destination (kSortedByDestID).
+///
+/// The balanced case runs a branch-reduced linear merge over the raw
+/// destination arrays that compilers can unroll and vectorize; when one
+/// list is much longer than the other it switches to galloping binary
+/// search. This is the shared inner loop of triangle counting, k-truss and
+/// Jaccard-style kernels, which all roll their own today.
+KATANA_EXPORT size_t CountSortedIntersection(
+    const GraphTopology& topo, GraphTopology::Node u,
+    GraphTopology::Node v) noexcept;
+
+/// As CountSortedIntersection, but invokes func on every common
+/// destination instead of counting.
+template <typename FuncTy>
+void
+ForEachSortedIntersection(
+    const GraphTopology& topo, GraphTopology::Node u, GraphTopology::Node v,
+    FuncTy&& func) noexcept {
+  const auto* dests = topo.DestData();
+  auto u_range = topo.OutEdges(u);
+  auto v_range = topo.OutEdges(v);
+  const auto* u_it = dests + *u_range.begin();
+  const auto* u_end = dests + *u_range.end();
+  const auto* v_it = dests + *v_range.begin();
+  const auto* v_end = dests + *v_range.end();
+
+  while (u_it != u_end && v_it != v_end) {
+    const auto u_dst = *u_it;
+    const auto v_dst = *v_it;
+    if (u_dst == v_dst) {
+      func(u_dst);
+      ++u_it;
+      ++v_it;
+    } else {
+      u_it += (u_dst < v_dst);
+      v_it += (v_dst < u_dst);
+    }
+  }
+}
+
 /// A simple incremental topology builder for small sized graphs.
 /// Typical usage:
 /// AddNodes(10); // creates 10 nodes (0..9) with no edges
@@ -0,0 +1,63 @@
+#ifndef KATANA_LIBGRAPH_KATANA_GROUPBY_H_
+#define KATANA_LIBGRAPH_KATANA_GROUPBY_H_
+
+#include <string>
+#include <vector>
+
+#include <arrow/api.h>
+
+#include "katana/PropertyGraph.h"
+#include "katana/Result.h"
+#include "katana/config.h"
+
+namespace katana {
+
+/// The reduction applied to one property within each group.
+enum class AggregateOp {
+  kCount,  ///< number of rows in the group; uses no input property
+  kSum,    ///< sum of non-null values
+  kMin,    ///< smallest non-null value
+  kMax,    ///< largest non-null value
+  kMean,   ///< sum of non-null values divided by their count
+};
+
+/// One output column of a group-by: which property to reduce, how, and
+/// what to call the result.
+struct KATANA_EXPORT AggregateSpec {
+  /// Property to aggregate; must be a numeric column. Leave empty for
+  /// AggregateOp::kCount, which only counts rows.
+  std::string property;
+  AggregateOp op{AggregateOp::kCount};
+  /// Column name in the result table.
+  std::string output_name;
+};
+
+/// Group the nodes of \p pg by an integer-typed key property and reduce
+/// the requested properties within each group, entirely in memory. Rows
+/// with a null key are dropped. The result table has the key column
+/// (int64, sorted ascending) followed by one column per spec: int64 for
+/// kCount, float64 for the others, null where a group saw no non-null
+/// values.
+///
+/// Aggregation runs with a hash table per thread and a single merge pass,
+/// so threads never contend on shared buckets; this is the same
+/// thread-local-then-combine shape the runtime uses for reduction and
+/// statistics.
+///
+/// Returns TypeError for a non-integer key or non-numeric aggregate
+/// property, PropertyNotFound for missing properties, and InvalidArgument
+/// for a spec whose op needs a property but names none.
+KATANA_EXPORT Result<std::shared_ptr<arrow::Table>> GroupByNodeProperty(
+    const PropertyGraph& pg, const std::string& key_property,
+    const std::vector<AggregateSpec>& aggregates);
+
+/// Group the edges of \p pg by an integer-typed key property.
+///
+/// \see GroupByNodeProperty
+KATANA_EXPORT Result<std::shared_ptr<arrow::Table>> GroupByEdgeProperty(
+    const PropertyGraph& pg, const std::string& key_property,
+    const std::vector<AggregateSpec>& aggregates);
+
+}  // namespace katana
+
+#endif
@@ -20,8 +20,16 @@
 #ifndef KATANA_LIBGRAPH_KATANA_HYPERGRAPH_H_
 #define KATANA_LIBGRAPH_KATANA_HYPERGRAPH_H_
 
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
 #include "katana/DynamicBitset.h"
 #include "katana/LC_CSR_Graph.h"
+#include "katana/Loops.h"
+#include "katana/NUMAArray.h"
+#include "katana/Reduction.h"
+#include "katana/gstl.h"
 
 namespace katana {
 template <typename NodeTy, bool HasNoLockable = true, bool UseNumaAlloc = true>
@@ -38,6 +46,135 @@ private:
   uint32_t hedges_;
   uint32_t hnodes_;
 };
+
+/**
+ * Compressed pin list over a HyperGraph.
+ *
+ * The bipartite encoding above stores pins as generic CSR edges: 64-bit
+ * edge machinery, destinations offset by the hyperedge count, and
+ * hyperedges visited in id order regardless of size. Pin-bound phases
+ * (net-cut evaluation, gain updates) only need hyperedge-major pin
+ * scans, so this layout packs the pins of each hyperedge contiguously
+ * as 32-bit vertex ids rebased to [0, hnodes) and orders hyperedges by
+ * descending pin count, which keeps the large nets at the front where
+ * work stealing balances them instead of trailing a mostly-drained
+ * loop.
+ *
+ * The layout is a read-only snapshot of the graph it was built from.
+ */
+template <typename HyperGraphTy>
+class HyperGraphPinList {
+public:
+  explicit HyperGraphPinList(HyperGraphTy* graph) {
+    const uint32_t num_hedges = graph->GetHedges();
+
+    order_.resize(num_hedges);
+    std::iota(order_.begin(), order_.end(), uint32_t{0});
+    std::sort(order_.begin(), order_.end(), [&](uint32_t a, uint32_t b) {
+      size_t da = std::distance(graph->edge_begin(a), graph->edge_end(a));
+      size_t db = std::distance(graph->edge_begin(b), graph->edge_end(b));
+      return da != db ? da > db : a < b;
+    });
+
+    pin_offsets_.allocateBlocked(num_hedges);
+    uint64_t num_pins = 0;
+    for (uint32_t rank = 0; rank < num_hedges; ++rank) {
+      num_pins += std::distance(
+          graph->edge_begin(order_[rank]), graph->edge_end(order_[rank]));
+      pin_offsets_[rank] = num_pins;
+    }
+
+    pins_.allocateBlocked(num_pins);
+    katana::do_all(
+        katana::iterate(uint32_t{0}, num_hedges),
+        [&](uint32_t rank) {
+          uint64_t out = rank == 0 ? 0 : pin_offsets_[rank - 1];
+          for (auto e : graph->edges(order_[rank])) {
+            uint32_t dst = graph->getEdgeDst(e);
+            KATANA_LOG_DEBUG_ASSERT(dst >= num_hedges);
+            pins_[out++] = dst - num_hedges;
+          }
+        },
+        katana::steal());
+  }
+
+  uint32_t NumHedges() const {
+    return static_cast<uint32_t>(order_.size());
+  }
+  uint64_t NumPins() const { return pins_.size(); }
+
+  /// Original hyperedge id at a degree-sorted rank.
+  uint32_t GetHedgeID(uint32_t rank) const { return order_[rank]; }
+
+  /// Pins of the hyperedge at a degree-sorted rank, as vertex ids in
+  /// [0, hnodes).
+  const uint32_t* PinsBegin(uint32_t rank) const {
+    return &pins_[rank == 0 ? 0 : pin_offsets_[rank - 1]];
+  }
+  const uint32_t* PinsEnd(uint32_t rank) const {
+    return &pins_[0] + pin_offsets_[rank];
+  }
+
+  /**
+   * Number of hyperedges whose pins span more than one partition, for a
+   * partition assignment \p part indexed by vertex id. Parallel over
+   * the degree-sorted order.
+   */
+  template <typename PartitionFn>
+  uint32_t ComputeCut(const PartitionFn& part) const {
+    katana::GAccumulator<uint32_t> cut;
+    katana::do_all(
+        katana::iterate(uint32_t{0}, NumHedges()),
+        [&](uint32_t rank) {
+          const uint32_t* pin = PinsBegin(rank);
+          const uint32_t* end = PinsEnd(rank);
+          if (pin == end) {
+            return;
+          }
+          uint32_t first = part(*pin);
+          for (++pin; pin != end; ++pin) {
+            if (part(*pin) != first) {
+              cut += 1;
+              return;
+            }
+          }
+        },
+        katana::steal(), katana::loopname("PinList-ComputeCut"));
+    return cut.reduce();
+  }
+
+  /**
+   * Connectivity metric: sum over hyperedges of (number of partitions
+   * touched - 1). Zero for an uncut partitioning; counts multi-way
+   * splits more finely than ComputeCut.
+   */
+  template <typename PartitionFn>
+  uint64_t ComputeConnectivity(const PartitionFn& part) const {
+    katana::GAccumulator<uint64_t> connectivity;
+    katana::do_all(
+        katana::iterate(uint32_t{0}, NumHedges()),
+        [&](uint32_t rank) {
+          katana::gstl::Vector<uint32_t> seen;
+          for (const uint32_t* pin = PinsBegin(rank); pin != PinsEnd(rank);
+               ++pin) {
+            uint32_t p = part(*pin);
+            if (std::find(seen.begin(), seen.end(), p) == seen.end()) {
+              seen.push_back(p);
+            }
+          }
+          if (!seen.empty()) {
+            connectivity += seen.size() - 1;
+          }
+        },
+        katana::steal(), katana::loopname("PinList-ComputeConnectivity"));
+    return connectivity.reduce();
+  }
+
+private:
+  std::vector<uint32_t> order_;
+  NUMAArray<uint64_t> pin_offsets_;
+  NUMAArray<uint32_t> pins_;
+};
 }  // namespace katana
 
 #endif
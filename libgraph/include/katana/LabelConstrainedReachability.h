@@ -0,0 +1,141 @@
+#ifndef KATANA_LIBGRAPH_KATANA_LABELCONSTRAINEDREACHABILITY_H_
+#define KATANA_LIBGRAPH_KATANA_LABELCONSTRAINEDREACHABILITY_H_
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "katana/GraphTopology.h"
+#include "katana/PropertyGraph.h"
+#include "katana/Result.h"
+#include "katana/config.h"
+
+namespace katana {
+
+/// A 2-hop reachability index answering label-constrained queries: "is
+/// \c dst reachable from \c src using only edges whose types are in set
+/// S". Queries that previously required a full BFS per call resolve by
+/// intersecting two per-node label lists, typically in microseconds.
+///
+/// The index is a pruned landmark labeling: nodes are processed in
+/// degree order, and each landmark's forward and backward traversals
+/// record (hub, edge-type mask) entries on the nodes they reach, pruned
+/// against the labels built so far. A query succeeds when the out-labels
+/// of \c src and the in-labels of \c dst share a hub whose combined mask
+/// is a subset of the allowed types.
+///
+/// At most 64 distinct edge types can be indexed (one mask bit each);
+/// Make fails with InvalidArgument beyond that. The index keeps its own
+/// copy of the adjacency so that AddEdge can maintain labels under
+/// streaming ingest without holding a graph version alive.
+class KATANA_EXPORT LabelConstrainedReachabilityIndex
+    : public GraphTopologyTypes {
+public:
+  using EdgeTypeMask = uint64_t;
+
+  static constexpr size_t kMaxIndexedEdgeTypes = 64;
+
+  /// Node property names used by WriteProperties/FromProperties.
+  static constexpr const char* kOutLabelPropertyName = "lcr_out_labels";
+  static constexpr const char* kInLabelPropertyName = "lcr_in_labels";
+
+  LabelConstrainedReachabilityIndex(LabelConstrainedReachabilityIndex&&) =
+      default;
+  LabelConstrainedReachabilityIndex& operator=(
+      LabelConstrainedReachabilityIndex&&) = default;
+
+  /// Builds the index from scratch over \p pg's default topology.
+  static Result<std::unique_ptr<LabelConstrainedReachabilityIndex>> Make(
+      const PropertyGraph& pg);
+
+  /// Rebuilds the index from the label properties a previous
+  /// WriteProperties stored on \p pg, skipping the build traversals.
+  static Result<std::unique_ptr<LabelConstrainedReachabilityIndex>>
+  FromProperties(const PropertyGraph& pg);
+
+  /// The mask bit for \p edge_type, or NotFound if the type is not
+  /// indexed. Resolve masks once per query, not per hop.
+  Result<EdgeTypeMask> MaskOf(const EntityTypeID& edge_type) const;
+
+  /// Union of MaskOf over \p edge_types.
+  Result<EdgeTypeMask> MaskOf(
+      const std::vector<EntityTypeID>& edge_types) const;
+
+  /// True if \p dst is reachable from \p src via edges whose type bits
+  /// all lie in \p allowed_types.
+  bool Reachable(Node src, Node dst, EdgeTypeMask allowed_types) const;
+
+  Result<bool> Reachable(
+      Node src, Node dst, const std::vector<EntityTypeID>& edge_types) const;
+
+  /// Incrementally extends the index for a newly ingested edge; labels
+  /// reachable through the new edge are added, nothing is rebuilt. A
+  /// previously unseen edge type gets the next free mask bit.
+  Result<void> AddEdge(Node src, Node dst, const EntityTypeID& edge_type);
+
+  /// Stores the label lists as binary node properties on \p pg so a
+  /// later FromProperties can skip the build. Masks are canonicalized to
+  /// the sorted order of the graph's distinct edge types, which is the
+  /// mapping FromProperties reconstructs.
+  Result<void> WriteProperties(PropertyGraph* pg, TxnContext* txn_ctx) const;
+
+  size_t num_nodes() const { return out_labels_.size(); }
+
+  /// Total label entries over both directions; the usual index-size
+  /// metric for 2-hop schemes.
+  size_t num_label_entries() const;
+
+private:
+  struct LabelEntry {
+    uint32_t hub_rank;
+    EdgeTypeMask mask;
+  };
+
+  /// Sorted by hub_rank; a hub may carry several incomparable masks.
+  using LabelList = std::vector<LabelEntry>;
+
+  struct HalfEdge {
+    Node dst;
+    uint8_t type_bit;
+  };
+
+  LabelConstrainedReachabilityIndex() = default;
+
+  Result<void> BuildAdjacency(const PropertyGraph& pg);
+  void BuildLabels();
+
+  /// All neighbors of \p n in the given direction, CSR plus edges added
+  /// incrementally since Make.
+  template <typename Fn>
+  void ForEachNeighbor(bool forward, Node n, Fn&& fn) const;
+
+  /// Pruned traversal from (\p start, \p start_mask) on behalf of hub
+  /// \p hub_rank, recording labels into in_labels_ (forward) or
+  /// out_labels_ (backward).
+  void PrunedTraversal(
+      bool forward, uint32_t hub_rank, Node start, EdgeTypeMask start_mask);
+
+  // Out-labels of n: hubs n reaches; in-labels: hubs that reach n.
+  std::vector<LabelList> out_labels_;
+  std::vector<LabelList> in_labels_;
+
+  std::unordered_map<EntityTypeID, uint8_t> type_bits_;
+
+  // Degree-descending landmark order; labels store ranks so that the
+  // two-pointer intersection visits the most useful hubs first.
+  std::vector<Node> rank_to_node_;
+  std::vector<uint32_t> node_to_rank_;
+
+  // Private adjacency copy in both directions; extra_* hold edges from
+  // AddEdge so maintenance does not depend on a graph version.
+  NUMAArray<Edge> out_adj_indices_;
+  NUMAArray<HalfEdge> out_edges_;
+  NUMAArray<Edge> in_adj_indices_;
+  NUMAArray<HalfEdge> in_edges_;
+  std::vector<std::vector<HalfEdge>> extra_out_edges_;
+  std::vector<std::vector<HalfEdge>> extra_in_edges_;
+};
+
+}  // namespace katana
+
+#endif
@@ -0,0 +1,206 @@
+#ifndef KATANA_LIBGRAPH_KATANA_MORPHGRAPHCOMPACTOR_H_
+#define KATANA_LIBGRAPH_KATANA_MORPHGRAPHCOMPACTOR_H_
+
+/// CSR compaction for MorphGraph read phases.
+///
+/// MorphGraph pays for mutability on every traversal: per-node edge
+/// vectors behind a filter iterator, pointer-identified nodes, no
+/// contiguous scan. Workloads like mesh refinement alternate mutation
+/// bursts with long read phases, and hand-written conversion to an LC
+/// graph between the two is boilerplate that goes stale. A
+/// MorphGraphCompactor tracks a mutation epoch and rebuilds a packed CSR
+/// image of the graph in parallel at the first read after a burst;
+/// between bursts, traversals run over the flat arrays at LC_CSR speed.
+///
+/// Compacted node ids, edge ids, and the arrays behind them stay stable
+/// until the first compact() after a mutation, so read phases can cache
+/// them freely. Node data is not copied — getData() goes through the
+/// stable gNode pointer — while edge destinations and edge data are
+/// snapshotted into the CSR image (edge vectors move under mutation).
+///
+/// \file
+
+#include <cstdint>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "katana/Logging.h"
+#include "katana/Loops.h"
+#include "katana/MethodFlags.h"
+#include "katana/NUMAArray.h"
+#include "katana/ParallelSTL.h"
+#include "katana/Range.h"
+#include "katana/config.h"
+
+namespace katana {
+
+template <typename MorphGraphTy>
+class MorphGraphCompactor {
+public:
+  using GraphNode = typename MorphGraphTy::GraphNode;
+  using node_data_type = typename MorphGraphTy::node_data_type;
+  using edge_data_type = typename MorphGraphTy::edge_data_type;
+  using CompactNode = uint32_t;
+  using CompactEdge = uint64_t;
+  using edges_range = StandardRange<boost::counting_iterator<CompactEdge>>;
+
+  /// \param graph the graph to compact; not owned and must outlive the
+  /// compactor. Mutations must go through the forwarding mutators below
+  /// (or be followed by a manual markMutated()) for staleness tracking.
+  explicit MorphGraphCompactor(MorphGraphTy& graph) : graph_(&graph) {}
+
+  /// Record that the underlying graph changed; the next compact()
+  /// rebuilds. Needed only for mutations that bypass the forwarders.
+  void markMutated() { mutation_epoch_ += 1; }
+
+  /// True when the CSR image reflects every recorded mutation.
+  bool upToDate() const { return compacted_epoch_ == mutation_epoch_; }
+
+  // Forwarding mutators; each marks the CSR image stale.
+
+  template <typename... Args>
+  GraphNode createNode(Args&&... args) {
+    return graph_->createNode(std::forward<Args>(args)...);
+  }
+
+  void addNode(const GraphNode& n) {
+    graph_->addNode(n);
+    markMutated();
+  }
+
+  typename MorphGraphTy::edge_iterator addEdge(GraphNode src, GraphNode dst) {
+    markMutated();
+    return graph_->addEdge(src, dst);
+  }
+
+  void removeNode(GraphNode n) {
+    graph_->removeNode(n);
+    markMutated();
+  }
+
+  void removeEdge(GraphNode src, typename MorphGraphTy::edge_iterator edge) {
+    graph_->removeEdge(src, edge);
+    markMutated();
+  }
+
+  /// Rebuild the CSR image if any mutation happened since the last
+  /// rebuild. Uses the whole thread pool; call it at the epoch boundary
+  /// (end of a mutation burst), not from inside a parallel region. Read
+  /// accessors call it implicitly.
+  void compact() {
+    if (upToDate()) {
+      return;
+    }
+
+    // Pointer-to-id assignment orders nodes by morph iteration order;
+    // InsertBag iteration is not parallel-friendly here, but this pass
+    // is linear in nodes and the edge passes below dominate.
+    nodes_.clear();
+    ids_.clear();
+    for (auto ii = graph_->begin(), ei = graph_->end(); ii != ei; ++ii) {
+      ids_[*ii] = static_cast<CompactNode>(nodes_.size());
+      nodes_.push_back(*ii);
+    }
+
+    const size_t num_nodes = nodes_.size();
+    adj_indices_.deallocate();
+    adj_indices_.allocateBlocked(num_nodes);
+
+    katana::do_all(
+        katana::iterate(size_t{0}, num_nodes),
+        [&](size_t i) {
+          adj_indices_[i] = std::distance(
+              graph_->edge_begin(nodes_[i], katana::MethodFlag::UNPROTECTED),
+              graph_->edge_end(nodes_[i], katana::MethodFlag::UNPROTECTED));
+        },
+        katana::steal());
+    katana::ParallelSTL::partial_sum(
+        adj_indices_.begin(), adj_indices_.end(), adj_indices_.begin());
+
+    const uint64_t num_edges = num_nodes == 0 ? 0 : adj_indices_[num_nodes - 1];
+    dests_.deallocate();
+    dests_.allocateBlocked(num_edges);
+    if constexpr (!std::is_void_v<edge_data_type>) {
+      edge_data_.resize(num_edges);
+    }
+
+    katana::do_all(
+        katana::iterate(size_t{0}, num_nodes),
+        [&](size_t i) {
+          CompactEdge out = i == 0 ? 0 : adj_indices_[i - 1];
+          for (auto e =
+                   graph_->edge_begin(nodes_[i], katana::MethodFlag::UNPROTECTED),
+               ee = graph_->edge_end(nodes_[i], katana::MethodFlag::UNPROTECTED);
+               e != ee; ++e, ++out) {
+            dests_[out] = ids_.at(graph_->getEdgeDst(e));
+            if constexpr (!std::is_void_v<edge_data_type>) {
+              edge_data_[out] = graph_->getEdgeData(e);
+            }
+          }
+        },
+        katana::steal());
+
+    compacted_epoch_ = mutation_epoch_;
+  }
+
+  // CSR reads. Ids and ranges are stable until the first compact() that
+  // observes a mutation.
+
+  CompactNode size() {
+    compact();
+    return static_cast<CompactNode>(nodes_.size());
+  }
+
+  CompactEdge sizeEdges() {
+    compact();
+    return nodes_.empty() ? 0 : adj_indices_[nodes_.size() - 1];
+  }
+
+  edges_range edges(CompactNode n) {
+    compact();
+    KATANA_LOG_DEBUG_ASSERT(n < nodes_.size());
+    CompactEdge begin = n == 0 ? 0 : adj_indices_[n - 1];
+    return MakeStandardRange(
+        boost::counting_iterator<CompactEdge>(begin),
+        boost::counting_iterator<CompactEdge>(adj_indices_[n]));
+  }
+
+  CompactNode getEdgeDst(CompactEdge e) const { return dests_[e]; }
+
+  template <typename T = edge_data_type>
+  std::enable_if_t<!std::is_void_v<T>, T&> getEdgeData(CompactEdge e) {
+    return edge_data_[e];
+  }
+
+  /// Node data stays in the morph graph; writes through this reference
+  /// are visible there and do not stale the CSR image.
+  node_data_type& getData(CompactNode n) {
+    return graph_->getData(nodes_[n], katana::MethodFlag::UNPROTECTED);
+  }
+
+  /// The morph-graph node behind a compacted id, for mutations keyed
+  /// off a read phase's findings.
+  GraphNode node(CompactNode n) const { return nodes_[n]; }
+
+  /// The compacted id of a morph-graph node in the current image.
+  CompactNode id(GraphNode n) const { return ids_.at(n); }
+
+private:
+  using EdgeDataStore =
+      std::conditional_t<std::is_void_v<edge_data_type>, char, edge_data_type>;
+
+  MorphGraphTy* graph_;
+  uint64_t mutation_epoch_{1};
+  uint64_t compacted_epoch_{0};
+
+  std::vector<GraphNode> nodes_;
+  std::unordered_map<GraphNode, CompactNode> ids_;
+  NUMAArray<CompactEdge> adj_indices_;
+  NUMAArray<CompactNode> dests_;
+  std::vector<EdgeDataStore> edge_data_;
+};
+
+}  // namespace katana
+
+#endif
@@ -0,0 +1,97 @@
+#ifndef KATANA_LIBGRAPH_KATANA_PACKEDBOOLVIEW_H_
+#define KATANA_LIBGRAPH_KATANA_PACKEDBOOLVIEW_H_
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "katana/DynamicBitset.h"
+#include "katana/PropertyGraph.h"
+#include "katana/Result.h"
+#include "katana/config.h"
+
+namespace katana {
+
+/// A boolean expression over the named flags of a PackedBoolView. Build one
+/// with the Flag/Not/And/Or factories and pass it to
+/// PackedBoolView::Evaluate; flag names are resolved at evaluation time, so
+/// the same expression can be reused across views.
+///
+/// Expressions share subtrees: operands are captured by value but only hold
+/// a reference-counted pointer, so composing a large rule out of common
+/// sub-rules does not copy them.
+class KATANA_EXPORT BoolExpr {
+public:
+  /// The value of the named flag property.
+  static BoolExpr Flag(std::string name);
+  /// Logical complement of \p operand.
+  static BoolExpr Not(BoolExpr operand);
+  /// Logical conjunction of \p lhs and \p rhs.
+  static BoolExpr And(BoolExpr lhs, BoolExpr rhs);
+  /// Logical disjunction of \p lhs and \p rhs.
+  static BoolExpr Or(BoolExpr lhs, BoolExpr rhs);
+
+  /// The operator of a term; public so evaluators can switch over it.
+  enum class Op { kFlag, kNot, kAnd, kOr };
+
+private:
+  friend class PackedBoolView;
+
+  struct Term {
+    Op op;
+    std::string flag;
+    std::shared_ptr<const Term> lhs;
+    std::shared_ptr<const Term> rhs;
+  };
+
+  explicit BoolExpr(std::shared_ptr<const Term> root)
+      : root_(std::move(root)) {}
+
+  std::shared_ptr<const Term> root_;
+};
+
+/// PackedBoolView repacks selected boolean node properties into one bit per
+/// node so that rule sweeps touch bits instead of whole columns. Each
+/// uint8/bool property becomes a DynamicBitset at construction (nonzero is
+/// true, null is false); evaluating a BoolExpr then walks the packed words
+/// in 512-bit blocks, combining all operators for a block before moving to
+/// the next, so no intermediate bitset is materialized per operator and the
+/// word-wise inner loops vectorize.
+///
+/// The view is a snapshot: it copies the property values at construction
+/// and does not observe later updates to the graph.
+class KATANA_EXPORT PackedBoolView {
+public:
+  /// Pack the named node properties of \p pg. Each property must be an
+  /// arrow boolean or uint8 column; anything else is a TypeError and a
+  /// missing property is a PropertyNotFound error.
+  static Result<PackedBoolView> MakeFromNodeProperties(
+      const PropertyGraph& pg, const std::vector<std::string>& flag_properties);
+
+  /// Evaluate \p expr for every node at once. The result bitset has one bit
+  /// per node, set where the expression holds. Returns PropertyNotFound if
+  /// the expression names a flag this view did not pack.
+  Result<DynamicBitset> Evaluate(const BoolExpr& expr) const;
+
+  /// The value of a single flag for a single node; intended for spot checks
+  /// rather than sweeps.
+  Result<bool> Test(const std::string& flag, uint64_t node) const;
+
+  /// The number of nodes covered by each flag.
+  size_t size() const { return size_; }
+
+  /// The number of packed flag properties.
+  size_t num_flags() const { return flags_.size(); }
+
+private:
+  PackedBoolView() = default;
+
+  size_t size_{0};
+  std::vector<DynamicBitset> flags_;
+  std::unordered_map<std::string, size_t> flag_index_;
+};
+
+}  // namespace katana
+
+#endif
@@ -399,19 +399,28 @@ public:
 
   size_t size() const { return length_; }
 
-  reference GetValue(size_t i) { return values_[i + offset_]; }
+  reference GetValue(size_t i) { return values_[i]; }
 
-  const_reference GetValue(size_t i) const { return values_[i + offset_]; }
+  const_reference GetValue(size_t i) const { return values_[i]; }
 
   reference operator[](size_t i) { return GetValue(i); }
 
   const_reference operator[](size_t i) const { return GetValue(i); }
 
+  /// Raw pointer to the first element. Elements are contiguous, so inner
+  /// loops can hoist this load instead of going through GetValue; validity
+  /// must still be checked through IsValid where nulls are possible.
+  value_type* data() { return values_; }
+
+  const value_type* data() const { return values_; }
+
 private:
   PODPropertyView(
       T* values, const uint8_t* null_bitmap, size_t length, size_t offset,
       size_t null_count)
-      : values_(values),
+      // fold the array offset into the base pointer so per-access offset
+      // arithmetic is only needed for the null bitmap, which is bit-packed
+      : values_(values + offset),
         null_bitmap_(null_bitmap),
         length_(length),
         offset_(offset),
@@ -494,6 +503,84 @@ private:
   const ArrowArrayType& array_;
 };
 
+/// DictionaryPropertyReadOnlyView provides a read-only property view over
+/// arrow::DictionaryArrays whose dictionary holds string elements. The column
+/// stays dictionary encoded in memory: GetValue decodes a single row on
+/// demand, while GetValueIndex and FindValueIndex expose the integer
+/// dictionary codes directly, so equality tests on low-cardinality columns
+/// are integer compares and the flat strings are never materialized.
+///
+/// \tparam ValueArrayType the arrow array type of the dictionary values
+/// (i.e., arrow::StringArray or arrow::LargeStringArray).
+template <typename ValueArrayType>
+class DictionaryPropertyReadOnlyView {
+public:
+  using value_type = std::string;
+
+  static Result<DictionaryPropertyReadOnlyView> Make(
+      const arrow::DictionaryArray& array) {
+    auto values =
+        std::dynamic_pointer_cast<ValueArrayType>(array.dictionary());
+    if (!values) {
+      return KATANA_ERROR(
+          ErrorCode::TypeError, "unexpected dictionary value type: {}",
+          array.dictionary()->type()->ToString());
+    }
+    return DictionaryPropertyReadOnlyView(array, std::move(values));
+  }
+
+  bool IsValid(size_t i) const { return array_.IsValid(i); }
+
+  size_t size() const { return array_.length(); }
+
+  /// the number of distinct values in the dictionary
+  size_t dictionary_size() const { return values_->length(); }
+
+  /// the dictionary code of row \p i; codes index GetDictionaryValue
+  int64_t GetValueIndex(size_t i) const {
+    KATANA_LOG_DEBUG_ASSERT(IsValid(i));
+    return array_.GetValueIndex(i);
+  }
+
+  /// decode the dictionary entry for code \p index
+  value_type GetDictionaryValue(size_t index) const {
+    return values_->GetString(index);
+  }
+
+  /// the code for \p value, or -1 if the dictionary does not contain it.
+  /// Look up a filter constant once, then compare the result against
+  /// GetValueIndex per row instead of comparing strings.
+  int64_t FindValueIndex(const value_type& value) const {
+    for (int64_t i = 0, n = values_->length(); i < n; ++i) {
+      if (values_->GetString(i) == value) {
+        return i;
+      }
+    }
+    return -1;
+  }
+
+  value_type GetValue(size_t i) const {
+    KATANA_LOG_DEBUG_ASSERT(IsValid(i));
+    return values_->GetString(array_.GetValueIndex(i));
+  }
+
+  value_type operator[](size_t i) const {
+    if (!IsValid(i)) {
+      return value_type{};
+    }
+    return GetValue(i);
+  }
+
+private:
+  DictionaryPropertyReadOnlyView(
+      const arrow::DictionaryArray& array,
+      std::shared_ptr<ValueArrayType> values)
+      : array_(array), values_(std::move(values)) {}
+
+  const arrow::DictionaryArray& array_;
+  std::shared_ptr<ValueArrayType> values_;
+};
+
 template <typename ArrowT, typename ViewT>
 struct Property {
   using ArrowType = ArrowT;
@@ -558,6 +645,18 @@ struct LargeStringReadOnlyProperty
           arrow::LargeStringType,
           StringPropertyReadOnlyView<arrow::LargeStringArray>> {};
 
+/// Views over dictionary-encoded string columns, as produced by
+/// ParquetReader::ReadOpts::read_dictionary.
+struct DictionaryStringReadOnlyProperty
+    : public Property<
+          arrow::DictionaryType,
+          DictionaryPropertyReadOnlyView<arrow::StringArray>> {};
+
+struct DictionaryLargeStringReadOnlyProperty
+    : public Property<
+          arrow::DictionaryType,
+          DictionaryPropertyReadOnlyView<arrow::LargeStringArray>> {};
+
 template <typename T>
 struct StructProperty
     : public Property<arrow::FixedSizeBinaryType, katana::PODPropertyView<T>> {
@@ -1,6 +1,7 @@
 #ifndef KATANA_LIBGRAPH_KATANA_PROPERTYGRAPH_H_
 #define KATANA_LIBGRAPH_KATANA_PROPERTYGRAPH_H_
 
+#include <map>
 #include <memory>
 #include <utility>
 
@@ -228,6 +229,41 @@ public:
         NumEdges());
   }
 
+  // Variant of the constructor above that adopts an already-shared
+  // default topology instead of taking ownership of one; used by Make to
+  // share identical topologies across PropertyGraph objects (see
+  // SharedTopologyRegistry). The shared topology must be treated as
+  // immutable.
+  PropertyGraph(
+      std::unique_ptr<RDGFile>&& rdg_file, RDG&& rdg,
+      std::shared_ptr<GraphTopology> topo,
+      EntityTypeIDArray&& node_entity_type_ids,
+      EntityTypeIDArray&& edge_entity_type_ids,
+      EntityTypeManager&& node_type_manager,
+      EntityTypeManager&& edge_type_manager) noexcept
+      : rdg_(std::make_shared<RDG>(std::move(rdg))),
+        file_(std::move(rdg_file)),
+        node_entity_type_manager_(
+            std::make_shared<EntityTypeManager>(std::move(node_type_manager))),
+        edge_entity_type_manager_(
+            std::make_shared<EntityTypeManager>(std::move(edge_type_manager))),
+        node_entity_type_ids_(std::make_shared<EntityTypeIDArray>(
+            std::move(node_entity_type_ids))),
+        node_entity_data_(node_entity_type_ids_->data()),
+        edge_entity_type_ids_(std::make_shared<EntityTypeIDArray>(
+            std::move(edge_entity_type_ids))),
+        edge_entity_data_(edge_entity_type_ids_->data()),
+        pg_view_cache_(std::move(topo)) {
+    KATANA_LOG_DEBUG_VASSERT(
+        node_entity_type_ids_->size() == NumNodes(),
+        "type array size: {}, num nodes: {}", node_entity_type_ids_->size(),
+        NumNodes());
+    KATANA_LOG_DEBUG_VASSERT(
+        edge_entity_type_ids_->size() == NumEdges(),
+        "type array size: {}, num edges: {}", edge_entity_type_ids_->size(),
+        NumEdges());
+  }
+
   template <typename PGView>
   PGView BuildView() noexcept {
     return pg_view_cache_.BuildView<PGView>(this);
@@ -278,6 +314,20 @@ public:
       const katana::RDGManifest& rdg_manifest,
       const katana::RDGLoadOptions& opts, katana::TxnContext* txn_ctx);
 
+  /// Make a property graph holding only the nodes in
+  /// [node_range.first, node_range.second) of the graph stored at
+  /// \p rdg_dir: the induced subgraph on that range, with node IDs
+  /// rebased to start at 0 and edges whose destination falls outside
+  /// the range dropped. Because the default topology is CSR, the range's
+  /// adjacency entries, destination entries, property rows and type IDs
+  /// are all contiguous on storage, so only bytes proportional to the
+  /// range are read — loading 1% of a graph costs roughly 1% of the
+  /// I/O of Make. The result has no backing RDG and cannot be committed.
+  static Result<std::unique_ptr<PropertyGraph>> MakeRange(
+      const katana::URI& rdg_dir, std::pair<uint64_t, uint64_t> node_range,
+      katana::TxnContext* txn_ctx,
+      const katana::RDGLoadOptions& opts = katana::RDGLoadOptions());
+
   [[deprecated]] static std::unique_ptr<PropertyGraph> MakeProjectedGraph(
       PropertyGraph& pg, const std::vector<std::string>& node_types,
       const std::vector<std::string>& edge_types);
@@ -294,6 +344,58 @@ public:
       PropertyGraph& pg, std::optional<SetOfEntityTypeIDs> node_types,
       std::optional<SetOfEntityTypeIDs> edge_types);
 
+  /// A predicate over a single property column, used to push filtering
+  /// into projection. Rows whose property value is null never match.
+  struct PropertyPredicate {
+    enum class Op {
+      kLessThan,
+      kLessEqual,
+      kEqual,
+      kNotEqual,
+      kGreaterEqual,
+      kGreaterThan,
+    };
+    std::string property_name;
+    Op op{Op::kEqual};
+    /// Compared against the column values after casting to the column type.
+    std::shared_ptr<arrow::Scalar> value;
+  };
+
+  /// Make a projected graph selecting nodes and edges by entity type and
+  /// by property predicates in one fused pass, instead of projecting by
+  /// type and filtering the result in application code. All node
+  /// predicates must match for a node to be kept (likewise for edges);
+  /// predicate evaluation resolves the column type once per chunk and
+  /// scans contiguous raw values with word-level null handling.
+  static Result<std::unique_ptr<PropertyGraph>> MakeProjectedGraph(
+      PropertyGraph& pg, std::optional<SetOfEntityTypeIDs> node_types,
+      std::optional<SetOfEntityTypeIDs> edge_types,
+      const std::vector<PropertyPredicate>& node_predicates,
+      const std::vector<PropertyPredicate>& edge_predicates);
+
+  /// Zone-map statistics for one chunk of a property column. min and max
+  /// are conservative double bounds over the non-null values (widened one
+  /// ulp, so integral columns wider than a double never skip a matching
+  /// chunk). has_min_max is false when the chunk is all null or the column
+  /// type is not numeric; such chunks are never skipped.
+  struct PropertyChunkStatistics {
+    double min{0.0};
+    double max{0.0};
+    int64_t null_count{0};
+    bool has_min_max{false};
+  };
+
+  /// Per-chunk min/max/null-count statistics for a node property column,
+  /// computed on first request and cached. Predicate evaluation consults
+  /// these to skip chunks that cannot contain a matching row.
+  Result<const std::vector<PropertyChunkStatistics>*> GetNodePropertyStatistics(
+      const std::string& name);
+
+  /// Per-chunk min/max/null-count statistics for an edge property column.
+  /// \see GetNodePropertyStatistics
+  Result<const std::vector<PropertyChunkStatistics>*> GetEdgePropertyStatistics(
+      const std::string& name);
+
   /// \return A copy of this with the same set of properties. The copy shares no
   ///       state with this.
   Result<std::unique_ptr<PropertyGraph>> Copy(
@@ -337,6 +439,14 @@ public:
     return *edge_entity_type_manager_;
   }
 
+  Result<std::optional<RDGAdjacencyFilter>> LoadAdjacencyFilter() {
+    return rdg_->LoadAdjacencyFilter();
+  }
+
+  Result<void> WriteAdjacencyFilter(RDGAdjacencyFilter& filter) {
+    return rdg_->WriteAdjacencyFilter(filter);
+  }
+
   Result<std::optional<RDKLSHIndexPrimitive>> LoadRDKLSHIndexPrimitive() {
     return rdg_->LoadRDKLSHIndexPrimitive();
   }
@@ -357,6 +467,10 @@ public:
 
   const katana::URI& rdg_dir() const { return rdg_->rdg_dir(); }
 
+  /// \returns the storage version of the loaded graph, or 0 when the graph
+  /// is not backed by an open RDG file (e.g. in-memory graphs)
+  uint64_t rdg_version();
+
   uint32_t partition_id() const { return rdg_->partition_id(); }
 
   uint32_t partition_policy_id() const {
@@ -603,6 +717,30 @@ public:
         edge_entity_type_id, GetTypeOfEdgeFromPropertyIndex(edge));
   }
 
+  /// \returns a bitmap with a set bit for every node that has the type
+  /// @param node_entity_type_id (need not be the most specific type).
+  ///
+  /// Built on first request with one parallel scan and cached, so
+  /// type-filtered scans that would otherwise call DoesNodeHaveType once
+  /// per node become a word-level walk of the set bits (SetBits()), and
+  /// conjunctive type filters are a bitwise AND of two cached bitmaps.
+  /// The bitmap reflects the types at build time; it is dropped with the
+  /// cached topologies and rebuilt on demand.
+  Result<std::shared_ptr<const DynamicBitset>> GetNodesWithType(
+      EntityTypeID node_entity_type_id);
+
+  /// As GetNodesWithType, over edges indexed in topology order.
+  Result<std::shared_ptr<const DynamicBitset>> GetEdgesWithType(
+      EntityTypeID edge_entity_type_id);
+
+  /// \returns the nodes of this graph binned by out-degree class, for
+  /// degree-bucketed operator dispatch (see DoAllByDegreeBin in
+  /// DegreeBins.h). Built on first request and cached until the
+  /// topology changes.
+  std::shared_ptr<const DegreeBins> BuildOrGetDegreeBins() {
+    return pg_view_cache_.BuildOrGetDegreeBins(this);
+  }
+
   // Return type dictated by arrow
   /// Returns the number of node properties
   /// Does not include types managed by the EntityTypeManager
@@ -723,6 +861,14 @@ public:
     return pg_view_cache_.DropAllTopologies();
   }
 
+  /// Drop cached topology views that no live view references, returning an
+  /// estimate of the bytes freed. Safe to call at any time; dropped
+  /// topologies are rebuilt on demand. Called under memory pressure for
+  /// graphs tracked by TopologyViewManager.
+  size_t DropUnusedTopologies() noexcept {
+    return pg_view_cache_.DropUnusedTopologies();
+  }
+
   const GraphTopology& topology() const noexcept {
     return pg_view_cache_.GetDefaultTopologyRef();
   }
@@ -778,6 +924,53 @@ public:
   Result<void> UpsertEdgeProperties(
       const std::shared_ptr<arrow::Table>& props, katana::TxnContext* txn_ctx);
 
+  /// Add many node property tables in one operation. All columns are
+  /// staged and validated in parallel before anything is inserted, then
+  /// committed as a single property write: one manifest update at
+  /// TxnContext commit time instead of one per table. Either every
+  /// column is added or none are.
+  Result<void> AddNodePropertiesBulk(
+      const std::vector<std::shared_ptr<arrow::Table>>& prop_tables,
+      katana::TxnContext* txn_ctx);
+  /// \see AddNodePropertiesBulk
+  Result<void> AddEdgePropertiesBulk(
+      const std::vector<std::shared_ptr<arrow::Table>>& prop_tables,
+      katana::TxnContext* txn_ctx);
+
+  /// Set a single value of a typed node property in place. Only the chunk
+  /// containing \p index is copied (copy-on-write); every other chunk of
+  /// the column is shared with the previous version. The updated column is
+  /// published atomically through the upsert path, so readers holding the
+  /// old column keep a consistent snapshot and nothing pays a full-column
+  /// rebuild.
+  template <typename T>
+  Result<void> SetNodePropertyValue(
+      const std::string& name, uint64_t index, T value,
+      katana::TxnContext* txn_ctx) {
+    std::shared_ptr<arrow::ChunkedArray> column =
+        KATANA_CHECKED(GetNodeProperty(name));
+    std::shared_ptr<arrow::ChunkedArray> updated =
+        KATANA_CHECKED(CopyOnWriteSetValue(column, index, value));
+    auto table = arrow::Table::Make(
+        arrow::schema({arrow::field(name, column->type())}), {updated});
+    return UpsertNodeProperties(table, txn_ctx);
+  }
+
+  /// Set a single value of a typed edge property in place.
+  /// \see SetNodePropertyValue
+  template <typename T>
+  Result<void> SetEdgePropertyValue(
+      const std::string& name, uint64_t index, T value,
+      katana::TxnContext* txn_ctx) {
+    std::shared_ptr<arrow::ChunkedArray> column =
+        KATANA_CHECKED(GetEdgeProperty(name));
+    std::shared_ptr<arrow::ChunkedArray> updated =
+        KATANA_CHECKED(CopyOnWriteSetValue(column, index, value));
+    auto table = arrow::Table::Make(
+        arrow::schema({arrow::field(name, column->type())}), {updated});
+    return UpsertEdgeProperties(table, txn_ctx);
+  }
+
   Result<void> RemoveNodeProperty(int i, katana::TxnContext* txn_ctx);
   Result<void> RemoveNodeProperty(
       const std::string& prop_name, katana::TxnContext* txn_ctx);
@@ -1049,6 +1242,58 @@ protected:
   PropertyGraph* Parent() const { return parent_; }
 
 private:
+  /// Return a copy of \p column with the value at \p index replaced by
+  /// \p value and marked valid. Only the chunk containing the index is
+  /// deep-copied; the remaining chunks are shared with the input.
+  template <typename T>
+  static Result<std::shared_ptr<arrow::ChunkedArray>> CopyOnWriteSetValue(
+      const std::shared_ptr<arrow::ChunkedArray>& column, uint64_t index,
+      T value) {
+    static_assert(
+        std::is_arithmetic_v<T>, "only primitive typed columns are mutable");
+    using ArrowType = typename arrow::CTypeTraits<T>::ArrowType;
+    using ArrayType = typename arrow::TypeTraits<ArrowType>::ArrayType;
+
+    if (index >= static_cast<uint64_t>(column->length())) {
+      return KATANA_ERROR(
+          ErrorCode::InvalidArgument, "index {} out of range for length {}",
+          index, column->length());
+    }
+    int chunk_index = 0;
+    int64_t chunk_offset = index;
+    while (chunk_offset >= column->chunk(chunk_index)->length()) {
+      chunk_offset -= column->chunk(chunk_index)->length();
+      ++chunk_index;
+    }
+    auto typed =
+        std::dynamic_pointer_cast<ArrayType>(column->chunk(chunk_index));
+    if (!typed) {
+      return KATANA_ERROR(
+          ErrorCode::TypeError, "column has type {}",
+          column->type()->ToString());
+    }
+
+    std::shared_ptr<arrow::ArrayData> data = typed->data()->Copy();
+    std::shared_ptr<arrow::Buffer> values = KATANA_CHECKED(
+        data->buffers[1]->CopySlice(0, data->buffers[1]->size()));
+    reinterpret_cast<T*>(values->mutable_data())[data->offset + chunk_offset] =
+        value;
+    data->buffers[1] = std::move(values);
+    if (data->buffers[0] != nullptr) {
+      std::shared_ptr<arrow::Buffer> bitmap = KATANA_CHECKED(
+          data->buffers[0]->CopySlice(0, data->buffers[0]->size()));
+      arrow::BitUtil::SetBit(
+          bitmap->mutable_data(), data->offset + chunk_offset);
+      data->buffers[0] = std::move(bitmap);
+      data->null_count = arrow::kUnknownNullCount;
+    }
+
+    std::vector<std::shared_ptr<arrow::Array>> chunks = column->chunks();
+    chunks[chunk_index] = arrow::MakeArray(data);
+    return std::make_shared<arrow::ChunkedArray>(
+        std::move(chunks), column->type());
+  }
+
   /// this function creates an empty projection with num_new_nodes nodes
   static std::unique_ptr<PropertyGraph> MakeEmptyEdgeProjectedGraph(
       PropertyGraph& pg, uint32_t num_new_nodes,
@@ -1096,6 +1341,18 @@ private:
 
   Result<RDGTopology*> LoadTopology(const RDGTopology& shadow);
 
+  /// Cached zone-map statistics for one property column. The source pointer
+  /// records the column the statistics were computed from; when the column
+  /// is replaced the entry is recomputed on the next request, so mutation
+  /// paths do not need to invalidate the cache explicitly.
+  struct PropertyStatisticsEntry {
+    std::weak_ptr<arrow::ChunkedArray> source;
+    std::vector<PropertyChunkStatistics> chunks;
+  };
+
+  Result<const std::vector<PropertyChunkStatistics>*> GetPropertyStatistics(
+      const std::string& name, bool for_nodes);
+
   // Data
   std::shared_ptr<katana::RDG> rdg_{std::make_shared<katana::RDG>()};
   std::shared_ptr<katana::RDGFile> file_;
@@ -1124,6 +1381,10 @@ private:
   std::vector<std::shared_ptr<EntityIndex<Node>>> node_indexes_;
   std::vector<std::shared_ptr<EntityIndex<Edge>>> edge_indexes_;
 
+  // Lazily computed zone-map statistics, keyed by property name.
+  std::map<std::string, PropertyStatisticsEntry> node_property_statistics_;
+  std::map<std::string, PropertyStatisticsEntry> edge_property_statistics_;
+
   PGViewCache pg_view_cache_;
 
   // Transformation related data.
@@ -1162,6 +1423,52 @@ KATANA_EXPORT GraphTopology::Edge FindEdgeSortedByDest(
 // TODO(amber): this method should return a new sorted topology
 KATANA_EXPORT Result<void> SortNodesByDegree(PropertyGraph* pg);
 
+/// Creates a new PropertyGraph with nodes relabeled in descending degree
+/// order.
+///
+/// Unlike SortNodesByDegree, which permutes only the topology in place, this
+/// applies the permutation end-to-end: topology, all Arrow node and edge
+/// property columns, and the entity type ID arrays are rewritten into the new
+/// order, so analytics over the returned graph pay no property-index
+/// indirection and benefit from the improved locality directly.
+/// \param pg The original property graph; it is not modified
+/// \return A new, degree-relabeled property graph that shares no state with pg
+KATANA_EXPORT Result<std::unique_ptr<PropertyGraph>> CreateDegreeRelabeledGraph(
+    PropertyGraph* pg, katana::TxnContext* txn_ctx);
+
+/// Creates a new PropertyGraph with nodes relabeled by an arbitrary
+/// permutation: old node \c i becomes new node \c old_to_new[i].
+///
+/// Like CreateDegreeRelabeledGraph, the permutation is applied end-to-end:
+/// topology, Arrow node and edge property columns, and entity type ID
+/// arrays all move together, so orderings computed by external tools (for
+/// example a METIS partition order) can be applied without losing the
+/// property columns.
+/// \param pg The original property graph; it is not modified
+/// \param old_to_new A bijection over [0, NumNodes())
+/// \return A new relabeled property graph that shares no state with pg
+KATANA_EXPORT Result<std::unique_ptr<PropertyGraph>> CreateRelabeledGraph(
+    PropertyGraph* pg, const NUMAArray<uint32_t>& old_to_new,
+    katana::TxnContext* txn_ctx);
+
+/// Computes the degree-descending permutation used by
+/// CreateDegreeRelabeledGraph: hubs get the lowest new IDs.
+KATANA_EXPORT Result<NUMAArray<uint32_t>> ComputeDegreeOrder(
+    const PropertyGraph* pg);
+
+/// Computes a reverse Cuthill-McKee permutation: breadth-first labeling
+/// from low-degree seeds with degree-ascending tie-breaks, reversed. Lowers
+/// adjacency bandwidth so neighboring nodes land near each other; intended
+/// for symmetric graphs (only out-edges are followed).
+KATANA_EXPORT Result<NUMAArray<uint32_t>> ComputeRCMOrder(
+    const PropertyGraph* pg);
+
+/// Computes a Gorder-style greedy permutation that places each node next
+/// to the recently placed nodes it shares edges with, maximizing overlap
+/// within a sliding window of \p window nodes.
+KATANA_EXPORT Result<NUMAArray<uint32_t>> ComputeWindowAffinityOrder(
+    const PropertyGraph* pg, uint32_t window = 8);
+
 /// Creates in-memory symmetric (or undirected) graph.
 ///
 /// This function creates an symmetric or undirected version of the
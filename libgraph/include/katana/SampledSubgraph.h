@@ -0,0 +1,93 @@
+#ifndef KATANA_LIBGRAPH_KATANA_SAMPLEDSUBGRAPH_H_
+#define KATANA_LIBGRAPH_KATANA_SAMPLEDSUBGRAPH_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "katana/GraphTopology.h"
+#include "katana/PropertyGraph.h"
+#include "katana/Result.h"
+#include "katana/config.h"
+
+namespace katana {
+
+/// A small induced subgraph drawn from a PropertyGraph by sampling, for
+/// approximate analytics at interactive latency.
+///
+/// Only the sample is materialized — a compact CSR over the sampled nodes
+/// with locally renumbered destinations — so building one costs time and
+/// memory proportional to the sample, not the graph, unlike
+/// MakeProjectedGraph. Local node IDs are dense in [0, NumNodes());
+/// OriginalNode maps them back for reading properties off the parent graph.
+///
+/// Estimates computed on induced samples are biased for quantities that
+/// depend on edges between unsampled nodes (an induced node sample keeps
+/// roughly the square of the sampling fraction of the edges); estimator
+/// wrappers account for this where they can and report confidence
+/// intervals either way.
+class KATANA_EXPORT SampledSubgraph : public GraphTopologyTypes {
+public:
+  /// Induced subgraph on \p num_nodes nodes drawn uniformly at random.
+  static Result<SampledSubgraph> RandomNodeSample(
+      const PropertyGraph& graph, uint64_t num_nodes, uint32_t seed);
+
+  /// Induced subgraph on the endpoints of \p num_edges edges drawn
+  /// uniformly at random. Biases the node set toward high-degree nodes,
+  /// which preserves connectivity structure better than node sampling.
+  static Result<SampledSubgraph> RandomEdgeSample(
+      const PropertyGraph& graph, uint64_t num_edges, uint32_t seed);
+
+  /// Induced subgraph on breadth-first neighborhoods: \p num_seeds random
+  /// roots expanded \p depth hops, keeping at most \p fanout random
+  /// neighbors per expanded node (GraphSAGE-style).
+  static Result<SampledSubgraph> NeighborhoodSample(
+      const PropertyGraph& graph, uint64_t num_seeds, uint32_t depth,
+      uint32_t fanout, uint32_t seed);
+
+  uint64_t NumNodes() const noexcept { return nodes_.size(); }
+  uint64_t NumEdges() const noexcept { return dests_.size(); }
+
+  /// The sampled node's ID in the parent graph.
+  Node OriginalNode(Node local) const noexcept { return nodes_[local]; }
+
+  /// Fraction of the parent graph's nodes in the sample.
+  double NodeFraction() const noexcept {
+    return total_nodes_ == 0
+               ? 0.0
+               : static_cast<double>(nodes_.size()) / total_nodes_;
+  }
+
+  nodes_range Nodes() const noexcept {
+    return MakeStandardRange<node_iterator>(
+        Node{0}, static_cast<Node>(nodes_.size()));
+  }
+
+  edges_range OutEdges(Node local) const noexcept {
+    Edge begin = local == 0 ? 0 : adj_indices_[local - 1];
+    return MakeStandardRange<edge_iterator>(begin, adj_indices_[local]);
+  }
+
+  /// Destination as a local node ID.
+  Node OutEdgeDst(Edge e) const noexcept { return dests_[e]; }
+
+  uint64_t OutDegree(Node local) const noexcept {
+    Edge begin = local == 0 ? 0 : adj_indices_[local - 1];
+    return adj_indices_[local] - begin;
+  }
+
+private:
+  /// Build the induced CSR for an arbitrary set of original node IDs
+  /// (deduplicated and sorted here).
+  static Result<SampledSubgraph> FromNodeSet(
+      const PropertyGraph& graph, std::vector<Node>&& node_set);
+
+  NUMAArray<Node> nodes_;  ///< local ID -> original ID, ascending
+  AdjIndexVec adj_indices_;
+  EdgeDestVec dests_;  ///< local IDs
+  uint64_t total_nodes_{0};
+  uint64_t total_edges_{0};
+};
+
+}  // namespace katana
+
+#endif
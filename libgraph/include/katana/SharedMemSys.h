@@ -26,6 +26,19 @@ public:
   SharedMemSys(std::unique_ptr<ProgressTracer> tracer = TextTracer::Make());
   ~SharedMemSys();
 
+  /**
+   * Pay the lazy parts of initialization now instead of during the first
+   * timed parallel region: wakes every pool thread once, faulting in its
+   * stack and per-thread storage, and optionally preallocates the page
+   * pool. Construction alone stays cheap for CLI tools and tests that
+   * touch only small graphs; long-running services call Warmup() (or set
+   * KATANA_PREALLOC_PAGES) for predictable first-query latency.
+   *
+   * @param prealloc_pages if non-zero, populate the page pool with at
+   *     least this many pages, spread across threads.
+   */
+  void Warmup(size_t prealloc_pages = 0);
+
   SharedMemSys(const SharedMemSys&) = delete;
   SharedMemSys& operator=(const SharedMemSys&) = delete;
 
@@ -0,0 +1,51 @@
+#ifndef KATANA_LIBGRAPH_KATANA_SHAREDTOPOLOGYCACHE_H_
+#define KATANA_LIBGRAPH_KATANA_SHAREDTOPOLOGYCACHE_H_
+
+#include <string>
+
+#include "katana/GraphTopology.h"
+#include "katana/Result.h"
+#include "katana/config.h"
+
+namespace katana {
+
+/// Warm-start cache for CSR topologies, backed by named POSIX shared
+/// memory.
+///
+/// Publish copies a loaded topology into a segment under /dev/shm keyed
+/// by a caller-chosen string (typically the RDG directory). The segment
+/// outlives the publishing process, so one warm-up run plays the role of
+/// a daemon: every later process Attaches the same bytes read-only in
+/// milliseconds instead of re-paying the load, and concurrent attachers
+/// share one physical copy. Drop unlinks the segment; existing
+/// attachments stay valid until those processes exit.
+///
+/// Only the topology (and optional property index maps) is shared;
+/// decoded arrow property columns are not relocatable across processes
+/// and load through the usual path.
+class KATANA_EXPORT SharedTopologyCache {
+public:
+  /// Copy the adjacency arrays of \p topo into the shared segment for
+  /// \p key, replacing any previous contents. Property index maps are
+  /// not published; the default CSR topology uses the identity mapping.
+  static Result<void> Publish(
+      const std::string& key, const GraphTopology& topo);
+
+  /// Map the shared segment for \p key read-only and return a topology
+  /// viewing it without copying. The mapping stays for the life of the
+  /// process.
+  static Result<GraphTopology> Attach(const std::string& key);
+
+  /// True when a segment for \p key exists.
+  static bool Contains(const std::string& key);
+
+  /// Unlink the shared segment for \p key.
+  static Result<void> Drop(const std::string& key);
+
+  /// Name of the shm segment that backs \p key; exposed for diagnostics.
+  static std::string SegmentName(const std::string& key);
+};
+
+}  // namespace katana
+
+#endif
@@ -0,0 +1,53 @@
+#ifndef KATANA_LIBGRAPH_KATANA_SHAREDTOPOLOGYREGISTRY_H_
+#define KATANA_LIBGRAPH_KATANA_SHAREDTOPOLOGYREGISTRY_H_
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "katana/GraphTopology.h"
+#include "katana/config.h"
+
+namespace katana {
+
+/// Process-wide structural sharing of immutable CSR topologies.
+///
+/// RDG versions that do not change the graph structure reference the
+/// same topology file (topology files are written once and never
+/// rewritten in place), so workspaces holding several versions of one
+/// graph used to build several identical in-memory copies. The registry
+/// interns the default topology by its storage name: the first load
+/// builds it, later loads of any version referencing the same file get
+/// the same shared instance. Entries are held weakly; when the last
+/// PropertyGraph using a topology goes away, the memory goes with it.
+///
+/// Shared topologies must be treated as immutable. The default topology
+/// already is — mutating operations (transposes, edge sorts) build new
+/// derived topologies in the per-graph view cache rather than editing
+/// the original in place.
+class KATANA_EXPORT SharedTopologyRegistry {
+public:
+  static SharedTopologyRegistry& Get();
+
+  /// Return the topology interned under \p key, invoking \p build to
+  /// create it on miss. An empty key bypasses the registry and always
+  /// builds a private instance.
+  std::shared_ptr<GraphTopology> Intern(
+      const std::string& key, const std::function<GraphTopology()>& build);
+
+  /// Number of interned topologies still alive; exposed for tests and
+  /// diagnostics.
+  size_t NumLive();
+
+private:
+  SharedTopologyRegistry() = default;
+
+  std::mutex lock_;
+  std::unordered_map<std::string, std::weak_ptr<GraphTopology>> entries_;
+};
+
+}  // namespace katana
+
+#endif
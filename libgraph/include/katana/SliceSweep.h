@@ -0,0 +1,180 @@
+#ifndef KATANA_LIBGRAPH_KATANA_SLICESWEEP_H_
+#define KATANA_LIBGRAPH_KATANA_SLICESWEEP_H_
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "katana/Logging.h"
+#include "katana/RDGPrefix.h"
+#include "katana/RDGSlice.h"
+#include "katana/Result.h"
+#include "katana/config.h"
+#include "katana/tsuba.h"
+
+namespace katana {
+
+/// A read-only CSR view over one memory-resident slice of an RDG being
+/// swept by SliceSweep.
+///
+/// Node and edge identifiers are global: adjacency comes from the
+/// sweep's resident prefix array while destinations come from the
+/// slice's bound byte range, so an operator written against this view
+/// reads like one written against GraphTopology. Only nodes in
+/// [NodesBegin, NodesEnd) and edges in [EdgesBegin, EdgesEnd) are
+/// backed by memory; property columns for the same ranges are reachable
+/// through rdg().
+class KATANA_EXPORT GraphSlice {
+public:
+  using Node = uint64_t;
+  using Edge = uint64_t;
+
+  Node NodesBegin() const { return node_begin_; }
+  Node NodesEnd() const { return node_end_; }
+  Edge EdgesBegin() const { return edge_begin_; }
+  Edge EdgesEnd() const { return edge_end_; }
+
+  Edge OutEdgeBegin(Node node) const {
+    KATANA_LOG_DEBUG_ASSERT(node >= node_begin_ && node < node_end_);
+    return node > 0 ? (*prefix_)[node - 1] : 0;
+  }
+
+  Edge OutEdgeEnd(Node node) const {
+    KATANA_LOG_DEBUG_ASSERT(node >= node_begin_ && node < node_end_);
+    return (*prefix_)[node];
+  }
+
+  uint64_t OutDegree(Node node) const {
+    return OutEdgeEnd(node) - OutEdgeBegin(node);
+  }
+
+  Node OutEdgeDst(Edge edge) const {
+    KATANA_LOG_DEBUG_ASSERT(edge >= edge_begin_ && edge < edge_end_);
+    if (narrow_dests_) {
+      return dests32_[edge - edge_begin_];
+    }
+    return dests64_[edge - edge_begin_];
+  }
+
+  /// Property columns and metadata for this slice's node/edge ranges.
+  const RDGSlice& rdg() const { return *slice_; }
+
+  /// Index of a node's property row within this slice's tables.
+  uint64_t NodePropertyIndex(Node node) const { return node - node_begin_; }
+  /// Index of an edge's property row within this slice's tables.
+  uint64_t EdgePropertyIndex(Edge edge) const { return edge - edge_begin_; }
+
+private:
+  friend class SliceSweep;
+
+  GraphSlice(
+      const RDGSlice* slice, const RDGPrefix* prefix, Node node_begin,
+      Node node_end, Edge edge_begin, Edge edge_end, uint64_t dests_offset,
+      bool narrow_dests)
+      : slice_(slice),
+        prefix_(prefix),
+        node_begin_(node_begin),
+        node_end_(node_end),
+        edge_begin_(edge_begin),
+        edge_end_(edge_end),
+        narrow_dests_(narrow_dests) {
+    const FileView& fv = slice_->topology_file_storage();
+    if (narrow_dests_) {
+      dests32_ = fv.ptr<uint32_t>(dests_offset);
+    } else {
+      dests64_ = fv.ptr<uint64_t>(dests_offset);
+    }
+  }
+
+  const RDGSlice* slice_;
+  const RDGPrefix* prefix_;
+  Node node_begin_;
+  Node node_end_;
+  Edge edge_begin_;
+  Edge edge_end_;
+  const uint32_t* dests32_{nullptr};
+  const uint64_t* dests64_{nullptr};
+  bool narrow_dests_;
+};
+
+/// Out-of-core execution over an RDG too large for memory, generalizing
+/// what OCGraph does for the old FileGraph world to the RDG/property
+/// world.
+///
+/// Make loads only the CSR prefix (8 bytes per node) and partitions the
+/// graph into slices of at most max_slice_edges contiguous edges, each
+/// with its contiguous node range. Sweep then runs a callback over the
+/// slices in order; while the callback processes slice i, slice i+1 is
+/// already loading on a background thread (RDGSlice::Prefetch), so
+/// storage reads overlap compute — classic double buffering. Residency
+/// is one prefix array plus at most two slices of topology and
+/// requested properties.
+///
+/// Algorithms whose per-node state fits in memory run as repeated
+/// sweeps: pagerank keeps rank/contribution arrays and sweeps once per
+/// iteration; connected components keeps a component array and sweeps
+/// until no label changes. Anything needing random access to edges
+/// outside the current slice does not fit this engine.
+class KATANA_EXPORT SliceSweep {
+public:
+  struct Options {
+    /// Upper bound on edges resident per slice; choose it from the
+    /// memory budget: one edge costs the destination entry plus any
+    /// requested edge property rows. Two slices are live at a time.
+    uint64_t max_slice_edges{uint64_t{1} << 28};
+    /// Properties to load for every slice; empty vectors load none.
+    std::optional<std::vector<std::string>> node_properties{
+        std::vector<std::string>{}};
+    std::optional<std::vector<std::string>> edge_properties{
+        std::vector<std::string>{}};
+  };
+
+  SliceSweep(SliceSweep&&) noexcept = default;
+  SliceSweep& operator=(SliceSweep&&) noexcept = default;
+  SliceSweep(const SliceSweep&) = delete;
+  SliceSweep& operator=(const SliceSweep&) = delete;
+  ~SliceSweep() = default;
+
+  static Result<SliceSweep> Make(
+      const std::string& rdg_manifest_path, Options options);
+
+  uint64_t num_nodes() const { return prefix_.num_nodes(); }
+  uint64_t num_edges() const { return prefix_.num_edges(); }
+  size_t NumSlices() const { return plan_.size(); }
+
+  using SliceFn = std::function<Result<void>(const GraphSlice&)>;
+
+  /// Run \p fn once on every slice, in node order, prefetching the next
+  /// slice while the current one is processed.
+  Result<void> Sweep(const SliceFn& fn);
+
+private:
+  struct PlannedSlice {
+    uint64_t node_begin;
+    uint64_t node_end;
+    uint64_t edge_begin;
+    uint64_t edge_end;
+  };
+
+  SliceSweep(RDGFile&& file, RDGPrefix&& prefix, Options&& options)
+      : file_(std::make_unique<RDGFile>(std::move(file))),
+        prefix_(std::move(prefix)),
+        options_(std::move(options)) {}
+
+  void BuildPlan();
+  RDGSlice::SliceArg MakeSliceArg(const PlannedSlice& slice) const;
+  uint64_t DestEntrySize() const;
+  uint64_t DestsFileOffset(uint64_t edge) const;
+
+  std::unique_ptr<RDGFile> file_;
+  RDGPrefix prefix_;
+  Options options_;
+  std::vector<PlannedSlice> plan_;
+};
+
+}  // namespace katana
+
+#endif
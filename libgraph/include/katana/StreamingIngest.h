@@ -0,0 +1,84 @@
+#ifndef KATANA_LIBGRAPH_KATANA_STREAMINGINGEST_H_
+#define KATANA_LIBGRAPH_KATANA_STREAMINGINGEST_H_
+
+/// Streaming edge ingestion for PropertyGraph.
+///
+/// Producers (e.g. Kafka consumers) stage edges concurrently into
+/// lock-free per-thread buffers; Merge periodically folds the staged
+/// micro-batch into a new CSR and returns a new graph version that the
+/// caller publishes with PropertyGraph::Write.
+///
+/// \file
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include <arrow/api.h>
+
+#include "katana/Bag.h"
+#include "katana/BuildGraph.h"
+#include "katana/PropertyGraph.h"
+#include "katana/Result.h"
+
+namespace katana {
+
+class KATANA_EXPORT StreamingEdgeIngestor {
+public:
+  /// Declares an edge property carried by staged edges.
+  struct StreamedProperty {
+    std::string name;
+    arrow::Type::type type;
+  };
+
+  /// \param pg graph receiving updates; not owned and must outlive the
+  /// ingestor
+  /// \param properties schema of staged edge properties; Insert calls
+  /// must supply values in this order
+  StreamingEdgeIngestor(
+      PropertyGraph* pg, std::vector<StreamedProperty> properties = {})
+      : pg_(pg), properties_(std::move(properties)) {}
+
+  /// Stage one edge. Safe to call concurrently from any thread; edges
+  /// accumulate in per-thread buffers with no locking on the push path.
+  /// \param values property values matching the declared schema; a
+  /// shorter vector leaves the remaining properties null
+  void Insert(
+      GraphTopology::Node src, GraphTopology::Node dst,
+      std::vector<ImportData> values = {}) {
+    staged_.emplace(StagedEdge{src, dst, std::move(values)});
+    staged_count_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  /// Number of edges staged since the last Merge.
+  uint64_t StagedCount() const {
+    return staged_count_.load(std::memory_order_relaxed);
+  }
+
+  /// Drain the staged micro-batch and merge it with the current graph
+  /// into a new PropertyGraph: topology rebuilt in parallel, existing
+  /// edge property rows carried over by reference through the edge
+  /// property index indirection, staged rows appended as new chunks.
+  /// Publish the returned graph with PropertyGraph::Write to commit the
+  /// new version.
+  ///
+  /// Merge is not safe to run concurrently with Insert; quiesce
+  /// producers (or swap ingestors) around the call.
+  Result<std::unique_ptr<PropertyGraph>> Merge(katana::TxnContext* txn_ctx);
+
+private:
+  struct StagedEdge {
+    GraphTopology::Node src;
+    GraphTopology::Node dst;
+    std::vector<ImportData> values;
+  };
+
+  PropertyGraph* pg_;
+  std::vector<StreamedProperty> properties_;
+  InsertBag<StagedEdge> staged_;
+  std::atomic<uint64_t> staged_count_{0};
+};
+
+}  // namespace katana
+
+#endif
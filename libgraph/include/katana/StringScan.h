@@ -0,0 +1,44 @@
+#ifndef KATANA_LIBGRAPH_KATANA_STRINGSCAN_H_
+#define KATANA_LIBGRAPH_KATANA_STRINGSCAN_H_
+
+#include <string>
+
+#include "katana/DynamicBitset.h"
+#include "katana/PropertyGraph.h"
+#include "katana/Result.h"
+#include "katana/config.h"
+
+namespace katana {
+
+/// The string comparison applied by a scan.
+enum class StringPredicate {
+  kEquals,    ///< the value is exactly the pattern
+  kPrefix,    ///< the value starts with the pattern
+  kContains,  ///< the pattern occurs anywhere in the value
+};
+
+/// Scan a string node property and return a bitset with one bit per node,
+/// set where the predicate holds; null values never match. The property
+/// must be an arrow string or large_string column.
+///
+/// The scan works on the raw offset and character buffers rather than
+/// per-element arrow accessors. Substring search in particular runs
+/// memchr over the character buffer across element boundaries and maps
+/// hits back to elements through the offsets, so the inner loop is the
+/// libc-vectorized one regardless of how short the individual strings
+/// are. The mask plugs directly into MakeProjectedGraph-style node
+/// selections.
+KATANA_EXPORT Result<DynamicBitset> ScanNodeStringProperty(
+    const PropertyGraph& pg, const std::string& property,
+    StringPredicate predicate, const std::string& pattern);
+
+/// Scan a string edge property; one bit per edge.
+///
+/// \see ScanNodeStringProperty
+KATANA_EXPORT Result<DynamicBitset> ScanEdgeStringProperty(
+    const PropertyGraph& pg, const std::string& property,
+    StringPredicate predicate, const std::string& pattern);
+
+}  // namespace katana
+
+#endif
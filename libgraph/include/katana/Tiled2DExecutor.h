@@ -0,0 +1,430 @@
+#ifndef KATANA_LIBGRAPH_KATANA_TILED2DEXECUTOR_H_
+#define KATANA_LIBGRAPH_KATANA_TILED2DEXECUTOR_H_
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <vector>
+
+#include "katana/GraphTopology.h"
+#include "katana/Loops.h"
+#include "katana/PaddedLock.h"
+#include "katana/Range.h"
+#include "katana/Reduction.h"
+#include "katana/Statistics.h"
+#include "katana/ThreadPool.h"
+#include "katana/config.h"
+#include "katana/gIO.h"
+
+namespace katana {
+
+/// 2D edge-tiled executor over any topology exposing the GraphTopology
+/// API (GraphTopology itself, FlatCsrView, TypedPropertyGraph and the
+/// PGView family). The adjacency matrix restricted to
+/// [first_x, last_x) x [first_y, last_y) is cut into fixed tiles; worker
+/// threads start on the grid diagonal and claim tiles dynamically, so
+/// two workers rarely touch the same row or column band of the operand
+/// arrays at once. With locking enabled no two concurrently running
+/// tiles ever share an X or Y band, which lets operators update
+/// per-node state on both endpoints without atomics (DSGD-style matrix
+/// completion, SpMM-like feature propagation).
+///
+/// This is Fixed2DGraphTiledExecutor (libgalois/katana/TiledExecutor.h)
+/// ported off the FileGraph-era LC_CSR interface: tiles address node ids
+/// directly, the sparse path binary-searches each row's destination
+/// range, and tile shape can be derived from the per-row property
+/// footprint so a tile's working set fits in L2 (ComputeTileShape).
+///
+/// The sparse path requires adjacency lists sorted by destination id
+/// within the traversed Y range.
+template <typename Topology>
+class Tiled2DExecutor {
+  static constexpr int kNumDims = 2;  // code is specialized to 2
+
+  using SpinLock = katana::PaddedLock<true>;
+  using Node = GraphTopologyTypes::Node;
+  using Edge = GraphTopologyTypes::Edge;
+  using Point = std::array<size_t, kNumDims>;
+
+  template <typename T>
+  struct SimpleAtomic {
+    std::atomic<T> value;
+    SimpleAtomic() : value(0) {}
+    SimpleAtomic(const SimpleAtomic& o) : value(o.value.load()) {}
+    T relaxedLoad() { return value.load(std::memory_order_relaxed); }
+    void relaxedAdd(T delta) {
+      value.store(relaxedLoad() + delta, std::memory_order_relaxed);
+    }
+  };
+
+  /// Tasks are 2D ranges [start_x, end_x) x [start_y, end_y_inclusive]
+  struct Task {
+    Node start_x;
+    Node end_x;
+    Node start_y;
+    Node end_y_inclusive;
+    Point coord;
+    SimpleAtomic<unsigned> updates;
+  };
+
+  const Topology& topo_;
+  std::array<std::vector<SpinLock>, kNumDims> locks_;
+  std::vector<Task> tasks_;
+  unsigned max_updates_{0};
+  bool use_locks_{false};
+  katana::GAccumulator<unsigned> failed_probes_;
+
+  /// Advance point p in the given dimension by delta, wrapping at the
+  /// edge of the tile grid.
+  void NextPoint(Point& p, int dim, int delta) {
+    KATANA_LOG_DEBUG_ASSERT(dim < kNumDims);
+    p[dim] += delta;
+    while (p[dim] >= locks_[dim].size()) {
+      p[dim] -= locks_[dim].size();
+    }
+  }
+
+  Task* GetTask(const Point& p) {
+    Task* t = &tasks_[p[0] + p[1] * locks_[0].size()];
+
+    KATANA_LOG_DEBUG_ASSERT(t < &tasks_[tasks_.size()]);
+    KATANA_LOG_DEBUG_ASSERT(t >= &tasks_[0]);
+
+    return t;
+  }
+
+  /// Probe up to n tiles from start along dim for one that has not
+  /// reached max_updates_; a found tile is returned WITH both of its
+  /// band locks held.
+  Task* ProbeBlockWithLock(Point& start, int dim, size_t n) {
+    Point p = start;
+
+    for (size_t i = 0; i < n; ++i) {
+      Task* t = GetTask(p);
+
+      KATANA_LOG_DEBUG_ASSERT(p[0] == t->coord[0]);
+      KATANA_LOG_DEBUG_ASSERT(p[1] == t->coord[1]);
+
+      if (t->updates.relaxedLoad() < max_updates_) {
+        if (std::try_lock(locks_[0][t->coord[0]], locks_[1][t->coord[1]]) <
+            0) {
+          if (t->updates.relaxedLoad() < max_updates_) {
+            t->updates.relaxedAdd(1);
+            start = p;
+            return t;
+          }
+
+          for (int d = 0; d < kNumDims; ++d) {
+            locks_[d][t->coord[d]].unlock();
+          }
+        }
+      }
+
+      NextPoint(p, dim, 1);
+    }
+
+    failed_probes_ += 1;
+    return nullptr;
+  }
+
+  /// Lock-free variant of ProbeBlockWithLock: claims a tile with a
+  /// fetch_add on its update counter instead of band locks.
+  Task* ProbeBlockWithoutLock(Point& start, int dim, size_t n) {
+    Point p = start;
+
+    for (size_t i = 0; i < n; ++i) {
+      Task* t = GetTask(p);
+
+      if (t->updates.relaxedLoad() < max_updates_) {
+        if (t->updates.value.fetch_add(1) < max_updates_) {
+          start = p;
+          return t;
+        }
+      }
+      NextPoint(p, dim, 1);
+    }
+
+    failed_probes_ += 1;
+    return nullptr;
+  }
+
+  Task* ProbeBlock(Point& start, int dim, size_t n) {
+    KATANA_LOG_DEBUG_ASSERT(dim < kNumDims);
+
+    if (use_locks_) {
+      return ProbeBlockWithLock(start, dim, n);
+    }
+    return ProbeBlockWithoutLock(start, dim, n);
+  }
+
+  /// From start, search right and down for a claimable tile, then walk
+  /// the diagonal re-probing both directions until the grid has been
+  /// swept twice without finding one.
+  Task* NextBlock(Point& start, bool inclusive) {
+    Task* t = nullptr;
+
+    // repeats twice just to make sure there are actually no unused tiles
+    for (int times = 0; times < 2; ++times) {
+      Point limit{{locks_[0].size(), locks_[1].size()}};
+
+      int inclusive_delta = (inclusive && times == 0) ? 0 : 1;
+
+      for (int i = 0; i < kNumDims; ++i) {
+        Point p = start;
+        NextPoint(p, i, inclusive_delta);
+
+        if ((t = ProbeBlock(p, i, limit[i] - inclusive_delta))) {
+          start = p;
+          return t;
+        }
+      }
+
+      Point p = start;
+      for (int i = 0; i < kNumDims; ++i) {
+        NextPoint(p, i, 1);
+      }
+
+      while (std::any_of(
+          limit.begin(), limit.end(), [](size_t x) { return x > 0; })) {
+        for (int i = 0; i < kNumDims; ++i) {
+          if (limit[i] > 1 && (t = ProbeBlock(p, i, limit[i] - 1))) {
+            start = p;
+            return t;
+          }
+        }
+
+        for (int i = 0; i < kNumDims; ++i) {
+          if (limit[i] > 0) {
+            limit[i] -= 1;
+            NextPoint(p, i, 1);
+          }
+        }
+      }
+    }
+
+    return nullptr;
+  }
+
+  /// Dense tile: apply fn to every (x, y) pair whether or not the edge
+  /// exists.
+  template <typename Function>
+  void ExecuteDenseBlock(Function& fn, Task& task) {
+    for (Node x = task.start_x; x != task.end_x; ++x) {
+      for (Node y = task.start_y; y <= task.end_y_inclusive; ++y) {
+        fn(x, y);
+      }
+    }
+  }
+
+  /// Sparse tile: apply fn to every edge (x, y, e) inside the tile.
+  /// Binary-searches each row for the first destination >= start_y.
+  template <typename Function>
+  void ExecuteSparseBlock(Function& fn, Task& task) {
+    for (Node x = task.start_x; x != task.end_x; ++x) {
+      auto edges = topo_.OutEdges(x);
+      auto ii = std::lower_bound(
+          edges.begin(), edges.end(), task.start_y,
+          [&](Edge e, Node y) { return topo_.OutEdgeDst(e) < y; });
+      for (; ii != edges.end(); ++ii) {
+        Node y = topo_.OutEdgeDst(*ii);
+        if (y > task.end_y_inclusive) {
+          break;
+        }
+        fn(x, y, *ii);
+      }
+    }
+  }
+
+  template <bool UseDense, typename Function>
+  void ExecuteLoop(Function fn, unsigned tid, unsigned total) {
+    Point num_blocks{{locks_[0].size(), locks_[1].size()}};
+    Point block;
+    Point start;
+
+    // assign each thread to a tile on the grid diagonal to begin with
+    for (int i = 0; i < kNumDims; ++i) {
+      block[i] = (num_blocks[i] + total - 1) / total;
+      start[i] = std::min(block[i] * tid, num_blocks[i] - 1);
+    }
+
+    unsigned cores_per_socket = katana::GetThreadPool().getMaxCores() /
+                                katana::GetThreadPool().getMaxSockets();
+
+    // with locks, pack the threads of a socket into neighbouring Y bands
+    if (use_locks_) {
+      start = {
+          {start[0], std::min(
+                         block[1] * katana::GetThreadPool().getSocket(tid) *
+                             cores_per_socket,
+                         num_blocks[1] - 1)}};
+    }
+
+    Point p = start;
+
+    for (int i = 0;; ++i) {
+      Task* t = NextBlock(p, i == 0);
+      if (!t) {
+        break;
+      }
+
+      if constexpr (UseDense) {
+        ExecuteDenseBlock(fn, *t);
+      } else {
+        ExecuteSparseBlock(fn, *t);
+      }
+
+      if (use_locks_) {
+        for (int d = 0; d < kNumDims; ++d) {
+          locks_[d][t->coord[d]].unlock();
+        }
+      }
+    }
+  }
+
+  /// Cut [first_x, last_x) x [first_y, last_y) into size_x-by-size_y
+  /// tiles and set up the task grid and band locks.
+  void InitializeTasks(
+      Node first_x, Node last_x, Node first_y, Node last_y, size_t size_x,
+      size_t size_y) {
+    const size_t num_x_blocks = (size_t{last_x - first_x} + size_x - 1) / size_x;
+    const size_t num_y_blocks = (size_t{last_y - first_y} + size_y - 1) / size_y;
+    const size_t num_blocks = num_x_blocks * num_y_blocks;
+
+    locks_[0] = std::vector<SpinLock>(num_x_blocks);
+    locks_[1] = std::vector<SpinLock>(num_y_blocks);
+    tasks_ = std::vector<Task>(num_blocks);
+
+    for (size_t i = 0; i < num_blocks; ++i) {
+      Task& task = tasks_[i];
+      task.coord = {{i % num_x_blocks, i / num_x_blocks}};
+      auto x_range = katana::block_range(
+          first_x, last_x, task.coord[0], num_x_blocks);
+      task.start_x = x_range.first;
+      task.end_x = x_range.second;
+      auto y_range = katana::block_range(
+          first_y, last_y, task.coord[1], num_y_blocks);
+      task.start_y = y_range.first;
+      task.end_y_inclusive = y_range.second - 1;
+    }
+  }
+
+public:
+  /// Default per-tile working set budget; sized for a typical L2.
+  static constexpr size_t kDefaultL2Bytes = 1 << 20;
+
+  struct TileShape {
+    size_t size_x;
+    size_t size_y;
+  };
+
+  /// Derives a tile shape whose working set fits the cache budget.
+  /// bytes_per_x / bytes_per_y are the property bytes an operator
+  /// touches per X node and per Y node (latent vectors, feature rows);
+  /// each side gets half the budget.
+  static TileShape ComputeTileShape(
+      size_t bytes_per_x, size_t bytes_per_y,
+      size_t cache_bytes = kDefaultL2Bytes) {
+    TileShape shape;
+    shape.size_x = std::max(size_t{16}, cache_bytes / 2 / std::max(bytes_per_x, size_t{1}));
+    shape.size_y = std::max(size_t{16}, cache_bytes / 2 / std::max(bytes_per_y, size_t{1}));
+    return shape;
+  }
+
+  Tiled2DExecutor(const Topology& topo) : topo_(topo) {}
+
+  Tiled2DExecutor(const Tiled2DExecutor&) = delete;
+  Tiled2DExecutor& operator=(const Tiled2DExecutor&) = delete;
+
+  ~Tiled2DExecutor() {
+    katana::ReportStatSingle(
+        "Tiled2DExecutor", "ProbeFailures", failed_probes_.reduce());
+  }
+
+  /// Apply fn(x, y, edge) to every edge in
+  /// [first_x, last_x) x [first_y, last_y), tile by tile, num_iterations
+  /// times per tile. With use_locks no two concurrent tiles share an X
+  /// or Y band, so fn may update per-node state on both endpoints
+  /// without atomics.
+  template <typename Function>
+  void Execute(
+      Node first_x, Node last_x, Node first_y, Node last_y, size_t size_x,
+      size_t size_y, Function fn, bool use_locks,
+      unsigned num_iterations = 1) {
+    InitializeTasks(first_x, last_x, first_y, last_y, size_x, size_y);
+    max_updates_ = num_iterations;
+    use_locks_ = use_locks;
+
+    katana::on_each([&](unsigned tid, unsigned total) {
+      ExecuteLoop<false>(fn, tid, total);
+    });
+
+    if (std::any_of(tasks_.begin(), tasks_.end(), [this](Task& t) {
+          return t.updates.value < max_updates_;
+        })) {
+      katana::gWarn("Missing tasks");
+    }
+  }
+
+  /// Dense variant of Execute: fn(x, y) runs for every pair in the
+  /// rectangle whether or not the edge exists.
+  template <typename Function>
+  void ExecuteDense(
+      Node first_x, Node last_x, Node first_y, Node last_y, size_t size_x,
+      size_t size_y, Function fn, bool use_locks,
+      unsigned num_iterations = 1) {
+    InitializeTasks(first_x, last_x, first_y, last_y, size_x, size_y);
+    max_updates_ = num_iterations;
+    use_locks_ = use_locks;
+
+    katana::on_each([&](unsigned tid, unsigned total) {
+      ExecuteLoop<true>(fn, tid, total);
+    });
+
+    if (std::any_of(tasks_.begin(), tasks_.end(), [this](Task& t) {
+          return t.updates.value < max_updates_;
+        })) {
+      katana::gWarn("Missing tasks");
+    }
+  }
+};
+
+/// Tiled SpMM-like feature propagation: for every edge (x, y) with
+/// weight w, out[x * num_features ..] += w * in[y * num_features ..].
+/// Tiles are sized so the X and Y feature rows a tile touches fit in
+/// cache together, and band locking makes the row updates exclusive, so
+/// the inner loop is a plain non-atomic AXPY over the feature vectors.
+///
+/// weight_fn maps an edge id to its scalar weight; pass a lambda
+/// returning 1 for an unweighted aggregation. Requires adjacency lists
+/// sorted by destination id.
+template <typename Topology, typename T, typename WeightFn>
+void
+TiledFeaturePropagation(
+    const Topology& topo, const T* in, T* out, size_t num_features,
+    WeightFn weight_fn,
+    size_t cache_bytes = Tiled2DExecutor<Topology>::kDefaultL2Bytes) {
+  using Node = GraphTopologyTypes::Node;
+  using Edge = GraphTopologyTypes::Edge;
+
+  Tiled2DExecutor<Topology> executor(topo);
+  const size_t bytes_per_row = num_features * sizeof(T);
+  auto shape = Tiled2DExecutor<Topology>::ComputeTileShape(
+      bytes_per_row, bytes_per_row, cache_bytes);
+
+  const auto num_nodes = static_cast<Node>(topo.NumNodes());
+  executor.Execute(
+      Node{0}, num_nodes, Node{0}, num_nodes, shape.size_x, shape.size_y,
+      [&](Node x, Node y, Edge e) {
+        const T w = weight_fn(e);
+        const T* src_row = &in[size_t{y} * num_features];
+        T* dst_row = &out[size_t{x} * num_features];
+        for (size_t i = 0; i < num_features; ++i) {
+          dst_row[i] += w * src_row[i];
+        }
+      },
+      /*use_locks=*/true);
+}
+
+}  // namespace katana
+
+#endif
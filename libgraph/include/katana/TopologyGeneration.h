@@ -35,6 +35,45 @@ KATANA_EXPORT std::unique_ptr<katana::PropertyGraph> MakeClique(
 KATANA_EXPORT std::unique_ptr<katana::PropertyGraph> MakeTriangle(
     size_t num_rows) noexcept;
 
+/**********************************************************/
+/* Functions for generating synthetic random topologies   */
+/**********************************************************/
+
+/// Generates a uniform random (Erdos-Renyi style G(n, m)) directed
+/// topology: num_edges edges whose endpoints are drawn independently and
+/// uniformly from [0, num_nodes).
+///
+/// Edges are generated in parallel in fixed-size blocks, each seeded from
+/// (seed, block), so the result is deterministic for a given seed
+/// regardless of the number of threads.
+KATANA_EXPORT GraphTopology MakeUniformRandomTopology(
+    GraphTopology::Node num_nodes, GraphTopology::Edge num_edges,
+    uint32_t seed) noexcept;
+
+/// Generates an R-MAT (stochastic Kronecker) directed topology with
+/// 2^scale nodes and num_edges edges. a, b and c are the probabilities of
+/// recursing into the top-left, top-right and bottom-left quadrants of
+/// the adjacency matrix; the bottom-right probability is 1 - a - b - c.
+/// Graph500-style inputs use a = 0.57, b = c = 0.19.
+///
+/// Deterministic for a given seed independent of thread count; see
+/// MakeUniformRandomTopology.
+KATANA_EXPORT GraphTopology MakeRMATTopology(
+    uint32_t scale, GraphTopology::Edge num_edges, double a, double b, double c,
+    uint32_t seed) noexcept;
+
+/// Convenience wrapper around MakeUniformRandomTopology returning a
+/// PropertyGraph with no properties.
+KATANA_EXPORT std::unique_ptr<katana::PropertyGraph> MakeUniformRandomGraph(
+    GraphTopology::Node num_nodes, GraphTopology::Edge num_edges,
+    uint32_t seed) noexcept;
+
+/// Convenience wrapper around MakeRMATTopology returning a PropertyGraph
+/// with no properties.
+KATANA_EXPORT std::unique_ptr<katana::PropertyGraph> MakeRMATGraph(
+    uint32_t scale, GraphTopology::Edge num_edges, double a, double b, double c,
+    uint32_t seed) noexcept;
+
 /***********************************************************/
 /* Functions for adding node and edge properties to graphs */
 /***********************************************************/
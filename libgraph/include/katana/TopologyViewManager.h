@@ -0,0 +1,46 @@
+#pragma once
+
+#include <mutex>
+#include <unordered_set>
+
+#include "katana/Manager.h"
+#include "katana/config.h"
+
+namespace katana {
+
+class PropertyGraph;
+
+/// Manager that reclaims cached topology views under memory pressure.
+///
+/// The PropertyManager already lets the MemorySupervisor evict cold property
+/// columns; this extends reclamation to the other large per-graph resource,
+/// the topology views accumulated in each graph's PGViewCache. Long-running
+/// services register their long-lived graphs with TrackGraph; when the
+/// supervisor asks for memory, unused views are dropped (and rebuilt on
+/// demand if needed again) instead of the process growing toward the OOM
+/// killer.
+///
+/// Tracking is opt-in because the manager holds raw graph pointers: a
+/// tracked graph must stay at a stable address and must be untracked before
+/// it is destroyed or moved.
+class KATANA_EXPORT TopologyViewManager : public Manager {
+public:
+  static const std::string name_;
+  const std::string& Name() const override { return name_; }
+
+  count_t FreeStandbyMemory(count_t goal) override;
+
+  /// Start tracking \p pg; installs the manager in the MemorySupervisor on
+  /// first use.
+  static void TrackGraph(PropertyGraph* pg);
+  /// Stop tracking \p pg; must be called before the graph is destroyed.
+  static void UntrackGraph(PropertyGraph* pg);
+
+private:
+  static TopologyViewManager* Instance();
+
+  std::mutex lock_;
+  std::unordered_set<PropertyGraph*> graphs_;
+};
+
+}  // namespace katana
@@ -0,0 +1,97 @@
+#ifndef KATANA_LIBGRAPH_KATANA_VERSIONEDGRAPH_H_
+#define KATANA_LIBGRAPH_KATANA_VERSIONEDGRAPH_H_
+
+/// Snapshot isolation between read queries and streaming ingest.
+///
+/// TxnContext serializes writers, but a reader that wants a consistent
+/// view across a long query otherwise has to reopen the graph. A
+/// VersionedGraph holds the chain head of immutable graph versions (as
+/// produced by StreamingEdgeIngestor::Merge): readers pin the current
+/// version for the duration of a query, writers publish new versions
+/// without waiting for readers, and superseded versions are reclaimed
+/// through EpochManager once the last query pinned on them finishes.
+/// Short queries are never blocked behind a long merge; they simply run
+/// against the version that was current when they started.
+///
+/// \file
+
+#include <atomic>
+#include <memory>
+
+#include "katana/EpochReclamation.h"
+#include "katana/PropertyGraph.h"
+#include "katana/config.h"
+
+namespace katana {
+
+class KATANA_EXPORT VersionedGraph {
+public:
+  /// Pins one graph version for the lifetime of the guard. The pinned
+  /// graph must be treated as read-only.
+  ///
+  /// A guard stalls epoch advancement while it is open, which is the
+  /// point: superseded versions accumulate (bounded by the number of
+  /// merges published during the query) instead of readers blocking.
+  /// Only the thread coordinating a query needs a guard; worker threads
+  /// inside a do_all over the pinned graph are covered by it. Guards
+  /// must not be nested on one thread.
+  class ReadGuard {
+  public:
+    const PropertyGraph& graph() const { return *graph_; }
+
+    ReadGuard(const ReadGuard&) = delete;
+    ReadGuard& operator=(const ReadGuard&) = delete;
+
+  private:
+    friend class VersionedGraph;
+
+    ReadGuard(EpochManager* epochs, const std::atomic<PropertyGraph*>* head)
+        : guard_(epochs), graph_(head->load(std::memory_order_acquire)) {}
+
+    // The guard must open before the head is read: a version retired
+    // after that cannot be freed until this epoch is two behind, and a
+    // version retired before it is not the one we loaded.
+    EpochManager::Guard guard_;
+    const PropertyGraph* graph_;
+  };
+
+  explicit VersionedGraph(std::unique_ptr<PropertyGraph> initial)
+      : head_(initial.release()) {}
+
+  VersionedGraph(const VersionedGraph&) = delete;
+  VersionedGraph& operator=(const VersionedGraph&) = delete;
+
+  ~VersionedGraph() {
+    // ~EpochManager drains retired versions; the head is still live.
+    delete head_.load(std::memory_order_relaxed);
+  }
+
+  /// Pin the current version. Cheap enough for per-query use: one
+  /// per-thread store and one load, no reference count contention.
+  ReadGuard Pin() { return ReadGuard(&epochs_, &head_); }
+
+  /// Publish \p next as the current version and retire the version it
+  /// replaces. Writers are expected to be serialized already (TxnContext
+  /// admits one writer); Publish never waits on readers. Must not be
+  /// called while the calling thread holds a ReadGuard.
+  void Publish(std::unique_ptr<PropertyGraph> next) {
+    PropertyGraph* old =
+        head_.exchange(next.release(), std::memory_order_acq_rel);
+    EpochManager::Guard guard(&epochs_);
+    epochs_.Retire(old);
+  }
+
+  /// Unpinned peek at the current version, for stats and logging only;
+  /// the pointer may be retired by a concurrent Publish at any time.
+  const PropertyGraph* current() const {
+    return head_.load(std::memory_order_acquire);
+  }
+
+private:
+  std::atomic<PropertyGraph*> head_;
+  EpochManager epochs_;
+};
+
+}  // namespace katana
+
+#endif
@@ -0,0 +1,44 @@
+#ifndef KATANA_LIBGRAPH_KATANA_ANALYTICS_APPROXIMATEANALYTICS_H_
+#define KATANA_LIBGRAPH_KATANA_ANALYTICS_APPROXIMATEANALYTICS_H_
+
+#include <cstdint>
+
+#include "katana/PropertyGraph.h"
+#include "katana/Result.h"
+#include "katana/config.h"
+
+namespace katana::analytics {
+
+/// A point estimate with a confidence interval, from a sampled run.
+struct KATANA_EXPORT ApproxStatistic {
+  double estimate{0.0};
+  double ci_lower{0.0};
+  double ci_upper{0.0};
+  uint64_t sample_size{0};
+};
+
+/// Normal-approximation confidence interval for a proportion of
+/// \p successes out of \p trials. \p confidence of 0.90, 0.95 (default)
+/// and 0.99 map to exact z values; anything else falls back to 0.95.
+KATANA_EXPORT ApproxStatistic ProportionEstimate(
+    uint64_t successes, uint64_t trials, double confidence = 0.95);
+
+/// Estimate the fraction of nodes in the largest connected component from
+/// a random edge sample of \p sample_edges edges (edge sampling preserves
+/// connectivity structure far better than node sampling). The interval is
+/// a proportion CI over the sampled nodes; induced sampling still
+/// under-connects, so the estimate is a lower bound in expectation.
+KATANA_EXPORT Result<ApproxStatistic> EstimateLargestComponentFraction(
+    const PropertyGraph& graph, uint64_t sample_edges = 100000,
+    uint32_t seed = 0);
+
+/// Estimate the fraction of PageRank mass held by the top \p top_fraction
+/// of nodes, from PageRank run to convergence on a random edge sample.
+/// The interval is a percentile bootstrap over the sampled per-node ranks.
+KATANA_EXPORT Result<ApproxStatistic> EstimatePageRankTopMass(
+    const PropertyGraph& graph, double top_fraction = 0.01,
+    uint64_t sample_edges = 100000, uint32_t seed = 0);
+
+}  // namespace katana::analytics
+
+#endif
@@ -24,6 +24,7 @@
 #include <cstdlib>
 #include <iostream>
 
+#include "katana/GraphHelpers.h"
 #include "katana/analytics/Utils.h"
 
 namespace katana::analytics {
@@ -251,19 +252,24 @@ struct BfsSsspImplementationBase {
       if (sd == kDistanceInfinity)
         return;
 
-      for (auto ii : g->OutEdges(node)) {
-        auto dest = g->OutEdgeDst(ii);
-        Dist dd = g->template GetData<NodeProp>(dest);
-        Dist ew = getEdgeWeight<USE_EDGE_WT>(ii);
-        if (dd > sd + ew) {
-          KATANA_LOG_DEBUG(
-              "Wrong label: {}, on node: {}, correct label from src node {} is "
-              "{}",
-              dd, dest, node, sd + ew);
-          refb = true;
-          // return;
-        }
-      }
+      katana::VisitEdgesPrefetched(
+          g->OutEdges(node),
+          [&](const auto& e) {
+            return &g->template GetData<NodeProp>(g->OutEdgeDst(e));
+          },
+          [&](const auto& ii) {
+            auto dest = g->OutEdgeDst(ii);
+            Dist dd = g->template GetData<NodeProp>(dest);
+            Dist ew = getEdgeWeight<USE_EDGE_WT>(ii);
+            if (dd > sd + ew) {
+              KATANA_LOG_DEBUG(
+                  "Wrong label: {}, on node: {}, correct label from src node "
+                  "{} is {}",
+                  dd, dest, node, sd + ew);
+              refb = true;
+              // return;
+            }
+          });
     }
   };
 
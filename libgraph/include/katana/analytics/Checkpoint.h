@@ -0,0 +1,111 @@
+#ifndef KATANA_LIBGRAPH_KATANA_ANALYTICS_CHECKPOINT_H_
+#define KATANA_LIBGRAPH_KATANA_ANALYTICS_CHECKPOINT_H_
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "katana/NUMAArray.h"
+#include "katana/Result.h"
+#include "katana/config.h"
+
+namespace katana {
+
+class WriteGroup;
+
+namespace analytics {
+
+/// Cooperative checkpointing of algorithm state for long-running analytics.
+///
+/// An algorithm registers the flat arrays that define its progress
+/// (community assignments, ranks) and calls Snapshot between rounds. Each
+/// snapshot hashes the arrays in fixed-size chunks and uploads only the
+/// chunks that changed since the previous snapshot, asynchronously through
+/// a tsuba WriteGroup, so the next round computes while the dirty chunks
+/// drain to storage. The manifest naming a snapshot is written only after
+/// all of its chunks have landed, so a run killed mid-upload restores the
+/// previous complete snapshot rather than a torn one.
+///
+/// Restore refills the registered arrays from the newest manifest under the
+/// same prefix; the caller is responsible for re-running any per-round setup
+/// that is derived from them.
+class KATANA_EXPORT AlgoCheckpointer {
+public:
+  static constexpr uint64_t kDefaultChunkSize = 8ULL << 20;
+
+  explicit AlgoCheckpointer(
+      std::string uri_prefix, uint64_t chunk_size = kDefaultChunkSize);
+
+  AlgoCheckpointer(const AlgoCheckpointer&) = delete;
+  AlgoCheckpointer& operator=(const AlgoCheckpointer&) = delete;
+
+  /// Waits for in-flight chunk uploads and commits their manifest; failures
+  /// at this point are logged because a destructor cannot return them. Call
+  /// Flush first when the final snapshot must be known to have landed.
+  ~AlgoCheckpointer();
+
+  /// Register a state array under a stable name. The array must stay live
+  /// and keep its address and size until UnregisterAll; re-register after
+  /// anything that reallocates it.
+  template <typename T>
+  void RegisterArray(const std::string& name, katana::NUMAArray<T>* array) {
+    static_assert(
+        std::is_trivially_copyable_v<T>,
+        "checkpointed arrays are snapshotted bytewise");
+    RegisterRawArray(
+        name, reinterpret_cast<uint8_t*>(array->data()),
+        array->size() * sizeof(T));
+  }
+
+  void RegisterRawArray(
+      const std::string& name, uint8_t* data, uint64_t num_bytes);
+
+  /// Drop all registrations (in-flight uploads of their chunks still
+  /// complete; the frames own copies of the data).
+  void UnregisterAll();
+
+  /// Snapshot the registered arrays as of now. Waits for the previous
+  /// snapshot's uploads and commits its manifest, then starts async uploads
+  /// of this round's dirty chunks and returns; the arrays may be mutated
+  /// freely afterwards. \p round is recorded in the manifest and handed
+  /// back by Restore.
+  katana::Result<void> Snapshot(uint64_t round);
+
+  /// Wait for the last snapshot's uploads and commit its manifest.
+  katana::Result<void> Flush();
+
+  /// Refill the registered arrays from the newest committed snapshot and
+  /// return its round. Fails with ErrorCode::NotFound when no manifest
+  /// exists under the prefix, and with ErrorCode::InvalidArgument when the
+  /// registered arrays do not match the checkpointed ones.
+  katana::Result<uint64_t> Restore();
+
+private:
+  struct RegisteredArray {
+    std::string name;
+    uint8_t* data;
+    uint64_t num_bytes;
+    /// Hash of each chunk as of the last snapshot; chunks whose current
+    /// hash differs are dirty. Zero-initialized so every chunk is dirty on
+    /// the first snapshot.
+    std::vector<uint64_t> chunk_hashes;
+  };
+
+  std::string ChunkUri(const std::string& name, uint64_t chunk) const;
+  std::string ManifestUri() const;
+  katana::Result<void> CommitPending();
+
+  std::string uri_prefix_;
+  uint64_t chunk_size_;
+  std::vector<RegisteredArray> arrays_;
+  std::unique_ptr<katana::WriteGroup> in_flight_;
+  /// Manifest describing the uploads in in_flight_; stored once they finish.
+  std::string pending_manifest_;
+};
+
+}  // namespace analytics
+}  // namespace katana
+
+#endif
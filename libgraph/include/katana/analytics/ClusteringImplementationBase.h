@@ -86,11 +86,11 @@ struct ClusteringImplementationBase {
    * in cluster_local_map, total unique cluster edge weights
    * in counter as well as total weight of self edges in self_loop_wt.
    */
-  template <typename EdgeWeightType>
+  template <
+      typename EdgeWeightType, typename CommunityMapTy, typename CounterTy>
   static void FindNeighboringClusters(
-      const Graph& graph, const GNode& n,
-      std::map<uint64_t, uint64_t>& cluster_local_map,
-      std::vector<EdgeTy>& counter, EdgeTy& self_loop_wt) {
+      const Graph& graph, const GNode& n, CommunityMapTy& cluster_local_map,
+      CounterTy& counter, EdgeTy& self_loop_wt) {
     uint64_t num_unique_clusters = 0;
 
     // Add the node's current cluster to be considered
@@ -275,9 +275,10 @@ struct ClusteringImplementationBase {
    * Computes the modularity gain of the current cluster assignment
    * without swapping the cluster assignment.
    */
+  template <typename CommunityMapTy, typename CounterTy>
   static uint64_t MaxModularityWithoutSwaps(
-      std::map<uint64_t, uint64_t>& cluster_local_map,
-      std::vector<EdgeTy>& counter, uint64_t self_loop_wt,
+      CommunityMapTy& cluster_local_map, CounterTy& counter,
+      uint64_t self_loop_wt,
       CommunityArray& c_info, EdgeTy degree_wt, uint64_t sc, double constant) {
     uint64_t max_index = sc;  // Assign the intial value as self community
     double cur_gain = 0;
@@ -561,27 +562,84 @@ struct ClusteringImplementationBase {
 
     const uint64_t num_nodes_next = num_unique_clusters;
 
-    std::vector<std::vector<GNode>> cluster_bags(num_unique_clusters);
-    // TODO(amber): This loop can be parallelized when using a concurrent container
-    // for cluster_bags, but something like katana::InsertBag exhausts the
-    // per-thread-storage memory
-    for (GNode n = 0; n < graph.NumNodes(); ++n) {
-      auto n_data_curr_comm_id = graph.template GetData<CommunityIDType>(n);
-      if (n_data_curr_comm_id != UNASSIGNED) {
-        cluster_bags[n_data_curr_comm_id].push_back(n);
-      }
-    }
+    // Group nodes by community with a parallel counting sort: count members
+    // per cluster, prefix sum the counts into start offsets, then scatter
+    // node ids using the counts as per-cluster cursors. This replaces the
+    // old serial vector-of-vectors build without the per-thread-storage
+    // blowup a concurrent bag per cluster would cause.
+    katana::NUMAArray<std::atomic<uint64_t>> cluster_cursor;
+    cluster_cursor.allocateInterleaved(num_unique_clusters);
+    katana::NUMAArray<uint64_t> cluster_member_end;
+    cluster_member_end.allocateInterleaved(num_unique_clusters);
+
+    katana::do_all(
+        katana::iterate(uint64_t{0}, num_unique_clusters), [&](uint64_t c) {
+          cluster_cursor[c].store(0, std::memory_order_relaxed);
+        });
+
+    katana::GAccumulator<uint64_t> num_assigned_nodes;
+    katana::do_all(
+        katana::iterate(graph),
+        [&](GNode n) {
+          auto n_data_curr_comm_id =
+              graph.template GetData<CommunityIDType>(n);
+          if (n_data_curr_comm_id != UNASSIGNED) {
+            cluster_cursor[n_data_curr_comm_id].fetch_add(
+                1, std::memory_order_relaxed);
+            num_assigned_nodes += 1;
+          }
+        },
+        katana::no_stats(), katana::loopname("BuildGraph: Count members"));
+
+    katana::do_all(
+        katana::iterate(uint64_t{0}, num_unique_clusters), [&](uint64_t c) {
+          cluster_member_end[c] =
+              cluster_cursor[c].load(std::memory_order_relaxed);
+          cluster_cursor[c].store(0, std::memory_order_relaxed);
+        });
+    katana::ParallelSTL::partial_sum(
+        cluster_member_end.begin(), cluster_member_end.end(),
+        cluster_member_end.begin());
+
+    katana::NUMAArray<GNode> cluster_members;
+    cluster_members.allocateInterleaved(num_assigned_nodes.reduce());
+    katana::do_all(
+        katana::iterate(graph),
+        [&](GNode n) {
+          auto n_data_curr_comm_id =
+              graph.template GetData<CommunityIDType>(n);
+          if (n_data_curr_comm_id != UNASSIGNED) {
+            uint64_t base = (n_data_curr_comm_id == 0)
+                                ? 0
+                                : cluster_member_end[n_data_curr_comm_id - 1];
+            uint64_t idx =
+                base + cluster_cursor[n_data_curr_comm_id].fetch_add(
+                           1, std::memory_order_relaxed);
+            cluster_members[idx] = n;
+          }
+        },
+        katana::no_stats(), katana::loopname("BuildGraph: Scatter members"));
 
     std::vector<katana::gstl::Vector<uint32_t>> edges_id(num_unique_clusters);
     std::vector<katana::gstl::Vector<EdgeTy>> edges_data(num_unique_clusters);
 
+    // Per-thread arena backing the transient community-edge maps below;
+    // rewound after every cluster.
+    katana::PerRoundArenaHeap arena;
+    using CoarsenMapAlloc =
+        katana::gstl::ArenaAlloc<std::pair<const uint64_t, uint64_t>>;
+
     /* First pass to find the number of edges */
     katana::do_all(
         katana::iterate(uint64_t{0}, num_unique_clusters),
         [&](uint64_t c) {
-          katana::gstl::Map<uint64_t, uint64_t> cluster_local_map;
+          katana::gstl::ArenaUnorderedMap<uint64_t, uint64_t>
+              cluster_local_map{CoarsenMapAlloc(&arena)};
           uint64_t num_unique_clusters = 0;
-          for (auto node : cluster_bags[c]) {
+          const uint64_t members_begin =
+              (c == 0) ? 0 : cluster_member_end[c - 1];
+          for (uint64_t m = members_begin; m < cluster_member_end[c]; ++m) {
+            GNode node = cluster_members[m];
             KATANA_LOG_DEBUG_ASSERT(
                 graph.template GetData<CommunityIDType>(node) ==
                 c);  // All nodes in this bag must have same cluster id
@@ -605,6 +663,8 @@ struct ClusteringImplementationBase {
               }
             }  // End edge loop
           }
+          // The map above is dead; reclaim its arena space.
+          arena.resetLocal();
         },
         katana::steal(), katana::loopname("BuildGraph: Find edges"));
 
@@ -1071,10 +1131,11 @@ struct ClusteringImplementationBase {
     comm_constant_term.destroy();
   }
 
-  template <typename EdgeWeightType>
+  template <
+      typename EdgeWeightType, typename CommunityMapTy, typename CounterTy>
   uint64_t MaxCPMQualityWithoutSwaps(
-      std::map<uint64_t, uint64_t>& cluster_local_map,
-      std::vector<EdgeWeightType>& counter, EdgeWeightType self_loop_wt,
+      CommunityMapTy& cluster_local_map, CounterTy& counter,
+      EdgeWeightType self_loop_wt,
       CommunityArray& c_info, uint64_t node_wt, uint64_t sc,
       double resolution) {
     uint64_t max_index = sc;  // Assign the initial value as self community
@@ -0,0 +1,55 @@
+#ifndef KATANA_LIBGRAPH_KATANA_ANALYTICS_GPUBACKEND_H_
+#define KATANA_LIBGRAPH_KATANA_ANALYTICS_GPUBACKEND_H_
+
+#include <cstdint>
+#include <string>
+
+#include "katana/Result.h"
+#include "katana/config.h"
+
+namespace katana {
+
+class PropertyGraph;
+class TxnContext;
+
+namespace analytics {
+
+/// Entry points implemented by a GPU analytics backend.
+///
+/// libgraph never links against CUDA. A backend (libgpu) fills in this
+/// table and registers it with SetGpuBackend at startup; the analytics
+/// entry points dispatch through it whenever a plan requests
+/// Architecture::kGPU. An entry may be null, meaning the backend does not
+/// implement that algorithm; the caller then falls back to its CPU path,
+/// as it does when no backend is registered at all.
+///
+/// Each entry has the same contract as the corresponding CPU entry point:
+/// it creates the output property, which may not exist before the call.
+struct GpuBackend {
+  Result<void> (*bfs)(
+      PropertyGraph* pg, uint32_t start_node,
+      const std::string& output_property_name, katana::TxnContext* txn_ctx);
+
+  Result<void> (*sssp)(
+      PropertyGraph* pg, size_t start_node,
+      const std::string& edge_weight_property_name,
+      const std::string& output_property_name, katana::TxnContext* txn_ctx);
+
+  Result<void> (*pagerank)(
+      PropertyGraph* pg, const std::string& output_property_name,
+      katana::TxnContext* txn_ctx, float tolerance, unsigned max_iterations,
+      float alpha);
+};
+
+/// Register the process-wide GPU backend, or clear it with null. The table
+/// must outlive every analytics call that dispatches through it; register
+/// once at startup, after runtime initialization.
+KATANA_EXPORT void SetGpuBackend(const GpuBackend* backend);
+
+/// The registered GPU backend, or null when none is registered.
+KATANA_EXPORT const GpuBackend* GetGpuBackend();
+
+}  // namespace analytics
+}  // namespace katana
+
+#endif
@@ -33,13 +33,33 @@ struct MatrixCompletionImplementationBase {
 
   // returns the result of the inner product of 2 NodeLatentVectors
   // assumes both vectors are of seize equal to LATENT_VECTOR_SIZE
+  // The elements are atomics; reading them through the implicit
+  // sequentially-consistent load defeats vectorization, so the values are
+  // pulled out with relaxed loads into independent accumulators that the
+  // compiler can turn into SIMD lanes. SGD tolerates the weaker ordering.
   template <typename NodeIndex>
   double InnerProduct(
       katana::PropertyReferenceType<NodeIndex> first_vector,
       katana::PropertyReferenceType<NodeIndex> second_vector) {
-    double res = 0;
-    for (int i = 0; i < LATENT_VECTOR_SIZE; i++) {
-      res += first_vector[i] * second_vector[i];
+    double acc0 = 0;
+    double acc1 = 0;
+    double acc2 = 0;
+    double acc3 = 0;
+    int i = 0;
+    for (; i + 4 <= LATENT_VECTOR_SIZE; i += 4) {
+      acc0 += first_vector[i].load(std::memory_order_relaxed) *
+              second_vector[i].load(std::memory_order_relaxed);
+      acc1 += first_vector[i + 1].load(std::memory_order_relaxed) *
+              second_vector[i + 1].load(std::memory_order_relaxed);
+      acc2 += first_vector[i + 2].load(std::memory_order_relaxed) *
+              second_vector[i + 2].load(std::memory_order_relaxed);
+      acc3 += first_vector[i + 3].load(std::memory_order_relaxed) *
+              second_vector[i + 3].load(std::memory_order_relaxed);
+    }
+    double res = (acc0 + acc1) + (acc2 + acc3);
+    for (; i < LATENT_VECTOR_SIZE; i++) {
+      res += first_vector[i].load(std::memory_order_relaxed) *
+             second_vector[i].load(std::memory_order_relaxed);
     }
     return res;
   }
@@ -0,0 +1,88 @@
+#ifndef KATANA_LIBGRAPH_KATANA_ANALYTICS_NODESWEEPPIPELINE_H_
+#define KATANA_LIBGRAPH_KATANA_ANALYTICS_NODESWEEPPIPELINE_H_
+
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "katana/GraphTopology.h"
+#include "katana/Loops.h"
+
+namespace katana::analytics {
+
+/// Run several per-node operators in one parallel sweep over the topology.
+///
+/// Each operator conforms to <code>fn(const GraphTopology& topo, Node n)</code>
+/// and may walk n's out-edges itself. Because all operators for a node run
+/// back to back, the node's adjacency list is read from DRAM once and the
+/// later operators hit it in cache — back-to-back analytics that each sweep
+/// the full topology pay that traffic once instead of once per analytic.
+///
+/// Operators known at compile time should use this variadic form, which
+/// fuses with no per-node indirection; NodeSweepPipeline is the runtime
+/// counterpart for composing phases across separately written analytics.
+template <typename... OpTys>
+void
+FusedNodeSweep(const GraphTopology& topo, OpTys&&... ops) {
+  katana::do_all(
+      katana::iterate(topo.Nodes()),
+      [&](GraphTopologyTypes::Node node) { (ops(topo, node), ...); },
+      katana::steal(), katana::loopname("FusedNodeSweep"));
+}
+
+/// Collects node-sweep phases from different analytics and runs the batch
+/// in one fused topology traversal.
+///
+/// Phases added between calls to Run must be independent: they execute
+/// interleaved per node, not one after the other, so a phase must not read
+/// state another phase in the same batch writes. Round-based analytics
+/// (pagerank power iterations, k-core peeling rounds, degree statistics)
+/// fit naturally — each round is one phase, and rounds of different
+/// analytics fuse as long as they only communicate through their own
+/// arrays.
+///
+/// \code
+/// NodeSweepPipeline pipeline(pg->topology());
+/// pipeline.AddPhase([&](const auto& topo, auto n) { degrees[n] = ...; });
+/// pipeline.AddPhase([&](const auto& topo, auto n) { rank_next[n] = ...; });
+/// pipeline.Run();  // one traversal, both features
+/// \endcode
+class NodeSweepPipeline {
+public:
+  using Node = GraphTopologyTypes::Node;
+  using PhaseFn = std::function<void(const GraphTopology&, Node)>;
+
+  explicit NodeSweepPipeline(const GraphTopology& topo) : topo_(topo) {}
+
+  /// Queue a per-node operator for the next fused sweep.
+  void AddPhase(PhaseFn fn) { phases_.emplace_back(std::move(fn)); }
+
+  size_t NumPendingPhases() const { return phases_.size(); }
+
+  /// Run all queued phases in one parallel traversal and clear the queue.
+  /// The per-node indirection of the type-erased phases is amortized over
+  /// each phase's edge loop; pipelines of compile-time-known operators
+  /// should call FusedNodeSweep directly.
+  void Run() {
+    if (phases_.empty()) {
+      return;
+    }
+    katana::do_all(
+        katana::iterate(topo_.Nodes()),
+        [&](Node node) {
+          for (const PhaseFn& phase : phases_) {
+            phase(topo_, node);
+          }
+        },
+        katana::steal(), katana::loopname("NodeSweepPipeline"));
+    phases_.clear();
+  }
+
+private:
+  const GraphTopology& topo_;
+  std::vector<PhaseFn> phases_;
+};
+
+}  // namespace katana::analytics
+
+#endif
@@ -1,7 +1,18 @@
 #ifndef KATANA_LIBGRAPH_KATANA_ANALYTICS_PLAN_H_
 #define KATANA_LIBGRAPH_KATANA_ANALYTICS_PLAN_H_
 
-namespace katana::analytics {
+#include <future>
+#include <string>
+#include <vector>
+
+#include "katana/Result.h"
+#include "katana/config.h"
+
+namespace katana {
+
+class PropertyGraph;
+
+namespace analytics {
 
 enum Architecture {
   /// Local execution using CPUs only
@@ -29,6 +40,8 @@ enum Architecture {
 /// larger graph.
 class Plan {
   Architecture architecture_;
+  std::vector<std::string> required_node_properties_;
+  std::vector<std::string> required_edge_properties_;
 
 protected:
   explicit Plan(Architecture architecture) : architecture_(architecture) {}
@@ -36,8 +49,35 @@ protected:
 public:
   /// The architecture on which the algorithm will run.
   Architecture architecture() const { return architecture_; }
+
+  /// The properties the algorithm will read, declared up front so the
+  /// runtime can prefetch exactly these (see PrefetchRequiredProperties)
+  /// instead of loading every column the graph carries.
+  const std::vector<std::string>& required_node_properties() const {
+    return required_node_properties_;
+  }
+  const std::vector<std::string>& required_edge_properties() const {
+    return required_edge_properties_;
+  }
+
+  /// Declare a node property the algorithm will read.
+  void RequireNodeProperty(std::string name) {
+    required_node_properties_.emplace_back(std::move(name));
+  }
+  /// Declare an edge property the algorithm will read.
+  void RequireEdgeProperty(std::string name) {
+    required_edge_properties_.emplace_back(std::move(name));
+  }
 };
 
-}  // namespace katana::analytics
+/// Asynchronously load the properties a plan declares as required, so the
+/// reads overlap with topology view construction. Properties that are
+/// already loaded are skipped; nothing else is loaded. The returned future
+/// must be resolved before the properties are accessed.
+KATANA_EXPORT std::future<CopyableResult<void>> PrefetchRequiredProperties(
+    PropertyGraph* pg, const Plan& plan);
+
+}  // namespace analytics
+}  // namespace katana
 
 #endif  //KATANA_PLAN_H_
@@ -0,0 +1,59 @@
+#ifndef KATANA_LIBGRAPH_KATANA_ANALYTICS_PLANPROFILE_H_
+#define KATANA_LIBGRAPH_KATANA_ANALYTICS_PLANPROFILE_H_
+
+#include <cstdint>
+
+#include "katana/PropertyGraph.h"
+#include "katana/analytics/bfs/bfs.h"
+#include "katana/analytics/louvain_clustering/louvain_clustering.h"
+#include "katana/analytics/sssp/sssp.h"
+#include "katana/config.h"
+
+namespace katana::analytics {
+
+/// Degree-distribution statistics for a graph, the features the plan
+/// auto-tuner keys its cost models on. Computing one samples up to a
+/// thousand non-isolated nodes, so it is cheap relative to any analytic
+/// but not free; GetPlanProfile caches and persists the result.
+struct KATANA_EXPORT GraphProfile {
+  uint64_t num_nodes{0};
+  uint64_t num_edges{0};
+  double average_degree{0.0};
+  double median_sampled_degree{0.0};
+  double p90_sampled_degree{0.0};
+  /// Same criterion as IsApproximateDegreeDistributionPowerLaw: the
+  /// sampled mean exceeding the sampled median by more than 30%.
+  bool is_power_law{false};
+
+  static GraphProfile Compute(const PropertyGraph& graph);
+};
+
+/// Return the profile for a graph, calibrating it on first use. Profiles
+/// are cached in-process per graph, and for graphs backed by an RDG also
+/// persisted as plan_profile.json in the RDG directory, so later loads of
+/// the same dataset skip calibration entirely. Persistence is best effort:
+/// read or write failures are logged and the profile is recomputed.
+KATANA_EXPORT GraphProfile GetPlanProfile(const PropertyGraph& graph);
+
+/// Drop cached profiles, e.g. after topology-changing mutations.
+KATANA_EXPORT void ClearPlanProfileCache();
+
+/// Pick an SSSP plan for a graph profile: a fused delta-step with a small
+/// delta for low-diameter power-law graphs, the barrier delta-step with the
+/// default delta for high-diameter graphs like road networks.
+KATANA_EXPORT SsspPlan AutoTuneSsspPlan(const GraphProfile& profile);
+
+/// Pick a BFS plan: direction-optimizing traversal pays off when frontiers
+/// get dense (power-law graphs); plain synchronous BFS avoids its
+/// per-round frontier-density checks everywhere else.
+KATANA_EXPORT BfsPlan AutoTuneBfsPlan(const GraphProfile& profile);
+
+/// Pick a Louvain plan: vertex following collapses the degree-1 fringe
+/// that dominates power-law graphs, and is skipped for mesh-like graphs
+/// where it only adds a pass.
+KATANA_EXPORT LouvainClusteringPlan AutoTuneLouvainClusteringPlan(
+    const GraphProfile& profile);
+
+}  // namespace katana::analytics
+
+#endif
@@ -0,0 +1,89 @@
+#ifndef KATANA_LIBGRAPH_KATANA_ANALYTICS_WORKSPACE_H_
+#define KATANA_LIBGRAPH_KATANA_ANALYTICS_WORKSPACE_H_
+
+#include <memory>
+#include <typeindex>
+#include <utility>
+
+#include "katana/NUMAArray.h"
+#include "katana/config.h"
+
+namespace katana::analytics {
+
+namespace internal {
+
+/// Identity of a pooled workspace buffer: the graph it was warmed against,
+/// the element type, and the entry count. Buffers are only reused for the
+/// same key, so a lease always comes back NUMA-placed and page-faulted for
+/// the right graph.
+struct WorkspaceKey {
+  const void* graph;
+  std::type_index type;
+  size_t size;
+
+  bool operator==(const WorkspaceKey& other) const {
+    return graph == other.graph && type == other.type && size == other.size;
+  }
+};
+
+KATANA_EXPORT std::shared_ptr<void> CheckOutWorkspace(const WorkspaceKey& key);
+KATANA_EXPORT void CheckInWorkspace(
+    const WorkspaceKey& key, std::shared_ptr<void> buffer);
+
+}  // namespace internal
+
+/// Drops every pooled workspace buffer. Call when graphs are unloaded or
+/// under memory pressure; leases currently held stay valid and are freed
+/// when they are returned (the pool re-admits them up to its per-key cap).
+KATANA_EXPORT void ClearWorkspacePool();
+
+/// An RAII lease on a NUMA-interleaved scratch array from a process-wide
+/// pool.
+///
+/// Analytics entry points allocate fresh NUMAArrays for per-run working
+/// state (distances, parents, frontiers); for a service issuing many small
+/// queries the allocation and first-touch page faults dominate latency.
+/// A lease checks a buffer out of the pool keyed by (graph, element type,
+/// entry count) and returns it on destruction, so repeated runs against the
+/// same graph reuse warmed, NUMA-placed memory. A pool miss falls back to a
+/// normal allocateInterleaved.
+///
+/// Like a fresh NUMAArray, the leased memory is uninitialized: it holds
+/// whatever the previous run left there, and callers must initialize the
+/// entries they use.
+template <typename T>
+class WorkspaceLease {
+  internal::WorkspaceKey key_;
+  std::shared_ptr<NUMAArray<T>> array_;
+
+public:
+  /// Leases an array of num_entries T. graph_key identifies the graph the
+  /// buffer belongs to (any stable address, e.g. the PropertyGraph).
+  WorkspaceLease(const void* graph_key, size_t num_entries)
+      : key_{graph_key, std::type_index(typeid(T)), num_entries} {
+    if (std::shared_ptr<void> cached = internal::CheckOutWorkspace(key_)) {
+      array_ = std::static_pointer_cast<NUMAArray<T>>(std::move(cached));
+    } else {
+      array_ = std::make_shared<NUMAArray<T>>();
+      array_->allocateInterleaved(num_entries);
+    }
+  }
+
+  ~WorkspaceLease() {
+    if (array_) {
+      internal::CheckInWorkspace(key_, std::move(array_));
+    }
+  }
+
+  WorkspaceLease(const WorkspaceLease&) = delete;
+  WorkspaceLease& operator=(const WorkspaceLease&) = delete;
+  WorkspaceLease(WorkspaceLease&&) = default;
+  WorkspaceLease& operator=(WorkspaceLease&&) = default;
+
+  NUMAArray<T>& array() { return *array_; }
+  const NUMAArray<T>& array() const { return *array_; }
+};
+
+}  // namespace katana::analytics
+
+#endif
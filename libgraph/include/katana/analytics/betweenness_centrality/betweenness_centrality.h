@@ -18,16 +18,31 @@ public:
   enum Algorithm {
     kLevel,
     kOuter,
+    kAdaptiveSampling,
     // TODO(gill): Reinstate async and auto once we have bidirectional graphs.
     // kAsynchronous,
     // kAutomatic,
   };
 
+  static constexpr float kDefaultEpsilon = 0.05;
+  static constexpr float kDefaultDelta = 0.1;
+
 private:
   Algorithm algorithm_;
+  float epsilon_;
+  float delta_;
 
   BetweennessCentralityPlan(Architecture architecture, Algorithm algorithm)
-      : Plan(architecture), algorithm_(algorithm) {}
+      : BetweennessCentralityPlan(
+            architecture, algorithm, kDefaultEpsilon, kDefaultDelta) {}
+
+  BetweennessCentralityPlan(
+      Architecture architecture, Algorithm algorithm, float epsilon,
+      float delta)
+      : Plan(architecture),
+        algorithm_(algorithm),
+        epsilon_(epsilon),
+        delta_(delta) {}
 
 public:
   BetweennessCentralityPlan() : BetweennessCentralityPlan{kCPU, kLevel} {}
@@ -50,11 +65,31 @@ public:
   }
 
   Algorithm algorithm() const { return algorithm_; }
+  /// Additive error bound on normalized centrality, only used by
+  /// kAdaptiveSampling.
+  float epsilon() const { return epsilon_; }
+  /// Probability that the epsilon bound is missed, only used by
+  /// kAdaptiveSampling.
+  float delta() const { return delta_; }
 
   static BetweennessCentralityPlan Level() { return {kCPU, kLevel}; }
 
   static BetweennessCentralityPlan Outer() { return {kCPU, kOuter}; }
 
+  /// Adaptive sampling approximation in the style of ABRA/KADABRA.
+  ///
+  /// Instead of one Brandes pass per graph node, sources are sampled
+  /// uniformly in batches until either the estimates stop moving or enough
+  /// samples have been taken to guarantee, with probability 1 - delta, that
+  /// every node's normalized centrality is within epsilon of the exact
+  /// value. The output property holds the estimated all-sources dependency
+  /// sum, directly comparable to the exact Level output. The sources
+  /// argument of BetweennessCentrality() is ignored by this algorithm.
+  static BetweennessCentralityPlan AdaptiveSampling(
+      float epsilon = kDefaultEpsilon, float delta = kDefaultDelta) {
+    return {kCPU, kAdaptiveSampling, epsilon, delta};
+  }
+
   static BetweennessCentralityPlan FromAlgorithm(Algorithm algo) {
     return BetweennessCentralityPlan(kCPU, algo);
   }
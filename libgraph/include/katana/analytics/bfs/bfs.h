@@ -2,6 +2,7 @@
 #define KATANA_LIBGRAPH_KATANA_ANALYTICS_BFS_BFS_H_
 
 #include <iostream>
+#include <vector>
 
 #include "katana/analytics/Plan.h"
 #include "katana/analytics/Utils.h"
@@ -68,6 +69,15 @@ public:
       uint32_t alpha = kDefaultAlpha, uint32_t beta = kDefaultBeta) {
     return {kCPU, kSynchronousDirectOpt, 0, alpha, beta};
   }
+
+  /// Run on the registered GPU backend (see GpuBackend.h). If no backend
+  /// is registered, or the backend does not implement BFS, the call falls
+  /// back to the default CPU algorithm.
+  static BfsPlan Gpu() {
+    return {
+        kGPU, kSynchronousDirectOpt, kDefaultEdgeTileSize, kDefaultAlpha,
+        kDefaultBeta};
+  }
 };
 
 /// Compute BFS parent of nodes in the graph pg starting from start_node. The
@@ -87,6 +97,22 @@ KATANA_EXPORT Result<void> Bfs(
 KATANA_EXPORT Result<void> BfsAssertValid(
     PropertyGraph* pg, uint32_t source, const std::string& property_name);
 
+/// Batched multi-source BFS (MS-BFS).
+///
+/// Runs a single breadth-first sweep from up to 64 sources at once using one
+/// 64-bit visited word per node: after the call, bit i of the uint64 value
+/// stored for a node in output_property_name is set iff that node is
+/// reachable from sources[i]. Frontier setup and edge traversals are shared
+/// across the whole batch, so workloads that issue many single-source BFS
+/// calls (all-pairs style reachability features) pay for one sweep instead of
+/// up to 64.
+///
+/// The property named output_property_name is created by this function and
+/// may not exist before the call.
+KATANA_EXPORT Result<void> BfsMultiSource(
+    PropertyGraph* pg, const std::vector<uint32_t>& sources,
+    const std::string& output_property_name, katana::TxnContext* txn_ctx);
+
 /// Statistics about a graph that can be extracted from the results of BFS.
 struct KATANA_EXPORT BfsStatistics {
   /// The number of nodes reachable from the source node.
@@ -0,0 +1,120 @@
+#ifndef KATANA_LIBGRAPH_KATANA_ANALYTICS_DISTANCEORACLE_DISTANCEORACLE_H_
+#define KATANA_LIBGRAPH_KATANA_ANALYTICS_DISTANCEORACLE_DISTANCEORACLE_H_
+
+#include <iostream>
+#include <string>
+
+#include "katana/NUMAArray.h"
+#include "katana/PropertyGraph.h"
+#include "katana/analytics/Plan.h"
+#include "katana/analytics/Utils.h"
+
+// API
+
+namespace katana::analytics {
+
+/// A computational plan for building a landmark distance oracle, specifying
+/// how many landmarks to use and how to choose them.
+class DistanceOraclePlan : public Plan {
+public:
+  /// Landmark selection strategies.
+  enum Selection {
+    /// Use the highest-degree nodes as landmarks. Hubs tend to lie on many
+    /// shortest paths, which tightens the bounds.
+    kHighestDegree,
+    /// Use uniformly random nodes as landmarks.
+    kRandom,
+  };
+
+  static const uint32_t kDefaultNumLandmarks = 16;
+
+  // Don't allow people to directly construct these, so as to have only one
+  // consistent way to configure.
+private:
+  Selection selection_;
+  uint32_t num_landmarks_;
+
+  DistanceOraclePlan(
+      Architecture architecture, Selection selection, uint32_t num_landmarks)
+      : Plan(architecture),
+        selection_(selection),
+        num_landmarks_(num_landmarks) {}
+
+public:
+  DistanceOraclePlan()
+      : DistanceOraclePlan{kCPU, kHighestDegree, kDefaultNumLandmarks} {}
+
+  Selection selection() const { return selection_; }
+
+  /// Number of landmarks; each one costs a shortest-path sweep at build
+  /// time and one label entry per node.
+  uint32_t num_landmarks() const { return num_landmarks_; }
+
+  static DistanceOraclePlan HighestDegree(
+      uint32_t num_landmarks = kDefaultNumLandmarks) {
+    return {kCPU, kHighestDegree, num_landmarks};
+  }
+
+  static DistanceOraclePlan Random(
+      uint32_t num_landmarks = kDefaultNumLandmarks) {
+    return {kCPU, kRandom, num_landmarks};
+  }
+};
+
+/// Precompute landmark distance labels for pg. One shortest-path sweep is
+/// run per landmark using the edge weights in edge_weight_property_name
+/// (which may be a 32- or 64-bit signed or unsigned int, or a float or
+/// double), and the distances from landmark i are stored in a node property
+/// named "<label_property_prefix>_<i>". The properties persist with the
+/// graph, so the build can run once per ingest and queries can be served
+/// from the stored labels from then on. The pg is expected to be symmetric
+/// so that landmark distances bound point-to-point distances in both
+/// directions. The label properties are created by this function and may
+/// not exist before the call.
+KATANA_EXPORT Result<void> BuildDistanceOracle(
+    PropertyGraph* pg, const std::string& edge_weight_property_name,
+    const std::string& label_property_prefix, katana::TxnContext* txn_ctx,
+    DistanceOraclePlan plan = {});
+
+/// A point-to-point distance oracle over labels written by
+/// BuildDistanceOracle. Make copies the label properties into a dense
+/// node-major array once; Query then answers in O(num_landmarks) with two
+/// contiguous reads per landmark and no graph traversal, so millions of
+/// queries per second are practical on one thread.
+class KATANA_EXPORT DistanceOracle {
+public:
+  /// Bounds on the shortest-path distance between two nodes. The true
+  /// distance lies in [lower, upper]; upper is exact whenever a landmark
+  /// lies on a shortest path between the endpoints. Both are
+  /// +infinity when the nodes are in different components.
+  struct Bounds {
+    double lower;
+    double upper;
+  };
+
+  /// Load the labels written by BuildDistanceOracle under
+  /// label_property_prefix. num_landmarks must match the plan used to build.
+  static Result<DistanceOracle> Make(
+      PropertyGraph* pg, const std::string& label_property_prefix,
+      uint32_t num_landmarks);
+
+  /// Bound the shortest-path distance between source and destination.
+  Bounds Query(uint32_t source, uint32_t destination) const;
+
+  uint32_t num_landmarks() const { return num_landmarks_; }
+  uint64_t num_nodes() const { return num_nodes_; }
+
+private:
+  DistanceOracle(uint64_t num_nodes, uint32_t num_landmarks)
+      : num_nodes_(num_nodes), num_landmarks_(num_landmarks) {}
+
+  uint64_t num_nodes_;
+  uint32_t num_landmarks_;
+  /// Node-major labels: entry node * num_landmarks_ + landmark. Unreachable
+  /// pairs hold +infinity.
+  katana::NUMAArray<double> labels_;
+};
+
+}  // namespace katana::analytics
+
+#endif
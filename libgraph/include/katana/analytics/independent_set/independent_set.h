@@ -20,7 +20,8 @@ public:
     // kNondeterministic,
     // kDeterministicBase,
     kPriority,
-    kEdgeTiledPriority
+    kEdgeTiledPriority,
+    kPriorityFrontier
   };
 
 private:
@@ -46,6 +47,15 @@ public:
     return {kCPU, kEdgeTiledPriority};
   }
 
+  /// Deterministic hash-priority rounds over a shrinking frontier: a node
+  /// joins the set when its hash is a local minimum among undecided
+  /// neighbors, decided nodes drop out of the worklist, and no locks or
+  /// speculation are involved. Good for sparse graphs where few rounds
+  /// decide almost everything.
+  static IndependentSetPlan PriorityFrontier() {
+    return {kCPU, kPriorityFrontier};
+  }
+
   static IndependentSetPlan FromAlgorithm(Algorithm algorithm) {
     return {kCPU, algorithm};
   }
@@ -2,6 +2,7 @@
 #define KATANA_LIBGRAPH_KATANA_ANALYTICS_JACCARD_JACCARD_H_
 
 #include <iostream>
+#include <vector>
 
 #include "katana/Properties.h"
 #include "katana/PropertyGraph.h"
@@ -65,6 +66,25 @@ KATANA_EXPORT Result<void> Jaccard(
 KATANA_EXPORT Result<void> JaccardAssertValid(
     PropertyGraph* pg, uint32_t compare_node, const std::string& property_name);
 
+/// One ranked result of a JaccardTopK query.
+struct KATANA_EXPORT JaccardTopKEntry {
+  uint32_t node;
+  double similarity;
+};
+
+/// Compute, for every node in query_nodes, the k nodes most Jaccard-similar
+/// to it. Queries run in parallel and each enumerates only its two-hop
+/// neighborhood: a node sharing no neighbor with the query has similarity 0
+/// and is never considered. A candidate whose degree ratio already bounds
+/// its similarity below the current kth best is skipped before its adjacency
+/// list is touched, and each worker thread reuses one neighbor-marking table
+/// across all the queries it runs instead of rebuilding the query's neighbor
+/// set per call. Each result vector is ordered by decreasing similarity and
+/// excludes the query node itself; it holds fewer than k entries when fewer
+/// candidates exist.
+KATANA_EXPORT Result<std::vector<std::vector<JaccardTopKEntry>>> JaccardTopK(
+    PropertyGraph* pg, const std::vector<uint32_t>& query_nodes, uint32_t k);
+
 struct KATANA_EXPORT JaccardStatistics {
   /// The maximum similarity excluding the comparison node.
   double max_similarity;
@@ -52,6 +52,18 @@ KATANA_EXPORT Result<void> KCore(
     const std::string& output_property_name, katana::TxnContext* txn_ctx,
     const bool& is_symmetric = false, KCorePlan plan = KCorePlan());
 
+/// Compute the full k-core decomposition for pg in one pass. Every node's
+/// coreness (the largest k such that the node is in the k-core) is written
+/// to the uint32 property named output_property_name. Nodes are peeled level
+/// by level with the same atomic degree-decrement cascade as KCore, so each
+/// edge is processed once regardless of how many distinct coreness values
+/// exist; use this instead of repeated KCore calls with increasing k.
+/// The property named output_property_name is created by this function and
+/// may not exist before the call.
+KATANA_EXPORT Result<void> KCoreDecomposition(
+    PropertyGraph* pg, const std::string& output_property_name,
+    katana::TxnContext* txn_ctx, const bool& is_symmetric = false);
+
 KATANA_EXPORT Result<void> KCoreAssertValid(
     PropertyGraph* pg, uint32_t k_core_number,
     const std::string& property_name);
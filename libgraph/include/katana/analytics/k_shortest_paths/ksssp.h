@@ -16,6 +16,7 @@ public:
     kDeltaTile,
     kDeltaStep,
     kDeltaStepBarrier,
+    kBidirectionalDijkstra,
   };
 
   /// Specifices algorithm used for path reachability
@@ -27,6 +28,7 @@ public:
   static const Reachability kDefaultReach = syncLevel;
   static const int kDefaultDelta = 13;
   static const int kDefaultEdgeTileSize = 512;
+  static const bool kDefaultReverseOracle = false;
 
   // Don't allow people to directly construct these, so as to have only one
   // consistent way to configure.
@@ -35,15 +37,18 @@ private:
   Reachability reachability_;
   unsigned delta_;
   ptrdiff_t edge_tile_size_;
+  bool reverse_oracle_;
 
   KssspPlan(
       Architecture architecture, Algorithm algorithm, Reachability reachability,
-      unsigned delta, ptrdiff_t edge_tile_size)
+      unsigned delta, ptrdiff_t edge_tile_size,
+      bool reverse_oracle = kDefaultReverseOracle)
       : Plan(architecture),
         algorithm_(algorithm),
         reachability_(reachability),
         delta_(delta),
-        edge_tile_size_(edge_tile_size) {}
+        edge_tile_size_(edge_tile_size),
+        reverse_oracle_(reverse_oracle) {}
 
 public:
   KssspPlan() : KssspPlan{kCPU, kDeltaTile, kDefaultReach, 0, 0} {}
@@ -64,22 +69,41 @@ public:
   unsigned delta() const { return delta_; }
   ptrdiff_t edge_tile_size() const { return edge_tile_size_; }
 
+  /// Whether to run one extra SSSP sweep from the report node up front and
+  /// use the resulting distances as lower bounds to prune deviation paths
+  /// that can no longer beat the k paths already found. Pays off when
+  /// num_paths is large relative to the cost of a single sweep, e.g. road
+  /// networks.
+  bool reverse_oracle() const { return reverse_oracle_; }
+
   static KssspPlan DeltaTile(
       Reachability reachability = kDefaultReach, unsigned delta = kDefaultDelta,
-      ptrdiff_t edge_tile_size = kDefaultEdgeTileSize) {
-    return {kCPU, kDeltaTile, reachability, delta, edge_tile_size};
+      ptrdiff_t edge_tile_size = kDefaultEdgeTileSize,
+      bool reverse_oracle = kDefaultReverseOracle) {
+    return {kCPU, kDeltaTile, reachability, delta, edge_tile_size,
+            reverse_oracle};
   }
 
   static KssspPlan DeltaStep(
-      Reachability reachability = kDefaultReach,
-      unsigned delta = kDefaultDelta) {
-    return {kCPU, kDeltaStep, reachability, delta, 0};
+      Reachability reachability = kDefaultReach, unsigned delta = kDefaultDelta,
+      bool reverse_oracle = kDefaultReverseOracle) {
+    return {kCPU, kDeltaStep, reachability, delta, 0, reverse_oracle};
   }
 
   static KssspPlan DeltaStepBarrier(
-      Reachability reachability = kDefaultReach,
-      unsigned delta = kDefaultDelta) {
-    return {kCPU, kDeltaStepBarrier, reachability, delta, 0};
+      Reachability reachability = kDefaultReach, unsigned delta = kDefaultDelta,
+      bool reverse_oracle = kDefaultReverseOracle) {
+    return {kCPU, kDeltaStepBarrier, reachability, delta, 0, reverse_oracle};
+  }
+
+  /// Point-to-point search: forward and backward frontiers expand
+  /// alternately and stop as soon as no unsettled pair can beat the best
+  /// meeting point found, instead of running to global convergence. On
+  /// directed graphs the backward frontier traverses in-edges through the
+  /// BiDirectional view. Only valid for num_paths == 1; on road-network
+  /// style graphs it explores a small fraction of what a full sweep does.
+  static KssspPlan BidirectionalDijkstra() {
+    return {kCPU, kBidirectionalDijkstra, kDefaultReach, 0, 0};
   }
 };
 
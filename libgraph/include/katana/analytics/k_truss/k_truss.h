@@ -16,7 +16,7 @@ namespace katana::analytics {
 class KTrussPlan : public Plan {
 public:
   /// Algorithm selectors for KCore
-  enum Algorithm { kBsp, kBspJacobi, kBspCoreThenTruss };
+  enum Algorithm { kBsp, kBspJacobi, kBspCoreThenTruss, kPeeling };
 
   // Don't allow people to directly construct these, so as to have only one
   // consistent way to configure.
@@ -39,6 +39,15 @@ public:
 
   /// Compute k-1 core and then k-truss algorithm.
   static KTrussPlan BspCoreThenTruss() { return {kCPU, kBspCoreThenTruss}; }
+
+  /// Bucketed support-peeling algorithm in the style of PKT.
+  ///
+  /// Counts every edge's triangle support once up front into a flat array,
+  /// then peels rounds of edges whose support dropped below k - 2, with
+  /// atomic decrements on the surviving edges of each broken triangle.
+  /// Unlike the BSP variants it never recomputes an intersection for an edge
+  /// that stays supported, so it wins on graphs where most edges survive.
+  static KTrussPlan Peeling() { return {kCPU, kPeeling}; }
 };
 
 /// Compute the k-truss for pg. The pg is expected to be
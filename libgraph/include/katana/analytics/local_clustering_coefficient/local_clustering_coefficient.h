@@ -14,7 +14,11 @@ namespace katana::analytics {
 /// Clustering Coefficient of the nodes in the graph.
 class LocalClusteringCoefficientPlan : public Plan {
 public:
-  enum Algorithm { kOrderedCountAtomics, kOrderedCountPerThread };
+  enum Algorithm {
+    kOrderedCountAtomics,
+    kOrderedCountPerThread,
+    kHybridSampled
+  };
 
   enum Relabeling {
     kRelabel,
@@ -24,19 +28,41 @@ public:
 
   static const Relabeling kDefaultRelabeling = kAutoRelabel;
   static const bool kDefaultEdgesSorted = false;
+  static const uint32_t kDefaultSamplingDegreeThreshold = 1024;
+  constexpr static const double kDefaultSamplingEpsilon = 0.01;
+  constexpr static const double kDefaultSamplingDelta = 0.001;
 
 private:
   Algorithm algorithm_;
   bool edges_sorted_;
   Relabeling relabeling_;
+  uint32_t sampling_degree_threshold_;
+  double sampling_epsilon_;
+  double sampling_delta_;
 
   LocalClusteringCoefficientPlan(
       Architecture architecture, Algorithm algorithm, bool edges_sorted,
-      Relabeling relabeling)
+      Relabeling relabeling, uint32_t sampling_degree_threshold,
+      double sampling_epsilon, double sampling_delta)
       : Plan(architecture),
         algorithm_(algorithm),
         edges_sorted_(edges_sorted),
-        relabeling_(relabeling) {}
+        relabeling_(relabeling),
+        sampling_degree_threshold_(sampling_degree_threshold),
+        sampling_epsilon_(sampling_epsilon),
+        sampling_delta_(sampling_delta) {}
+
+  LocalClusteringCoefficientPlan(
+      Architecture architecture, Algorithm algorithm, bool edges_sorted,
+      Relabeling relabeling)
+      : LocalClusteringCoefficientPlan{
+            architecture,
+            algorithm,
+            edges_sorted,
+            relabeling,
+            kDefaultSamplingDegreeThreshold,
+            kDefaultSamplingEpsilon,
+            kDefaultSamplingDelta} {}
 
 public:
   LocalClusteringCoefficientPlan()
@@ -49,6 +75,20 @@ public:
   bool edges_sorted() const { return edges_sorted_; }
   Relabeling relabeling() const { return relabeling_; }
 
+  /// Nodes of this degree or less are always counted exactly; only nodes
+  /// above it fall back to wedge sampling. Only used by kHybridSampled.
+  uint32_t sampling_degree_threshold() const {
+    return sampling_degree_threshold_;
+  }
+
+  /// Additive error tolerated on a sampled node's coefficient.
+  /// Only used by kHybridSampled.
+  double sampling_epsilon() const { return sampling_epsilon_; }
+
+  /// Per-node probability that a sampled coefficient misses its error bound.
+  /// Only used by kHybridSampled.
+  double sampling_delta() const { return sampling_delta_; }
+
   /**
    * An ordered count algorithm that sorts the nodes by degree before
    * execution. This has been found to give good performance. We implement the
@@ -69,6 +109,38 @@ public:
       Relabeling relabeling = kDefaultRelabeling) {
     return {kCPU, kOrderedCountPerThread, edges_sorted, relabeling};
   }
+
+  /**
+   * A per-node hybrid: nodes at or below sampling_degree_threshold are
+   * counted exactly with sorted intersections, while higher-degree nodes
+   * estimate their coefficient by sampling random wedges and testing
+   * whether each is closed. The sample count is chosen from a Hoeffding
+   * bound so each sampled coefficient is within sampling_epsilon of the
+   * exact value with probability at least 1 - sampling_delta. This bounds
+   * the per-node work by the degree threshold rather than the maximum
+   * degree, so a few hubs no longer dominate the run.
+   *
+   * @param sampling_degree_threshold Exact counting is used up to this degree.
+   * @param sampling_epsilon Additive error tolerated on sampled nodes.
+   * @param sampling_delta Per-node failure probability of the error bound.
+   * @param edges_sorted Are the edges of the graph already sorted.
+   * @param relabeling Should the algorithm relabel the nodes.
+   */
+  static LocalClusteringCoefficientPlan HybridSampled(
+      uint32_t sampling_degree_threshold = kDefaultSamplingDegreeThreshold,
+      double sampling_epsilon = kDefaultSamplingEpsilon,
+      double sampling_delta = kDefaultSamplingDelta,
+      bool edges_sorted = kDefaultEdgesSorted,
+      Relabeling relabeling = kDefaultRelabeling) {
+    return {
+        kCPU,
+        kHybridSampled,
+        edges_sorted,
+        relabeling,
+        sampling_degree_threshold,
+        sampling_epsilon,
+        sampling_delta};
+  }
 };
 
 /**
@@ -16,6 +16,8 @@ class MatrixCompletionPlan : public Plan {
 public:
   enum Algorithm {
     kSGDByItems,
+    kSGDByItemsSharded,
+    kSGDByItemsTiled,
   };
 
   enum Step { kBold, kBottou, kIntel, kInverse, kPurdue };
@@ -122,6 +124,69 @@ public:
         use_det_init,
         learning_rate_function};
   }
+
+  /// SGD over item blocks with user striping. Each worker owns a static
+  /// block of item nodes and the user side is walked stripe by stripe, so
+  /// within a phase no two workers ever touch the same latent vector and
+  /// the gradient step needs no atomics. Prefer this over SGDByItems when
+  /// hogwild collisions on popular users limit throughput.
+  static MatrixCompletionPlan SGDByItemsSharded(
+      double learning_rate = kDefaultLearningRate,
+      double decay_rate = kDefaultDecayRate, double lambda = kDefaultLambda,
+      double tolerance = kDefaultTolerance,
+      bool use_same_latent_vector = kDefaultUseSameLatentVector,
+      uint32_t max_updates = kDefaultMaxUpdates,
+      uint32_t updates_per_edge = kDefaultUpdatesPerEdge,
+      uint32_t fixed_rounds = kDefaultFixedRounds,
+      bool use_exact_error = kDefaultUseExactError,
+      bool use_det_init = kDefaultUseDetInit,
+      Step learning_rate_function = kDefaultLearningRateFunction) {
+    return {
+        kCPU,
+        kSGDByItemsSharded,
+        learning_rate,
+        decay_rate,
+        lambda,
+        tolerance,
+        use_same_latent_vector,
+        max_updates,
+        updates_per_edge,
+        fixed_rounds,
+        use_exact_error,
+        use_det_init,
+        learning_rate_function};
+  }
+  /// DSGD-style SGD over 2D edge tiles (Tiled2DExecutor). Tiles are
+  /// sized so the item and user latent vectors a tile touches fit in L2
+  /// together, and tile band locking keeps concurrent workers off each
+  /// other's vectors, so the gradient step needs no atomics. Prefer this
+  /// over SGDByItemsSharded when the latent working set blows the cache.
+  static MatrixCompletionPlan SGDByItemsTiled(
+      double learning_rate = kDefaultLearningRate,
+      double decay_rate = kDefaultDecayRate, double lambda = kDefaultLambda,
+      double tolerance = kDefaultTolerance,
+      bool use_same_latent_vector = kDefaultUseSameLatentVector,
+      uint32_t max_updates = kDefaultMaxUpdates,
+      uint32_t updates_per_edge = kDefaultUpdatesPerEdge,
+      uint32_t fixed_rounds = kDefaultFixedRounds,
+      bool use_exact_error = kDefaultUseExactError,
+      bool use_det_init = kDefaultUseDetInit,
+      Step learning_rate_function = kDefaultLearningRateFunction) {
+    return {
+        kCPU,
+        kSGDByItemsTiled,
+        learning_rate,
+        decay_rate,
+        lambda,
+        tolerance,
+        use_same_latent_vector,
+        max_updates,
+        updates_per_edge,
+        fixed_rounds,
+        use_exact_error,
+        use_det_init,
+        learning_rate_function};
+  }
 };
 
 /// Performs matrix completion using stochastic gradient descent (SGD) algortihm
@@ -2,6 +2,7 @@
 #define KATANA_LIBGRAPH_KATANA_ANALYTICS_PAGERANK_PAGERANK_H_
 
 #include <iostream>
+#include <vector>
 
 #include "katana/Properties.h"
 #include "katana/PropertyGraph.h"
@@ -16,6 +17,7 @@ public:
   enum Algorithm {
     kPullTopological,
     kPullResidual,
+    kPullResidualTiled,
     kPushSynchronous,
     kPushAsynchronous,
   };
@@ -76,6 +78,21 @@ public:
     return {kCPU, kPullResidual, tolerance, max_iterations, alpha};
   }
 
+  /// Edge-tiled delta-residual pull algorithm
+  ///
+  /// Like PullResidual, but the accumulation pass runs over fixed-size edge
+  /// tiles so its reads of the delta array stay within a bounded working set
+  /// and heavy nodes are split across threads. Prefer this on large
+  /// skewed-degree graphs.
+  ///
+  /// The graph must be transposed to use this algorithm.
+  static PagerankPlan PullResidualTiled(
+      float tolerance = kDefaultTolerance,
+      unsigned int max_iterations = kDefaultMaxIterations,
+      float alpha = kDefaultAlpha) {
+    return {kCPU, kPullResidualTiled, tolerance, max_iterations, alpha};
+  }
+
   /// Asynchronous push algorithm
   ///
   /// This implementation is based on the Push-based PageRank computation
@@ -103,6 +120,16 @@ public:
       float alpha = kDefaultAlpha) {
     return {kCPU, kPushSynchronous, tolerance, max_iterations, alpha};
   }
+
+  /// Run on the registered GPU backend (see GpuBackend.h). If no backend
+  /// is registered, or the backend does not implement PageRank, the call
+  /// falls back to the synchronous push algorithm on the CPU.
+  static PagerankPlan Gpu(
+      float tolerance = kDefaultTolerance,
+      unsigned int max_iterations = kDefaultMaxIterations,
+      float alpha = kDefaultAlpha) {
+    return {kGPU, kPushSynchronous, tolerance, max_iterations, alpha};
+  }
 };
 
 /// Compute the Page Rank of each node in the graph.
@@ -112,6 +139,33 @@ KATANA_EXPORT Result<void> Pagerank(
     PropertyGraph* pg, const std::string& output_property_name,
     katana::TxnContext* txn_ctx, PagerankPlan plan = {});
 
+/// Compute PageRank with the asynchronous push engine, keeping the per-node
+/// residuals in residual_property_name instead of a temporary property so
+/// they persist with the graph. A later PagerankIncremental call uses the
+/// persisted ranks and residuals to refresh the result after a small
+/// topology delta without recomputing from scratch.
+///
+/// Both properties are created by this function and may not exist before the
+/// call. The plan's algorithm selection is ignored; the push engine is
+/// always used.
+KATANA_EXPORT Result<void> PagerankWithResiduals(
+    PropertyGraph* pg, const std::string& output_property_name,
+    const std::string& residual_property_name, katana::TxnContext* txn_ctx,
+    PagerankPlan plan = {});
+
+/// Refresh a PageRank result computed by PagerankWithResiduals after a small
+/// graph delta. touched_nodes lists the nodes whose edges changed; each has
+/// its absorbed rank moved back into its residual (nodes new since the full
+/// run get the base mass instead) and is re-pushed through the current
+/// topology, activating further nodes only as their residuals cross the plan
+/// tolerance. Mass that was already pushed through since-removed edges is
+/// not rescinded exactly, so the result drifts with the cumulative size of
+/// the deltas; rerun PagerankWithResiduals periodically to re-anchor it.
+KATANA_EXPORT Result<void> PagerankIncremental(
+    PropertyGraph* pg, const std::string& output_property_name,
+    const std::string& residual_property_name,
+    const std::vector<uint32_t>& touched_nodes, PagerankPlan plan = {});
+
 KATANA_EXPORT Result<void> PagerankAssertValid(
     PropertyGraph* pg, const std::string& property_name);
 
@@ -140,6 +140,15 @@ public:
 KATANA_EXPORT Result<std::vector<std::vector<uint32_t>>> RandomWalks(
     PropertyGraph* pg, RandomWalksPlan plan = RandomWalksPlan());
 
+/// Compute random walks biased by the given edge weight property. Per-node
+/// alias tables are built once up front, so every weighted neighbor draw
+/// during the walks costs O(1) regardless of degree; the node2vec
+/// return/in-out bias is applied on top by the usual rejection step. Only
+/// the node2vec algorithm is supported. The pg is expected to be symmetric.
+KATANA_EXPORT Result<std::vector<std::vector<uint32_t>>> WeightedRandomWalks(
+    PropertyGraph* pg, const std::string& edge_weight_property_name,
+    RandomWalksPlan plan = RandomWalksPlan());
+
 KATANA_EXPORT Result<void> RandomWalksAssertValid(PropertyGraph* pg);
 
 }  // namespace katana::analytics
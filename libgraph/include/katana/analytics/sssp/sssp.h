@@ -111,6 +111,13 @@ public:
       ptrdiff_t edge_tile_size = kDefaultEdgeTileSize) {
     return {kCPU, kTopologicalTile, 0, edge_tile_size};
   }
+
+  /// Run on the registered GPU backend (see GpuBackend.h). If no backend
+  /// is registered, or the backend does not implement SSSP, the call falls
+  /// back to delta stepping on the CPU with the given delta.
+  static SsspPlan Gpu(unsigned delta = kDefaultDelta) {
+    return {kGPU, kDeltaStep, delta, 0};
+  }
 };
 
 /// Compute the Single-Source Shortest Path for pg starting from start_node.
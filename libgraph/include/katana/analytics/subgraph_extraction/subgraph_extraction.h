@@ -57,7 +57,35 @@ SubGraphExtraction(
     katana::PropertyGraph* pg,
     const std::vector<katana::PropertyGraph::Node>& node_vec,
     SubGraphExtractionPlan plan = {});
-// const std::vector<std::string>& node_properties_to_copy, const std::vector<std::string>& edge_properties_to_copy);
+
+/**
+ * Construct a new sub-graph from the original graph, carrying properties
+ * and entity types over in the same call.
+ *
+ * The topology is built exactly as SubGraphExtraction builds it. On top of
+ * that, the requested node and edge property columns are sliced out with one
+ * Arrow take per table, the EntityTypeIDs of the extracted nodes and edges
+ * are remapped onto the new graph, and the type managers are copied, so the
+ * result is a self-contained PropertyGraph ready to be exported. Passing an
+ * empty property list copies every loaded column of that kind; a property
+ * name that does not exist fails the call.
+ *
+ * @param pg The graph to process.
+ * @param node_vec Set of node IDs
+ * @param node_properties_to_copy Node property columns to slice into the
+ *   sub-graph; empty means all.
+ * @param edge_properties_to_copy Edge property columns to slice into the
+ *   sub-graph; empty means all.
+ * @param txn_ctx The transaction context for property additions.
+ * @param plan
+ */
+KATANA_EXPORT katana::Result<std::unique_ptr<katana::PropertyGraph>>
+SubGraphExtractionWithProperties(
+    katana::PropertyGraph* pg,
+    const std::vector<katana::PropertyGraph::Node>& node_vec,
+    const std::vector<std::string>& node_properties_to_copy,
+    const std::vector<std::string>& edge_properties_to_copy,
+    katana::TxnContext* txn_ctx, SubGraphExtractionPlan plan = {});
 
 }  // namespace katana::analytics
 
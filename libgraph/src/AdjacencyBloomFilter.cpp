@@ -0,0 +1,126 @@
+#include "katana/AdjacencyBloomFilter.h"
+
+#include <algorithm>
+
+#include "katana/Loops.h"
+#include "katana/ParallelSTL.h"
+#include "katana/PropertyGraph.h"
+
+namespace {
+
+/// Smallest power of two holding at least the requested number of
+/// blocks; node block counts must be powers of two so block selection is
+/// a mask instead of a modulo.
+uint64_t
+BlocksFor(size_t degree, uint64_t bits_per_edge) {
+  if (degree == 0) {
+    return 0;
+  }
+  const uint64_t wanted =
+      (degree * bits_per_edge + katana::AdjacencyBloomFilter::kBitsPerBlock -
+       1) /
+      katana::AdjacencyBloomFilter::kBitsPerBlock;
+  uint64_t blocks = 1;
+  while (blocks < wanted) {
+    blocks <<= 1;
+  }
+  return blocks;
+}
+
+}  // namespace
+
+katana::AdjacencyBloomFilter
+katana::AdjacencyBloomFilter::Make(
+    const PropertyGraph* pg, uint64_t bits_per_edge) noexcept {
+  const GraphTopology& topo = pg->topology();
+  const uint64_t num_nodes = topo.NumNodes();
+
+  NUMAArray<uint64_t> block_offsets;
+  block_offsets.allocateInterleaved(num_nodes + 1);
+  block_offsets[0] = 0;
+  katana::do_all(
+      topo.Nodes(),
+      [&](Node node) {
+        block_offsets[node + 1] =
+            BlocksFor(topo.OutDegree(node), bits_per_edge);
+      },
+      katana::no_stats());
+  katana::ParallelSTL::partial_sum(
+      block_offsets.begin(), block_offsets.end(), block_offsets.begin());
+
+  NUMAArray<uint64_t> words;
+  words.allocateInterleaved(block_offsets[num_nodes] * kWordsPerBlock);
+
+  // Each node's blocks are written only by its own iteration, so the
+  // insert loop needs no atomics.
+  katana::do_all(
+      topo.Nodes(),
+      [&](Node node) {
+        const uint64_t block_begin = block_offsets[node];
+        const uint64_t num_blocks = block_offsets[node + 1] - block_begin;
+        if (num_blocks == 0) {
+          return;
+        }
+        uint64_t* base = &words[block_begin * kWordsPerBlock];
+        std::fill(base, base + num_blocks * kWordsPerBlock, uint64_t{0});
+        for (Edge e : topo.OutEdges(node)) {
+          const uint64_t h = MixHash(topo.OutEdgeDst(e));
+          uint64_t* block = base + ((h >> 48) & (num_blocks - 1)) *
+                                       kWordsPerBlock;
+          const uint64_t probe1 = h & (kBitsPerBlock - 1);
+          const uint64_t probe2 = ((h >> 9) & (kBitsPerBlock - 1)) | 1;
+          for (uint64_t i = 0; i < kProbesPerEdge; ++i) {
+            const uint64_t bit = (probe1 + i * probe2) & (kBitsPerBlock - 1);
+            block[bit >> 6] |= uint64_t{1} << (bit & 63);
+          }
+        }
+      },
+      katana::steal(), katana::no_stats(),
+      katana::loopname("AdjacencyBloomFilterBuild"));
+
+  return AdjacencyBloomFilter(
+      std::move(block_offsets), std::move(words), bits_per_edge);
+}
+
+katana::Result<katana::AdjacencyBloomFilter>
+katana::AdjacencyBloomFilter::Make(RDGAdjacencyFilter&& rdg_filter) {
+  if (rdg_filter.probes_per_edge() != kProbesPerEdge) {
+    return KATANA_ERROR(
+        ErrorCode::InvalidArgument,
+        "stored adjacency filter uses {} probes per edge; this build expects "
+        "{}",
+        rdg_filter.probes_per_edge(), kProbesPerEdge);
+  }
+  if (rdg_filter.block_offsets().size() != rdg_filter.num_nodes() + 1) {
+    return KATANA_ERROR(
+        ErrorCode::InvalidArgument,
+        "stored adjacency filter has {} block offsets for {} nodes",
+        rdg_filter.block_offsets().size(), rdg_filter.num_nodes());
+  }
+
+  NUMAArray<uint64_t> block_offsets;
+  block_offsets.allocateInterleaved(rdg_filter.block_offsets().size());
+  katana::ParallelSTL::copy(
+      rdg_filter.block_offsets().begin(), rdg_filter.block_offsets().end(),
+      block_offsets.begin());
+
+  NUMAArray<uint64_t> words;
+  words.allocateInterleaved(rdg_filter.words().size());
+  katana::ParallelSTL::copy(
+      rdg_filter.words().begin(), rdg_filter.words().end(), words.begin());
+
+  return AdjacencyBloomFilter(
+      std::move(block_offsets), std::move(words), rdg_filter.bits_per_edge());
+}
+
+katana::Result<katana::RDGAdjacencyFilter>
+katana::AdjacencyBloomFilter::ToRDGAdjacencyFilter() const {
+  RDGAdjacencyFilter rdg_filter;
+  rdg_filter.set_num_nodes(NumNodes());
+  rdg_filter.set_bits_per_edge(bits_per_edge_);
+  rdg_filter.set_probes_per_edge(kProbesPerEdge);
+  rdg_filter.set_block_offsets(
+      std::vector<uint64_t>(block_offsets_.begin(), block_offsets_.end()));
+  rdg_filter.set_words(std::vector<uint64_t>(words_.begin(), words_.end()));
+  return rdg_filter;
+}
@@ -0,0 +1,119 @@
+#include "katana/ArrowIPCExport.h"
+
+#include "katana/ArrowIPCWriter.h"
+#include "katana/ErrorCode.h"
+#include "katana/HTTP.h"
+
+namespace {
+
+katana::Result<std::shared_ptr<arrow::Table>>
+SelectProperties(
+    const katana::PropertyGraph& pg, const std::vector<std::string>& properties,
+    bool for_nodes) {
+  std::vector<std::shared_ptr<arrow::Field>> fields;
+  std::vector<std::shared_ptr<arrow::ChunkedArray>> columns;
+
+  if (properties.empty()) {
+    int32_t num_properties = for_nodes ? pg.GetNumNodeProperties()
+                                       : pg.GetNumEdgeProperties();
+    for (int32_t i = 0; i < num_properties; ++i) {
+      std::string name = for_nodes ? pg.GetNodePropertyName(i)
+                                   : pg.GetEdgePropertyName(i);
+      std::shared_ptr<arrow::ChunkedArray> column =
+          for_nodes ? pg.GetNodeProperty(i) : pg.GetEdgeProperty(i);
+      fields.emplace_back(arrow::field(name, column->type()));
+      columns.emplace_back(std::move(column));
+    }
+  } else {
+    for (const std::string& name : properties) {
+      std::shared_ptr<arrow::ChunkedArray> column = KATANA_CHECKED_CONTEXT(
+          for_nodes ? pg.GetNodeProperty(name) : pg.GetEdgeProperty(name),
+          "exporting property {}", name);
+      fields.emplace_back(arrow::field(name, column->type()));
+      columns.emplace_back(std::move(column));
+    }
+  }
+
+  if (fields.empty()) {
+    return KATANA_ERROR(
+        katana::ErrorCode::InvalidArgument, "no properties to export");
+  }
+  return arrow::Table::Make(arrow::schema(fields), columns);
+}
+
+katana::Result<std::shared_ptr<arrow::Buffer>>
+ExportIPC(
+    const katana::PropertyGraph& pg, const std::vector<std::string>& properties,
+    bool for_nodes) {
+  std::shared_ptr<arrow::Table> table =
+      KATANA_CHECKED(SelectProperties(pg, properties, for_nodes));
+  std::unique_ptr<katana::ArrowIPCWriter> writer =
+      KATANA_CHECKED(katana::ArrowIPCWriter::Make(std::move(table)));
+  return writer->ToBuffer();
+}
+
+katana::Result<void>
+WriteIPC(
+    const katana::PropertyGraph& pg, const katana::URI& uri,
+    const std::vector<std::string>& properties, bool for_nodes) {
+  std::shared_ptr<arrow::Table> table =
+      KATANA_CHECKED(SelectProperties(pg, properties, for_nodes));
+  std::unique_ptr<katana::ArrowIPCWriter> writer =
+      KATANA_CHECKED(katana::ArrowIPCWriter::Make(std::move(table)));
+  return writer->WriteToUri(uri);
+}
+
+katana::Result<void>
+PushIPC(
+    const katana::PropertyGraph& pg, const std::string& url,
+    const std::vector<std::string>& properties, bool for_nodes) {
+  std::shared_ptr<arrow::Buffer> buffer =
+      KATANA_CHECKED(ExportIPC(pg, properties, for_nodes));
+  KATANA_CHECKED(katana::HttpInit());
+  std::string payload(
+      reinterpret_cast<const char*>(buffer->data()), buffer->size());
+  std::vector<char> response;
+  return katana::HttpPost(url, payload, &response);
+}
+
+}  // namespace
+
+katana::Result<std::shared_ptr<arrow::Buffer>>
+katana::ExportNodePropertiesIPC(
+    const PropertyGraph& pg, const std::vector<std::string>& properties) {
+  return ExportIPC(pg, properties, true);
+}
+
+katana::Result<std::shared_ptr<arrow::Buffer>>
+katana::ExportEdgePropertiesIPC(
+    const PropertyGraph& pg, const std::vector<std::string>& properties) {
+  return ExportIPC(pg, properties, false);
+}
+
+katana::Result<void>
+katana::WriteNodePropertiesIPC(
+    const PropertyGraph& pg, const URI& uri,
+    const std::vector<std::string>& properties) {
+  return WriteIPC(pg, uri, properties, true);
+}
+
+katana::Result<void>
+katana::WriteEdgePropertiesIPC(
+    const PropertyGraph& pg, const URI& uri,
+    const std::vector<std::string>& properties) {
+  return WriteIPC(pg, uri, properties, false);
+}
+
+katana::Result<void>
+katana::PushNodePropertiesIPC(
+    const PropertyGraph& pg, const std::string& url,
+    const std::vector<std::string>& properties) {
+  return PushIPC(pg, url, properties, true);
+}
+
+katana::Result<void>
+katana::PushEdgePropertiesIPC(
+    const PropertyGraph& pg, const std::string& url,
+    const std::vector<std::string>& properties) {
+  return PushIPC(pg, url, properties, false);
+}
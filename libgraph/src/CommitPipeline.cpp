@@ -0,0 +1,110 @@
+#include "katana/CommitPipeline.h"
+
+#include "katana/ThreadPool.h"
+
+katana::CommitPipeline&
+katana::CommitPipeline::Get() {
+  // Leaked intentionally: the dedicated thread lives until the thread pool
+  // shuts down at process exit, and must never observe a destroyed queue.
+  static CommitPipeline* pipeline = new CommitPipeline();
+  return *pipeline;
+}
+
+katana::CommitPipeline::CommitPipeline() {
+  static std::function<void(void)> body = [this]() { Run(); };
+  katana::GetThreadPool().runDedicated(body);
+}
+
+uint64_t
+katana::CommitPipeline::Submit(Op op) {
+  uint64_t seq;
+  {
+    std::lock_guard<std::mutex> guard(lock_);
+    seq = next_seq_++;
+    pending_.emplace_back(PendingCommit{seq, std::move(op)});
+  }
+  work_ready_.notify_one();
+  return seq;
+}
+
+uint64_t
+katana::CommitPipeline::Submit(
+    std::shared_ptr<PropertyGraph> pg, std::string command_line,
+    katana::TxnContext* txn_ctx) {
+  return Submit([pg = std::move(pg), command_line = std::move(command_line),
+                 txn_ctx]() -> katana::CopyableResult<void> {
+    auto res = pg->Commit(command_line, txn_ctx);
+    if (!res) {
+      return katana::CopyableErrorInfo{res.error()};
+    }
+    return katana::CopyableResultSuccess();
+  });
+}
+
+uint64_t
+katana::CommitPipeline::DurableWatermark() {
+  std::lock_guard<std::mutex> guard(lock_);
+  return durable_seq_;
+}
+
+katana::Result<void>
+katana::CommitPipeline::WaitForDurable(uint64_t seq) {
+  std::unique_lock<std::mutex> guard(lock_);
+  commit_done_.wait(guard, [&]() {
+    return durable_seq_ >= seq || completed_seq_ >= seq;
+  });
+  if (durable_seq_ >= seq) {
+    return katana::ResultSuccess();
+  }
+  katana::CopyableErrorInfo err = last_error_;
+  return err.WithContext(
+      "write-behind commit covering sequence {} failed", seq);
+}
+
+katana::Result<void>
+katana::CommitPipeline::Flush() {
+  uint64_t target;
+  {
+    std::lock_guard<std::mutex> guard(lock_);
+    target = next_seq_ - 1;
+  }
+  if (target == 0) {
+    return katana::ResultSuccess();
+  }
+  return WaitForDurable(target);
+}
+
+size_t
+katana::CommitPipeline::NumPending() {
+  std::lock_guard<std::mutex> guard(lock_);
+  return pending_.size();
+}
+
+void
+katana::CommitPipeline::Run() {
+  while (true) {
+    std::deque<PendingCommit> batch;
+    {
+      std::unique_lock<std::mutex> guard(lock_);
+      work_ready_.wait(guard, [this]() { return !pending_.empty(); });
+      // Group commit: take everything queued behind the last round trip.
+      // Ops are cumulative, so running only the newest one makes the
+      // whole batch durable with a single storage round trip and a
+      // single manifest update.
+      batch.swap(pending_);
+    }
+
+    katana::CopyableResult<void> res = batch.back().op();
+
+    {
+      std::lock_guard<std::mutex> guard(lock_);
+      completed_seq_ = batch.back().seq;
+      if (res) {
+        durable_seq_ = completed_seq_;
+      } else {
+        last_error_ = res.error();
+      }
+    }
+    commit_done_.notify_all();
+  }
+}
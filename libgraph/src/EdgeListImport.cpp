@@ -0,0 +1,457 @@
+#include "katana/EdgeListImport.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <numeric>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <boost/lexical_cast.hpp>
+
+#include "katana/ArrowRandomAccessBuilder.h"
+#include "katana/ErrorCode.h"
+#include "katana/JSON.h"
+#include "katana/Logging.h"
+#include "katana/Loops.h"
+#include "katana/NUMAArray.h"
+#include "katana/ParallelSTL.h"
+#include "katana/Reduction.h"
+#include "katana/Threads.h"
+
+namespace {
+
+using katana::GraphTopology;
+
+/// Parsed edges of one chunk of lines. Property values stay as raw
+/// strings until the column type has been inferred over the whole file.
+struct ParsedChunk {
+  std::vector<uint64_t> sources;
+  std::vector<uint64_t> destinations;
+  // per column name: (chunk-local edge index, raw value). Sparse so JSONL
+  // objects can carry different fields per line.
+  std::map<std::string, std::vector<std::pair<uint64_t, std::string>>>
+      properties;
+  uint64_t max_node_id{0};
+};
+
+bool
+IsCommentOrBlank(std::string_view line) {
+  return line.empty() || line.front() == '#' || line.front() == '%';
+}
+
+bool
+ParseNodeID(std::string_view field, uint64_t* out) {
+  if (field.empty()) {
+    return false;
+  }
+  uint64_t value = 0;
+  for (char c : field) {
+    if (c < '0' || c > '9') {
+      return false;
+    }
+    value = value * 10 + (c - '0');
+  }
+  *out = value;
+  return true;
+}
+
+/// Splits one CSV line on commas. Quoting is not handled; machine-written
+/// edge lists do not quote numeric id fields, and a quoted property value
+/// simply keeps its quotes as part of the string.
+std::vector<std::string_view>
+SplitCsvLine(std::string_view line) {
+  std::vector<std::string_view> fields;
+  size_t start = 0;
+  while (true) {
+    size_t comma = line.find(',', start);
+    if (comma == std::string_view::npos) {
+      fields.emplace_back(line.substr(start));
+      break;
+    }
+    fields.emplace_back(line.substr(start, comma - start));
+    start = comma + 1;
+  }
+  return fields;
+}
+
+bool
+ParseCsvLine(
+    std::string_view line, const std::vector<std::string>& column_names,
+    ParsedChunk* chunk) {
+  std::vector<std::string_view> fields = SplitCsvLine(line);
+  if (fields.size() < 2) {
+    return false;
+  }
+  uint64_t src = 0;
+  uint64_t dst = 0;
+  if (!ParseNodeID(fields[0], &src) || !ParseNodeID(fields[1], &dst)) {
+    return false;
+  }
+  uint64_t local = chunk->sources.size();
+  chunk->sources.emplace_back(src);
+  chunk->destinations.emplace_back(dst);
+  chunk->max_node_id = std::max({chunk->max_node_id, src, dst});
+  for (size_t i = 2; i < fields.size(); ++i) {
+    if (fields[i].empty()) {
+      continue;
+    }
+    std::string name = i - 2 < column_names.size()
+                           ? column_names[i - 2]
+                           : "prop" + std::to_string(i - 2);
+    chunk->properties[name].emplace_back(local, std::string(fields[i]));
+  }
+  return true;
+}
+
+bool
+ParseJsonlLine(std::string_view line, ParsedChunk* chunk) {
+  nlohmann::json object;
+  if (!katana::JsonParse(line, &object) || !object.is_object()) {
+    return false;
+  }
+  uint64_t src = 0;
+  uint64_t dst = 0;
+  bool have_src = false;
+  bool have_dst = false;
+  std::vector<std::pair<std::string, std::string>> values;
+  for (const auto& item : object.items()) {
+    const std::string& key = item.key();
+    const nlohmann::json& value = item.value();
+    if (key == "src" || key == "source") {
+      have_src = value.is_number_unsigned();
+      if (have_src) {
+        src = value.get<uint64_t>();
+      }
+    } else if (key == "dst" || key == "dest" || key == "target") {
+      have_dst = value.is_number_unsigned();
+      if (have_dst) {
+        dst = value.get<uint64_t>();
+      }
+    } else if (value.is_string()) {
+      values.emplace_back(key, value.get<std::string>());
+    } else if (!value.is_null()) {
+      values.emplace_back(key, value.dump());
+    }
+  }
+  if (!have_src || !have_dst) {
+    return false;
+  }
+  uint64_t local = chunk->sources.size();
+  chunk->sources.emplace_back(src);
+  chunk->destinations.emplace_back(dst);
+  chunk->max_node_id = std::max({chunk->max_node_id, src, dst});
+  for (auto& value : values) {
+    chunk->properties[value.first].emplace_back(
+        local, std::move(value.second));
+  }
+  return true;
+}
+
+/// Inferred arrow type of a property column, by order of preference:
+/// int64 if every value parses as one, then double, then boolean, and
+/// string as the fallback.
+enum class ColumnType { kInt64, kDouble, kBoolean, kString };
+
+template <typename T>
+bool
+ParsesAs(const std::string& value) {
+  try {
+    boost::lexical_cast<T>(value);
+    return true;
+  } catch (const boost::bad_lexical_cast&) {
+    return false;
+  }
+}
+
+bool
+IsBoolean(const std::string& value) {
+  return value == "true" || value == "false" || value == "True" ||
+         value == "False";
+}
+
+ColumnType
+InferColumnType(
+    const std::vector<ParsedChunk>& chunks, const std::string& name) {
+  ColumnType type = ColumnType::kInt64;
+  for (const ParsedChunk& chunk : chunks) {
+    auto it = chunk.properties.find(name);
+    if (it == chunk.properties.end()) {
+      continue;
+    }
+    for (const auto& value : it->second) {
+      if (type == ColumnType::kInt64 && !ParsesAs<int64_t>(value.second)) {
+        type = ColumnType::kDouble;
+      }
+      if (type == ColumnType::kDouble && !ParsesAs<double>(value.second)) {
+        type = ColumnType::kBoolean;
+      }
+      if (type == ColumnType::kBoolean && !IsBoolean(value.second)) {
+        return ColumnType::kString;
+      }
+    }
+  }
+  return type;
+}
+
+template <typename ArrowType, typename CType>
+katana::Result<std::shared_ptr<arrow::Array>>
+BuildColumn(
+    const std::vector<ParsedChunk>& chunks,
+    const std::vector<std::vector<uint64_t>>& csr_positions,
+    const std::string& name, uint64_t num_edges) {
+  katana::ArrowRandomAccessBuilder<ArrowType> builder(num_edges);
+  for (size_t ci = 0; ci < chunks.size(); ++ci) {
+    auto it = chunks[ci].properties.find(name);
+    if (it == chunks[ci].properties.end()) {
+      continue;
+    }
+    for (const auto& value : it->second) {
+      try {
+        builder.SetValue(
+            csr_positions[ci][value.first],
+            boost::lexical_cast<CType>(value.second));
+      } catch (const boost::bad_lexical_cast&) {
+        // leave the slot null; the value disagreed with the inferred type
+      }
+    }
+  }
+  return builder.Finalize();
+}
+
+katana::Result<std::shared_ptr<arrow::Array>>
+BuildBooleanColumn(
+    const std::vector<ParsedChunk>& chunks,
+    const std::vector<std::vector<uint64_t>>& csr_positions,
+    const std::string& name, uint64_t num_edges) {
+  katana::ArrowRandomAccessBuilder<arrow::BooleanType> builder(num_edges);
+  for (size_t ci = 0; ci < chunks.size(); ++ci) {
+    auto it = chunks[ci].properties.find(name);
+    if (it == chunks[ci].properties.end()) {
+      continue;
+    }
+    for (const auto& value : it->second) {
+      builder.SetValue(
+          csr_positions[ci][value.first],
+          value.second == "true" || value.second == "True");
+    }
+  }
+  return builder.Finalize();
+}
+
+std::shared_ptr<arrow::Table>
+EmptyTable(int64_t num_rows) {
+  return arrow::Table::Make(
+      arrow::schema({}), std::vector<std::shared_ptr<arrow::Array>>{},
+      num_rows);
+}
+
+}  // namespace
+
+katana::Result<katana::GraphComponents>
+katana::ConvertEdgeList(
+    const std::string& infilename, EdgeListFormat format, bool verbose) {
+  std::ifstream in(infilename, std::ios::binary);
+  if (!in) {
+    return KATANA_ERROR(ErrorCode::NotFound, "Unable to open {}", infilename);
+  }
+  std::string buf{
+      std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+  in.close();
+
+  // a CSV first line whose source field is not an integer names the
+  // property columns
+  std::vector<std::string> column_names;
+  size_t body_begin = 0;
+  if (format == EdgeListFormat::kCsv) {
+    size_t eol = buf.find('\n');
+    std::string_view first_line(
+        buf.data(), eol == std::string::npos ? buf.size() : eol);
+    uint64_t unused = 0;
+    if (!IsCommentOrBlank(first_line)) {
+      std::vector<std::string_view> fields = SplitCsvLine(first_line);
+      if (!fields.empty() && !ParseNodeID(fields[0], &unused)) {
+        for (size_t i = 2; i < fields.size(); ++i) {
+          column_names.emplace_back(fields[i]);
+        }
+        body_begin = eol == std::string::npos ? buf.size() : eol + 1;
+      }
+    }
+  }
+
+  // split the file into line-aligned chunks, one worker-owned record set
+  // per chunk; finding the next newline vectorizes through memchr
+  size_t num_chunks = std::min<size_t>(
+      std::max<size_t>(size_t{1}, buf.size() / 4096),
+      size_t{katana::getActiveThreads()} * 4);
+  std::vector<size_t> chunk_begin(num_chunks + 1);
+  chunk_begin[0] = body_begin;
+  chunk_begin[num_chunks] = buf.size();
+  for (size_t i = 1; i < num_chunks; ++i) {
+    size_t target =
+        body_begin + (buf.size() - body_begin) * i / num_chunks;
+    size_t eol = buf.find('\n', target);
+    chunk_begin[i] = eol == std::string::npos ? buf.size() : eol + 1;
+  }
+
+  std::vector<ParsedChunk> chunks(num_chunks);
+  std::atomic<uint64_t> bad_lines{0};
+
+  katana::do_all(
+      katana::iterate(size_t{0}, num_chunks),
+      [&](size_t i) {
+        size_t pos = chunk_begin[i];
+        size_t end = std::max(chunk_begin[i + 1], pos);
+        while (pos < end) {
+          size_t eol = buf.find('\n', pos);
+          if (eol == std::string::npos || eol > end) {
+            eol = end;
+          }
+          std::string_view line(buf.data() + pos, eol - pos);
+          if (!line.empty() && line.back() == '\r') {
+            line.remove_suffix(1);
+          }
+          if (!IsCommentOrBlank(line)) {
+            bool ok = format == EdgeListFormat::kCsv
+                          ? ParseCsvLine(line, column_names, &chunks[i])
+                          : ParseJsonlLine(line, &chunks[i]);
+            if (!ok) {
+              bad_lines.fetch_add(1, std::memory_order_relaxed);
+            }
+          }
+          pos = eol + 1;
+        }
+      },
+      katana::steal());
+
+  if (bad_lines > 0) {
+    return KATANA_ERROR(
+        ErrorCode::InvalidArgument,
+        "{} lines could not be parsed as edges; node ids must be "
+        "non-negative integers",
+        bad_lines.load());
+  }
+
+  uint64_t num_edges = 0;
+  uint64_t max_node_id = 0;
+  for (const ParsedChunk& chunk : chunks) {
+    num_edges += chunk.sources.size();
+    max_node_id = std::max(max_node_id, chunk.max_node_id);
+  }
+  uint64_t num_nodes = num_edges == 0 ? 0 : max_node_id + 1;
+  if (verbose) {
+    std::cout << "Parsed " << num_edges << " edges over " << num_nodes
+              << " nodes\n";
+  }
+
+  // two-pass CSR assembly: count degrees, prefix-sum into adj indices,
+  // then place destinations with per-node cursors
+  NUMAArray<uint64_t> degrees;
+  degrees.allocateInterleaved(num_nodes);
+  katana::ParallelSTL::fill(degrees.begin(), degrees.end(), uint64_t{0});
+  katana::do_all(katana::iterate(chunks), [&](const ParsedChunk& chunk) {
+    for (uint64_t src : chunk.sources) {
+      __sync_fetch_and_add(&degrees[src], uint64_t{1});
+    }
+  });
+
+  GraphTopology::AdjIndexVec adj_indices;
+  adj_indices.allocateInterleaved(num_nodes);
+  std::partial_sum(degrees.begin(), degrees.end(), adj_indices.begin());
+
+  NUMAArray<uint64_t> cursors;
+  cursors.allocateInterleaved(num_nodes);
+  katana::do_all(
+      katana::iterate(uint64_t{0}, num_nodes),
+      [&](uint64_t n) { cursors[n] = adj_indices[n] - degrees[n]; });
+
+  GraphTopology::EdgeDestVec dests;
+  dests.allocateInterleaved(num_edges);
+  // csr_positions[chunk][local edge] is where the edge landed in the CSR,
+  // used below to place property values in topology order
+  std::vector<std::vector<uint64_t>> csr_positions(num_chunks);
+  katana::do_all(
+      katana::iterate(size_t{0}, num_chunks),
+      [&](size_t i) {
+        const ParsedChunk& chunk = chunks[i];
+        csr_positions[i].resize(chunk.sources.size());
+        for (size_t e = 0; e < chunk.sources.size(); ++e) {
+          uint64_t pos =
+              __sync_fetch_and_add(&cursors[chunk.sources[e]], uint64_t{1});
+          dests[pos] = static_cast<GraphTopology::Node>(chunk.destinations[e]);
+          csr_positions[i][e] = pos;
+        }
+      },
+      katana::steal());
+
+  // build one arrow column per property; columns are independent so each
+  // runs on its own thread
+  std::vector<std::string> property_names;
+  for (const ParsedChunk& chunk : chunks) {
+    for (const auto& column : chunk.properties) {
+      if (std::find(
+              property_names.begin(), property_names.end(), column.first) ==
+          property_names.end()) {
+        property_names.emplace_back(column.first);
+      }
+    }
+  }
+  std::sort(property_names.begin(), property_names.end());
+
+  std::vector<std::shared_ptr<arrow::Array>> columns(property_names.size());
+  std::vector<std::shared_ptr<arrow::Field>> fields(property_names.size());
+  std::atomic<bool> column_ok{true};
+  katana::do_all(
+      katana::iterate(size_t{0}, property_names.size()), [&](size_t i) {
+        const std::string& name = property_names[i];
+        katana::Result<std::shared_ptr<arrow::Array>> array =
+            ErrorCode::InvalidArgument;
+        switch (InferColumnType(chunks, name)) {
+        case ColumnType::kInt64:
+          array = BuildColumn<arrow::Int64Type, int64_t>(
+              chunks, csr_positions, name, num_edges);
+          break;
+        case ColumnType::kDouble:
+          array = BuildColumn<arrow::DoubleType, double>(
+              chunks, csr_positions, name, num_edges);
+          break;
+        case ColumnType::kBoolean:
+          array = BuildBooleanColumn(chunks, csr_positions, name, num_edges);
+          break;
+        case ColumnType::kString:
+          array = BuildColumn<arrow::LargeStringType, std::string>(
+              chunks, csr_positions, name, num_edges);
+          break;
+        }
+        if (!array) {
+          column_ok = false;
+          return;
+        }
+        columns[i] = std::move(array.value());
+        fields[i] = arrow::field(name, columns[i]->type());
+      });
+  if (!column_ok) {
+    return KATANA_ERROR(
+        ErrorCode::ArrowError, "building edge property columns");
+  }
+
+  std::shared_ptr<arrow::Table> edge_properties =
+      property_names.empty()
+          ? EmptyTable(num_edges)
+          : arrow::Table::Make(arrow::schema(fields), columns, num_edges);
+
+  GraphComponents components;
+  components.nodes =
+      GraphComponent{EmptyTable(num_nodes), EmptyTable(num_nodes)};
+  components.edges =
+      GraphComponent{std::move(edge_properties), EmptyTable(num_edges)};
+  components.topology =
+      GraphTopology(std::move(adj_indices), std::move(dests));
+  return Result<GraphComponents>(std::move(components));
+}
@@ -1,11 +1,15 @@
 #include "katana/GraphML.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstdint>
 #include <cstdlib>
+#include <fstream>
 #include <iostream>
+#include <iterator>
 #include <limits>
 #include <optional>
+#include <variant>
 #include <vector>
 
 #include <boost/algorithm/string.hpp>
@@ -15,6 +19,7 @@
 #include "katana/Galois.h"
 #include "katana/GraphMLSchema.h"
 #include "katana/Logging.h"
+#include "katana/Loops.h"
 #include "katana/PropertyGraph.h"
 #include "katana/SharedMemSys.h"
 #include "katana/Threads.h"
@@ -322,20 +327,42 @@ ProcessData(xmlTextReaderPtr reader) {
   return make_pair(key, propertyData);
 }
 
+/*
+ * Parsed form of one <node> element. Property values stay as raw strings;
+ * type resolution happens when the record is fed to the builder, so records
+ * can be produced by any thread.
+ */
+struct NodeRecord {
+  std::string id;
+  std::vector<std::string> labels;
+  std::vector<std::pair<std::string, std::string>> properties;
+};
+
+/*
+ * Parsed form of one <edge> element.
+ */
+struct EdgeRecord {
+  std::string source;
+  std::string target;
+  std::string type;
+  std::vector<std::pair<std::string, std::string>> properties;
+};
+
+using GraphRecord = std::variant<NodeRecord, EdgeRecord>;
+
 /*
  * reader should be pointing at the node element before calling
  *
- * parses the node from a GraphML file into readable form
+ * extracts the node from a GraphML file into a NodeRecord
  */
-void
-ProcessNode(xmlTextReaderPtr reader, katana::PropertyGraphBuilder* builder) {
+NodeRecord
+ParseNodeRecord(xmlTextReaderPtr reader) {
   auto minimum_depth = xmlTextReaderDepth(reader);
 
   int ret = xmlTextReaderMoveToNextAttribute(reader);
   xmlChar *name, *value;
 
-  std::string id;
-  std::vector<std::string> labels;
+  NodeRecord record;
 
   bool extractedLabels = false;  // neo4j includes these twice so only parse 1
 
@@ -346,7 +373,7 @@ ProcessNode(xmlTextReaderPtr reader, katana::PropertyGraphBuilder* builder) {
 
     if (name != NULL) {
       if (xmlStrEqual(name, BAD_CAST "id")) {
-        id = std::string((const char*)value);
+        record.id = std::string((const char*)value);
       } else if (
           xmlStrEqual(name, BAD_CAST "labels") ||
           xmlStrEqual(name, BAD_CAST "label")) {
@@ -355,7 +382,7 @@ ProcessNode(xmlTextReaderPtr reader, katana::PropertyGraphBuilder* builder) {
         if (data.front() == ':') {
           data.erase(0, 1);
         }
-        boost::split(labels, data, boost::is_any_of(":"));
+        boost::split(record.labels, data, boost::is_any_of(":"));
         extractedLabels = true;
       } else {
         KATANA_LOG_ERROR(
@@ -369,11 +396,6 @@ ProcessNode(xmlTextReaderPtr reader, katana::PropertyGraphBuilder* builder) {
     ret = xmlTextReaderMoveToNextAttribute(reader);
   }
 
-  bool validNode = !id.empty();
-  if (validNode) {
-    builder->StartNode(id);
-  }
-
   // parse "data" xml nodes for properties
   ret = xmlTextReaderRead(reader);
   // will terminate when </node> reached or an improper read
@@ -397,22 +419,11 @@ ProcessNode(xmlTextReaderPtr reader, katana::PropertyGraphBuilder* builder) {
               if (data.front() == ':') {
                 data.erase(0, 1);
               }
-              boost::split(labels, data, boost::is_any_of(":"));
+              boost::split(record.labels, data, boost::is_any_of(":"));
               extractedLabels = true;
             }
           } else if (property.first != std::string("IGNORE")) {
-            if (validNode) {
-              const std::string& value = property.second;
-              builder->AddValue(
-                  property.first,
-                  [&]() {
-                    return PropertyKey{
-                        property.first, ImportDataType::kString, false};
-                  },
-                  [&value](ImportDataType type, bool is_list) {
-                    return ResolveValue(value, type, is_list);
-                  });
-            }
+            record.properties.emplace_back(std::move(property));
           }
         }
       } else {
@@ -426,32 +437,22 @@ ProcessNode(xmlTextReaderPtr reader, katana::PropertyGraphBuilder* builder) {
     ret = xmlTextReaderRead(reader);
   }
 
-  // add labels if they exists
-  if (validNode) {
-    if (!labels.empty()) {
-      for (std::string label : labels) {
-        builder->AddLabel(label);
-      }
-    }
-    builder->FinishNode();
-  }
+  return record;
 }
 
 /*
  * reader should be pointing at the edge element before calling
  *
- * parses the edge from a GraphML file into readable form
+ * extracts the edge from a GraphML file into an EdgeRecord
  */
-void
-ProcessEdge(xmlTextReaderPtr reader, katana::PropertyGraphBuilder* builder) {
+EdgeRecord
+ParseEdgeRecord(xmlTextReaderPtr reader) {
   auto minimum_depth = xmlTextReaderDepth(reader);
 
   int ret = xmlTextReaderMoveToNextAttribute(reader);
   xmlChar *name, *value;
 
-  std::string source;
-  std::string target;
-  std::string type;
+  EdgeRecord record;
   bool extracted_type = false;  // neo4j includes these twice so only parse 1
 
   // parse node attributes for id (required) and label(s) (optional)
@@ -462,13 +463,13 @@ ProcessEdge(xmlTextReaderPtr reader, katana::PropertyGraphBuilder* builder) {
     if (name != NULL) {
       if (xmlStrEqual(name, BAD_CAST "id")) {
       } else if (xmlStrEqual(name, BAD_CAST "source")) {
-        source = std::string((const char*)value);
+        record.source = std::string((const char*)value);
       } else if (xmlStrEqual(name, BAD_CAST "target")) {
-        target = std::string((const char*)value);
+        record.target = std::string((const char*)value);
       } else if (
           xmlStrEqual(name, BAD_CAST "labels") ||
           xmlStrEqual(name, BAD_CAST "label")) {
-        type = std::string((const char*)value);
+        record.type = std::string((const char*)value);
         extracted_type = true;
       } else {
         KATANA_LOG_ERROR(
@@ -482,11 +483,6 @@ ProcessEdge(xmlTextReaderPtr reader, katana::PropertyGraphBuilder* builder) {
     ret = xmlTextReaderMoveToNextAttribute(reader);
   }
 
-  bool valid_edge = !source.empty() && !target.empty();
-  if (valid_edge) {
-    valid_edge = builder->StartEdge(source, target);
-  }
-
   // parse "data" xml edges for properties
   ret = xmlTextReaderRead(reader);
   // will terminate when </edge> reached or an improper read
@@ -505,22 +501,11 @@ ProcessEdge(xmlTextReaderPtr reader, katana::PropertyGraphBuilder* builder) {
           if (property.first == std::string("label") ||
               property.first == std::string("labels")) {
             if (!extracted_type) {
-              type = property.second;
+              record.type = property.second;
               extracted_type = true;
             }
           } else if (property.first != std::string("IGNORE")) {
-            if (valid_edge) {
-              const std::string& value = property.second;
-              builder->AddValue(
-                  property.first,
-                  [&]() {
-                    return PropertyKey{
-                        property.first, ImportDataType::kString, false};
-                  },
-                  [&value](ImportDataType type, bool is_list) {
-                    return ResolveValue(value, type, is_list);
-                  });
-            }
+            record.properties.emplace_back(std::move(property));
           }
         }
       } else {
@@ -533,13 +518,89 @@ ProcessEdge(xmlTextReaderPtr reader, katana::PropertyGraphBuilder* builder) {
     ret = xmlTextReaderRead(reader);
   }
 
-  // add type if it exists
-  if (valid_edge) {
-    if (type.length() > 0) {
-      builder->AddLabel(type);
-    }
-    builder->FinishEdge();
+  return record;
+}
+
+/*
+ * Feeds a parsed node record to the builder; must run on the thread that
+ * owns the builder since node indexes are assigned in feed order.
+ */
+void
+FeedRecord(katana::PropertyGraphBuilder* builder, const NodeRecord& record) {
+  if (record.id.empty()) {
+    return;
+  }
+  builder->StartNode(record.id);
+
+  for (const auto& property : record.properties) {
+    const std::string& key = property.first;
+    const std::string& value = property.second;
+    builder->AddValue(
+        key,
+        [&]() {
+          return PropertyKey{key, ImportDataType::kString, false};
+        },
+        [&value](ImportDataType type, bool is_list) {
+          return ResolveValue(value, type, is_list);
+        });
+  }
+
+  for (const std::string& label : record.labels) {
+    builder->AddLabel(label);
+  }
+  builder->FinishNode();
+}
+
+/*
+ * Feeds a parsed edge record to the builder; must run on the thread that
+ * owns the builder since edge indexes are assigned in feed order.
+ */
+void
+FeedRecord(katana::PropertyGraphBuilder* builder, const EdgeRecord& record) {
+  if (record.source.empty() || record.target.empty()) {
+    return;
+  }
+  if (!builder->StartEdge(record.source, record.target)) {
+    return;
+  }
+
+  for (const auto& property : record.properties) {
+    const std::string& key = property.first;
+    const std::string& value = property.second;
+    builder->AddValue(
+        key,
+        [&]() {
+          return PropertyKey{key, ImportDataType::kString, false};
+        },
+        [&value](ImportDataType type, bool is_list) {
+          return ResolveValue(value, type, is_list);
+        });
   }
+
+  if (record.type.length() > 0) {
+    builder->AddLabel(record.type);
+  }
+  builder->FinishEdge();
+}
+
+/*
+ * reader should be pointing at the node element before calling
+ *
+ * parses the node from a GraphML file into readable form
+ */
+void
+ProcessNode(xmlTextReaderPtr reader, katana::PropertyGraphBuilder* builder) {
+  FeedRecord(builder, ParseNodeRecord(reader));
+}
+
+/*
+ * reader should be pointing at the edge element before calling
+ *
+ * parses the edge from a GraphML file into readable form
+ */
+void
+ProcessEdge(xmlTextReaderPtr reader, katana::PropertyGraphBuilder* builder) {
+  FeedRecord(builder, ParseEdgeRecord(reader));
 }
 
 /*
@@ -592,6 +653,75 @@ ProcessGraph(
   }
 }
 
+/*********************************************/
+/* Pipelined parallel import of large files  */
+/*********************************************/
+
+/*
+ * Parses one chunk of <node>/<edge> elements into records. The chunk is
+ * wrapped in a synthetic <graph> element so it forms a well-formed
+ * document; each worker owns its own libxml2 reader.
+ */
+bool
+ParseFragment(const std::string& fragment, std::vector<GraphRecord>* records) {
+  xmlTextReaderPtr reader =
+      xmlReaderForMemory(fragment.data(), fragment.size(), NULL, NULL, 0);
+  if (reader == NULL) {
+    return false;
+  }
+
+  int ret;
+  while ((ret = xmlTextReaderRead(reader)) == 1) {
+    xmlChar* name = xmlTextReaderName(reader);
+    if (name == NULL) {
+      name = xmlStrdup(BAD_CAST "--");
+    }
+    if (xmlTextReaderNodeType(reader) == 1) {
+      if (xmlStrEqual(name, BAD_CAST "node")) {
+        records->emplace_back(ParseNodeRecord(reader));
+      } else if (xmlStrEqual(name, BAD_CAST "edge")) {
+        records->emplace_back(ParseEdgeRecord(reader));
+      } else if (!xmlStrEqual(name, BAD_CAST "graph")) {
+        KATANA_LOG_ERROR(
+            "Found element: {}, which was ignored",
+            std::string((const char*)name));
+      }
+    }
+    xmlFree(name);
+  }
+
+  xmlFreeTextReader(reader);
+  return ret == 0;
+}
+
+/*
+ * Returns the byte offsets of every <node> and <edge> element start in
+ * [begin, end). A raw byte scan is sound for machine-generated exports
+ * (e.g. neo4j), which do not hide element text in comments or CDATA
+ * sections; files where the scan misfires fail XML parsing later and fall
+ * back to the serial importer.
+ */
+std::vector<size_t>
+FindElementOffsets(const std::string& buf, size_t begin, size_t end) {
+  std::vector<size_t> offsets;
+  for (size_t pos = begin; pos < end;) {
+    size_t next = buf.find('<', pos);
+    if (next == std::string::npos || next >= end) {
+      break;
+    }
+    if (buf.compare(next, 5, "<node") == 0 ||
+        buf.compare(next, 5, "<edge") == 0) {
+      char following = next + 5 < end ? buf[next + 5] : '\0';
+      if (following == ' ' || following == '>' || following == '/' ||
+          following == '\t' || following == '\n' || following == '\r') {
+        offsets.emplace_back(next);
+      }
+    }
+    pos = next + 1;
+  }
+  return offsets;
+}
+
 }  // end of unnamed namespace
 
 katana::Result<katana::GraphComponents>
@@ -658,3 +788,122 @@ katana::ConvertGraphML(
   }
   return builder.Finish(verbose);
 }
+
+katana::Result<katana::GraphComponents>
+katana::ConvertGraphMLParallel(
+    const std::string& infilename, size_t chunk_size, bool verbose) {
+  std::ifstream in(infilename, std::ios::binary);
+  if (!in) {
+    return KATANA_ERROR(ErrorCode::NotFound, "Unable to open {}", infilename);
+  }
+  std::string buf{
+      std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+  in.close();
+
+  // locate the body of the first <graph> element; "<graphml" also matches
+  // the prefix, so check the following character
+  size_t graph_begin = buf.find("<graph");
+  while (graph_begin != std::string::npos) {
+    char following =
+        graph_begin + 6 < buf.size() ? buf[graph_begin + 6] : '\0';
+    if (following == ' ' || following == '>' || following == '\t' ||
+        following == '\n' || following == '\r') {
+      break;
+    }
+    graph_begin = buf.find("<graph", graph_begin + 1);
+  }
+  size_t graph_end = buf.rfind("</graph>");
+  if (graph_begin == std::string::npos || graph_end == std::string::npos ||
+      graph_end < graph_begin) {
+    // not a shape the splitter understands; take the serial path
+    return ConvertGraphML(infilename, chunk_size, verbose);
+  }
+
+  // parallel workers each construct their own parser context; make sure
+  // the library-wide state is initialized before any of them start
+  xmlInitParser();
+
+  katana::PropertyGraphBuilder builder{chunk_size};
+
+  // parse the key declarations ahead of <graph> exactly as the serial path
+  // does; closing the root early yields a well-formed header document
+  {
+    std::string header = buf.substr(0, graph_begin) + "</graphml>";
+    xmlTextReaderPtr reader =
+        xmlReaderForMemory(header.data(), header.size(), NULL, NULL, 0);
+    if (reader == NULL) {
+      return ConvertGraphML(infilename, chunk_size, verbose);
+    }
+    int ret;
+    while ((ret = xmlTextReaderRead(reader)) == 1) {
+      xmlChar* name = xmlTextReaderName(reader);
+      if (name != NULL && xmlTextReaderNodeType(reader) == 1 &&
+          xmlStrEqual(name, BAD_CAST "key")) {
+        PropertyKey key = katana::graphml::ProcessKey(reader);
+        if (!key.id.empty() && key.id != std::string("label") &&
+            key.id != std::string("IGNORE") &&
+            (key.for_node || key.for_edge)) {
+          builder.AddBuilder(std::move(key));
+        }
+      }
+      xmlFree(name);
+    }
+    xmlFreeTextReader(reader);
+    if (ret < 0) {
+      return ConvertGraphML(infilename, chunk_size, verbose);
+    }
+    if (verbose) {
+      std::cout << "Finished processing property headers\n";
+    }
+  }
+
+  std::vector<size_t> offsets = FindElementOffsets(buf, graph_begin, graph_end);
+  if (offsets.empty()) {
+    return builder.Finish(verbose);
+  }
+
+  // split the element list into contiguous chunks, one record vector per
+  // chunk so workers never contend and document order is preserved
+  size_t num_chunks =
+      std::min(offsets.size(), size_t{katana::getActiveThreads()} * 4);
+  std::vector<std::vector<GraphRecord>> records(num_chunks);
+  std::atomic<bool> parse_ok{true};
+
+  katana::do_all(
+      katana::iterate(size_t{0}, num_chunks),
+      [&](size_t i) {
+        size_t first = offsets.size() * i / num_chunks;
+        size_t last = offsets.size() * (i + 1) / num_chunks;
+        if (first == last) {
+          return;
+        }
+        size_t lo = offsets[first];
+        size_t hi = last < offsets.size() ? offsets[last] : graph_end;
+        std::string fragment =
+            "<graph>" + buf.substr(lo, hi - lo) + "</graph>";
+        if (!ParseFragment(fragment, &records[i])) {
+          parse_ok = false;
+        }
+      },
+      katana::steal());
+
+  if (!parse_ok) {
+    return KATANA_ERROR(
+        ErrorCode::InvalidArgument,
+        "failed to parse: incorrect xml format\n"
+        "Please verify there are no illegal characters in the GraphML file\n"
+        "To remove invalid characters use: \"sed -i $'s/[^[:print:]\t]//g' "
+        "<file>\", warning this will alter the original file");
+  }
+
+  // index assignment in the builder is order-dependent, so records are fed
+  // serially in document order; parsing dominates import time and has
+  // already happened above
+  for (const std::vector<GraphRecord>& chunk : records) {
+    for (const GraphRecord& record : chunk) {
+      std::visit([&](const auto& r) { FeedRecord(&builder, r); }, record);
+    }
+  }
+
+  return builder.Finish(verbose);
+}
@@ -0,0 +1,510 @@
+#include "katana/GraphSnapshot.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <arrow/api.h>
+#include <arrow/io/api.h>
+#include <arrow/ipc/api.h>
+
+#include "katana/ArrowIPCWriter.h"
+#include "katana/ErrorCode.h"
+#include "katana/FileView.h"
+#include "katana/JSON.h"
+#include "katana/Loops.h"
+#include "katana/NUMAArray.h"
+
+namespace {
+
+constexpr char kSnapshotMagic[8] = {'K', 'S', 'N', 'A', 'P', '0', '0', '1'};
+constexpr uint64_t kSnapshotVersion = 1;
+constexpr uint64_t kSectionAlignment = 8;
+constexpr uint64_t kWriteChunkSize = uint64_t{8} << 20;
+
+// Serialized forms of the EntityTypeManager storage maps; unordered_map
+// keys are not strings so they round-trip through explicit pair lists.
+using TypeDictPairs =
+    std::vector<std::pair<katana::EntityTypeID, std::vector<katana::EntityTypeID>>>;
+using TypeNamePairs = std::vector<std::pair<katana::EntityTypeID, std::string>>;
+
+struct SnapshotSection {
+  uint64_t offset{0};
+  uint64_t length{0};
+};
+
+void
+to_json(nlohmann::json& j, const SnapshotSection& s) {
+  j = nlohmann::json{{"offset", s.offset}, {"length", s.length}};
+}
+
+void
+from_json(const nlohmann::json& j, SnapshotSection& s) {
+  j.at("offset").get_to(s.offset);
+  j.at("length").get_to(s.length);
+}
+
+// Manifest of a snapshot file. Section offsets are relative to the
+// aligned payload base that follows the header so the manifest can be
+// laid out before its own length is known.
+struct SnapshotManifest {
+  uint64_t version{kSnapshotVersion};
+  uint64_t num_nodes{0};
+  uint64_t num_edges{0};
+  SnapshotSection adj_indices;
+  SnapshotSection dests;
+  SnapshotSection edge_prop_indices;
+  SnapshotSection node_prop_indices;
+  SnapshotSection node_type_ids;
+  SnapshotSection edge_type_ids;
+  SnapshotSection node_properties;
+  SnapshotSection edge_properties;
+  TypeDictPairs node_type_dict;
+  TypeNamePairs node_type_names;
+  TypeDictPairs edge_type_dict;
+  TypeNamePairs edge_type_names;
+};
+
+void
+to_json(nlohmann::json& j, const SnapshotManifest& m) {
+  j = nlohmann::json{
+      {"version", m.version},
+      {"num_nodes", m.num_nodes},
+      {"num_edges", m.num_edges},
+      {"adj_indices", m.adj_indices},
+      {"dests", m.dests},
+      {"edge_prop_indices", m.edge_prop_indices},
+      {"node_prop_indices", m.node_prop_indices},
+      {"node_type_ids", m.node_type_ids},
+      {"edge_type_ids", m.edge_type_ids},
+      {"node_properties", m.node_properties},
+      {"edge_properties", m.edge_properties},
+      {"node_type_dict", m.node_type_dict},
+      {"node_type_names", m.node_type_names},
+      {"edge_type_dict", m.edge_type_dict},
+      {"edge_type_names", m.edge_type_names},
+  };
+}
+
+void
+from_json(const nlohmann::json& j, SnapshotManifest& m) {
+  j.at("version").get_to(m.version);
+  j.at("num_nodes").get_to(m.num_nodes);
+  j.at("num_edges").get_to(m.num_edges);
+  j.at("adj_indices").get_to(m.adj_indices);
+  j.at("dests").get_to(m.dests);
+  j.at("edge_prop_indices").get_to(m.edge_prop_indices);
+  j.at("node_prop_indices").get_to(m.node_prop_indices);
+  j.at("node_type_ids").get_to(m.node_type_ids);
+  j.at("edge_type_ids").get_to(m.edge_type_ids);
+  j.at("node_properties").get_to(m.node_properties);
+  j.at("edge_properties").get_to(m.edge_properties);
+  j.at("node_type_dict").get_to(m.node_type_dict);
+  j.at("node_type_names").get_to(m.node_type_names);
+  j.at("edge_type_dict").get_to(m.edge_type_dict);
+  j.at("edge_type_names").get_to(m.edge_type_names);
+}
+
+uint64_t
+AlignUp(uint64_t value) {
+  return (value + kSectionAlignment - 1) & ~(kSectionAlignment - 1);
+}
+
+// Keeps the snapshot mapping alive for the lifetime of Arrow data that
+// references it, so restored property tables read straight from the
+// page cache with no copy.
+class FileViewBuffer : public arrow::Buffer {
+public:
+  FileViewBuffer(
+      std::shared_ptr<katana::FileView> view, const uint8_t* data,
+      int64_t length)
+      : arrow::Buffer(data, length), view_(std::move(view)) {}
+
+private:
+  std::shared_ptr<katana::FileView> view_;
+};
+
+katana::Result<void>
+WriteRegion(int fd, const uint8_t* data, uint64_t length, uint64_t offset) {
+  while (length > 0) {
+    ssize_t written = pwrite(fd, data, length, static_cast<off_t>(offset));
+    if (written < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return KATANA_ERROR(
+          katana::ResultErrno(), "writing snapshot region at offset {}",
+          offset);
+    }
+    data += written;
+    length -= written;
+    offset += written;
+  }
+  return katana::ResultSuccess();
+}
+
+katana::Result<std::shared_ptr<arrow::Buffer>>
+PropertiesToIPC(
+    const katana::PropertyGraph& pg, bool for_nodes) {
+  int32_t num_properties =
+      for_nodes ? pg.GetNumNodeProperties() : pg.GetNumEdgeProperties();
+  if (num_properties == 0) {
+    return std::shared_ptr<arrow::Buffer>();
+  }
+  std::vector<std::shared_ptr<arrow::Field>> fields;
+  std::vector<std::shared_ptr<arrow::ChunkedArray>> columns;
+  for (int32_t i = 0; i < num_properties; ++i) {
+    std::shared_ptr<arrow::ChunkedArray> column =
+        for_nodes ? pg.GetNodeProperty(i) : pg.GetEdgeProperty(i);
+    std::string name =
+        for_nodes ? pg.GetNodePropertyName(i) : pg.GetEdgePropertyName(i);
+    fields.emplace_back(arrow::field(std::move(name), column->type()));
+    columns.emplace_back(std::move(column));
+  }
+  std::unique_ptr<katana::ArrowIPCWriter> writer =
+      KATANA_CHECKED(katana::ArrowIPCWriter::Make(
+          arrow::Table::Make(arrow::schema(fields), columns)));
+  return writer->ToBuffer();
+}
+
+katana::Result<std::shared_ptr<arrow::Table>>
+TableFromIPC(
+    const std::shared_ptr<katana::FileView>& view, uint64_t offset,
+    uint64_t length) {
+  auto buffer = std::make_shared<FileViewBuffer>(
+      view, view->ptr<uint8_t>() + offset, static_cast<int64_t>(length));
+  std::shared_ptr<arrow::ipc::RecordBatchStreamReader> reader =
+      KATANA_CHECKED(arrow::ipc::RecordBatchStreamReader::Open(
+          std::make_shared<arrow::io::BufferReader>(buffer)));
+  std::shared_ptr<arrow::Table> table;
+  KATANA_CHECKED(reader->ReadAll(&table));
+  return table;
+}
+
+TypeDictPairs
+ToPairs(const katana::EntityTypeIDToSetOfEntityTypeIDsStorageMap& map) {
+  return TypeDictPairs(map.begin(), map.end());
+}
+
+TypeNamePairs
+ToPairs(const katana::EntityTypeIDToAtomicTypeNameMap& map) {
+  return TypeNamePairs(map.begin(), map.end());
+}
+
+// Copy a raw section of the mapping into a freshly NUMA-interleaved
+// array, block-parallel. NUMAArray owns its own interleaved mapping, so
+// restore copies rather than adopting the file pages in place; the copy
+// is sequential reads from the page cache and parallelizes well.
+template <typename T>
+void
+FillFromSection(
+    katana::NUMAArray<T>* array, const katana::FileView& view,
+    uint64_t offset, uint64_t count) {
+  array->allocateInterleaved(count);
+  const T* src = view.ptr<T>(offset);
+  constexpr uint64_t kBlock = uint64_t{1} << 20;
+  uint64_t num_blocks = (count + kBlock - 1) / kBlock;
+  katana::do_all(
+      katana::iterate(uint64_t{0}, num_blocks),
+      [&](uint64_t b) {
+        uint64_t begin = b * kBlock;
+        uint64_t end = std::min(begin + kBlock, count);
+        std::memcpy(
+            array->data() + begin, src + begin, (end - begin) * sizeof(T));
+      },
+      katana::loopname("SnapshotCopySection"));
+}
+
+}  // namespace
+
+katana::Result<void>
+katana::WriteGraphSnapshot(const PropertyGraph& pg, const std::string& path) {
+  using Node = GraphTopology::Node;
+  using Edge = GraphTopology::Edge;
+  using PropertyIndex = GraphTopology::PropertyIndex;
+
+  const GraphTopology& topo = pg.topology();
+  const uint64_t num_nodes = topo.NumNodes();
+  const uint64_t num_edges = topo.NumEdges();
+
+  // The adjacency and destination arrays dump directly; the property
+  // index and type arrays are gathered through the public per-element
+  // accessors into contiguous staging arrays first.
+  NUMAArray<PropertyIndex> edge_prop_indices;
+  edge_prop_indices.allocateInterleaved(num_edges);
+  katana::do_all(katana::iterate(Edge{0}, Edge{num_edges}), [&](Edge e) {
+    edge_prop_indices[e] = topo.GetEdgePropertyIndexFromOutEdge(e);
+  });
+  NUMAArray<PropertyIndex> node_prop_indices;
+  node_prop_indices.allocateInterleaved(num_nodes);
+  katana::do_all(katana::iterate(Node{0}, Node{num_nodes}), [&](Node n) {
+    node_prop_indices[n] = pg.GetNodePropertyIndex(n);
+  });
+  NUMAArray<EntityTypeID> node_type_ids;
+  node_type_ids.allocateInterleaved(num_nodes);
+  katana::do_all(katana::iterate(Node{0}, Node{num_nodes}), [&](Node n) {
+    node_type_ids[n] = pg.GetTypeOfNode(n);
+  });
+  NUMAArray<EntityTypeID> edge_type_ids;
+  edge_type_ids.allocateInterleaved(num_edges);
+  katana::do_all(katana::iterate(Edge{0}, Edge{num_edges}), [&](Edge e) {
+    edge_type_ids[e] =
+        pg.GetTypeOfEdgeFromPropertyIndex(static_cast<PropertyIndex>(e));
+  });
+
+  std::shared_ptr<arrow::Buffer> node_props_ipc =
+      KATANA_CHECKED(PropertiesToIPC(pg, true));
+  std::shared_ptr<arrow::Buffer> edge_props_ipc =
+      KATANA_CHECKED(PropertiesToIPC(pg, false));
+
+  SnapshotManifest manifest;
+  manifest.num_nodes = num_nodes;
+  manifest.num_edges = num_edges;
+
+  EntityTypeIDToSetOfEntityTypeIDsStorageMap node_dict;
+  EntityTypeIDToAtomicTypeNameMap node_names;
+  KATANA_CHECKED(
+      pg.GetNodeTypeManager().ExtractEntityTypeInfo(&node_dict, &node_names));
+  manifest.node_type_dict = ToPairs(node_dict);
+  manifest.node_type_names = ToPairs(node_names);
+  EntityTypeIDToSetOfEntityTypeIDsStorageMap edge_dict;
+  EntityTypeIDToAtomicTypeNameMap edge_names;
+  KATANA_CHECKED(
+      pg.GetEdgeTypeManager().ExtractEntityTypeInfo(&edge_dict, &edge_names));
+  manifest.edge_type_dict = ToPairs(edge_dict);
+  manifest.edge_type_names = ToPairs(edge_names);
+
+  struct RawSection {
+    SnapshotSection* entry;
+    const uint8_t* data;
+    uint64_t length;
+  };
+  std::vector<RawSection> sections = {
+      {&manifest.adj_indices, reinterpret_cast<const uint8_t*>(topo.AdjData()),
+       num_nodes * sizeof(Edge)},
+      {&manifest.dests, reinterpret_cast<const uint8_t*>(topo.DestData()),
+       num_edges * sizeof(Node)},
+      {&manifest.edge_prop_indices,
+       reinterpret_cast<const uint8_t*>(edge_prop_indices.data()),
+       num_edges * sizeof(PropertyIndex)},
+      {&manifest.node_prop_indices,
+       reinterpret_cast<const uint8_t*>(node_prop_indices.data()),
+       num_nodes * sizeof(PropertyIndex)},
+      {&manifest.node_type_ids,
+       reinterpret_cast<const uint8_t*>(node_type_ids.data()),
+       num_nodes * sizeof(EntityTypeID)},
+      {&manifest.edge_type_ids,
+       reinterpret_cast<const uint8_t*>(edge_type_ids.data()),
+       num_edges * sizeof(EntityTypeID)},
+  };
+  if (node_props_ipc) {
+    sections.push_back(
+        {&manifest.node_properties, node_props_ipc->data(),
+         static_cast<uint64_t>(node_props_ipc->size())});
+  }
+  if (edge_props_ipc) {
+    sections.push_back(
+        {&manifest.edge_properties, edge_props_ipc->data(),
+         static_cast<uint64_t>(edge_props_ipc->size())});
+  }
+
+  uint64_t payload_size = 0;
+  for (RawSection& section : sections) {
+    section.entry->offset = payload_size;
+    section.entry->length = section.length;
+    payload_size = AlignUp(payload_size + section.length);
+  }
+
+  std::string manifest_json = KATANA_CHECKED(JsonDump(manifest));
+  const uint64_t manifest_length = manifest_json.size();
+  const uint64_t payload_base =
+      AlignUp(sizeof(kSnapshotMagic) + sizeof(uint64_t) + manifest_length);
+  const uint64_t total_size = payload_base + payload_size;
+
+  int fd = open(path.c_str(), O_CREAT | O_TRUNC | O_WRONLY, 0644);
+  if (fd < 0) {
+    return KATANA_ERROR(ResultErrno(), "creating snapshot file {}", path);
+  }
+  if (ftruncate(fd, static_cast<off_t>(total_size)) < 0) {
+    auto err =
+        KATANA_ERROR(ResultErrno(), "sizing snapshot file {}", path);
+    close(fd);
+    return err;
+  }
+
+  // Each section is split into fixed-size chunks written concurrently
+  // with pwrite at precomputed offsets; the header goes last so a
+  // partially written file never carries a valid magic.
+  struct WriteChunk {
+    const uint8_t* data;
+    uint64_t offset;
+    uint64_t length;
+  };
+  std::vector<WriteChunk> chunks;
+  for (const RawSection& section : sections) {
+    for (uint64_t done = 0; done < section.length; done += kWriteChunkSize) {
+      uint64_t length = std::min(kWriteChunkSize, section.length - done);
+      chunks.push_back(
+          {section.data + done, payload_base + section.entry->offset + done,
+           length});
+    }
+  }
+  std::atomic<int> first_errno{0};
+  katana::do_all(
+      katana::iterate(size_t{0}, chunks.size()),
+      [&](size_t i) {
+        auto res =
+            WriteRegion(fd, chunks[i].data, chunks[i].length, chunks[i].offset);
+        if (!res) {
+          int expected = 0;
+          first_errno.compare_exchange_strong(expected, errno ? errno : EIO);
+        }
+      },
+      katana::loopname("SnapshotParallelWrite"));
+  if (int saved = first_errno.load(); saved != 0) {
+    close(fd);
+    return KATANA_ERROR(
+        std::error_code(saved, std::system_category()),
+        "writing snapshot sections to {}", path);
+  }
+
+  std::vector<uint8_t> header(payload_base, 0);
+  std::memcpy(header.data(), kSnapshotMagic, sizeof(kSnapshotMagic));
+  std::memcpy(
+      header.data() + sizeof(kSnapshotMagic), &manifest_length,
+      sizeof(manifest_length));
+  std::memcpy(
+      header.data() + sizeof(kSnapshotMagic) + sizeof(manifest_length),
+      manifest_json.data(), manifest_length);
+  if (auto res = WriteRegion(fd, header.data(), header.size(), 0); !res) {
+    close(fd);
+    return res.error().WithContext("writing snapshot header to {}", path);
+  }
+
+  if (fsync(fd) < 0) {
+    auto err = KATANA_ERROR(ResultErrno(), "syncing snapshot file {}", path);
+    close(fd);
+    return err;
+  }
+  close(fd);
+  return katana::ResultSuccess();
+}
+
+katana::Result<std::unique_ptr<katana::PropertyGraph>>
+katana::LoadGraphSnapshot(
+    const std::string& path, katana::TxnContext* txn_ctx) {
+  using Edge = GraphTopology::Edge;
+  using Node = GraphTopology::Node;
+  using PropertyIndex = GraphTopology::PropertyIndex;
+
+  auto view = std::make_shared<FileView>();
+  KATANA_CHECKED_CONTEXT(
+      view->Bind(path, true), "opening snapshot file {}", path);
+  if (view->size() < sizeof(kSnapshotMagic) + sizeof(uint64_t)) {
+    return KATANA_ERROR(
+        ErrorCode::InvalidArgument, "{} is too small to be a snapshot", path);
+  }
+  if (std::memcmp(view->ptr<char>(), kSnapshotMagic, sizeof(kSnapshotMagic)) !=
+      0) {
+    return KATANA_ERROR(
+        ErrorCode::InvalidArgument, "{} is not a graph snapshot", path);
+  }
+  uint64_t manifest_length{};
+  std::memcpy(
+      &manifest_length, view->ptr<char>() + sizeof(kSnapshotMagic),
+      sizeof(manifest_length));
+  if (sizeof(kSnapshotMagic) + sizeof(uint64_t) + manifest_length >
+      view->size()) {
+    return KATANA_ERROR(
+        ErrorCode::InvalidArgument, "snapshot manifest in {} is truncated",
+        path);
+  }
+  std::string_view manifest_text(
+      view->ptr<char>() + sizeof(kSnapshotMagic) + sizeof(uint64_t),
+      manifest_length);
+  SnapshotManifest manifest =
+      KATANA_CHECKED(JsonParse<SnapshotManifest>(manifest_text));
+  if (manifest.version != kSnapshotVersion) {
+    return KATANA_ERROR(
+        ErrorCode::BadVersion, "snapshot {} has version {}, expected {}", path,
+        manifest.version, kSnapshotVersion);
+  }
+  const uint64_t payload_base =
+      AlignUp(sizeof(kSnapshotMagic) + sizeof(uint64_t) + manifest_length);
+
+  GraphTopology::AdjIndexVec adj_indices;
+  FillFromSection(
+      &adj_indices, *view, payload_base + manifest.adj_indices.offset,
+      manifest.num_nodes);
+  GraphTopology::EdgeDestVec dests;
+  FillFromSection(
+      &dests, *view, payload_base + manifest.dests.offset, manifest.num_edges);
+  GraphTopology::PropIndexVec edge_prop_indices;
+  FillFromSection(
+      &edge_prop_indices, *view,
+      payload_base + manifest.edge_prop_indices.offset, manifest.num_edges);
+  GraphTopology::PropIndexVec node_prop_indices;
+  FillFromSection(
+      &node_prop_indices, *view,
+      payload_base + manifest.node_prop_indices.offset, manifest.num_nodes);
+  PropertyGraph::EntityTypeIDArray node_type_ids;
+  FillFromSection(
+      &node_type_ids, *view, payload_base + manifest.node_type_ids.offset,
+      manifest.num_nodes);
+  PropertyGraph::EntityTypeIDArray edge_type_ids;
+  FillFromSection(
+      &edge_type_ids, *view, payload_base + manifest.edge_type_ids.offset,
+      manifest.num_edges);
+  static_assert(sizeof(Edge) == sizeof(uint64_t));
+  static_assert(sizeof(Node) == sizeof(uint32_t));
+  static_assert(sizeof(PropertyIndex) == sizeof(uint64_t));
+
+  GraphTopology topo(
+      std::move(adj_indices), std::move(dests), std::move(edge_prop_indices),
+      std::move(node_prop_indices));
+
+  EntityTypeIDToSetOfEntityTypeIDsStorageMap node_dict(
+      manifest.node_type_dict.begin(), manifest.node_type_dict.end());
+  EntityTypeIDToAtomicTypeNameMap node_names(
+      manifest.node_type_names.begin(), manifest.node_type_names.end());
+  EntityTypeManager node_manager =
+      KATANA_CHECKED(EntityTypeManager::Make(node_dict, node_names));
+  EntityTypeIDToSetOfEntityTypeIDsStorageMap edge_dict(
+      manifest.edge_type_dict.begin(), manifest.edge_type_dict.end());
+  EntityTypeIDToAtomicTypeNameMap edge_names(
+      manifest.edge_type_names.begin(), manifest.edge_type_names.end());
+  EntityTypeManager edge_manager =
+      KATANA_CHECKED(EntityTypeManager::Make(edge_dict, edge_names));
+
+  std::unique_ptr<PropertyGraph> pg = KATANA_CHECKED(PropertyGraph::Make(
+      std::move(topo), std::move(node_type_ids), std::move(edge_type_ids),
+      std::move(node_manager), std::move(edge_manager)));
+
+  // Property tables are adopted zero-copy: record batches reference the
+  // snapshot mapping through FileViewBuffer, so no column data is
+  // materialized until touched.
+  if (manifest.node_properties.length > 0) {
+    std::shared_ptr<arrow::Table> node_table = KATANA_CHECKED(TableFromIPC(
+        view, payload_base + manifest.node_properties.offset,
+        manifest.node_properties.length));
+    KATANA_CHECKED_CONTEXT(
+        pg->AddNodeProperties(node_table, txn_ctx),
+        "restoring node properties from {}", path);
+  }
+  if (manifest.edge_properties.length > 0) {
+    std::shared_ptr<arrow::Table> edge_table = KATANA_CHECKED(TableFromIPC(
+        view, payload_base + manifest.edge_properties.offset,
+        manifest.edge_properties.length));
+    KATANA_CHECKED_CONTEXT(
+        pg->AddEdgeProperties(edge_table, txn_ctx),
+        "restoring edge properties from {}", path);
+  }
+
+  return pg;
+}
@@ -2,8 +2,15 @@
 
 #include <math.h>
 
+#include <algorithm>
+#include <atomic>
 #include <iostream>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <tuple>
 
+#include "katana/DegreeBins.h"
 #include "katana/Logging.h"
 #include "katana/PropertyGraph.h"
 #include "katana/RDGTopology.h"
@@ -26,11 +33,16 @@ katana::GraphTopology::Print() const noexcept {
   print_array(dests_, "dests_");
 }
 
+// Topology arrays are allocated blocked rather than interleaved: blocked
+// allocation first-touches each thread's contiguous block on that thread's
+// socket, and do_all hands threads the same blocked ranges, so the node and
+// edge ranges a socket iterates are the ranges resident in its memory.
+// Stealing still crosses sockets, but the common case stays local.
 katana::GraphTopology::GraphTopology(
     const Edge* adj_indices, size_t num_nodes, const Node* dests,
     size_t num_edges) noexcept {
-  adj_indices_.allocateInterleaved(num_nodes);
-  dests_.allocateInterleaved(num_edges);
+  adj_indices_.allocateBlocked(num_nodes);
+  dests_.allocateBlocked(num_edges);
 
   katana::ParallelSTL::copy(
       &adj_indices[0], &adj_indices[num_nodes], adj_indices_.begin());
@@ -41,22 +53,22 @@ katana::GraphTopology::GraphTopology(
     const Edge* adj_indices, size_t num_nodes, const Node* dests,
     size_t num_edges, const PropertyIndex* edge_prop_indices,
     const PropertyIndex* node_prop_indices) noexcept {
-  adj_indices_.allocateInterleaved(num_nodes);
-  dests_.allocateInterleaved(num_edges);
+  adj_indices_.allocateBlocked(num_nodes);
+  dests_.allocateBlocked(num_edges);
 
   katana::ParallelSTL::copy(
       &adj_indices[0], &adj_indices[num_nodes], adj_indices_.begin());
   katana::ParallelSTL::copy(&dests[0], &dests[num_edges], dests_.begin());
 
   if (edge_prop_indices) {
-    edge_prop_indices_.allocateInterleaved(num_edges);
+    edge_prop_indices_.allocateBlocked(num_edges);
     katana::ParallelSTL::copy(
         &edge_prop_indices[0], &edge_prop_indices[num_edges],
         edge_prop_indices_.begin());
   }
 
   if (node_prop_indices) {
-    node_prop_indices_.allocateInterleaved(num_nodes);
+    node_prop_indices_.allocateBlocked(num_nodes);
     katana::ParallelSTL::copy(
         &node_prop_indices[0], &node_prop_indices[num_nodes],
         node_prop_indices_.begin());
@@ -114,6 +126,331 @@ katana::ShuffleTopology::MakeFrom(
   return ret;
 }
 
+namespace {
+
+uint32_t
+VarIntLength(uint64_t val) noexcept {
+  uint32_t len = 1;
+  while (val >= 0x80) {
+    val >>= 7;
+    ++len;
+  }
+  return len;
+}
+
+uint8_t*
+EncodeVarInt(uint64_t val, uint8_t* out) noexcept {
+  while (val >= 0x80) {
+    *out++ = static_cast<uint8_t>(val) | 0x80;
+    val >>= 7;
+  }
+  *out++ = static_cast<uint8_t>(val);
+  return out;
+}
+
+uint64_t
+ZigZagEncode(int64_t val) noexcept {
+  return (static_cast<uint64_t>(val) << 1) ^
+         static_cast<uint64_t>(val >> (sizeof(int64_t) * 8 - 1));
+}
+
+}  // namespace
+
+katana::CompressedGraphTopologyView
+katana::CompressedGraphTopologyView::Make(const GraphTopology& topo) noexcept {
+  CompressedGraphTopologyView ret;
+  ret.num_edges_ = topo.NumEdges();
+  ret.offsets_.allocateInterleaved(topo.NumNodes() + 1);
+
+  // Pass 1: compute the encoded size of every node's block so blocks can be
+  // written in parallel without synchronization.
+  katana::do_all(
+      katana::iterate(topo.Nodes()),
+      [&](Node n) {
+        uint64_t bytes = VarIntLength(topo.OutDegree(n));
+        int64_t prev = 0;
+        for (auto e : topo.OutEdges(n)) {
+          int64_t dst = static_cast<int64_t>(topo.OutEdgeDst(e));
+          bytes += VarIntLength(ZigZagEncode(dst - prev));
+          prev = dst;
+        }
+        ret.offsets_[n + 1] = bytes;
+      },
+      katana::steal(), katana::no_stats());
+
+  ret.offsets_[0] = 0;
+  katana::ParallelSTL::partial_sum(
+      ret.offsets_.begin(), ret.offsets_.end(), ret.offsets_.begin());
+
+  ret.bytes_.allocateInterleaved(ret.offsets_[topo.NumNodes()]);
+
+  // Pass 2: encode each block into its slot.
+  katana::do_all(
+      katana::iterate(topo.Nodes()),
+      [&](Node n) {
+        uint8_t* out = &ret.bytes_[ret.offsets_[n]];
+        out = EncodeVarInt(topo.OutDegree(n), out);
+        int64_t prev = 0;
+        for (auto e : topo.OutEdges(n)) {
+          int64_t dst = static_cast<int64_t>(topo.OutEdgeDst(e));
+          out = EncodeVarInt(ZigZagEncode(dst - prev), out);
+          prev = dst;
+        }
+        KATANA_LOG_DEBUG_ASSERT(
+            out == ret.bytes_.data() + ret.offsets_[n + 1]);
+      },
+      katana::steal(), katana::no_stats());
+
+  return ret;
+}
+
+katana::Result<katana::BlockedCSRTopologyView>
+katana::BlockedCSRTopologyView::Make(const GraphTopology& topo) {
+  const uint64_t num_nodes = topo.NumNodes();
+  const uint64_t num_blocks = (num_nodes + kBlockSize - 1) / kBlockSize;
+
+  BlockedCSRTopologyView ret;
+  ret.dests_ = topo.DestData();
+  ret.num_edges_ = topo.NumEdges();
+  ret.rel_offsets_.allocateInterleaved(num_nodes);
+  ret.block_bases_.allocateInterleaved(num_blocks);
+
+  const Edge* adj = topo.AdjData();
+
+  std::atomic<bool> overflow{false};
+  katana::do_all(
+      katana::iterate(uint64_t{0}, num_blocks),
+      [&](uint64_t b) {
+        const uint64_t block_start = b * kBlockSize;
+        const Edge base = (block_start == 0) ? Edge{0} : adj[block_start - 1];
+        ret.block_bases_[b] = base;
+
+        const uint64_t block_end =
+            std::min(block_start + kBlockSize, num_nodes);
+        for (uint64_t n = block_start; n < block_end; ++n) {
+          const Edge rel = adj[n] - base;
+          if (rel > std::numeric_limits<uint32_t>::max()) {
+            overflow = true;
+            return;
+          }
+          ret.rel_offsets_[n] = static_cast<uint32_t>(rel);
+        }
+      },
+      katana::no_stats());
+
+  if (overflow) {
+    return KATANA_ERROR(
+        ErrorCode::InvalidArgument,
+        "a {}-node block spans 2^32 or more edges; blocked CSR offsets do "
+        "not fit in 32 bits",
+        kBlockSize);
+  }
+
+  return Result<BlockedCSRTopologyView>(std::move(ret));
+}
+
+katana::CSRCOOGraphTopologyView
+katana::CSRCOOGraphTopologyView::Make(const GraphTopology& topo) noexcept {
+  CSRCOOGraphTopologyView ret;
+  ret.adj_indices_ = topo.AdjData();
+  ret.dests_ = topo.DestData();
+  ret.num_nodes_ = topo.NumNodes();
+  ret.srcs_.allocateInterleaved(topo.NumEdges());
+
+  katana::do_all(
+      katana::iterate(topo.Nodes()),
+      [&](Node n) {
+        for (auto e : topo.OutEdges(n)) {
+          ret.srcs_[e] = n;
+        }
+      },
+      katana::steal(), katana::no_stats());
+
+  return ret;
+}
+
+namespace {
+
+// Linear merge over raw destination arrays. The unsigned-compare advance
+// keeps the loop body branch-free apart from the match test, which lets the
+// compiler unroll and vectorize it.
+size_t
+CountIntersectionMerge(
+    const katana::GraphTopology::Node* a_it,
+    const katana::GraphTopology::Node* a_end,
+    const katana::GraphTopology::Node* b_it,
+    const katana::GraphTopology::Node* b_end) noexcept {
+  size_t count = 0;
+  while (a_it != a_end && b_it != b_end) {
+    const auto a = *a_it;
+    const auto b = *b_it;
+    count += (a == b);
+    a_it += (a <= b);
+    b_it += (b <= a);
+  }
+  return count;
+}
+
+// Galloping search of the longer list for each element of the shorter one;
+// wins when the size ratio is large, as is common against hub nodes.
+size_t
+CountIntersectionGallop(
+    const katana::GraphTopology::Node* small_it,
+    const katana::GraphTopology::Node* small_end,
+    const katana::GraphTopology::Node* big_it,
+    const katana::GraphTopology::Node* big_end) noexcept {
+  size_t count = 0;
+  for (; small_it != small_end && big_it != big_end; ++small_it) {
+    const auto key = *small_it;
+    size_t bound = 1;
+    while (big_it + bound < big_end && *(big_it + bound) < key) {
+      bound *= 2;
+    }
+    big_it = std::lower_bound(
+        big_it, std::min(big_it + bound + 1, big_end), key);
+    if (big_it != big_end && *big_it == key) {
+      ++count;
+      ++big_it;
+    }
+  }
+  return count;
+}
+
+}  // namespace
+
+size_t
+katana::CountSortedIntersection(
+    const GraphTopology& topo, GraphTopology::Node u,
+    GraphTopology::Node v) noexcept {
+  constexpr size_t kGallopRatio = 32;
+
+  const auto* dests = topo.DestData();
+  auto u_range = topo.OutEdges(u);
+  auto v_range = topo.OutEdges(v);
+  const auto* u_beg = dests + *u_range.begin();
+  const auto* u_end = dests + *u_range.end();
+  const auto* v_beg = dests + *v_range.begin();
+  const auto* v_end = dests + *v_range.end();
+
+  const size_t u_size = u_end - u_beg;
+  const size_t v_size = v_end - v_beg;
+
+  if (u_size > v_size * kGallopRatio) {
+    return CountIntersectionGallop(v_beg, v_end, u_beg, u_end);
+  }
+  if (v_size > u_size * kGallopRatio) {
+    return CountIntersectionGallop(u_beg, u_end, v_beg, v_end);
+  }
+  return CountIntersectionMerge(u_beg, u_end, v_beg, v_end);
+}
+
+katana::HubSegmentedTopologyView
+katana::HubSegmentedTopologyView::Make(
+    const GraphTopology& topo, size_t max_segment_size) noexcept {
+  KATANA_LOG_DEBUG_ASSERT(max_segment_size > 0);
+
+  const uint64_t num_nodes = topo.NumNodes();
+
+  // Pass 1: number of segments per node, then prefix sum to place them.
+  NUMAArray<uint64_t> seg_counts;
+  seg_counts.allocateInterleaved(num_nodes);
+
+  katana::do_all(
+      katana::iterate(topo.Nodes()),
+      [&](Node n) {
+        const size_t degree = topo.OutDegree(n);
+        seg_counts[n] =
+            (degree == 0)
+                ? 1
+                : (degree + max_segment_size - 1) / max_segment_size;
+      },
+      katana::no_stats());
+
+  katana::ParallelSTL::partial_sum(
+      seg_counts.begin(), seg_counts.end(), seg_counts.begin());
+
+  HubSegmentedTopologyView ret;
+  ret.segments_.allocateInterleaved(
+      num_nodes == 0 ? 0 : seg_counts[num_nodes - 1]);
+  ret.split_nodes_.resize(num_nodes);
+
+  // Pass 2: carve each node's edge range into segments.
+  katana::do_all(
+      katana::iterate(topo.Nodes()),
+      [&](Node n) {
+        auto e_range = topo.OutEdges(n);
+        uint64_t slot = (n == 0) ? 0 : seg_counts[n - 1];
+        const uint64_t num_segs = seg_counts[n] - slot;
+        if (num_segs > 1) {
+          ret.split_nodes_.set(n);
+        }
+
+        Edge beg = *e_range.begin();
+        const Edge end = *e_range.end();
+        for (uint64_t s = 0; s < num_segs; ++s, ++slot) {
+          Edge seg_end = std::min(end, beg + max_segment_size);
+          ret.segments_[slot] = Segment{n, beg, seg_end};
+          beg = seg_end;
+        }
+      },
+      katana::no_stats());
+
+  return ret;
+}
+
+std::shared_ptr<katana::LazyEdgeTypeAwareView>
+katana::LazyEdgeTypeAwareView::Make(
+    std::shared_ptr<const CondensedTypeIDMap> edge_type_index,
+    const EdgeShuffleTopology* sorted_topo) noexcept {
+  KATANA_LOG_DEBUG_ASSERT(sorted_topo);
+  KATANA_LOG_ASSERT(sorted_topo->has_edges_sorted_by(
+      katana::RDGTopology::EdgeSortKind::kSortedByEdgeType));
+
+  return std::shared_ptr<LazyEdgeTypeAwareView>(
+      new LazyEdgeTypeAwareView(std::move(edge_type_index), sorted_topo));
+}
+
+const katana::LazyEdgeTypeAwareView::Slice&
+katana::LazyEdgeTypeAwareView::GetOrBuildSlice(
+    const PropertyGraph* pg, const EntityTypeID& edge_type) const noexcept {
+  KATANA_LOG_DEBUG_ASSERT(edge_type_index_->has_edge_type_id(edge_type));
+  Slice& slice = *slices_[edge_type_index_->GetIndex(edge_type)];
+  if (slice.ready.load(std::memory_order_acquire)) {
+    return slice;
+  }
+
+  std::lock_guard<std::mutex> guard(build_lock_);
+  if (slice.ready.load(std::memory_order_acquire)) {
+    return slice;
+  }
+
+  slice.ranges.allocateInterleaved(topo_->NumNodes());
+
+  auto type_of = [&](Edge e) {
+    return pg->GetTypeOfEdgeFromPropertyIndex(
+        topo_->GetEdgePropertyIndexFromOutEdge(e));
+  };
+
+  // Edges of a node are sorted by type, so the sub-range of edge_type can be
+  // recovered with two binary searches per node.
+  katana::do_all(
+      katana::iterate(topo_->Nodes()),
+      [&](Node n) {
+        auto e_range = topo_->OutEdges(n);
+        auto lower = std::lower_bound(
+            e_range.begin(), e_range.end(), edge_type,
+            [&](Edge e, const EntityTypeID& type) { return type_of(e) < type; });
+        auto upper = std::upper_bound(
+            lower, e_range.end(), edge_type,
+            [&](const EntityTypeID& type, Edge e) { return type < type_of(e); });
+        slice.ranges[n] = std::make_pair(*lower, *upper);
+      },
+      katana::steal(), katana::no_stats());
+
+  slice.ready.store(true, std::memory_order_release);
+  return slice;
+}
+
 katana::EdgeShuffleTopology::~EdgeShuffleTopology() = default;
 
 std::shared_ptr<katana::EdgeShuffleTopology>
@@ -134,11 +471,15 @@ katana::EdgeShuffleTopology::MakeTransposeCopy(
   PropIndexVec edge_prop_indices;
   PropIndexVec node_prop_indices;
 
-  out_indices.allocateInterleaved(topology.NumNodes());
-  out_dests.allocateInterleaved(topology.NumEdges());
-  edge_prop_indices.allocateInterleaved(topology.NumEdges());
+  // Blocked placement matches the blocked node ranges that do_all hands to
+  // each thread, so the pages of the transposed arrays land on the socket
+  // whose threads build and later iterate them instead of being interleaved
+  // across all sockets.
+  out_indices.allocateBlocked(topology.NumNodes());
+  out_dests.allocateBlocked(topology.NumEdges());
+  edge_prop_indices.allocateBlocked(topology.NumEdges());
 
-  out_dests_offset.allocateInterleaved(topology.NumNodes());
+  out_dests_offset.allocateBlocked(topology.NumNodes());
 
   katana::ParallelSTL::fill(out_indices.begin(), out_indices.end(), Edge{0});
 
@@ -437,41 +778,109 @@ katana::EdgeShuffleTopology::SortEdgesByDestType(
   KATANA_LOG_FATAL("Not implemented yet");
 }
 
+void
+katana::EdgeShuffleTopology::SortNodeEdges(
+    const PropertyGraph* pg, const Node& node) noexcept {
+  if (edge_sort_state_ == katana::RDGTopology::EdgeSortKind::kAny) {
+    return;
+  }
+
+  auto e_beg = *OutEdges(node).begin();
+  auto e_end = *OutEdges(node).end();
+
+  auto begin_sort_iter = katana::make_zip_iterator(
+      edge_prop_indices_.begin() + e_beg, GetDests().begin() + e_beg);
+
+  auto end_sort_iter = katana::make_zip_iterator(
+      edge_prop_indices_.begin() + e_end, GetDests().begin() + e_end);
+
+  if (edge_sort_state_ == katana::RDGTopology::EdgeSortKind::kSortedByDestID) {
+    std::sort(
+        begin_sort_iter, end_sort_iter,
+        [&](const auto& tup1, const auto& tup2) {
+          return std::get<1>(tup1) < std::get<1>(tup2);
+        });
+  } else if (
+      edge_sort_state_ ==
+      katana::RDGTopology::EdgeSortKind::kSortedByEdgeType) {
+    std::sort(
+        begin_sort_iter, end_sort_iter,
+        [&](const auto& tup1, const auto& tup2) {
+          katana::EntityTypeID data1 =
+              pg->GetTypeOfEdgeFromPropertyIndex(std::get<0>(tup1));
+          katana::EntityTypeID data2 =
+              pg->GetTypeOfEdgeFromPropertyIndex(std::get<0>(tup2));
+          if (data1 != data2) {
+            return data1 < data2;
+          }
+          return std::get<1>(tup1) < std::get<1>(tup2);
+        });
+  } else {
+    KATANA_LOG_FATAL("switch-case fell through");
+  }
+}
+
+void
+katana::EdgeShuffleTopology::ResortEdges(
+    const PropertyGraph* pg, const std::vector<Node>& nodes) noexcept {
+  katana::do_all(
+      katana::iterate(nodes),
+      [&](const Node& node) { SortNodeEdges(pg, node); }, katana::steal(),
+      katana::no_stats());
+}
+
+bool
+katana::EdgeShuffleTopology::UpdateEdgeDst(
+    const PropertyGraph* pg, const Node& src, const Edge& eid,
+    const Node& new_dst) noexcept {
+  auto edge_range = OutEdges(src);
+  if (eid < *edge_range.begin() || eid >= *edge_range.end()) {
+    return false;
+  }
+
+  GetDests()[eid] = new_dst;
+  SortNodeEdges(pg, src);
+  return true;
+}
+
 std::shared_ptr<katana::ShuffleTopology>
 katana::ShuffleTopology::MakeSortedByDegree(
     const PropertyGraph*,
     const katana::EdgeShuffleTopology& seed_topo) noexcept {
-  auto cmp = [&](const auto& i1, const auto& i2) {
-    auto d1 = seed_topo.OutDegree(i1);
-    auto d2 = seed_topo.OutDegree(i2);
-    // TODO(amber): Triangle-Counting needs degrees sorted in descending order. I
-    // need to think of a way to specify in the interface whether degrees should be
-    // sorted in ascending or descending order.
-    // return d1 < d2;
-    return d1 > d2;
+  // TODO(amber): Triangle-Counting needs degrees sorted in descending order. I
+  // need to think of a way to specify in the interface whether degrees should be
+  // sorted in ascending or descending order.
+  // The radix sort wants ascending unsigned keys, so rank each node by
+  // how far its degree falls short of the maximum: higher degrees sort
+  // first.
+  katana::GReduceMax<GraphTopology::Edge> max_degree;
+  katana::do_all(
+      katana::iterate(seed_topo.Nodes()),
+      [&](auto n) { max_degree.update(seed_topo.OutDegree(n)); },
+      katana::no_stats());
+  const GraphTopology::Edge top_degree = max_degree.reduce();
+
+  auto key_fn = [&seed_topo, top_degree](const auto& i) {
+    return top_degree - seed_topo.OutDegree(i);
   };
 
   return MakeNodeSortedTopo(
-      seed_topo, cmp, katana::RDGTopology::NodeSortKind::kSortedByDegree);
+      seed_topo, key_fn, katana::RDGTopology::NodeSortKind::kSortedByDegree);
 }
 
 std::shared_ptr<katana::ShuffleTopology>
 katana::ShuffleTopology::MakeSortedByNodeType(
     const PropertyGraph* pg,
     const katana::EdgeShuffleTopology& seed_topo) noexcept {
-  auto cmp = [&](const auto& i1, const auto& i2) {
-    auto idx1 = seed_topo.GetNodePropertyIndex(i1);
-    auto idx2 = seed_topo.GetNodePropertyIndex(i2);
-    auto k1 = pg->GetTypeOfNodeFromPropertyIndex(idx1);
-    auto k2 = pg->GetTypeOfNodeFromPropertyIndex(idx2);
-    if (k1 == k2) {
-      return i1 < i2;
-    }
-    return k1 < k2;
+  // Stability of the radix sort keeps nodes of equal type in ascending
+  // node id order.
+  auto key_fn = [pg, &seed_topo](const auto& i) {
+    auto idx = seed_topo.GetNodePropertyIndex(i);
+    return pg->GetTypeOfNodeFromPropertyIndex(idx);
   };
 
   return MakeNodeSortedTopo(
-      seed_topo, cmp, katana::RDGTopology::NodeSortKind::kSortedByNodeType);
+      seed_topo, key_fn, katana::RDGTopology::NodeSortKind::kSortedByNodeType);
 }
 
 std::shared_ptr<katana::ShuffleTopology>
@@ -727,6 +1136,41 @@ katana::PGViewCache::DropAllTopologies() noexcept {
   fully_shuff_topos_.clear();
   edge_type_aware_topos_.clear();
   edge_type_id_map_.reset();
+  node_type_bitmaps_.clear();
+  edge_type_bitmaps_.clear();
+  degree_bins_.reset();
+}
+
+size_t
+katana::PGViewCache::DropUnusedTopologies() noexcept {
+  // Lower bound on a topology's footprint: adjacency indices, destinations
+  // and the edge property index map; derived topologies add per-type ranges
+  // on top of this.
+  auto estimate_size = [](const katana::GraphTopology& topo) {
+    return topo.NumNodes() * sizeof(katana::GraphTopology::Edge) +
+           topo.NumEdges() * (sizeof(katana::GraphTopology::Node) +
+                              sizeof(katana::GraphTopology::PropertyIndex));
+  };
+
+  size_t freed = 0;
+  auto drop_unused = [&](auto& topos) {
+    auto is_unused = [&](const auto& topo_ptr) {
+      // The cache holds the only reference; no view (and not the default
+      // topology pointer) is using it.
+      if (topo_ptr.use_count() == 1) {
+        freed += estimate_size(*topo_ptr);
+        return true;
+      }
+      return false;
+    };
+    topos.erase(
+        std::remove_if(topos.begin(), topos.end(), is_unused), topos.end());
+  };
+
+  drop_unused(edge_shuff_topos_);
+  drop_unused(fully_shuff_topos_);
+  drop_unused(edge_type_aware_topos_);
+  return freed;
 }
 
 std::shared_ptr<katana::CondensedTypeIDMap>
@@ -741,12 +1185,128 @@ katana::PGViewCache::BuildOrGetEdgeTypeIndex(
   return edge_type_id_map_;
 };
 
+namespace {
+
+// Shared scan for the node and edge type bitmaps: per most-specific type,
+// precompute whether it carries the queried type so the per-entity check in
+// the parallel loop is a table lookup instead of a subset test.
+template <typename GetTypeFn>
+std::shared_ptr<const katana::DynamicBitset>
+BuildTypeBitmap(
+    const katana::EntityTypeManager& manager, size_t num_entities,
+    katana::EntityTypeID type, GetTypeFn&& get_type) noexcept {
+  std::vector<bool> matches(manager.GetNumEntityTypes());
+  for (size_t et = 0; et < matches.size(); ++et) {
+    matches[et] =
+        manager.IsSubtypeOf(type, static_cast<katana::EntityTypeID>(et));
+  }
+
+  auto bitmap = std::make_shared<katana::DynamicBitset>();
+  bitmap->resize(num_entities);
+  katana::do_all(
+      katana::iterate(size_t{0}, num_entities),
+      [&](size_t i) {
+        if (matches[get_type(i)]) {
+          bitmap->set(i);
+        }
+      },
+      katana::no_stats());
+  return bitmap;
+}
+
+}  // namespace
+
+std::shared_ptr<const katana::DynamicBitset>
+katana::PGViewCache::BuildOrGetNodeTypeBitmap(
+    const katana::PropertyGraph* pg, EntityTypeID type) noexcept {
+  auto it = node_type_bitmaps_.find(type);
+  if (it != node_type_bitmaps_.end() && it->second->size() == pg->NumNodes()) {
+    return it->second;
+  }
+
+  std::shared_ptr<const DynamicBitset> bitmap = BuildTypeBitmap(
+      pg->GetNodeTypeManager(), pg->NumNodes(), type, [&](size_t node) {
+        return pg->GetTypeOfNode(static_cast<GraphTopology::Node>(node));
+      });
+  node_type_bitmaps_[type] = bitmap;
+  return bitmap;
+}
+
+std::shared_ptr<const katana::DynamicBitset>
+katana::PGViewCache::BuildOrGetEdgeTypeBitmap(
+    const katana::PropertyGraph* pg, EntityTypeID type) noexcept {
+  auto it = edge_type_bitmaps_.find(type);
+  if (it != edge_type_bitmaps_.end() && it->second->size() == pg->NumEdges()) {
+    return it->second;
+  }
+
+  std::shared_ptr<const DynamicBitset> bitmap = BuildTypeBitmap(
+      pg->GetEdgeTypeManager(), pg->NumEdges(), type, [&](size_t edge) {
+        return pg->GetTypeOfEdgeFromTopoIndex(edge);
+      });
+  edge_type_bitmaps_[type] = bitmap;
+  return bitmap;
+}
+
+std::shared_ptr<const katana::DegreeBins>
+katana::PGViewCache::BuildOrGetDegreeBins(
+    const katana::PropertyGraph* pg) noexcept {
+  if (degree_bins_ && degree_bins_->NumNodes() == pg->NumNodes() &&
+      degree_bins_->NumEdges() == pg->NumEdges()) {
+    return degree_bins_;
+  }
+
+  degree_bins_ =
+      std::make_shared<const DegreeBins>(DegreeBins::Make(*original_topo_));
+  return degree_bins_;
+}
+
 template <typename Topo>
 [[maybe_unused]] bool
 CheckTopology(const katana::PropertyGraph* pg, const Topo* t) noexcept {
   return (pg->NumNodes() == t->NumNodes()) && (pg->NumEdges() == t->NumEdges());
 }
 
+namespace {
+
+// Process-wide registry of shuffled topologies, keyed by storage location,
+// version, partition and view kind. Separate PropertyGraph instances opened
+// over the same RDG version (our services open one per query session) share
+// the derived topologies instead of each rebuilding them. Entries hold weak
+// references, so a topology lives exactly as long as some view cache or
+// view references it, and lookups skip topologies invalidated by mutation.
+using SharedTopoKey =
+    std::tuple<std::string, uint64_t, uint32_t, int, int>;
+
+std::mutex shared_topo_mutex;
+std::map<SharedTopoKey, std::weak_ptr<katana::EdgeShuffleTopology>>
+    shared_edge_shuff_topos;
+
+std::shared_ptr<katana::EdgeShuffleTopology>
+LookupSharedEdgeShuffTopo(const SharedTopoKey& key) noexcept {
+  std::lock_guard<std::mutex> lock(shared_topo_mutex);
+  auto it = shared_edge_shuff_topos.find(key);
+  if (it == shared_edge_shuff_topos.end()) {
+    return nullptr;
+  }
+  std::shared_ptr<katana::EdgeShuffleTopology> topo = it->second.lock();
+  if (!topo || !topo->is_valid()) {
+    shared_edge_shuff_topos.erase(it);
+    return nullptr;
+  }
+  return topo;
+}
+
+void
+PublishSharedEdgeShuffTopo(
+    const SharedTopoKey& key,
+    const std::shared_ptr<katana::EdgeShuffleTopology>& topo) noexcept {
+  std::lock_guard<std::mutex> lock(shared_topo_mutex);
+  shared_edge_shuff_topos[key] = topo;
+}
+
+}  // namespace
+
 std::shared_ptr<katana::EdgeShuffleTopology>
 katana::PGViewCache::BuildOrGetEdgeShuffTopo(
     katana::PropertyGraph* pg,
@@ -797,6 +1357,22 @@ katana::PGViewCache::BuildOrGetEdgeShuffTopoImpl(
     }
   }
 
+  // Not in this graph's cache; another PropertyGraph over the same RDG
+  // version may already hold the topology. Popped topologies are excluded
+  // from sharing because callers mutate them.
+  const uint64_t version = pg->rdg_version();
+  const bool shareable = !pop && version != 0 && !pg->rdg_dir().empty();
+  SharedTopoKey key{
+      pg->rdg_dir().string(), version, pg->partition_id(),
+      static_cast<int>(tpose_kind), static_cast<int>(sort_kind)};
+  if (shareable) {
+    if (auto shared = LookupSharedEdgeShuffTopo(key);
+        shared && CheckTopology(pg, shared.get())) {
+      edge_shuff_topos_.emplace_back(shared);
+      return shared;
+    }
+  }
+
   // No matching topology in cache, see if we have it in storage
   katana::RDGTopology shadow = katana::RDGTopology::MakeShadow(
       katana::RDGTopology::TopologyKind::kEdgeShuffleTopology, tpose_kind,
@@ -809,10 +1385,12 @@ katana::PGViewCache::BuildOrGetEdgeShuffTopoImpl(
 
   if (pop) {
     return new_topo;
-  } else {
-    edge_shuff_topos_.emplace_back(std::move(new_topo));
-    return edge_shuff_topos_.back();
   }
+  if (shareable) {
+    PublishSharedEdgeShuffTopo(key, new_topo);
+  }
+  edge_shuff_topos_.emplace_back(std::move(new_topo));
+  return edge_shuff_topos_.back();
 }
 
 std::shared_ptr<katana::ShuffleTopology>
@@ -0,0 +1,260 @@
+#include "katana/GroupBy.h"
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <unordered_map>
+
+#include "katana/Loops.h"
+#include "katana/PerThreadStorage.h"
+#include "katana/PropertyViews.h"
+
+namespace {
+
+using katana::AggregateOp;
+using katana::AggregateSpec;
+
+/// Running reduction of one property within one group.
+struct AggState {
+  double sum{0.0};
+  double min{std::numeric_limits<double>::infinity()};
+  double max{-std::numeric_limits<double>::infinity()};
+  int64_t non_null{0};
+};
+
+struct GroupState {
+  int64_t rows{0};
+  std::vector<AggState> aggs;
+};
+
+using GroupMap = std::unordered_map<int64_t, GroupState>;
+
+/// Read an integer key column as int64, or nullopt for null rows.
+using KeyGetter = std::function<std::optional<int64_t>(int64_t)>;
+/// Read a numeric aggregate column as double, or nullopt for null rows.
+using ValueGetter = std::function<std::optional<double>(int64_t)>;
+
+template <typename ArrowType, typename Out>
+std::function<std::optional<Out>(int64_t)>
+TypedGetter(const arrow::Array* array) {
+  const auto* typed =
+      static_cast<const arrow::NumericArray<ArrowType>*>(array);
+  return [typed](int64_t i) -> std::optional<Out> {
+    if (typed->IsNull(i)) {
+      return std::nullopt;
+    }
+    return static_cast<Out>(typed->Value(i));
+  };
+}
+
+template <typename Out>
+katana::Result<std::function<std::optional<Out>(int64_t)>>
+MakeGetter(const arrow::Array* array, bool allow_floating) {
+  switch (array->type_id()) {
+  case arrow::Type::INT8:
+    return TypedGetter<arrow::Int8Type, Out>(array);
+  case arrow::Type::INT16:
+    return TypedGetter<arrow::Int16Type, Out>(array);
+  case arrow::Type::INT32:
+    return TypedGetter<arrow::Int32Type, Out>(array);
+  case arrow::Type::INT64:
+    return TypedGetter<arrow::Int64Type, Out>(array);
+  case arrow::Type::UINT8:
+    return TypedGetter<arrow::UInt8Type, Out>(array);
+  case arrow::Type::UINT16:
+    return TypedGetter<arrow::UInt16Type, Out>(array);
+  case arrow::Type::UINT32:
+    return TypedGetter<arrow::UInt32Type, Out>(array);
+  case arrow::Type::UINT64:
+    return TypedGetter<arrow::UInt64Type, Out>(array);
+  case arrow::Type::FLOAT:
+    if (allow_floating) {
+      return TypedGetter<arrow::FloatType, Out>(array);
+    }
+    break;
+  case arrow::Type::DOUBLE:
+    if (allow_floating) {
+      return TypedGetter<arrow::DoubleType, Out>(array);
+    }
+    break;
+  default:
+    break;
+  }
+  return KATANA_ERROR(
+      katana::ErrorCode::TypeError, "unsupported column type {}",
+      array->type()->ToString());
+}
+
+katana::Result<std::shared_ptr<arrow::Table>>
+GroupByImpl(
+    const katana::PropertyGraph::ReadOnlyPropertyView& pview,
+    const std::string& key_property,
+    const std::vector<AggregateSpec>& aggregates) {
+  arrow::Array* key_array = KATANA_CHECKED_CONTEXT(
+      katana::internal::ExtractArrays(pview, {key_property}),
+      "group-by key {}", std::quoted(key_property))[0];
+  KeyGetter key = KATANA_CHECKED_CONTEXT(
+      MakeGetter<int64_t>(key_array, /*allow_floating=*/false),
+      "group-by key {} must be an integer column", std::quoted(key_property));
+
+  std::vector<ValueGetter> values;
+  for (const AggregateSpec& spec : aggregates) {
+    if (spec.op == AggregateOp::kCount) {
+      values.emplace_back();  // counts need no input column
+      continue;
+    }
+    if (spec.property.empty()) {
+      return KATANA_ERROR(
+          katana::ErrorCode::InvalidArgument,
+          "aggregate {} needs a property to reduce",
+          std::quoted(spec.output_name));
+    }
+    arrow::Array* array = KATANA_CHECKED(
+        katana::internal::ExtractArrays(pview, {spec.property}))[0];
+    values.emplace_back(KATANA_CHECKED_CONTEXT(
+        MakeGetter<double>(array, /*allow_floating=*/true), "aggregate {}",
+        std::quoted(spec.property)));
+  }
+
+  // Per-thread hash tables, merged once below; no shared buckets to
+  // contend on while scanning.
+  int64_t num_rows = key_array->length();
+  katana::PerThreadStorage<GroupMap> maps;
+  katana::do_all(
+      katana::iterate(int64_t{0}, num_rows),
+      [&](int64_t row) {
+        std::optional<int64_t> k = key(row);
+        if (!k) {
+          return;
+        }
+        GroupState& group = (*maps.getLocal())[*k];
+        if (group.aggs.empty()) {
+          group.aggs.resize(aggregates.size());
+        }
+        group.rows += 1;
+        for (size_t a = 0; a < aggregates.size(); ++a) {
+          if (!values[a]) {
+            continue;
+          }
+          std::optional<double> v = values[a](row);
+          if (!v) {
+            continue;
+          }
+          AggState& agg = group.aggs[a];
+          agg.sum += *v;
+          agg.min = std::min(agg.min, *v);
+          agg.max = std::max(agg.max, *v);
+          agg.non_null += 1;
+        }
+      },
+      katana::steal(), katana::no_stats(), katana::loopname("GroupByScan"));
+
+  GroupMap merged;
+  for (unsigned tid = 0; tid < maps.size(); ++tid) {
+    for (auto& [k, group] : *maps.getRemote(tid)) {
+      GroupState& into = merged[k];
+      if (into.aggs.empty()) {
+        into.aggs.resize(aggregates.size());
+      }
+      into.rows += group.rows;
+      for (size_t a = 0; a < aggregates.size(); ++a) {
+        AggState& agg = into.aggs[a];
+        agg.sum += group.aggs[a].sum;
+        agg.min = std::min(agg.min, group.aggs[a].min);
+        agg.max = std::max(agg.max, group.aggs[a].max);
+        agg.non_null += group.aggs[a].non_null;
+      }
+    }
+  }
+
+  std::vector<int64_t> keys;
+  keys.reserve(merged.size());
+  for (const auto& [k, group] : merged) {
+    keys.push_back(k);
+  }
+  std::sort(keys.begin(), keys.end());
+
+  auto check = [](const arrow::Status& st) -> katana::Result<void> {
+    if (!st.ok()) {
+      return KATANA_ERROR(
+          katana::ErrorCode::ArrowError, "building group-by column: {}", st);
+    }
+    return katana::ResultSuccess();
+  };
+
+  std::vector<std::shared_ptr<arrow::Field>> fields;
+  std::vector<std::shared_ptr<arrow::Array>> columns;
+
+  arrow::Int64Builder key_builder;
+  for (int64_t k : keys) {
+    KATANA_CHECKED(check(key_builder.Append(k)));
+  }
+  std::shared_ptr<arrow::Array> key_column;
+  KATANA_CHECKED(check(key_builder.Finish(&key_column)));
+  fields.push_back(arrow::field(key_property, arrow::int64()));
+  columns.push_back(std::move(key_column));
+
+  for (size_t a = 0; a < aggregates.size(); ++a) {
+    const AggregateSpec& spec = aggregates[a];
+    std::shared_ptr<arrow::Array> column;
+    if (spec.op == AggregateOp::kCount) {
+      arrow::Int64Builder builder;
+      for (int64_t k : keys) {
+        KATANA_CHECKED(check(builder.Append(merged[k].rows)));
+      }
+      KATANA_CHECKED(check(builder.Finish(&column)));
+      fields.push_back(arrow::field(spec.output_name, arrow::int64()));
+    } else {
+      arrow::DoubleBuilder builder;
+      for (int64_t k : keys) {
+        const AggState& agg = merged[k].aggs[a];
+        if (agg.non_null == 0) {
+          KATANA_CHECKED(check(builder.AppendNull()));
+          continue;
+        }
+        double out = 0.0;
+        switch (spec.op) {
+        case AggregateOp::kSum:
+          out = agg.sum;
+          break;
+        case AggregateOp::kMin:
+          out = agg.min;
+          break;
+        case AggregateOp::kMax:
+          out = agg.max;
+          break;
+        case AggregateOp::kMean:
+          out = agg.sum / static_cast<double>(agg.non_null);
+          break;
+        case AggregateOp::kCount:
+          KATANA_LOG_FATAL("unreachable");
+        }
+        KATANA_CHECKED(check(builder.Append(out)));
+      }
+      KATANA_CHECKED(check(builder.Finish(&column)));
+      fields.push_back(arrow::field(spec.output_name, arrow::float64()));
+    }
+    columns.push_back(std::move(column));
+  }
+
+  return arrow::Table::Make(
+      arrow::schema(std::move(fields)), std::move(columns),
+      static_cast<int64_t>(keys.size()));
+}
+
+}  // namespace
+
+katana::Result<std::shared_ptr<arrow::Table>>
+katana::GroupByNodeProperty(
+    const PropertyGraph& pg, const std::string& key_property,
+    const std::vector<AggregateSpec>& aggregates) {
+  return GroupByImpl(pg.NodeReadOnlyPropertyView(), key_property, aggregates);
+}
+
+katana::Result<std::shared_ptr<arrow::Table>>
+katana::GroupByEdgeProperty(
+    const PropertyGraph& pg, const std::string& key_property,
+    const std::vector<AggregateSpec>& aggregates) {
+  return GroupByImpl(pg.EdgeReadOnlyPropertyView(), key_property, aggregates);
+}
@@ -0,0 +1,538 @@
+#include "katana/LabelConstrainedReachability.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <limits>
+
+#include <arrow/api.h>
+
+#include "katana/Bag.h"
+#include "katana/Loops.h"
+#include "katana/ParallelSTL.h"
+
+namespace {
+
+using katana::LabelConstrainedReachabilityIndex;
+using Node = katana::GraphTopologyTypes::Node;
+using Edge = katana::GraphTopologyTypes::Edge;
+using EdgeTypeMask = LabelConstrainedReachabilityIndex::EdgeTypeMask;
+
+/// One unit of traversal work: a node together with the union of edge
+/// type bits on the path that reached it.
+struct State {
+  Node node;
+  EdgeTypeMask mask;
+};
+
+void
+AppendU32(std::string* blob, uint32_t val) {
+  blob->append(reinterpret_cast<const char*>(&val), sizeof(val));
+}
+
+void
+AppendU64(std::string* blob, uint64_t val) {
+  blob->append(reinterpret_cast<const char*>(&val), sizeof(val));
+}
+
+}  // namespace
+
+template <typename Fn>
+void
+katana::LabelConstrainedReachabilityIndex::ForEachNeighbor(
+    bool forward, Node n, Fn&& fn) const {
+  const NUMAArray<Edge>& adj = forward ? out_adj_indices_ : in_adj_indices_;
+  const NUMAArray<HalfEdge>& edges = forward ? out_edges_ : in_edges_;
+  if (n < adj.size()) {
+    Edge first = (n == 0) ? Edge{0} : adj[n - 1];
+    for (Edge e = first; e < adj[n]; ++e) {
+      fn(edges[e]);
+    }
+  }
+  const auto& extra = forward ? extra_out_edges_[n] : extra_in_edges_[n];
+  for (const HalfEdge& he : extra) {
+    fn(he);
+  }
+}
+
+katana::Result<void>
+katana::LabelConstrainedReachabilityIndex::BuildAdjacency(
+    const PropertyGraph& pg) {
+  const GraphTopology& topo = pg.topology();
+  const uint64_t num_nodes = topo.NumNodes();
+  const uint64_t num_edges = topo.NumEdges();
+
+  // Distinct edge types get mask bits in sorted order, so the mapping is
+  // reproducible from the graph alone (FromProperties relies on this).
+  std::vector<uint8_t> seen(
+      size_t{std::numeric_limits<EntityTypeID>::max()} + 1, 0);
+  for (Edge e = 0; e < num_edges; ++e) {
+    seen[pg.GetTypeOfEdgeFromTopoIndex(e)] = 1;
+  }
+  size_t num_types = 0;
+  for (size_t t = 0; t < seen.size(); ++t) {
+    if (!seen[t]) {
+      continue;
+    }
+    if (num_types == kMaxIndexedEdgeTypes) {
+      return KATANA_ERROR(
+          ErrorCode::InvalidArgument,
+          "graph has more than {} distinct edge types; "
+          "label-constrained index masks hold one bit per type",
+          kMaxIndexedEdgeTypes);
+    }
+    type_bits_.emplace(
+        static_cast<EntityTypeID>(t), static_cast<uint8_t>(num_types));
+    num_types++;
+  }
+
+  // Private out-CSR annotated with type bits.
+  out_adj_indices_.allocateInterleaved(num_nodes);
+  out_edges_.allocateInterleaved(num_edges);
+  katana::do_all(
+      katana::iterate(topo.Nodes()),
+      [&](Node n) {
+        out_adj_indices_[n] = topo.AdjData()[n];
+        for (Edge e : topo.OutEdges(n)) {
+          out_edges_[e] = HalfEdge{
+              topo.OutEdgeDst(e),
+              type_bits_.at(pg.GetTypeOfEdgeFromTopoIndex(e))};
+        }
+      },
+      katana::steal(), katana::no_stats());
+
+  // Transpose for the backward traversals.
+  NUMAArray<std::atomic<Edge>> cursor;
+  cursor.allocateInterleaved(num_nodes);
+  cursor.construct(Edge{0});
+  katana::do_all(
+      katana::iterate(uint64_t{0}, num_edges),
+      [&](uint64_t e) {
+        cursor[topo.OutEdgeDst(e)].fetch_add(1, std::memory_order_relaxed);
+      },
+      katana::no_stats());
+
+  in_adj_indices_.allocateInterleaved(num_nodes);
+  Edge running = 0;
+  for (uint64_t n = 0; n < num_nodes; ++n) {
+    Edge degree = cursor[n].load(std::memory_order_relaxed);
+    // Rewind each cursor to its node's first slot for the scatter pass.
+    cursor[n].store(running, std::memory_order_relaxed);
+    running += degree;
+    in_adj_indices_[n] = running;
+  }
+
+  in_edges_.allocateInterleaved(num_edges);
+  katana::do_all(
+      katana::iterate(topo.Nodes()),
+      [&](Node n) {
+        for (Edge e : topo.OutEdges(n)) {
+          Node dst = topo.OutEdgeDst(e);
+          Edge pos = cursor[dst].fetch_add(1, std::memory_order_relaxed);
+          in_edges_[pos] = HalfEdge{n, out_edges_[e].type_bit};
+        }
+      },
+      katana::steal(), katana::no_stats());
+
+  extra_out_edges_.resize(num_nodes);
+  extra_in_edges_.resize(num_nodes);
+  out_labels_.resize(num_nodes);
+  in_labels_.resize(num_nodes);
+
+  // Degree-descending landmark order; high-degree hubs cover the most
+  // pairs and so produce the smallest labels.
+  rank_to_node_.resize(num_nodes);
+  node_to_rank_.resize(num_nodes);
+  katana::do_all(
+      katana::iterate(topo.Nodes()), [&](Node n) { rank_to_node_[n] = n; },
+      katana::no_stats());
+  katana::ParallelSTL::sort(
+      rank_to_node_.begin(), rank_to_node_.end(), [&](Node a, Node b) {
+        size_t deg_a = topo.OutDegree(a) +
+                       (in_adj_indices_[a] - (a == 0 ? 0 : in_adj_indices_[a - 1]));
+        size_t deg_b = topo.OutDegree(b) +
+                       (in_adj_indices_[b] - (b == 0 ? 0 : in_adj_indices_[b - 1]));
+        if (deg_a != deg_b) {
+          return deg_a > deg_b;
+        }
+        return a < b;
+      });
+  katana::do_all(
+      katana::iterate(uint64_t{0}, num_nodes),
+      [&](uint64_t r) { node_to_rank_[rank_to_node_[r]] = r; },
+      katana::no_stats());
+
+  return katana::ResultSuccess();
+}
+
+bool
+katana::LabelConstrainedReachabilityIndex::Reachable(
+    Node src, Node dst, EdgeTypeMask allowed_types) const {
+  if (src >= out_labels_.size() || dst >= in_labels_.size()) {
+    return false;
+  }
+  if (src == dst) {
+    return true;
+  }
+  const LabelList& a = out_labels_[src];
+  const LabelList& b = in_labels_[dst];
+  size_t i = 0;
+  size_t j = 0;
+  while (i < a.size() && j < b.size()) {
+    if (a[i].hub_rank < b[j].hub_rank) {
+      ++i;
+    } else if (a[i].hub_rank > b[j].hub_rank) {
+      ++j;
+    } else {
+      // A hub may carry several incomparable masks on either side;
+      // any compatible pairing certifies reachability.
+      uint32_t hub = a[i].hub_rank;
+      for (size_t i2 = i; i2 < a.size() && a[i2].hub_rank == hub; ++i2) {
+        for (size_t j2 = j; j2 < b.size() && b[j2].hub_rank == hub; ++j2) {
+          if (((a[i2].mask | b[j2].mask) & ~allowed_types) == 0) {
+            return true;
+          }
+        }
+      }
+      while (i < a.size() && a[i].hub_rank == hub) {
+        ++i;
+      }
+      while (j < b.size() && b[j].hub_rank == hub) {
+        ++j;
+      }
+    }
+  }
+  return false;
+}
+
+katana::Result<bool>
+katana::LabelConstrainedReachabilityIndex::Reachable(
+    Node src, Node dst, const std::vector<EntityTypeID>& edge_types) const {
+  return Reachable(src, dst, KATANA_CHECKED(MaskOf(edge_types)));
+}
+
+katana::Result<EdgeTypeMask>
+katana::LabelConstrainedReachabilityIndex::MaskOf(
+    const EntityTypeID& edge_type) const {
+  auto it = type_bits_.find(edge_type);
+  if (it == type_bits_.end()) {
+    return KATANA_ERROR(
+        ErrorCode::NotFound, "edge type {} is not indexed", edge_type);
+  }
+  return EdgeTypeMask{1} << it->second;
+}
+
+katana::Result<EdgeTypeMask>
+katana::LabelConstrainedReachabilityIndex::MaskOf(
+    const std::vector<EntityTypeID>& edge_types) const {
+  EdgeTypeMask mask = 0;
+  for (const EntityTypeID& edge_type : edge_types) {
+    mask |= KATANA_CHECKED(MaskOf(edge_type));
+  }
+  return mask;
+}
+
+void
+katana::LabelConstrainedReachabilityIndex::PrunedTraversal(
+    bool forward, uint32_t hub_rank, Node start, EdgeTypeMask start_mask) {
+  const Node hub = rank_to_node_[hub_rank];
+
+  // Minimal masks reached per node within this traversal; a state whose
+  // mask dominates one already seen cannot contribute a new label.
+  std::unordered_map<Node, std::vector<EdgeTypeMask>> visited;
+  auto try_visit = [&](Node v, EdgeTypeMask m) {
+    std::vector<EdgeTypeMask>& masks = visited[v];
+    for (EdgeTypeMask old : masks) {
+      if ((old & ~m) == 0) {
+        return false;
+      }
+    }
+    masks.erase(
+        std::remove_if(
+            masks.begin(), masks.end(),
+            [m](EdgeTypeMask old) { return (m & ~old) == 0; }),
+        masks.end());
+    masks.push_back(m);
+    return true;
+  };
+
+  std::vector<State> current;
+  if (start != hub && try_visit(start, start_mask)) {
+    current.push_back(State{start, start_mask});
+  }
+
+  while (!current.empty()) {
+    // Label pass is serial: pruning queries read the lists being grown.
+    std::vector<State> expand;
+    for (const State& s : current) {
+      bool covered = forward ? Reachable(hub, s.node, s.mask)
+                             : Reachable(s.node, hub, s.mask);
+      if (covered) {
+        continue;
+      }
+      LabelList& labels = forward ? in_labels_[s.node] : out_labels_[s.node];
+      auto pos = std::upper_bound(
+          labels.begin(), labels.end(), hub_rank,
+          [](uint32_t rank, const LabelEntry& entry) {
+            return rank < entry.hub_rank;
+          });
+      labels.insert(pos, LabelEntry{hub_rank, s.mask});
+      expand.push_back(s);
+    }
+
+    // Neighbor expansion is the bulk of the work and is parallel.
+    InsertBag<State> next;
+    katana::do_all(
+        katana::iterate(expand),
+        [&](const State& s) {
+          ForEachNeighbor(forward, s.node, [&](const HalfEdge& he) {
+            next.push(State{he.dst, s.mask | (EdgeTypeMask{1} << he.type_bit)});
+          });
+        },
+        katana::steal(), katana::no_stats());
+
+    current.clear();
+    for (const State& s : next) {
+      if (s.node != hub && try_visit(s.node, s.mask)) {
+        current.push_back(s);
+      }
+    }
+  }
+}
+
+void
+katana::LabelConstrainedReachabilityIndex::BuildLabels() {
+  for (uint32_t r = 0; r < rank_to_node_.size(); ++r) {
+    Node hub = rank_to_node_[r];
+    out_labels_[hub].push_back(LabelEntry{r, 0});
+    in_labels_[hub].push_back(LabelEntry{r, 0});
+    ForEachNeighbor(true, hub, [&](const HalfEdge& he) {
+      PrunedTraversal(true, r, he.dst, EdgeTypeMask{1} << he.type_bit);
+    });
+    ForEachNeighbor(false, hub, [&](const HalfEdge& he) {
+      PrunedTraversal(false, r, he.dst, EdgeTypeMask{1} << he.type_bit);
+    });
+  }
+}
+
+katana::Result<
+    std::unique_ptr<katana::LabelConstrainedReachabilityIndex>>
+katana::LabelConstrainedReachabilityIndex::Make(const PropertyGraph& pg) {
+  std::unique_ptr<LabelConstrainedReachabilityIndex> index(
+      new LabelConstrainedReachabilityIndex());
+  KATANA_CHECKED(index->BuildAdjacency(pg));
+  index->BuildLabels();
+  return index;
+}
+
+katana::Result<void>
+katana::LabelConstrainedReachabilityIndex::AddEdge(
+    Node src, Node dst, const EntityTypeID& edge_type) {
+  // Streaming ingest may introduce nodes; they join with the lowest
+  // landmark priority and only a self label.
+  Node max_node = std::max(src, dst);
+  while (max_node >= out_labels_.size()) {
+    Node fresh = static_cast<Node>(out_labels_.size());
+    uint32_t rank = static_cast<uint32_t>(rank_to_node_.size());
+    rank_to_node_.push_back(fresh);
+    node_to_rank_.push_back(rank);
+    out_labels_.push_back(LabelList{LabelEntry{rank, 0}});
+    in_labels_.push_back(LabelList{LabelEntry{rank, 0}});
+    extra_out_edges_.emplace_back();
+    extra_in_edges_.emplace_back();
+  }
+
+  auto it = type_bits_.find(edge_type);
+  if (it == type_bits_.end()) {
+    if (type_bits_.size() == kMaxIndexedEdgeTypes) {
+      return KATANA_ERROR(
+          ErrorCode::InvalidArgument,
+          "cannot index edge type {}: all {} mask bits are in use",
+          edge_type, kMaxIndexedEdgeTypes);
+    }
+    it = type_bits_
+             .emplace(edge_type, static_cast<uint8_t>(type_bits_.size()))
+             .first;
+  }
+  uint8_t bit = it->second;
+  EdgeTypeMask bit_mask = EdgeTypeMask{1} << bit;
+
+  extra_out_edges_[src].push_back(HalfEdge{dst, bit});
+  extra_in_edges_[dst].push_back(HalfEdge{src, bit});
+
+  // Everything that reached src now reaches onward from dst, and
+  // everything dst reached is now reached from src. Snapshot the lists:
+  // the traversals below grow them.
+  LabelList into_src = in_labels_[src];
+  LabelList from_dst = out_labels_[dst];
+  for (const LabelEntry& entry : into_src) {
+    PrunedTraversal(true, entry.hub_rank, dst, entry.mask | bit_mask);
+  }
+  for (const LabelEntry& entry : from_dst) {
+    PrunedTraversal(false, entry.hub_rank, src, entry.mask | bit_mask);
+  }
+
+  return katana::ResultSuccess();
+}
+
+size_t
+katana::LabelConstrainedReachabilityIndex::num_label_entries() const {
+  size_t total = 0;
+  for (const LabelList& labels : out_labels_) {
+    total += labels.size();
+  }
+  for (const LabelList& labels : in_labels_) {
+    total += labels.size();
+  }
+  return total;
+}
+
+katana::Result<void>
+katana::LabelConstrainedReachabilityIndex::WriteProperties(
+    PropertyGraph* pg, TxnContext* txn_ctx) const {
+  const uint64_t num_nodes = pg->topology().NumNodes();
+  if (out_labels_.size() != num_nodes) {
+    return KATANA_ERROR(
+        ErrorCode::InvalidArgument,
+        "index covers {} nodes but graph has {}", out_labels_.size(),
+        num_nodes);
+  }
+
+  // Bits assigned incrementally by AddEdge may be out of sorted order;
+  // canonicalize so FromProperties can rebuild the mapping from the
+  // graph's distinct edge types alone.
+  std::vector<EntityTypeID> sorted_types;
+  sorted_types.reserve(type_bits_.size());
+  for (const auto& entry : type_bits_) {
+    sorted_types.push_back(entry.first);
+  }
+  std::sort(sorted_types.begin(), sorted_types.end());
+  std::array<uint8_t, kMaxIndexedEdgeTypes> bit_to_canonical{};
+  for (size_t i = 0; i < sorted_types.size(); ++i) {
+    bit_to_canonical[type_bits_.at(sorted_types[i])] =
+        static_cast<uint8_t>(i);
+  }
+  auto canonical_mask = [&](EdgeTypeMask mask) {
+    EdgeTypeMask out = 0;
+    for (size_t b = 0; b < kMaxIndexedEdgeTypes; ++b) {
+      if (mask & (EdgeTypeMask{1} << b)) {
+        out |= EdgeTypeMask{1} << bit_to_canonical[b];
+      }
+    }
+    return out;
+  };
+
+  auto serialize = [&](const std::vector<LabelList>& labels,
+                       std::shared_ptr<arrow::Array>* out) -> Result<void> {
+    arrow::LargeBinaryBuilder builder;
+    std::string blob;
+    for (uint64_t n = 0; n < num_nodes; ++n) {
+      blob.clear();
+      AppendU32(&blob, static_cast<uint32_t>(labels[n].size()));
+      for (const LabelEntry& entry : labels[n]) {
+        // Hubs are stored as node ids: ranks are recomputed on load.
+        AppendU32(&blob, rank_to_node_[entry.hub_rank]);
+        AppendU64(&blob, canonical_mask(entry.mask));
+      }
+      arrow::Status st = builder.Append(blob);
+      if (!st.ok()) {
+        return KATANA_ERROR(
+            ErrorCode::ArrowError, "appending label blob: {}", st);
+      }
+    }
+    arrow::Status st = builder.Finish(out);
+    if (!st.ok()) {
+      return KATANA_ERROR(
+          ErrorCode::ArrowError, "finishing label column: {}", st);
+    }
+    return katana::ResultSuccess();
+  };
+
+  std::shared_ptr<arrow::Array> out_array;
+  std::shared_ptr<arrow::Array> in_array;
+  KATANA_CHECKED(serialize(out_labels_, &out_array));
+  KATANA_CHECKED(serialize(in_labels_, &in_array));
+
+  auto table = arrow::Table::Make(
+      arrow::schema(
+          {arrow::field(kOutLabelPropertyName, arrow::large_binary()),
+           arrow::field(kInLabelPropertyName, arrow::large_binary())}),
+      {out_array, in_array});
+  return pg->UpsertNodeProperties(table, txn_ctx);
+}
+
+katana::Result<
+    std::unique_ptr<katana::LabelConstrainedReachabilityIndex>>
+katana::LabelConstrainedReachabilityIndex::FromProperties(
+    const PropertyGraph& pg) {
+  std::unique_ptr<LabelConstrainedReachabilityIndex> index(
+      new LabelConstrainedReachabilityIndex());
+  KATANA_CHECKED(index->BuildAdjacency(pg));
+
+  auto deserialize = [&](const std::string& name,
+                         std::vector<LabelList>* labels) -> Result<void> {
+    std::shared_ptr<arrow::ChunkedArray> column =
+        KATANA_CHECKED(pg.GetNodeProperty(name));
+    uint64_t n = 0;
+    for (const auto& chunk : column->chunks()) {
+      auto binary =
+          std::dynamic_pointer_cast<arrow::LargeBinaryArray>(chunk);
+      if (!binary) {
+        return KATANA_ERROR(
+            ErrorCode::InvalidArgument,
+            "property {} is not a large binary column", name);
+      }
+      for (int64_t row = 0; row < binary->length(); ++row, ++n) {
+        arrow::util::string_view blob = binary->GetView(row);
+        if (blob.size() < sizeof(uint32_t)) {
+          return KATANA_ERROR(
+              ErrorCode::InvalidArgument, "truncated label blob at node {}",
+              n);
+        }
+        uint32_t count;
+        std::memcpy(&count, blob.data(), sizeof(count));
+        size_t expected =
+            sizeof(uint32_t) +
+            size_t{count} * (sizeof(uint32_t) + sizeof(uint64_t));
+        if (blob.size() != expected) {
+          return KATANA_ERROR(
+              ErrorCode::InvalidArgument, "truncated label blob at node {}",
+              n);
+        }
+        LabelList& list = (*labels)[n];
+        list.resize(count);
+        const char* cursor = blob.data() + sizeof(uint32_t);
+        for (uint32_t i = 0; i < count; ++i) {
+          uint32_t hub_node;
+          uint64_t mask;
+          std::memcpy(&hub_node, cursor, sizeof(hub_node));
+          cursor += sizeof(hub_node);
+          std::memcpy(&mask, cursor, sizeof(mask));
+          cursor += sizeof(mask);
+          if (hub_node >= index->node_to_rank_.size()) {
+            return KATANA_ERROR(
+                ErrorCode::InvalidArgument,
+                "label hub {} out of range at node {}", hub_node, n);
+          }
+          list[i] = LabelEntry{index->node_to_rank_[hub_node], mask};
+        }
+        std::sort(
+            list.begin(), list.end(),
+            [](const LabelEntry& a, const LabelEntry& b) {
+              return a.hub_rank < b.hub_rank;
+            });
+      }
+    }
+    if (n != index->out_labels_.size()) {
+      return KATANA_ERROR(
+          ErrorCode::InvalidArgument,
+          "property {} has {} rows but graph has {} nodes", name, n,
+          index->out_labels_.size());
+    }
+    return katana::ResultSuccess();
+  };
+
+  KATANA_CHECKED(deserialize(kOutLabelPropertyName, &index->out_labels_));
+  KATANA_CHECKED(deserialize(kInLabelPropertyName, &index->in_labels_));
+  return index;
+}
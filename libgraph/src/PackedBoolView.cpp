@@ -0,0 +1,236 @@
+#include "katana/PackedBoolView.h"
+
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <iomanip>
+
+#include <arrow/api.h>
+
+#include "katana/Loops.h"
+#include "katana/PropertyViews.h"
+
+namespace {
+
+constexpr size_t kWordBits = katana::DynamicBitset::kNumBitsInUint64;
+
+/// Evaluate one operator tree over a 512-bit block at a time. The words of
+/// a block fit in registers, so a whole rule is combined per block without
+/// writing intermediates back to memory.
+constexpr size_t kWordsPerBlock = 8;
+
+using Block = std::array<uint64_t, kWordsPerBlock>;
+
+/// BoolExpr with its flag terms resolved to packed word storage, so block
+/// evaluation does no name lookups.
+struct CompiledTerm {
+  katana::BoolExpr::Op op;
+  const katana::DynamicBitset* flag{nullptr};
+  std::unique_ptr<CompiledTerm> lhs;
+  std::unique_ptr<CompiledTerm> rhs;
+};
+
+/// Pack values[word_begin * 64 ...] into words, via a per-index getter so
+/// boolean and uint8 columns share the loop.
+template <typename GetBit>
+void
+PackWords(katana::DynamicBitset* bits, size_t num_values, GetBit&& get_bit) {
+  auto& words = bits->get_vec();
+  katana::do_all(
+      katana::iterate(size_t{0}, words.size()),
+      [&](size_t w) {
+        uint64_t word = 0;
+        size_t begin = w * kWordBits;
+        size_t end = std::min(begin + kWordBits, num_values);
+        for (size_t i = begin; i < end; ++i) {
+          if (get_bit(i)) {
+            word |= uint64_t{1} << (i - begin);
+          }
+        }
+        words[w] = word;
+      },
+      katana::no_stats(), katana::loopname("PackBoolProperty"));
+}
+
+void
+EvalBlock(const CompiledTerm& term, size_t word_begin, size_t num_words,
+    uint64_t* out) {
+  switch (term.op) {
+  case katana::BoolExpr::Op::kFlag: {
+    const auto& words = term.flag->get_vec();
+    for (size_t w = 0; w < num_words; ++w) {
+      out[w] = words[word_begin + w];
+    }
+    return;
+  }
+  case katana::BoolExpr::Op::kNot: {
+    EvalBlock(*term.lhs, word_begin, num_words, out);
+    for (size_t w = 0; w < num_words; ++w) {
+      out[w] = ~out[w];
+    }
+    return;
+  }
+  case katana::BoolExpr::Op::kAnd:
+  case katana::BoolExpr::Op::kOr: {
+    Block rhs;
+    EvalBlock(*term.lhs, word_begin, num_words, out);
+    EvalBlock(*term.rhs, word_begin, num_words, rhs.data());
+    if (term.op == katana::BoolExpr::Op::kAnd) {
+      for (size_t w = 0; w < num_words; ++w) {
+        out[w] &= rhs[w];
+      }
+    } else {
+      for (size_t w = 0; w < num_words; ++w) {
+        out[w] |= rhs[w];
+      }
+    }
+    return;
+  }
+  }
+  KATANA_LOG_FATAL("unhandled boolean operator");
+}
+
+}  // namespace
+
+katana::BoolExpr
+katana::BoolExpr::Flag(std::string name) {
+  return BoolExpr{std::make_shared<Term>(
+      Term{Op::kFlag, std::move(name), nullptr, nullptr})};
+}
+
+katana::BoolExpr
+katana::BoolExpr::Not(BoolExpr operand) {
+  return BoolExpr{std::make_shared<Term>(
+      Term{Op::kNot, {}, std::move(operand.root_), nullptr})};
+}
+
+katana::BoolExpr
+katana::BoolExpr::And(BoolExpr lhs, BoolExpr rhs) {
+  return BoolExpr{std::make_shared<Term>(
+      Term{Op::kAnd, {}, std::move(lhs.root_), std::move(rhs.root_)})};
+}
+
+katana::BoolExpr
+katana::BoolExpr::Or(BoolExpr lhs, BoolExpr rhs) {
+  return BoolExpr{std::make_shared<Term>(
+      Term{Op::kOr, {}, std::move(lhs.root_), std::move(rhs.root_)})};
+}
+
+katana::Result<katana::PackedBoolView>
+katana::PackedBoolView::MakeFromNodeProperties(
+    const PropertyGraph& pg, const std::vector<std::string>& flag_properties) {
+  std::vector<arrow::Array*> arrays = KATANA_CHECKED(
+      internal::ExtractArrays(pg.NodeReadOnlyPropertyView(), flag_properties));
+
+  PackedBoolView view;
+  view.size_ = pg.num_nodes();
+  view.flags_.resize(arrays.size());
+
+  for (size_t f = 0; f < arrays.size(); ++f) {
+    arrow::Array* array = arrays[f];
+    if (static_cast<size_t>(array->length()) != view.size_) {
+      return KATANA_ERROR(
+          ErrorCode::InvalidArgument, "property {} has {} values for {} nodes",
+          std::quoted(flag_properties[f]), array->length(), view.size_);
+    }
+
+    DynamicBitset& bits = view.flags_[f];
+    bits.resize(view.size_);
+    switch (array->type_id()) {
+    case arrow::Type::BOOL: {
+      const auto* typed = static_cast<const arrow::BooleanArray*>(array);
+      PackWords(&bits, view.size_, [&](size_t i) {
+        return typed->IsValid(i) && typed->Value(i);
+      });
+      break;
+    }
+    case arrow::Type::UINT8: {
+      const auto* typed = static_cast<const arrow::UInt8Array*>(array);
+      PackWords(&bits, view.size_, [&](size_t i) {
+        return typed->IsValid(i) && typed->Value(i) != 0;
+      });
+      break;
+    }
+    default:
+      return KATANA_ERROR(
+          ErrorCode::TypeError, "property {} has type {}; expected bool/uint8",
+          std::quoted(flag_properties[f]), array->type()->ToString());
+    }
+
+    view.flag_index_.emplace(flag_properties[f], f);
+  }
+
+  return view;
+}
+
+katana::Result<katana::DynamicBitset>
+katana::PackedBoolView::Evaluate(const BoolExpr& expr) const {
+  // Resolve flag names up front; evaluation proper cannot fail.
+  std::function<Result<std::unique_ptr<CompiledTerm>>(const BoolExpr::Term&)>
+      compile = [&](const BoolExpr::Term& term)
+      -> Result<std::unique_ptr<CompiledTerm>> {
+    auto compiled = std::make_unique<CompiledTerm>();
+    compiled->op = term.op;
+    if (term.op == BoolExpr::Op::kFlag) {
+      auto it = flag_index_.find(term.flag);
+      if (it == flag_index_.end()) {
+        return KATANA_ERROR(
+            ErrorCode::PropertyNotFound, "no packed flag named {}",
+            std::quoted(term.flag));
+      }
+      compiled->flag = &flags_[it->second];
+      return compiled;
+    }
+    compiled->lhs = KATANA_CHECKED(compile(*term.lhs));
+    if (term.rhs) {
+      compiled->rhs = KATANA_CHECKED(compile(*term.rhs));
+    }
+    return compiled;
+  };
+  std::unique_ptr<CompiledTerm> compiled = KATANA_CHECKED(compile(*expr.root_));
+
+  DynamicBitset result;
+  result.resize(size_);
+  auto& out_words = result.get_vec();
+  size_t num_words = out_words.size();
+  size_t num_blocks = (num_words + kWordsPerBlock - 1) / kWordsPerBlock;
+
+  katana::do_all(
+      katana::iterate(size_t{0}, num_blocks),
+      [&](size_t b) {
+        size_t word_begin = b * kWordsPerBlock;
+        size_t block_words =
+            std::min(kWordsPerBlock, num_words - word_begin);
+        Block block;
+        EvalBlock(*compiled, word_begin, block_words, block.data());
+        for (size_t w = 0; w < block_words; ++w) {
+          out_words[word_begin + w] = block[w];
+        }
+      },
+      katana::no_stats(), katana::loopname("EvaluateBoolExpr"));
+
+  // Not() can set bits past size() in the last word; keep the
+  // DynamicBitset trailing-bits invariant.
+  size_t tail = size_ % kWordBits;
+  if (tail != 0 && num_words > 0) {
+    out_words[num_words - 1] =
+        out_words[num_words - 1] & ((uint64_t{1} << tail) - 1);
+  }
+
+  return result;
+}
+
+katana::Result<bool>
+katana::PackedBoolView::Test(const std::string& flag, uint64_t node) const {
+  auto it = flag_index_.find(flag);
+  if (it == flag_index_.end()) {
+    return KATANA_ERROR(
+        ErrorCode::PropertyNotFound, "no packed flag named {}",
+        std::quoted(flag));
+  }
+  if (node >= size_) {
+    return KATANA_ERROR(
+        ErrorCode::InvalidArgument, "node {} out of range", node);
+  }
+  return flags_[it->second].test(node);
+}
@@ -3,13 +3,21 @@
 #include <stdio.h>
 #include <sys/mman.h>
 
+#include <cmath>
+#include <limits>
 #include <memory>
+#include <numeric>
+#include <queue>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
 #include <arrow/array.h>
+#include <arrow/compute/api_vector.h>
 
 #include "katana/ArrowInterchange.h"
+#include "katana/ArrowVisitor.h"
+#include "katana/CSRTopology.h"
 #include "katana/ErrorCode.h"
 #include "katana/FileFrame.h"
 #include "katana/GraphTopology.h"
@@ -23,9 +31,11 @@
 #include "katana/RDG.h"
 #include "katana/RDGManifest.h"
 #include "katana/RDGPrefix.h"
+#include "katana/RDGSlice.h"
 #include "katana/RDGStorageFormatVersion.h"
 #include "katana/RDGTopology.h"
 #include "katana/Result.h"
+#include "katana/SharedTopologyRegistry.h"
 #include "katana/tsuba.h"
 
 namespace {
@@ -66,9 +76,10 @@ katana::Result<katana::PropertyGraph::EntityTypeIDArray>
 MapEntityTypeIDsArray(
     const katana::FileView& file_view, size_t num_entries,
     bool is_headerless_entity_type_id_array) {
-  // allocate type IDs array
+  // allocate type IDs array; blocked so each socket's do_all range is
+  // resident on that socket (see the GraphTopology constructors)
   katana::PropertyGraph::EntityTypeIDArray entity_type_id_array;
-  entity_type_id_array.allocateInterleaved(num_entries);
+  entity_type_id_array.allocateBlocked(num_entries);
 
   const katana::EntityTypeID* type_IDs_array = nullptr;
 
@@ -117,7 +128,7 @@ WriteEntityTypeIDsArray(
 katana::PropertyGraph::EntityTypeIDArray
 MakeDefaultEntityTypeIDArray(size_t vec_sz) {
   katana::PropertyGraph::EntityTypeIDArray type_ids;
-  type_ids.allocateInterleaved(vec_sz);
+  type_ids.allocateBlocked(vec_sz);
   katana::ParallelSTL::fill(
       type_ids.begin(), type_ids.end(), katana::kUnknownEntityType);
   return type_ids;
@@ -129,30 +140,286 @@ FillBitMask(
     size_t num_elements, const katana::DynamicBitset& bitset,
     katana::NUMAArray<uint8_t>* bitmask) {
   uint32_t num_bytes = (num_elements + 7) / 8;
+  const auto& words = bitset.get_vec();
 
-  // TODO(udit) find another way to do the following
-  // as it is prone to errors
+  // the bitset and the arrow-style bitmask share LSB-first bit order, so
+  // each 64-bit word maps onto 8 mask bytes; extract bytes by shifting
+  // instead of testing per bit. Bits past num_elements are zero in the
+  // bitset by invariant.
   katana::do_all(katana::iterate(uint32_t{0}, num_bytes), [&](uint32_t i) {
-    auto start = i * 8;
-    auto end = (i + 1) * 8;
-    end = (end > num_elements) ? num_elements : end;
-    uint8_t val{0};
-    while (start != end) {
-      if (bitset.test(start)) {
-        uint8_t bit_offset{1};
-        bit_offset <<= (start % 8);
-        val = val | bit_offset;
+    uint64_t word = words[i / 8];
+    (*bitmask)[i] = static_cast<uint8_t>(word >> (8 * (i % 8)));
+  });
+}
+
+/// Sets the bit for every row of a chunk whose value matches a projection
+/// predicate. The column type is resolved once per chunk and the
+/// comparison runs over contiguous raw values with word-level null
+/// handling (ForEachValidRun), so null rows never match and non-null rows
+/// cost no per-element validity branch.
+struct PredicateVisitor : public katana::ArrowVisitor {
+  using ResultType = katana::Result<void>;
+  using AcceptTypes = std::tuple<katana::AcceptNumericArrowTypes>;
+  using Op = katana::PropertyGraph::PropertyPredicate::Op;
+
+  PredicateVisitor(
+      Op op, const arrow::Scalar& value, katana::DynamicBitset* bits,
+      int64_t base)
+      : op_(op), value_(value), bits_(bits), base_(base) {}
+
+  template <typename ArrowType, typename ArrayType>
+  katana::Result<void> Call(const ArrayType& array) {
+    using CType = typename ArrowType::c_type;
+    auto cast_res = value_.CastTo(array.type());
+    if (!cast_res.ok()) {
+      return KATANA_ERROR(
+          katana::ErrorCode::TypeError, "casting predicate value: {}",
+          cast_res.status());
+    }
+    CType rhs =
+        static_cast<const typename arrow::TypeTraits<ArrowType>::ScalarType&>(
+            *cast_res.ValueOrDie())
+            .value;
+    Op op = op_;
+    katana::ForEachValidRun(
+        array, [&](const CType* values, int64_t begin, int64_t length) {
+          for (int64_t i = 0; i < length; ++i) {
+            if (Matches(op, values[i], rhs)) {
+              bits_->set(base_ + begin + i);
+            }
+          }
+        });
+    return katana::ResultSuccess();
+  }
+
+  katana::Result<void> AcceptFailed(const arrow::Array& array) {
+    return KATANA_ERROR(
+        katana::ErrorCode::TypeError,
+        "projection predicates are not supported over type {}",
+        array.type()->ToString());
+  }
+
+private:
+  template <typename CType>
+  static bool Matches(Op op, CType lhs, CType rhs) {
+    switch (op) {
+    case Op::kLessThan:
+      return lhs < rhs;
+    case Op::kLessEqual:
+      return lhs <= rhs;
+    case Op::kEqual:
+      return lhs == rhs;
+    case Op::kNotEqual:
+      return lhs != rhs;
+    case Op::kGreaterEqual:
+      return lhs >= rhs;
+    case Op::kGreaterThan:
+      return lhs > rhs;
+    }
+    return false;
+  }
+
+  Op op_;
+  const arrow::Scalar& value_;
+  katana::DynamicBitset* bits_;
+  int64_t base_;
+};
+
+/// Computes conservative double min/max bounds over the non-null values of
+/// one chunk. Bounds are widened one ulp so that a value of an integral
+/// type wider than a double can never fall outside them after rounding.
+struct MinMaxVisitor : public katana::ArrowVisitor {
+  using ResultType = katana::Result<void>;
+  using AcceptTypes = std::tuple<katana::AcceptNumericArrowTypes>;
+
+  MinMaxVisitor(katana::PropertyGraph::PropertyChunkStatistics* stats)
+      : stats_(stats) {}
+
+  template <typename ArrowType, typename ArrayType>
+  katana::Result<void> Call(const ArrayType& array) {
+    using CType = typename ArrowType::c_type;
+    CType mn = std::numeric_limits<CType>::max();
+    CType mx = std::numeric_limits<CType>::lowest();
+    bool any = false;
+    katana::ForEachValidRun(
+        array, [&](const CType* values, int64_t, int64_t length) {
+          for (int64_t i = 0; i < length; ++i) {
+            mn = std::min(mn, values[i]);
+            mx = std::max(mx, values[i]);
+          }
+          any |= length > 0;
+        });
+    if (any) {
+      stats_->min = std::nextafter(
+          static_cast<double>(mn), -std::numeric_limits<double>::infinity());
+      stats_->max = std::nextafter(
+          static_cast<double>(mx), std::numeric_limits<double>::infinity());
+      stats_->has_min_max = true;
+    }
+    return katana::ResultSuccess();
+  }
+
+  // Non-numeric columns simply get no bounds; their chunks are never
+  // skipped.
+  katana::Result<void> AcceptFailed(const arrow::Array&) {
+    return katana::ResultSuccess();
+  }
+
+private:
+  katana::PropertyGraph::PropertyChunkStatistics* stats_;
+};
+
+katana::Result<std::vector<katana::PropertyGraph::PropertyChunkStatistics>>
+ComputeChunkStatistics(const arrow::ChunkedArray& column) {
+  std::vector<katana::PropertyGraph::PropertyChunkStatistics> stats(
+      column.num_chunks());
+  for (int i = 0; i < column.num_chunks(); ++i) {
+    const std::shared_ptr<arrow::Array>& chunk = column.chunk(i);
+    stats[i].null_count = chunk->null_count();
+    MinMaxVisitor visitor(&stats[i]);
+    KATANA_CHECKED(katana::VisitArrow(visitor, *chunk));
+  }
+  return stats;
+}
+
+/// Whether a chunk whose non-null values lie in [stats.min, stats.max] can
+/// contain a row matching `op value`. The bounds are conservative, so a
+/// false answer means no row in the chunk matches.
+bool
+ChunkCanMatch(
+    katana::PropertyGraph::PropertyPredicate::Op op,
+    const katana::PropertyGraph::PropertyChunkStatistics& stats,
+    double value) {
+  using Op = katana::PropertyGraph::PropertyPredicate::Op;
+  switch (op) {
+  case Op::kLessThan:
+    return stats.min < value;
+  case Op::kLessEqual:
+    return stats.min <= value;
+  case Op::kEqual:
+    return stats.min <= value && value <= stats.max;
+  case Op::kNotEqual:
+    // A chunk of identical values could be disproven, but the widened
+    // bounds make that test unreliable; never skip.
+    return true;
+  case Op::kGreaterEqual:
+    return stats.max >= value;
+  case Op::kGreaterThan:
+    return stats.max > value;
+  }
+  return true;
+}
+
+/// Evaluate a conjunction of property predicates into a bitset over all
+/// nodes or edges. Each predicate produces its own bitset; the results are
+/// intersected word-wise. Chunks whose zone-map statistics prove that no
+/// row can match are skipped without touching the data.
+katana::Result<katana::DynamicBitset>
+EvalPropertyPredicates(
+    katana::PropertyGraph& pg,
+    const std::vector<katana::PropertyGraph::PropertyPredicate>& predicates,
+    bool for_nodes, size_t num_entities) {
+  katana::DynamicBitset result;
+  result.resize(num_entities);
+  bool first = true;
+  for (const auto& pred : predicates) {
+    if (pred.value == nullptr) {
+      return KATANA_ERROR(
+          katana::ErrorCode::InvalidArgument,
+          "projection predicate on {} has no value",
+          std::quoted(pred.property_name));
+    }
+    std::shared_ptr<arrow::ChunkedArray> column = KATANA_CHECKED(
+        for_nodes ? pg.GetNodeProperty(pred.property_name)
+                  : pg.GetEdgeProperty(pred.property_name));
+    const std::vector<katana::PropertyGraph::PropertyChunkStatistics>* stats =
+        KATANA_CHECKED(
+            for_nodes ? pg.GetNodePropertyStatistics(pred.property_name)
+                      : pg.GetEdgePropertyStatistics(pred.property_name));
+    double pred_value = 0.0;
+    bool have_pred_value = false;
+    if (auto cast_res = pred.value->CastTo(arrow::float64()); cast_res.ok()) {
+      pred_value =
+          static_cast<const arrow::DoubleScalar&>(*cast_res.ValueOrDie())
+              .value;
+      have_pred_value = true;
+    }
+    katana::DynamicBitset bits;
+    bits.resize(num_entities);
+    int64_t base = 0;
+    for (int ci = 0; ci < column->num_chunks(); ++ci) {
+      const std::shared_ptr<arrow::Array>& chunk = column->chunk(ci);
+      const auto& chunk_stats = (*stats)[ci];
+      // Null rows never match, so an all-null chunk is skipped outright;
+      // otherwise skip when the min/max bounds rule out every row.
+      if (chunk_stats.null_count == chunk->length() ||
+          (have_pred_value && chunk_stats.has_min_max &&
+           !ChunkCanMatch(pred.op, chunk_stats, pred_value))) {
+        base += chunk->length();
+        continue;
       }
-      start++;
+      PredicateVisitor visitor(pred.op, *pred.value, &bits, base);
+      KATANA_CHECKED_CONTEXT(
+          katana::VisitArrow(visitor, *chunk), "evaluating predicate on {}",
+          std::quoted(pred.property_name));
+      base += chunk->length();
     }
-    (*bitmask)[i] = val;
-  });
+    if (first) {
+      result = std::move(bits);
+      first = false;
+    } else {
+      result.bitwise_and(bits);
+    }
+  }
+  return result;
 }
 
 }  // namespace
 
 katana::PropertyGraph::~PropertyGraph() = default;
 
+uint64_t
+katana::PropertyGraph::rdg_version() {
+  if (!file_) {
+    return 0;
+  }
+  return rdg_->CurrentVersion(*file_);
+}
+
+katana::Result<
+    const std::vector<katana::PropertyGraph::PropertyChunkStatistics>*>
+katana::PropertyGraph::GetNodePropertyStatistics(const std::string& name) {
+  return GetPropertyStatistics(name, /*for_nodes=*/true);
+}
+
+katana::Result<
+    const std::vector<katana::PropertyGraph::PropertyChunkStatistics>*>
+katana::PropertyGraph::GetEdgePropertyStatistics(const std::string& name) {
+  return GetPropertyStatistics(name, /*for_nodes=*/false);
+}
+
+katana::Result<
+    const std::vector<katana::PropertyGraph::PropertyChunkStatistics>*>
+katana::PropertyGraph::GetPropertyStatistics(
+    const std::string& name, bool for_nodes) {
+  std::shared_ptr<arrow::ChunkedArray> column =
+      KATANA_CHECKED(for_nodes ? GetNodeProperty(name) : GetEdgeProperty(name));
+  auto& cache =
+      for_nodes ? node_property_statistics_ : edge_property_statistics_;
+  auto it = cache.find(name);
+  if (it != cache.end() && it->second.source.lock() == column) {
+    return &it->second.chunks;
+  }
+  PropertyStatisticsEntry entry;
+  entry.source = column;
+  entry.chunks = KATANA_CHECKED_CONTEXT(
+      ComputeChunkStatistics(*column), "computing statistics for {}",
+      std::quoted(name));
+  auto& slot = cache[name];
+  slot = std::move(entry);
+  return &slot.chunks;
+}
+
 katana::Result<std::unique_ptr<katana::PropertyGraph>>
 katana::PropertyGraph::Make(
     std::unique_ptr<katana::RDGFile> rdg_file, katana::RDG&& rdg,
@@ -166,8 +433,16 @@ katana::PropertyGraph::Make(
 
   KATANA_LOG_DEBUG_ASSERT(CheckTopology(
       csr->adj_indices(), csr->num_nodes(), csr->dests(), csr->num_edges()));
-  katana::GraphTopology topo = katana::GraphTopology(
-      csr->adj_indices(), csr->num_nodes(), csr->dests(), csr->num_edges());
+  // Versions of a graph that do not change structure reference the same
+  // topology file, so intern the in-memory copy by the file's storage
+  // name: opening several such versions shares one GraphTopology.
+  std::shared_ptr<katana::GraphTopology> topo =
+      katana::SharedTopologyRegistry::Get().Intern(
+          csr->file_storage().filename(), [&]() {
+            return katana::GraphTopology(
+                csr->adj_indices(), csr->num_nodes(), csr->dests(),
+                csr->num_edges());
+          });
 
   // The GraphTopology constructor copies all of the required topology data.
   // Clean up the RDGTopologies memory
@@ -177,15 +452,15 @@ katana::PropertyGraph::Make(
     KATANA_LOG_DEBUG("loading EntityType data from outside properties");
 
     EntityTypeIDArray node_type_ids = KATANA_CHECKED(MapEntityTypeIDsArray(
-        rdg.node_entity_type_id_array_file_storage(), topo.NumNodes(),
+        rdg.node_entity_type_id_array_file_storage(), topo->NumNodes(),
         rdg.IsHeaderlessEntityTypeIDArray()));
 
     EntityTypeIDArray edge_type_ids = KATANA_CHECKED(MapEntityTypeIDsArray(
-        rdg.edge_entity_type_id_array_file_storage(), topo.NumEdges(),
+        rdg.edge_entity_type_id_array_file_storage(), topo->NumEdges(),
         rdg.IsHeaderlessEntityTypeIDArray()));
 
-    KATANA_ASSERT(topo.NumNodes() == node_type_ids.size());
-    KATANA_ASSERT(topo.NumEdges() == edge_type_ids.size());
+    KATANA_ASSERT(topo->NumNodes() == node_type_ids.size());
+    KATANA_ASSERT(topo->NumEdges() == edge_type_ids.size());
 
     EntityTypeManager node_type_manager =
         KATANA_CHECKED(rdg.node_entity_type_manager());
@@ -200,9 +475,9 @@ katana::PropertyGraph::Make(
     // we must construct id_arrays and managers from properties
 
     auto pg = std::make_unique<PropertyGraph>(
-        std::move(rdg_file), std::move(rdg), std::move(topo),
-        MakeDefaultEntityTypeIDArray(topo.NumNodes()),
-        MakeDefaultEntityTypeIDArray(topo.NumEdges()), EntityTypeManager{},
+        std::move(rdg_file), std::move(rdg), topo,
+        MakeDefaultEntityTypeIDArray(topo->NumNodes()),
+        MakeDefaultEntityTypeIDArray(topo->NumEdges()), EntityTypeManager{},
         EntityTypeManager{});
 
     KATANA_CHECKED(pg->ConstructEntityTypeIDs(txn_ctx));
@@ -233,6 +508,186 @@ katana::PropertyGraph::Make(
       std::move(rdg_file), std::move(rdg), txn_ctx);
 }
 
+katana::Result<std::unique_ptr<katana::PropertyGraph>>
+katana::PropertyGraph::MakeRange(
+    const katana::URI& rdg_dir, std::pair<uint64_t, uint64_t> node_range,
+    katana::TxnContext* txn_ctx, const katana::RDGLoadOptions& opts) {
+  katana::RDGManifest manifest =
+      KATANA_CHECKED(katana::FindManifest(rdg_dir, txn_ctx));
+  katana::RDGHandle handle =
+      KATANA_CHECKED(katana::Open(std::move(manifest), katana::kReadOnly));
+  RDGFile file(handle);
+
+  uint32_t partition_id = opts.partition_id_to_load.value_or(0);
+  RDGPrefix prefix = KATANA_CHECKED(RDGPrefix::Make(handle, partition_id));
+
+  const uint64_t node_begin = node_range.first;
+  const uint64_t node_end = node_range.second;
+  if (node_begin > node_end || node_end > prefix.num_nodes()) {
+    return KATANA_ERROR(
+        ErrorCode::InvalidArgument,
+        "node range [{}, {}) is not within the {} nodes of {}", node_begin,
+        node_end, prefix.num_nodes(), rdg_dir);
+  }
+
+  // CSR puts a node range's outgoing edges in one contiguous run, so the
+  // prefix array alone determines the edge range and the byte range of the
+  // destination entries to bind.
+  const uint64_t edge_begin = node_begin > 0 ? prefix[node_begin - 1] : 0;
+  const uint64_t edge_end =
+      node_end > node_begin ? prefix[node_end - 1] : edge_begin;
+  const uint64_t dest_entry_size =
+      prefix.version() == 1 ? sizeof(uint32_t) : sizeof(uint64_t);
+  auto dests_file_offset = [&](uint64_t edge) {
+    return sizeof(CSRTopologyHeader) + prefix.num_nodes() * sizeof(uint64_t) +
+           edge * dest_entry_size;
+  };
+
+  RDGSlice::SliceArg slice_arg{
+      .node_range = std::make_pair(node_begin, node_end),
+      .edge_range = std::make_pair(edge_begin, edge_end),
+      .topo_off = dests_file_offset(edge_begin),
+      .topo_size = dests_file_offset(edge_end) - dests_file_offset(edge_begin),
+  };
+  RDGSlice slice = KATANA_CHECKED(RDGSlice::Make(
+      handle, slice_arg, partition_id, opts.node_properties,
+      opts.edge_properties));
+
+  const uint64_t num_range_nodes = node_end - node_begin;
+  const FileView& topo_fv = slice.topology_file_storage();
+  const uint32_t* dests32 = nullptr;
+  const uint64_t* dests64 = nullptr;
+  if (dest_entry_size == sizeof(uint32_t)) {
+    dests32 = topo_fv.ptr<uint32_t>(slice_arg.topo_off);
+  } else {
+    dests64 = topo_fv.ptr<uint64_t>(slice_arg.topo_off);
+  }
+  auto global_dest = [&](uint64_t edge) {
+    return dests32 != nullptr ? uint64_t{dests32[edge - edge_begin]}
+                              : dests64[edge - edge_begin];
+  };
+
+  // First pass counts each node's surviving out-degree so the new adjacency
+  // array can be built with a prefix sum; the second pass fills in the
+  // rebased destinations and remembers each kept edge's global ID so
+  // property rows and type IDs can follow.
+  GraphTopology::AdjIndexVec adj_indices;
+  adj_indices.allocateInterleaved(num_range_nodes);
+  katana::do_all(
+      katana::iterate(uint64_t{0}, num_range_nodes),
+      [&](uint64_t local) {
+        uint64_t node = node_begin + local;
+        uint64_t last = prefix[node];
+        uint64_t kept = 0;
+        for (uint64_t e = node > 0 ? prefix[node - 1] : 0; e < last; ++e) {
+          uint64_t dest = global_dest(e);
+          if (dest >= node_begin && dest < node_end) {
+            ++kept;
+          }
+        }
+        adj_indices[local] = kept;
+      },
+      katana::steal());
+  katana::ParallelSTL::partial_sum(
+      adj_indices.begin(), adj_indices.end(), adj_indices.begin());
+  const uint64_t num_range_edges =
+      num_range_nodes > 0 ? adj_indices[num_range_nodes - 1] : 0;
+
+  GraphTopology::EdgeDestVec dests;
+  dests.allocateInterleaved(num_range_edges);
+  NUMAArray<uint64_t> kept_edge_to_global;
+  kept_edge_to_global.allocateInterleaved(num_range_edges);
+  katana::do_all(
+      katana::iterate(uint64_t{0}, num_range_nodes),
+      [&](uint64_t local) {
+        uint64_t node = node_begin + local;
+        uint64_t last = prefix[node];
+        uint64_t out = local > 0 ? adj_indices[local - 1] : 0;
+        for (uint64_t e = node > 0 ? prefix[node - 1] : 0; e < last; ++e) {
+          uint64_t dest = global_dest(e);
+          if (dest >= node_begin && dest < node_end) {
+            dests[out] = static_cast<GraphTopology::Node>(dest - node_begin);
+            kept_edge_to_global[out] = e;
+            ++out;
+          }
+        }
+        KATANA_LOG_DEBUG_ASSERT(out == adj_indices[local]);
+      },
+      katana::steal());
+
+  // Slice the property tables before the type work so graphs that still
+  // store types as uint8 properties can derive them from the sliced rows.
+  std::shared_ptr<arrow::Table> node_props = slice.node_properties();
+  std::shared_ptr<arrow::Table> edge_props = slice.edge_properties();
+  if (edge_props->num_columns() > 0 && edge_props->num_rows() > 0) {
+    arrow::UInt64Builder builder;
+    KATANA_CHECKED(builder.Resize(num_range_edges));
+    for (uint64_t i = 0; i < num_range_edges; ++i) {
+      builder.UnsafeAppend(kept_edge_to_global[i] - edge_begin);
+    }
+    std::shared_ptr<arrow::Array> indices = KATANA_CHECKED(builder.Finish());
+    arrow::Datum taken =
+        KATANA_CHECKED(arrow::compute::Take(edge_props, indices));
+    edge_props = taken.table();
+  }
+
+  EntityTypeIDArray node_type_ids;
+  EntityTypeIDArray edge_type_ids;
+  EntityTypeManager node_type_manager;
+  EntityTypeManager edge_type_manager;
+  if (slice.IsEntityTypeIDsOutsideProperties()) {
+    node_type_ids = KATANA_CHECKED(slice.node_entity_type_id_array());
+    NUMAArray<EntityTypeID> slice_edge_types =
+        KATANA_CHECKED(slice.edge_entity_type_id_array());
+    edge_type_ids.allocateInterleaved(num_range_edges);
+    katana::do_all(
+        katana::iterate(uint64_t{0}, num_range_edges), [&](uint64_t i) {
+          edge_type_ids[i] = slice_edge_types[kept_edge_to_global[i] - edge_begin];
+        });
+    node_type_manager = KATANA_CHECKED(slice.node_entity_type_manager());
+    edge_type_manager = KATANA_CHECKED(slice.edge_entity_type_manager());
+  } else {
+    // Old-style graph: types are uint8 properties, so infer them from the
+    // sliced rows and drop the type columns like ConstructEntityTypeIDs.
+    node_type_ids = MakeDefaultEntityTypeIDArray(num_range_nodes);
+    edge_type_ids = MakeDefaultEntityTypeIDArray(num_range_edges);
+    if (node_props->num_rows() > 0) {
+      auto to_remove =
+          KATANA_CHECKED(EntityTypeManager::AssignEntityTypeIDsFromProperties(
+              num_range_nodes, node_props, &node_type_manager,
+              &node_type_ids));
+      for (const std::string& name : to_remove) {
+        node_props = KATANA_CHECKED(
+            node_props->RemoveColumn(node_props->schema()->GetFieldIndex(name)));
+      }
+    }
+    if (edge_props->num_rows() > 0) {
+      auto to_remove =
+          KATANA_CHECKED(EntityTypeManager::AssignEntityTypeIDsFromProperties(
+              num_range_edges, edge_props, &edge_type_manager,
+              &edge_type_ids));
+      for (const std::string& name : to_remove) {
+        edge_props = KATANA_CHECKED(
+            edge_props->RemoveColumn(edge_props->schema()->GetFieldIndex(name)));
+      }
+    }
+  }
+
+  GraphTopology topo(std::move(adj_indices), std::move(dests));
+  std::unique_ptr<PropertyGraph> pg = KATANA_CHECKED(PropertyGraph::Make(
+      std::move(topo), std::move(node_type_ids), std::move(edge_type_ids),
+      std::move(node_type_manager), std::move(edge_type_manager)));
+
+  if (node_props->num_columns() > 0 && node_props->num_rows() > 0) {
+    KATANA_CHECKED(pg->AddNodeProperties(node_props, txn_ctx));
+  }
+  if (edge_props->num_columns() > 0 && edge_props->num_rows() > 0) {
+    KATANA_CHECKED(pg->AddEdgeProperties(edge_props, txn_ctx));
+  }
+
+  return MakeResult(std::move(pg));
+}
+
 katana::Result<std::unique_ptr<katana::PropertyGraph>>
 katana::PropertyGraph::Make(katana::GraphTopology&& topo_to_assign) {
   return std::make_unique<katana::PropertyGraph>(
@@ -383,11 +838,34 @@ katana::Result<std::unique_ptr<katana::PropertyGraph>>
 katana::PropertyGraph::MakeProjectedGraph(
     PropertyGraph& pg, std::optional<SetOfEntityTypeIDs> node_types,
     std::optional<SetOfEntityTypeIDs> edge_types) {
+  return MakeProjectedGraph(
+      pg, std::move(node_types), std::move(edge_types), {}, {});
+}
+
+katana::Result<std::unique_ptr<katana::PropertyGraph>>
+katana::PropertyGraph::MakeProjectedGraph(
+    PropertyGraph& pg, std::optional<SetOfEntityTypeIDs> node_types,
+    std::optional<SetOfEntityTypeIDs> edge_types,
+    const std::vector<PropertyPredicate>& node_predicates,
+    const std::vector<PropertyPredicate>& edge_predicates) {
   const auto& topology = pg.topology();
   if (topology.empty()) {
     return MakeEmptyProjectedGraph(pg, katana::DynamicBitset{});
   }
 
+  // evaluate property predicates up front so the selection loops below
+  // fuse type and predicate filtering into the same pass over the topology
+  std::optional<katana::DynamicBitset> node_pred_bits;
+  if (!node_predicates.empty()) {
+    node_pred_bits = KATANA_CHECKED(EvalPropertyPredicates(
+        pg, node_predicates, /*for_nodes=*/true, topology.NumNodes()));
+  }
+  std::optional<katana::DynamicBitset> edge_pred_bits;
+  if (!edge_predicates.empty()) {
+    edge_pred_bits = KATANA_CHECKED(EvalPropertyPredicates(
+        pg, edge_predicates, /*for_nodes=*/false, topology.NumEdges()));
+  }
+
   // calculate number of new nodes
   uint32_t num_new_nodes = 0;
   uint32_t num_new_edges = 0;
@@ -398,7 +876,7 @@ katana::PropertyGraph::MakeProjectedGraph(
   NUMAArray<Node> original_to_projected_nodes_mapping;
   original_to_projected_nodes_mapping.allocateInterleaved(topology.NumNodes());
 
-  if (!node_types) {
+  if (!node_types && !node_pred_bits) {
     num_new_nodes = topology.NumNodes();
     // set all nodes
     katana::do_all(katana::iterate(topology.Nodes()), [&](auto src) {
@@ -413,16 +891,26 @@ katana::PropertyGraph::MakeProjectedGraph(
     katana::GAccumulator<uint32_t> accum_num_new_nodes;
 
     katana::do_all(katana::iterate(topology.Nodes()), [&](auto src) {
-      for (auto type : node_types.value()) {
-        if (pg.DoesNodeHaveType(src, type)) {
-          accum_num_new_nodes += 1;
-          bitset_nodes.set(src);
-          // this sets the corresponding entry in the array to 1
-          // will perform a prefix sum on this array later on
-          original_to_projected_nodes_mapping[src] = 1;
+      if (node_pred_bits && !node_pred_bits->test(src)) {
+        return;
+      }
+      if (node_types) {
+        bool has_type = false;
+        for (auto type : node_types.value()) {
+          if (pg.DoesNodeHaveType(src, type)) {
+            has_type = true;
+            break;
+          }
+        }
+        if (!has_type) {
           return;
         }
       }
+      accum_num_new_nodes += 1;
+      bitset_nodes.set(src);
+      // this sets the corresponding entry in the array to 1
+      // will perform a prefix sum on this array later on
+      original_to_projected_nodes_mapping[src] = 1;
     });
     num_new_nodes = accum_num_new_nodes.reduce();
 
@@ -469,7 +957,7 @@ katana::PropertyGraph::MakeProjectedGraph(
   // initializes the edge-index array to all zeros
   katana::ParallelSTL::fill(out_indices.begin(), out_indices.end(), Edge{0});
 
-  if (!edge_types) {
+  if (!edge_types && !edge_pred_bits) {
     katana::GAccumulator<uint32_t> accum_num_new_edges;
     // set all edges incident to projected nodes
     katana::do_all(
@@ -498,16 +986,27 @@ katana::PropertyGraph::MakeProjectedGraph(
 
           for (Edge e : topology.OutEdges(old_src)) {
             auto dest = topology.OutEdgeDst(e);
-            if (bitset_nodes.test(dest)) {
+            if (!bitset_nodes.test(dest)) {
+              continue;
+            }
+            if (edge_pred_bits && !edge_pred_bits->test(e)) {
+              continue;
+            }
+            if (edge_types) {
+              bool has_type = false;
               for (auto type : edge_types.value()) {
                 if (pg.DoesEdgeHaveTypeFromTopoIndex(e, type)) {
-                  accum_num_new_edges += 1;
-                  bitset_edges.set(e);
-                  out_indices[src] += 1;
+                  has_type = true;
                   break;
                 }
               }
+              if (!has_type) {
+                continue;
+              }
             }
+            accum_num_new_edges += 1;
+            bitset_edges.set(e);
+            out_indices[src] += 1;
           }
         },
         katana::steal());
@@ -743,6 +1242,26 @@ katana::PropertyGraph::LoadTopology(const katana::RDGTopology& shadow) {
   return topo;
 }
 
+katana::Result<std::shared_ptr<const katana::DynamicBitset>>
+katana::PropertyGraph::GetNodesWithType(EntityTypeID node_entity_type_id) {
+  if (node_entity_type_id >= GetNodeTypeManager().GetNumEntityTypes()) {
+    return KATANA_ERROR(
+        ErrorCode::NotFound, "no node entity type with ID {}",
+        node_entity_type_id);
+  }
+  return pg_view_cache_.BuildOrGetNodeTypeBitmap(this, node_entity_type_id);
+}
+
+katana::Result<std::shared_ptr<const katana::DynamicBitset>>
+katana::PropertyGraph::GetEdgesWithType(EntityTypeID edge_entity_type_id) {
+  if (edge_entity_type_id >= GetEdgeTypeManager().GetNumEntityTypes()) {
+    return KATANA_ERROR(
+        ErrorCode::NotFound, "no edge entity type with ID {}",
+        edge_entity_type_id);
+  }
+  return pg_view_cache_.BuildOrGetEdgeTypeBitmap(this, edge_entity_type_id);
+}
+
 katana::Result<void>
 katana::PropertyGraph::DoWriteTopologies() {
   // Since PGViewCache doesn't manage the main csr topology, see if we need to store it now
@@ -1181,6 +1700,87 @@ katana::PropertyGraph::UpsertNodeProperties(
   return rdg_->UpsertNodeProperties(props, txn_ctx);
 }
 
+namespace {
+
+/// Flatten prop_tables into one table, checking row counts and name
+/// uniqueness up front and running arrow validation over all columns in
+/// parallel. Nothing is inserted here, so a failure leaves the graph
+/// untouched.
+katana::Result<std::shared_ptr<arrow::Table>>
+CombinePropertyTables(
+    const std::vector<std::shared_ptr<arrow::Table>>& prop_tables,
+    uint64_t expected_rows) {
+  std::vector<std::shared_ptr<arrow::Field>> fields;
+  std::vector<std::shared_ptr<arrow::ChunkedArray>> columns;
+  std::unordered_set<std::string> seen_names;
+
+  for (const auto& table : prop_tables) {
+    if (!table) {
+      return KATANA_ERROR(
+          katana::ErrorCode::InvalidArgument, "property table is null");
+    }
+    if (table->num_columns() == 0) {
+      continue;
+    }
+    if (expected_rows != static_cast<uint64_t>(table->num_rows())) {
+      return KATANA_ERROR(
+          katana::ErrorCode::InvalidArgument, "expected {} rows found {} instead",
+          expected_rows, table->num_rows());
+    }
+    for (int i = 0; i < table->num_columns(); ++i) {
+      const auto& field = table->schema()->field(i);
+      if (!seen_names.insert(field->name()).second) {
+        return KATANA_ERROR(
+            katana::ErrorCode::AlreadyExists,
+            "column names are not distinct: {}", field->name());
+      }
+      fields.emplace_back(field);
+      columns.emplace_back(table->column(i));
+    }
+  }
+
+  if (fields.empty()) {
+    return KATANA_ERROR(
+        katana::ErrorCode::InvalidArgument, "no properties to add");
+  }
+
+  std::vector<arrow::Status> statuses(columns.size());
+  katana::do_all(
+      katana::iterate(size_t{0}, columns.size()),
+      [&](size_t i) { statuses[i] = columns[i]->ValidateFull(); },
+      katana::steal(), katana::loopname("ValidateBulkProperties"));
+  for (size_t i = 0; i < statuses.size(); ++i) {
+    if (!statuses[i].ok()) {
+      return KATANA_ERROR(
+          katana::ErrorCode::ArrowError, "validating column {}: {}",
+          fields[i]->name(), statuses[i]);
+    }
+  }
+
+  return arrow::Table::Make(
+      arrow::schema(fields), columns, static_cast<int64_t>(expected_rows));
+}
+
+}  // namespace
+
+katana::Result<void>
+katana::PropertyGraph::AddNodePropertiesBulk(
+    const std::vector<std::shared_ptr<arrow::Table>>& prop_tables,
+    katana::TxnContext* txn_ctx) {
+  std::shared_ptr<arrow::Table> combined =
+      KATANA_CHECKED(CombinePropertyTables(prop_tables, NumOriginalNodes()));
+  return AddNodeProperties(combined, txn_ctx);
+}
+
+katana::Result<void>
+katana::PropertyGraph::AddEdgePropertiesBulk(
+    const std::vector<std::shared_ptr<arrow::Table>>& prop_tables,
+    katana::TxnContext* txn_ctx) {
+  std::shared_ptr<arrow::Table> combined =
+      KATANA_CHECKED(CombinePropertyTables(prop_tables, NumOriginalEdges()));
+  return AddEdgeProperties(combined, txn_ctx);
+}
+
 katana::Result<void>
 katana::PropertyGraph::RemoveNodeProperty(int i, katana::TxnContext* txn_ctx) {
   return rdg_->RemoveNodeProperty(i, txn_ctx);
@@ -1519,6 +2119,304 @@ katana::SortNodesByDegree(katana::PropertyGraph* pg) {
   return katana::ResultSuccess();
 }
 
+katana::Result<std::unique_ptr<katana::PropertyGraph>>
+katana::CreateRelabeledGraph(
+    katana::PropertyGraph* pg, const katana::NUMAArray<uint32_t>& old_to_new,
+    katana::TxnContext* txn_ctx) {
+  const auto& topo = pg->topology();
+  const uint64_t num_nodes = topo.NumNodes();
+  const uint64_t num_edges = topo.NumEdges();
+
+  if (num_nodes == 0) {
+    return std::make_unique<PropertyGraph>();
+  }
+  if (old_to_new.size() != num_nodes) {
+    return KATANA_ERROR(
+        ErrorCode::InvalidArgument, "permutation has {} entries for {} nodes",
+        old_to_new.size(), num_nodes);
+  }
+
+  katana::NUMAArray<uint32_t> new_to_old;
+  new_to_old.allocateInterleaved(num_nodes);
+  katana::do_all(katana::iterate(topo.Nodes()), [&](auto old_id) {
+    KATANA_LOG_DEBUG_ASSERT(old_to_new[old_id] < num_nodes);
+    new_to_old[old_to_new[old_id]] = old_id;
+  });
+
+  GraphTopology::AdjIndexVec new_adj_indices;
+  new_adj_indices.allocateInterleaved(num_nodes);
+
+  katana::do_all(katana::iterate(uint64_t{0}, num_nodes), [&](uint64_t new_id) {
+    new_adj_indices[new_id] = topo.OutDegree(new_to_old[new_id]);
+  });
+
+  katana::ParallelSTL::partial_sum(
+      new_adj_indices.begin(), new_adj_indices.end(), new_adj_indices.begin());
+
+  // Rewrite the destination array in the new order, remembering for every new
+  // edge position which old edge it came from so property columns and type
+  // IDs can follow the same permutation.
+  GraphTopology::EdgeDestVec new_dests;
+  new_dests.allocateInterleaved(num_edges);
+
+  katana::NUMAArray<uint64_t> edge_new_to_old;
+  edge_new_to_old.allocateInterleaved(num_edges);
+
+  katana::do_all(
+      katana::iterate(topo.Nodes()),
+      [&](auto old_id) {
+        uint32_t new_id = old_to_new[old_id];
+        uint64_t out = (new_id == 0) ? 0 : new_adj_indices[new_id - 1];
+        for (auto e : topo.OutEdges(old_id)) {
+          new_dests[out] = old_to_new[topo.OutEdgeDst(e)];
+          edge_new_to_old[out] = e;
+          ++out;
+        }
+        KATANA_LOG_DEBUG_ASSERT(out == new_adj_indices[new_id]);
+      },
+      katana::steal());
+
+  // Entity type IDs follow the same permutations so the new graph needs no
+  // property index arrays.
+  PropertyGraph::EntityTypeIDArray node_type_ids;
+  node_type_ids.allocateInterleaved(num_nodes);
+  katana::do_all(katana::iterate(uint64_t{0}, num_nodes), [&](uint64_t new_id) {
+    node_type_ids[new_id] = pg->GetTypeOfNode(new_to_old[new_id]);
+  });
+
+  PropertyGraph::EntityTypeIDArray edge_type_ids;
+  edge_type_ids.allocateInterleaved(num_edges);
+  katana::do_all(
+      katana::iterate(uint64_t{0}, num_edges), [&](uint64_t new_eid) {
+        edge_type_ids[new_eid] =
+            pg->GetTypeOfEdgeFromTopoIndex(edge_new_to_old[new_eid]);
+      });
+
+  GraphTopology new_topo(std::move(new_adj_indices), std::move(new_dests));
+
+  std::unique_ptr<PropertyGraph> relabeled = KATANA_CHECKED(PropertyGraph::Make(
+      std::move(new_topo), std::move(node_type_ids), std::move(edge_type_ids),
+      EntityTypeManager(pg->GetNodeTypeManager()),
+      EntityTypeManager(pg->GetEdgeTypeManager())));
+
+  // Permute property columns with a single Take per table.
+  if (pg->GetNumNodeProperties() > 0) {
+    arrow::UInt64Builder builder;
+    KATANA_CHECKED(builder.Resize(num_nodes));
+    for (uint64_t new_id = 0; new_id < num_nodes; ++new_id) {
+      builder.UnsafeAppend(topo.GetNodePropertyIndex(new_to_old[new_id]));
+    }
+    std::shared_ptr<arrow::Array> indices = KATANA_CHECKED(builder.Finish());
+
+    std::vector<std::shared_ptr<arrow::ChunkedArray>> columns;
+    for (int32_t i = 0; i < pg->GetNumNodeProperties(); ++i) {
+      columns.emplace_back(pg->GetNodeProperty(i));
+    }
+    auto table = arrow::Table::Make(pg->loaded_node_schema(), columns);
+    arrow::Datum permuted =
+        KATANA_CHECKED(arrow::compute::Take(table, indices));
+    KATANA_CHECKED(relabeled->AddNodeProperties(permuted.table(), txn_ctx));
+  }
+
+  if (pg->GetNumEdgeProperties() > 0) {
+    arrow::UInt64Builder builder;
+    KATANA_CHECKED(builder.Resize(num_edges));
+    for (uint64_t new_eid = 0; new_eid < num_edges; ++new_eid) {
+      builder.UnsafeAppend(
+          topo.GetEdgePropertyIndexFromOutEdge(edge_new_to_old[new_eid]));
+    }
+    std::shared_ptr<arrow::Array> indices = KATANA_CHECKED(builder.Finish());
+
+    std::vector<std::shared_ptr<arrow::ChunkedArray>> columns;
+    for (int32_t i = 0; i < pg->GetNumEdgeProperties(); ++i) {
+      columns.emplace_back(pg->GetEdgeProperty(i));
+    }
+    auto table = arrow::Table::Make(pg->loaded_edge_schema(), columns);
+    arrow::Datum permuted =
+        KATANA_CHECKED(arrow::compute::Take(table, indices));
+    KATANA_CHECKED(relabeled->AddEdgeProperties(permuted.table(), txn_ctx));
+  }
+
+  return std::unique_ptr<PropertyGraph>(std::move(relabeled));
+}
+
+katana::Result<std::unique_ptr<katana::PropertyGraph>>
+katana::CreateDegreeRelabeledGraph(
+    katana::PropertyGraph* pg, katana::TxnContext* txn_ctx) {
+  katana::NUMAArray<uint32_t> old_to_new =
+      KATANA_CHECKED(ComputeDegreeOrder(pg));
+  return CreateRelabeledGraph(pg, old_to_new, txn_ctx);
+}
+
+katana::Result<katana::NUMAArray<uint32_t>>
+katana::ComputeDegreeOrder(const katana::PropertyGraph* pg) {
+  const auto& topo = pg->topology();
+  const uint64_t num_nodes = topo.NumNodes();
+
+  using DegreeNodePair = std::pair<uint64_t, uint32_t>;
+  katana::NUMAArray<DegreeNodePair> dn_pairs;
+  dn_pairs.allocateInterleaved(num_nodes);
+
+  katana::do_all(katana::iterate(topo.Nodes()), [&](auto node) {
+    dn_pairs[node] = DegreeNodePair(topo.OutDegree(node), node);
+  });
+
+  katana::ParallelSTL::sort(
+      dn_pairs.begin(), dn_pairs.end(), std::greater<DegreeNodePair>());
+
+  katana::NUMAArray<uint32_t> old_to_new;
+  old_to_new.allocateInterleaved(num_nodes);
+  katana::do_all(katana::iterate(uint64_t{0}, num_nodes), [&](uint64_t new_id) {
+    old_to_new[dn_pairs[new_id].second] = new_id;
+  });
+
+  return old_to_new;
+}
+
+katana::Result<katana::NUMAArray<uint32_t>>
+katana::ComputeRCMOrder(const katana::PropertyGraph* pg) {
+  const auto& topo = pg->topology();
+  const uint64_t num_nodes = topo.NumNodes();
+
+  katana::NUMAArray<uint32_t> old_to_new;
+  old_to_new.allocateInterleaved(num_nodes);
+  if (num_nodes == 0) {
+    return old_to_new;
+  }
+
+  // Classic Cuthill-McKee: breadth-first traversal seeded at low-degree
+  // nodes, neighbors visited in ascending degree order, final labels
+  // reversed. The traversal is inherently sequential; reordering is a
+  // one-time cost, so this runs single-threaded.
+  std::vector<uint32_t> seeds(num_nodes);
+  std::iota(seeds.begin(), seeds.end(), 0);
+  std::sort(seeds.begin(), seeds.end(), [&](uint32_t a, uint32_t b) {
+    return topo.OutDegree(a) < topo.OutDegree(b);
+  });
+
+  std::vector<uint32_t> order;
+  order.reserve(num_nodes);
+  std::vector<bool> visited(num_nodes, false);
+  std::vector<uint32_t> frontier;
+
+  size_t head = 0;
+  for (uint32_t seed : seeds) {
+    if (visited[seed]) {
+      continue;
+    }
+    visited[seed] = true;
+    order.push_back(seed);
+    while (head < order.size()) {
+      uint32_t node = order[head++];
+      frontier.clear();
+      for (auto e : topo.OutEdges(node)) {
+        uint32_t dest = topo.OutEdgeDst(e);
+        if (!visited[dest]) {
+          visited[dest] = true;
+          frontier.push_back(dest);
+        }
+      }
+      std::sort(frontier.begin(), frontier.end(), [&](uint32_t a, uint32_t b) {
+        return topo.OutDegree(a) < topo.OutDegree(b);
+      });
+      order.insert(order.end(), frontier.begin(), frontier.end());
+    }
+  }
+  KATANA_LOG_DEBUG_ASSERT(order.size() == num_nodes);
+
+  katana::do_all(katana::iterate(uint64_t{0}, num_nodes), [&](uint64_t i) {
+    old_to_new[order[i]] = num_nodes - 1 - i;
+  });
+
+  return old_to_new;
+}
+
+katana::Result<katana::NUMAArray<uint32_t>>
+katana::ComputeWindowAffinityOrder(
+    const katana::PropertyGraph* pg, uint32_t window) {
+  const auto& topo = pg->topology();
+  const uint64_t num_nodes = topo.NumNodes();
+
+  katana::NUMAArray<uint32_t> old_to_new;
+  old_to_new.allocateInterleaved(num_nodes);
+  if (num_nodes == 0) {
+    return old_to_new;
+  }
+  if (window == 0) {
+    return KATANA_ERROR(ErrorCode::InvalidArgument, "window must be positive");
+  }
+
+  // Gorder-style greedy: place next the unplaced node with the most
+  // neighbors among the last `window` placed nodes, so nodes accessed
+  // together end up on the same cache lines. Scores are maintained
+  // incrementally (+1 when a neighbor enters the window, -1 when it slides
+  // out) with a lazy max-heap; stale heap entries are re-pushed with their
+  // current score. Hubs seed the scan in degree-descending order.
+  std::vector<uint32_t> seeds(num_nodes);
+  std::iota(seeds.begin(), seeds.end(), 0);
+  std::sort(seeds.begin(), seeds.end(), [&](uint32_t a, uint32_t b) {
+    return topo.OutDegree(a) > topo.OutDegree(b);
+  });
+
+  std::vector<int64_t> score(num_nodes, 0);
+  std::vector<bool> placed(num_nodes, false);
+  std::vector<uint32_t> order;
+  order.reserve(num_nodes);
+  std::priority_queue<std::pair<int64_t, uint32_t>> heap;
+
+  auto place = [&](uint32_t node) {
+    placed[node] = true;
+    order.push_back(node);
+    for (auto e : topo.OutEdges(node)) {
+      uint32_t dest = topo.OutEdgeDst(e);
+      if (!placed[dest]) {
+        ++score[dest];
+        heap.emplace(score[dest], dest);
+      }
+    }
+    if (order.size() > window) {
+      uint32_t expired = order[order.size() - 1 - window];
+      for (auto e : topo.OutEdges(expired)) {
+        uint32_t dest = topo.OutEdgeDst(e);
+        if (!placed[dest]) {
+          --score[dest];
+        }
+      }
+    }
+  };
+
+  size_t next_seed = 0;
+  while (order.size() < num_nodes) {
+    uint32_t chosen = std::numeric_limits<uint32_t>::max();
+    while (!heap.empty()) {
+      auto [snapshot, node] = heap.top();
+      heap.pop();
+      if (placed[node]) {
+        continue;
+      }
+      if (snapshot != score[node]) {
+        heap.emplace(score[node], node);
+        continue;
+      }
+      chosen = node;
+      break;
+    }
+    if (chosen == std::numeric_limits<uint32_t>::max()) {
+      while (placed[seeds[next_seed]]) {
+        ++next_seed;
+      }
+      chosen = seeds[next_seed];
+    }
+    place(chosen);
+  }
+
+  katana::do_all(katana::iterate(uint64_t{0}, num_nodes), [&](uint64_t i) {
+    old_to_new[order[i]] = i;
+  });
+
+  return old_to_new;
+}
+
 katana::Result<std::unique_ptr<katana::PropertyGraph>>
 katana::CreateSymmetricGraph(katana::PropertyGraph* pg) {
   const GraphTopology& topology = pg->topology();
@@ -1605,8 +2503,11 @@ katana::CreateTransposeGraphTopology(const GraphTopology& topology) {
   katana::NUMAArray<GraphTopology::Edge> out_indices;
   katana::NUMAArray<GraphTopology::Node> out_dests;
 
-  out_indices.allocateInterleaved(topology.NumNodes());
-  out_dests.allocateInterleaved(topology.NumEdges());
+  // Blocked placement matches the blocked node ranges do_all hands to each
+  // thread, keeping the transposed arrays local to the socket that builds
+  // and later iterates them.
+  out_indices.allocateBlocked(topology.NumNodes());
+  out_dests.allocateBlocked(topology.NumEdges());
 
   // Initialize the new topology indices
   katana::do_all(
@@ -0,0 +1,187 @@
+#include "katana/SampledSubgraph.h"
+
+#include <algorithm>
+#include <random>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "katana/ErrorCode.h"
+#include "katana/Loops.h"
+#include "katana/ParallelSTL.h"
+
+katana::Result<katana::SampledSubgraph>
+katana::SampledSubgraph::FromNodeSet(
+    const katana::PropertyGraph& graph, std::vector<Node>&& node_set) {
+  const GraphTopology& topo = graph.topology();
+
+  std::sort(node_set.begin(), node_set.end());
+  node_set.erase(
+      std::unique(node_set.begin(), node_set.end()), node_set.end());
+
+  SampledSubgraph sample;
+  sample.total_nodes_ = topo.NumNodes();
+  sample.total_edges_ = topo.NumEdges();
+
+  const uint64_t num_local = node_set.size();
+  sample.nodes_.allocateInterleaved(num_local);
+  std::copy(node_set.begin(), node_set.end(), sample.nodes_.begin());
+
+  // The sample is small by construction, so a hash map for the
+  // original-to-local translation is fine.
+  std::unordered_map<Node, Node> to_local;
+  to_local.reserve(num_local);
+  for (uint64_t i = 0; i < num_local; ++i) {
+    to_local.emplace(sample.nodes_[i], static_cast<Node>(i));
+  }
+
+  sample.adj_indices_.allocateInterleaved(num_local);
+  katana::do_all(
+      katana::iterate(uint64_t{0}, num_local),
+      [&](uint64_t local) {
+        uint64_t count = 0;
+        for (auto e : topo.OutEdges(sample.nodes_[local])) {
+          if (to_local.count(topo.OutEdgeDst(e)) != 0) {
+            ++count;
+          }
+        }
+        sample.adj_indices_[local] = count;
+      },
+      katana::steal(), katana::no_stats());
+
+  katana::ParallelSTL::partial_sum(
+      sample.adj_indices_.begin(), sample.adj_indices_.end(),
+      sample.adj_indices_.begin());
+
+  const uint64_t num_sampled_edges =
+      num_local == 0 ? 0 : sample.adj_indices_[num_local - 1];
+  sample.dests_.allocateInterleaved(num_sampled_edges);
+  katana::do_all(
+      katana::iterate(uint64_t{0}, num_local),
+      [&](uint64_t local) {
+        Edge out = local == 0 ? 0 : sample.adj_indices_[local - 1];
+        for (auto e : topo.OutEdges(sample.nodes_[local])) {
+          auto it = to_local.find(topo.OutEdgeDst(e));
+          if (it != to_local.end()) {
+            sample.dests_[out++] = it->second;
+          }
+        }
+      },
+      katana::steal(), katana::no_stats());
+
+  return katana::Result<SampledSubgraph>(std::move(sample));
+}
+
+katana::Result<katana::SampledSubgraph>
+katana::SampledSubgraph::RandomNodeSample(
+    const katana::PropertyGraph& graph, uint64_t num_nodes, uint32_t seed) {
+  const uint64_t total = graph.NumNodes();
+  if (num_nodes == 0) {
+    return KATANA_ERROR(
+        ErrorCode::InvalidArgument, "sample size must be positive");
+  }
+  if (total == 0) {
+    return FromNodeSet(graph, {});
+  }
+  num_nodes = std::min(num_nodes, total);
+
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<uint64_t> dist(0, total - 1);
+  std::vector<Node> node_set;
+  node_set.reserve(num_nodes);
+  std::unordered_set<Node> seen;
+  seen.reserve(num_nodes);
+  while (seen.size() < num_nodes) {
+    Node node = static_cast<Node>(dist(gen));
+    if (seen.insert(node).second) {
+      node_set.push_back(node);
+    }
+  }
+  return FromNodeSet(graph, std::move(node_set));
+}
+
+katana::Result<katana::SampledSubgraph>
+katana::SampledSubgraph::RandomEdgeSample(
+    const katana::PropertyGraph& graph, uint64_t num_edges, uint32_t seed) {
+  const GraphTopology& topo = graph.topology();
+  const uint64_t total = topo.NumEdges();
+  if (num_edges == 0) {
+    return KATANA_ERROR(
+        ErrorCode::InvalidArgument, "sample size must be positive");
+  }
+  if (total == 0) {
+    return FromNodeSet(graph, {});
+  }
+  num_edges = std::min(num_edges, total);
+
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<uint64_t> dist(0, total - 1);
+  std::vector<Node> node_set;
+  node_set.reserve(2 * num_edges);
+  const Edge* adj = topo.AdjData();
+  for (uint64_t i = 0; i < num_edges; ++i) {
+    Edge e = dist(gen);
+    // Source of edge e: first node whose adjacency range ends past e.
+    auto src_it = std::upper_bound(adj, adj + topo.NumNodes(), e);
+    node_set.push_back(static_cast<Node>(src_it - adj));
+    node_set.push_back(topo.OutEdgeDst(e));
+  }
+  return FromNodeSet(graph, std::move(node_set));
+}
+
+katana::Result<katana::SampledSubgraph>
+katana::SampledSubgraph::NeighborhoodSample(
+    const katana::PropertyGraph& graph, uint64_t num_seeds, uint32_t depth,
+    uint32_t fanout, uint32_t seed) {
+  const GraphTopology& topo = graph.topology();
+  const uint64_t total = topo.NumNodes();
+  if (num_seeds == 0 || fanout == 0) {
+    return KATANA_ERROR(
+        ErrorCode::InvalidArgument, "num_seeds and fanout must be positive");
+  }
+  num_seeds = std::min(num_seeds, total);
+
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<uint64_t> dist(0, total - 1);
+  std::vector<Node> frontier;
+  frontier.reserve(num_seeds);
+  std::unordered_set<Node> visited;
+  while (frontier.size() < num_seeds) {
+    Node node = static_cast<Node>(dist(gen));
+    if (visited.insert(node).second) {
+      frontier.push_back(node);
+    }
+  }
+
+  std::vector<Node> next;
+  for (uint32_t hop = 0; hop < depth; ++hop) {
+    next.clear();
+    for (Node node : frontier) {
+      const uint64_t degree = topo.OutDegree(node);
+      if (degree == 0) {
+        continue;
+      }
+      if (degree <= fanout) {
+        for (auto e : topo.OutEdges(node)) {
+          Node dest = topo.OutEdgeDst(e);
+          if (visited.insert(dest).second) {
+            next.push_back(dest);
+          }
+        }
+      } else {
+        // Keep `fanout` random neighbors; duplicates just waste a draw.
+        std::uniform_int_distribution<uint64_t> pick(0, degree - 1);
+        Edge first = *topo.OutEdges(node).begin();
+        for (uint32_t i = 0; i < fanout; ++i) {
+          Node dest = topo.OutEdgeDst(first + pick(gen));
+          if (visited.insert(dest).second) {
+            next.push_back(dest);
+          }
+        }
+      }
+    }
+    std::swap(frontier, next);
+  }
+
+  std::vector<Node> node_set(visited.begin(), visited.end());
+  return FromNodeSet(graph, std::move(node_set));
+}
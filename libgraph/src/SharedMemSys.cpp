@@ -20,14 +20,18 @@
 #include "katana/SharedMemSys.h"
 
 #include "katana/CommBackend.h"
+#include "katana/CpuDispatch.h"
+#include "katana/Env.h"
 #include "katana/Experimental.h"
 #include "katana/FileStorage.h"
+#include "katana/Mem.h"
 #include "katana/Galois.h"
 #include "katana/GaloisRuntime.h"
 #include "katana/Logging.h"
 #include "katana/Plugin.h"
 #include "katana/Strings.h"
 #include "katana/TextTracer.h"
+#include "katana/ThreadPool.h"
 #include "katana/tsuba.h"
 
 namespace {
@@ -48,6 +52,21 @@ katana::SharedMemSys::SharedMemSys(std::unique_ptr<ProgressTracer> tracer)
     KATANA_LOG_FATAL("katana::InitTsuba: {}", init_good.error());
   }
 
+  // Long-running services set KATANA_PREALLOC_PAGES so the page pool (and
+  // any hugetlb reservation behind it) is populated once at startup instead
+  // of faulting during the first queries.
+  int prealloc_pages = 0;
+  if (katana::GetEnv("KATANA_PREALLOC_PAGES", &prealloc_pages) &&
+      prealloc_pages > 0) {
+    katana::Prealloc(static_cast<size_t>(prealloc_pages));
+  }
+
+  // Resolve the SIMD dispatch level once up front so kernels calling
+  // GetCpuIsaLevel from inside parallel loops never hit first-use detection;
+  // tag it on the span so performance reports say which variants ran.
+  ProgressTracer::Get().GetActiveSpan().SetTags(
+      {{"cpu_isa_level", katana::CpuIsaLevelName(katana::GetCpuIsaLevel())}});
+
   auto features_on = katana::internal::ExperimentalFeature::ReportEnabled();
   if (!features_on.empty()) {
     auto feature_string = katana::Join(features_on, ",");
@@ -65,6 +84,15 @@ katana::SharedMemSys::SharedMemSys(std::unique_ptr<ProgressTracer> tracer)
   }
 }
 
+void
+katana::SharedMemSys::Warmup(size_t prealloc_pages) {
+  auto& thread_pool = katana::GetThreadPool();
+  thread_pool.run(thread_pool.getMaxUsableThreads(), []() {});
+  if (prealloc_pages > 0) {
+    katana::EnsurePreallocated(prealloc_pages);
+  }
+}
+
 katana::SharedMemSys::~SharedMemSys() {
   if (auto fini_good = katana::FiniTsuba(); !fini_good) {
     KATANA_LOG_ERROR("katana::FiniTsuba: {}", fini_good.error());
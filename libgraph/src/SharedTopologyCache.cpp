@@ -0,0 +1,164 @@
+#include "katana/SharedTopologyCache.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <functional>
+
+#include "katana/ErrorCode.h"
+#include "katana/ParallelSTL.h"
+
+namespace {
+
+// Layout of a published segment: the adj_indices array follows the
+// header, the dests array follows adj_indices. present_flags is
+// reserved for publishing optional arrays without a format break.
+struct SegmentHeader {
+  uint64_t magic;
+  uint64_t num_nodes;
+  uint64_t num_edges;
+  uint64_t present_flags;
+};
+
+constexpr uint64_t kMagic = 0x6b6174616e61746fULL;  // "katanato"
+
+uint64_t
+SegmentSize(const SegmentHeader& header) {
+  return sizeof(SegmentHeader) +
+         header.num_nodes * sizeof(katana::GraphTopology::Edge) +
+         header.num_edges * sizeof(katana::GraphTopology::Node);
+}
+
+}  // namespace
+
+std::string
+katana::SharedTopologyCache::SegmentName(const std::string& key) {
+  // shm names must be one path component; hash the key instead of
+  // trying to escape it.
+  return fmt::format("/katana-topo-{:016x}", std::hash<std::string>{}(key));
+}
+
+katana::Result<void>
+katana::SharedTopologyCache::Publish(
+    const std::string& key, GraphTopology& topo) {
+  SegmentHeader header{};
+  header.magic = kMagic;
+  header.num_nodes = topo.NumNodes();
+  header.num_edges = topo.NumEdges();
+  uint64_t size = SegmentSize(header);
+
+  std::string name = SegmentName(key);
+  int fd = shm_open(name.c_str(), O_CREAT | O_RDWR, 0600);
+  if (fd < 0) {
+    return KATANA_ERROR(ResultErrno(), "creating shm segment {}", name);
+  }
+  if (ftruncate(fd, size) < 0) {
+    auto err = KATANA_ERROR(ResultErrno(), "sizing shm segment {}", name);
+    close(fd);
+    shm_unlink(name.c_str());
+    return err;
+  }
+  void* map = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (map == MAP_FAILED) {
+    auto err = KATANA_ERROR(ResultErrno(), "mapping shm segment {}", name);
+    shm_unlink(name.c_str());
+    return err;
+  }
+
+  auto* out = static_cast<uint8_t*>(map);
+  // Write the header last so a concurrent Attach never sees a valid
+  // magic over partially copied arrays.
+  std::memset(out, 0, sizeof(SegmentHeader));
+  uint8_t* cursor = out + sizeof(SegmentHeader);
+
+  auto copy_array = [&cursor](const auto* data, uint64_t count) {
+    using T = std::remove_cv_t<std::remove_pointer_t<decltype(data)>>;
+    auto* dst = reinterpret_cast<T*>(cursor);
+    katana::ParallelSTL::copy(data, data + count, dst);
+    cursor += count * sizeof(T);
+  };
+  copy_array(topo.AdjData(), header.num_nodes);
+  copy_array(topo.DestData(), header.num_edges);
+
+  std::memcpy(out, &header, sizeof(SegmentHeader));
+  if (munmap(map, size) < 0) {
+    return KATANA_ERROR(ResultErrno(), "unmapping shm segment {}", name);
+  }
+  return ResultSuccess();
+}
+
+katana::Result<katana::GraphTopology>
+katana::SharedTopologyCache::Attach(const std::string& key) {
+  std::string name = SegmentName(key);
+  int fd = shm_open(name.c_str(), O_RDONLY, 0);
+  if (fd < 0) {
+    return KATANA_ERROR(
+        ErrorCode::NotFound, "no published topology for {}", key);
+  }
+  struct stat buf;
+  if (fstat(fd, &buf) < 0) {
+    auto err = KATANA_ERROR(ResultErrno(), "stating shm segment {}", name);
+    close(fd);
+    return err;
+  }
+  uint64_t size = buf.st_size;
+  if (size < sizeof(SegmentHeader)) {
+    close(fd);
+    return KATANA_ERROR(
+        ErrorCode::InvalidArgument, "shm segment {} is truncated", name);
+  }
+  void* map = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (map == MAP_FAILED) {
+    return KATANA_ERROR(ResultErrno(), "mapping shm segment {}", name);
+  }
+
+  SegmentHeader header;
+  std::memcpy(&header, map, sizeof(SegmentHeader));
+  if (header.magic != kMagic || SegmentSize(header) > size) {
+    munmap(map, size);
+    return KATANA_ERROR(
+        ErrorCode::InvalidArgument,
+        "shm segment {} does not hold a published topology", name);
+  }
+
+  // The mapping backs the returned topology's arrays and is deliberately
+  // kept for the life of the process, like the per-process page cache
+  // mappings elsewhere; attachers are short-lived CLI runs.
+  auto* cursor = static_cast<uint8_t*>(map) + sizeof(SegmentHeader);
+  auto take = [&cursor](uint64_t count, auto tag) {
+    using T = decltype(tag);
+    NUMAArray<T> arr(cursor, count);
+    cursor += count * sizeof(T);
+    return arr;
+  };
+  GraphTopology::AdjIndexVec adj =
+      take(header.num_nodes, GraphTopology::Edge{});
+  GraphTopology::EdgeDestVec dests =
+      take(header.num_edges, GraphTopology::Node{});
+
+  return GraphTopology(std::move(adj), std::move(dests));
+}
+
+bool
+katana::SharedTopologyCache::Contains(const std::string& key) {
+  int fd = shm_open(SegmentName(key).c_str(), O_RDONLY, 0);
+  if (fd < 0) {
+    return false;
+  }
+  close(fd);
+  return true;
+}
+
+katana::Result<void>
+katana::SharedTopologyCache::Drop(const std::string& key) {
+  std::string name = SegmentName(key);
+  if (shm_unlink(name.c_str()) < 0) {
+    return KATANA_ERROR(ResultErrno(), "unlinking shm segment {}", name);
+  }
+  return ResultSuccess();
+}
@@ -0,0 +1,56 @@
+#include "katana/SharedTopologyRegistry.h"
+
+katana::SharedTopologyRegistry&
+katana::SharedTopologyRegistry::Get() {
+  static SharedTopologyRegistry registry;
+  return registry;
+}
+
+std::shared_ptr<katana::GraphTopology>
+katana::SharedTopologyRegistry::Intern(
+    const std::string& key, const std::function<GraphTopology()>& build) {
+  if (key.empty()) {
+    return std::make_shared<GraphTopology>(build());
+  }
+
+  {
+    std::lock_guard<std::mutex> guard(lock_);
+    auto it = entries_.find(key);
+    if (it != entries_.end()) {
+      if (std::shared_ptr<GraphTopology> live = it->second.lock()) {
+        return live;
+      }
+      entries_.erase(it);
+    }
+  }
+
+  // Build outside the lock; topology construction copies whole arrays.
+  // Two threads racing on the same key build twice and one copy wins,
+  // which costs a transient duplicate but never blocks other keys.
+  auto topo = std::make_shared<GraphTopology>(build());
+
+  std::lock_guard<std::mutex> guard(lock_);
+  auto it = entries_.find(key);
+  if (it != entries_.end()) {
+    if (std::shared_ptr<GraphTopology> live = it->second.lock()) {
+      return live;
+    }
+  }
+  entries_[key] = topo;
+  return topo;
+}
+
+size_t
+katana::SharedTopologyRegistry::NumLive() {
+  std::lock_guard<std::mutex> guard(lock_);
+  size_t live = 0;
+  for (auto it = entries_.begin(); it != entries_.end();) {
+    if (it->second.expired()) {
+      it = entries_.erase(it);
+    } else {
+      ++live;
+      ++it;
+    }
+  }
+  return live;
+}
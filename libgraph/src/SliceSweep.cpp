@@ -0,0 +1,114 @@
+#include "katana/SliceSweep.h"
+
+#include "katana/CSRTopology.h"
+#include "katana/RDGManifest.h"
+
+katana::Result<katana::SliceSweep>
+katana::SliceSweep::Make(
+    const std::string& rdg_manifest_path, Options options) {
+  katana::RDGManifest manifest = KATANA_CHECKED(
+      katana::FindManifest(KATANA_CHECKED(katana::URI::Make(rdg_manifest_path))));
+  katana::RDGHandle handle =
+      KATANA_CHECKED(katana::Open(std::move(manifest), katana::kReadOnly));
+  RDGFile file(handle);
+
+  RDGPrefix prefix = KATANA_CHECKED(RDGPrefix::Make(handle));
+
+  if (options.max_slice_edges == 0) {
+    return KATANA_ERROR(
+        ErrorCode::InvalidArgument, "max_slice_edges must be positive");
+  }
+
+  SliceSweep sweep(std::move(file), std::move(prefix), std::move(options));
+  sweep.BuildPlan();
+  return std::move(sweep);
+}
+
+uint64_t
+katana::SliceSweep::DestEntrySize() const {
+  // Version 1 CSR files store 32-bit destinations; later versions are
+  // 64-bit.
+  return prefix_.version() == 1 ? sizeof(uint32_t) : sizeof(uint64_t);
+}
+
+uint64_t
+katana::SliceSweep::DestsFileOffset(uint64_t edge) const {
+  return sizeof(CSRTopologyHeader) + num_nodes() * sizeof(uint64_t) +
+         edge * DestEntrySize();
+}
+
+void
+katana::SliceSweep::BuildPlan() {
+  const uint64_t num_nodes = prefix_.num_nodes();
+
+  // Greedily extend each slice until adding the next node would
+  // overflow the edge budget. A node whose degree alone exceeds the
+  // budget gets a slice of its own; the budget is a target, not a hard
+  // limit, because node ranges must stay contiguous.
+  uint64_t node = 0;
+  while (node < num_nodes) {
+    PlannedSlice slice{};
+    slice.node_begin = node;
+    slice.edge_begin = node > 0 ? prefix_[node - 1] : 0;
+
+    uint64_t edge_end = slice.edge_begin;
+    while (node < num_nodes) {
+      uint64_t next_end = prefix_[node];
+      if (node > slice.node_begin &&
+          next_end - slice.edge_begin > options_.max_slice_edges) {
+        break;
+      }
+      edge_end = next_end;
+      ++node;
+    }
+
+    slice.node_end = node;
+    slice.edge_end = edge_end;
+    plan_.push_back(slice);
+  }
+}
+
+katana::RDGSlice::SliceArg
+katana::SliceSweep::MakeSliceArg(const PlannedSlice& slice) const {
+  // The bound topology range covers only this slice's destination
+  // entries; adjacency offsets come from the resident prefix.
+  uint64_t topo_begin = DestsFileOffset(slice.edge_begin);
+  uint64_t topo_end = DestsFileOffset(slice.edge_end);
+  return RDGSlice::SliceArg{
+      .node_range = std::make_pair(slice.node_begin, slice.node_end),
+      .edge_range = std::make_pair(slice.edge_begin, slice.edge_end),
+      .topo_off = topo_begin,
+      .topo_size = topo_end - topo_begin,
+  };
+}
+
+katana::Result<void>
+katana::SliceSweep::Sweep(const SliceFn& fn) {
+  if (plan_.empty()) {
+    return ResultSuccess();
+  }
+
+  const bool narrow_dests = DestEntrySize() == sizeof(uint32_t);
+
+  auto next = RDGSlice::Prefetch(
+      *file_, MakeSliceArg(plan_[0]), 0, options_.node_properties,
+      options_.edge_properties);
+
+  for (size_t i = 0; i < plan_.size(); ++i) {
+    RDGSlice rdg_slice = KATANA_CHECKED(next.get());
+    if (i + 1 < plan_.size()) {
+      next = RDGSlice::Prefetch(
+          *file_, MakeSliceArg(plan_[i + 1]), 0, options_.node_properties,
+          options_.edge_properties);
+    }
+
+    const PlannedSlice& planned = plan_[i];
+    GraphSlice view(
+        &rdg_slice, &prefix_, planned.node_begin, planned.node_end,
+        planned.edge_begin, planned.edge_end,
+        DestsFileOffset(planned.edge_begin), narrow_dests);
+    KATANA_CHECKED(fn(view));
+  }
+
+  return ResultSuccess();
+}
@@ -0,0 +1,215 @@
+#include "katana/StreamingIngest.h"
+
+#include <numeric>
+
+#include "katana/ArrowInterchange.h"
+#include "katana/ErrorCode.h"
+#include "katana/Loops.h"
+#include "katana/NUMAArray.h"
+#include "katana/ParallelSTL.h"
+
+katana::Result<std::unique_ptr<katana::PropertyGraph>>
+katana::StreamingEdgeIngestor::Merge(katana::TxnContext* txn_ctx) {
+  using Node = GraphTopology::Node;
+  using Edge = GraphTopology::Edge;
+  using PropertyIndex = GraphTopology::PropertyIndex;
+
+  // Drain the staging buffers; reading an InsertBag is serial but cheap
+  // relative to the merge itself.
+  std::vector<StagedEdge> staged;
+  staged.reserve(StagedCount());
+  for (StagedEdge& e : staged_) {
+    staged.emplace_back(std::move(e));
+  }
+  staged_.clear();
+  staged_count_.store(0, std::memory_order_relaxed);
+
+  if (staged.empty()) {
+    return KATANA_ERROR(
+        katana::ErrorCode::InvalidArgument, "no staged edges to merge");
+  }
+
+  const GraphTopology& topo = pg_->topology();
+  const Node num_nodes = topo.NumNodes();
+  const Edge old_num_edges = topo.NumEdges();
+  const Edge staged_count = staged.size();
+
+  for (const StagedEdge& e : staged) {
+    if (e.src >= num_nodes || e.dst >= num_nodes) {
+      return KATANA_ERROR(
+          katana::ErrorCode::InvalidArgument,
+          "staged edge ({}, {}) references a node outside the graph ({} "
+          "nodes); streaming node addition is not supported",
+          e.src, e.dst, num_nodes);
+    }
+  }
+
+  // Deterministic edge order within the batch.
+  katana::ParallelSTL::sort(
+      staged.begin(), staged.end(),
+      [](const StagedEdge& a, const StagedEdge& b) {
+        return std::tie(a.src, a.dst) < std::tie(b.src, b.dst);
+      });
+
+  // Merged CSR: per-node old degree plus staged degree, prefix summed,
+  // old runs copied and staged edges scattered behind them. Staged edge
+  // i's property row is appended at old_num_edges + i, referenced
+  // through the edge property index indirection so existing rows are
+  // never moved.
+  GraphTopology::AdjIndexVec adj_indices;
+  adj_indices.allocateInterleaved(num_nodes);
+  katana::do_all(
+      katana::iterate(Node{0}, num_nodes),
+      [&](Node n) { adj_indices[n] = topo.OutDegree(n); });
+  katana::do_all(
+      katana::iterate(Edge{0}, staged_count),
+      [&](Edge i) { __sync_fetch_and_add(&adj_indices[staged[i].src], 1); });
+  std::partial_sum(
+      adj_indices.begin(), adj_indices.end(), adj_indices.begin());
+
+  GraphTopology::EdgeDestVec dests;
+  GraphTopology::PropIndexVec edge_prop_indices;
+  dests.allocateInterleaved(old_num_edges + staged_count);
+  edge_prop_indices.allocateInterleaved(old_num_edges + staged_count);
+
+  katana::NUMAArray<Edge> cursors;
+  cursors.allocateInterleaved(num_nodes);
+  katana::do_all(
+      katana::iterate(Node{0}, num_nodes),
+      [&](Node n) {
+        Edge pos = n == 0 ? Edge{0} : adj_indices[n - 1];
+        for (Edge e : topo.OutEdges(n)) {
+          dests[pos] = topo.OutEdgeDst(e);
+          edge_prop_indices[pos] = topo.GetEdgePropertyIndexFromOutEdge(e);
+          ++pos;
+        }
+        cursors[n] = pos;
+      },
+      katana::steal(), katana::loopname("MergeCopyExistingEdges"));
+  katana::do_all(
+      katana::iterate(Edge{0}, staged_count),
+      [&](Edge i) {
+        Edge pos = __sync_fetch_and_add(&cursors[staged[i].src], 1);
+        dests[pos] = staged[i].dst;
+        edge_prop_indices[pos] = old_num_edges + i;
+      },
+      katana::loopname("MergeScatterStagedEdges"));
+
+  GraphTopology::PropIndexVec node_prop_indices;
+  node_prop_indices.allocateInterleaved(num_nodes);
+  katana::do_all(katana::iterate(Node{0}, num_nodes), [&](Node n) {
+    node_prop_indices[n] = pg_->GetNodePropertyIndex(n);
+  });
+
+  GraphTopology merged_topo(
+      std::move(adj_indices), std::move(dests), std::move(edge_prop_indices),
+      std::move(node_prop_indices));
+
+  // Entity types: existing rows keep their types, staged edges start
+  // untyped.
+  PropertyGraph::EntityTypeIDArray node_type_ids;
+  node_type_ids.allocateInterleaved(num_nodes);
+  katana::do_all(katana::iterate(Node{0}, num_nodes), [&](Node n) {
+    node_type_ids[n] = pg_->GetTypeOfNode(n);
+  });
+  PropertyGraph::EntityTypeIDArray edge_type_ids;
+  edge_type_ids.allocateInterleaved(old_num_edges + staged_count);
+  katana::do_all(katana::iterate(Edge{0}, old_num_edges), [&](Edge e) {
+    edge_type_ids[e] =
+        pg_->GetTypeOfEdgeFromPropertyIndex(static_cast<PropertyIndex>(e));
+  });
+  katana::do_all(katana::iterate(Edge{0}, staged_count), [&](Edge i) {
+    edge_type_ids[old_num_edges + i] = kUnknownEntityType;
+  });
+
+  std::unique_ptr<PropertyGraph> merged = KATANA_CHECKED(PropertyGraph::Make(
+      std::move(merged_topo), std::move(node_type_ids),
+      std::move(edge_type_ids), EntityTypeManager(pg_->GetNodeTypeManager()),
+      EntityTypeManager(pg_->GetEdgeTypeManager())));
+
+  // Node properties pass through unchanged.
+  if (pg_->GetNumNodeProperties() > 0) {
+    std::vector<std::shared_ptr<arrow::Field>> node_fields;
+    std::vector<std::shared_ptr<arrow::ChunkedArray>> node_columns;
+    for (int32_t i = 0; i < pg_->GetNumNodeProperties(); ++i) {
+      std::shared_ptr<arrow::ChunkedArray> column = pg_->GetNodeProperty(i);
+      node_fields.emplace_back(
+          arrow::field(pg_->GetNodePropertyName(i), column->type()));
+      node_columns.emplace_back(std::move(column));
+    }
+    KATANA_CHECKED(merged->AddNodeProperties(
+        arrow::Table::Make(arrow::schema(node_fields), node_columns), txn_ctx));
+  }
+
+  // Edge properties: existing columns gain one chunk of staged values
+  // (or nulls for columns the batch does not carry); declared streamed
+  // properties missing from the graph become new columns with nulls for
+  // all pre-existing rows.
+  std::vector<std::shared_ptr<arrow::Field>> edge_fields;
+  std::vector<std::shared_ptr<arrow::ChunkedArray>> edge_columns;
+
+  auto staged_column =
+      [&](size_t prop_idx,
+          arrow::Type::type type) -> Result<std::shared_ptr<arrow::ChunkedArray>> {
+    std::vector<ImportData> values;
+    values.reserve(staged_count);
+    for (const StagedEdge& e : staged) {
+      if (prop_idx < e.values.size()) {
+        values.emplace_back(e.values[prop_idx]);
+      } else {
+        values.emplace_back(ImportData(ImportDataType::kUnsupported, false));
+      }
+    }
+    return ImportToArrow(type, values);
+  };
+
+  auto find_streamed = [&](const std::string& name) -> int64_t {
+    for (size_t j = 0; j < properties_.size(); ++j) {
+      if (properties_[j].name == name) {
+        return static_cast<int64_t>(j);
+      }
+    }
+    return -1;
+  };
+
+  for (int32_t i = 0; i < pg_->GetNumEdgeProperties(); ++i) {
+    std::string name = pg_->GetEdgePropertyName(i);
+    std::shared_ptr<arrow::ChunkedArray> old_column = pg_->GetEdgeProperty(i);
+    int64_t streamed_idx = find_streamed(name);
+    std::shared_ptr<arrow::ChunkedArray> tail =
+        streamed_idx >= 0
+            ? KATANA_CHECKED(staged_column(
+                  streamed_idx, properties_[streamed_idx].type))
+            : KATANA_CHECKED(
+                  NullChunkedArray(old_column->type(), staged_count));
+    std::vector<std::shared_ptr<arrow::Array>> chunks = old_column->chunks();
+    for (const auto& chunk : tail->chunks()) {
+      chunks.emplace_back(chunk);
+    }
+    edge_fields.emplace_back(arrow::field(name, old_column->type()));
+    edge_columns.emplace_back(
+        std::make_shared<arrow::ChunkedArray>(chunks, old_column->type()));
+  }
+  for (size_t j = 0; j < properties_.size(); ++j) {
+    if (pg_->HasEdgeProperty(properties_[j].name)) {
+      continue;
+    }
+    std::shared_ptr<arrow::ChunkedArray> tail =
+        KATANA_CHECKED(staged_column(j, properties_[j].type));
+    std::shared_ptr<arrow::ChunkedArray> head =
+        KATANA_CHECKED(NullChunkedArray(tail->type(), old_num_edges));
+    std::vector<std::shared_ptr<arrow::Array>> chunks = head->chunks();
+    for (const auto& chunk : tail->chunks()) {
+      chunks.emplace_back(chunk);
+    }
+    edge_fields.emplace_back(arrow::field(properties_[j].name, tail->type()));
+    edge_columns.emplace_back(
+        std::make_shared<arrow::ChunkedArray>(chunks, tail->type()));
+  }
+  if (!edge_fields.empty()) {
+    KATANA_CHECKED(merged->AddEdgeProperties(
+        arrow::Table::Make(arrow::schema(edge_fields), edge_columns), txn_ctx));
+  }
+
+  return merged;
+}
@@ -0,0 +1,154 @@
+#include "katana/StringScan.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iomanip>
+
+#include <arrow/api.h>
+
+#include "katana/Loops.h"
+#include "katana/PropertyViews.h"
+
+namespace {
+
+using katana::StringPredicate;
+
+/// Rows handled by one parallel task. Each task scans the contiguous
+/// character range its rows cover, so tasks never overlap in the buffer.
+constexpr int64_t kRowsPerBlock = 4096;
+
+/// Substring scan over one block's character range. memchr does the byte
+/// search across element boundaries; hits are mapped back to rows through
+/// the offsets and discarded when they straddle two elements.
+template <typename OffsetType>
+void
+ContainsBlock(
+    const uint8_t* data, const OffsetType* offsets, const arrow::Array& array,
+    int64_t row_begin, int64_t row_end, const std::string& pattern,
+    katana::DynamicBitset* out) {
+  size_t pat = pattern.size();
+  int64_t row = row_begin;
+  const uint8_t* cur = data + offsets[row_begin];
+  const uint8_t* end = data + offsets[row_end];
+  while (cur + pat <= end) {
+    size_t searchable = static_cast<size_t>(end - cur) - (pat - 1);
+    const auto* hit = static_cast<const uint8_t*>(
+        memchr(cur, pattern.front(), searchable));
+    if (hit == nullptr) {
+      return;
+    }
+    if (memcmp(hit, pattern.data(), pat) == 0) {
+      OffsetType pos = static_cast<OffsetType>(hit - data);
+      while (offsets[row + 1] <= pos) {
+        ++row;
+      }
+      if (pos + static_cast<OffsetType>(pat) <= offsets[row + 1]) {
+        if (!array.IsNull(row)) {
+          out->set(row);
+        }
+        // This row matched; resume at the next element.
+        cur = data + offsets[row + 1];
+        continue;
+      }
+    }
+    cur = hit + 1;
+  }
+}
+
+template <typename OffsetType>
+void
+ScanTyped(
+    const uint8_t* data, const OffsetType* offsets, const arrow::Array& array,
+    StringPredicate predicate, const std::string& pattern,
+    katana::DynamicBitset* out) {
+  int64_t num_rows = array.length();
+  int64_t num_blocks = (num_rows + kRowsPerBlock - 1) / kRowsPerBlock;
+  katana::do_all(
+      katana::iterate(int64_t{0}, num_blocks),
+      [&](int64_t b) {
+        int64_t row_begin = b * kRowsPerBlock;
+        int64_t row_end = std::min(row_begin + kRowsPerBlock, num_rows);
+        if (predicate == StringPredicate::kContains && !pattern.empty()) {
+          ContainsBlock(
+              data, offsets, array, row_begin, row_end, pattern, out);
+          return;
+        }
+        auto pat_len = static_cast<OffsetType>(pattern.size());
+        for (int64_t row = row_begin; row < row_end; ++row) {
+          if (array.IsNull(row)) {
+            continue;
+          }
+          OffsetType len = offsets[row + 1] - offsets[row];
+          bool match = false;
+          switch (predicate) {
+          case StringPredicate::kEquals:
+            match = len == pat_len &&
+                    memcmp(data + offsets[row], pattern.data(), len) == 0;
+            break;
+          case StringPredicate::kPrefix:
+            match = len >= pat_len &&
+                    memcmp(data + offsets[row], pattern.data(), pat_len) == 0;
+            break;
+          case StringPredicate::kContains:
+            // Only the empty pattern reaches here; it matches everything.
+            match = true;
+            break;
+          }
+          if (match) {
+            out->set(row);
+          }
+        }
+      },
+      katana::no_stats(), katana::loopname("StringPropertyScan"));
+}
+
+katana::Result<katana::DynamicBitset>
+ScanImpl(
+    const katana::PropertyGraph::ReadOnlyPropertyView& pview,
+    const std::string& property, StringPredicate predicate,
+    const std::string& pattern) {
+  arrow::Array* array =
+      KATANA_CHECKED(katana::internal::ExtractArrays(pview, {property}))[0];
+
+  katana::DynamicBitset mask;
+  mask.resize(array->length());
+
+  switch (array->type_id()) {
+  case arrow::Type::STRING: {
+    const auto* typed = static_cast<const arrow::StringArray*>(array);
+    ScanTyped<int32_t>(
+        typed->value_data()->data(), typed->raw_value_offsets(), *array,
+        predicate, pattern, &mask);
+    break;
+  }
+  case arrow::Type::LARGE_STRING: {
+    const auto* typed = static_cast<const arrow::LargeStringArray*>(array);
+    ScanTyped<int64_t>(
+        typed->value_data()->data(), typed->raw_value_offsets(), *array,
+        predicate, pattern, &mask);
+    break;
+  }
+  default:
+    return KATANA_ERROR(
+        katana::ErrorCode::TypeError, "property {} has type {}; expected string",
+        std::quoted(property), array->type()->ToString());
+  }
+
+  return mask;
+}
+
+}  // namespace
+
+katana::Result<katana::DynamicBitset>
+katana::ScanNodeStringProperty(
+    const PropertyGraph& pg, const std::string& property,
+    StringPredicate predicate, const std::string& pattern) {
+  return ScanImpl(pg.NodeReadOnlyPropertyView(), property, predicate, pattern);
+}
+
+katana::Result<katana::DynamicBitset>
+katana::ScanEdgeStringProperty(
+    const PropertyGraph& pg, const std::string& property,
+    StringPredicate predicate, const std::string& pattern) {
+  return ScanImpl(pg.EdgeReadOnlyPropertyView(), property, predicate, pattern);
+}
@@ -1,5 +1,13 @@
 #include "katana/TopologyGeneration.h"
 
+#include <numeric>
+#include <random>
+
+#include "katana/Loops.h"
+#include "katana/NUMAArray.h"
+#include "katana/ParallelSTL.h"
+#include "katana/Random.h"
+
 namespace {
 template <typename F>
 std::unique_ptr<katana::PropertyGraph>
@@ -12,6 +20,74 @@ MakeTopologyImpl(F builder_fun) {
   KATANA_LOG_ASSERT(res);
   return std::move(res.value());
 }
+
+/// Fixed generation block size; seeding each block from (seed, block)
+/// makes the output independent of the number of threads.
+constexpr size_t kEdgesPerGenBlock = size_t{1} << 16;
+
+/// Draws num_edges (src, dst) pairs with gen_edge, block-parallel, and
+/// assembles them into CSR form with a count/prefix-sum/scatter pass.
+/// gen_edge is called with a per-block generator and must be
+/// deterministic given that generator's state.
+template <typename GenEdgeFunc>
+katana::GraphTopology
+MakeRandomTopologyImpl(
+    katana::GraphTopology::Node num_nodes,
+    katana::GraphTopology::Edge num_edges, uint32_t seed,
+    GenEdgeFunc gen_edge) {
+  using Node = katana::GraphTopology::Node;
+  using Edge = katana::GraphTopology::Edge;
+
+  katana::NUMAArray<Node> srcs;
+  katana::NUMAArray<Node> dsts;
+  srcs.allocateInterleaved(num_edges);
+  dsts.allocateInterleaved(num_edges);
+
+  size_t num_blocks = (num_edges + kEdgesPerGenBlock - 1) / kEdgesPerGenBlock;
+  katana::do_all(
+      katana::iterate(size_t{0}, num_blocks),
+      [&](size_t block) {
+        std::seed_seq seq{seed, static_cast<uint32_t>(block)};
+        katana::RandGenerator rng(seq);
+        Edge end = std::min(
+            static_cast<Edge>((block + 1) * kEdgesPerGenBlock), num_edges);
+        for (Edge e = block * kEdgesPerGenBlock; e < end; ++e) {
+          auto [src, dst] = gen_edge(rng);
+          srcs[e] = src;
+          dsts[e] = dst;
+        }
+      },
+      katana::steal(), katana::loopname("GenerateRandomEdges"));
+
+  katana::GraphTopology::AdjIndexVec adj_indices;
+  adj_indices.allocateInterleaved(num_nodes);
+  katana::ParallelSTL::fill(adj_indices.begin(), adj_indices.end(), Edge{0});
+  katana::do_all(
+      katana::iterate(Edge{0}, num_edges),
+      [&](Edge e) { __sync_fetch_and_add(&adj_indices[srcs[e]], 1); },
+      katana::loopname("CountRandomDegrees"));
+
+  katana::NUMAArray<Edge> cursors;
+  cursors.allocateInterleaved(num_nodes);
+  std::partial_sum(
+      adj_indices.begin(), adj_indices.end(), adj_indices.begin());
+  katana::do_all(
+      katana::iterate(Node{0}, num_nodes), [&](Node n) {
+        cursors[n] = n == 0 ? Edge{0} : adj_indices[n - 1];
+      });
+
+  katana::GraphTopology::EdgeDestVec out_dests;
+  out_dests.allocateInterleaved(num_edges);
+  katana::do_all(
+      katana::iterate(Edge{0}, num_edges),
+      [&](Edge e) {
+        Edge idx = __sync_fetch_and_add(&cursors[srcs[e]], 1);
+        out_dests[idx] = dsts[e];
+      },
+      katana::loopname("ScatterRandomEdges"));
+
+  return katana::GraphTopology(std::move(adj_indices), std::move(out_dests));
+}
 }  // namespace
 
 namespace katana {
@@ -176,4 +252,76 @@ MakeTriangle(size_t num_rows) noexcept {
   });
 }
 
+KATANA_EXPORT GraphTopology
+MakeUniformRandomTopology(
+    GraphTopology::Node num_nodes, GraphTopology::Edge num_edges,
+    uint32_t seed) noexcept {
+  KATANA_LOG_ASSERT(num_nodes > 0);
+
+  return MakeRandomTopologyImpl(
+      num_nodes, num_edges, seed,
+      [num_nodes](RandGenerator& rng) -> std::pair<
+                                          GraphTopology::Node,
+                                          GraphTopology::Node> {
+        std::uniform_int_distribution<GraphTopology::Node> dist(
+            0, num_nodes - 1);
+        return {dist(rng), dist(rng)};
+      });
+}
+
+KATANA_EXPORT GraphTopology
+MakeRMATTopology(
+    uint32_t scale, GraphTopology::Edge num_edges, double a, double b, double c,
+    uint32_t seed) noexcept {
+  KATANA_LOG_ASSERT(scale > 0 && scale < 32);
+  KATANA_LOG_ASSERT(a >= 0 && b >= 0 && c >= 0 && a + b + c <= 1.0);
+
+  GraphTopology::Node num_nodes = GraphTopology::Node{1} << scale;
+
+  return MakeRandomTopologyImpl(
+      num_nodes, num_edges, seed,
+      [=](RandGenerator& rng) -> std::pair<
+                                  GraphTopology::Node, GraphTopology::Node> {
+        std::uniform_real_distribution<double> dist(0.0, 1.0);
+        GraphTopology::Node src = 0;
+        GraphTopology::Node dst = 0;
+        // Recursively pick a quadrant of the adjacency matrix per bit,
+        // from the most significant down.
+        for (uint32_t bit = scale; bit-- > 0;) {
+          double r = dist(rng);
+          if (r < a) {
+            // top-left: no bits set
+          } else if (r < a + b) {
+            dst |= GraphTopology::Node{1} << bit;
+          } else if (r < a + b + c) {
+            src |= GraphTopology::Node{1} << bit;
+          } else {
+            src |= GraphTopology::Node{1} << bit;
+            dst |= GraphTopology::Node{1} << bit;
+          }
+        }
+        return {src, dst};
+      });
+}
+
+KATANA_EXPORT std::unique_ptr<katana::PropertyGraph>
+MakeUniformRandomGraph(
+    GraphTopology::Node num_nodes, GraphTopology::Edge num_edges,
+    uint32_t seed) noexcept {
+  auto res = katana::PropertyGraph::Make(
+      MakeUniformRandomTopology(num_nodes, num_edges, seed));
+  KATANA_LOG_ASSERT(res);
+  return std::move(res.value());
+}
+
+KATANA_EXPORT std::unique_ptr<katana::PropertyGraph>
+MakeRMATGraph(
+    uint32_t scale, GraphTopology::Edge num_edges, double a, double b, double c,
+    uint32_t seed) noexcept {
+  auto res = katana::PropertyGraph::Make(
+      MakeRMATTopology(scale, num_edges, a, b, c, seed));
+  KATANA_LOG_ASSERT(res);
+  return std::move(res.value());
+}
+
 }  // namespace katana
@@ -0,0 +1,48 @@
+#include "katana/TopologyViewManager.h"
+
+#include "katana/MemorySupervisor.h"
+#include "katana/PropertyGraph.h"
+
+const std::string katana::TopologyViewManager::name_ = "topology-view";
+
+katana::TopologyViewManager*
+katana::TopologyViewManager::Instance() {
+  // Ownership passes to the MemorySupervisor, which lives for the process;
+  // we keep a raw pointer for registration bookkeeping.
+  static TopologyViewManager* instance = []() {
+    auto manager = std::make_unique<TopologyViewManager>();
+    auto* raw = manager.get();
+    MemorySupervisor::Get().RegisterManager(std::move(manager));
+    return raw;
+  }();
+  return instance;
+}
+
+void
+katana::TopologyViewManager::TrackGraph(PropertyGraph* pg) {
+  auto* self = Instance();
+  std::lock_guard<std::mutex> guard(self->lock_);
+  self->graphs_.insert(pg);
+}
+
+void
+katana::TopologyViewManager::UntrackGraph(PropertyGraph* pg) {
+  auto* self = Instance();
+  std::lock_guard<std::mutex> guard(self->lock_);
+  self->graphs_.erase(pg);
+}
+
+katana::count_t
+katana::TopologyViewManager::FreeStandbyMemory(count_t goal) {
+  std::lock_guard<std::mutex> guard(lock_);
+  count_t freed = 0;
+  for (auto* pg : graphs_) {
+    freed += static_cast<count_t>(pg->DropUnusedTopologies());
+    if (freed >= goal) {
+      break;
+    }
+  }
+  // View memory is not accounted as standby with the supervisor, so there
+  // is no PutStandby call here; the freed bytes simply lower RSS.
+  return std::min(freed, goal);
+}
@@ -0,0 +1,180 @@
+#include "katana/analytics/ApproximateAnalytics.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "katana/ErrorCode.h"
+#include "katana/SampledSubgraph.h"
+
+namespace {
+
+double
+ZValue(double confidence) {
+  if (confidence == 0.90) {
+    return 1.6449;
+  }
+  if (confidence == 0.99) {
+    return 2.5758;
+  }
+  return 1.9600;
+}
+
+/// Union-find over the sample; samples are small, so serial is fine.
+struct DisjointSets {
+  std::vector<uint32_t> parent;
+
+  explicit DisjointSets(uint64_t n) : parent(n) {
+    std::iota(parent.begin(), parent.end(), 0);
+  }
+
+  uint32_t Find(uint32_t x) {
+    while (parent[x] != x) {
+      parent[x] = parent[parent[x]];
+      x = parent[x];
+    }
+    return x;
+  }
+
+  void Union(uint32_t a, uint32_t b) {
+    a = Find(a);
+    b = Find(b);
+    if (a != b) {
+      parent[b] = a;
+    }
+  }
+};
+
+}  // namespace
+
+katana::analytics::ApproxStatistic
+katana::analytics::ProportionEstimate(
+    uint64_t successes, uint64_t trials, double confidence) {
+  ApproxStatistic stat;
+  stat.sample_size = trials;
+  if (trials == 0) {
+    return stat;
+  }
+  double p = static_cast<double>(successes) / trials;
+  double half_width = ZValue(confidence) * std::sqrt(p * (1.0 - p) / trials);
+  stat.estimate = p;
+  stat.ci_lower = std::max(0.0, p - half_width);
+  stat.ci_upper = std::min(1.0, p + half_width);
+  return stat;
+}
+
+katana::Result<katana::analytics::ApproxStatistic>
+katana::analytics::EstimateLargestComponentFraction(
+    const katana::PropertyGraph& graph, uint64_t sample_edges, uint32_t seed) {
+  SampledSubgraph sample = KATANA_CHECKED(
+      SampledSubgraph::RandomEdgeSample(graph, sample_edges, seed));
+  const uint64_t n = sample.NumNodes();
+  if (n == 0) {
+    return ApproxStatistic{};
+  }
+
+  DisjointSets sets(n);
+  for (auto node : sample.Nodes()) {
+    for (auto e : sample.OutEdges(node)) {
+      sets.Union(node, sample.OutEdgeDst(e));
+    }
+  }
+
+  std::vector<uint64_t> component_size(n, 0);
+  uint64_t largest = 0;
+  for (uint64_t i = 0; i < n; ++i) {
+    uint64_t size = ++component_size[sets.Find(i)];
+    largest = std::max(largest, size);
+  }
+
+  return ProportionEstimate(largest, n);
+}
+
+katana::Result<katana::analytics::ApproxStatistic>
+katana::analytics::EstimatePageRankTopMass(
+    const katana::PropertyGraph& graph, double top_fraction,
+    uint64_t sample_edges, uint32_t seed) {
+  if (top_fraction <= 0.0 || top_fraction > 1.0) {
+    return KATANA_ERROR(
+        ErrorCode::InvalidArgument, "top_fraction must be in (0, 1]");
+  }
+  SampledSubgraph sample = KATANA_CHECKED(
+      SampledSubgraph::RandomEdgeSample(graph, sample_edges, seed));
+  const uint64_t n = sample.NumNodes();
+  if (n == 0) {
+    return ApproxStatistic{};
+  }
+
+  constexpr double kDamping = 0.85;
+  constexpr uint32_t kMaxIterations = 50;
+  constexpr double kTolerance = 1e-7;
+
+  std::vector<double> rank(n, 1.0 / n);
+  std::vector<double> next(n);
+  for (uint32_t iter = 0; iter < kMaxIterations; ++iter) {
+    std::fill(next.begin(), next.end(), (1.0 - kDamping) / n);
+    double dangling = 0.0;
+    for (auto node : sample.Nodes()) {
+      uint64_t degree = sample.OutDegree(node);
+      if (degree == 0) {
+        dangling += rank[node];
+        continue;
+      }
+      double share = kDamping * rank[node] / degree;
+      for (auto e : sample.OutEdges(node)) {
+        next[sample.OutEdgeDst(e)] += share;
+      }
+    }
+    double dangling_share = kDamping * dangling / n;
+    double delta = 0.0;
+    for (uint64_t i = 0; i < n; ++i) {
+      next[i] += dangling_share;
+      delta += std::abs(next[i] - rank[i]);
+    }
+    rank.swap(next);
+    if (delta < kTolerance) {
+      break;
+    }
+  }
+
+  const uint64_t top_k = std::max<uint64_t>(
+      1, static_cast<uint64_t>(top_fraction * static_cast<double>(n)));
+  auto top_mass = [&](const std::vector<double>& ranks) {
+    std::vector<double> sorted(ranks);
+    std::nth_element(
+        sorted.begin(), sorted.begin() + (top_k - 1), sorted.end(),
+        std::greater<double>());
+    double threshold_sum = 0.0;
+    for (uint64_t i = 0; i < top_k; ++i) {
+      threshold_sum += sorted[i];
+    }
+    double total = 0.0;
+    for (double r : ranks) {
+      total += r;
+    }
+    return total == 0.0 ? 0.0 : threshold_sum / total;
+  };
+
+  ApproxStatistic stat;
+  stat.sample_size = n;
+  stat.estimate = top_mass(rank);
+
+  // Percentile bootstrap over the per-node ranks.
+  constexpr uint32_t kBootstrapRounds = 100;
+  std::mt19937 gen(seed + 1);
+  std::uniform_int_distribution<uint64_t> pick(0, n - 1);
+  std::vector<double> replicates(kBootstrapRounds);
+  std::vector<double> resampled(n);
+  for (uint32_t round = 0; round < kBootstrapRounds; ++round) {
+    for (uint64_t i = 0; i < n; ++i) {
+      resampled[i] = rank[pick(gen)];
+    }
+    replicates[round] = top_mass(resampled);
+  }
+  std::sort(replicates.begin(), replicates.end());
+  stat.ci_lower = replicates[kBootstrapRounds / 40];        // 2.5th pct
+  stat.ci_upper = replicates[kBootstrapRounds * 39 / 40];   // 97.5th pct
+  return stat;
+}
@@ -0,0 +1,219 @@
+#include "katana/analytics/Checkpoint.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "katana/FileFrame.h"
+#include "katana/JSON.h"
+#include "katana/Logging.h"
+#include "katana/Loops.h"
+#include "katana/WriteGroup.h"
+#include "katana/file.h"
+
+namespace {
+
+/// FNV-1a over a chunk. Not cryptographic; it only has to make "chunk did
+/// not change between rounds" overwhelmingly likely, and a collision merely
+/// skips one upload of a chunk that will be re-hashed next round.
+uint64_t
+HashChunk(const uint8_t* data, uint64_t size) {
+  constexpr uint64_t kOffset = 0xcbf29ce484222325ULL;
+  constexpr uint64_t kPrime = 0x100000001b3ULL;
+  uint64_t hash = kOffset;
+  for (uint64_t i = 0; i < size; ++i) {
+    hash ^= data[i];
+    hash *= kPrime;
+  }
+  return hash;
+}
+
+struct ManifestArray {
+  std::string name;
+  uint64_t num_bytes;
+  std::vector<uint64_t> chunk_hashes;
+};
+
+struct Manifest {
+  uint64_t round;
+  uint64_t chunk_size;
+  std::vector<ManifestArray> arrays;
+};
+
+void
+to_json(nlohmann::json& j, const ManifestArray& a) {
+  j = nlohmann::json{
+      {"name", a.name},
+      {"num_bytes", a.num_bytes},
+      {"chunk_hashes", a.chunk_hashes},
+  };
+}
+
+void
+from_json(const nlohmann::json& j, ManifestArray& a) {
+  j.at("name").get_to(a.name);
+  j.at("num_bytes").get_to(a.num_bytes);
+  j.at("chunk_hashes").get_to(a.chunk_hashes);
+}
+
+void
+to_json(nlohmann::json& j, const Manifest& m) {
+  j = nlohmann::json{
+      {"round", m.round},
+      {"chunk_size", m.chunk_size},
+      {"arrays", m.arrays},
+  };
+}
+
+void
+from_json(const nlohmann::json& j, Manifest& m) {
+  j.at("round").get_to(m.round);
+  j.at("chunk_size").get_to(m.chunk_size);
+  j.at("arrays").get_to(m.arrays);
+}
+
+}  // namespace
+
+katana::analytics::AlgoCheckpointer::AlgoCheckpointer(
+    std::string uri_prefix, uint64_t chunk_size)
+    : uri_prefix_(std::move(uri_prefix)), chunk_size_(chunk_size) {
+  KATANA_LOG_ASSERT(chunk_size_ > 0);
+}
+
+katana::analytics::AlgoCheckpointer::~AlgoCheckpointer() {
+  if (auto res = CommitPending(); !res) {
+    KATANA_LOG_ERROR("committing final checkpoint snapshot: {}", res.error());
+  }
+}
+
+void
+katana::analytics::AlgoCheckpointer::RegisterRawArray(
+    const std::string& name, uint8_t* data, uint64_t num_bytes) {
+  uint64_t num_chunks = (num_bytes + chunk_size_ - 1) / chunk_size_;
+  arrays_.emplace_back(RegisteredArray{
+      name, data, num_bytes, std::vector<uint64_t>(num_chunks, 0)});
+}
+
+void
+katana::analytics::AlgoCheckpointer::UnregisterAll() {
+  arrays_.clear();
+}
+
+std::string
+katana::analytics::AlgoCheckpointer::ChunkUri(
+    const std::string& name, uint64_t chunk) const {
+  return fmt::format("{}/{}.chunk{:08}", uri_prefix_, name, chunk);
+}
+
+std::string
+katana::analytics::AlgoCheckpointer::ManifestUri() const {
+  return fmt::format("{}/checkpoint.manifest", uri_prefix_);
+}
+
+katana::Result<void>
+katana::analytics::AlgoCheckpointer::CommitPending() {
+  if (!in_flight_) {
+    return katana::ResultSuccess();
+  }
+  KATANA_CHECKED(in_flight_->Finish());
+  in_flight_.reset();
+  KATANA_CHECKED(katana::FileStore(
+      ManifestUri(), pending_manifest_.data(), pending_manifest_.size()));
+  pending_manifest_.clear();
+  return katana::ResultSuccess();
+}
+
+katana::Result<void>
+katana::analytics::AlgoCheckpointer::Snapshot(uint64_t round) {
+  KATANA_CHECKED(CommitPending());
+  in_flight_ = KATANA_CHECKED(katana::WriteGroup::Make());
+
+  Manifest manifest{round, chunk_size_, {}};
+  for (RegisteredArray& array : arrays_) {
+    uint64_t num_chunks = array.chunk_hashes.size();
+    std::vector<uint64_t> hashes(num_chunks);
+
+    katana::do_all(
+        katana::iterate(uint64_t{0}, num_chunks),
+        [&](uint64_t chunk) {
+          uint64_t begin = chunk * chunk_size_;
+          uint64_t len = std::min(chunk_size_, array.num_bytes - begin);
+          hashes[chunk] = HashChunk(array.data + begin, len);
+        },
+        katana::steal(), katana::no_stats(),
+        katana::loopname("CheckpointHashChunks"));
+
+    for (uint64_t chunk = 0; chunk < num_chunks; ++chunk) {
+      if (hashes[chunk] == array.chunk_hashes[chunk]) {
+        continue;
+      }
+      uint64_t begin = chunk * chunk_size_;
+      uint64_t len = std::min(chunk_size_, array.num_bytes - begin);
+
+      // Copy the chunk into a frame so the algorithm can keep mutating the
+      // array while the upload is in flight.
+      auto ff = std::make_shared<katana::FileFrame>();
+      KATANA_CHECKED(ff->Init(len));
+      ff->Bind(ChunkUri(array.name, chunk));
+      uint8_t* dest = KATANA_CHECKED(ff->ptr<uint8_t>());
+      memcpy(dest, array.data + begin, len);
+      KATANA_CHECKED(ff->SetCursor(len));
+      in_flight_->StartStore(std::move(ff));
+    }
+
+    array.chunk_hashes = hashes;
+    manifest.arrays.emplace_back(
+        ManifestArray{array.name, array.num_bytes, std::move(hashes)});
+  }
+
+  pending_manifest_ = KATANA_CHECKED(katana::JsonDump(manifest));
+  return katana::ResultSuccess();
+}
+
+katana::Result<void>
+katana::analytics::AlgoCheckpointer::Flush() {
+  return CommitPending();
+}
+
+katana::Result<uint64_t>
+katana::analytics::AlgoCheckpointer::Restore() {
+  katana::StatBuf stat;
+  KATANA_CHECKED_CONTEXT(
+      katana::FileStat(ManifestUri(), &stat), "no checkpoint manifest at {}",
+      ManifestUri());
+
+  std::vector<char> buf(stat.size);
+  KATANA_CHECKED(katana::FileGet(ManifestUri(), buf.data(), 0, stat.size));
+  Manifest manifest = KATANA_CHECKED(JsonParse<Manifest>(buf));
+
+  if (manifest.chunk_size != chunk_size_) {
+    return KATANA_ERROR(
+        katana::ErrorCode::InvalidArgument,
+        "checkpoint chunk size {} does not match configured {}",
+        manifest.chunk_size, chunk_size_);
+  }
+
+  for (RegisteredArray& array : arrays_) {
+    auto it = std::find_if(
+        manifest.arrays.begin(), manifest.arrays.end(),
+        [&](const ManifestArray& m) { return m.name == array.name; });
+    if (it == manifest.arrays.end() || it->num_bytes != array.num_bytes) {
+      return KATANA_ERROR(
+          katana::ErrorCode::InvalidArgument,
+          "registered array {} ({} bytes) does not match checkpoint",
+          array.name, array.num_bytes);
+    }
+
+    uint64_t num_chunks = array.chunk_hashes.size();
+    for (uint64_t chunk = 0; chunk < num_chunks; ++chunk) {
+      uint64_t begin = chunk * chunk_size_;
+      uint64_t len = std::min(chunk_size_, array.num_bytes - begin);
+      KATANA_CHECKED(katana::FileGet(
+          ChunkUri(array.name, chunk), array.data + begin, 0, len));
+    }
+    // Future snapshots only upload chunks that diverge from the restored
+    // state.
+    array.chunk_hashes = it->chunk_hashes;
+  }
+
+  return manifest.round;
+}
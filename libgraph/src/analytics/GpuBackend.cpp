@@ -0,0 +1,17 @@
+#include "katana/analytics/GpuBackend.h"
+
+namespace {
+
+const katana::analytics::GpuBackend* gpu_backend = nullptr;
+
+}  // namespace
+
+void
+katana::analytics::SetGpuBackend(const GpuBackend* backend) {
+  gpu_backend = backend;
+}
+
+const katana::analytics::GpuBackend*
+katana::analytics::GetGpuBackend() {
+  return gpu_backend;
+}
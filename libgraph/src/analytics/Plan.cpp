@@ -0,0 +1,32 @@
+#include "katana/analytics/Plan.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "katana/PropertyGraph.h"
+
+std::future<katana::CopyableResult<void>>
+katana::analytics::PrefetchRequiredProperties(
+    PropertyGraph* pg, const Plan& plan) {
+  // copy the names out of the plan so the caller is free to destroy it
+  // before the future resolves
+  std::vector<std::string> node_props = plan.required_node_properties();
+  std::vector<std::string> edge_props = plan.required_edge_properties();
+  return std::async(
+      std::launch::async,
+      [pg, node_props = std::move(node_props),
+       edge_props = std::move(edge_props)]() -> katana::CopyableResult<void> {
+        for (const std::string& name : node_props) {
+          if (auto res = pg->EnsureNodePropertyLoaded(name); !res) {
+            return katana::CopyableErrorInfo{res.error()};
+          }
+        }
+        for (const std::string& name : edge_props) {
+          if (auto res = pg->EnsureEdgePropertyLoaded(name); !res) {
+            return katana::CopyableErrorInfo{res.error()};
+          }
+        }
+        return katana::CopyableResultSuccess();
+      });
+}
@@ -0,0 +1,193 @@
+#include "katana/analytics/PlanProfile.h"
+
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "katana/JSON.h"
+#include "katana/Logging.h"
+#include "katana/Timer.h"
+#include "katana/analytics/Utils.h"
+#include "katana/file.h"
+
+namespace katana::analytics {
+
+void
+to_json(nlohmann::json& j, const GraphProfile& p) {
+  j = nlohmann::json{
+      {"num_nodes", p.num_nodes},
+      {"num_edges", p.num_edges},
+      {"average_degree", p.average_degree},
+      {"median_sampled_degree", p.median_sampled_degree},
+      {"p90_sampled_degree", p.p90_sampled_degree},
+      {"is_power_law", p.is_power_law},
+  };
+}
+
+void
+from_json(const nlohmann::json& j, GraphProfile& p) {
+  j.at("num_nodes").get_to(p.num_nodes);
+  j.at("num_edges").get_to(p.num_edges);
+  j.at("average_degree").get_to(p.average_degree);
+  j.at("median_sampled_degree").get_to(p.median_sampled_degree);
+  j.at("p90_sampled_degree").get_to(p.p90_sampled_degree);
+  j.at("is_power_law").get_to(p.is_power_law);
+}
+
+}  // namespace katana::analytics
+
+namespace {
+
+constexpr const char* kProfileFileName = "plan_profile.json";
+
+struct ProfileCache {
+  std::mutex lock;
+  std::unordered_map<
+      const katana::PropertyGraph*, katana::analytics::GraphProfile>
+      profiles;
+};
+
+ProfileCache&
+Cache() {
+  static ProfileCache cache;
+  return cache;
+}
+
+std::string
+ProfileUri(const katana::PropertyGraph& graph) {
+  return graph.rdg_dir().Join(kProfileFileName).string();
+}
+
+katana::Result<katana::analytics::GraphProfile>
+LoadPersistedProfile(const std::string& uri) {
+  katana::StatBuf stat;
+  KATANA_CHECKED(katana::FileStat(uri, &stat));
+  std::vector<char> buf(stat.size);
+  KATANA_CHECKED(katana::FileGet(uri, buf.data(), 0, stat.size));
+  return katana::JsonParse<katana::analytics::GraphProfile>(buf);
+}
+
+}  // namespace
+
+katana::analytics::GraphProfile
+katana::analytics::GraphProfile::Compute(const katana::PropertyGraph& graph) {
+  GraphProfile profile;
+  profile.num_nodes = graph.NumNodes();
+  profile.num_edges = graph.NumEdges();
+  if (profile.num_nodes == 0) {
+    return profile;
+  }
+  profile.average_degree =
+      static_cast<double>(profile.num_edges) / profile.num_nodes;
+
+  if (profile.num_edges == 0) {
+    return profile;
+  }
+
+  katana::StatTimer calibration_timer("PlanProfileCalibration");
+  calibration_timer.start();
+
+  SourcePicker picker(graph);
+  uint32_t num_samples =
+      std::min<uint64_t>(1000, graph.NumNodes());
+  std::vector<uint64_t> samples(num_samples);
+  uint64_t sample_total = 0;
+  for (uint32_t trial = 0; trial < num_samples; ++trial) {
+    auto node = picker.PickNext();
+    samples[trial] = graph.topology().OutDegree(node);
+    sample_total += samples[trial];
+  }
+  std::sort(samples.begin(), samples.end());
+
+  double sample_average = static_cast<double>(sample_total) / num_samples;
+  profile.median_sampled_degree = samples[num_samples / 2];
+  profile.p90_sampled_degree = samples[num_samples * 9 / 10];
+  profile.is_power_law =
+      sample_average / 1.3 > profile.median_sampled_degree;
+
+  calibration_timer.stop();
+  return profile;
+}
+
+katana::analytics::GraphProfile
+katana::analytics::GetPlanProfile(const katana::PropertyGraph& graph) {
+  {
+    std::lock_guard<std::mutex> guard(Cache().lock);
+    auto it = Cache().profiles.find(&graph);
+    if (it != Cache().profiles.end()) {
+      return it->second;
+    }
+  }
+
+  bool has_storage = !graph.rdg_dir().empty();
+  if (has_storage) {
+    if (auto persisted = LoadPersistedProfile(ProfileUri(graph)); persisted) {
+      std::lock_guard<std::mutex> guard(Cache().lock);
+      Cache().profiles.emplace(&graph, persisted.value());
+      return persisted.value();
+    }
+  }
+
+  GraphProfile profile = GraphProfile::Compute(graph);
+
+  if (has_storage) {
+    auto serialized = katana::JsonDump(profile);
+    if (serialized) {
+      if (auto stored = katana::FileStore(
+              ProfileUri(graph), serialized.value().data(),
+              serialized.value().size());
+          !stored) {
+        KATANA_LOG_WARN(
+            "could not persist plan profile to {}: {}", ProfileUri(graph),
+            stored.error());
+      }
+    }
+  }
+
+  std::lock_guard<std::mutex> guard(Cache().lock);
+  Cache().profiles.emplace(&graph, profile);
+  return profile;
+}
+
+void
+katana::analytics::ClearPlanProfileCache() {
+  std::lock_guard<std::mutex> guard(Cache().lock);
+  Cache().profiles.clear();
+}
+
+katana::analytics::SsspPlan
+katana::analytics::AutoTuneSsspPlan(const GraphProfile& profile) {
+  if (profile.is_power_law) {
+    // Low diameter: few delta buckets suffice and the fused worklist keeps
+    // the large frontiers dense. Deeper buckets for denser graphs.
+    unsigned delta = std::clamp<unsigned>(
+        static_cast<unsigned>(std::log2(profile.average_degree + 1)), 1, 8);
+    return SsspPlan::DeltaStepFusion(delta);
+  }
+  // High-diameter graphs (roads, meshes) want the wider default delta so
+  // each bucket carries enough work to parallelize.
+  return SsspPlan::DeltaStepBarrier();
+}
+
+katana::analytics::BfsPlan
+katana::analytics::AutoTuneBfsPlan(const GraphProfile& profile) {
+  if (profile.is_power_law) {
+    // Direction optimization flips to pull when the frontier covers more
+    // than 1/alpha of the edges; denser graphs reach that sooner, so scale
+    // alpha with the average degree.
+    uint32_t alpha = std::max<uint32_t>(
+        BfsPlan::kDefaultAlpha, static_cast<uint32_t>(profile.average_degree));
+    return BfsPlan::SynchronousDirectOpt(alpha, BfsPlan::kDefaultBeta);
+  }
+  return BfsPlan::Synchronous();
+}
+
+katana::analytics::LouvainClusteringPlan
+katana::analytics::AutoTuneLouvainClusteringPlan(const GraphProfile& profile) {
+  // Vertex following collapses the degree-1 fringe before the first round;
+  // on power-law graphs that fringe is a large fraction of the nodes, on
+  // mesh-like graphs the pass only adds cost.
+  return LouvainClusteringPlan::DoAll(/*enable_vf=*/profile.is_power_law);
+}
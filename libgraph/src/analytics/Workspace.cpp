@@ -0,0 +1,70 @@
+#include "katana/analytics/Workspace.h"
+
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+struct WorkspaceKeyHash {
+  size_t operator()(const katana::analytics::internal::WorkspaceKey& key)
+      const {
+    size_t h = std::hash<const void*>()(key.graph);
+    h ^= key.type.hash_code() + 0x9e3779b9 + (h << 6) + (h >> 2);
+    h ^= std::hash<size_t>()(key.size) + 0x9e3779b9 + (h << 6) + (h >> 2);
+    return h;
+  }
+};
+
+/// How many buffers the pool keeps per key. A key's buffers are all the
+/// same size, so this bounds memory to (cap x largest working set) per
+/// (graph, type, size) while still covering a few concurrent queries.
+constexpr size_t kMaxPooledPerKey = 4;
+
+struct WorkspacePool {
+  std::mutex lock;
+  std::unordered_map<
+      katana::analytics::internal::WorkspaceKey,
+      std::vector<std::shared_ptr<void>>, WorkspaceKeyHash>
+      buffers;
+};
+
+WorkspacePool&
+Pool() {
+  static WorkspacePool pool;
+  return pool;
+}
+
+}  // namespace
+
+std::shared_ptr<void>
+katana::analytics::internal::CheckOutWorkspace(const WorkspaceKey& key) {
+  WorkspacePool& pool = Pool();
+  std::lock_guard<std::mutex> guard(pool.lock);
+  auto it = pool.buffers.find(key);
+  if (it == pool.buffers.end() || it->second.empty()) {
+    return nullptr;
+  }
+  std::shared_ptr<void> buffer = std::move(it->second.back());
+  it->second.pop_back();
+  return buffer;
+}
+
+void
+katana::analytics::internal::CheckInWorkspace(
+    const WorkspaceKey& key, std::shared_ptr<void> buffer) {
+  WorkspacePool& pool = Pool();
+  std::lock_guard<std::mutex> guard(pool.lock);
+  std::vector<std::shared_ptr<void>>& stash = pool.buffers[key];
+  if (stash.size() < kMaxPooledPerKey) {
+    stash.emplace_back(std::move(buffer));
+  }
+  // Over the cap the buffer is simply dropped here.
+}
+
+void
+katana::analytics::ClearWorkspacePool() {
+  WorkspacePool& pool = Pool();
+  std::lock_guard<std::mutex> guard(pool.lock);
+  pool.buffers.clear();
+}
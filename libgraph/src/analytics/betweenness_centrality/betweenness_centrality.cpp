@@ -43,6 +43,9 @@ katana::analytics::BetweennessCentrality(
   case BetweennessCentralityPlan::kOuter:
     return BetweennessCentralityOuter(
         pg, sources, output_property_name, plan, txn_ctx);
+  case BetweennessCentralityPlan::kAdaptiveSampling:
+    return BetweennessCentralityLevelSampled(
+        pg, output_property_name, plan, txn_ctx);
   default:
     return katana::ErrorCode::InvalidArgument;
   }
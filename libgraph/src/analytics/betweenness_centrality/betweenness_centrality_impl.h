@@ -18,4 +18,9 @@ katana::Result<void> BetweennessCentralityLevel(
     katana::analytics::BetweennessCentralityPlan plan,
     katana::TxnContext* txn_ctx);
 
+katana::Result<void> BetweennessCentralityLevelSampled(
+    katana::PropertyGraph* pg, const std::string& output_property_name,
+    katana::analytics::BetweennessCentralityPlan plan,
+    katana::TxnContext* txn_ctx);
+
 #endif
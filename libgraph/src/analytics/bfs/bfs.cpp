@@ -22,12 +22,16 @@
 #include <deque>
 #include <type_traits>
 
+#include "katana/DirectionOptimizingExecutor.h"
 #include "katana/DynamicBitset.h"
 #include "katana/ErrorCode.h"
+#include "katana/Reduction.h"
 #include "katana/Result.h"
 #include "katana/Statistics.h"
 #include "katana/TypedPropertyGraph.h"
 #include "katana/analytics/BfsSsspImplementationBase.h"
+#include "katana/analytics/GpuBackend.h"
+#include "katana/analytics/Workspace.h"
 
 using namespace katana::analytics;
 
@@ -116,28 +120,6 @@ struct OneTilePushWrap {
   }
 };
 
-template <typename WL>
-void
-WlToBitset(const WL& wl, katana::DynamicBitset* bitset) {
-  katana::do_all(
-      katana::iterate(wl), [&](const GNode& src) { bitset->set(src); },
-      katana::chunk_size<kChunkSize>(), katana::loopname("WlToBitset"));
-}
-
-template <typename G, typename WL>
-void
-BitsetToWl(const G& graph, const katana::DynamicBitset& bitset, WL* wl) {
-  wl->clear();
-  katana::do_all(
-      katana::iterate(graph),
-      [&](const GNode& src) {
-        if (bitset.test(src)) {
-          wl->push(src);
-        }
-      },
-      katana::chunk_size<kChunkSize>(), katana::loopname("BitsetToWl"));
-}
-
 template <typename T, typename P, typename R>
 void
 AsynchronousAlgo(
@@ -216,91 +198,43 @@ AsynchronousAlgo(
   }
 }
 
-template <typename P>
 void
 SynchronousDirectOpt(
     const BiDirGraphView& bidir_view, katana::NUMAArray<GNode>* node_data,
-    const GNode source, const P& pushWrap, const uint32_t alpha,
-    const uint32_t beta) {
-  using Cont = katana::InsertBag<GNode>;
-  using Loop = katana::DoAll;
-
-  katana::GAccumulator<uint32_t> work_items;
-  katana::StatTimer bitset_to_wl_timer("Bitset_To_WL_Timer");
-  katana::StatTimer wl_to_bitset_timer("WL_To_Bitset_Timer");
-
-  Loop loop;
-
-  katana::DynamicBitset front_bitset;
-  katana::DynamicBitset next_bitset;
-
-  uint32_t num_nodes = bidir_view.NumNodes();
-  uint64_t num_edges = bidir_view.NumEdges();
-
-  front_bitset.resize(num_nodes);
-  next_bitset.resize(num_nodes);
-
-  auto frontier = std::make_unique<Cont>();
-  auto next_frontier = std::make_unique<Cont>();
-
+    const GNode source, const uint32_t alpha, const uint32_t beta) {
   (*node_data)[source] = source;
 
-  pushWrap(*next_frontier, source, "parallel");
-
-  work_items += 1;
-
-  int64_t edges_to_check = num_edges;
-  int64_t scout_count = bidir_view.OutDegree(source);
-  uint64_t old_num_work_items{0};
-
-  katana::GAccumulator<uint64_t> writes_pull;
-  katana::GAccumulator<uint64_t> writes_push;
-
-  while (!next_frontier->empty()) {
-    std::swap(frontier, next_frontier);
-    next_frontier->clear();
-    if (scout_count > edges_to_check / alpha) {
-      wl_to_bitset_timer.start();
-      WlToBitset(*frontier, &front_bitset);
-      wl_to_bitset_timer.stop();
-      do {
-        old_num_work_items = work_items.reduce();
-        work_items.reset();
-
-        loop(
-            katana::iterate(bidir_view),
-            [&](const GNode& dst) {
-              GNode& ddata = (*node_data)[dst];
-              if (ddata == BfsImplementation::kDistanceInfinity) {
-                for (auto e : bidir_view.InEdges(dst)) {
-                  auto src = bidir_view.InEdgeSrc(e);
-
-                  if (front_bitset.test(src)) {
-                    // assign parents on the bfs path.
-                    ddata = src;
-                    next_bitset.set(dst);
-                    work_items += 1;
-                    break;
-                  }
+  // The frontier bookkeeping, the scout-count cost model and the
+  // per-round push/pull decision live in the executor; only the BFS
+  // operators remain here.
+  katana::DirectionOptimizingExecutor<BiDirGraphView> executor(
+      bidir_view, alpha, beta);
+  executor.ActivateSeed(source);
+
+  executor.Execute([&](katana::Direction dir) {
+    if (dir == katana::Direction::kPull) {
+      katana::do_all(
+          katana::iterate(bidir_view),
+          [&](const GNode& dst) {
+            GNode& ddata = (*node_data)[dst];
+            if (ddata == BfsImplementation::kDistanceInfinity) {
+              for (auto e : bidir_view.InEdges(dst)) {
+                auto src = bidir_view.InEdgeSrc(e);
+
+                if (executor.InFrontier(src)) {
+                  // assign parents on the bfs path.
+                  ddata = src;
+                  executor.Activate(dst);
+                  break;
                 }
               }
-            },
-            katana::steal(), katana::chunk_size<kChunkSize>(),
-            katana::loopname(std::string("SyncDO-pull").c_str()));
-        std::swap(front_bitset, next_bitset);
-        next_bitset.reset();
-      } while (work_items.reduce() >= old_num_work_items ||
-               (work_items.reduce() > num_nodes / beta));
-      bitset_to_wl_timer.start();
-      BitsetToWl(bidir_view, front_bitset, next_frontier.get());
-      bitset_to_wl_timer.stop();
-      scout_count = 1;
+            }
+          },
+          katana::steal(), katana::chunk_size<kChunkSize>(),
+          katana::loopname(std::string("SyncDO-pull").c_str()));
     } else {
-      edges_to_check -= scout_count;
-      work_items.reset();
-
-      loop(
-          katana::iterate(*frontier),
+      katana::do_all(
+          katana::iterate(executor.FrontierBag()),
           [&](const GNode& src) {
             for (auto e : bidir_view.OutEdges(src)) {
               auto dst = bidir_view.OutEdgeDst(e);
@@ -308,17 +242,15 @@ SynchronousDirectOpt(
               if (ddata == BfsImplementation::kDistanceInfinity) {
                 GNode old_parent = ddata;
                 if (__sync_bool_compare_and_swap(&ddata, old_parent, src)) {
-                  next_frontier->push(dst);
-                  work_items += bidir_view.OutDegree(dst);
+                  executor.Activate(dst);
                 }
               }
             }
           },
           katana::steal(), katana::chunk_size<kChunkSize>(),
           katana::loopname(std::string("SyncDO-push").c_str()));
-      scout_count = work_items.reduce();
     }
-  }
+  });
 }
 
 template <typename NDType, typename ValueTy>
@@ -376,25 +308,28 @@ RunAlgo(
 
   switch (algo.algorithm()) {
   case BfsPlan::kSynchronousDirectOpt: {
-    // Set up node data
-    katana::NUMAArray<GNode> node_data;
-    node_data.allocateInterleaved(graph->NumNodes());
+    // Set up node data; lease the scratch array so repeated queries against
+    // the same graph reuse warmed, NUMA-placed pages.
+    WorkspaceLease<GNode> node_data_lease(
+        bidir_view.property_graph(), graph->NumNodes());
+    katana::NUMAArray<GNode>& node_data = node_data_lease.array();
     InitNodeDataVec(BfsImplementation::kDistanceInfinity, &node_data);
 
     exec_time.start();
     SynchronousDirectOpt(
-        bidir_view, &node_data, source, NodePushWrap(), algo.alpha(),
-        algo.beta());
+        bidir_view, &node_data, source, algo.alpha(), algo.beta());
     exec_time.stop();
 
     UpdateGraphNodeData(graph, node_data);
     break;
   }
   case BfsPlan::kAsynchronous: {
-    katana::NUMAArray<GNode> node_parent;
-    katana::NUMAArray<Dist> node_dist;
-    node_parent.allocateInterleaved(graph->NumNodes());
-    node_dist.allocateInterleaved(graph->NumNodes());
+    WorkspaceLease<GNode> node_parent_lease(
+        bidir_view.property_graph(), graph->NumNodes());
+    WorkspaceLease<Dist> node_dist_lease(
+        bidir_view.property_graph(), graph->NumNodes());
+    katana::NUMAArray<GNode>& node_parent = node_parent_lease.array();
+    katana::NUMAArray<Dist>& node_dist = node_dist_lease.array();
 
     InitNodeDataVec(BfsImplementation::kDistanceInfinity, &node_parent);
     InitNodeDataVec(BfsImplementation::kDistanceInfinity, &node_dist);
@@ -447,6 +382,83 @@ BfsImpl(
   return katana::ResultSuccess();
 }
 
+/// The tag for the output property of multi-source BFS: one visited bit per
+/// batched source.
+using BfsNodeVisitedMask = katana::PODProperty<uint64_t>;
+
+/// One level-synchronous sweep from up to 64 sources at once. Bit i of a
+/// node's word in seen is set once the node has been reached from
+/// sources[i]; a node re-enters the frontier whenever a round adds new bits
+/// to its word, so its edges are rescanned only when they can still spread
+/// something new.
+void
+MultiSourceBfs(
+    const katana::GraphTopology& topo, const std::vector<GNode>& sources,
+    katana::NUMAArray<uint64_t>* seen_ptr) {
+  katana::NUMAArray<uint64_t>& seen = *seen_ptr;
+  katana::NUMAArray<uint64_t> visit;
+  katana::NUMAArray<std::atomic<uint64_t>> visit_next;
+  visit.allocateInterleaved(topo.NumNodes());
+  visit_next.allocateInterleaved(topo.NumNodes());
+
+  katana::do_all(katana::iterate(topo.Nodes()), [&](GNode n) {
+    seen[n] = 0;
+    visit[n] = 0;
+    visit_next[n].store(0, std::memory_order_relaxed);
+  });
+
+  for (size_t i = 0; i < sources.size(); ++i) {
+    uint64_t bit = uint64_t{1} << i;
+    visit[sources[i]] |= bit;
+    seen[sources[i]] |= bit;
+  }
+
+  katana::GReduceLogicalOr work_left;
+  size_t rounds = 0;
+
+  do {
+    work_left.reset();
+
+    katana::do_all(
+        katana::iterate(topo.Nodes()),
+        [&](GNode src) {
+          uint64_t word = visit[src];
+          if (word == 0) {
+            return;
+          }
+          for (auto e : topo.OutEdges(src)) {
+            GNode dest = topo.OutEdgeDst(e);
+            // seen[dest] may be stale here; it only prunes atomics, the
+            // authoritative filtering happens in the update pass below.
+            uint64_t unseen = word & ~seen[dest];
+            if (unseen != 0) {
+              visit_next[dest].fetch_or(unseen, std::memory_order_relaxed);
+            }
+          }
+        },
+        katana::steal(), katana::chunk_size<kChunkSize>(),
+        katana::loopname("MultiSourceBfsExpand"));
+
+    katana::do_all(
+        katana::iterate(topo.Nodes()),
+        [&](GNode n) {
+          uint64_t incoming =
+              visit_next[n].load(std::memory_order_relaxed) & ~seen[n];
+          visit_next[n].store(0, std::memory_order_relaxed);
+          visit[n] = incoming;
+          if (incoming != 0) {
+            seen[n] |= incoming;
+            work_left.update(true);
+          }
+        },
+        katana::loopname("MultiSourceBfsUpdate"));
+
+    ++rounds;
+  } while (work_left.reduce());
+
+  katana::ReportStatSingle("BFS", "MultiSourceRounds", rounds);
+}
+
 }  // namespace
 
 katana::Result<void>
@@ -454,6 +466,16 @@ katana::analytics::Bfs(
     PropertyGraph* pg, GNode start_node,
     const std::string& output_property_name, katana::TxnContext* txn_ctx,
     BfsPlan algo) {
+  if (algo.architecture() == kGPU) {
+    const GpuBackend* backend = GetGpuBackend();
+    if (backend != nullptr && backend->bfs != nullptr) {
+      return backend->bfs(pg, start_node, output_property_name, txn_ctx);
+    }
+    KATANA_LOG_WARN(
+        "plan requests GPU execution but no GPU backend implements BFS; "
+        "falling back to the CPU algorithm");
+  }
+
   if (auto result = pg->ConstructNodeProperties<std::tuple<BfsNodeParent>>(
           txn_ctx, {output_property_name});
       !result) {
@@ -474,6 +496,51 @@ katana::analytics::Bfs(
   return BfsImpl(&graph, bidir_view, start_node, algo);
 }
 
+katana::Result<void>
+katana::analytics::BfsMultiSource(
+    PropertyGraph* pg, const std::vector<uint32_t>& sources,
+    const std::string& output_property_name, katana::TxnContext* txn_ctx) {
+  if (sources.empty() || sources.size() > 64) {
+    return KATANA_ERROR(
+        katana::ErrorCode::InvalidArgument,
+        "multi-source BFS batches between 1 and 64 sources: got {}",
+        sources.size());
+  }
+
+  const katana::GraphTopology& topo = pg->topology();
+  for (uint32_t source : sources) {
+    if (source >= topo.NumNodes()) {
+      return KATANA_ERROR(
+          katana::ErrorCode::InvalidArgument, "source node {} is out of range",
+          source);
+    }
+  }
+
+  if (auto result = pg->ConstructNodeProperties<std::tuple<BfsNodeVisitedMask>>(
+          txn_ctx, {output_property_name});
+      !result) {
+    return result.error();
+  }
+
+  auto graph = KATANA_CHECKED((
+      katana::TypedPropertyGraph<std::tuple<BfsNodeVisitedMask>, std::tuple<>>::
+          Make(pg, {output_property_name}, {})));
+
+  katana::EnsurePreallocated(2, 3 * topo.NumNodes() * sizeof(uint64_t));
+  katana::ReportPageAllocGuard page_alloc;
+
+  katana::NUMAArray<uint64_t> seen;
+  seen.allocateInterleaved(topo.NumNodes());
+
+  MultiSourceBfs(topo, sources, &seen);
+
+  katana::do_all(katana::iterate(graph), [&](GNode n) {
+    graph.GetData<BfsNodeVisitedMask>(n) = seen[n];
+  });
+
+  return katana::ResultSuccess();
+}
+
 template <typename LevelVec>
 void
 ComputeLevels(
@@ -495,7 +562,7 @@ ComputeLevels(
 
   while (!next->empty()) {
     std::swap(curr, next);
-    next->clear();
+    next->clear_and_keep_capacity();
     ++next_level;
 
     loop(
@@ -19,9 +19,10 @@
 
 #include "katana/analytics/cdlp/cdlp.h"
 
-#include <boost/unordered_map.hpp>
-
 #include "katana/ArrowRandomAccessBuilder.h"
+#include "katana/DegreeBins.h"
+#include "katana/DirectionOptimizingExecutor.h"
+#include "katana/PerThreadStorage.h"
 #include "katana/TypedPropertyGraph.h"
 
 using namespace katana::analytics;
@@ -45,7 +46,9 @@ struct CdlpAlgo {
       graph->template GetData<NodeCommunity>(node) = node;
     });
   }
-  virtual void operator()(Graph* graph, size_t max_iterations) = 0;
+  virtual void operator()(
+      Graph* graph, const katana::DegreeBins& degree_bins,
+      size_t max_iterations) = 0;
 };
 
 template <typename GraphViewTy>
@@ -55,7 +58,9 @@ struct CdlpSynchronousAlgo : CdlpAlgo<GraphViewTy> {
   using CommunityType = typename CdlpAlgo<GraphViewTy>::CommunityType;
   using NodeCommunity = typename CdlpAlgo<GraphViewTy>::NodeCommunity;
 
-  void operator()(Graph* graph, size_t max_iterations = kMaxIterations) {
+  void operator()(
+      Graph* graph, const katana::DegreeBins& degree_bins,
+      size_t max_iterations = kMaxIterations) {
     if (max_iterations == 0)
       return;
 
@@ -65,70 +70,119 @@ struct CdlpSynchronousAlgo : CdlpAlgo<GraphViewTy> {
       NodeDataPair(GNode node, CommunityType data) : node(node), data(data) {}
     };
 
-    size_t iterations = 0;
+    // Dense per-thread label-frequency scratch. Labels are always node ids,
+    // so the table is indexed directly. Stale entries are invalidated by
+    // bumping the epoch instead of clearing the counts between nodes.
+    struct LabelScratch {
+      std::vector<size_t> freq;
+      std::vector<uint32_t> epoch;
+      uint32_t cur{0};
+    };
+
+    const uint64_t num_nodes = graph->NumNodes();
+
     katana::InsertBag<NodeDataPair> apply_bag;
+    katana::PerThreadStorage<LabelScratch> scratch;
+
+    // Only nodes whose neighborhood changed in the previous round can change
+    // community, so later rounds regather a shrinking frontier instead of the
+    // whole graph. The executor decides per round whether that frontier is
+    // walked sparsely or swept densely in node order, and every node starts
+    // active so the first round is one dense sweep.
+    katana::DirectionOptimizingExecutor<Graph> executor(*graph);
+    katana::do_all(katana::iterate(*graph), [&](const GNode& node) {
+      executor.ActivateSeed(node);
+    });
 
-    /// TODO (Yasin): in this implementation, in each iteration, all the nodes are active
-    /// for gather phase. If InsertBag does not accept duplicate items then this
-    /// can be improved to have only the affected nodes to be active in next iteration
-    while (iterations < max_iterations) {
-      // Gather Phase
-      katana::do_all(
-          katana::iterate(*graph),
-          [&](const GNode& node) {
-            const auto ndata_current_comm =
-                graph->template GetData<NodeCommunity>(node);
-            using Histogram_type = boost::unordered_map<CommunityType, size_t>;
-            Histogram_type histogram;
-            // Iterate over all neighbors (this is undirected view)
-            for (auto e : Edges(*graph, node)) {
-              auto neighbor = EdgeDst(*graph, e);
-              const auto neighbor_data =
-                  graph->template GetData<NodeCommunity>(neighbor);
-              histogram[neighbor_data]++;
-            }
-
-            // Pick the most frequent community as the new community for node
-            // pick the smallest one if more than one max frequent exist.
-            auto ndata_new_comm = ndata_current_comm;
-            size_t best_freq = 0;
-            for (const auto& [comm, freq] : histogram) {
-              if (freq > best_freq ||
-                  (freq == best_freq && comm < ndata_new_comm)) {
-                ndata_new_comm = comm;
-                best_freq = freq;
-              }
-            }
-
-            if (ndata_new_comm != ndata_current_comm)
-              apply_bag.push(NodeDataPair(node, (CommunityType)ndata_new_comm));
-          },
-          katana::loopname("CDLP_Gather"));
-
-      // No change! break!
-      if (apply_bag.empty())
-        break;
-
-      // Apply Phase
-      katana::do_all(
-          katana::iterate(apply_bag),
-          [&](const NodeDataPair node_data) {
-            GNode node = node_data.node;
-            graph->template GetData<NodeCommunity>(node) = node_data.data;
-          },
-          katana::loopname("CDLP_Apply"));
-
-      apply_bag.clear();
-      iterations += 1;
-    }
-    katana::ReportStatSingle("CDLP_Synchronous", "iterations", iterations);
+    auto gather = [&](const GNode& node) {
+      const auto ndata_current_comm =
+          graph->template GetData<NodeCommunity>(node);
+
+      LabelScratch& table = *scratch.getLocal();
+      if (table.freq.empty()) {
+        table.freq.resize(num_nodes);
+        table.epoch.resize(num_nodes, 0);
+      }
+      ++table.cur;
+      if (table.cur == 0) {
+        // Epoch counter wrapped; all stamps are stale.
+        std::fill(table.epoch.begin(), table.epoch.end(), 0);
+        table.cur = 1;
+      }
+
+      // Pick the most frequent community as the new community for node;
+      // pick the smallest one if more than one max frequent exist. The
+      // running best is maintained while counting, so one pass over the
+      // neighbors suffices.
+      auto ndata_new_comm = ndata_current_comm;
+      size_t best_freq = 0;
+      // Iterate over all neighbors (this is undirected view)
+      for (auto e : Edges(*graph, node)) {
+        auto neighbor = EdgeDst(*graph, e);
+        const auto neighbor_data =
+            graph->template GetData<NodeCommunity>(neighbor);
+        if (table.epoch[neighbor_data] != table.cur) {
+          table.epoch[neighbor_data] = table.cur;
+          table.freq[neighbor_data] = 0;
+        }
+        size_t freq = ++table.freq[neighbor_data];
+        if (freq > best_freq ||
+            (freq == best_freq && neighbor_data < ndata_new_comm)) {
+          ndata_new_comm = neighbor_data;
+          best_freq = freq;
+        }
+      }
+
+      if (ndata_new_comm != ndata_current_comm)
+        apply_bag.push(NodeDataPair(node, (CommunityType)ndata_new_comm));
+    };
+
+    executor.Execute(
+        [&](katana::Direction dir) {
+          // Gather Phase. Dense rounds sweep the nodes bin by bin so
+          // every loop gathers over similar neighborhood sizes instead
+          // of mixing degree-1 nodes with hubs.
+          if (dir == katana::Direction::kPull) {
+            katana::DoAllByDegreeBin(
+                degree_bins,
+                [&](const GNode& node, auto /*degree_bound*/) {
+                  if (executor.InFrontier(node)) {
+                    gather(node);
+                  }
+                },
+                katana::steal(), katana::loopname("CDLP_Gather"));
+          } else {
+            katana::do_all(
+                katana::iterate(executor.FrontierBag()), gather,
+                katana::steal(), katana::loopname("CDLP_Gather"));
+          }
+
+          // Apply Phase. A changed node reactivates itself and its
+          // neighbors for the next round; everything else stays settled.
+          katana::do_all(
+              katana::iterate(apply_bag),
+              [&](const NodeDataPair node_data) {
+                GNode node = node_data.node;
+                graph->template GetData<NodeCommunity>(node) = node_data.data;
+                executor.Activate(node);
+                for (auto e : Edges(*graph, node)) {
+                  executor.Activate(EdgeDst(*graph, e));
+                }
+              },
+              katana::steal(), katana::loopname("CDLP_Apply"));
+
+          apply_bag.clear();
+        },
+        max_iterations);
+    katana::ReportStatSingle(
+        "CDLP_Synchronous", "iterations", executor.rounds());
   }
 };
 
 template <typename GraphViewTy>
 struct CdlpAsynchronousAlgo : CdlpAlgo<GraphViewTy> {
   using Graph = typename CdlpAlgo<GraphViewTy>::Graph;
-  void operator()(Graph*, size_t) {}
+  void operator()(Graph*, const katana::DegreeBins&, size_t) {}
 };
 
 }  //namespace
@@ -158,10 +212,13 @@ CdlpWithWrap(
 
   algo.Initialize(&graph);
 
+  std::shared_ptr<const katana::DegreeBins> degree_bins =
+      pg->BuildOrGetDegreeBins();
+
   katana::StatTimer execTime("CDLP");
 
   execTime.start();
-  algo(&graph, max_iterations);
+  algo(&graph, *degree_bins, max_iterations);
   execTime.stop();
 
   return katana::ResultSuccess();
@@ -20,6 +20,8 @@
 #include "katana/analytics/connected_components/connected_components.h"
 
 #include "katana/ArrowRandomAccessBuilder.h"
+#include "katana/GraphHelpers.h"
+#include "katana/StripedLock.h"
 #include "katana/TypedPropertyGraph.h"
 
 using namespace katana::analytics;
@@ -138,13 +140,19 @@ struct ConnectedComponentsLabelPropAlgo {
 
               changed.update(true);
 
-              for (auto e : Edges(*graph, src)) {
-                auto dest = EdgeDst(*graph, e);
-                auto& ddata_current_comp =
-                    graph->template GetData<NodeComponent>(dest);
-                ComponentType label_new = sdata_current_comp;
-                katana::atomicMin(ddata_current_comp, label_new);
-              }
+              katana::VisitEdgesPrefetched(
+                  Edges(*graph, src),
+                  [&](const auto& e) {
+                    return &graph->template GetData<NodeComponent>(
+                        EdgeDst(*graph, e));
+                  },
+                  [&](const auto& e) {
+                    auto dest = EdgeDst(*graph, e);
+                    auto& ddata_current_comp =
+                        graph->template GetData<NodeComponent>(dest);
+                    ComponentType label_new = sdata_current_comp;
+                    katana::atomicMin(ddata_current_comp, label_new);
+                  });
             }
           },
           katana::disable_conflict_detection(), katana::steal(),
@@ -194,6 +202,9 @@ struct ConnectedComponentsSynchronousAlgo {
   void operator()(Graph* graph) {
     size_t rounds = 0;
     katana::GAccumulator<size_t> empty_merges;
+    // Serializes merges on the same (hot) root through padded stripes
+    // instead of CAS-spinning on the root's own cache line.
+    katana::StripedLock<> merge_locks;
 
     katana::InsertBag<Edge> wls[2];
     katana::InsertBag<Edge>* next_bag;
@@ -218,7 +229,7 @@ struct ConnectedComponentsSynchronousAlgo {
           katana::iterate(*current_bag),
           [&](const Edge& edge) {
             auto& sdata = graph->template GetData<NodeComponent>(edge.src);
-            if (!sdata->merge(edge.ddata))
+            if (!sdata->merge(edge.ddata, merge_locks))
               empty_merges += 1;
           },
           katana::loopname("Merge"));
@@ -300,22 +311,29 @@ struct ConnectedComponentsAsynchronousAlgo {
 
   void operator()(Graph* graph) {
     katana::GAccumulator<size_t> empty_merges;
+    katana::StripedLock<> merge_locks;
 
     katana::do_all(
         katana::iterate(*graph),
         [&](const GNode& src) {
           auto& sdata = graph->template GetData<NodeComponent>(src);
 
-          for (const auto& ii : Edges(*graph, src)) {
-            auto dest = EdgeDst(*graph, ii);
-            auto& ddata = graph->template GetData<NodeComponent>(dest);
-
-            if (src >= dest)
-              continue;
-
-            if (!sdata->merge(ddata))
-              empty_merges += 1;
-          }
+          katana::VisitEdgesPrefetched(
+              Edges(*graph, src),
+              [&](const auto& e) {
+                return &graph->template GetData<NodeComponent>(
+                    EdgeDst(*graph, e));
+              },
+              [&](const auto& ii) {
+                auto dest = EdgeDst(*graph, ii);
+                auto& ddata = graph->template GetData<NodeComponent>(dest);
+
+                if (src >= dest)
+                  return;
+
+                if (!sdata->merge(ddata, merge_locks))
+                  empty_merges += 1;
+              });
         },
         katana::loopname("CC-Asynchronous"));
 
@@ -366,6 +384,7 @@ struct ConnectedComponentsEdgeAsynchronousAlgo {
 
   void operator()(Graph* graph) {
     katana::GAccumulator<size_t> empty_merges;
+    katana::StripedLock<> merge_locks;
 
     katana::InsertBag<Edge> works;
 
@@ -390,7 +409,7 @@ struct ConnectedComponentsEdgeAsynchronousAlgo {
           if (e.first > dest)
             // continue;
             ;
-          else if (!sdata->merge(ddata)) {
+          else if (!sdata->merge(ddata, merge_locks)) {
             empty_merges += 1;
           }
         },
@@ -554,6 +573,7 @@ struct ConnectedComponentsEdgeTiledAsynchronousAlgo {
 
   void operator()(Graph* graph) {
     katana::GAccumulator<size_t> empty_merges;
+    katana::StripedLock<> merge_locks;
 
     katana::InsertBag<EdgeTile> works;
     katana::do_all(
@@ -591,7 +611,7 @@ struct ConnectedComponentsEdgeTiledAsynchronousAlgo {
               continue;
 
             auto& ddata = graph->template GetData<NodeComponent>(dest);
-            if (!sdata->merge(ddata))
+            if (!sdata->merge(ddata, merge_locks))
               empty_merges += 1;
           }
         },
@@ -0,0 +1,238 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+#include "katana/analytics/distance_oracle/distance_oracle.h"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <random>
+
+#include "katana/Statistics.h"
+#include "katana/TypedPropertyGraph.h"
+#include "katana/analytics/sssp/sssp.h"
+
+using namespace katana::analytics;
+
+namespace {
+
+std::string
+LabelPropertyName(const std::string& prefix, uint32_t landmark) {
+  return prefix + "_" + std::to_string(landmark);
+}
+
+/// Pick the landmarks according to the plan. Returned node ids are distinct.
+katana::Result<std::vector<uint32_t>>
+SelectLandmarks(katana::PropertyGraph* pg, const DistanceOraclePlan& plan) {
+  const auto& topo = pg->topology();
+  const uint64_t num_nodes = topo.NumNodes();
+  const uint32_t num_landmarks = plan.num_landmarks();
+
+  if (num_landmarks == 0 || num_landmarks > num_nodes) {
+    return KATANA_ERROR(
+        katana::ErrorCode::InvalidArgument,
+        "number of landmarks ({}) must be between 1 and the number of nodes "
+        "({})",
+        num_landmarks, num_nodes);
+  }
+
+  std::vector<uint32_t> landmarks;
+  landmarks.reserve(num_landmarks);
+
+  switch (plan.selection()) {
+  case DistanceOraclePlan::kHighestDegree: {
+    std::vector<uint32_t> nodes(num_nodes);
+    std::iota(nodes.begin(), nodes.end(), 0U);
+    std::nth_element(
+        nodes.begin(), nodes.begin() + num_landmarks - 1, nodes.end(),
+        [&](uint32_t a, uint32_t b) {
+          return topo.OutDegree(a) > topo.OutDegree(b);
+        });
+    landmarks.assign(nodes.begin(), nodes.begin() + num_landmarks);
+    break;
+  }
+  case DistanceOraclePlan::kRandom: {
+    std::mt19937 gen(num_landmarks);
+    std::uniform_int_distribution<uint64_t> pick(0, num_nodes - 1);
+    while (landmarks.size() < num_landmarks) {
+      uint32_t candidate = pick(gen);
+      if (std::find(landmarks.begin(), landmarks.end(), candidate) ==
+          landmarks.end()) {
+        landmarks.push_back(candidate);
+      }
+    }
+    break;
+  }
+  default:
+    return katana::ErrorCode::InvalidArgument;
+  }
+
+  return landmarks;
+}
+
+/// Copy one landmark's distance property into the node-major label array,
+/// mapping unreachable sentinel values to +infinity.
+template <typename Weight>
+katana::Result<void>
+CopyLabels(
+    katana::PropertyGraph* pg, const std::string& property_name,
+    uint32_t landmark, uint32_t num_landmarks,
+    katana::NUMAArray<double>* labels) {
+  using NodeDistance = katana::PODProperty<Weight>;
+  using Graph =
+      katana::TypedPropertyGraph<std::tuple<NodeDistance>, std::tuple<>>;
+  using GNode = typename Graph::Node;
+
+  // Matches kDistanceInfinity in BfsSsspImplementationBase.
+  constexpr Weight kUnreachable = std::numeric_limits<Weight>::max() / 4;
+
+  Graph graph = KATANA_CHECKED(Graph::Make(pg, {property_name}, {}));
+
+  katana::do_all(
+      katana::iterate(graph),
+      [&](const GNode& node) {
+        Weight dist = graph.template GetData<NodeDistance>(node);
+        (*labels)[node * num_landmarks + landmark] =
+            dist >= kUnreachable ? std::numeric_limits<double>::infinity()
+                                 : static_cast<double>(dist);
+      },
+      katana::no_stats());
+
+  return katana::ResultSuccess();
+}
+
+}  // namespace
+
+katana::Result<void>
+katana::analytics::BuildDistanceOracle(
+    katana::PropertyGraph* pg, const std::string& edge_weight_property_name,
+    const std::string& label_property_prefix, katana::TxnContext* txn_ctx,
+    DistanceOraclePlan plan) {
+  std::vector<uint32_t> landmarks = KATANA_CHECKED(SelectLandmarks(pg, plan));
+
+  katana::StatTimer exec_time("DistanceOracleBuild");
+  exec_time.start();
+
+  // One shortest-path sweep per landmark; Sssp creates each label property
+  // and handles the edge weight type dispatch (or unit weights when the
+  // weight property name is empty).
+  for (uint32_t i = 0; i < landmarks.size(); ++i) {
+    KATANA_CHECKED_CONTEXT(
+        Sssp(
+            pg, landmarks[i], edge_weight_property_name,
+            LabelPropertyName(label_property_prefix, i), txn_ctx),
+        "computing labels for landmark {} (node {})", i, landmarks[i]);
+  }
+
+  exec_time.stop();
+  katana::ReportStatSingle(
+      "DistanceOracleBuild", "Landmarks", landmarks.size());
+
+  return katana::ResultSuccess();
+}
+
+katana::Result<DistanceOracle>
+katana::analytics::DistanceOracle::Make(
+    katana::PropertyGraph* pg, const std::string& label_property_prefix,
+    uint32_t num_landmarks) {
+  if (num_landmarks == 0) {
+    return KATANA_ERROR(
+        katana::ErrorCode::InvalidArgument, "number of landmarks must be > 0");
+  }
+
+  const uint64_t num_nodes = pg->topology().NumNodes();
+
+  DistanceOracle oracle(num_nodes, num_landmarks);
+  oracle.labels_.allocateInterleaved(num_nodes * num_landmarks);
+
+  for (uint32_t i = 0; i < num_landmarks; ++i) {
+    std::string property_name = LabelPropertyName(label_property_prefix, i);
+    switch (
+        KATANA_CHECKED(pg->GetNodeProperty(property_name))->type()->id()) {
+    case arrow::UInt32Type::type_id:
+      KATANA_CHECKED(CopyLabels<uint32_t>(
+          pg, property_name, i, num_landmarks, &oracle.labels_));
+      break;
+    case arrow::Int32Type::type_id:
+      KATANA_CHECKED(CopyLabels<int32_t>(
+          pg, property_name, i, num_landmarks, &oracle.labels_));
+      break;
+    case arrow::UInt64Type::type_id:
+      KATANA_CHECKED(CopyLabels<uint64_t>(
+          pg, property_name, i, num_landmarks, &oracle.labels_));
+      break;
+    case arrow::Int64Type::type_id:
+      KATANA_CHECKED(CopyLabels<int64_t>(
+          pg, property_name, i, num_landmarks, &oracle.labels_));
+      break;
+    case arrow::FloatType::type_id:
+      KATANA_CHECKED(CopyLabels<float>(
+          pg, property_name, i, num_landmarks, &oracle.labels_));
+      break;
+    case arrow::DoubleType::type_id:
+      KATANA_CHECKED(CopyLabels<double>(
+          pg, property_name, i, num_landmarks, &oracle.labels_));
+      break;
+    default:
+      return KATANA_ERROR(
+          katana::ErrorCode::TypeError, "Unsupported type: {}",
+          KATANA_CHECKED(pg->GetNodeProperty(property_name))
+              ->type()
+              ->ToString());
+    }
+  }
+
+  return oracle;
+}
+
+katana::analytics::DistanceOracle::Bounds
+katana::analytics::DistanceOracle::Query(
+    uint32_t source, uint32_t destination) const {
+  KATANA_LOG_DEBUG_ASSERT(source < num_nodes_);
+  KATANA_LOG_DEBUG_ASSERT(destination < num_nodes_);
+
+  if (source == destination) {
+    return Bounds{0.0, 0.0};
+  }
+
+  constexpr double kInfinity = std::numeric_limits<double>::infinity();
+  const double* source_labels = &labels_[uint64_t{source} * num_landmarks_];
+  const double* destination_labels =
+      &labels_[uint64_t{destination} * num_landmarks_];
+
+  double lower = 0.0;
+  double upper = kInfinity;
+  for (uint32_t l = 0; l < num_landmarks_; ++l) {
+    double d_source = source_labels[l];
+    double d_destination = destination_labels[l];
+    if (d_source == kInfinity && d_destination == kInfinity) {
+      // The landmark sees neither endpoint; it tells us nothing.
+      continue;
+    }
+    if (d_source == kInfinity || d_destination == kInfinity) {
+      // The landmark reaches exactly one endpoint, so on a symmetric graph
+      // the endpoints are in different components.
+      return Bounds{kInfinity, kInfinity};
+    }
+    upper = std::min(upper, d_source + d_destination);
+    lower = std::max(lower, std::abs(d_source - d_destination));
+  }
+
+  return Bounds{lower, upper};
+}
@@ -562,6 +562,91 @@ struct EdgeTiledPrioAlgo {
   }
 };
 
+/// Deterministic hash-priority MIS over a shrinking frontier. A node joins
+/// the set when its hash (node id breaks ties) is a local minimum among the
+/// neighbors that are still undecided; losers re-enter the worklist for the
+/// next round and decided nodes drop out entirely. Everything is plain
+/// do_all rounds separated by the loop join - no conflict detection, no
+/// rollback, no per-neighbor locks. Two adjacent nodes can never both win a
+/// round because the priority order is a strict total order, and a stale
+/// read of a neighbor's flag only defers a decision to the next round.
+struct FrontierPrioAlgo {
+  struct NodeFlag : public katana::PODProperty<uint8_t> {};
+
+  using NodeData = std::tuple<NodeFlag>;
+  using EdgeData = std::tuple<>;
+
+  typedef katana::TypedPropertyGraph<NodeData, EdgeData> Graph;
+  typedef typename Graph::Node GNode;
+
+  void Initialize(Graph* graph) {
+    for (auto n : *graph) {
+      graph->GetData<NodeFlag>(n) = kUndecided;
+    }
+  }
+
+  static bool HasHigherPriority(GNode a, GNode b) {
+    unsigned int hash_a = hash(a);
+    unsigned int hash_b = hash(b);
+    return hash_a < hash_b || (hash_a == hash_b && a < b);
+  }
+
+  void operator()(Graph* graph) {
+    size_t rounds = 0;
+    auto cur = std::make_unique<katana::InsertBag<GNode>>();
+    auto next = std::make_unique<katana::InsertBag<GNode>>();
+
+    auto process = [&](const GNode& src) {
+      auto& src_flag = graph->GetData<NodeFlag>(src);
+      if (!(src_flag & kUndecided)) {
+        return;
+      }
+
+      for (auto edge : graph->OutEdges(src)) {
+        auto dest = graph->OutEdgeDst(edge);
+        if (dest == src) {  // self loop, can never be in the set
+          src_flag = kPermanentNo;
+          return;
+        }
+
+        auto dest_flag = graph->GetData<NodeFlag>(dest);
+        if (dest_flag == kPermanentYes) {
+          src_flag = kPermanentNo;
+          return;
+        }
+        if (dest_flag == kPermanentNo) {
+          continue;
+        }
+        if (HasHigherPriority(dest, src)) {
+          // An undecided neighbor outranks us; try again next round.
+          next->push(src);
+          return;
+        }
+      }
+      src_flag = kPermanentYes;
+    };
+
+    katana::do_all(
+        katana::iterate(*graph), process, katana::steal(),
+        katana::chunk_size<kChunkSize>(),
+        katana::loopname("IndependentSet-frontier"));
+    rounds += 1;
+
+    while (!next->empty()) {
+      std::swap(cur, next);
+      next->clear();
+      katana::do_all(
+          katana::iterate(*cur), process, katana::steal(),
+          katana::chunk_size<kChunkSize>(),
+          katana::loopname("IndependentSet-frontier"));
+      rounds += 1;
+    }
+
+    katana::ReportStatSingle(
+        "IndependentSet-frontierPrioAlgo", "rounds", rounds);
+  }
+};
+
 struct IsBad {
   struct NodeFlag : public katana::PODProperty<uint8_t> {};
   using NodeData = std::tuple<NodeFlag>;
@@ -634,7 +719,8 @@ Run(katana::PropertyGraph* pg, const std::string& output_property_name,
   page_alloc.Report();
 
   if (std::is_same<Algo, PrioAlgo>::value ||
-      std::is_same<Algo, EdgeTiledPrioAlgo>::value) {
+      std::is_same<Algo, EdgeTiledPrioAlgo>::value ||
+      std::is_same<Algo, FrontierPrioAlgo>::value) {
     // For these algorithms we need to translate the flags into MatchFlag/bool.
     // Check for errors as we go since it costs almost nothing.
     katana::GReduceLogicalOr has_error;
@@ -674,6 +760,8 @@ katana::analytics::IndependentSet(
     return Run<PrioAlgo>(pg, output_property_name, txn_ctx);
   case IndependentSetPlan::kEdgeTiledPriority:
     return Run<EdgeTiledPrioAlgo>(pg, output_property_name, txn_ctx);
+  case IndependentSetPlan::kPriorityFrontier:
+    return Run<FrontierPrioAlgo>(pg, output_property_name, txn_ctx);
   default:
     return katana::ErrorCode::InvalidArgument;
   }
@@ -19,6 +19,9 @@
 
 #include "katana/analytics/jaccard/jaccard.h"
 
+#include <algorithm>
+
+#include "katana/PerThreadStorage.h"
 #include "katana/Statistics.h"
 #include "katana/TypedPropertyGraph.h"
 #include "katana/analytics/Utils.h"
@@ -37,23 +40,25 @@ namespace {
 struct IntersectWithSortedEdgeList {
 private:
   const GNode base_;
-  const Graph& graph_;
+  // Indirection-free CSR view: OutEdgeDst in the merge loop below compiles
+  // down to array indexing instead of chasing the wrapper layers.
+  const katana::FlatCsrView csr_;
 
 public:
   IntersectWithSortedEdgeList(const Graph& graph, GNode base)
-      : base_(base), graph_(graph) {}
+      : base_(base), csr_(graph.flat_csr_view()) {}
 
   uint32_t operator()(GNode n2) {
     uint32_t intersection_size = 0;
     // Iterate over the edges of both n2 and base in sync, based on the
     // assumption that edges lists are sorted.
-    auto edges_n2_iter = graph_.OutEdges(n2).begin();
-    auto edges_n2_end = graph_.OutEdges(n2).end();
-    auto edges_base_iter = graph_.OutEdges(base_).begin();
-    auto edges_base_end = graph_.OutEdges(base_).end();
+    auto edges_n2_iter = csr_.OutEdges(n2).begin();
+    auto edges_n2_end = csr_.OutEdges(n2).end();
+    auto edges_base_iter = csr_.OutEdges(base_).begin();
+    auto edges_base_end = csr_.OutEdges(base_).end();
     while (edges_n2_iter != edges_n2_end && edges_base_iter != edges_base_end) {
-      auto edge_n2_dst = graph_.OutEdgeDst(*edges_n2_iter);
-      auto edge_base_dst = graph_.OutEdgeDst(*edges_base_iter);
+      auto edge_n2_dst = csr_.OutEdgeDst(*edges_n2_iter);
+      auto edge_base_dst = csr_.OutEdgeDst(*edges_base_iter);
       if (edge_n2_dst == edge_base_dst) {
         intersection_size++;
         edges_n2_iter++;
@@ -71,22 +76,22 @@ public:
 struct IntersectWithUnsortedEdgeList {
 private:
   std::unordered_set<GNode> base_neighbors;
-  const Graph& graph_;
+  const katana::FlatCsrView csr_;
 
 public:
   IntersectWithUnsortedEdgeList(const Graph& graph, GNode base)
-      : graph_(graph) {
+      : csr_(graph.flat_csr_view()) {
     // Collect all the neighbors of the base node into a hash set.
-    for (const auto& e : graph.OutEdges(base)) {
-      auto dest = graph.OutEdgeDst(e);
+    for (const auto& e : csr_.OutEdges(base)) {
+      auto dest = csr_.OutEdgeDst(e);
       base_neighbors.emplace(dest);
     }
   }
 
   uint32_t operator()(GNode n2) {
     uint32_t intersection_size = 0;
-    for (const auto& e : graph_.OutEdges(n2)) {
-      auto neighbor = graph_.OutEdgeDst(e);
+    for (const auto& e : csr_.OutEdges(n2)) {
+      auto neighbor = csr_.OutEdgeDst(e);
       if (base_neighbors.count(neighbor) > 0)
         intersection_size++;
     }
@@ -134,6 +139,15 @@ JaccardImpl(Graph& graph, size_t compare_node, JaccardPlan /*plan*/) {
   return katana::ResultSuccess();
 }
 
+//! Per-thread scratch for JaccardTopK: epoch-marked tables sized to the
+//! graph, reused across all the queries a thread runs so a query's neighbor
+//! set is never rebuilt from scratch and never needs clearing.
+struct TopKScratch {
+  std::vector<uint32_t> neighbor_epoch;
+  std::vector<uint32_t> candidate_epoch;
+  uint32_t epoch{0};
+};
+
 }  // namespace
 
 katana::Result<void>
@@ -165,6 +179,111 @@ katana::analytics::Jaccard(
   return r;
 }
 
+katana::Result<std::vector<std::vector<katana::analytics::JaccardTopKEntry>>>
+katana::analytics::JaccardTopK(
+    PropertyGraph* pg, const std::vector<uint32_t>& query_nodes, uint32_t k) {
+  if (k == 0) {
+    return KATANA_ERROR(
+        katana::ErrorCode::InvalidArgument, "k must be positive");
+  }
+
+  using PlainGraph = katana::TypedPropertyGraphView<
+      katana::PropertyGraphViews::Default, std::tuple<>, std::tuple<>>;
+  PlainGraph graph = KATANA_CHECKED(PlainGraph::Make(pg, {}, {}));
+
+  for (uint32_t query : query_nodes) {
+    if (query >= graph.NumNodes()) {
+      return KATANA_ERROR(
+          katana::ErrorCode::InvalidArgument, "query node {} is out of range",
+          query);
+    }
+  }
+
+  std::vector<std::vector<JaccardTopKEntry>> results(query_nodes.size());
+  katana::PerThreadStorage<TopKScratch> scratch;
+
+  katana::ReportPageAllocGuard page_alloc;
+  katana::StatTimer exec_time("JaccardTopK");
+  exec_time.start();
+
+  //! Min-heap on similarity, so the current kth best sits at the front.
+  auto heap_cmp = [](const JaccardTopKEntry& a, const JaccardTopKEntry& b) {
+    return a.similarity > b.similarity;
+  };
+
+  katana::do_all(
+      katana::iterate(size_t{0}, query_nodes.size()),
+      [&](size_t query_index) {
+        TopKScratch& s = *scratch.getLocal();
+        if (s.neighbor_epoch.size() < graph.NumNodes()) {
+          s.neighbor_epoch.assign(graph.NumNodes(), 0);
+          s.candidate_epoch.assign(graph.NumNodes(), 0);
+        }
+        s.epoch += 1;
+        const uint32_t epoch = s.epoch;
+
+        const uint32_t query = query_nodes[query_index];
+        const uint32_t query_degree = graph.OutDegree(query);
+        for (auto e : graph.OutEdges(query)) {
+          s.neighbor_epoch[graph.OutEdgeDst(e)] = epoch;
+        }
+
+        std::vector<JaccardTopKEntry> heap;
+        heap.reserve(k + 1);
+
+        for (auto e : graph.OutEdges(query)) {
+          auto shared = graph.OutEdgeDst(e);
+          for (auto e2 : graph.OutEdges(shared)) {
+            auto candidate = graph.OutEdgeDst(e2);
+            if (candidate == query ||
+                s.candidate_epoch[candidate] == epoch) {
+              continue;
+            }
+            s.candidate_epoch[candidate] = epoch;
+
+            const uint32_t candidate_degree = graph.OutDegree(candidate);
+            //! Degree-ratio pruning: similarity can be at most
+            //! min / max degree, so skip the intersection entirely when
+            //! that bound cannot beat the current kth score.
+            const double bound =
+                static_cast<double>(
+                    std::min(query_degree, candidate_degree)) /
+                std::max(query_degree, candidate_degree);
+            if (heap.size() == k && bound <= heap.front().similarity) {
+              continue;
+            }
+
+            uint32_t intersection_size = 0;
+            for (auto e3 : graph.OutEdges(candidate)) {
+              if (s.neighbor_epoch[graph.OutEdgeDst(e3)] == epoch) {
+                intersection_size += 1;
+              }
+            }
+            const double similarity =
+                static_cast<double>(intersection_size) /
+                (query_degree + candidate_degree - intersection_size);
+
+            if (heap.size() < k) {
+              heap.push_back(JaccardTopKEntry{candidate, similarity});
+              std::push_heap(heap.begin(), heap.end(), heap_cmp);
+            } else if (similarity > heap.front().similarity) {
+              std::pop_heap(heap.begin(), heap.end(), heap_cmp);
+              heap.back() = JaccardTopKEntry{candidate, similarity};
+              std::push_heap(heap.begin(), heap.end(), heap_cmp);
+            }
+          }
+        }
+
+        std::sort_heap(heap.begin(), heap.end(), heap_cmp);
+        results[query_index] = std::move(heap);
+      },
+      katana::steal(), katana::chunk_size<1>(),
+      katana::loopname("JaccardTopK"));
+
+  exec_time.stop();
+  return results;
+}
+
 constexpr static const double EPSILON = 1e-6;
 
 katana::Result<void>
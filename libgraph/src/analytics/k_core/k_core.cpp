@@ -20,6 +20,7 @@
 #include "katana/analytics/k_core/k_core.h"
 
 #include "katana/ArrowRandomAccessBuilder.h"
+#include "katana/DynamicBitset.h"
 #include "katana/Statistics.h"
 #include "katana/TypedPropertyGraph.h"
 
@@ -265,6 +266,146 @@ katana::analytics::KCore(
   return KCoreMarkAliveNodes(&graph_final, k_core_number);
 }
 
+//! Coreness output of the full decomposition.
+struct KCoreNodeCoreness : public katana::PODProperty<uint32_t> {};
+
+/**
+ * Peel the whole graph level by level, recording for each node the level at
+ * which it dies. Level k first sweeps the unpeeled nodes for degree <= k,
+ * then runs the usual synchronous decrement cascade; a node whose degree
+ * drops to k during the cascade also has coreness k. Each edge is handled
+ * exactly once, when its endpoint is peeled. When a level's sweep finds
+ * nothing, the level jumps straight to the minimum surviving degree instead
+ * of stepping through empty levels.
+ *
+ * @param graph Graph to operate on
+ */
+template <typename GraphTy>
+void
+DecompositionCascade(GraphTy* graph) {
+  using GNode = typename GraphTy::Node;
+  auto current = std::make_unique<katana::InsertBag<GNode>>();
+  auto next = std::make_unique<katana::InsertBag<GNode>>();
+
+  katana::DynamicBitset peeled;
+  peeled.resize(graph->NumNodes());
+
+  uint64_t remaining = graph->NumNodes();
+  uint32_t k = 0;
+
+  while (remaining > 0) {
+    //! Sweep for nodes dying at this level; track the minimum surviving
+    //! degree so empty levels can be skipped.
+    katana::GAccumulator<uint64_t> peeled_count;
+    katana::GReduceMin<uint32_t> min_surviving_degree;
+    katana::do_all(
+        katana::iterate(*graph),
+        [&](const GNode& node) {
+          if (peeled.test(node)) {
+            return;
+          }
+          const auto& node_current_degree =
+              graph->template GetData<KCoreNodeCurrentDegree>(node);
+          if (node_current_degree <= k) {
+            peeled.set(node);
+            graph->template GetData<KCoreNodeCoreness>(node) = k;
+            current->emplace(node);
+            peeled_count += 1;
+          } else {
+            min_surviving_degree.update(node_current_degree);
+          }
+        },
+        katana::loopname("KCoreDecomposition Sweep"), katana::no_stats());
+
+    if (current->empty()) {
+      //! Nothing dies at this level; jump to the next populated one.
+      k = min_surviving_degree.reduce();
+      continue;
+    }
+
+    while (!current->empty()) {
+      katana::do_all(
+          katana::iterate(*current),
+          [&](const GNode& dead_node) {
+            //! Decrement degree of all neighbors.
+            for (auto e : Edges(*graph, dead_node)) {
+              auto dest = EdgeDst(*graph, e);
+              auto& dest_current_degree =
+                  graph->template GetData<KCoreNodeCurrentDegree>(dest);
+              uint32_t old_degree = katana::atomicSub(dest_current_degree, 1u);
+
+              if (old_degree == k + 1) {
+                //! This thread was responsible for putting degree of
+                //! destination at this level; it dies with coreness k.
+                peeled.set(dest);
+                graph->template GetData<KCoreNodeCoreness>(dest) = k;
+                next->emplace(dest);
+                peeled_count += 1;
+              }
+            }
+          },
+          katana::steal(), katana::chunk_size<KCorePlan::kChunkSize>(),
+          katana::loopname("KCoreDecomposition Cascade"));
+
+      current->clear();
+      std::swap(current, next);
+    }
+
+    remaining -= peeled_count.reduce();
+    k += 1;
+  }
+  katana::ReportStatSingle(
+      "KCoreDecomposition", "MaxCoreness", k == 0 ? 0 : k - 1);
+}
+
+katana::Result<void>
+katana::analytics::KCoreDecomposition(
+    katana::PropertyGraph* pg, const std::string& output_property_name,
+    katana::TxnContext* txn_ctx, const bool& is_symmetric) {
+  katana::analytics::TemporaryPropertyGuard temporary_property{
+      pg->NodeMutablePropertyView()};
+
+  KATANA_CHECKED(
+      pg->ConstructNodeProperties<std::tuple<KCoreNodeCurrentDegree>>(
+          txn_ctx, {temporary_property.name()}));
+  KATANA_CHECKED(pg->ConstructNodeProperties<std::tuple<KCoreNodeCoreness>>(
+      txn_ctx, {output_property_name}));
+
+  using DecompositionNodeData =
+      std::tuple<KCoreNodeCurrentDegree, KCoreNodeCoreness>;
+
+  size_t approxNodeData = 4 * (pg->NumNodes() + pg->NumEdges());
+  katana::EnsurePreallocated(8, approxNodeData);
+  katana::ReportPageAllocGuard page_alloc;
+
+  katana::StatTimer exec_time("KCoreDecomposition");
+
+  if (is_symmetric) {
+    using Graph = katana::TypedPropertyGraphView<
+        katana::PropertyGraphViews::Default, DecompositionNodeData, EdgeData>;
+    Graph graph = KATANA_CHECKED(Graph::Make(
+        pg, {temporary_property.name(), output_property_name}, {}));
+
+    DegreeCounting(&graph);
+    exec_time.start();
+    DecompositionCascade(&graph);
+    exec_time.stop();
+  } else {
+    using Graph = katana::TypedPropertyGraphView<
+        katana::PropertyGraphViews::Undirected, DecompositionNodeData,
+        EdgeData>;
+    Graph graph = KATANA_CHECKED(Graph::Make(
+        pg, {temporary_property.name(), output_property_name}, {}));
+
+    DegreeCounting(&graph);
+    exec_time.start();
+    DecompositionCascade(&graph);
+    exec_time.stop();
+  }
+
+  return katana::ResultSuccess();
+}
+
 // Doxygen doesn't correctly handle implementation annotations that do not
 // appear in the declaration.
 /// \cond DO_NOT_DOCUMENT
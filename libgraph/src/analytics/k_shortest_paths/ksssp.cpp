@@ -19,7 +19,12 @@
 
 #include "katana/analytics/k_shortest_paths/ksssp.h"
 
+#include <functional>
+#include <queue>
+#include <type_traits>
+
 #include "katana/AtomicHelpers.h"
+#include "katana/NUMAArray.h"
 #include "katana/Reduction.h"
 #include "katana/Statistics.h"
 #include "katana/TypedPropertyGraph.h"
@@ -49,6 +54,19 @@ using NodeData = std::tuple<NodeCount, NodeMax<Weight>>;
 template <typename Weight>
 using EdgeData = std::tuple<EdgeWeight<Weight>>;
 
+/// Edge weight load specialized at compile time. The kUniform = true
+/// instantiation is used for unweighted runs: the typed view carries no
+/// weight column and every load folds to the constant 1.
+template <bool kUniform, typename Weight, typename GraphTy, typename E>
+Weight
+LoadEdgeWeight([[maybe_unused]] GraphTy* graph, [[maybe_unused]] const E& e) {
+  if constexpr (kUniform) {
+    return Weight{1};
+  } else {
+    return graph->template GetEdgeData<EdgeWeight<Weight>>(e);
+  }
+}
+
 constexpr static const bool kTrackWork = false;
 constexpr static const unsigned kChunkSize = 64U;
 
@@ -177,6 +195,59 @@ CheckReachabilitySync(
   return true;
 }
 
+/**
+ * Runs one delta-step sweep from the report node and records every node's
+ * distance to it. The views traversed here are symmetric, so these distances
+ * are exact lower bounds on the length of any continuation of a partial path:
+ * the main search can drop an extension whose weight plus its bound cannot
+ * beat the k paths already recorded at report.
+ *
+ * @param graph typed graph
+ * @param report Final node to look for
+ * @param step_shift Shift value for deltastep
+ * @param min_dist Output distance of each node to report
+ */
+template <typename GraphTy, typename Weight, bool kUniform = false>
+void
+ComputeReverseOracle(
+    GraphTy* graph, const typename GraphTy::Node& report, uint32_t step_shift,
+    katana::NUMAArray<std::atomic<Weight>>* min_dist) {
+  using GNode = typename GraphTy::Node;
+
+  using SSSP = BfsSsspImplementationBase<GraphTy, Weight, true>;
+  using UpdateRequest = typename SSSP::UpdateRequest;
+  using UpdateRequestIndexer = typename SSSP::UpdateRequestIndexer;
+
+  using OBIM = katana::OrderedByIntegerMetric<UpdateRequestIndexer, PSchunk>;
+
+  katana::do_all(katana::iterate(*graph), [&](GNode n) {
+    (*min_dist)[n] = SSSP::kDistanceInfinity;
+  });
+  (*min_dist)[report] = 0;
+
+  katana::InsertBag<UpdateRequest> init_bag;
+  init_bag.push(UpdateRequest{report, 0});
+
+  katana::for_each(
+      katana::iterate(init_bag),
+      [&](const UpdateRequest& req, auto& ctx) {
+        if ((*min_dist)[req.src].load(std::memory_order_relaxed) < req.dist) {
+          return;
+        }
+        for (auto edge : Edges(*graph, req.src)) {
+          GNode dst = EdgeDst(*graph, edge);
+          Weight ew = LoadEdgeWeight<kUniform, Weight>(graph, edge);
+          const Weight new_dist = req.dist + ew;
+          if (katana::atomicMin((*min_dist)[dst], new_dist) > new_dist) {
+            ctx.push(UpdateRequest{dst, new_dist});
+          }
+        }
+      },
+      katana::wl<OBIM>(UpdateRequestIndexer{step_shift}),
+      katana::disable_conflict_detection(),
+      katana::loopname("kSSSPReverseOracle"));
+}
+
 /**
  * Checks if source node can reach report
  * for asynchronous graphs
@@ -191,10 +262,11 @@ CheckReachabilitySync(
  * @param path_alloc Allocates paths in graph
  * @param num_paths Number of paths to look for
  * @param step_shift Shift value for deltastep
+ * @param lower_bounds Distances to report for pruning, may be null
  */
 template <
     typename GraphTy, typename Weight, typename Item, typename OBIMTy,
-    typename PushWrap, typename EdgeRange>
+    bool kUniform = false, typename PushWrap, typename EdgeRange>
 void
 DeltaStepAlgo(
     GraphTy* graph, const typename GraphTy::Node& source,
@@ -202,7 +274,8 @@ DeltaStepAlgo(
     const EdgeRange& edge_range,
     katana::InsertBag<std::pair<Weight, Path*>>* report_paths_bag,
     katana::InsertBag<Path*>* path_pointers, PathAlloc& path_alloc,
-    size_t num_paths, uint32_t step_shift) {
+    size_t num_paths, uint32_t step_shift,
+    const katana::NUMAArray<std::atomic<Weight>>* lower_bounds) {
   using GNode = typename GraphTy::Node;
 
   using kSSSP = katana::analytics::KSsspImplementationBase<
@@ -237,12 +310,26 @@ DeltaStepAlgo(
           auto& ddata_count = graph->template GetData<NodeCount>(dst);
           auto& ddata_max = graph->template GetData<NodeMax<Weight>>(dst);
 
-          Weight ew = graph->template GetEdgeData<EdgeWeight<Weight>>(ii);
+          Weight ew = LoadEdgeWeight<kUniform, Weight>(graph, ii);
           const Weight new_dist = item.distance + ew;
 
           if ((ddata_count >= num_paths) && (ddata_max <= new_dist))
             continue;
 
+          // report_bound is the best weight any completion of this extension
+          // can reach; with the oracle, extensions that cannot beat the k
+          // paths already recorded at report are dropped before they
+          // allocate a path.
+          Weight report_bound = new_dist;
+          if (lower_bounds != nullptr) {
+            report_bound +=
+                (*lower_bounds)[dst].load(std::memory_order_relaxed);
+            if ((graph->template GetData<NodeCount>(report) >= num_paths) &&
+                (graph->template GetData<NodeMax<Weight>>(report) <=
+                 report_bound))
+              continue;
+          }
+
           Path* path = path_alloc.NewPath();
           path->parent = item.src;
           path->last = item.path;
@@ -261,7 +348,8 @@ DeltaStepAlgo(
           bool should_add =
               (graph->template GetData<NodeCount>(report) < num_paths) ||
               ((graph->template GetData<NodeCount>(report) >= num_paths) &&
-               (graph->template GetData<NodeMax<Weight>>(report) > new_dist));
+               (graph->template GetData<NodeMax<Weight>>(report) >
+                report_bound));
 
           if (should_add) {
             const Path* const_path = path;
@@ -280,6 +368,189 @@ DeltaStepAlgo(
   }
 }
 
+/// Edge weight load for an in-edge of a BiDirectional view; the in-edge
+/// id maps back to the local out-edge whose property index is valid.
+template <bool kUniform, typename Weight, typename GraphTy, typename E>
+Weight
+LoadInEdgeWeight([[maybe_unused]] GraphTy* graph, [[maybe_unused]] const E& e) {
+  if constexpr (kUniform) {
+    return Weight{1};
+  } else {
+    return graph->template GetEdgeData<EdgeWeight<Weight>>(
+        graph->GetLocalEdgeIDFromInEdge(e));
+  }
+}
+
+/**
+ * Point-to-point shortest path via bidirectional search with early
+ * termination: the forward frontier from source and the backward frontier
+ * toward report expand alternately (cheapest top first) and the search
+ * stops as soon as no unsettled pair can beat the best meeting point
+ * found. Point queries are latency-bound and the two frontiers settle a
+ * small fraction of the graph, so the expansion is serial.
+ *
+ * @param graph typed graph; needs InEdges when kUseInEdges
+ * @param start_node Beginning node in graph
+ * @param report_node Final node to look for
+ */
+template <typename GraphTy, typename Weight, bool kUniform, bool kUseInEdges>
+katana::Result<void>
+BidirectionalDijkstra(GraphTy graph, size_t start_node, size_t report_node) {
+  using GNode = typename GraphTy::Node;
+
+  constexpr Weight kInfinity = std::numeric_limits<Weight>::max();
+
+  auto it = graph.begin();
+  std::advance(it, start_node);
+  GNode source = *it;
+  it = graph.begin();
+  std::advance(it, report_node);
+  GNode report = *it;
+
+  katana::StatTimer exec_time("kSSSP");
+  exec_time.start();
+
+  if (source == report) {
+    exec_time.stop();
+    katana::gPrint("Node ", report, " has these k paths:\n");
+    katana::gPrint(" ", source, "\n");
+    katana::gPrint("Weight: ", Weight{0}, "\n");
+    return katana::ResultSuccess();
+  }
+
+  using HeapItem = std::pair<Weight, GNode>;
+  using Heap = std::priority_queue<
+      HeapItem, std::vector<HeapItem>, std::greater<HeapItem>>;
+
+  struct Side {
+    std::vector<Weight> dist;
+    std::vector<GNode> parent;
+    std::vector<uint8_t> settled;
+    Heap heap;
+  };
+
+  const size_t num_nodes = graph.size();
+  Side fwd;
+  Side bwd;
+  for (Side* side : {&fwd, &bwd}) {
+    side->dist.assign(num_nodes, kInfinity);
+    side->parent.assign(num_nodes, GNode{0});
+    side->settled.assign(num_nodes, 0);
+  }
+  fwd.dist[source] = 0;
+  fwd.heap.push(HeapItem{0, source});
+  bwd.dist[report] = 0;
+  bwd.heap.push(HeapItem{0, report});
+
+  Weight best = kInfinity;
+  GNode meet{0};
+  bool found = false;
+  size_t settled_count = 0;
+
+  // Relaxations are written to avoid overflowing Weight: a candidate
+  // meeting length is compared against best without forming the sum
+  // unless it improves.
+  auto relax = [&](Side& self, const Side& other, GNode src_n, Weight d,
+                   GNode dst_n, Weight ew) {
+    if (ew >= kInfinity - d) {
+      return;
+    }
+    const Weight new_dist = d + ew;
+    if (new_dist < self.dist[dst_n]) {
+      self.dist[dst_n] = new_dist;
+      self.parent[dst_n] = src_n;
+      self.heap.push(HeapItem{new_dist, dst_n});
+    }
+    if (self.dist[dst_n] < best && other.dist[dst_n] != kInfinity &&
+        other.dist[dst_n] < best - self.dist[dst_n]) {
+      best = self.dist[dst_n] + other.dist[dst_n];
+      meet = dst_n;
+      found = true;
+    }
+  };
+
+  auto expand_forward = [&]() {
+    auto [d, u] = fwd.heap.top();
+    fwd.heap.pop();
+    if (fwd.settled[u]) {
+      return;
+    }
+    fwd.settled[u] = 1;
+    ++settled_count;
+    for (auto e : Edges(graph, u)) {
+      GNode v = EdgeDst(graph, e);
+      relax(fwd, bwd, u, d, v, LoadEdgeWeight<kUniform, Weight>(&graph, e));
+    }
+  };
+
+  auto expand_backward = [&]() {
+    auto [d, u] = bwd.heap.top();
+    bwd.heap.pop();
+    if (bwd.settled[u]) {
+      return;
+    }
+    bwd.settled[u] = 1;
+    ++settled_count;
+    if constexpr (kUseInEdges) {
+      for (auto e : graph.InEdges(u)) {
+        GNode v = graph.InEdgeSrc(e);
+        relax(bwd, fwd, u, d, v, LoadInEdgeWeight<kUniform, Weight>(&graph, e));
+      }
+    } else {
+      // Symmetric view: the out-adjacency is its own transpose.
+      for (auto e : Edges(graph, u)) {
+        GNode v = EdgeDst(graph, e);
+        relax(bwd, fwd, u, d, v, LoadEdgeWeight<kUniform, Weight>(&graph, e));
+      }
+    }
+  };
+
+  while (!fwd.heap.empty() && !bwd.heap.empty()) {
+    const Weight top_f = fwd.heap.top().first;
+    const Weight top_b = bwd.heap.top().first;
+    // Classic meet condition: every still-improvable path costs at least
+    // top_f + top_b once both frontiers have settled their tops.
+    if (found && (top_b >= best || top_f >= best - top_b)) {
+      break;
+    }
+    if (top_f <= top_b) {
+      expand_forward();
+    } else {
+      expand_backward();
+    }
+  }
+
+  exec_time.stop();
+  katana::ReportStatSingle("kSSSP", "BidirectionalSettledNodes", settled_count);
+
+  if (!found) {
+    // Matches the other algorithms' behavior for unreachable pairs.
+    return katana::ResultSuccess();
+  }
+
+  std::vector<GNode> path;
+  for (GNode n = meet;; n = fwd.parent[n]) {
+    path.push_back(n);
+    if (n == source) {
+      break;
+    }
+  }
+  std::reverse(path.begin(), path.end());
+  for (GNode n = meet; n != report;) {
+    n = bwd.parent[n];
+    path.push_back(n);
+  }
+
+  katana::gPrint("Node ", report, " has these k paths:\n");
+  for (GNode n : path) {
+    katana::gPrint(" ", n);
+  }
+  katana::gPrint("\n");
+  katana::gPrint("Weight: ", best, "\n");
+
+  return katana::ResultSuccess();
+}
+
 /**
  * Prints all paths recursively
  *
@@ -303,7 +574,7 @@ PrintPath(const Path* path) {
  * @param num_paths Number of paths to look for
  * @param plan Algorithm to get path
  */
-template <typename GraphTy, typename Weight>
+template <typename GraphTy, typename Weight, bool kUniform = false>
 katana::Result<void>
 KssspImpl(
     GraphTy graph, size_t start_node, size_t report_node, size_t num_paths,
@@ -366,28 +637,43 @@ KssspImpl(
     std::abort();
   }
 
+  // The reverse oracle is computed once and shared by every deviation the
+  // main search explores; its single extra sweep amortizes over num_paths.
+  katana::NUMAArray<std::atomic<Weight>> reverse_dist;
+  const katana::NUMAArray<std::atomic<Weight>>* lower_bounds = nullptr;
+  if (reachable && plan.reverse_oracle()) {
+    katana::StatTimer oracle_time("kSSSPReverseOracle");
+    oracle_time.start();
+    reverse_dist.allocateInterleaved(graph.size());
+    ComputeReverseOracle<GraphTy, Weight, kUniform>(
+        &graph, report, plan.delta(), &reverse_dist);
+    oracle_time.stop();
+    lower_bounds = &reverse_dist;
+  }
+
   PathAlloc path_alloc;
 
   if (reachable) {
     switch (plan.algorithm()) {
     case KssspPlan::kDeltaTile:
-      DeltaStepAlgo<GraphTy, Weight, kSSSPSrcEdgeTile, OBIM>(
+      DeltaStepAlgo<GraphTy, Weight, kSSSPSrcEdgeTile, OBIM, kUniform>(
           &graph, source, report, kSSSPSrcEdgeTilePushWrap{&graph},
           kSSSPTileRangeFn(), &paths, &path_pointers, path_alloc, num_paths,
-          plan.delta());
+          plan.delta(), lower_bounds);
       break;
     case KssspPlan::kDeltaStep:
-      DeltaStepAlgo<GraphTy, Weight, kSSSPUpdateRequest, OBIM>(
+      DeltaStepAlgo<GraphTy, Weight, kSSSPUpdateRequest, OBIM, kUniform>(
           &graph, source, report, kSSSPReqPushWrap(),
           kSSSPOutEdgeRangeFn{&graph}, &paths, &path_pointers, path_alloc,
-          num_paths, plan.delta());
+          num_paths, plan.delta(), lower_bounds);
       break;
     case KssspPlan::kDeltaStepBarrier:
       katana::gInfo("Using OBIM with barrier\n");
-      DeltaStepAlgo<GraphTy, Weight, kSSSPUpdateRequest, OBIM_Barrier>(
+      DeltaStepAlgo<
+          GraphTy, Weight, kSSSPUpdateRequest, OBIM_Barrier, kUniform>(
           &graph, source, report, kSSSPReqPushWrap(),
           kSSSPOutEdgeRangeFn{&graph}, &paths, &path_pointers, path_alloc,
-          num_paths, plan.delta());
+          num_paths, plan.delta(), lower_bounds);
       break;
 
     default:
@@ -461,6 +747,32 @@ kSSSPWithWrap(
   KATANA_CHECKED(pg->ConstructNodeProperties<NodeData<Weight>>(
       txn_ctx, temp_node_property_names));
 
+  if (plan.algorithm() == KssspPlan::kBidirectionalDijkstra) {
+    if (num_paths != 1) {
+      return KATANA_ERROR(
+          katana::ErrorCode::InvalidArgument,
+          "bidirectional ksssp answers single-pair queries; num_paths must "
+          "be 1, got {}",
+          num_paths);
+    }
+    if (is_symmetric) {
+      using Graph = katana::TypedPropertyGraphView<
+          katana::PropertyGraphViews::Default, NodeData<Weight>,
+          EdgeData<Weight>>;
+      Graph graph = KATANA_CHECKED(Graph::Make(
+          pg, temp_node_property_names, {edge_weight_property_name}));
+      return BidirectionalDijkstra<Graph, Weight, false, false>(
+          graph, start_node, report_node);
+    }
+    using Graph = katana::TypedPropertyGraphView<
+        katana::PropertyGraphViews::BiDirectional, NodeData<Weight>,
+        EdgeData<Weight>>;
+    Graph graph = KATANA_CHECKED(
+        Graph::Make(pg, temp_node_property_names, {edge_weight_property_name}));
+    return BidirectionalDijkstra<Graph, Weight, false, true>(
+        graph, start_node, report_node);
+  }
+
   if (is_symmetric) {
     using Graph = katana::TypedPropertyGraphView<
         katana::PropertyGraphViews::Default, NodeData<Weight>,
@@ -483,6 +795,83 @@ kSSSPWithWrap(
   }
 }
 
+/**
+ * Unweighted variant: builds typed views without a weight column and runs
+ * the unit-weight instantiations, where every weight load folds to 1.
+ *
+ * @param pg property graph
+ * @param start_node Beginning node in graph
+ * @param report_node Final node to look for
+ * @param num_paths Number of paths to look for
+ * @param is_symmetric Whether or not the path is symmetric
+ * @param plan Algorithm to get path
+ */
+template <typename Weight>
+katana::Result<void>
+kSSSPUniformWithWrap(
+    katana::PropertyGraph* pg, size_t start_node, size_t report_node,
+    size_t num_paths, const bool& is_symmetric, katana::TxnContext* txn_ctx,
+    KssspPlan plan) {
+  static_assert(std::is_integral_v<Weight>);
+
+  std::vector<TemporaryPropertyGuard> temp_node_properties(2);
+  std::generate_n(
+      temp_node_properties.begin(), temp_node_properties.size(),
+      [&]() { return TemporaryPropertyGuard{pg->NodeMutablePropertyView()}; });
+  std::vector<std::string> temp_node_property_names(
+      temp_node_properties.size());
+  std::transform(
+      temp_node_properties.begin(), temp_node_properties.end(),
+      temp_node_property_names.begin(),
+      [](const TemporaryPropertyGuard& p) { return p.name(); });
+
+  KATANA_CHECKED(pg->ConstructNodeProperties<NodeData<Weight>>(
+      txn_ctx, temp_node_property_names));
+
+  if (plan.algorithm() == KssspPlan::kBidirectionalDijkstra) {
+    if (num_paths != 1) {
+      return KATANA_ERROR(
+          katana::ErrorCode::InvalidArgument,
+          "bidirectional ksssp answers single-pair queries; num_paths must "
+          "be 1, got {}",
+          num_paths);
+    }
+    if (is_symmetric) {
+      using Graph = katana::TypedPropertyGraphView<
+          katana::PropertyGraphViews::Default, NodeData<Weight>, std::tuple<>>;
+      Graph graph =
+          KATANA_CHECKED(Graph::Make(pg, temp_node_property_names, {}));
+      return BidirectionalDijkstra<Graph, Weight, /*kUniform=*/true, false>(
+          graph, start_node, report_node);
+    }
+    using Graph = katana::TypedPropertyGraphView<
+        katana::PropertyGraphViews::BiDirectional, NodeData<Weight>,
+        std::tuple<>>;
+    Graph graph = KATANA_CHECKED(Graph::Make(pg, temp_node_property_names, {}));
+    return BidirectionalDijkstra<Graph, Weight, /*kUniform=*/true, true>(
+        graph, start_node, report_node);
+  }
+
+  if (is_symmetric) {
+    using Graph = katana::TypedPropertyGraphView<
+        katana::PropertyGraphViews::Default, NodeData<Weight>, std::tuple<>>;
+    Graph graph =
+        KATANA_CHECKED(Graph::Make(pg, temp_node_property_names, {}));
+
+    return KssspImpl<Graph, Weight, /*kUniform=*/true>(
+        graph, start_node, report_node, num_paths, plan);
+  } else {
+    using Graph = katana::TypedPropertyGraphView<
+        katana::PropertyGraphViews::Undirected, NodeData<Weight>,
+        std::tuple<>>;
+    Graph graph =
+        KATANA_CHECKED(Graph::Make(pg, temp_node_property_names, {}));
+
+    return KssspImpl<Graph, Weight, /*kUniform=*/true>(
+        graph, start_node, report_node, num_paths, plan);
+  }
+}
+
 /**
  * Runs a ksssp algorithm based on its weight
  *
@@ -507,14 +896,11 @@ katana::analytics::Ksssp(
   }
 
   if (edge_weight_property_name.empty()) {
-    TemporaryPropertyGuard temporary_edge_property{
-        pg->EdgeMutablePropertyView()};
-    using EdgeWeightType = int64_t;
-    KATANA_CHECKED(katana::analytics::AddDefaultEdgeWeight<EdgeWeightType>(
-        pg, temporary_edge_property.name(), 1, txn_ctx));
-    return kSSSPWithWrap<int64_t>(
-        pg, temporary_edge_property.name(), start_node, report_node, num_paths,
-        is_symmetric, txn_ctx, plan);
+    // All ksssp algorithms are delta-stepping variants, so the unweighted
+    // case can use the compile-time unit-weight instantiation instead of
+    // materializing a temporary weight-1 property.
+    return kSSSPUniformWithWrap<int64_t>(
+        pg, start_node, report_node, num_paths, is_symmetric, txn_ctx, plan);
   }
 
   switch (KATANA_CHECKED(pg->GetEdgeProperty(edge_weight_property_name))
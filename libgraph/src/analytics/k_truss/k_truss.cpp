@@ -20,6 +20,7 @@
 #include "katana/analytics/k_truss/k_truss.h"
 
 #include "katana/ArrowRandomAccessBuilder.h"
+#include "katana/NUMAArray.h"
 #include "katana/TypedPropertyGraph.h"
 
 using namespace katana::analytics;
@@ -41,6 +42,10 @@ using NodeVec = katana::InsertBag<GNode>;
 
 static const uint32_t valid = 0x0;
 static const uint32_t removed = 0x1;
+//! Edges being peeled in the current round of PeelingTrussAlgo; distinct
+//! from removed so triangle updates can tell dying edges from long-dead
+//! ones.
+static const uint32_t peeled = 0x2;
 
 /// Initialize edge data to valid.
 void
@@ -344,6 +349,177 @@ BSPCoreThenTrussAlgo(SortedGraphView* g, uint32_t k) {
   return katana::ResultSuccess();
 }
 
+/**
+ * Count the triangles containing the edge (src, dest) by walking the sorted
+ * adjacency lists of both endpoints.
+ */
+uint32_t
+CountEdgeSupport(const SortedGraphView& g, GNode src, GNode dest) {
+  uint32_t count = 0;
+  auto srcI = g.OutEdges(src).begin(), srcE = g.OutEdges(src).end(),
+       dstI = g.OutEdges(dest).begin(), dstE = g.OutEdges(dest).end();
+
+  while (srcI != srcE && dstI != dstE) {
+    auto sN = g.OutEdgeDst(*srcI), dN = g.OutEdgeDst(*dstI);
+    if (sN < dN) {
+      ++srcI;
+    } else if (dN < sN) {
+      ++dstI;
+    } else {
+      count += 1;
+      ++srcI;
+      ++dstI;
+    }
+  }
+  return count;
+}
+
+/**
+ * Take one triangle away from the canonical edge (min(u, w), max(u, w)).
+ * Pushes the edge into the next peeling round exactly once: at the
+ * transition from j to j - 1 supports.
+ */
+void
+DecrementSupport(
+    SortedGraphView* g, katana::NUMAArray<std::atomic<uint32_t>>* support,
+    GNode u, GNode w, uint32_t j, EdgeVec* next) {
+  GNode lo = std::min(u, w), hi = std::max(u, w);
+  auto eid = *g->FindEdge(lo, hi);
+  uint32_t old = (*support)[eid].fetch_sub(1, std::memory_order_relaxed);
+  if (old == j) {
+    next->push_back(std::make_pair(lo, hi));
+  }
+}
+
+/// PeelingTrussAlgo (PKT style):
+/// 1. Count every edge's triangle support once into a flat array.
+/// 2. Collect the bucket of edges with support < k - 2.
+/// 3. Flag the whole bucket as peeled, then for every broken triangle
+///    atomically decrement the support of its surviving edges; edges
+///    crossing the threshold form the next bucket.
+/// 4. Downgrade the bucket to removed and repeat until no bucket remains.
+/// Unlike the BSP variants, supported edges are never re-intersected.
+katana::Result<void>
+PeelingTrussAlgo(SortedGraphView* g, uint32_t k) {
+  if (k <= 2) {
+    return katana::ErrorCode::InvalidArgument;
+  }
+  const uint32_t j = k - 2;
+
+  katana::NUMAArray<std::atomic<uint32_t>> support;
+  support.allocateInterleaved(g->NumEdges());
+
+  auto cur = std::make_unique<EdgeVec>();
+  auto next = std::make_unique<EdgeVec>();
+
+  //! Count initial support; only the canonical direction (src < dest) of
+  //! each undirected edge carries it.
+  katana::do_all(
+      katana::iterate(*g),
+      [&](GNode n) {
+        for (auto e : g->OutEdges(n)) {
+          auto dest = g->OutEdgeDst(e);
+          if (dest > n) {
+            uint32_t s = CountEdgeSupport(*g, n, dest);
+            support[e].store(s, std::memory_order_relaxed);
+            if (s < j) {
+              cur->push_back(std::make_pair(n, dest));
+            }
+          }
+        }
+      },
+      katana::steal(), katana::loopname("PeelingCountSupport"));
+
+  while (!cur->empty()) {
+    //! Flag the whole bucket before updating supports so triangle walks
+    //! can distinguish this round's dying edges from long-removed ones.
+    katana::do_all(
+        katana::iterate(*cur),
+        [&](Edge e) {
+          g->template GetEdgeData<EdgeFlag>(*g->FindEdge(e.first, e.second)) =
+              peeled;
+          g->template GetEdgeData<EdgeFlag>(*g->FindEdge(e.second, e.first)) =
+              peeled;
+        },
+        katana::steal(), katana::loopname("PeelingFlagBucket"));
+
+    katana::do_all(
+        katana::iterate(*cur),
+        [&](Edge e) {
+          GNode src = e.first, dest = e.second;
+          auto srcI = g->OutEdges(src).begin(),
+               srcE = g->OutEdges(src).end(),
+               dstI = g->OutEdges(dest).begin(),
+               dstE = g->OutEdges(dest).end();
+
+          while (true) {
+            //! Skip edges removed in earlier rounds.
+            while (srcI != srcE &&
+                   (g->template GetEdgeData<EdgeFlag>(*srcI) & removed)) {
+              ++srcI;
+            }
+            while (dstI != dstE &&
+                   (g->template GetEdgeData<EdgeFlag>(*dstI) & removed)) {
+              ++dstI;
+            }
+            if (srcI == srcE || dstI == dstE) {
+              break;
+            }
+
+            auto sN = g->OutEdgeDst(*srcI), dN = g->OutEdgeDst(*dstI);
+            if (sN < dN) {
+              ++srcI;
+            } else if (dN < sN) {
+              ++dstI;
+            } else {
+              GNode w = sN;
+              bool src_w_peeled =
+                  (g->template GetEdgeData<EdgeFlag>(*srcI) & peeled);
+              bool dest_w_peeled =
+                  (g->template GetEdgeData<EdgeFlag>(*dstI) & peeled);
+
+              //! A triangle side that is also being peeled this round is
+              //! handled by exactly one of the two dying edges: the
+              //! canonically smaller one. A side whose both companions die
+              //! needs no update at all.
+              if (!src_w_peeled && !dest_w_peeled) {
+                DecrementSupport(g, &support, src, w, j, next.get());
+                DecrementSupport(g, &support, dest, w, j, next.get());
+              } else if (!src_w_peeled && dest_w_peeled) {
+                Edge other{std::min(dest, w), std::max(dest, w)};
+                if (e < other) {
+                  DecrementSupport(g, &support, src, w, j, next.get());
+                }
+              } else if (src_w_peeled && !dest_w_peeled) {
+                Edge other{std::min(src, w), std::max(src, w)};
+                if (e < other) {
+                  DecrementSupport(g, &support, dest, w, j, next.get());
+                }
+              }
+              ++srcI;
+              ++dstI;
+            }
+          }
+        },
+        katana::steal(), katana::loopname("PeelingUpdateSupport"));
+
+    //! Downgrade the bucket to removed for good.
+    katana::do_all(
+        katana::iterate(*cur),
+        [&](Edge e) {
+          g->template GetEdgeData<EdgeFlag>(*g->FindEdge(e.first, e.second)) =
+              removed;
+          g->template GetEdgeData<EdgeFlag>(*g->FindEdge(e.second, e.first)) =
+              removed;
+        },
+        katana::steal(), katana::loopname("PeelingRetireBucket"));
+
+    cur->clear();
+    std::swap(cur, next);
+  }
+  return katana::ResultSuccess();
+}
+
 katana::Result<void>
 katana::analytics::KTruss(
     katana::TxnContext* txn_ctx, katana::PropertyGraph* pg,
@@ -369,6 +545,8 @@ katana::analytics::KTruss(
     return BSPTrussJacobiAlgo(&graph, k_truss_number);
   case KTrussPlan::kBspCoreThenTruss:
     return BSPCoreThenTrussAlgo(&graph, k_truss_number);
+  case KTrussPlan::kPeeling:
+    return PeelingTrussAlgo(&graph, k_truss_number);
   default:
     return katana::ErrorCode::InvalidArgument;
   }
@@ -22,7 +22,10 @@
 #include <deque>
 #include <type_traits>
 
+#include "katana/Env.h"
 #include "katana/TypedPropertyGraph.h"
+#include "katana/gstl.h"
+#include "katana/analytics/Checkpoint.h"
 #include "katana/analytics/ClusteringImplementationBase.h"
 
 using namespace katana::analytics;
@@ -98,6 +101,13 @@ struct LeidenClusteringImplementation
             c_info[n_data_curr_comm_id].degree_wt, n_data_degree_wt);
       });
     }
+    // Per-thread arena backing the transient per-node containers in the
+    // move phase; rewound after every node.
+    katana::PerRoundArenaHeap arena;
+    using MapAlloc =
+        katana::gstl::ArenaAlloc<std::pair<const uint64_t, uint64_t>>;
+    using CounterAlloc = katana::gstl::ArenaAlloc<EdgeWeightType>;
+
     katana::StatTimer TimerClusteringWhile("Timer_Clustering_While");
     TimerClusteringWhile.start();
     while (true) {
@@ -114,14 +124,15 @@ struct LeidenClusteringImplementation
 
             uint64_t degree = Degree(*graph, n);
             uint64_t local_target = Base::UNASSIGNED;
-            std::map<uint64_t, uint64_t>
-                cluster_local_map;  // Map each neighbor's cluster to local number:
-                                    // Community --> Index
-            std::vector<EdgeWeightType>
-                counter;  // Number of edges to each unique cluster
-            EdgeWeightType self_loop_wt = 0;
 
             if (degree > 0) {
+              katana::gstl::ArenaMap<uint64_t, uint64_t> cluster_local_map{
+                  MapAlloc(&arena)};  // Map each neighbor's cluster to local
+                                      // number: Community --> Index
+              katana::gstl::ArenaVector<EdgeWeightType> counter{CounterAlloc(
+                  &arena)};  // Number of edges to each unique cluster
+              EdgeWeightType self_loop_wt = 0;
+
               Base::template FindNeighboringClusters<EdgeWeightType>(
                   *graph, n, cluster_local_map, counter, self_loop_wt);
               // Find the max gain in modularity
@@ -129,9 +140,9 @@ struct LeidenClusteringImplementation
                   cluster_local_map, counter, self_loop_wt, c_info,
                   n_data_node_wt, n_data_curr_comm_id,
                   constant_for_second_term);
-            } else {
-              local_target = Base::UNASSIGNED;
             }
+            // The containers above are dead; reclaim their arena space.
+            arena.resetLocal();
 
             /* Update cluster info */
             if (local_target != n_data_curr_comm_id &&
@@ -255,6 +266,13 @@ struct LeidenClusteringImplementation
       c_update_subtract[n].node_wt = 0;
     });
 
+    // Per-thread arena backing the transient per-node containers in the
+    // move phase; rewound after every node.
+    katana::PerRoundArenaHeap arena;
+    using MapAlloc =
+        katana::gstl::ArenaAlloc<std::pair<const uint64_t, uint64_t>>;
+    using CounterAlloc = katana::gstl::ArenaAlloc<EdgeWeightType>;
+
     katana::StatTimer TimerClusteringWhile("Timer_Clustering_While");
     TimerClusteringWhile.start();
 
@@ -275,14 +293,14 @@ struct LeidenClusteringImplementation
 
               uint64_t degree = Degree(*graph, n);
 
-              std::map<uint64_t, uint64_t>
-                  cluster_local_map;  // Map each neighbor's cluster to local number:
-                                      // Community --> Index
-              std::vector<EdgeWeightType>
-                  counter;  // Number of edges to each unique cluster
-              EdgeWeightType self_loop_wt = 0;
-
               if (degree > 0) {
+                katana::gstl::ArenaMap<uint64_t, uint64_t> cluster_local_map{
+                    MapAlloc(&arena)};  // Map each neighbor's cluster to local
+                                        // number: Community --> Index
+                katana::gstl::ArenaVector<EdgeWeightType> counter{CounterAlloc(
+                    &arena)};  // Number of edges to each unique cluster
+                EdgeWeightType self_loop_wt = 0;
+
                 Base::template FindNeighboringClusters<EdgeWeightType>(
                     *graph, n, cluster_local_map, counter, self_loop_wt);
                 // Find the max gain in modularity
@@ -294,6 +312,8 @@ struct LeidenClusteringImplementation
               } else {
                 local_target[n] = 0;
               }
+              // The containers above are dead; reclaim their arena space.
+              arena.resetLocal();
 
               /* Update cluster info */
               if (local_target[n] != n_data_curr_comm_id &&
@@ -461,6 +481,16 @@ public:
     uint32_t iter = 0;
     uint64_t num_nodes_orig = clusters_orig.size();
 
+    // Spot-instance runs set KATANA_CHECKPOINT_URI to snapshot the
+    // original-node community assignment between coarsening phases; a
+    // killed run restarts with its communities instead of from scratch.
+    std::unique_ptr<AlgoCheckpointer> checkpointer;
+    std::string checkpoint_uri;
+    if (katana::GetEnv("KATANA_CHECKPOINT_URI", &checkpoint_uri)) {
+      checkpointer = std::make_unique<AlgoCheckpointer>(checkpoint_uri);
+      checkpointer->RegisterArray("clusters_orig", &clusters_orig);
+    }
+
     while (true) {
       iter++;
       phase++;
@@ -583,6 +613,12 @@ public:
         cluster_node_wt.deallocate();
         cluster_node_wt.destroy();
 
+        // The dirty chunks upload while the next phase runs on the
+        // coarsened graph; Snapshot first waits out the previous phase's
+        // uploads and commits their manifest.
+        if (checkpointer) {
+          KATANA_CHECKED(checkpointer->Snapshot(phase));
+        }
       } else {
         break;
       }
@@ -623,6 +659,11 @@ public:
           graph_curr_tmp.template GetData<CurrentCommunityID>(clusters_orig[n]);
     });
 
+    if (checkpointer) {
+      KATANA_CHECKED(checkpointer->Snapshot(phase + 1));
+      KATANA_CHECKED(checkpointer->Flush());
+    }
+
     TimerTotal.stop();
     return katana::ResultSuccess();
   }
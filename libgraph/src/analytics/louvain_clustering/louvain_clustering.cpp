@@ -24,6 +24,7 @@
 #include <type_traits>
 
 #include "katana/TypedPropertyGraph.h"
+#include "katana/gstl.h"
 #include "katana/analytics/ClusteringImplementationBase.h"
 
 using namespace katana::analytics;
@@ -90,6 +91,13 @@ struct LouvainClusteringImplementation
       KATANA_LOG_FATAL("constant_for_second_term is INFINITY\n");
     }
 
+    // Per-thread arena backing the transient per-node containers in the
+    // move phase; rewound after every node.
+    katana::PerRoundArenaHeap arena;
+    using MapAlloc =
+        katana::gstl::ArenaAlloc<std::pair<const uint64_t, uint64_t>>;
+    using CounterAlloc = katana::gstl::ArenaAlloc<EdgeWeightType>;
+
     katana::StatTimer TimerClusteringWhile("Timer_Clustering_While");
     TimerClusteringWhile.start();
     while (true) {
@@ -110,15 +118,15 @@ struct LouvainClusteringImplementation
 
             uint64_t degree = Degree(*graph, n);
             uint64_t local_target = Base::UNASSIGNED;
-            // TODO(amber): use scalable allocator with these containers
-            std::map<uint64_t, uint64_t>
-                cluster_local_map;  // Map each neighbor's cluster to local number:
-                                    // Community --> Index
-            std::vector<EdgeWeightType>
-                counter;  // Number of edges to each unique cluster
-            EdgeWeightType self_loop_wt = 0;
 
             if (degree > 0) {
+              katana::gstl::ArenaMap<uint64_t, uint64_t> cluster_local_map{
+                  MapAlloc(&arena)};  // Map each neighbor's cluster to local
+                                      // number: Community --> Index
+              katana::gstl::ArenaVector<EdgeWeightType> counter{CounterAlloc(
+                  &arena)};  // Number of edges to each unique cluster
+              EdgeWeightType self_loop_wt = 0;
+
               Base::template FindNeighboringClusters<EdgeWeightType>(
                   *graph, n, cluster_local_map, counter, self_loop_wt);
               // Find the max gain in modularity
@@ -126,10 +134,9 @@ struct LouvainClusteringImplementation
                   cluster_local_map, counter, self_loop_wt, c_info,
                   n_data_degree_wt, n_data_curr_comm_id,
                   constant_for_second_term);
-
-            } else {
-              local_target = Base::UNASSIGNED;
             }
+            // The containers above are dead; reclaim their arena space.
+            arena.resetLocal();
 
             /* Update cluster info */
             if (local_target != n_data_curr_comm_id &&
@@ -242,6 +249,13 @@ struct LouvainClusteringImplementation
       c_update_subtract[n].size = 0;
     });
 
+    // Per-thread arena backing the transient per-node containers in the
+    // move phase; rewound after every node.
+    katana::PerRoundArenaHeap arena;
+    using MapAlloc =
+        katana::gstl::ArenaAlloc<std::pair<const uint64_t, uint64_t>>;
+    using CounterAlloc = katana::gstl::ArenaAlloc<EdgeWeightType>;
+
     katana::StatTimer TimerClusteringWhile("Timer_Clustering_While");
     TimerClusteringWhile.start();
 
@@ -261,15 +275,14 @@ struct LouvainClusteringImplementation
 
               uint64_t degree = Degree(*graph, n);
 
-              // TODO(amber): use scalable allocators
-              std::map<uint64_t, uint64_t>
-                  cluster_local_map;  // Map each neighbor's cluster to local number:
-                                      // Community --> Index
-              std::vector<EdgeWeightType>
-                  counter;  // Number of edges to each unique cluster
-              EdgeWeightType self_loop_wt = 0;
-
               if (degree > 0) {
+                katana::gstl::ArenaMap<uint64_t, uint64_t> cluster_local_map{
+                    MapAlloc(&arena)};  // Map each neighbor's cluster to local
+                                        // number: Community --> Index
+                katana::gstl::ArenaVector<EdgeWeightType> counter{CounterAlloc(
+                    &arena)};  // Number of edges to each unique cluster
+                EdgeWeightType self_loop_wt = 0;
+
                 Base::template FindNeighboringClusters<EdgeWeightType>(
                     *graph, n, cluster_local_map, counter, self_loop_wt);
                 // Find the max gain in modularity
@@ -281,6 +294,8 @@ struct LouvainClusteringImplementation
               } else {
                 local_target[n] = Base::UNASSIGNED;
               }
+              // The containers above are dead; reclaim their arena space.
+              arena.resetLocal();
 
               /* Update cluster info */
               if (local_target[n] != n_data_curr_comm_id &&
@@ -31,6 +31,7 @@
 #include "katana/ParallelSTL.h"
 #include "katana/Properties.h"
 #include "katana/Reduction.h"
+#include "katana/Tiled2DExecutor.h"
 #include "katana/Timer.h"
 #include "katana/TypedPropertyGraph.h"
 #include "katana/analytics/MatrixCompletionImplementationBase.h"
@@ -102,6 +103,43 @@ struct MatrixCompletionImplementation
     return error;
   }
 
+  // Same update as DoGradientUpdate for callers that guarantee exclusive
+  // access to both latent vectors (see SGDShardedItemsAlgo). The values are
+  // staged through plain stack arrays so the dot product and the AXPY-style
+  // gradient step are straight-line loops over non-atomic doubles, which
+  // the compiler vectorizes; the atomics are only crossed once per element
+  // with relaxed loads and stores.
+  template <typename NodeIndex>
+  double DoGradientUpdateExclusive(
+      katana::PropertyReferenceType<NodeIndex> item_latent_vector,
+      katana::PropertyReferenceType<NodeIndex> user_latent_vector,
+      double lambda, double edge_rating, double step_size) {
+    double item_local[LATENT_VECTOR_SIZE];
+    double user_local[LATENT_VECTOR_SIZE];
+    for (int i = 0; i < LATENT_VECTOR_SIZE; i++) {
+      item_local[i] = item_latent_vector[i].load(std::memory_order_relaxed);
+      user_local[i] = user_latent_vector[i].load(std::memory_order_relaxed);
+    }
+
+    double inner_product = 0;
+    for (int i = 0; i < LATENT_VECTOR_SIZE; i++) {
+      inner_product += item_local[i] * user_local[i];
+    }
+    double error = edge_rating - inner_product;
+
+    for (int i = 0; i < LATENT_VECTOR_SIZE; i++) {
+      item_latent_vector[i].store(
+          item_local[i] +
+              step_size * (error * user_local[i] - lambda * item_local[i]),
+          std::memory_order_relaxed);
+      user_latent_vector[i].store(
+          user_local[i] +
+              step_size * (error * item_local[i] - lambda * user_local[i]),
+          std::memory_order_relaxed);
+    }
+    return error;
+  }
+
   struct StepFunction {
     virtual LatentValue StepSize(
         int round, MatrixCompletionPlan plan) const = 0;
@@ -368,6 +406,156 @@ public:
   }
 };
 
+// DSGD-style grid execution: each worker owns a static block of item nodes,
+// users are hashed into one stripe per worker, and the stripes rotate past
+// the item blocks one phase at a time. Within a phase no two workers share
+// an item or user vector (items are partitioned; each user stripe is
+// assigned to exactly one worker), so gradient steps run without atomics
+// and popular users stop being contention hot spots. The join at the end of
+// each on_each call is the barrier between phases. The price is that every
+// phase rescans the block's edge destinations to filter for the active
+// stripe; the filter only reads topology, not latent vectors.
+class SGDShardedItemsAlgo {
+public:
+  bool IsSgd() const { return true; }
+
+  std::string Name() const { return "sgdShardedItemsAlgo"; }
+
+  size_t NumItems() const { return kNumItemNodes; }
+
+private:
+  struct Execute {
+    Graph& graph;
+    katana::GAccumulator<unsigned>& edges_visited;
+
+    void operator()(
+        LatentValue* steps, int, katana::GAccumulator<double>* error_accum,
+        MatrixCompletionPlan plan, MatrixCompletionImplementation impl) {
+      const LatentValue step_size = steps[0];
+      const uint32_t num_stripes = katana::getActiveThreads();
+
+      for (uint32_t phase = 0; phase < num_stripes; ++phase) {
+        katana::on_each([&](const unsigned tid, const unsigned nthreads) {
+          size_t block_size = kNumItemNodes / nthreads;
+          if ((kNumItemNodes % nthreads) > 0) {
+            ++block_size;
+          }
+          GNode begin = tid * block_size;
+          GNode end = std::min(begin + block_size, GNode(kNumItemNodes));
+          const uint32_t stripe = (tid + phase) % num_stripes;
+
+          for (GNode src = begin; src < end; ++src) {
+            for (auto ii : graph.OutEdges(src)) {
+              auto dst = graph.OutEdgeDst(ii);
+              if (dst % num_stripes != stripe) {
+                continue;
+              }
+              auto item_latent_vector = graph.GetData<NodeLatentVector>(src);
+              auto user_latent_vector = graph.GetData<NodeLatentVector>(dst);
+              LatentValue error =
+                  impl.DoGradientUpdateExclusive<NodeLatentVector>(
+                      item_latent_vector, user_latent_vector, plan.lambda(),
+                      graph.GetEdgeData<EdgeWeight>(ii), step_size);
+
+              edges_visited += 1;
+              if (plan.useExactError())
+                *error_accum += error;
+            }
+          }
+        });
+      }
+    }
+  };
+
+public:
+  void operator()(
+      Graph& graph, const MatrixCompletionImplementation::StepFunction& sf,
+      MatrixCompletionPlan plan, MatrixCompletionImplementation impl) {
+    katana::GAccumulator<unsigned> edges_visited;
+
+    katana::StatTimer executeTimer("Time");
+    executeTimer.start();
+
+    Execute fn{graph, edges_visited};
+    ExecuteUntilConverged(sf, graph, fn, plan, impl);
+
+    executeTimer.stop();
+
+    katana::ReportStatSingle(
+        "sgdShardedItemsAlgo", "EdgesVisited", edges_visited.reduce());
+  }
+};
+
+// DSGD over 2D edge tiles: the item x user adjacency rectangle is cut
+// into tiles sized so the latent vectors a tile touches fit in L2
+// together, and Tiled2DExecutor's band locking guarantees no two
+// concurrent tiles share an item or user block, so the gradient step
+// runs exclusively without atomics. Unlike SGDShardedItemsAlgo there is
+// no per-phase rescan of untouched destinations: each row's edges are
+// binary-searched to the tile's user range, which requires adjacency
+// lists sorted by destination id.
+class SGDTiledItemsAlgo {
+public:
+  bool IsSgd() const { return true; }
+
+  std::string Name() const { return "sgdTiledItemsAlgo"; }
+
+  size_t NumItems() const { return kNumItemNodes; }
+
+private:
+  struct Execute {
+    Graph& graph;
+    katana::GAccumulator<unsigned>& edges_visited;
+
+    void operator()(
+        LatentValue* steps, int, katana::GAccumulator<double>* error_accum,
+        MatrixCompletionPlan plan, MatrixCompletionImplementation impl) {
+      const LatentValue step_size = steps[0];
+
+      constexpr size_t kLatentBytes =
+          LATENT_VECTOR_SIZE * sizeof(LatentValue);
+      auto shape = katana::Tiled2DExecutor<Graph>::ComputeTileShape(
+          kLatentBytes, kLatentBytes);
+
+      katana::Tiled2DExecutor<Graph> executor(graph);
+      executor.Execute(
+          GNode{0}, GNode(kNumItemNodes), GNode(kNumItemNodes),
+          GNode(graph.size()), shape.size_x, shape.size_y,
+          [&](GNode item, GNode user, Graph::Edge edge) {
+            auto item_latent_vector = graph.GetData<NodeLatentVector>(item);
+            auto user_latent_vector = graph.GetData<NodeLatentVector>(user);
+            LatentValue error =
+                impl.DoGradientUpdateExclusive<NodeLatentVector>(
+                    item_latent_vector, user_latent_vector, plan.lambda(),
+                    graph.GetEdgeData<EdgeWeight>(edge), step_size);
+
+            edges_visited += 1;
+            if (plan.useExactError())
+              *error_accum += error;
+          },
+          /*use_locks=*/true);
+    }
+  };
+
+public:
+  void operator()(
+      Graph& graph, const MatrixCompletionImplementation::StepFunction& sf,
+      MatrixCompletionPlan plan, MatrixCompletionImplementation impl) {
+    katana::GAccumulator<unsigned> edges_visited;
+
+    katana::StatTimer executeTimer("Time");
+    executeTimer.start();
+
+    Execute fn{graph, edges_visited};
+    ExecuteUntilConverged(sf, graph, fn, plan, impl);
+
+    executeTimer.stop();
+
+    katana::ReportStatSingle(
+        "sgdTiledItemsAlgo", "EdgesVisited", edges_visited.reduce());
+  }
+};
+
 template <typename Algo>
 katana::Result<void>
 Run(katana::PropertyGraph* pg, MatrixCompletionPlan plan,
@@ -403,6 +591,10 @@ katana::analytics::MatrixCompletion(
   switch (plan.algorithm()) {
   case MatrixCompletionPlan::kSGDByItems:
     return Run<SGDItemsAlgo>(pg, plan, txn_ctx);
+  case MatrixCompletionPlan::kSGDByItemsSharded:
+    return Run<SGDShardedItemsAlgo>(pg, plan, txn_ctx);
+  case MatrixCompletionPlan::kSGDByItemsTiled:
+    return Run<SGDTiledItemsAlgo>(pg, plan, txn_ctx);
   default:
     return katana::ErrorCode::InvalidArgument;
   }
@@ -41,6 +41,10 @@ katana::Result<void> PagerankPullResidual(
     katana::PropertyGraph* pg, const std::string& output_property_name,
     katana::analytics::PagerankPlan plan, katana::TxnContext* txn_ctx);
 
+katana::Result<void> PagerankPullResidualTiled(
+    katana::PropertyGraph* pg, const std::string& output_property_name,
+    katana::analytics::PagerankPlan plan, katana::TxnContext* txn_ctx);
+
 katana::Result<void> PagerankPushAsynchronous(
     katana::PropertyGraph* pg, const std::string& output_property_name,
     katana::analytics::PagerankPlan plan, katana::TxnContext* txn_ctx);
@@ -19,6 +19,8 @@
 
 #include <arrow/type.h>
 
+#include "katana/AtomicHelpers.h"
+#include "katana/Executor_PropagationBlocked.h"
 #include "katana/TypedPropertyGraph.h"
 #include "katana/analytics/Utils.h"
 #include "pagerank-impl.h"
@@ -96,17 +98,20 @@ ComputeOutDeg(const Graph& graph, PagerankValueAndOutDegreeArray* node_data) {
       [&](const GNode& src) { vec.constructAt(src, 0ul); },
       katana::loopname("InitDegVec"));
 
-  katana::do_all(
-      katana::iterate(graph),
-      [&](const GNode& src) {
+  // Degree updates scatter over the whole array; bin them by destination so
+  // each accumulation pass stays cache resident and needs no atomics.
+  katana::do_all_propagation_blocked<uint32_t>(
+      katana::iterate(graph), graph.size(),
+      [&](const GNode& src, auto& emit) {
         for (auto nbr : graph.OutEdges(src)) {
-          auto dest = graph.OutEdgeDst(nbr);
-          vec[dest].fetch_add(1ul);
+          emit(graph.OutEdgeDst(nbr), 1);
         }
       },
-      katana::steal(),
-      katana::chunk_size<katana::analytics::PagerankPlan::kChunkSize>(),
-      katana::loopname("ComputeOutDeg"));
+      [&](uint64_t dest, uint32_t count) {
+        vec[dest].store(
+            vec[dest].load(std::memory_order_relaxed) + count,
+            std::memory_order_relaxed);
+      });
 
   katana::do_all(
       katana::iterate(graph),
@@ -131,17 +136,20 @@ ComputeOutDeg(const Graph& graph, NodeOutDegreeArray* node_data) {
       [&](const GNode& src) { vec.constructAt(src, 0ul); },
       katana::loopname("InitDegVec"));
 
-  katana::do_all(
-      katana::iterate(graph),
-      [&](const GNode& src) {
+  // Degree updates scatter over the whole array; bin them by destination so
+  // each accumulation pass stays cache resident and needs no atomics.
+  katana::do_all_propagation_blocked<uint32_t>(
+      katana::iterate(graph), graph.size(),
+      [&](const GNode& src, auto& emit) {
         for (auto nbr : graph.OutEdges(src)) {
-          auto dest = graph.OutEdgeDst(nbr);
-          vec[dest].fetch_add(1ul);
+          emit(graph.OutEdgeDst(nbr), 1);
         }
       },
-      katana::steal(),
-      katana::chunk_size<katana::analytics::PagerankPlan::kChunkSize>(),
-      katana::loopname("ComputeOutDeg"));
+      [&](uint64_t dest, uint32_t count) {
+        vec[dest].store(
+            vec[dest].load(std::memory_order_relaxed) + count,
+            std::memory_order_relaxed);
+      });
 
   katana::do_all(
       katana::iterate(graph),
@@ -225,6 +233,116 @@ ComputePRResidual(
   return katana::ResultSuccess();
 }
 
+//! Number of edges per tile in the blocked residual engine.
+constexpr ptrdiff_t kEdgeTileSize = 512;
+
+struct EdgeTile {
+  Graph::Node src;
+  Graph::edge_iterator beg;
+  Graph::edge_iterator end;
+};
+
+//! Split each node's in-edge list (out-edges of the transposed view) into
+//! fixed-size tiles. The tiles are built once; the graph does not change
+//! between iterations.
+void
+MakeEdgeTiles(const Graph& graph, katana::InsertBag<EdgeTile>* tiles) {
+  using GNode = typename Graph::Node;
+  katana::do_all(
+      katana::iterate(graph),
+      [&](const GNode& src) {
+        auto edges = graph.OutEdges(src);
+        auto beg = edges.begin();
+        const auto end = edges.end();
+
+        if (end - beg > kEdgeTileSize) {
+          for (; beg + kEdgeTileSize < end; beg += kEdgeTileSize) {
+            tiles->push(EdgeTile{src, beg, beg + kEdgeTileSize});
+          }
+        }
+        if (end - beg > 0) {
+          tiles->push(EdgeTile{src, beg, end});
+        }
+      },
+      katana::steal(), katana::loopname("MakeEdgeTiles"));
+}
+
+/**
+ * Edge-tiled (blocked) variant of the residual pull engine. The SpMV-like
+ * accumulation pass runs over fixed-size edge tiles instead of whole
+ * adjacency lists, so one tile's reads of the delta array stay within a
+ * bounded working set and heavy nodes no longer serialize on one thread.
+ * Tiles of the same node combine their partial sums with an atomic add; the
+ * residual check is fused into the delta pass, so converged vertices
+ * contribute neither deltas nor work.
+ */
+katana::Result<void>
+ComputePRResidualTiled(
+    Graph* graph, DeltaArray* delta,
+    katana::NUMAArray<std::atomic<PRTy>>* residual,
+    const NodeOutDegreeArray& node_out_degree,
+    katana::analytics::PagerankPlan plan) {
+  katana::StatTimer exec_time("PagerankPullResidualTiled");
+  exec_time.start();
+  using GNode = typename Graph::Node;
+  unsigned int iterations = 0;
+  katana::GAccumulator<unsigned int> accum;
+
+  katana::InsertBag<EdgeTile> tiles;
+  MakeEdgeTiles(*graph, &tiles);
+
+  const PRTy tolerance = plan.tolerance();
+  const PRTy alpha = plan.alpha();
+
+  while (true) {
+    katana::do_all(
+        katana::iterate(*graph),
+        [&](const GNode& src) {
+          auto& sdata = graph->template GetData<NodeValue>(src);
+          (*delta)[src] = 0;
+
+          //! Only the residual higher than tolerance will be reflected
+          //! to the pagerank; converged vertices stay inert.
+          PRTy old_residual = (*residual)[src].load(std::memory_order_relaxed);
+          if (old_residual > tolerance) {
+            (*residual)[src].store(0.0, std::memory_order_relaxed);
+            sdata += old_residual;
+            if (node_out_degree[src] > 0) {
+              (*delta)[src] = old_residual * alpha / node_out_degree[src];
+              accum += 1;
+            }
+          }
+        },
+        katana::loopname("PageRankTiled_delta"));
+
+    katana::do_all(
+        katana::iterate(tiles),
+        [&](const EdgeTile& tile) {
+          PRTy sum = 0;
+          for (auto ii = tile.beg; ii != tile.end; ++ii) {
+            auto dest = graph->OutEdgeDst(*ii);
+            if ((*delta)[dest] > 0) {
+              sum += (*delta)[dest];
+            }
+          }
+          if (sum > 0) {
+            katana::atomicAdd((*residual)[tile.src], sum);
+          }
+        },
+        katana::steal(),
+        katana::chunk_size<katana::analytics::PagerankPlan::kChunkSize>(),
+        katana::loopname("PageRankTiled"));
+
+    iterations++;
+    if (iterations >= plan.max_iterations() || !accum.reduce()) {
+      break;
+    }
+    accum.reset();
+  }
+  exec_time.stop();
+  return katana::ResultSuccess();
+}
+
 /**
  * PageRank pull topological.
  * Always calculate the new pagerank for each iteration.
@@ -347,3 +465,43 @@ PagerankPullResidual(
 
   return ComputePRResidual(&graph, &delta, &residual, node_out_degree, plan);
 }
+
+katana::Result<void>
+PagerankPullResidualTiled(
+    katana::PropertyGraph* pg, const std::string& output_property_name,
+    katana::analytics::PagerankPlan plan, katana::TxnContext* txn_ctx) {
+  using GNode = typename Graph::Node;
+
+  KATANA_CHECKED(
+      pg->ConstructNodeProperties<NodeData>(txn_ctx, {output_property_name}));
+
+  Graph graph = KATANA_CHECKED(Graph::Make(pg, {output_property_name}, {}));
+
+  katana::EnsurePreallocated(2, 3 * graph.size() * sizeof(NodeData));
+  katana::ReportPageAllocGuard page_alloc;
+
+  // NUMA-aware temporary node data; residual is atomic because tiles of the
+  // same node accumulate partial sums concurrently.
+  NodeOutDegreeArray node_out_degree;
+  node_out_degree.allocateInterleaved(graph.size());
+
+  DeltaArray delta;
+  delta.allocateInterleaved(graph.size());
+  katana::NUMAArray<std::atomic<PRTy>> residual;
+  residual.allocateInterleaved(graph.size());
+
+  katana::do_all(
+      katana::iterate(graph),
+      [&](const GNode& n) {
+        auto& sdata = graph.template GetData<NodeValue>(n);
+        sdata = 0;
+        node_out_degree[n] = 0;
+        delta[n] = 0;
+        residual[n].store(plan.initial_residual(), std::memory_order_relaxed);
+      },
+      katana::loopname("initNodeData"));
+  KATANA_CHECKED(ComputeOutDeg(graph, &node_out_degree));
+
+  return ComputePRResidualTiled(
+      &graph, &delta, &residual, node_out_degree, plan);
+}
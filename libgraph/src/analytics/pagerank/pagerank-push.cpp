@@ -18,6 +18,8 @@
  */
 
 #include "katana/AtomicHelpers.h"
+#include "katana/DegreeBins.h"
+#include "katana/DirectionOptimizingExecutor.h"
 #include "katana/Properties.h"
 #include "katana/TypedPropertyGraph.h"
 #include "katana/analytics/Utils.h"
@@ -50,6 +52,47 @@ InitializeNodeResidual(
       katana::no_stats(), katana::loopname("Initialize"));
 }
 
+//! Runs the asynchronous residual push loop starting from the nodes in
+//! initial; further nodes activate transitively as their residuals cross the
+//! plan tolerance.
+template <typename Range>
+void
+AsynchronousPush(
+    Graph* graph, const katana::analytics::PagerankPlan& plan,
+    const Range& initial) {
+  typedef katana::PerSocketChunkFIFO<
+      katana::analytics::PagerankPlan::kChunkSize>
+      WL;
+  katana::for_each(
+      initial,
+      [&](const GNode& src, auto& ctx) {
+        auto& src_residual = graph->GetData<NodeResidual>(src);
+        if (src_residual > plan.tolerance()) {
+          PRTy old_residual = src_residual.exchange(0.0);
+          auto& src_value = graph->GetData<NodeValue>(src);
+          src_value += old_residual;
+          int src_nout = graph->OutDegree(src);
+          if (src_nout > 0) {
+            PRTy delta = old_residual * plan.alpha() / src_nout;
+            //! For each out-going neighbors.
+            for (const auto& jj : graph->OutEdges(src)) {
+              auto dest = graph->OutEdgeDst(jj);
+              auto& dest_residual = graph->GetData<NodeResidual>(dest);
+              if (delta > 0) {
+                auto old = atomicAdd(dest_residual, delta);
+                if ((old < plan.tolerance()) &&
+                    (old + delta >= plan.tolerance())) {
+                  ctx.push(dest);
+                }
+              }
+            }
+          }
+        }
+      },
+      katana::loopname("PushResidualAsynchronous"),
+      katana::disable_conflict_detection(), katana::wl<WL>());
+}
+
 }  // namespace
 
 katana::Result<void>
@@ -73,37 +116,78 @@ PagerankPushAsynchronous(
 
   InitializeNodeResidual(&graph, plan);
 
-  typedef katana::PerSocketChunkFIFO<
-      katana::analytics::PagerankPlan::kChunkSize>
-      WL;
-  katana::for_each(
-      katana::iterate(graph),
-      [&](const GNode& src, auto& ctx) {
-        auto& src_residual = graph.GetData<NodeResidual>(src);
-        if (src_residual > plan.tolerance()) {
-          PRTy old_residual = src_residual.exchange(0.0);
-          auto& src_value = graph.GetData<NodeValue>(src);
-          src_value += old_residual;
-          int src_nout = graph.OutDegree(src);
-          if (src_nout > 0) {
-            PRTy delta = old_residual * plan.alpha() / src_nout;
-            //! For each out-going neighbors.
-            for (const auto& jj : graph.OutEdges(src)) {
-              auto dest = graph.OutEdgeDst(jj);
-              auto& dest_residual = graph.GetData<NodeResidual>(dest);
-              if (delta > 0) {
-                auto old = atomicAdd(dest_residual, delta);
-                if ((old < plan.tolerance()) &&
-                    (old + delta >= plan.tolerance())) {
-                  ctx.push(dest);
-                }
-              }
-            }
-          }
+  AsynchronousPush(&graph, plan, katana::iterate(graph));
+
+  return katana::ResultSuccess();
+}
+
+katana::Result<void>
+katana::analytics::PagerankWithResiduals(
+    katana::PropertyGraph* pg, const std::string& output_property_name,
+    const std::string& residual_property_name, katana::TxnContext* txn_ctx,
+    katana::analytics::PagerankPlan plan) {
+  katana::EnsurePreallocated(5, 5 * pg->NumNodes() * sizeof(NodeData));
+  katana::ReportPageAllocGuard page_alloc;
+
+  if (auto result = pg->ConstructNodeProperties<NodeData>(
+          txn_ctx, {output_property_name, residual_property_name});
+      !result) {
+    return result.error();
+  }
+
+  Graph graph = KATANA_CHECKED(
+      Graph::Make(pg, {output_property_name, residual_property_name}, {}));
+
+  InitializeNodeResidual(&graph, plan);
+
+  AsynchronousPush(&graph, plan, katana::iterate(graph));
+
+  return katana::ResultSuccess();
+}
+
+katana::Result<void>
+katana::analytics::PagerankIncremental(
+    katana::PropertyGraph* pg, const std::string& output_property_name,
+    const std::string& residual_property_name,
+    const std::vector<uint32_t>& touched_nodes,
+    katana::analytics::PagerankPlan plan) {
+  for (uint32_t node : touched_nodes) {
+    if (node >= pg->NumNodes()) {
+      return KATANA_ERROR(
+          katana::ErrorCode::InvalidArgument, "touched node {} is out of range",
+          node);
+    }
+  }
+
+  Graph graph = KATANA_CHECKED(
+      Graph::Make(pg, {output_property_name, residual_property_name}, {}));
+
+  katana::EnsurePreallocated(
+      2, touched_nodes.size() * sizeof(NodeData) +
+             pg->NumNodes() * sizeof(GNode) / 8);
+  katana::ReportPageAllocGuard page_alloc;
+
+  katana::InsertBag<GNode> frontier;
+  katana::do_all(
+      katana::iterate(touched_nodes),
+      [&](uint32_t node) {
+        auto& value = graph.GetData<NodeValue>(node);
+        auto& residual = graph.GetData<NodeResidual>(node);
+        PRTy absorbed = value;
+        value = 0;
+        if (absorbed == 0 && residual == 0) {
+          // node added since the last full run: give it the base mass
+          residual = plan.initial_residual();
+        } else {
+          // rescind the rank this node absorbed so the push loop
+          // redistributes it over the node's current out-edges
+          atomicAdd(residual, absorbed);
         }
+        frontier.push(node);
       },
-      katana::loopname("PushResidualAsynchronous"),
-      katana::disable_conflict_detection(), katana::wl<WL>());
+      katana::no_stats(), katana::loopname("SeedTouchedNodes"));
+
+  AsynchronousPush(&graph, plan, katana::iterate(frontier));
 
   return katana::ResultSuccess();
 }
@@ -138,74 +222,106 @@ PagerankPushSynchronous(
   constexpr ptrdiff_t kEdgeTileSize = 128;
 
   katana::InsertBag<Update> updates;
-  katana::InsertBag<GNode> active_nodes;
 
+  // The executor only picks the active-set representation here: both round
+  // kinds push residuals, but dense rounds sweep the nodes in node order
+  // instead of chasing the worklist, which is the faster traversal while
+  // most of the graph is still active. Every node starts active.
+  katana::DirectionOptimizingExecutor<Graph> executor(graph);
   katana::do_all(
-      katana::iterate(graph), [&](const auto& src) { active_nodes.push(src); },
+      katana::iterate(graph),
+      [&](const GNode& src) { executor.ActivateSeed(src); },
       katana::no_stats());
 
-  size_t iter = 0;
-  for (; !active_nodes.empty() && iter < plan.max_iterations(); ++iter) {
-    katana::do_all(
-        katana::iterate(active_nodes),
-        [&](const GNode& src) {
-          auto& sdata_residual = graph.GetData<NodeResidual>(src);
+  auto make_tiles = [&](const GNode& src, auto degree_bound) {
+    auto& sdata_residual = graph.GetData<NodeResidual>(src);
 
-          if (sdata_residual > plan.tolerance()) {
-            PRTy old_residual = sdata_residual;
-            graph.GetData<NodeValue>(src) += old_residual;
-            sdata_residual = 0.0;
+    if (sdata_residual > plan.tolerance()) {
+      PRTy old_residual = sdata_residual;
+      graph.GetData<NodeValue>(src) += old_residual;
+      sdata_residual = 0.0;
 
-            int src_nout = graph.OutEdges(src).size();
-            PRTy delta = old_residual * plan.alpha() / src_nout;
+      int src_nout = graph.OutEdges(src).size();
+      PRTy delta = old_residual * plan.alpha() / src_nout;
+
+      auto beg = graph.OutEdges(src).begin();
+      const auto end = graph.OutEdges(src).end();
 
-            auto beg = graph.OutEdges(src).begin();
-            const auto end = graph.OutEdges(src).end();
+      KATANA_LOG_ASSERT(beg <= end);
 
-            KATANA_LOG_ASSERT(beg <= end);
+      //! Edge tiling for large outdegree nodes. Bins whose degree bound
+      //! fits in one tile compile this branch away entirely.
+      if constexpr (degree_bound() > uint32_t{kEdgeTileSize}) {
+        if ((end - beg) > kEdgeTileSize) {
+          for (; beg + kEdgeTileSize < end;) {
+            auto ne = beg + kEdgeTileSize;
+            updates.push(Update{delta, beg, ne});
+            beg = ne;
+          }
+        }
+      }
 
-            //! Edge tiling for large outdegree nodes.
-            if ((end - beg) > kEdgeTileSize) {
-              for (; beg + kEdgeTileSize < end;) {
-                auto ne = beg + kEdgeTileSize;
-                updates.push(Update{delta, beg, ne});
-                beg = ne;
+      if ((end - beg) > 0) {
+        updates.push(Update{delta, beg, end});
+      }
+    }
+  };
+
+  // Dense rounds sweep the nodes bin by bin, so each loop sees uniform
+  // trip counts and the tiling decision is per bin, not per node.
+  std::shared_ptr<const katana::DegreeBins> degree_bins =
+      pg->BuildOrGetDegreeBins();
+
+  executor.Execute(
+      [&](katana::Direction dir) {
+        if (dir == katana::Direction::kPull) {
+          katana::DoAllByDegreeBin(
+              *degree_bins,
+              [&](const GNode& src, auto degree_bound) {
+                if (executor.InFrontier(src)) {
+                  make_tiles(src, degree_bound);
+                }
+              },
+              katana::steal(),
+              katana::chunk_size<katana::analytics::PagerankPlan::kChunkSize>(),
+              katana::loopname("CreateEdgeTiles"), katana::no_stats());
+        } else {
+          katana::do_all(
+              katana::iterate(executor.FrontierBag()),
+              [&](const GNode& src) {
+                make_tiles(
+                    src, std::integral_constant<
+                             uint32_t, katana::DegreeBins::kUnbounded>{});
+              },
+              katana::steal(),
+              katana::chunk_size<katana::analytics::PagerankPlan::kChunkSize>(),
+              katana::loopname("CreateEdgeTiles"), katana::no_stats());
+        }
+
+        katana::do_all(
+            katana::iterate(updates),
+            [&](const Update& up) {
+              //! For each out-going neighbors.
+              for (auto jj = up.beg; jj != up.end; ++jj) {
+                auto dest = graph.OutEdgeDst(*jj);
+                auto& ddata_residual = graph.GetData<NodeResidual>(dest);
+                auto old = atomicAdd(ddata_residual, up.delta);
+                //! If fabs(old) is greater than tolerance, then it would
+                //! already have been processed in the previous do_all
+                //! loop.
+                if ((old <= plan.tolerance()) &&
+                    (old + up.delta >= plan.tolerance())) {
+                  executor.Activate(dest);
+                }
               }
-            }
+            },
+            katana::steal(),
+            katana::chunk_size<katana::analytics::PagerankPlan::kChunkSize>(),
+            katana::loopname("PushResidualSynchronous"));
 
-            if ((end - beg) > 0) {
-              updates.push(Update{delta, beg, end});
-            }
-          }
-        },
-        katana::steal(),
-        katana::chunk_size<katana::analytics::PagerankPlan::kChunkSize>(),
-        katana::loopname("CreateEdgeTiles"), katana::no_stats());
-
-    active_nodes.clear();
-
-    katana::do_all(
-        katana::iterate(updates),
-        [&](const Update& up) {
-          //! For each out-going neighbors.
-          for (auto jj = up.beg; jj != up.end; ++jj) {
-            auto dest = graph.OutEdgeDst(*jj);
-            auto& ddata_residual = graph.GetData<NodeResidual>(dest);
-            auto old = atomicAdd(ddata_residual, up.delta);
-            //! If fabs(old) is greater than tolerance, then it would
-            //! already have been processed in the previous do_all
-            //! loop.
-            if ((old <= plan.tolerance()) &&
-                (old + up.delta >= plan.tolerance())) {
-              active_nodes.push(dest);
-            }
-          }
-        },
-        katana::steal(),
-        katana::chunk_size<katana::analytics::PagerankPlan::kChunkSize>(),
-        katana::loopname("PushResidualSynchronous"));
+        updates.clear();
+      },
+      plan.max_iterations());
 
-    updates.clear();
-  }
   return katana::ResultSuccess();
 }
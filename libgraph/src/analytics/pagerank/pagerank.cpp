@@ -18,15 +18,30 @@
  */
 
 #include "katana/TypedPropertyGraph.h"
+#include "katana/analytics/GpuBackend.h"
 #include "pagerank-impl.h"
 
 katana::Result<void>
 katana::analytics::Pagerank(
     katana::PropertyGraph* pg, const std::string& output_property_name,
     katana::TxnContext* txn_ctx, katana::analytics::PagerankPlan plan) {
+  if (plan.architecture() == kGPU) {
+    const GpuBackend* backend = GetGpuBackend();
+    if (backend != nullptr && backend->pagerank != nullptr) {
+      return backend->pagerank(
+          pg, output_property_name, txn_ctx, plan.tolerance(),
+          plan.max_iterations(), plan.alpha());
+    }
+    KATANA_LOG_WARN(
+        "plan requests GPU execution but no GPU backend implements PageRank; "
+        "falling back to the CPU algorithm");
+  }
+
   switch (plan.algorithm()) {
   case PagerankPlan::kPullResidual:
     return PagerankPullResidual(pg, output_property_name, plan, txn_ctx);
+  case PagerankPlan::kPullResidualTiled:
+    return PagerankPullResidualTiled(pg, output_property_name, plan, txn_ctx);
   case PagerankPlan::kPullTopological:
     return PagerankPullTopological(pg, output_property_name, plan, txn_ctx);
   case PagerankPlan::kPushAsynchronous:
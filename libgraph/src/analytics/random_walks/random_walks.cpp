@@ -20,6 +20,7 @@
 #include "katana/analytics/random_walks/random_walks.h"
 
 #include "katana/TypedPropertyGraph.h"
+#include "katana/gstl.h"
 
 using namespace katana::analytics;
 
@@ -172,6 +173,232 @@ struct Node2VecAlgo {
   }
 };
 
+//! One alias-table cell; slot i of a node covers its i-th out-edge and
+//! redirects to neighbor index alias with probability 1 - prob.
+struct AliasEntry {
+  double prob;
+  uint32_t alias;
+};
+
+template <typename EdgeWeightType>
+struct Node2VecWeightedAlgo {
+  using EdgeWeight = katana::PODProperty<EdgeWeightType>;
+
+  using NodeData = std::tuple<>;
+  using EdgeData = std::tuple<EdgeWeight>;
+
+  using SortedGraphView = katana::TypedPropertyGraphView<
+      SortedPropertyGraphView, NodeData, EdgeData>;
+  using GNode = typename SortedGraphView::Node;
+
+  const RandomWalksPlan& plan_;
+  //! Per-node alias tables, one cell per edge, indexed by CSR edge id.
+  katana::NUMAArray<AliasEntry> alias_;
+
+  Node2VecWeightedAlgo(const RandomWalksPlan& plan) : plan_(plan) {}
+
+  //! Build every node's alias table with Vose's method so each weighted
+  //! neighbor draw during the walks is O(1) instead of a list scan.
+  void BuildAliasTables(const SortedGraphView& graph) {
+    alias_.allocateInterleaved(graph.NumEdges());
+    katana::do_all(
+        katana::iterate(graph),
+        [&](GNode n) {
+          auto edges = graph.OutEdges(n);
+          const size_t deg = edges.size();
+          if (deg == 0) {
+            return;
+          }
+          const auto base = *edges.begin();
+
+          double total = 0;
+          for (auto e : edges) {
+            total += static_cast<double>(graph.GetEdgeData<EdgeWeight>(e));
+          }
+          if (!(total > 0)) {
+            //! Degenerate weights: fall back to uniform sampling.
+            for (size_t i = 0; i < deg; ++i) {
+              alias_[base + i] = AliasEntry{1.0, static_cast<uint32_t>(i)};
+            }
+            return;
+          }
+
+          katana::gstl::Vector<double> scaled(deg);
+          katana::gstl::Vector<uint32_t> small;
+          katana::gstl::Vector<uint32_t> large;
+          small.reserve(deg);
+          large.reserve(deg);
+          {
+            size_t i = 0;
+            for (auto e : edges) {
+              scaled[i] =
+                  static_cast<double>(graph.GetEdgeData<EdgeWeight>(e)) *
+                  deg / total;
+              (scaled[i] < 1.0 ? small : large).push_back(i);
+              ++i;
+            }
+          }
+          while (!small.empty() && !large.empty()) {
+            uint32_t s = small.back();
+            small.pop_back();
+            uint32_t l = large.back();
+            large.pop_back();
+            alias_[base + s] = AliasEntry{scaled[s], l};
+            scaled[l] += scaled[s] - 1.0;
+            (scaled[l] < 1.0 ? small : large).push_back(l);
+          }
+          while (!large.empty()) {
+            alias_[base + large.back()] = AliasEntry{1.0, large.back()};
+            large.pop_back();
+          }
+          while (!small.empty()) {
+            alias_[base + small.back()] = AliasEntry{1.0, small.back()};
+            small.pop_back();
+          }
+        },
+        katana::steal(), katana::loopname("BuildAliasTables"));
+  }
+
+  GNode FindSampleNeighbor(
+      const SortedGraphView& graph, const GNode& n,
+      const katana::NUMAArray<uint64_t>& degree, const double prob) {
+    if (degree[n] == 0) {
+      return graph.NumNodes();
+    }
+    const double scaled = prob * degree[n];
+    uint32_t slot = std::floor(scaled);
+
+    auto ei = graph.OutEdges(n).begin() + slot;
+    const AliasEntry& cell = alias_[*ei];
+    //! The fractional part of the slot draw is uniform and independent of
+    //! the slot index, so it serves as the coin for the alias test.
+    if (scaled - slot <= cell.prob) {
+      return graph.OutEdgeDst(*ei);
+    }
+    auto ai = graph.OutEdges(n).begin() + cell.alias;
+    return graph.OutEdgeDst(*ai);
+  }
+
+  void GraphRandomWalk(
+      const SortedGraphView& graph,
+      katana::InsertBag<std::vector<uint32_t>>* walks,
+      const katana::NUMAArray<uint64_t>& degree) {
+    katana::PerThreadStorage<std::mt19937> generator;
+    katana::PerThreadStorage<std::uniform_real_distribution<double>*>
+        distribution;
+
+    for (uint32_t i = 0; i < distribution.size(); i++) {
+      *distribution.getRemote(i) =
+          new std::uniform_real_distribution<double>(0.0, 1.0);
+    }
+
+    double prob_forward = 1.0 / plan_.forward_probability();
+    double prob_backward = 1.0 / plan_.backward_probability();
+
+    double upper_bound = 1.0;
+
+    upper_bound = (upper_bound > prob_forward) ? upper_bound : prob_forward;
+    upper_bound = (upper_bound > prob_backward) ? upper_bound : prob_backward;
+
+    double lower_bound = 1.0;
+
+    lower_bound = (lower_bound < prob_forward) ? lower_bound : prob_forward;
+    lower_bound = (lower_bound < prob_backward) ? lower_bound : prob_backward;
+
+    uint64_t total_walks = graph.size() * plan_.number_of_walks();
+
+    katana::do_all(
+        katana::iterate(uint64_t(0), total_walks),
+        [&](uint64_t idx) {
+          GNode n = idx % graph.size();
+
+          //check if n has no neighbor
+          if (degree[n] == 0) {
+            return;
+          }
+
+          std::uniform_real_distribution<double>* dist =
+              *distribution.getLocal();
+
+          std::vector<uint32_t> walk;
+          walk.push_back(n);
+
+          //random value between 0 and 1
+          double prob = (*dist)(*generator.getLocal());
+
+          //proposal drawn from the edge-weight distribution in O(1)
+          auto nbr = FindSampleNeighbor(graph, n, degree, prob);
+          KATANA_LOG_ASSERT(nbr < graph.NumNodes());
+
+          walk.push_back(std::move(nbr));
+
+          for (uint32_t current_walk = 2; current_walk <= plan_.walk_length();
+               current_walk++) {
+            uint32_t curr = walk[current_walk - 1];
+            uint32_t prev = walk[current_walk - 2];
+
+            //check if n has no neighbor
+            if (degree[curr] == 0) {
+              break;
+            }
+            //acceptance-rejection sampling over the weighted proposal
+            while (true) {
+              //sample x
+              double prob = (*dist)(*generator.getLocal());
+
+              auto nbr = FindSampleNeighbor(graph, curr, degree, prob);
+              KATANA_LOG_ASSERT(nbr < graph.NumNodes());
+
+              //sample y
+              double y = (*dist)(*generator.getLocal());
+              y = y * upper_bound;
+
+              if (y <= lower_bound) {
+                //accept this sample
+                walk.push_back(std::move(nbr));
+                break;
+              } else {
+                //compute transition probability
+                double alpha;
+
+                //check if nbr is same as the previous node on this walk
+                if (nbr == prev) {
+                  alpha = prob_backward;
+                }  //check if nbr is also a neighbor of the previous node on this walk
+                else if (graph.HasEdge(prev, nbr)) {
+                  alpha = 1.0;
+                } else {
+                  alpha = prob_forward;
+                }
+
+                if (y <= alpha) {
+                  //accept y
+                  walk.push_back(std::move(nbr));
+                  break;
+                }
+              }
+            }
+          }
+
+          walks->push(std::move(walk));
+        },
+        katana::steal(), katana::chunk_size<RandomWalksPlan::kChunkSize>(),
+        katana::loopname("Node2vec weighted walks"), katana::no_stats());
+
+    for (uint32_t i = 0; i < distribution.size(); i++) {
+      delete (*distribution.getRemote(i));
+    }
+  }
+
+  void operator()(
+      const SortedGraphView& graph,
+      katana::InsertBag<std::vector<uint32_t>>* walks,
+      const katana::NUMAArray<uint64_t>& degree) {
+    BuildAliasTables(graph);
+    GraphRandomWalk(graph, walks, degree);
+  }
+};
+
 struct Edge2VecAlgo {
   using EdgeType = katana::UInt32Property;
 
@@ -522,6 +749,62 @@ katana::analytics::RandomWalks(PropertyGraph* pg, RandomWalksPlan plan) {
   }
 }
 
+template <typename EdgeWeightType>
+static katana::Result<std::vector<std::vector<uint32_t>>>
+WeightedRandomWalksWithWrap(
+    katana::PropertyGraph* pg, const std::string& edge_weight_property_name,
+    RandomWalksPlan plan) {
+  auto graph =
+      KATANA_CHECKED(Node2VecWeightedAlgo<EdgeWeightType>::SortedGraphView::
+                         Make(pg, {}, {edge_weight_property_name}));
+  return RandomWalksWithWrap<Node2VecWeightedAlgo<EdgeWeightType>>(
+      graph, plan);
+}
+
+katana::Result<std::vector<std::vector<uint32_t>>>
+katana::analytics::WeightedRandomWalks(
+    PropertyGraph* pg, const std::string& edge_weight_property_name,
+    RandomWalksPlan plan) {
+  if (plan.algorithm() != RandomWalksPlan::kNode2Vec) {
+    return KATANA_ERROR(
+        katana::ErrorCode::NotImplemented,
+        "weighted random walks are only implemented for node2vec");
+  }
+  if (!pg->HasEdgeProperty(edge_weight_property_name)) {
+    return KATANA_ERROR(
+        katana::ErrorCode::NotFound, "Edge Property: {} Not found",
+        edge_weight_property_name);
+  }
+  switch (KATANA_CHECKED(pg->GetEdgeProperty(edge_weight_property_name))
+              ->type()
+              ->id()) {
+  case arrow::UInt32Type::type_id:
+    return WeightedRandomWalksWithWrap<uint32_t>(
+        pg, edge_weight_property_name, plan);
+  case arrow::Int32Type::type_id:
+    return WeightedRandomWalksWithWrap<int32_t>(
+        pg, edge_weight_property_name, plan);
+  case arrow::UInt64Type::type_id:
+    return WeightedRandomWalksWithWrap<uint64_t>(
+        pg, edge_weight_property_name, plan);
+  case arrow::Int64Type::type_id:
+    return WeightedRandomWalksWithWrap<int64_t>(
+        pg, edge_weight_property_name, plan);
+  case arrow::FloatType::type_id:
+    return WeightedRandomWalksWithWrap<float>(
+        pg, edge_weight_property_name, plan);
+  case arrow::DoubleType::type_id:
+    return WeightedRandomWalksWithWrap<double>(
+        pg, edge_weight_property_name, plan);
+  default:
+    return KATANA_ERROR(
+        katana::ErrorCode::TypeError, "Unsupported type: {}",
+        KATANA_CHECKED(pg->GetEdgeProperty(edge_weight_property_name))
+            ->type()
+            ->ToString());
+  }
+}
+
 /// \cond DO_NOT_DOCUMENT
 katana::Result<void>
 katana::analytics::RandomWalksAssertValid(
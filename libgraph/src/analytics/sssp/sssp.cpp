@@ -19,10 +19,14 @@
 
 #include "katana/analytics/sssp/sssp.h"
 
+#include <type_traits>
+
 #include "katana/Reduction.h"
 #include "katana/Statistics.h"
 #include "katana/TypedPropertyGraph.h"
 #include "katana/analytics/BfsSsspImplementationBase.h"
+#include "katana/analytics/GpuBackend.h"
+#include "katana/analytics/PlanProfile.h"
 #include "katana/gstl.h"
 
 using namespace katana::analytics;
@@ -35,21 +39,36 @@ struct SsspNodeDistance : public katana::AtomicPODProperty<Weight> {};
 template <typename Weight>
 using SsspEdgeWeight = katana::PODProperty<Weight>;
 
+/// Compile-time stand-in for the copied-out edge weight array on
+/// uniform-weight runs: every subscript folds to the constant 1, so the
+/// per-edge weight load disappears from the relaxation loops entirely.
 template <typename Weight>
+struct UniformUnitWeight {
+  constexpr Weight operator[](size_t) const noexcept { return Weight{1}; }
+};
+
+/// kUniformWeight = true instantiates the unweighted fast path: the typed
+/// graph carries no edge weight column, weight loads fold to 1 at compile
+/// time, and delta-stepping runs with a step shift of 0 so its buckets
+/// degenerate to plain BFS levels.
+template <typename Weight, bool kUniformWeight = false>
 struct SsspImplementation : public katana::analytics::BfsSsspImplementationBase<
                                 katana::TypedPropertyGraph<
                                     std::tuple<SsspNodeDistance<Weight>>,
-                                    std::tuple<SsspEdgeWeight<Weight>>>,
-                                Weight, true> {
+                                    std::conditional_t<
+                                        kUniformWeight, std::tuple<>,
+                                        std::tuple<SsspEdgeWeight<Weight>>>>,
+                                Weight, !kUniformWeight> {
   using NodeDistance = SsspNodeDistance<Weight>;
   using EdgeWeight = SsspEdgeWeight<Weight>;
 
   using NodeData = typename std::tuple<NodeDistance>;
-  using EdgeData = typename std::tuple<EdgeWeight>;
+  using EdgeData = std::conditional_t<
+      kUniformWeight, std::tuple<>, std::tuple<EdgeWeight>>;
   using Graph = katana::TypedPropertyGraph<NodeData, EdgeData>;
 
-  using Base =
-      katana::analytics::BfsSsspImplementationBase<Graph, Weight, true>;
+  using Base = katana::analytics::BfsSsspImplementationBase<
+      Graph, Weight, !kUniformWeight>;
 
   using Dist = typename Base::Dist;
   using UpdateRequest = typename Base::UpdateRequest;
@@ -70,10 +89,12 @@ struct SsspImplementation : public katana::analytics::BfsSsspImplementationBase<
   using OBIMBarrier = typename katana::OrderedByIntegerMetric<
       UpdateRequestIndexer, PSchunk>::template with_barrier<true>::type;
 
-  template <typename T, typename OBIMTy = OBIM, typename P, typename R>
+  template <
+      typename T, typename OBIMTy = OBIM, typename EdgeWts, typename P,
+      typename R>
   static void DeltaStepAlgo(
       katana::NUMAArray<std::atomic<Weight>>* node_data,
-      katana::NUMAArray<Weight>* edge_data, Graph* graph,
+      const EdgeWts* edge_data, Graph* graph,
       const typename Graph::Node& source, const P& pushWrap, const R& edgeRange,
       unsigned stepShift) {
     //! [reducible for self-defined stats]
@@ -125,9 +146,10 @@ struct SsspImplementation : public katana::analytics::BfsSsspImplementationBase<
     }
   }
 
+  template <typename EdgeWts>
   static void DeltaStepFusionAlgo(
       katana::NUMAArray<std::atomic<Weight>>* node_data,
-      katana::NUMAArray<Weight>* edge_data, Graph* graph,
+      const EdgeWts* edge_data, Graph* graph,
       const typename Graph::Node& source, unsigned stepShift) {
     constexpr size_t kMaxFusion = 1000;
 
@@ -172,7 +194,8 @@ struct SsspImplementation : public katana::analytics::BfsSsspImplementationBase<
               relax(n, sdist, *buckets.getLocal());
             }
           },
-          katana::wl<PSchunk>, katana::steal());
+          katana::steal(), katana::chunk_size<kChunkSize>(),
+          katana::loopname("SSSP-fusion"));
 
       katana::GReduceMin<size_t> least_bucket;
 
@@ -199,7 +222,7 @@ struct SsspImplementation : public katana::analytics::BfsSsspImplementationBase<
         }
       });
 
-      wl.clear();
+      wl.clear_and_keep_capacity();
 
       cur_bucket = least_bucket.reduce();
       if (cur_bucket == std::numeric_limits<size_t>::max()) {
@@ -419,17 +442,24 @@ public:
     bool use_block = false;
     if (use_block) {
       node_data.allocateBlocked(graph.size());
-      edge_data.allocateBlocked(graph.NumEdges());
     } else {
       node_data.allocateInterleaved(graph.size());
-      edge_data.allocateInterleaved(graph.NumEdges());
+    }
+    if constexpr (!kUniformWeight) {
+      if (use_block) {
+        edge_data.allocateBlocked(graph.NumEdges());
+      } else {
+        edge_data.allocateInterleaved(graph.NumEdges());
+      }
     }
 
     katana::do_all(katana::iterate(graph), [&](const typename Graph::Node& n) {
       graph.template GetData<NodeDistance>(n) = kDistanceInfinity;
       node_data[n] = kDistanceInfinity;
-      for (auto e : graph.OutEdges(n)) {
-        edge_data[e] = graph.template GetEdgeData<EdgeWeight>(e);
+      if constexpr (!kUniformWeight) {
+        for (auto e : graph.OutEdges(n)) {
+          edge_data[e] = graph.template GetEdgeData<EdgeWeight>(e);
+        }
       }
     });
 
@@ -440,50 +470,85 @@ public:
     execTime.start();
 
     if (plan.algorithm() == SsspPlan::kAutomatic) {
-      plan = SsspPlan(&graph.GetPropertyGraph());
+      plan = AutoTuneSsspPlan(GetPlanProfile(graph.GetPropertyGraph()));
     }
 
+    // Weight source for the delta-stepping family: the copied-out array, or
+    // the compile-time unit weight. With unit weights a step shift of 0
+    // makes each OBIM bucket exactly one BFS level, so no relaxation is
+    // ever retracted.
+    [[maybe_unused]] const UniformUnitWeight<Weight> unit_weights;
+    auto delta_weights = [&]() {
+      if constexpr (kUniformWeight) {
+        return &unit_weights;
+      } else {
+        return &edge_data;
+      }
+    }();
+    const unsigned step_shift = kUniformWeight ? 0 : plan.delta();
+
     switch (plan.algorithm()) {
     case SsspPlan::kDeltaTile:
       DeltaStepAlgo<SrcEdgeTile>(
-          &node_data, &edge_data, &graph, source,
-          SrcEdgeTilePushWrap{&graph, *this}, TileRangeFn(), plan.delta());
+          &node_data, delta_weights, &graph, source,
+          SrcEdgeTilePushWrap{&graph, *this}, TileRangeFn(), step_shift);
       break;
     case SsspPlan::kDeltaStep:
       DeltaStepAlgo<UpdateRequest>(
-          &node_data, &edge_data, &graph, source, ReqPushWrap(),
-          OutEdgeRangeFn{&graph}, plan.delta());
+          &node_data, delta_weights, &graph, source, ReqPushWrap(),
+          OutEdgeRangeFn{&graph}, step_shift);
       break;
     case SsspPlan::kDeltaStepBarrier:
       DeltaStepAlgo<UpdateRequest, OBIMBarrier>(
-          &node_data, &edge_data, &graph, source, ReqPushWrap(),
-          OutEdgeRangeFn{&graph}, plan.delta());
+          &node_data, delta_weights, &graph, source, ReqPushWrap(),
+          OutEdgeRangeFn{&graph}, step_shift);
       break;
     case SsspPlan::kDeltaStepFusion:
-      DeltaStepFusionAlgo(&node_data, &edge_data, &graph, source, plan.delta());
+      DeltaStepFusionAlgo(
+          &node_data, delta_weights, &graph, source, step_shift);
       break;
     case SsspPlan::kSerialDeltaTile:
-      SerDeltaAlgo<SrcEdgeTile>(
-          &graph, source, SrcEdgeTilePushWrap{&graph, *this}, TileRangeFn(),
-          plan.delta());
-      break;
     case SsspPlan::kSerialDelta:
-      SerDeltaAlgo<UpdateRequest>(
-          &graph, source, ReqPushWrap(), OutEdgeRangeFn{&graph}, plan.delta());
-      break;
     case SsspPlan::kDijkstraTile:
-      DijkstraAlgo<SrcEdgeTile>(
-          &graph, source, SrcEdgeTilePushWrap{&graph, *this}, TileRangeFn());
-      break;
     case SsspPlan::kDijkstra:
-      DijkstraAlgo<UpdateRequest>(
-          &graph, source, ReqPushWrap(), OutEdgeRangeFn{&graph});
-      break;
     case SsspPlan::kTopological:
-      TopoAlgo(&graph, source);
-      break;
     case SsspPlan::kTopologicalTile:
-      TopoTileAlgo(&graph, source);
+      // These algorithms read weights straight from the typed view, which
+      // the uniform-weight instantiation does not carry; the entry point
+      // routes them through the weighted path instead.
+      if constexpr (kUniformWeight) {
+        return katana::ErrorCode::InvalidArgument;
+      } else {
+        switch (plan.algorithm()) {
+        case SsspPlan::kSerialDeltaTile:
+          SerDeltaAlgo<SrcEdgeTile>(
+              &graph, source, SrcEdgeTilePushWrap{&graph, *this},
+              TileRangeFn(), plan.delta());
+          break;
+        case SsspPlan::kSerialDelta:
+          SerDeltaAlgo<UpdateRequest>(
+              &graph, source, ReqPushWrap(), OutEdgeRangeFn{&graph},
+              plan.delta());
+          break;
+        case SsspPlan::kDijkstraTile:
+          DijkstraAlgo<SrcEdgeTile>(
+              &graph, source, SrcEdgeTilePushWrap{&graph, *this},
+              TileRangeFn());
+          break;
+        case SsspPlan::kDijkstra:
+          DijkstraAlgo<UpdateRequest>(
+              &graph, source, ReqPushWrap(), OutEdgeRangeFn{&graph});
+          break;
+        case SsspPlan::kTopological:
+          TopoAlgo(&graph, source);
+          break;
+        case SsspPlan::kTopologicalTile:
+          TopoTileAlgo(&graph, source);
+          break;
+        default:
+          return katana::ErrorCode::InvalidArgument;
+        }
+      }
       break;
     default:
       return katana::ErrorCode::InvalidArgument;
@@ -511,6 +576,25 @@ Sssp(
   return impl.SSSP(pg, start_node, plan);
 }
 
+/// Unweighted entry: builds a typed view without a weight column and runs
+/// the unit-weight instantiation. Only valid for the delta-stepping family.
+template <typename Weight>
+katana::Result<void>
+SSSPUniformWithWrap(
+    katana::PropertyGraph* pg, size_t start_node,
+    const std::string& output_property_name, SsspPlan plan,
+    katana::TxnContext* txn_ctx) {
+  static_assert(std::is_integral_v<Weight>);
+  KATANA_CHECKED(
+      pg->ConstructNodeProperties<std::tuple<SsspNodeDistance<Weight>>>(
+          txn_ctx, {output_property_name}));
+  using Impl = SsspImplementation<Weight, /*kUniformWeight=*/true>;
+  typename Impl::Graph graph =
+      KATANA_CHECKED(Impl::Graph::Make(pg, {output_property_name}, {}));
+  Impl impl{{plan.edge_tile_size()}};
+  return impl.SSSP(graph, start_node, plan);
+}
+
 template <typename Weight>
 static katana::Result<void>
 SSSPWithWrap(
@@ -518,12 +602,18 @@ SSSPWithWrap(
     const std::string& edge_weight_property_name,
     const std::string& output_property_name, SsspPlan plan,
     katana::TxnContext* txn_ctx) {
+  // start the edge weight read now so it overlaps with allocating the
+  // output column below; the future is resolved before the typed view is
+  // built
+  plan.RequireEdgeProperty(edge_weight_property_name);
+  auto prefetch = katana::analytics::PrefetchRequiredProperties(pg, plan);
   if (auto r =
           pg->ConstructNodeProperties<std::tuple<SsspNodeDistance<Weight>>>(
               txn_ctx, {output_property_name});
       !r) {
     return r.error();
   }
+  KATANA_CHECKED(prefetch.get());
   auto graph = katana::TypedPropertyGraph<
       std::tuple<SsspNodeDistance<Weight>>,
       std::tuple<SsspEdgeWeight<Weight>>>::
@@ -549,18 +639,47 @@ katana::analytics::Sssp(
     const std::string& edge_weight_property_name,
     const std::string& output_property_name, katana::TxnContext* txn_ctx,
     SsspPlan plan) {
+  if (plan.architecture() == kGPU) {
+    const GpuBackend* backend = GetGpuBackend();
+    if (backend != nullptr && backend->sssp != nullptr) {
+      return backend->sssp(
+          pg, start_node, edge_weight_property_name, output_property_name,
+          txn_ctx);
+    }
+    KATANA_LOG_WARN(
+        "plan requests GPU execution but no GPU backend implements SSSP; "
+        "falling back to the CPU algorithm");
+  }
+
   if (!edge_weight_property_name.empty() &&
       !pg->HasEdgeProperty(edge_weight_property_name)) {
     return KATANA_ERROR(
         katana::ErrorCode::NotFound, "Edge Property: {} Not found",
         edge_weight_property_name);
   }
-  // If edge property name empty, add int64_t property
-  // add initialize it to 1.
   if (edge_weight_property_name.empty()) {
+    using EdgeWeightType = int64_t;
+    // The delta-stepping family has a compile-time unit-weight
+    // instantiation that needs no weight column and degenerates to BFS
+    // level bucketing, so prefer it over materializing a temporary
+    // weight-1 property. kAutomatic always resolves to a delta-step
+    // variant.
+    switch (plan.algorithm()) {
+    case SsspPlan::kAutomatic:
+    case SsspPlan::kDeltaTile:
+    case SsspPlan::kDeltaStep:
+    case SsspPlan::kDeltaStepBarrier:
+    case SsspPlan::kDeltaStepFusion:
+      return SSSPUniformWithWrap<EdgeWeightType>(
+          pg, start_node, output_property_name, plan, txn_ctx);
+    default:
+      break;
+    }
+
+    // The remaining algorithms read weights from the typed view, so add a
+    // temporary property initialized to 1.
     TemporaryPropertyGuard temporary_edge_property{
         pg->EdgeMutablePropertyView()};
-    using EdgeWeightType = int64_t;
     KATANA_CHECKED(katana::analytics::AddDefaultEdgeWeight<EdgeWeightType>(
         pg, temporary_edge_property.name(), 1, txn_ctx));
 
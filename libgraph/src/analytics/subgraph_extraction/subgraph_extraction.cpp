@@ -21,6 +21,8 @@
 
 #include <iostream>
 
+#include <arrow/compute/api_vector.h>
+
 #include "katana/PropertyGraph.h"
 #include "katana/TypedPropertyGraph.h"
 #include "katana/analytics/Utils.h"
@@ -90,6 +92,168 @@ SubGraphNodeSet(
 
   return sub_g_res;
 }
+
+/// Slice the named columns (all of them when names is empty) down to the
+/// rows in prop_indices with a single Arrow take per table. Returns null
+/// when there is nothing to copy.
+katana::Result<std::shared_ptr<arrow::Table>>
+TakeColumns(
+    const std::shared_ptr<arrow::Schema>& schema,
+    const std::vector<std::shared_ptr<arrow::ChunkedArray>>& all_columns,
+    const std::vector<std::string>& names,
+    const katana::NUMAArray<uint64_t>& prop_indices) {
+  std::vector<std::shared_ptr<arrow::Field>> fields;
+  std::vector<std::shared_ptr<arrow::ChunkedArray>> columns;
+  if (names.empty()) {
+    fields = schema->fields();
+    columns = all_columns;
+  } else {
+    for (const std::string& name : names) {
+      int idx = schema->GetFieldIndex(name);
+      if (idx < 0) {
+        return KATANA_ERROR(
+            katana::ErrorCode::NotFound, "Property: {} Not found", name);
+      }
+      fields.emplace_back(schema->field(idx));
+      columns.emplace_back(all_columns[idx]);
+    }
+  }
+  if (columns.empty()) {
+    return nullptr;
+  }
+
+  arrow::UInt64Builder builder;
+  KATANA_CHECKED(builder.Resize(prop_indices.size()));
+  for (uint64_t idx : prop_indices) {
+    builder.UnsafeAppend(idx);
+  }
+  std::shared_ptr<arrow::Array> indices = KATANA_CHECKED(builder.Finish());
+
+  auto table = arrow::Table::Make(arrow::schema(fields), columns);
+  arrow::Datum taken = KATANA_CHECKED(arrow::compute::Take(table, indices));
+  return taken.table();
+}
+
+katana::Result<std::unique_ptr<katana::PropertyGraph>>
+SubGraphNodeSetWithProperties(
+    katana::PropertyGraph* pg, const SortedGraphView& graph,
+    const std::vector<Node>& node_set,
+    const std::vector<std::string>& node_properties_to_copy,
+    const std::vector<std::string>& edge_properties_to_copy,
+    katana::TxnContext* txn_ctx) {
+  uint64_t num_nodes = node_set.size();
+  // Subgraph topology : out indices
+  katana::NUMAArray<Edge> out_indices;
+  out_indices.allocateInterleaved(num_nodes);
+
+  // Each extracted edge carries its original property index along so the
+  // property slice and the type remap below need no second lookup.
+  katana::gstl::Vector<katana::gstl::Vector<std::pair<Node, uint64_t>>>
+      subgraph_edges;
+  subgraph_edges.resize(num_nodes);
+
+  katana::do_all(
+      katana::iterate(Node(0), Node(num_nodes)),
+      [&](const Node& n) {
+        Node src = node_set[n];
+
+        auto last = graph.OutEdges(src).end();
+        for (Node m = 0; m < num_nodes; ++m) {
+          auto dest = node_set[m];
+          // Binary search on the edges sorted by destination id
+          for (auto edge_it = graph.FindEdge(src, dest);
+               edge_it != last && graph.OutEdgeDst(*edge_it) == dest;
+               ++edge_it) {
+            subgraph_edges[n].push_back(
+                {m, graph.GetEdgePropertyIndexFromOutEdge(*edge_it)});
+          }
+        }
+        out_indices[n] = subgraph_edges[n].size();
+      },
+      katana::steal(), katana::loopname("SubgraphExtraction"));
+
+  // Prefix sum
+  katana::ParallelSTL::partial_sum(
+      out_indices.begin(), out_indices.end(), out_indices.begin());
+  uint64_t num_edges = out_indices[num_nodes - 1];
+
+  // Subgraph topology : out dests
+  katana::NUMAArray<Node> out_dests;
+  out_dests.allocateInterleaved(num_edges);
+  katana::NUMAArray<uint64_t> edge_prop_indices;
+  edge_prop_indices.allocateInterleaved(num_edges);
+
+  katana::do_all(
+      katana::iterate(Node(0), Node(num_nodes)),
+      [&](const Node& n) {
+        uint64_t offset = n == 0 ? 0 : out_indices[n - 1];
+        for (const auto& [dest, orig_prop_index] : subgraph_edges[n]) {
+          out_dests[offset] = dest;
+          edge_prop_indices[offset] = orig_prop_index;
+          offset++;
+        }
+      },
+      katana::steal(), katana::loopname("ConstructTopology"));
+
+  // Remap EntityTypeIDs of the extracted nodes and edges; the type managers
+  // are copied wholesale so the ids stay meaningful.
+  katana::NUMAArray<uint64_t> node_prop_indices;
+  node_prop_indices.allocateInterleaved(num_nodes);
+  katana::PropertyGraph::EntityTypeIDArray node_type_ids;
+  node_type_ids.allocateInterleaved(num_nodes);
+  katana::do_all(
+      katana::iterate(Node(0), Node(num_nodes)), [&](const Node& n) {
+        node_prop_indices[n] = graph.GetNodePropertyIndex(node_set[n]);
+        node_type_ids[n] =
+            pg->GetTypeOfNodeFromPropertyIndex(node_prop_indices[n]);
+      });
+
+  katana::PropertyGraph::EntityTypeIDArray edge_type_ids;
+  edge_type_ids.allocateInterleaved(num_edges);
+  katana::do_all(
+      katana::iterate(uint64_t{0}, num_edges), [&](uint64_t e) {
+        edge_type_ids[e] =
+            pg->GetTypeOfEdgeFromPropertyIndex(edge_prop_indices[e]);
+      });
+
+  katana::GraphTopology sub_g_topo{std::move(out_indices),
+                                   std::move(out_dests)};
+  std::unique_ptr<katana::PropertyGraph> sub_g =
+      KATANA_CHECKED(katana::PropertyGraph::Make(
+          std::move(sub_g_topo), std::move(node_type_ids),
+          std::move(edge_type_ids),
+          katana::EntityTypeManager(pg->GetNodeTypeManager()),
+          katana::EntityTypeManager(pg->GetEdgeTypeManager())));
+
+  // Slice the property columns onto the new graph.
+  if (!node_properties_to_copy.empty() || pg->GetNumNodeProperties() > 0) {
+    std::vector<std::shared_ptr<arrow::ChunkedArray>> columns;
+    for (int32_t i = 0; i < pg->GetNumNodeProperties(); ++i) {
+      columns.emplace_back(pg->GetNodeProperty(i));
+    }
+    std::shared_ptr<arrow::Table> table = KATANA_CHECKED(TakeColumns(
+        pg->loaded_node_schema(), columns, node_properties_to_copy,
+        node_prop_indices));
+    if (table) {
+      KATANA_CHECKED(sub_g->AddNodeProperties(table, txn_ctx));
+    }
+  }
+
+  if (!edge_properties_to_copy.empty() || pg->GetNumEdgeProperties() > 0) {
+    std::vector<std::shared_ptr<arrow::ChunkedArray>> columns;
+    for (int32_t i = 0; i < pg->GetNumEdgeProperties(); ++i) {
+      columns.emplace_back(pg->GetEdgeProperty(i));
+    }
+    std::shared_ptr<arrow::Table> table = KATANA_CHECKED(TakeColumns(
+        pg->loaded_edge_schema(), columns, edge_properties_to_copy,
+        edge_prop_indices));
+    if (table) {
+      KATANA_CHECKED(sub_g->AddEdgeProperties(table, txn_ctx));
+    }
+  }
+
+  return sub_g;
+}
 }  // namespace
 
 katana::Result<std::unique_ptr<katana::PropertyGraph>>
@@ -124,3 +288,39 @@ katana::analytics::SubGraphExtraction(
     return katana::ErrorCode::InvalidArgument;
   }
 }
+
+katana::Result<std::unique_ptr<katana::PropertyGraph>>
+katana::analytics::SubGraphExtractionWithProperties(
+    katana::PropertyGraph* pg, const std::vector<Node>& node_vec,
+    const std::vector<std::string>& node_properties_to_copy,
+    const std::vector<std::string>& edge_properties_to_copy,
+    katana::TxnContext* txn_ctx, SubGraphExtractionPlan plan) {
+  // Remove duplicates from the node vector
+  std::unordered_set<uint32_t> set;
+  std::vector<uint32_t> dedup_node_vec;
+  for (auto n : node_vec) {
+    if (set.insert(n).second) {  // If n wasn't already present.
+      dedup_node_vec.push_back(n);
+    }
+  }
+
+  if (dedup_node_vec.empty()) {
+    return std::make_unique<katana::PropertyGraph>();
+  }
+
+  SortedGraphView sg = pg->BuildView<SortedGraphView>();
+
+  katana::StatTimer execTime("SubGraph-Extraction");
+  switch (plan.algorithm()) {
+  case SubGraphExtractionPlan::kNodeSet: {
+    execTime.start();
+    auto subgraph = SubGraphNodeSetWithProperties(
+        pg, sg, dedup_node_vec, node_properties_to_copy,
+        edge_properties_to_copy, txn_ctx);
+    execTime.stop();
+    return subgraph;
+  }
+  default:
+    return katana::ErrorCode::InvalidArgument;
+  }
+}
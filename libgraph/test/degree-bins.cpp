@@ -0,0 +1,83 @@
+#include "katana/DegreeBins.h"
+
+#include <atomic>
+#include <vector>
+
+#include "katana/Logging.h"
+#include "katana/PropertyGraph.h"
+#include "katana/SharedMemSys.h"
+#include "katana/TopologyGeneration.h"
+
+using katana::DegreeBins;
+using Node = katana::GraphTopology::Node;
+
+namespace {
+
+void
+TestGraph(katana::PropertyGraph* pg) {
+  const katana::GraphTopology& topo = pg->topology();
+  std::shared_ptr<const DegreeBins> bins = pg->BuildOrGetDegreeBins();
+
+  KATANA_LOG_ASSERT(bins->NumNodes() == topo.NumNodes());
+  KATANA_LOG_ASSERT(bins->NumEdges() == topo.NumEdges());
+
+  // The bins partition the nodes: every node appears exactly once, in
+  // the bin matching its out-degree, in ascending id order within the
+  // bin.
+  std::vector<uint32_t> seen(topo.NumNodes(), 0);
+  for (size_t b = 0; b < DegreeBins::kNumBins; ++b) {
+    Node previous = 0;
+    bool first = true;
+    for (Node n : bins->BinNodes(b)) {
+      seen[n] += 1;
+      KATANA_LOG_VASSERT(
+          DegreeBins::BinIndex(topo.OutDegree(n)) == b,
+          "node {} with degree {} landed in bin {}", n, topo.OutDegree(n), b);
+      KATANA_LOG_ASSERT(first || n > previous);
+      previous = n;
+      first = false;
+    }
+  }
+  for (Node n = 0; n < topo.NumNodes(); ++n) {
+    KATANA_LOG_VASSERT(seen[n] == 1, "node {} binned {} times", n, seen[n]);
+  }
+
+  // The bucketed do_all visits every node once and hands each bin's
+  // operator instantiation the right degree bound.
+  std::vector<std::atomic<uint32_t>> visits(topo.NumNodes());
+  katana::DoAllByDegreeBin(
+      *bins,
+      [&](const Node& n, auto degree_bound) {
+        constexpr uint32_t bound = decltype(degree_bound)::value;
+        if constexpr (bound != DegreeBins::kUnbounded) {
+          KATANA_LOG_ASSERT(topo.OutDegree(n) <= bound);
+        } else {
+          KATANA_LOG_ASSERT(
+              topo.OutDegree(n) >
+              DegreeBins::kBinMaxDegree[DegreeBins::kNumBins - 2]);
+        }
+        visits[n].fetch_add(1, std::memory_order_relaxed);
+      },
+      katana::steal());
+  for (Node n = 0; n < topo.NumNodes(); ++n) {
+    KATANA_LOG_VASSERT(
+        visits[n].load() == 1, "node {} visited {} times", n, visits[n].load());
+  }
+
+  // Repeated requests hit the cache.
+  KATANA_LOG_ASSERT(pg->BuildOrGetDegreeBins() == bins);
+}
+
+}  // namespace
+
+int
+main() {
+  katana::SharedMemSys sys;
+
+  // Skewed degrees populate the hub bin; the grid covers degree-0 and
+  // tiny-degree nodes.
+  TestGraph(katana::MakeRMATGraph(10, 8 * 1024, 0.57, 0.19, 0.19, 42).get());
+  TestGraph(katana::MakeGrid(40, 25, false).get());
+
+  return 0;
+}
@@ -0,0 +1,193 @@
+#include "katana/DirectionOptimizingExecutor.h"
+
+#include <deque>
+#include <limits>
+#include <random>
+#include <set>
+#include <vector>
+
+#include "katana/Logging.h"
+#include "katana/SharedMemSys.h"
+
+using katana::GraphTopology;
+using Node = GraphTopology::Node;
+
+namespace {
+
+constexpr uint32_t kInfinity = std::numeric_limits<uint32_t>::max();
+
+/// Builds a symmetric topology from an undirected edge list: every edge
+/// is inserted in both directions so pull rounds can read out-edges as
+/// in-edges.
+GraphTopology
+MakeSymmetricTopology(
+    Node num_nodes, const std::vector<std::pair<Node, Node>>& edges) {
+  std::vector<std::set<Node>> adj(num_nodes);
+  for (const auto& [u, v] : edges) {
+    adj[u].insert(v);
+    adj[v].insert(u);
+  }
+
+  std::vector<GraphTopology::Edge> adj_indices(num_nodes);
+  std::vector<Node> dests;
+  for (Node n = 0; n < num_nodes; ++n) {
+    dests.insert(dests.end(), adj[n].begin(), adj[n].end());
+    adj_indices[n] = dests.size();
+  }
+
+  return GraphTopology(
+      adj_indices.data(), adj_indices.size(), dests.data(), dests.size());
+}
+
+/// 4-neighbor grid; the frontier is a wave that grows and then shrinks.
+GraphTopology
+MakeSymmetricGrid(Node width, Node height) {
+  std::vector<std::pair<Node, Node>> edges;
+  for (Node y = 0; y < height; ++y) {
+    for (Node x = 0; x < width; ++x) {
+      Node n = y * width + x;
+      if (x + 1 < width) {
+        edges.emplace_back(n, n + 1);
+      }
+      if (y + 1 < height) {
+        edges.emplace_back(n, n + width);
+      }
+    }
+  }
+  return MakeSymmetricTopology(width * height, edges);
+}
+
+/// Low-diameter random graph; the frontier explodes after a round or two.
+GraphTopology
+MakeSymmetricRandom(Node num_nodes, size_t num_edges, uint32_t seed) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<Node> pick(0, num_nodes - 1);
+  std::vector<std::pair<Node, Node>> edges;
+  while (edges.size() < num_edges) {
+    Node u = pick(gen);
+    Node v = pick(gen);
+    if (u != v) {
+      edges.emplace_back(u, v);
+    }
+  }
+  return MakeSymmetricTopology(num_nodes, edges);
+}
+
+std::vector<uint32_t>
+SerialDistances(const GraphTopology& topo, Node source) {
+  std::vector<uint32_t> dist(topo.NumNodes(), kInfinity);
+  dist[source] = 0;
+  std::deque<Node> queue{source};
+  while (!queue.empty()) {
+    Node n = queue.front();
+    queue.pop_front();
+    for (auto e : topo.OutEdges(n)) {
+      Node dst = topo.OutEdgeDst(e);
+      if (dist[dst] == kInfinity) {
+        dist[dst] = dist[n] + 1;
+        queue.push_back(dst);
+      }
+    }
+  }
+  return dist;
+}
+
+/// Level-synchronous BFS over a symmetric topology driven by the
+/// executor; pull rounds treat out-edges as in-edges. Returns the
+/// directions the executor picked, one per round.
+std::vector<katana::Direction>
+ExecutorBfs(
+    const GraphTopology& topo, Node source, uint32_t alpha, uint32_t beta,
+    std::vector<uint32_t>* dist_out) {
+  std::vector<std::atomic<uint32_t>> dist(topo.NumNodes());
+  for (auto& d : dist) {
+    d.store(kInfinity, std::memory_order_relaxed);
+  }
+  dist[source] = 0;
+
+  std::vector<katana::Direction> directions;
+  katana::DirectionOptimizingExecutor<GraphTopology> executor(
+      topo, alpha, beta);
+  executor.ActivateSeed(source);
+
+  uint32_t level = 0;
+  executor.Execute([&](katana::Direction dir) {
+    directions.push_back(dir);
+    level += 1;
+    if (dir == katana::Direction::kPull) {
+      katana::do_all(katana::iterate(topo.Nodes()), [&](Node n) {
+        if (dist[n].load(std::memory_order_relaxed) != kInfinity) {
+          return;
+        }
+        for (auto e : topo.OutEdges(n)) {
+          if (executor.InFrontier(topo.OutEdgeDst(e))) {
+            dist[n].store(level, std::memory_order_relaxed);
+            executor.Activate(n);
+            break;
+          }
+        }
+      });
+    } else {
+      katana::do_all(katana::iterate(executor.FrontierBag()), [&](Node n) {
+        for (auto e : topo.OutEdges(n)) {
+          Node dst = topo.OutEdgeDst(e);
+          uint32_t old = kInfinity;
+          if (dist[dst].compare_exchange_strong(
+                  old, level, std::memory_order_relaxed)) {
+            executor.Activate(dst);
+          }
+        }
+      });
+    }
+  });
+
+  KATANA_LOG_ASSERT(executor.rounds() == directions.size());
+
+  dist_out->assign(dist.begin(), dist.end());
+  return directions;
+}
+
+void
+TestGraph(const GraphTopology& topo, Node source) {
+  const std::vector<uint32_t> expected = SerialDistances(topo, source);
+
+  // Default thresholds: the search must be exact regardless of how the
+  // cost model splits the rounds, and a single-source seed always makes
+  // the first round a push round.
+  std::vector<uint32_t> dist;
+  auto directions = ExecutorBfs(
+      topo, source,
+      katana::DirectionOptimizingExecutor<GraphTopology>::kDefaultAlpha,
+      katana::DirectionOptimizingExecutor<GraphTopology>::kDefaultBeta, &dist);
+  KATANA_LOG_ASSERT(dist == expected);
+  KATANA_LOG_ASSERT(!directions.empty());
+  KATANA_LOG_ASSERT(directions.front() == katana::Direction::kPush);
+
+  // alpha = 1 compares the frontier's out-degree against every unchecked
+  // edge, which it can never exceed, so every round pushes.
+  directions = ExecutorBfs(topo, source, 1, 1, &dist);
+  KATANA_LOG_ASSERT(dist == expected);
+  for (katana::Direction dir : directions) {
+    KATANA_LOG_ASSERT(dir == katana::Direction::kPush);
+  }
+
+  // alpha > |E| drops the push budget to zero, so every round pulls.
+  directions = ExecutorBfs(
+      topo, source, static_cast<uint32_t>(topo.NumEdges() + 1), 1, &dist);
+  KATANA_LOG_ASSERT(dist == expected);
+  for (katana::Direction dir : directions) {
+    KATANA_LOG_ASSERT(dir == katana::Direction::kPull);
+  }
+}
+
+}  // namespace
+
+int
+main() {
+  katana::SharedMemSys sys;
+
+  TestGraph(MakeSymmetricGrid(40, 25), 0);
+  TestGraph(MakeSymmetricRandom(2000, 6000, 17), 37);
+
+  return 0;
+}
@@ -0,0 +1,144 @@
+#include "katana/GroupBy.h"
+
+#include <cmath>
+#include <map>
+
+#include "katana/Logging.h"
+#include "katana/SharedMemSys.h"
+#include "katana/TopologyGeneration.h"
+
+using katana::AggregateOp;
+using katana::AggregateSpec;
+using Node = katana::PropertyGraph::Node;
+using Edge = katana::PropertyGraph::Edge;
+
+namespace {
+
+constexpr int32_t kNumCommunities = 7;
+
+int32_t
+CommunityOf(Node id) {
+  return static_cast<int32_t>(id % kNumCommunities);
+}
+
+double
+RankOf(Node id) {
+  return 0.25 * static_cast<double>(id) + 1.0;
+}
+
+void
+TestNodeGroupBy(const katana::PropertyGraph& pg) {
+  auto table_res = katana::GroupByNodeProperty(
+      pg, "community",
+      {
+          {"", AggregateOp::kCount, "members"},
+          {"rank", AggregateOp::kSum, "rank_sum"},
+          {"rank", AggregateOp::kMin, "rank_min"},
+          {"rank", AggregateOp::kMax, "rank_max"},
+          {"rank", AggregateOp::kMean, "rank_mean"},
+      });
+  KATANA_LOG_ASSERT(table_res);
+  std::shared_ptr<arrow::Table> table = table_res.value();
+
+  // Scalar reference.
+  std::map<int32_t, std::vector<double>> ranks;
+  for (Node id = 0; id < pg.num_nodes(); ++id) {
+    ranks[CommunityOf(id)].push_back(RankOf(id));
+  }
+
+  KATANA_LOG_ASSERT(table->num_rows() == kNumCommunities);
+  KATANA_LOG_ASSERT(table->num_columns() == 6);
+
+  auto keys = std::static_pointer_cast<arrow::Int64Array>(
+      table->GetColumnByName("community")->chunk(0));
+  auto members = std::static_pointer_cast<arrow::Int64Array>(
+      table->GetColumnByName("members")->chunk(0));
+  auto sums = std::static_pointer_cast<arrow::DoubleArray>(
+      table->GetColumnByName("rank_sum")->chunk(0));
+  auto mins = std::static_pointer_cast<arrow::DoubleArray>(
+      table->GetColumnByName("rank_min")->chunk(0));
+  auto maxs = std::static_pointer_cast<arrow::DoubleArray>(
+      table->GetColumnByName("rank_max")->chunk(0));
+  auto means = std::static_pointer_cast<arrow::DoubleArray>(
+      table->GetColumnByName("rank_mean")->chunk(0));
+
+  for (int64_t row = 0; row < table->num_rows(); ++row) {
+    // Keys come back sorted, so row i is community i here.
+    KATANA_LOG_ASSERT(keys->Value(row) == row);
+    const std::vector<double>& group = ranks[static_cast<int32_t>(row)];
+    double sum = 0.0;
+    double min = group.front();
+    double max = group.front();
+    for (double r : group) {
+      sum += r;
+      min = std::min(min, r);
+      max = std::max(max, r);
+    }
+    KATANA_LOG_VASSERT(
+        members->Value(row) == static_cast<int64_t>(group.size()),
+        "bad count for community {}", row);
+    KATANA_LOG_ASSERT(std::abs(sums->Value(row) - sum) < 1e-9);
+    KATANA_LOG_ASSERT(mins->Value(row) == min);
+    KATANA_LOG_ASSERT(maxs->Value(row) == max);
+    KATANA_LOG_ASSERT(
+        std::abs(means->Value(row) - sum / group.size()) < 1e-9);
+  }
+}
+
+void
+TestEdgeGroupBy(const katana::PropertyGraph& pg) {
+  auto table_res = katana::GroupByEdgeProperty(
+      pg, "type_pair", {{"", AggregateOp::kCount, "edges"}});
+  KATANA_LOG_ASSERT(table_res);
+  std::shared_ptr<arrow::Table> table = table_res.value();
+
+  std::map<int64_t, int64_t> expected;
+  for (Edge e = 0; e < pg.num_edges(); ++e) {
+    expected[static_cast<int64_t>(e % 4)] += 1;
+  }
+
+  KATANA_LOG_ASSERT(
+      table->num_rows() == static_cast<int64_t>(expected.size()));
+  auto keys = std::static_pointer_cast<arrow::Int64Array>(
+      table->GetColumnByName("type_pair")->chunk(0));
+  auto counts = std::static_pointer_cast<arrow::Int64Array>(
+      table->GetColumnByName("edges")->chunk(0));
+  for (int64_t row = 0; row < table->num_rows(); ++row) {
+    KATANA_LOG_ASSERT(counts->Value(row) == expected[keys->Value(row)]);
+  }
+}
+
+}  // namespace
+
+int
+main() {
+  katana::SharedMemSys sys;
+
+  std::unique_ptr<katana::PropertyGraph> pg = katana::MakeGrid(20, 17, true);
+  katana::TxnContext txn_ctx;
+  auto node_res = katana::AddNodeProperties(
+      pg.get(), &txn_ctx,
+      katana::PropertyGenerator(
+          "community", [](Node id) { return CommunityOf(id); }),
+      katana::PropertyGenerator("rank", [](Node id) { return RankOf(id); }));
+  KATANA_LOG_ASSERT(node_res);
+  auto edge_res = katana::AddEdgeProperties(
+      pg.get(), &txn_ctx, katana::PropertyGenerator("type_pair", [](Edge id) {
+        return static_cast<uint8_t>(id % 4);
+      }));
+  KATANA_LOG_ASSERT(edge_res);
+
+  TestNodeGroupBy(*pg);
+  TestEdgeGroupBy(*pg);
+
+  // Keys must be integers, properties must exist, and every aggregate
+  // other than a count needs an input property.
+  KATANA_LOG_ASSERT(!katana::GroupByNodeProperty(
+      *pg, "rank", {{"", AggregateOp::kCount, "n"}}));
+  KATANA_LOG_ASSERT(!katana::GroupByNodeProperty(
+      *pg, "missing", {{"", AggregateOp::kCount, "n"}}));
+  KATANA_LOG_ASSERT(!katana::GroupByNodeProperty(
+      *pg, "community", {{"", AggregateOp::kSum, "s"}}));
+
+  return 0;
+}
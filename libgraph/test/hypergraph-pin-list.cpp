@@ -0,0 +1,75 @@
+#include <vector>
+
+#include "katana/HyperGraph.h"
+#include "katana/Logging.h"
+#include "katana/SharedMemSys.h"
+
+using TestGraph = katana::HyperGraph<uint32_t>;
+
+int
+main() {
+  katana::SharedMemSys sys;
+
+  // Three hyperedges over four vertices, bipartite encoding: hyperedges
+  // are nodes 0-2, vertices are nodes 3-6.
+  //   h0 = {v0, v1, v2}, h1 = {v2, v3}, h2 = {v0}
+  constexpr uint32_t kHedges = 3;
+  constexpr uint32_t kHnodes = 4;
+  constexpr uint32_t kTotalNodes = kHedges + kHnodes;
+  constexpr uint64_t kPins = 6;
+
+  katana::gstl::Vector<katana::PODVector<uint32_t>> edges_id(kTotalNodes);
+  edges_id[0].push_back(3);
+  edges_id[0].push_back(4);
+  edges_id[0].push_back(5);
+  edges_id[1].push_back(5);
+  edges_id[1].push_back(6);
+  edges_id[2].push_back(3);
+
+  katana::NUMAArray<uint64_t> prefix_edges;
+  prefix_edges.allocateInterleaved(kTotalNodes);
+  uint64_t sum = 0;
+  for (uint32_t n = 0; n < kTotalNodes; ++n) {
+    sum += edges_id[n].size();
+    prefix_edges[n] = sum;
+  }
+
+  TestGraph graph;
+  graph.constructFrom(kTotalNodes, kPins, std::move(prefix_edges), edges_id);
+  graph.SetHedges(kHedges);
+  graph.SetHnodes(kHnodes);
+
+  katana::HyperGraphPinList<TestGraph> pins(&graph);
+  KATANA_LOG_ASSERT(pins.NumHedges() == kHedges);
+  KATANA_LOG_ASSERT(pins.NumPins() == kPins);
+
+  // Degree-sorted: h0 (3 pins), then h1 (2), then h2 (1).
+  KATANA_LOG_ASSERT(pins.GetHedgeID(0) == 0);
+  KATANA_LOG_ASSERT(pins.GetHedgeID(1) == 1);
+  KATANA_LOG_ASSERT(pins.GetHedgeID(2) == 2);
+  KATANA_LOG_ASSERT(pins.PinsEnd(0) - pins.PinsBegin(0) == 3);
+  KATANA_LOG_ASSERT(pins.PinsEnd(1) - pins.PinsBegin(1) == 2);
+  KATANA_LOG_ASSERT(pins.PinsEnd(2) - pins.PinsBegin(2) == 1);
+
+  // Pins are rebased to vertex ids in [0, hnodes).
+  KATANA_LOG_ASSERT(pins.PinsBegin(0)[0] == 0);
+  KATANA_LOG_ASSERT(pins.PinsBegin(0)[1] == 1);
+  KATANA_LOG_ASSERT(pins.PinsBegin(0)[2] == 2);
+  KATANA_LOG_ASSERT(pins.PinsBegin(2)[0] == 0);
+
+  // Cut and connectivity against known partition assignments.
+  std::vector<uint32_t> part = {0, 0, 1, 1};
+  auto part_of = [&](uint32_t v) { return part[v]; };
+  KATANA_LOG_ASSERT(pins.ComputeCut(part_of) == 1);
+  KATANA_LOG_ASSERT(pins.ComputeConnectivity(part_of) == 1);
+
+  part = {0, 0, 0, 0};
+  KATANA_LOG_ASSERT(pins.ComputeCut(part_of) == 0);
+  KATANA_LOG_ASSERT(pins.ComputeConnectivity(part_of) == 0);
+
+  part = {0, 1, 2, 3};
+  KATANA_LOG_ASSERT(pins.ComputeCut(part_of) == 2);
+  KATANA_LOG_ASSERT(pins.ComputeConnectivity(part_of) == 3);
+
+  return 0;
+}
@@ -0,0 +1,99 @@
+#include <memory>
+#include <vector>
+
+#include "katana/Logging.h"
+#include "katana/PropertyGraph.h"
+#include "katana/RDG.h"
+#include "katana/Result.h"
+#include "katana/SharedMemSys.h"
+#include "katana/URI.h"
+
+namespace {
+
+katana::Result<void>
+TestMakeRange(const katana::URI& rdg_dir) {
+  katana::TxnContext txn_ctx;
+  std::unique_ptr<katana::PropertyGraph> full =
+      KATANA_CHECKED(katana::PropertyGraph::Make(rdg_dir, &txn_ctx));
+  const katana::GraphTopology& topo = full->topology();
+  const uint64_t num_nodes = topo.NumNodes();
+  KATANA_LOG_ASSERT(num_nodes >= 4);
+
+  // The whole-graph range keeps every edge and reproduces the graph.
+  {
+    std::unique_ptr<katana::PropertyGraph> whole =
+        KATANA_CHECKED(katana::PropertyGraph::MakeRange(
+            rdg_dir, std::make_pair(uint64_t{0}, num_nodes), &txn_ctx));
+    KATANA_LOG_ASSERT(whole->NumNodes() == num_nodes);
+    KATANA_LOG_ASSERT(whole->NumEdges() == topo.NumEdges());
+  }
+
+  // A partial range is the induced subgraph on [begin, end), rebased to 0.
+  const uint64_t begin = num_nodes / 4;
+  const uint64_t end = num_nodes / 2;
+  std::unique_ptr<katana::PropertyGraph> range =
+      KATANA_CHECKED(katana::PropertyGraph::MakeRange(
+          rdg_dir, std::make_pair(begin, end), &txn_ctx));
+  KATANA_LOG_ASSERT(range->NumNodes() == end - begin);
+
+  const katana::GraphTopology& range_topo = range->topology();
+  uint64_t expected_edges = 0;
+  for (uint64_t node = begin; node < end; ++node) {
+    auto local = static_cast<katana::GraphTopology::Node>(node - begin);
+    std::vector<uint32_t> expected;
+    for (auto e : topo.OutEdges(static_cast<katana::GraphTopology::Node>(node))) {
+      uint64_t dest = topo.OutEdgeDst(e);
+      if (dest >= begin && dest < end) {
+        expected.push_back(static_cast<uint32_t>(dest - begin));
+      }
+    }
+    KATANA_LOG_ASSERT(range_topo.OutDegree(local) == expected.size());
+    size_t i = 0;
+    for (auto e : range_topo.OutEdges(local)) {
+      KATANA_LOG_ASSERT(range_topo.OutEdgeDst(e) == expected[i]);
+      ++i;
+    }
+    KATANA_LOG_ASSERT(
+        range->GetTypeOfNode(local) ==
+        full->GetTypeOfNode(static_cast<katana::GraphTopology::Node>(node)));
+    expected_edges += expected.size();
+  }
+  KATANA_LOG_ASSERT(range_topo.NumEdges() == expected_edges);
+
+  // Property columns are the same rows the full graph holds for the range.
+  KATANA_LOG_ASSERT(
+      range->GetNumNodeProperties() == full->GetNumNodeProperties());
+  for (int32_t i = 0; i < full->GetNumNodeProperties(); ++i) {
+    const std::string& name = full->loaded_node_schema()->field(i)->name();
+    std::shared_ptr<arrow::ChunkedArray> expected =
+        full->GetNodeProperty(name)->Slice(begin, end - begin);
+    KATANA_LOG_ASSERT(range->GetNodeProperty(name)->Equals(*expected));
+  }
+  KATANA_LOG_ASSERT(
+      range->GetNumEdgeProperties() == full->GetNumEdgeProperties());
+
+  return katana::ResultSuccess();
+}
+
+}  // namespace
+
+int
+main(int argc, char* argv[]) {
+  katana::SharedMemSys sys;
+
+  if (argc <= 1) {
+    KATANA_LOG_FATAL("make-range <rdg dir>");
+  }
+
+  auto uri = katana::URI::Make(argv[1]);
+  if (!uri) {
+    KATANA_LOG_FATAL("bad URI: {}", uri.error());
+  }
+
+  auto res = TestMakeRange(uri.value());
+  if (!res) {
+    KATANA_LOG_FATAL("test failed: {}", res.error());
+  }
+
+  return 0;
+}
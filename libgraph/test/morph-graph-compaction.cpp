@@ -0,0 +1,91 @@
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "katana/Logging.h"
+#include "katana/MorphGraph.h"
+#include "katana/MorphGraphCompactor.h"
+#include "katana/SharedMemSys.h"
+
+using Graph = katana::MorphGraph<unsigned int, unsigned int, true>;
+using Compactor = katana::MorphGraphCompactor<Graph>;
+
+namespace {
+
+/// Every morph edge must appear exactly once in the CSR image with the
+/// same destination and data.
+void
+VerifyMatchesMorph(Graph& graph, Compactor& compactor) {
+  compactor.compact();
+
+  uint64_t num_edges = 0;
+  for (auto src : graph) {
+    Compactor::CompactNode csrc = compactor.id(src);
+    KATANA_LOG_ASSERT(compactor.node(csrc) == src);
+    KATANA_LOG_ASSERT(
+        compactor.getData(csrc) ==
+        graph.getData(src, katana::MethodFlag::UNPROTECTED));
+
+    std::vector<std::pair<Compactor::CompactNode, unsigned int>> want;
+    for (auto e : graph.edges(src, katana::MethodFlag::UNPROTECTED)) {
+      want.emplace_back(
+          compactor.id(graph.getEdgeDst(e)), graph.getEdgeData(e));
+    }
+    num_edges += want.size();
+
+    auto range = compactor.edges(csrc);
+    KATANA_LOG_ASSERT(range.size() == want.size());
+    for (auto ce : range) {
+      auto got =
+          std::make_pair(compactor.getEdgeDst(ce), compactor.getEdgeData(ce));
+      auto it = std::find(want.begin(), want.end(), got);
+      KATANA_LOG_ASSERT(it != want.end());
+      want.erase(it);
+    }
+  }
+  KATANA_LOG_ASSERT(compactor.sizeEdges() == num_edges);
+}
+
+}  // namespace
+
+int
+main() {
+  katana::SharedMemSys sys;
+
+  Graph graph;
+  Compactor compactor(graph);
+
+  std::vector<Graph::GraphNode> nodes;
+  for (unsigned int i = 0; i < 16; ++i) {
+    Graph::GraphNode n = compactor.createNode(i * 10);
+    compactor.addNode(n);
+    nodes.push_back(n);
+  }
+  for (unsigned int i = 0; i < 16; ++i) {
+    graph.getEdgeData(compactor.addEdge(nodes[i], nodes[(i + 1) % 16])) = i;
+    graph.getEdgeData(compactor.addEdge(nodes[i], nodes[(i + 5) % 16])) = i + 100;
+  }
+
+  KATANA_LOG_ASSERT(!compactor.upToDate());
+  compactor.compact();
+  KATANA_LOG_ASSERT(compactor.upToDate());
+  KATANA_LOG_ASSERT(compactor.size() == 16);
+  KATANA_LOG_ASSERT(compactor.sizeEdges() == 32);
+  VerifyMatchesMorph(graph, compactor);
+
+  // Node data writes flow through without staling the image.
+  compactor.getData(compactor.id(nodes[3])) = 999;
+  KATANA_LOG_ASSERT(
+      graph.getData(nodes[3], katana::MethodFlag::UNPROTECTED) == 999);
+  KATANA_LOG_ASSERT(compactor.upToDate());
+
+  // A mutation burst stales the image; the next read recompacts.
+  compactor.removeNode(nodes[7]);
+  graph.getEdgeData(compactor.addEdge(nodes[2], nodes[9])) = 77;
+  KATANA_LOG_ASSERT(!compactor.upToDate());
+  KATANA_LOG_ASSERT(compactor.size() == 15);
+  KATANA_LOG_ASSERT(compactor.upToDate());
+  VerifyMatchesMorph(graph, compactor);
+
+  return 0;
+}
@@ -203,6 +203,15 @@ TestPrimitiveIndex(size_t num_nodes, size_t line_width) {
   it = nonuniform_index->UpperBound(44);
   KATANA_LOG_ASSERT(it != nonuniform_index->end());
   KATANA_LOG_ASSERT(typed_prop->Value(*it) == 46);
+
+  // Range queries return a contiguous span of ids sorted by value, covering
+  // exactly [low, high).
+  auto range = nonuniform_index->Range(44, 50);
+  KATANA_LOG_ASSERT(range.end() - range.begin() == 3);
+  for (node_or_edge id : range) {
+    DataType val = typed_prop->Value(id);
+    KATANA_LOG_ASSERT(val >= 44 && val < 50);
+  }
 }
 
 template <typename node_or_edge>
@@ -271,6 +280,15 @@ TestStringIndex(size_t num_nodes, size_t line_width) {
   it = nonuniform_index->UpperBound("aaak");
   KATANA_LOG_ASSERT(it != nonuniform_index->end());
   KATANA_LOG_ASSERT(typed_prop->GetView(*it) == "aaam");
+
+  // Range queries return a contiguous span of ids sorted by value, covering
+  // exactly [low, high).
+  auto range = nonuniform_index->Range("aaac", "aaag");
+  KATANA_LOG_ASSERT(range.end() - range.begin() == 2);
+  for (node_or_edge id : range) {
+    auto val = typed_prop->GetView(id);
+    KATANA_LOG_ASSERT(val >= "aaac" && val < "aaag");
+  }
 }
 
 int
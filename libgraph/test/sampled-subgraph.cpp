@@ -0,0 +1,109 @@
+#include "katana/SampledSubgraph.h"
+
+#include "TestTypedPropertyGraph.h"
+#include "katana/Logging.h"
+#include "katana/SharedMemSys.h"
+#include "katana/analytics/ApproximateAnalytics.h"
+
+using DataType = int64_t;
+
+namespace {
+
+constexpr uint64_t kNumNodes = 1 << 14;
+constexpr uint32_t kSeed = 42;
+
+/// Every local edge must map to a real edge of the parent graph.
+void
+VerifyInduced(
+    const katana::PropertyGraph& g, const katana::SampledSubgraph& sample) {
+  const katana::GraphTopology& topo = g.topology();
+  for (auto node : sample.Nodes()) {
+    auto src = sample.OriginalNode(node);
+    for (auto e : sample.OutEdges(node)) {
+      auto dest = sample.OriginalNode(sample.OutEdgeDst(e));
+      bool found = false;
+      for (auto orig_e : topo.OutEdges(src)) {
+        if (topo.OutEdgeDst(orig_e) == dest) {
+          found = true;
+          break;
+        }
+      }
+      KATANA_LOG_VASSERT(
+          found, "sampled edge {} -> {} not in parent graph", src, dest);
+    }
+  }
+}
+
+void
+TestNodeSample(const katana::PropertyGraph& g) {
+  auto res = katana::SampledSubgraph::RandomNodeSample(g, 1000, kSeed);
+  KATANA_LOG_ASSERT(res);
+  const katana::SampledSubgraph& sample = res.value();
+  KATANA_LOG_ASSERT(sample.NumNodes() == 1000);
+  KATANA_LOG_ASSERT(sample.NodeFraction() > 0.0);
+  VerifyInduced(g, sample);
+}
+
+void
+TestEdgeSample(const katana::PropertyGraph& g) {
+  auto res = katana::SampledSubgraph::RandomEdgeSample(g, 1000, kSeed);
+  KATANA_LOG_ASSERT(res);
+  const katana::SampledSubgraph& sample = res.value();
+  KATANA_LOG_ASSERT(sample.NumNodes() > 0);
+  KATANA_LOG_ASSERT(sample.NumNodes() <= 2000);
+  // Every sampled edge's endpoints are in the sample, so the induced
+  // subgraph has at least as many edges as draws that landed distinct.
+  KATANA_LOG_ASSERT(sample.NumEdges() > 0);
+  VerifyInduced(g, sample);
+}
+
+void
+TestNeighborhoodSample(const katana::PropertyGraph& g) {
+  auto res = katana::SampledSubgraph::NeighborhoodSample(
+      g, /*num_seeds=*/16, /*depth=*/2, /*fanout=*/4, kSeed);
+  KATANA_LOG_ASSERT(res);
+  const katana::SampledSubgraph& sample = res.value();
+  KATANA_LOG_ASSERT(sample.NumNodes() >= 16);
+  // Seeds plus at most fanout new nodes per expanded node per hop.
+  KATANA_LOG_ASSERT(sample.NumNodes() <= 16 + 16 * 4 + 16 * 4 * 4);
+  VerifyInduced(g, sample);
+}
+
+void
+TestEstimators(const katana::PropertyGraph& g) {
+  auto cc = katana::analytics::EstimateLargestComponentFraction(
+      g, /*sample_edges=*/2000, kSeed);
+  KATANA_LOG_ASSERT(cc);
+  KATANA_LOG_ASSERT(cc.value().estimate >= 0.0 && cc.value().estimate <= 1.0);
+  KATANA_LOG_ASSERT(cc.value().ci_lower <= cc.value().estimate);
+  KATANA_LOG_ASSERT(cc.value().estimate <= cc.value().ci_upper);
+
+  auto pr = katana::analytics::EstimatePageRankTopMass(
+      g, /*top_fraction=*/0.01, /*sample_edges=*/2000, kSeed);
+  KATANA_LOG_ASSERT(pr);
+  KATANA_LOG_ASSERT(pr.value().estimate > 0.0 && pr.value().estimate <= 1.0);
+  KATANA_LOG_ASSERT(pr.value().ci_lower <= pr.value().ci_upper);
+
+  auto exact = katana::analytics::ProportionEstimate(50, 100);
+  KATANA_LOG_ASSERT(exact.estimate == 0.5);
+  KATANA_LOG_ASSERT(exact.ci_lower < 0.5 && exact.ci_upper > 0.5);
+}
+
+}  // namespace
+
+int
+main() {
+  katana::SharedMemSys sys;
+
+  katana::TxnContext txn_ctx;
+  RandomPolicy policy{4};
+  std::unique_ptr<katana::PropertyGraph> g =
+      MakeFileGraph<DataType>(kNumNodes, 1, &policy, &txn_ctx);
+
+  TestNodeSample(*g);
+  TestEdgeSample(*g);
+  TestNeighborhoodSample(*g);
+  TestEstimators(*g);
+
+  return 0;
+}
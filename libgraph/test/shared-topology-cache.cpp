@@ -0,0 +1,55 @@
+#include "katana/SharedTopologyCache.h"
+
+#include <unistd.h>
+
+#include "katana/Logging.h"
+#include "katana/Result.h"
+#include "katana/SharedMemSys.h"
+#include "katana/TopologyGeneration.h"
+
+namespace {
+
+katana::Result<void>
+TestPublishAttach() {
+  // Key on the pid so concurrent test runs do not collide.
+  std::string key = "shared-topology-cache-test-" + std::to_string(getpid());
+
+  KATANA_LOG_ASSERT(!katana::SharedTopologyCache::Contains(key));
+  auto missing = katana::SharedTopologyCache::Attach(key);
+  KATANA_LOG_ASSERT(!missing);
+
+  katana::GraphTopology topo =
+      katana::MakeUniformRandomTopology(1024, 8192, 42);
+  KATANA_CHECKED(katana::SharedTopologyCache::Publish(key, topo));
+  KATANA_LOG_ASSERT(katana::SharedTopologyCache::Contains(key));
+
+  katana::GraphTopology attached =
+      KATANA_CHECKED(katana::SharedTopologyCache::Attach(key));
+  KATANA_LOG_ASSERT(attached.NumNodes() == topo.NumNodes());
+  KATANA_LOG_ASSERT(attached.NumEdges() == topo.NumEdges());
+  for (katana::GraphTopology::Node n : topo.Nodes()) {
+    KATANA_LOG_ASSERT(attached.OutDegree(n) == topo.OutDegree(n));
+    for (katana::GraphTopology::Edge e : topo.OutEdges(n)) {
+      KATANA_LOG_ASSERT(attached.OutEdgeDst(e) == topo.OutEdgeDst(e));
+    }
+  }
+
+  KATANA_CHECKED(katana::SharedTopologyCache::Drop(key));
+  KATANA_LOG_ASSERT(!katana::SharedTopologyCache::Contains(key));
+
+  return katana::ResultSuccess();
+}
+
+}  // namespace
+
+int
+main() {
+  katana::SharedMemSys sys;
+
+  auto res = TestPublishAttach();
+  if (!res) {
+    KATANA_LOG_FATAL("test failed: {}", res.error());
+  }
+
+  return 0;
+}
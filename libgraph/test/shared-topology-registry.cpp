@@ -0,0 +1,48 @@
+#include "katana/Logging.h"
+#include "katana/SharedMemSys.h"
+#include "katana/SharedTopologyRegistry.h"
+#include "katana/TopologyGeneration.h"
+
+int
+main() {
+  katana::SharedMemSys sys;
+
+  auto& registry = katana::SharedTopologyRegistry::Get();
+  KATANA_LOG_ASSERT(registry.NumLive() == 0);
+
+  auto build = []() {
+    return katana::MakeUniformRandomTopology(1024, 8192, 42);
+  };
+
+  // Same key yields the same instance for as long as one holder is alive.
+  std::shared_ptr<katana::GraphTopology> first =
+      registry.Intern("topology-a", build);
+  std::shared_ptr<katana::GraphTopology> second =
+      registry.Intern("topology-a", build);
+  KATANA_LOG_ASSERT(first == second);
+  KATANA_LOG_ASSERT(registry.NumLive() == 1);
+
+  // Distinct keys get distinct instances.
+  std::shared_ptr<katana::GraphTopology> other =
+      registry.Intern("topology-b", build);
+  KATANA_LOG_ASSERT(other != first);
+  KATANA_LOG_ASSERT(registry.NumLive() == 2);
+
+  // An empty key always bypasses the registry.
+  std::shared_ptr<katana::GraphTopology> anonymous = registry.Intern("", build);
+  KATANA_LOG_ASSERT(anonymous != first);
+  KATANA_LOG_ASSERT(registry.NumLive() == 2);
+  anonymous.reset();
+
+  // Entries are weak: once the last holder drops a topology, a later
+  // Intern of the same key rebuilds rather than resurrecting it.
+  first.reset();
+  second.reset();
+  KATANA_LOG_ASSERT(registry.NumLive() == 1);
+  std::shared_ptr<katana::GraphTopology> rebuilt =
+      registry.Intern("topology-a", build);
+  KATANA_LOG_ASSERT(rebuilt != nullptr);
+  KATANA_LOG_ASSERT(registry.NumLive() == 2);
+
+  return 0;
+}
@@ -0,0 +1,95 @@
+#include "katana/StringScan.h"
+
+#include <string>
+
+#include "katana/Logging.h"
+#include "katana/SharedMemSys.h"
+#include "katana/TopologyGeneration.h"
+
+using katana::StringPredicate;
+using Node = katana::PropertyGraph::Node;
+
+namespace {
+
+std::string
+NameOf(Node id) {
+  // Even rows end with 'Y' and odd rows start with 'Z' so the pattern
+  // "YZ" only ever occurs across an element boundary and must not match.
+  if (id % 2 == 0) {
+    return fmt::format("account-{}-Y", id);
+  }
+  return fmt::format("Z-account-{}", id);
+}
+
+void
+VerifyScalar(
+    const katana::PropertyGraph& pg, StringPredicate predicate,
+    const std::string& pattern, const katana::DynamicBitset& mask) {
+  KATANA_LOG_ASSERT(mask.size() == pg.num_nodes());
+  for (Node id = 0; id < pg.num_nodes(); ++id) {
+    std::string value = NameOf(id);
+    bool expected = false;
+    switch (predicate) {
+    case StringPredicate::kEquals:
+      expected = value == pattern;
+      break;
+    case StringPredicate::kPrefix:
+      expected = value.rfind(pattern, 0) == 0;
+      break;
+    case StringPredicate::kContains:
+      expected = value.find(pattern) != std::string::npos;
+      break;
+    }
+    KATANA_LOG_VASSERT(
+        mask.test(id) == expected, "mismatch at node {} for pattern {}", id,
+        pattern);
+  }
+}
+
+void
+Check(
+    const katana::PropertyGraph& pg, StringPredicate predicate,
+    const std::string& pattern) {
+  auto mask_res =
+      katana::ScanNodeStringProperty(pg, "name", predicate, pattern);
+  KATANA_LOG_ASSERT(mask_res);
+  VerifyScalar(pg, predicate, pattern, mask_res.value());
+}
+
+}  // namespace
+
+int
+main() {
+  katana::SharedMemSys sys;
+
+  std::unique_ptr<katana::PropertyGraph> pg = katana::MakeGrid(30, 14, true);
+  katana::TxnContext txn_ctx;
+  auto add_res = katana::AddNodeProperties(
+      pg.get(), &txn_ctx,
+      katana::PropertyGenerator("name", [](Node id) { return NameOf(id); }),
+      katana::PropertyGenerator(
+          "degree", [](Node id) { return static_cast<int32_t>(id); }));
+  KATANA_LOG_ASSERT(add_res);
+
+  Check(*pg, StringPredicate::kEquals, "account-10-Y");
+  Check(*pg, StringPredicate::kEquals, "no-such-name");
+  Check(*pg, StringPredicate::kPrefix, "Z-account-1");
+  Check(*pg, StringPredicate::kPrefix, "account-");
+  Check(*pg, StringPredicate::kContains, "account-7");
+  Check(*pg, StringPredicate::kContains, "-Y");
+  // Straddles element boundaries everywhere; must match nothing.
+  Check(*pg, StringPredicate::kContains, "YZ");
+  // The empty pattern is contained in every non-null value.
+  Check(*pg, StringPredicate::kContains, "");
+  // A longer pattern than any value cannot match or read out of bounds.
+  Check(
+      *pg, StringPredicate::kContains,
+      std::string(256, 'x') + "account-never");
+
+  KATANA_LOG_ASSERT(!katana::ScanNodeStringProperty(
+      *pg, "degree", StringPredicate::kContains, "1"));
+  KATANA_LOG_ASSERT(!katana::ScanNodeStringProperty(
+      *pg, "missing", StringPredicate::kEquals, "x"));
+
+  return 0;
+}
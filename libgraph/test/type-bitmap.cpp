@@ -0,0 +1,115 @@
+#include <memory>
+#include <vector>
+
+#include "katana/DynamicBitset.h"
+#include "katana/Logging.h"
+#include "katana/PropertyGraph.h"
+#include "katana/RDG.h"
+#include "katana/Result.h"
+#include "katana/SharedMemSys.h"
+#include "katana/URI.h"
+
+namespace {
+
+katana::Result<void>
+TestTypeBitmaps(const katana::URI& rdg_dir) {
+  katana::TxnContext txn_ctx;
+  std::unique_ptr<katana::PropertyGraph> pg =
+      KATANA_CHECKED(katana::PropertyGraph::Make(rdg_dir, &txn_ctx));
+  const uint64_t num_nodes = pg->NumNodes();
+  const uint64_t num_edges = pg->NumEdges();
+
+  std::vector<katana::EntityTypeID> node_types;
+  for (const auto& [id, name] :
+       pg->GetNodeTypeManager().GetEntityTypeIDToAtomicTypeNameMap()) {
+    node_types.push_back(id);
+  }
+  KATANA_LOG_ASSERT(node_types.size() >= 2);
+
+  for (katana::EntityTypeID type : node_types) {
+    std::shared_ptr<const katana::DynamicBitset> bitmap =
+        KATANA_CHECKED(pg->GetNodesWithType(type));
+    KATANA_LOG_ASSERT(bitmap->size() == num_nodes);
+
+    uint64_t expected = 0;
+    for (uint64_t node = 0; node < num_nodes; ++node) {
+      bool has_type = pg->DoesNodeHaveType(
+          static_cast<katana::GraphTopology::Node>(node), type);
+      KATANA_LOG_ASSERT(bitmap->test(node) == has_type);
+      expected += has_type ? 1 : 0;
+    }
+    KATANA_LOG_ASSERT(bitmap->count() == expected);
+
+    // The word-level iteration visits exactly the set bits, in order.
+    uint64_t visited = 0;
+    uint64_t prev = 0;
+    for (uint64_t node : bitmap->SetBits()) {
+      KATANA_LOG_ASSERT(visited == 0 || node > prev);
+      KATANA_LOG_ASSERT(bitmap->test(node));
+      prev = node;
+      ++visited;
+    }
+    KATANA_LOG_ASSERT(visited == expected);
+
+    // A second request hits the cache.
+    KATANA_LOG_ASSERT(KATANA_CHECKED(pg->GetNodesWithType(type)) == bitmap);
+  }
+
+  // A type-intersection query is a bitwise AND of two cached bitmaps.
+  {
+    std::shared_ptr<const katana::DynamicBitset> a =
+        KATANA_CHECKED(pg->GetNodesWithType(node_types[0]));
+    std::shared_ptr<const katana::DynamicBitset> b =
+        KATANA_CHECKED(pg->GetNodesWithType(node_types[1]));
+    katana::DynamicBitset both;
+    both.resize(num_nodes);
+    both.bitwise_and(*a, *b);
+    for (uint64_t node = 0; node < num_nodes; ++node) {
+      auto n = static_cast<katana::GraphTopology::Node>(node);
+      KATANA_LOG_ASSERT(
+          both.test(node) == (pg->DoesNodeHaveType(n, node_types[0]) &&
+                              pg->DoesNodeHaveType(n, node_types[1])));
+    }
+  }
+
+  // Edge bitmaps, indexed in topology order.
+  for (const auto& [id, name] :
+       pg->GetEdgeTypeManager().GetEntityTypeIDToAtomicTypeNameMap()) {
+    std::shared_ptr<const katana::DynamicBitset> bitmap =
+        KATANA_CHECKED(pg->GetEdgesWithType(id));
+    KATANA_LOG_ASSERT(bitmap->size() == num_edges);
+    for (uint64_t edge = 0; edge < num_edges; ++edge) {
+      KATANA_LOG_ASSERT(
+          bitmap->test(edge) == pg->DoesEdgeHaveTypeFromTopoIndex(edge, id));
+    }
+    break;  // one edge type is enough for the per-edge comparison
+  }
+
+  // An unknown type ID is an error, not an empty bitmap.
+  KATANA_LOG_ASSERT(!pg->GetNodesWithType(katana::kInvalidEntityType));
+
+  return katana::ResultSuccess();
+}
+
+}  // namespace
+
+int
+main(int argc, char* argv[]) {
+  katana::SharedMemSys sys;
+
+  if (argc <= 1) {
+    KATANA_LOG_FATAL("type-bitmap <rdg dir>");
+  }
+
+  auto uri = katana::URI::Make(argv[1]);
+  if (!uri) {
+    KATANA_LOG_FATAL("bad URI: {}", uri.error());
+  }
+
+  auto res = TestTypeBitmaps(uri.value());
+  if (!res) {
+    KATANA_LOG_FATAL("test failed: {}", res.error());
+  }
+
+  return 0;
+}
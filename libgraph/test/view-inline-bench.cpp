@@ -0,0 +1,109 @@
+#include <benchmark/benchmark.h>
+
+#include "TestTypedPropertyGraph.h"
+#include "katana/Logging.h"
+#include "katana/PropertyGraph.h"
+#include "katana/SharedMemSys.h"
+
+using DataType = int64_t;
+
+namespace {
+
+void
+MakeArguments(benchmark::internal::Benchmark* b) {
+  for (int i = 0; i < 3; ++i) {
+    b->Args({1 << (i * 4 + 12)});
+  }
+}
+
+std::unique_ptr<katana::PropertyGraph>
+MakeGraph(long num_nodes, katana::TxnContext* txn_ctx) {
+  RandomPolicy policy{4};
+  return MakeFileGraph<DataType>(num_nodes, 1, &policy, txn_ctx);
+}
+
+/// Sum of all edge destinations through the layered view wrapper: every
+/// OutEdges/OutEdgeDst goes through the shared_ptr-held topology.
+template <typename ViewTy>
+uint64_t
+SumDestsThroughView(const ViewTy& view) {
+  uint64_t sum = 0;
+  for (auto n : view.Nodes()) {
+    for (auto e : view.OutEdges(n)) {
+      sum += view.OutEdgeDst(e);
+    }
+  }
+  return sum;
+}
+
+/// The same walk against the raw CSR arrays; the codegen target the flat
+/// view is supposed to match.
+uint64_t
+SumDestsRaw(const katana::GraphTopology& topo) {
+  const katana::GraphTopology::Edge* adj = topo.AdjData();
+  const katana::GraphTopology::Node* dests = topo.DestData();
+  uint64_t sum = 0;
+  const uint64_t num_nodes = topo.NumNodes();
+  for (uint64_t n = 0; n < num_nodes; ++n) {
+    for (uint64_t e = n > 0 ? adj[n - 1] : 0; e < adj[n]; ++e) {
+      sum += dests[e];
+    }
+  }
+  return sum;
+}
+
+void
+IterateWrappedView(benchmark::State& state) {
+  katana::TxnContext txn_ctx;
+  std::unique_ptr<katana::PropertyGraph> g =
+      MakeGraph(state.range(0), &txn_ctx);
+  auto view = g->BuildView<katana::PropertyGraphViews::Default>();
+
+  const uint64_t expected = SumDestsRaw(g->topology());
+  for (auto _ : state) {
+    uint64_t sum = SumDestsThroughView(view);
+    KATANA_LOG_VASSERT(sum == expected, "expected {} found {}", expected, sum);
+    benchmark::DoNotOptimize(sum);
+  }
+}
+
+void
+IterateFlatCsrView(benchmark::State& state) {
+  katana::TxnContext txn_ctx;
+  std::unique_ptr<katana::PropertyGraph> g =
+      MakeGraph(state.range(0), &txn_ctx);
+  auto view = g->BuildView<katana::PropertyGraphViews::Default>();
+  katana::FlatCsrView csr = view.flat_csr_view();
+
+  const uint64_t expected = SumDestsRaw(g->topology());
+  for (auto _ : state) {
+    uint64_t sum = SumDestsThroughView(csr);
+    KATANA_LOG_VASSERT(sum == expected, "expected {} found {}", expected, sum);
+    benchmark::DoNotOptimize(sum);
+  }
+}
+
+void
+IterateRawArrays(benchmark::State& state) {
+  katana::TxnContext txn_ctx;
+  std::unique_ptr<katana::PropertyGraph> g =
+      MakeGraph(state.range(0), &txn_ctx);
+
+  for (auto _ : state) {
+    uint64_t sum = SumDestsRaw(g->topology());
+    benchmark::DoNotOptimize(sum);
+  }
+}
+
+BENCHMARK(IterateRawArrays)->Apply(MakeArguments);
+BENCHMARK(IterateFlatCsrView)->Apply(MakeArguments);
+BENCHMARK(IterateWrappedView)->Apply(MakeArguments);
+
+}  // namespace
+
+int
+main(int argc, char** argv) {
+  ::benchmark::Initialize(&argc, argv);
+  katana::SharedMemSys G;
+  ::benchmark::RunSpecifiedBenchmarks();
+}
@@ -1,8 +1,14 @@
+#include <arrow/api.h>
+#include <arrow/compute/api_vector.h>
+#include <arrow/compute/cast.h>
 #include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 
 #include "katana/GraphML.h"
+#include "katana/Loops.h"
+#include "katana/NUMAArray.h"
 #include "katana/ParallelSTL.h"
+#include "katana/Reduction.h"
 #include "katana/python/CythonIntegration.h"
 #include "katana/python/ErrorHandling.h"
 #include "katana/python/PropertyGraphPython.h"
@@ -21,6 +27,138 @@ TopologyFromCSR(
       edge_destinations.size());
 }
 
+/// Build a graph in memory from an Arrow edge table (and optional node
+/// table): a parallel two-pass count/prefix-sum/scatter over the source and
+/// destination columns produces the CSR topology, the remaining edge columns
+/// are attached as edge properties permuted into CSR edge order with a single
+/// Take, and the node table's buffers are adopted as node properties without
+/// copying.
+katana::Result<std::shared_ptr<katana::PropertyGraph>>
+FromArrowTables(
+    std::shared_ptr<arrow::Table> edges, std::shared_ptr<arrow::Table> nodes,
+    const std::string& source_column, const std::string& destination_column,
+    katana::TxnContext* txn_ctx) {
+  using katana::PropertyGraph;
+
+  if (source_column == destination_column) {
+    return KATANA_ERROR(
+        katana::ErrorCode::InvalidArgument,
+        "source and destination columns must be distinct");
+  }
+
+  // Flatten so each column is at most one chunk; a no-op for the common
+  // case of a table freshly converted from pandas or numpy.
+  edges = KATANA_CHECKED(edges->CombineChunks(arrow::default_memory_pool()));
+  const uint64_t num_edges = edges->num_rows();
+  if (num_edges == 0) {
+    return KATANA_ERROR(
+        katana::ErrorCode::InvalidArgument,
+        "edges table must have at least one row");
+  }
+
+  auto src_column = edges->GetColumnByName(source_column);
+  auto dst_column = edges->GetColumnByName(destination_column);
+  if (!src_column || !dst_column) {
+    return KATANA_ERROR(
+        katana::ErrorCode::NotFound, "edges table has no column named {}",
+        !src_column ? source_column : destination_column);
+  }
+  if (src_column->null_count() > 0 || dst_column->null_count() > 0) {
+    return KATANA_ERROR(
+        katana::ErrorCode::InvalidArgument,
+        "source and destination columns may not contain nulls");
+  }
+
+  auto srcs =
+      std::static_pointer_cast<arrow::UInt64Array>(KATANA_CHECKED(
+          arrow::compute::Cast(*src_column->chunk(0), arrow::uint64())));
+  auto dsts =
+      std::static_pointer_cast<arrow::UInt32Array>(KATANA_CHECKED(
+          arrow::compute::Cast(*dst_column->chunk(0), arrow::uint32())));
+  const uint64_t* src_data = srcs->raw_values();
+  const uint32_t* dst_data = dsts->raw_values();
+
+  katana::GReduceMax<uint64_t> max_id;
+  katana::do_all(
+      katana::iterate(uint64_t{0}, num_edges),
+      [&](uint64_t e) {
+        max_id.update(std::max<uint64_t>(src_data[e], dst_data[e]));
+      },
+      katana::no_stats());
+  const uint64_t num_nodes =
+      nodes ? nodes->num_rows() : max_id.reduce() + 1;
+  if (max_id.reduce() >= num_nodes) {
+    return KATANA_ERROR(
+        katana::ErrorCode::InvalidArgument,
+        "edge endpoint {} is out of range for a nodes table with {} rows",
+        max_id.reduce(), num_nodes);
+  }
+
+  // First pass: per-source degree counts, prefix-summed into the CSR
+  // adjacency index.
+  katana::NUMAArray<uint64_t> adj_indices;
+  adj_indices.allocateInterleaved(num_nodes);
+  katana::do_all(
+      katana::iterate(uint64_t{0}, num_nodes),
+      [&](uint64_t n) { adj_indices[n] = 0; }, katana::no_stats());
+  katana::do_all(
+      katana::iterate(uint64_t{0}, num_edges),
+      [&](uint64_t e) { __sync_fetch_and_add(&adj_indices[src_data[e]], 1); },
+      katana::no_stats());
+  katana::ParallelSTL::partial_sum(
+      adj_indices.begin(), adj_indices.end(), adj_indices.begin());
+
+  katana::NUMAArray<uint64_t> insert_offsets;
+  insert_offsets.allocateInterleaved(num_nodes);
+  insert_offsets[0] = 0;
+  katana::do_all(
+      katana::iterate(uint64_t{1}, num_nodes),
+      [&](uint64_t n) { insert_offsets[n] = adj_indices[n - 1]; },
+      katana::no_stats());
+
+  // Second pass: scatter destinations, remembering which original row
+  // landed in each CSR slot so edge properties can be permuted to match.
+  katana::NUMAArray<uint32_t> out_dests;
+  out_dests.allocateInterleaved(num_edges);
+  katana::NUMAArray<uint64_t> csr_to_row;
+  csr_to_row.allocateInterleaved(num_edges);
+  katana::do_all(
+      katana::iterate(uint64_t{0}, num_edges),
+      [&](uint64_t e) {
+        uint64_t pos = __sync_fetch_and_add(&insert_offsets[src_data[e]], 1);
+        out_dests[pos] = dst_data[e];
+        csr_to_row[pos] = e;
+      },
+      katana::no_stats());
+
+  std::shared_ptr<PropertyGraph> pg = KATANA_CHECKED(PropertyGraph::Make(
+      katana::GraphTopology(std::move(adj_indices), std::move(out_dests))));
+
+  int src_idx = edges->schema()->GetFieldIndex(source_column);
+  int dst_idx = edges->schema()->GetFieldIndex(destination_column);
+  std::shared_ptr<arrow::Table> edge_props =
+      KATANA_CHECKED(edges->RemoveColumn(std::max(src_idx, dst_idx)));
+  edge_props =
+      KATANA_CHECKED(edge_props->RemoveColumn(std::min(src_idx, dst_idx)));
+  if (edge_props->num_columns() > 0) {
+    arrow::UInt64Builder builder;
+    KATANA_CHECKED(builder.Resize(num_edges));
+    for (uint64_t pos = 0; pos < num_edges; ++pos) {
+      builder.UnsafeAppend(csr_to_row[pos]);
+    }
+    std::shared_ptr<arrow::Array> indices = KATANA_CHECKED(builder.Finish());
+    arrow::Datum permuted =
+        KATANA_CHECKED(arrow::compute::Take(edge_props, indices));
+    KATANA_CHECKED(pg->AddEdgeProperties(permuted.table(), txn_ctx));
+  }
+
+  if (nodes && nodes->num_columns() > 0) {
+    KATANA_CHECKED(pg->AddNodeProperties(nodes, txn_ctx));
+  }
+
+  return pg;
+}
+
 }  // namespace
 
 void
@@ -54,6 +192,47 @@ katana::python::InitImportData(py::module& m) {
       :returns: the new :py:class:`~katana.local.Graph`
       )""");
 
+  m.def(
+      "from_arrow_tables",
+      [](py::object edges, py::object nodes, const std::string& source_column,
+         const std::string& destination_column,
+         TxnContext* txn_ctx) -> Result<std::shared_ptr<PropertyGraph>> {
+        std::shared_ptr<arrow::Table> edges_table = KATANA_CHECKED(
+            python::PythonArgumentsToTable(edges, py::dict()));
+        std::shared_ptr<arrow::Table> nodes_table;
+        if (!nodes.is_none()) {
+          nodes_table = KATANA_CHECKED(
+              python::PythonArgumentsToTable(nodes, py::dict()));
+        }
+        python::TxnContextArgumentHandler txn_handler(txn_ctx);
+        py::gil_scoped_release release;
+        return FromArrowTables(
+            std::move(edges_table), std::move(nodes_table), source_column,
+            destination_column, txn_handler.get());
+      },
+      py::arg("edges"), py::arg("nodes") = py::none(),
+      py::arg("source_column") = "source",
+      py::arg("destination_column") = "destination",
+      py::arg("txn_ctx") = python::TxnContextArgumentHandler::default_value,
+      R"""(
+      Create a new `Graph` in memory from an Arrow edge table and an optional node table.
+
+      The CSR topology is built with a parallel two-pass prefix-sum over the
+      source and destination columns; node property buffers are adopted from
+      the Arrow table without copying.
+
+      :param edges: The edge table. The source and destination columns must be
+          non-null integers; all other columns become edge properties.
+      :type edges: `pyarrow.Table` or anything accepted by ``pyarrow.table``,
+          such as a `pandas.DataFrame` or a dict of arrays.
+      :param nodes: An optional node table whose columns become node
+          properties. Its row count fixes the number of nodes; without it the
+          largest edge endpoint does.
+      :param source_column: The name of the edge source column.
+      :param destination_column: The name of the edge destination column.
+      :returns: the new :py:class:`~katana.local.Graph`
+      )""");
+
   m.def(
       "_from_csr_and_raw_types",
       [](const py::array_t<PropertyGraph::Edge> edge_indices,
@@ -137,6 +137,102 @@ public:
 GraphBaseEdgeSourceAccessor::~GraphBaseEdgeSourceAccessor() = default;
 
 namespace {
+
+/// Zero-copy NumPy view over one property column. Shares the Arrow
+/// buffer rather than converting element-wise; the view owns a
+/// reference to the column, so it stays valid even if the property is
+/// later unloaded from the graph. The view is read-only: writes must go
+/// through upsert so the graph notices them.
+katana::Result<py::object>
+NumpyViewOfColumn(const std::shared_ptr<arrow::ChunkedArray>& column) {
+  if (column->num_chunks() != 1) {
+    return KATANA_ERROR(
+        katana::ErrorCode::InvalidArgument,
+        "property has {} chunks; a zero-copy view needs exactly one "
+        "(combine_chunks on the arrow accessor for a copying fallback)",
+        column->num_chunks());
+  }
+  std::shared_ptr<arrow::Array> chunk = column->chunk(0);
+  if (chunk->null_count() != 0) {
+    return KATANA_ERROR(
+        katana::ErrorCode::InvalidArgument,
+        "property has nulls, which a NumPy view cannot represent; use the "
+        "arrow accessor");
+  }
+
+  py::dtype dtype;
+  switch (chunk->type()->id()) {
+  case arrow::Type::INT8:
+    dtype = py::dtype::of<int8_t>();
+    break;
+  case arrow::Type::UINT8:
+    dtype = py::dtype::of<uint8_t>();
+    break;
+  case arrow::Type::INT16:
+    dtype = py::dtype::of<int16_t>();
+    break;
+  case arrow::Type::UINT16:
+    dtype = py::dtype::of<uint16_t>();
+    break;
+  case arrow::Type::INT32:
+    dtype = py::dtype::of<int32_t>();
+    break;
+  case arrow::Type::UINT32:
+    dtype = py::dtype::of<uint32_t>();
+    break;
+  case arrow::Type::INT64:
+    dtype = py::dtype::of<int64_t>();
+    break;
+  case arrow::Type::UINT64:
+    dtype = py::dtype::of<uint64_t>();
+    break;
+  case arrow::Type::FLOAT:
+    dtype = py::dtype::of<float>();
+    break;
+  case arrow::Type::DOUBLE:
+    dtype = py::dtype::of<double>();
+    break;
+  default:
+    return KATANA_ERROR(
+        katana::ErrorCode::InvalidArgument,
+        "no zero-copy NumPy representation for arrow type {} (booleans are "
+        "bit-packed, strings and lists are not fixed-width); use the arrow "
+        "accessor",
+        chunk->type()->name());
+  }
+
+  auto prim = std::static_pointer_cast<arrow::PrimitiveArray>(chunk);
+  const ssize_t byte_width = dtype.itemsize();
+  const uint8_t* data = prim->values()->data() + prim->offset() * byte_width;
+
+  py::capsule owner(
+      new std::shared_ptr<arrow::Array>(chunk), [](void* column_ref) {
+        delete static_cast<std::shared_ptr<arrow::Array>*>(column_ref);
+      });
+  py::array out(
+      dtype, {static_cast<ssize_t>(chunk->length())}, {byte_width}, data,
+      owner);
+  PyArray_CLEARFLAGS(
+      reinterpret_cast<PyArrayObject*>(out.ptr()), NPY_ARRAY_WRITEABLE);
+  return py::object(std::move(out));
+}
+
+/// Read-only NumPy view over a topology array; pair with
+/// py::keep_alive so the graph outlives the view.
+template <typename T>
+py::object
+NumpyViewOfTopologyArray(const T* data, size_t size) {
+  // The capsule base only marks the array as non-owning; lifetime is
+  // the caller's keep_alive.
+  py::array out(
+      py::dtype::of<T>(), {static_cast<ssize_t>(size)},
+      {static_cast<ssize_t>(sizeof(T))}, data,
+      py::capsule(const_cast<T*>(data), [](void*) {}));
+  PyArray_CLEARFLAGS(
+      reinterpret_cast<PyArrayObject*>(out.ptr()), NPY_ARRAY_WRITEABLE);
+  return py::object(std::move(out));
+}
+
 // Custom Python methods on PropertyGraph that are used from Numba so cannot be
 // lambdas until C++20
 
@@ -858,9 +954,14 @@ DefPropertyGraph(py::module& m) {
       cls_numba_replacement, "get_edge_src");
 
   // GetEdgeDst(LocalEdgeID)-> NodeHandle - destination of an edge
-  cls.def("get_edge_dst", [](PropertyGraph& self, GraphTopologyTypes::Edge e) {
-    return self.BuildView<PropertyGraphViews::BiDirectional>().OutEdgeDst(e);
-  });
+  cls.def(
+      "get_edge_dst",
+      [](PropertyGraph& self, GraphTopologyTypes::Edge e) {
+        return self.BuildView<PropertyGraphViews::BiDirectional>().OutEdgeDst(
+            e);
+      },
+      // BuildView constructs the bidirectional topology on first use.
+      py::call_guard<py::gil_scoped_release>());
   katana::DefWithNumba<&PropertyGraphNumbaReplacement::OutEdgeDst>(
       cls_numba_replacement, "get_edge_dst");
 
@@ -887,6 +988,42 @@ DefPropertyGraph(py::module& m) {
       },
       py::call_guard<py::gil_scoped_release>());
 
+  // Zero-copy variants: NumPy views sharing the Arrow buffers, no
+  // element-wise conversion. Only fixed-width, null-free, single-chunk
+  // properties qualify; anything else errors and points at the arrow
+  // accessors above.
+  cls.def(
+      "get_node_property_numpy",
+      [](PropertyGraph& self,
+         const std::string& name) -> katana::Result<py::object> {
+        KATANA_CHECKED(self.EnsureNodePropertyLoaded(name));
+        return NumpyViewOfColumn(KATANA_CHECKED(self.GetNodeProperty(name)));
+      });
+  cls.def(
+      "get_edge_property_numpy",
+      [](PropertyGraph& self,
+         const std::string& name) -> katana::Result<py::object> {
+        KATANA_CHECKED(self.EnsureEdgePropertyLoaded(name));
+        return NumpyViewOfColumn(KATANA_CHECKED(self.GetEdgeProperty(name)));
+      });
+
+  // Topology arrays as read-only NumPy views; keep_alive ties them to
+  // the graph object since the buffers live in its topology.
+  cls.def(
+      "out_edge_dsts_numpy",
+      [](PropertyGraph& self) {
+        const GraphTopology& topo = self.topology();
+        return NumpyViewOfTopologyArray(topo.DestData(), topo.NumEdges());
+      },
+      py::keep_alive<0, 1>());
+  cls.def(
+      "out_edge_indices_numpy",
+      [](PropertyGraph& self) {
+        const GraphTopology& topo = self.topology();
+        return NumpyViewOfTopologyArray(topo.AdjData(), topo.NumNodes());
+      },
+      py::keep_alive<0, 1>());
+
   cls.def(
       "unload_node_property", &PropertyGraph::UnloadNodeProperty,
       py::call_guard<py::gil_scoped_release>());
@@ -1009,6 +1146,8 @@ DefPropertyGraph(py::module& m) {
       "get_node_index",
       [](PropertyGraph& self, const std::string& name)
           -> std::shared_ptr<katana::EntityIndex<katana::GraphTopology::Node>> {
+        // Index construction scans the whole property column.
+        py::gil_scoped_release guard;
         if (!self.HasNodeIndex(name)) {
           PythonChecked(self.MakeNodeIndex(name));
         }
@@ -1020,6 +1159,8 @@ DefPropertyGraph(py::module& m) {
       "get_edge_index",
       [](PropertyGraph& self, const std::string& name)
           -> std::shared_ptr<katana::EntityIndex<katana::GraphTopology::Edge>> {
+        // Index construction scans the whole property column.
+        py::gil_scoped_release guard;
         if (!self.HasEdgeIndex(name)) {
           PythonChecked(self.MakeEdgeIndex(name));
         }
@@ -1027,7 +1168,9 @@ DefPropertyGraph(py::module& m) {
       },
       py::arg("name"), py::return_value_policy::reference_internal);
 
-  cls.def("unload_topologies", &PropertyGraph::DropAllTopologies);
+  cls.def(
+      "unload_topologies", &PropertyGraph::DropAllTopologies,
+      py::call_guard<py::gil_scoped_release>());
 
   cls.def(
       "write",
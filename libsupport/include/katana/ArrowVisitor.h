@@ -1,6 +1,8 @@
 #ifndef KATANA_LIBSUPPORT_KATANA_ARROWVISITOR_H_
 #define KATANA_LIBSUPPORT_KATANA_ARROWVISITOR_H_
 
+#include <algorithm>
+#include <cstring>
 #include <type_traits>
 
 #include <arrow/api.h>
@@ -325,6 +327,129 @@ VisitArrow(Visitor&& visitor, Args&&... args) {
       std::forward<Visitor>(visitor), std::forward<Args>(args)...);
 }
 
+/// ForEachSetBitRun invokes func(begin, length) for each maximal run of set
+/// bits in bitmap over [offset, offset + length), with begin relative to
+/// offset. The bitmap is consumed a word at a time: all-set and all-clear
+/// words advance 64 bits per iteration and individual bits are only examined
+/// near run edges.
+template <typename Func>
+void
+ForEachSetBitRun(
+    const uint8_t* bitmap, int64_t offset, int64_t length, Func&& func) {
+  int64_t i = 0;
+  int64_t run_begin = -1;
+  auto close_run = [&](int64_t end) {
+    if (run_begin >= 0) {
+      func(run_begin, end - run_begin);
+      run_begin = -1;
+    }
+  };
+  auto scan_bits = [&](int64_t count) {
+    for (int64_t end = i + count; i < end; ++i) {
+      if (arrow::BitUtil::GetBit(bitmap, offset + i)) {
+        if (run_begin < 0) {
+          run_begin = i;
+        }
+      } else {
+        close_run(i);
+      }
+    }
+  };
+
+  // scan bit by bit up to the first byte boundary in the bitmap
+  int64_t lead = std::min(length, ((offset + 7) & ~int64_t{7}) - offset);
+  scan_bits(lead);
+  while (length - i >= 64 && (offset + i) % 8 == 0) {
+    uint64_t word;
+    memcpy(&word, bitmap + (offset + i) / 8, sizeof(word));
+    if (word == ~uint64_t{0}) {
+      if (run_begin < 0) {
+        run_begin = i;
+      }
+      i += 64;
+    } else if (word == 0) {
+      close_run(i);
+      i += 64;
+    } else {
+      scan_bits(64);
+    }
+  }
+  scan_bits(length - i);
+  close_run(length);
+}
+
+/// ForEachValidRun invokes func(values + begin, begin, length) for each
+/// maximal run of non-null elements of a primitive array, where values is
+/// the array's raw values buffer. Together with VisitArrow this gives batch
+/// visitation: the type switch is resolved once per array and func sees
+/// contiguous raw values, so conversion loops can run at memory speed
+/// (and auto-vectorize) instead of dispatching per element.
+///
+///     visitor.Call<ArrowType>(const ArrayType& array) {
+///       ForEachValidRun(array, [&](const T* values, int64_t, int64_t n) {
+///         // tight loop over values[0..n)
+///       });
+///     }
+template <typename ArrayType, typename Func>
+void
+ForEachValidRun(const ArrayType& array, Func&& func) {
+  const auto* values = array.raw_values();
+  const int64_t length = array.length();
+  if (length == 0) {
+    return;
+  }
+  if (array.null_count() == 0) {
+    func(values, int64_t{0}, length);
+    return;
+  }
+  const uint8_t* bitmap = array.null_bitmap_data();
+  if (bitmap == nullptr) {
+    // a null count with no bitmap means every element is null
+    return;
+  }
+  ForEachSetBitRun(
+      bitmap, array.offset(), length, [&](int64_t begin, int64_t run_length) {
+        func(values + begin, begin, run_length);
+      });
+}
+
+/// ForEachValidIndex invokes func(i) for each non-null index of array in
+/// [0, length), where length is capped at the array length. Runs of valid
+/// elements are found a word at a time (see ForEachSetBitRun), so mostly
+/// non-null arrays branch per word rather than per element as an IsValid
+/// check in the loop body would.
+template <typename Func>
+void
+ForEachValidIndex(const arrow::Array& array, int64_t length, Func&& func) {
+  length = std::min(length, array.length());
+  if (length <= 0) {
+    return;
+  }
+  if (array.null_count() == 0) {
+    for (int64_t i = 0; i < length; ++i) {
+      func(i);
+    }
+    return;
+  }
+  const uint8_t* bitmap = array.null_bitmap_data();
+  if (bitmap == nullptr) {
+    // a null count with no bitmap means every element is null
+    return;
+  }
+  ForEachSetBitRun(
+      bitmap, array.offset(), length, [&](int64_t begin, int64_t run_length) {
+        for (int64_t end = begin + run_length; begin < end; ++begin) {
+          func(begin);
+        }
+      });
+}
+
+template <typename Func>
+void
+ForEachValidIndex(const arrow::Array& array, Func&& func) {
+  ForEachValidIndex(array, array.length(), std::forward<Func>(func));
+}
+
 using AcceptNumericArrowTypes = std::tuple<
     arrow::Int8Type, arrow::UInt8Type, arrow::Int16Type, arrow::UInt16Type,
     arrow::Int32Type, arrow::UInt32Type, arrow::Int64Type, arrow::UInt64Type,
@@ -0,0 +1,64 @@
+#ifndef KATANA_LIBSUPPORT_KATANA_CPUDISPATCH_H_
+#define KATANA_LIBSUPPORT_KATANA_CPUDISPATCH_H_
+
+#include "katana/config.h"
+
+namespace katana {
+
+/// ISA tiers a kernel may provide variants for. The levels form a strict
+/// ladder: a CPU reporting a level supports everything below it, so kernels
+/// only need variants for the tiers where their codegen actually differs.
+///
+/// kAvx512 requires the F/BW/VL subset common to Skylake-X, Ice Lake and
+/// Zen4; the more exotic AVX-512 extensions are deliberately not modeled.
+enum class CpuIsaLevel {
+  kBaseline,  ///< whatever the binary was compiled for (SSE2 on x86-64)
+  kAvx2,      ///< AVX2 + FMA
+  kAvx512,    ///< AVX-512 F + BW + VL
+};
+
+/// Return the ISA level of the CPU this process is running on.
+///
+/// Detection runs once, on the first call; SharedMemSys makes that call
+/// during startup so later calls from parallel kernels are a plain load.
+/// The environment variable KATANA_CPU_ISA_LEVEL (baseline, avx2, avx512)
+/// caps the detected level, which is how we reproduce customer reports from
+/// older machines without leaving the build host.
+KATANA_EXPORT CpuIsaLevel GetCpuIsaLevel();
+
+/// Return a human-readable name for an ISA level, for logs and trace tags.
+KATANA_EXPORT const char* CpuIsaLevelName(CpuIsaLevel level);
+
+/// Pick the best implementation of a kernel for the running CPU.
+///
+/// Pass one function pointer per tier; leave a tier nullptr if the kernel
+/// has no dedicated variant for it and the next one down will be used.
+/// Callers resolve once into a function pointer (or a static), not per
+/// element:
+///
+/// \code
+/// static const auto* intersect = katana::ChooseIsaVariant(
+///     IntersectScalar, IntersectAvx2);
+/// \endcode
+template <typename FnPtr>
+FnPtr
+ChooseIsaVariant(FnPtr baseline, FnPtr avx2 = nullptr, FnPtr avx512 = nullptr) {
+  switch (GetCpuIsaLevel()) {
+  case CpuIsaLevel::kAvx512:
+    if (avx512 != nullptr) {
+      return avx512;
+    }
+    [[fallthrough]];
+  case CpuIsaLevel::kAvx2:
+    if (avx2 != nullptr) {
+      return avx2;
+    }
+    [[fallthrough]];
+  default:
+    return baseline;
+  }
+}
+
+}  // end namespace katana
+
+#endif
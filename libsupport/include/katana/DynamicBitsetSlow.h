@@ -105,6 +105,82 @@ public:
   }
 };
 
+/// An iterator that visits only the set bits of a bitset.
+///
+/// Unlike DynamicBitsetIterator this walks the bitset word by word and
+/// uses count-trailing-zeros to jump directly from one set bit to the
+/// next, so a full traversal costs O(words + set bits) rather than one
+/// test per bit. Concurrent set() calls during iteration may or may not
+/// be observed, like test().
+template <typename DynamicBitsetType>
+class KATANA_EXPORT DynamicBitsetSetBitIterator {
+  const DynamicBitsetType* underlying_;
+  uint64_t array_index_;
+  /// Copy of the current word with already-visited bits cleared; 0 only
+  /// at the end position.
+  uint64_t word_{0};
+
+  void SkipZeroWords() {
+    const auto& bitvec = underlying_->get_vec();
+    while (word_ == 0) {
+      ++array_index_;
+      if (array_index_ >= bitvec.size()) {
+        array_index_ = bitvec.size();
+        return;
+      }
+      word_ = bitvec[array_index_].load(std::memory_order_relaxed);
+    }
+  }
+
+public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = uint64_t;
+  using difference_type = int64_t;
+  using pointer = const uint64_t*;
+  using reference = uint64_t;
+
+  DynamicBitsetSetBitIterator(
+      const DynamicBitsetType* underlying, uint64_t array_index)
+      : underlying_(underlying), array_index_(array_index) {
+    const auto& bitvec = underlying_->get_vec();
+    if (array_index_ < bitvec.size()) {
+      word_ = bitvec[array_index_].load(std::memory_order_relaxed);
+      if (word_ == 0) {
+        SkipZeroWords();
+      }
+    }
+  }
+
+  reference operator*() const {
+    KATANA_LOG_DEBUG_ASSERT(word_ != 0);
+    return array_index_ * DynamicBitsetType::kNumBitsInUint64 +
+           __builtin_ctzll(word_);
+  }
+
+  DynamicBitsetSetBitIterator& operator++() {
+    word_ &= word_ - 1;  // clear the lowest set bit
+    if (word_ == 0) {
+      SkipZeroWords();
+    }
+    return *this;
+  }
+
+  DynamicBitsetSetBitIterator operator++(int) {
+    auto r = *this;
+    ++(*this);
+    return r;
+  }
+
+  bool operator==(const DynamicBitsetSetBitIterator& other) const {
+    return underlying_ == other.underlying_ &&
+           array_index_ == other.array_index_ && word_ == other.word_;
+  }
+
+  bool operator!=(const DynamicBitsetSetBitIterator& other) const {
+    return !(*this == other);
+  }
+};
+
 //TODO(emcginnis): Remove this class entirely when DynamicBitset is available to libsupport
 /**
  * Concurrent, thread safe, serial implementation of a dynamically allocated bitset
@@ -391,6 +467,12 @@ public:
     return (old_val & bit_offset);
   }
 
+  /// \returns true iff every bit set in this bitset is also set in
+  /// \p other. The test compares whole words, so it is O(words) rather
+  /// than O(bits) and allocates nothing; bits past the end of the
+  /// shorter operand are treated as 0.
+  bool IsSubsetOf(const DynamicBitsetSlow& other) const;
+
   // assumes bit_vector is not updated (set) in parallel
   void bitwise_or(const DynamicBitsetSlow& other);
 
@@ -469,8 +551,13 @@ public:
     if (size() != other.size()) {
       return false;
     }
-    for (size_t i = 0; i < size(); i++) {
-      if (test(i) != other.test(i)) {
+    // Equal sizes imply equal word counts, and the trailing-bits invariant
+    // guarantees the unused bits of the last word are 0, so comparing whole
+    // words is safe and much faster than bit-by-bit.
+    const auto& other_bitvec = other.get_vec();
+    for (size_t i = 0; i < bitvec_.size(); i++) {
+      if (bitvec_[i].load(std::memory_order_relaxed) !=
+          other_bitvec[i].load(std::memory_order_relaxed)) {
         return false;
       }
     }
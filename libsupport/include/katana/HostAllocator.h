@@ -49,6 +49,27 @@ public:
 
 KATANA_EXPORT HostHeap* GetSwappableHostHeap();
 
+/// HostHeap backed by anonymous memory mappings.
+///
+/// Realloc grows the mapping in place with mremap where available, so growing
+/// a buffer is O(1) instead of allocate-and-copy and never holds both the old
+/// and the new buffer live at once. Untouched pages are address space only;
+/// physical memory is committed on first touch. Allocations are rounded up to
+/// whole pages, so this heap is meant for large, growing buffers (e.g. import
+/// staging arrays), not small objects.
+class KATANA_EXPORT MmapHostHeap : public HostHeap {
+public:
+  void* Malloc(const size_t n_bytes) override;
+  void* Calloc(const size_t n_items, const size_t item_size) override;
+  void* Realloc(void* ptr, const size_t new_bytes) override;
+  void Free(void* ptr) override;
+  bool IsFastAlloc() const override { return true; }
+
+  ~MmapHostHeap() override;
+};
+
+KATANA_EXPORT HostHeap* GetMmapHostHeap();
+
 template <typename Ty>
 class HostAllocator {
   HostHeap* hh_;
@@ -237,4 +237,39 @@ KATANA_EXPORT void AbortApplication [[noreturn]] ();
 #define KATANA_DEBUG_WARN_ONCE(...)
 #endif
 
+/// KATANA_ASSUME tells the optimizer that a condition holds without
+/// emitting any code to check it. The condition must be free of side
+/// effects; it may never be evaluated at runtime. Unlike an elided
+/// assertion, the hint survives into release builds, so bounds
+/// information stays available to the vectorizer.
+#if defined(__clang__)
+#define KATANA_ASSUME(cond) __builtin_assume(cond)
+#elif defined(__GNUC__)
+#define KATANA_ASSUME(cond)                                                    \
+  do {                                                                         \
+    if (!(cond)) {                                                             \
+      __builtin_unreachable();                                                 \
+    }                                                                          \
+  } while (0)
+#else
+#define KATANA_ASSUME(cond)                                                    \
+  do {                                                                         \
+  } while (0)
+#endif
+
+/// KATANA_HOT_ASSERT is the assertion tier for per-element hot paths
+/// (per-edge/per-node accessors called inside parallel loops). In debug
+/// builds it is a full KATANA_LOG_ASSERT. In release builds it compiles
+/// to a KATANA_ASSUME hint: no branch, no function-call boundary, but
+/// the optimizer keeps the bounds fact. Configuring with
+/// KATANA_AUDIT_HOT_ASSERTS=ON (which defines KATANA_HOT_ASSERT_AUDIT)
+/// keeps the full checks in release builds so a perf profile or an
+/// objdump diff against a normal release build pinpoints any check that
+/// is still paid for on a hot path.
+#if !defined(NDEBUG) || defined(KATANA_HOT_ASSERT_AUDIT)
+#define KATANA_HOT_ASSERT(cond) KATANA_LOG_ASSERT(cond)
+#else
+#define KATANA_HOT_ASSERT(cond) KATANA_ASSUME(cond)
+#endif
+
 #endif
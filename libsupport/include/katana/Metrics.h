@@ -0,0 +1,110 @@
+#ifndef KATANA_LIBSUPPORT_KATANA_METRICS_H_
+#define KATANA_LIBSUPPORT_KATANA_METRICS_H_
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "katana/Result.h"
+#include "katana/config.h"
+
+namespace katana {
+
+/// A fixed-size latency histogram with bounded relative error.
+///
+/// Values (microseconds) are bucketed by power of two with 16 linear
+/// sub-buckets per power, so any reported percentile is within ~6% of
+/// the true value regardless of magnitude — the same scheme HDR
+/// histograms use. Recording is a single relaxed atomic increment and
+/// is safe from any thread; reading percentiles scans the 1024 buckets.
+class KATANA_EXPORT LatencyHistogram {
+public:
+  static constexpr uint32_t kSubBucketBits = 4;
+  static constexpr uint32_t kSubBuckets = 1 << kSubBucketBits;
+  static constexpr uint32_t kNumBuckets = 64 * kSubBuckets;
+
+  /// Record one latency observation, in microseconds.
+  void Record(uint64_t usec);
+
+  uint64_t Count() const;
+  uint64_t Max() const { return max_.load(std::memory_order_relaxed); }
+
+  /// Return the approximate value at quantile \p q in [0, 1] (e.g.,
+  /// 0.99 for p99); 0 when the histogram is empty.
+  uint64_t Percentile(double q) const;
+
+private:
+  static uint32_t BucketIndex(uint64_t usec);
+  static uint64_t BucketValue(uint32_t index);
+
+  std::array<std::atomic<uint64_t>, kNumBuckets> buckets_{};
+  std::atomic<uint64_t> max_{0};
+};
+
+/// Process-wide registry of operation latency histograms and gauges.
+///
+/// Services that embed SharedMemSys and run analytics per request
+/// record each operation's latency here and serve Metrics::ToJson from
+/// their metrics endpoint, instead of every client measuring for
+/// itself. Recording is cheap and thread-safe; histograms are created
+/// on first use per operation name.
+class KATANA_EXPORT Metrics {
+public:
+  static Metrics& Get();
+
+  Metrics(const Metrics&) = delete;
+  Metrics& operator=(const Metrics&) = delete;
+
+  /// Record one completed operation named \p op taking \p usec.
+  void RecordLatency(const std::string& op, uint64_t usec);
+
+  /// Number of operations currently in flight (see OperationGuard).
+  int64_t ActiveOperations() const {
+    return active_ops_.load(std::memory_order_relaxed);
+  }
+
+  /// Serialize a snapshot: per operation count, max and
+  /// p50/p90/p99/p999 latencies in microseconds, plus the active
+  /// operation gauge. The output is what a pull-style metrics endpoint
+  /// should return.
+  Result<std::string> ToJson() const;
+
+private:
+  friend class OperationGuard;
+
+  Metrics() = default;
+
+  LatencyHistogram& GetHistogram(const std::string& op);
+
+  std::atomic<int64_t> active_ops_{0};
+  mutable std::mutex lock_;
+  // Pointers are stable across rehashing; histograms are never removed.
+  std::map<std::string, std::unique_ptr<LatencyHistogram>> histograms_;
+};
+
+/// Times one operation and records it into Metrics on destruction,
+/// maintaining the active-operation gauge while alive.
+class KATANA_EXPORT [[nodiscard]] OperationGuard {
+public:
+  explicit OperationGuard(std::string op);
+
+  OperationGuard(const OperationGuard&) = delete;
+  OperationGuard(OperationGuard&&) = delete;
+  OperationGuard& operator=(const OperationGuard&) = delete;
+  OperationGuard& operator=(OperationGuard&&) = delete;
+
+  ~OperationGuard();
+
+private:
+  std::string op_;
+  std::chrono::steady_clock::time_point start_;
+};
+
+}  // namespace katana
+
+#endif
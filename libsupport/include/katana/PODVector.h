@@ -50,6 +50,11 @@ namespace katana {
  * If the allocation can be concurrent, check katana::gstl::Vector.
  * If the allocation is large and of known size, then check katana::NUMAArray.
  * Read CONTRIBUTING.md for a more detailed comparison between these types.
+ *
+ * For large buffers whose final size is unknown (e.g. import staging arrays),
+ * construct with an allocator over katana::GetMmapHostHeap(): growth then
+ * remaps the buffer in place instead of allocating and copying, so doubling
+ * is O(1) and the old and new buffers are never live at the same time.
  */
 template <typename _Tp>
 class PODVector {
@@ -0,0 +1,82 @@
+#include "katana/CpuDispatch.h"
+
+#include <string>
+
+#include "katana/Env.h"
+#include "katana/Logging.h"
+
+namespace {
+
+katana::CpuIsaLevel
+DetectIsaLevel() {
+#if defined(__x86_64__) || defined(__i386__)
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f") &&
+      __builtin_cpu_supports("avx512bw") &&
+      __builtin_cpu_supports("avx512vl")) {
+    return katana::CpuIsaLevel::kAvx512;
+  }
+  if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+    return katana::CpuIsaLevel::kAvx2;
+  }
+#endif
+  return katana::CpuIsaLevel::kBaseline;
+}
+
+katana::CpuIsaLevel
+ResolveIsaLevel() {
+  katana::CpuIsaLevel detected = DetectIsaLevel();
+
+  std::string requested;
+  if (!katana::GetEnv("KATANA_CPU_ISA_LEVEL", &requested)) {
+    return detected;
+  }
+
+  katana::CpuIsaLevel cap;
+  if (requested == "baseline") {
+    cap = katana::CpuIsaLevel::kBaseline;
+  } else if (requested == "avx2") {
+    cap = katana::CpuIsaLevel::kAvx2;
+  } else if (requested == "avx512") {
+    cap = katana::CpuIsaLevel::kAvx512;
+  } else {
+    KATANA_LOG_WARN(
+        "KATANA_CPU_ISA_LEVEL value {} not recognized (expected baseline, "
+        "avx2 or avx512); using detected level {}",
+        requested, katana::CpuIsaLevelName(detected));
+    return detected;
+  }
+
+  // The override can only lower the level: running AVX-512 code on a CPU
+  // without it is an illegal instruction, not a performance experiment.
+  if (cap > detected) {
+    KATANA_LOG_WARN(
+        "KATANA_CPU_ISA_LEVEL requests {} but this CPU only supports {}; "
+        "ignoring",
+        requested, katana::CpuIsaLevelName(detected));
+    return detected;
+  }
+  return cap;
+}
+
+}  // namespace
+
+katana::CpuIsaLevel
+katana::GetCpuIsaLevel() {
+  static const CpuIsaLevel level = ResolveIsaLevel();
+  return level;
+}
+
+const char*
+katana::CpuIsaLevelName(CpuIsaLevel level) {
+  switch (level) {
+  case CpuIsaLevel::kBaseline:
+    return "baseline";
+  case CpuIsaLevel::kAvx2:
+    return "avx2";
+  case CpuIsaLevel::kAvx512:
+    return "avx512";
+  default:
+    return "unknown";
+  }
+}
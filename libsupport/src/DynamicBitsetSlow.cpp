@@ -2,6 +2,25 @@
 
 #include <algorithm>
 
+bool
+katana::DynamicBitsetSlow::IsSubsetOf(const DynamicBitsetSlow& other) const {
+  const auto& other_bitvec = other.get_vec();
+  size_t common = std::min(bitvec_.size(), other_bitvec.size());
+
+  for (size_t i = 0; i < common; i++) {
+    if ((bitvec_[i] & ~other_bitvec[i]) != 0) {
+      return false;
+    }
+  }
+  // Bits beyond the other bitset's width must all be clear.
+  for (size_t i = common; i < bitvec_.size(); i++) {
+    if (bitvec_[i] != 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
 void
 katana::DynamicBitsetSlow::bitwise_or(const DynamicBitsetSlow& other) {
   KATANA_LOG_DEBUG_ASSERT(size() == other.size());
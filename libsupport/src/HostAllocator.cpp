@@ -1,5 +1,47 @@
 #include "katana/HostAllocator.h"
 
+#include <cstdint>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace {
+
+// Each mapping starts with a small header recording the mapping length so
+// that Realloc and Free can recover it from the user pointer alone. The
+// header is max_align_t-sized to keep the returned pointer suitably aligned.
+constexpr size_t kHeaderSize = alignof(std::max_align_t);
+
+size_t
+RoundToPage(size_t bytes) {
+  static const size_t page_size = sysconf(_SC_PAGESIZE);
+  return (bytes + page_size - 1) & ~(page_size - 1);
+}
+
+void*
+BaseOf(void* ptr) {
+  return static_cast<char*>(ptr) - kHeaderSize;
+}
+
+size_t
+MappedLength(void* ptr) {
+  return *static_cast<size_t*>(BaseOf(ptr));
+}
+
+void*
+MapLength(size_t map_len) {
+  void* base = mmap(
+      nullptr, map_len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS,
+      -1, 0);
+  if (base == MAP_FAILED) {
+    return nullptr;
+  }
+  *static_cast<size_t*>(base) = map_len;
+  return static_cast<char*>(base) + kHeaderSize;
+}
+
+}  // namespace
+
 namespace katana {
 
 HostHeap::~HostHeap() {}
@@ -12,4 +54,68 @@ GetSwappableHostHeap() {
   return &swappable_host_heap;
 }
 
+MmapHostHeap::~MmapHostHeap() {}
+
+void*
+MmapHostHeap::Malloc(const size_t n_bytes) {
+  if (n_bytes == 0) {
+    return nullptr;
+  }
+  return MapLength(RoundToPage(n_bytes + kHeaderSize));
+}
+
+void*
+MmapHostHeap::Calloc(const size_t n_items, const size_t item_size) {
+  // Fresh anonymous pages are already zero.
+  return Malloc(n_items * item_size);
+}
+
+void*
+MmapHostHeap::Realloc(void* ptr, const size_t new_bytes) {
+  if (ptr == nullptr) {
+    return Malloc(new_bytes);
+  }
+  if (new_bytes == 0) {
+    Free(ptr);
+    return nullptr;
+  }
+
+  size_t old_len = MappedLength(ptr);
+  size_t new_len = RoundToPage(new_bytes + kHeaderSize);
+  if (new_len <= old_len) {
+    return ptr;
+  }
+
+#ifdef __linux__
+  void* base = mremap(BaseOf(ptr), old_len, new_len, MREMAP_MAYMOVE);
+  if (base == MAP_FAILED) {
+    return nullptr;
+  }
+  *static_cast<size_t*>(base) = new_len;
+  return static_cast<char*>(base) + kHeaderSize;
+#else
+  void* new_ptr = MapLength(new_len);
+  if (new_ptr == nullptr) {
+    return nullptr;
+  }
+  memcpy(new_ptr, ptr, old_len - kHeaderSize);
+  Free(ptr);
+  return new_ptr;
+#endif
+}
+
+void
+MmapHostHeap::Free(void* ptr) {
+  if (ptr == nullptr) {
+    return;
+  }
+  munmap(BaseOf(ptr), MappedLength(ptr));
+}
+
+HostHeap*
+GetMmapHostHeap() {
+  static MmapHostHeap mmap_host_heap;
+  return &mmap_host_heap;
+}
+
 }  // namespace katana
@@ -0,0 +1,124 @@
+#include "katana/Metrics.h"
+
+#include <nlohmann/json.hpp>
+
+#include "katana/JSON.h"
+
+uint32_t
+katana::LatencyHistogram::BucketIndex(uint64_t usec) {
+  if (usec < kSubBuckets) {
+    return static_cast<uint32_t>(usec);
+  }
+  // Position of the highest set bit selects the power-of-two bucket;
+  // the next kSubBucketBits bits select the linear sub-bucket.
+  uint32_t exponent = 63 - __builtin_clzll(usec);
+  uint32_t sub = (usec >> (exponent - kSubBucketBits)) & (kSubBuckets - 1);
+  return exponent * kSubBuckets + sub;
+}
+
+uint64_t
+katana::LatencyHistogram::BucketValue(uint32_t index) {
+  uint32_t exponent = index / kSubBuckets;
+  uint32_t sub = index % kSubBuckets;
+  if (exponent < kSubBucketBits) {
+    return index;
+  }
+  // Midpoint of the bucket's range.
+  uint64_t base = (uint64_t{1} << exponent) +
+                  (uint64_t{sub} << (exponent - kSubBucketBits));
+  return base + (uint64_t{1} << (exponent - kSubBucketBits)) / 2;
+}
+
+void
+katana::LatencyHistogram::Record(uint64_t usec) {
+  buckets_[BucketIndex(usec)].fetch_add(1, std::memory_order_relaxed);
+  uint64_t prev = max_.load(std::memory_order_relaxed);
+  while (prev < usec &&
+         !max_.compare_exchange_weak(prev, usec, std::memory_order_relaxed)) {
+  }
+}
+
+uint64_t
+katana::LatencyHistogram::Count() const {
+  uint64_t total = 0;
+  for (const auto& bucket : buckets_) {
+    total += bucket.load(std::memory_order_relaxed);
+  }
+  return total;
+}
+
+uint64_t
+katana::LatencyHistogram::Percentile(double q) const {
+  uint64_t total = Count();
+  if (total == 0) {
+    return 0;
+  }
+  auto rank = static_cast<uint64_t>(q * static_cast<double>(total - 1));
+  uint64_t seen = 0;
+  for (uint32_t i = 0; i < kNumBuckets; ++i) {
+    seen += buckets_[i].load(std::memory_order_relaxed);
+    if (seen > rank) {
+      return BucketValue(i);
+    }
+  }
+  return Max();
+}
+
+katana::Metrics&
+katana::Metrics::Get() {
+  static Metrics metrics;
+  return metrics;
+}
+
+katana::LatencyHistogram&
+katana::Metrics::GetHistogram(const std::string& op) {
+  std::lock_guard<std::mutex> guard(lock_);
+  auto& slot = histograms_[op];
+  if (!slot) {
+    slot = std::make_unique<LatencyHistogram>();
+  }
+  return *slot;
+}
+
+void
+katana::Metrics::RecordLatency(const std::string& op, uint64_t usec) {
+  GetHistogram(op).Record(usec);
+}
+
+katana::Result<std::string>
+katana::Metrics::ToJson() const {
+  nlohmann::json obj;
+  obj["active_operations"] = ActiveOperations();
+
+  nlohmann::json ops = nlohmann::json::object();
+  {
+    std::lock_guard<std::mutex> guard(lock_);
+    for (const auto& [name, hist] : histograms_) {
+      ops[name] = {
+          {"count", hist->Count()},
+          {"max_usec", hist->Max()},
+          {"p50_usec", hist->Percentile(0.5)},
+          {"p90_usec", hist->Percentile(0.9)},
+          {"p99_usec", hist->Percentile(0.99)},
+          {"p999_usec", hist->Percentile(0.999)},
+      };
+    }
+  }
+  obj["operations"] = std::move(ops);
+
+  return JsonDump(obj);
+}
+
+katana::OperationGuard::OperationGuard(std::string op)
+    : op_(std::move(op)), start_(std::chrono::steady_clock::now()) {
+  Metrics::Get().active_ops_.fetch_add(1, std::memory_order_relaxed);
+}
+
+katana::OperationGuard::~OperationGuard() {
+  auto& metrics = Metrics::Get();
+  metrics.active_ops_.fetch_sub(1, std::memory_order_relaxed);
+  auto usec = std::chrono::duration_cast<std::chrono::microseconds>(
+                  std::chrono::steady_clock::now() - start_)
+                  .count();
+  metrics.RecordLatency(op_, static_cast<uint64_t>(usec));
+}
@@ -144,6 +144,59 @@ TestIsStringLikeTypePatchedNeeded() {
   KATANA_LOG_ASSERT(IsStringLikeTypePatchedNeeded<arrow::BooleanType>(nullptr));
 }
 
+void
+TestForEachValidRun() {
+  // exceed one bitmap word so the word-at-a-time path is exercised; every
+  // 71st element is null to place run edges at varying bit offsets
+  constexpr int64_t kLength = 1000;
+  arrow::Int64Builder builder;
+  int64_t expected_sum = 0;
+  int64_t expected_valid = 0;
+  for (int64_t i = 0; i < kLength; ++i) {
+    if (i % 71 == 0) {
+      KATANA_LOG_ASSERT(builder.AppendNull().ok());
+    } else {
+      KATANA_LOG_ASSERT(builder.Append(i).ok());
+      expected_sum += i;
+      ++expected_valid;
+    }
+  }
+  std::shared_ptr<arrow::Array> array;
+  KATANA_LOG_ASSERT(builder.Finish(&array).ok());
+  const auto& typed = static_cast<const arrow::Int64Array&>(*array);
+
+  int64_t sum = 0;
+  int64_t valid = 0;
+  katana::ForEachValidRun(
+      typed, [&](const int64_t* values, int64_t begin, int64_t length) {
+        KATANA_LOG_ASSERT(length > 0);
+        for (int64_t i = 0; i < length; ++i) {
+          KATANA_LOG_ASSERT(values[i] == begin + i);
+          sum += values[i];
+        }
+        valid += length;
+      });
+  KATANA_LOG_ASSERT(sum == expected_sum);
+  KATANA_LOG_ASSERT(valid == expected_valid);
+
+  // a fully valid array must arrive as one contiguous run
+  arrow::Int64Builder dense_builder;
+  for (int64_t i = 0; i < 100; ++i) {
+    KATANA_LOG_ASSERT(dense_builder.Append(i).ok());
+  }
+  std::shared_ptr<arrow::Array> dense;
+  KATANA_LOG_ASSERT(dense_builder.Finish(&dense).ok());
+  int64_t runs = 0;
+  katana::ForEachValidRun(
+      static_cast<const arrow::Int64Array&>(*dense),
+      [&](const int64_t*, int64_t begin, int64_t length) {
+        ++runs;
+        KATANA_LOG_ASSERT(begin == 0);
+        KATANA_LOG_ASSERT(length == 100);
+      });
+  KATANA_LOG_ASSERT(runs == 1);
+}
+
 }  // namespace
 
 int
@@ -157,4 +210,6 @@ main() {
   TestMultipleParameters();
 
   TestTupleContains();
+
+  TestForEachValidRun();
 }
@@ -0,0 +1,67 @@
+#include "katana/CpuDispatch.h"
+
+#include <string>
+
+#include "katana/Logging.h"
+
+namespace {
+
+int
+Baseline() {
+  return 0;
+}
+
+int
+Avx2() {
+  return 2;
+}
+
+int
+Avx512() {
+  return 5;
+}
+
+void
+TestDetectionIsStable() {
+  katana::CpuIsaLevel first = katana::GetCpuIsaLevel();
+  for (int i = 0; i < 100; ++i) {
+    KATANA_LOG_ASSERT(katana::GetCpuIsaLevel() == first);
+  }
+  KATANA_LOG_ASSERT(
+      std::string(katana::CpuIsaLevelName(first)) != "unknown");
+}
+
+void
+TestChooseIsaVariant() {
+  // With only a baseline variant every CPU gets the baseline.
+  KATANA_LOG_ASSERT(katana::ChooseIsaVariant(&Baseline)() == 0);
+
+  // A full ladder resolves to exactly the detected level.
+  int (*chosen)() = katana::ChooseIsaVariant(&Baseline, &Avx2, &Avx512);
+  switch (katana::GetCpuIsaLevel()) {
+  case katana::CpuIsaLevel::kBaseline:
+    KATANA_LOG_ASSERT(chosen() == 0);
+    break;
+  case katana::CpuIsaLevel::kAvx2:
+    KATANA_LOG_ASSERT(chosen() == 2);
+    break;
+  case katana::CpuIsaLevel::kAvx512:
+    KATANA_LOG_ASSERT(chosen() == 5);
+    break;
+  }
+
+  // A hole in the ladder falls through to the next variant down.
+  int (*no_avx512)() = katana::ChooseIsaVariant(&Baseline, &Avx2, {});
+  if (katana::GetCpuIsaLevel() == katana::CpuIsaLevel::kAvx512) {
+    KATANA_LOG_ASSERT(no_avx512() == 2);
+  }
+}
+
+}  // namespace
+
+int
+main() {
+  TestDetectionIsStable();
+  TestChooseIsaVariant();
+  return 0;
+}
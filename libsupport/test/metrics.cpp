@@ -0,0 +1,45 @@
+#include "katana/Metrics.h"
+
+#include "katana/Logging.h"
+
+void
+TestHistogram() {
+  katana::LatencyHistogram hist;
+  for (uint64_t i = 1; i <= 1000; ++i) {
+    hist.Record(i);
+  }
+  KATANA_LOG_ASSERT(hist.Count() == 1000);
+  KATANA_LOG_ASSERT(hist.Max() == 1000);
+
+  // Bucketing bounds relative error to one sub-bucket (~6%).
+  uint64_t p50 = hist.Percentile(0.5);
+  KATANA_LOG_VASSERT(p50 >= 450 && p50 <= 550, "p50 was {}", p50);
+  uint64_t p99 = hist.Percentile(0.99);
+  KATANA_LOG_VASSERT(p99 >= 920 && p99 <= 1070, "p99 was {}", p99);
+}
+
+void
+TestRegistry() {
+  auto& metrics = katana::Metrics::Get();
+  KATANA_LOG_ASSERT(metrics.ActiveOperations() == 0);
+  {
+    katana::OperationGuard guard("bfs");
+    KATANA_LOG_ASSERT(metrics.ActiveOperations() == 1);
+  }
+  KATANA_LOG_ASSERT(metrics.ActiveOperations() == 0);
+  metrics.RecordLatency("bfs", 1234);
+
+  auto json_res = metrics.ToJson();
+  KATANA_LOG_ASSERT(json_res);
+  const std::string& json = json_res.value();
+  KATANA_LOG_ASSERT(json.find("\"bfs\"") != std::string::npos);
+  KATANA_LOG_ASSERT(json.find("active_operations") != std::string::npos);
+  KATANA_LOG_ASSERT(json.find("p99_usec") != std::string::npos);
+}
+
+int
+main() {
+  TestHistogram();
+  TestRegistry();
+  return 0;
+}
@@ -0,0 +1,47 @@
+#ifndef KATANA_LIBTSUBA_KATANA_ARROWIPCWRITER_H_
+#define KATANA_LIBTSUBA_KATANA_ARROWIPCWRITER_H_
+
+#include <memory>
+
+#include <arrow/api.h>
+
+#include "katana/Result.h"
+#include "katana/URI.h"
+#include "katana/WriteGroup.h"
+
+namespace katana {
+
+/// Serializes an arrow::Table to the Arrow IPC stream format.
+///
+/// Unlike ParquetWriter this performs no encoding or compression: record
+/// batches reference the table's column buffers directly, so consumers
+/// that speak Arrow (feature stores, arrow.ipc readers, pyarrow) ingest
+/// the payload without per-element conversion.
+class KATANA_EXPORT ArrowIPCWriter {
+public:
+  /// \returns a writer for \param table; fails if the table has no
+  /// columns since an IPC stream needs a schema
+  static katana::Result<std::unique_ptr<ArrowIPCWriter>> Make(
+      std::shared_ptr<arrow::Table> table);
+
+  /// Serialize the table into an in-memory IPC stream
+  katana::Result<std::shared_ptr<arrow::Buffer>> ToBuffer();
+
+  /// Write the IPC stream out to a storage location. If `group` is null
+  /// the write is synchronous, otherwise an asynchronous write is
+  /// started and managed by group
+  /// \param uri the storage location to write to
+  /// \param group optional write group to group this write operation with
+  katana::Result<void> WriteToUri(
+      const katana::URI& uri, WriteGroup* group = nullptr);
+
+private:
+  ArrowIPCWriter(std::shared_ptr<arrow::Table> table)
+      : table_(std::move(table)) {}
+
+  std::shared_ptr<arrow::Table> table_;
+};
+
+}  // namespace katana
+
+#endif
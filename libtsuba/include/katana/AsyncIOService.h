@@ -0,0 +1,59 @@
+#ifndef KATANA_LIBTSUBA_KATANA_ASYNCIOSERVICE_H_
+#define KATANA_LIBTSUBA_KATANA_ASYNCIOSERVICE_H_
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+
+#include "katana/Result.h"
+#include "katana/config.h"
+
+namespace katana {
+
+/// A single dedicated I/O thread shared by tsuba's asynchronous storage
+/// operations.
+///
+/// Storage backends that implement the *Async interface with std::async
+/// either run the operation inline (deferred futures that block the compute
+/// thread in AsyncOpGroup::Finish) or spawn a fresh thread per operation,
+/// competing with the compute threads for cores. This service instead parks
+/// one thread reserved out of the galois ThreadPool (runDedicated) and
+/// drains a FIFO of submitted operations on it, so reads and writes overlap
+/// with computation without oversubscription.
+class KATANA_EXPORT AsyncIOService {
+public:
+  typedef std::function<katana::CopyableResult<void>()> Op;
+
+  AsyncIOService(const AsyncIOService&) = delete;
+  AsyncIOService& operator=(const AsyncIOService&) = delete;
+
+  /// Get the process-wide service, starting the dedicated thread on first
+  /// use.
+  static AsyncIOService& Get();
+
+  /// Run op on the dedicated I/O thread. The returned future becomes ready
+  /// when the operation completes; any state op captures by reference must
+  /// outlive that completion.
+  std::future<katana::CopyableResult<void>> Submit(Op op);
+
+  /// Number of operations submitted but not yet started; exposed for
+  /// tests and stats.
+  size_t NumPending();
+
+private:
+  AsyncIOService();
+
+  /// Body of the dedicated thread; parks on work_ready_ until submissions
+  /// arrive. Runs until process exit.
+  void Run();
+
+  std::mutex lock_;
+  std::condition_variable work_ready_;
+  std::deque<std::packaged_task<katana::CopyableResult<void>()>> pending_;
+};
+
+}  // namespace katana
+
+#endif
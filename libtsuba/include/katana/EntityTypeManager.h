@@ -268,9 +268,9 @@ public:
   /// This function can be used to convert "old style" graphs (storage format 1,
   /// where types are represented by uint8 properties) and "new style"
   /// graphs (version > 2, where types are represented in our native type
-  /// represenation). This function is serial but it likely iterates over
-  /// O(nodes) and O(edges) vectors, so it is very slow. It should only be used
-  /// for updating old graphs.
+  /// represenation). The O(nodes) and O(edges) scans over the type
+  /// properties run in parallel, but this still reads every type column in
+  /// full, so it should only be used for updating old graphs.
   ///
   /// The length of entity_type_ids should be equal to topo_size.
   /// properties->num_rows() should be equal to the length of entity_type_ids or
@@ -320,23 +320,8 @@ public:
     }
     TypeProperties type_properties = std::move(res.value());
 
-    // assign the type ID for each row
-    for (int64_t row = 0; row < num_rows; ++row) {
-      TypeProperties::FieldEntity field_indices;
-      for (auto& uint8_property : type_properties.uint8_properties) {
-        if (uint8_property.array->IsValid(row) &&
-            uint8_property.array->Value(row)) {
-          field_indices.emplace_back(uint8_property.field_index);
-        }
-      }
-      if (field_indices.empty()) {
-        entity_type_ids->at(row) = katana::kUnknownEntityType;
-      } else {
-        katana::EntityTypeID entity_type_id =
-            type_properties.type_field_indices_to_id.at(field_indices);
-        entity_type_ids->at(row) = entity_type_id;
-      }
-    }
+    // assign the type ID for each row; this is O(rows) and runs in parallel
+    MapRowsToEntityTypeIDs(type_properties, num_rows, entity_type_ids->data());
 
     std::vector<std::string> properties_used;
     for (const auto& prop_col : type_properties.uint8_properties) {
@@ -573,13 +558,10 @@ public:
   /// sub-type of the type \p super_type
   /// (assumes that the sub_type and super_type EntityTypeIDs exists)
   bool IsSubtypeOf(EntityTypeID sub_type, EntityTypeID super_type) const {
-    const auto& super_atomic_types = GetAtomicSubtypes(super_type);
-    const auto& sub_atomic_types = GetAtomicSubtypes(sub_type);
-    // return true if sub_atomic_types is a subset of super_atomic_types
-    SetOfEntityTypeIDs res;
-    res.resize(SetOfEntityTypeIDsSize_);
-    res.bitwise_and(sub_atomic_types, super_atomic_types);
-    return (res == sub_atomic_types);
+    // The subset test compares whole bitset words and allocates nothing,
+    // so this is cheap enough to sit on query filter hot paths.
+    return GetAtomicSubtypes(sub_type).IsSubsetOf(
+        GetAtomicSubtypes(super_type));
   }
 
   const EntityTypeIDToSetOfEntityTypeIDsMap&
@@ -674,6 +656,13 @@ private:
       const std::shared_ptr<arrow::Table>& properties,
       EntityTypeManager* entity_type_manager);
 
+  /// Map each property row to its EntityTypeID using the combination
+  /// table built by DoAssignEntityTypeIDsFromProperties. Rows are
+  /// independent, so the scan is parallel.
+  static void MapRowsToEntityTypeIDs(
+      const TypeProperties& type_properties, int64_t num_rows,
+      EntityTypeID* entity_type_ids);
+
   void Init() {
     // assume kUnknownEntityType is 0
     static_assert(kUnknownEntityType == 0);
@@ -4,6 +4,7 @@
 #include <cstdint>
 #include <future>
 #include <string>
+#include <vector>
 
 #include <arrow/status.h>
 #include <parquet/arrow/writer.h>
@@ -19,13 +20,27 @@ class KATANA_EXPORT FileFrame : public arrow::io::OutputStream {
   uint64_t map_size_;
   uint64_t region_size_;
   uint64_t cursor_;
+  // Streaming state: when streaming_chunk_ is non-zero and the destination
+  // supports streaming stores, Write flushes the buffer to storage every
+  // streaming_chunk_ bytes instead of letting it grow; flushed_ counts the
+  // bytes already handed to storage and streaming_ is true once a store has
+  // been opened.
+  uint64_t streaming_chunk_{0};
+  uint64_t flushed_{0};
+  bool streaming_{false};
   bool valid_ = false;
   bool synced_ = false;
+  // Compressed image of the buffer built by Persist/PersistAsync when
+  // KATANA_FILEFRAME_COMPRESSION is set; kept as a member so the bytes
+  // outlive the asynchronous store.
+  std::vector<uint8_t> compressed_;
 
   katana::Result<void> GrowBuffer(int64_t accommodate);
 
   katana::Result<void> MapContguousExtension(uint64_t new_size);
 
+  katana::Result<void> FlushChunk();
+
 public:
   FileFrame() = default;
   FileFrame(const FileFrame&) = delete;
@@ -37,9 +52,14 @@ public:
         map_size_(other.map_size_),
         region_size_(other.region_size_),
         cursor_(other.cursor_),
+        streaming_chunk_(other.streaming_chunk_),
+        flushed_(other.flushed_),
+        streaming_(other.streaming_),
         valid_(other.valid_),
-        synced_(other.synced_) {
+        synced_(other.synced_),
+        compressed_(std::move(other.compressed_)) {
     other.valid_ = false;
+    other.streaming_ = false;
   }
 
   FileFrame& operator=(FileFrame&& other) noexcept {
@@ -52,9 +72,14 @@ public:
       map_size_ = other.map_size_;
       region_size_ = other.region_size_;
       cursor_ = other.cursor_;
+      streaming_chunk_ = other.streaming_chunk_;
+      flushed_ = other.flushed_;
+      streaming_ = other.streaming_;
       synced_ = other.synced_;
       valid_ = other.valid_;
+      compressed_ = std::move(other.compressed_);
       other.valid_ = false;
+      other.streaming_ = false;
     }
     return *this;
   }
@@ -63,6 +88,14 @@ public:
 
   katana::Result<void> Init(uint64_t reserve_size);
   katana::Result<void> Init() { return Init(1); }
+
+  /// Associate this frame with a destination file. When
+  /// KATANA_STREAMING_WRITE_CHUNK_MB is set and the destination's storage
+  /// backend supports streaming stores, Write flushes the buffer to storage
+  /// whenever it holds that many megabytes, so persisting the frame costs
+  /// O(chunk) memory instead of the whole file. Streaming frames must be
+  /// written strictly through Write/PaddedWrite; ptr() only covers data not
+  /// yet flushed.
   void Bind(std::string_view filename);
 
   katana::Result<void> Destroy();
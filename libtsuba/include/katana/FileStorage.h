@@ -48,6 +48,18 @@ public:
   /// to the LocalStorage when no protocol on the URI is provided
   virtual uint32_t Priority() const { return 0; }
 
+  /// Streaming puts assemble an object chunk by chunk so a writer never has
+  /// to hold the whole serialized file in memory. Backends that can append
+  /// override all three hooks and report support; callers must issue
+  /// Begin/Append/Finish for any one uri from a single thread. The default
+  /// implementations report NotImplemented and callers fall back to the
+  /// buffered PutSync/PutAsync path.
+  virtual bool SupportsStreamingPut() const { return false; }
+  virtual katana::Result<void> PutStreamingBegin(const std::string& uri);
+  virtual katana::Result<void> PutStreamingAppend(
+      const std::string& uri, const uint8_t* data, uint64_t size);
+  virtual katana::Result<void> PutStreamingFinish(const std::string& uri);
+
   // get on future can potentially block (bulk synchronous parallel)
   virtual std::future<katana::CopyableResult<void>> PutAsync(
       const std::string& uri, const uint8_t* data, uint64_t size) = 0;
@@ -26,11 +26,16 @@ public:
         page_shift_(other.page_shift_),
         cursor_(other.cursor_),
         mem_start_(other.mem_start_),
+        min_fill_size_(other.min_fill_size_),
+        advised_begin_(other.advised_begin_),
+        advised_end_(other.advised_end_),
         filename_(std::move(other.filename_)),
         bound_(other.bound_),
+        file_mapped_(other.file_mapped_),
         filling_(std::move(other.filling_)),
         fetches_(std::move(other.fetches_)) {
     other.bound_ = false;
+    other.file_mapped_ = false;
   }
 
   FileView& operator=(FileView&& other) noexcept {
@@ -43,12 +48,17 @@ public:
       page_shift_ = other.page_shift_;
       cursor_ = other.cursor_;
       mem_start_ = other.mem_start_;
+      min_fill_size_ = other.min_fill_size_;
+      advised_begin_ = other.advised_begin_;
+      advised_end_ = other.advised_end_;
       filename_ = std::move(other.filename_);
       bound_ = other.bound_;
+      file_mapped_ = other.file_mapped_;
       filling_ = std::move(other.filling_);
       fetches_ =
           std::unique_ptr<std::vector<FillingRange>>(std::move(other.fetches_));
       other.bound_ = false;
+      other.file_mapped_ = false;
     }
     return *this;
   }
@@ -65,6 +75,18 @@ public:
   /// Calls to Read will handle asynchronous
   /// reads internally, but if you intend to use ptr(), you should pass
   /// resolve=true.
+  ///
+  /// When KATANA_MMAP_LOCAL_FILES is set and filename refers to a local
+  /// file, the file itself is mapped read-only instead of being copied into
+  /// anonymous memory; ptr() then points straight at the page cache. See
+  /// TryBindMapped for the details and caveats.
+  ///
+  /// When KATANA_MIN_READ_SIZE_MB is set, every fetch issued for this view
+  /// reads at least that many megabytes (capped at the end of the file).
+  /// Small scattered reads - parquet footers, column chunk after column
+  /// chunk - coalesce into a few large range requests instead of one
+  /// round trip each, which matters on storage where per-request latency
+  /// dominates (object stores).
   katana::Result<void> Bind(
       std::string_view filename, uint64_t begin, uint64_t end, bool resolve);
   katana::Result<void> Bind(
@@ -77,6 +99,18 @@ public:
 
   katana::Result<void> Fill(uint64_t begin, uint64_t end, bool resolve);
 
+  /// Shift this view's resident window to [begin, end).
+  ///
+  /// The new window starts loading immediately: file-mapped views get
+  /// readahead, copy-backed views get an asynchronous Fill. File-mapped
+  /// views additionally release whole pages of the previously advised
+  /// window that fall outside the new one back to the kernel, so a loop
+  /// that walks a large edge-keyed region range by range keeps only its
+  /// current window resident instead of faulting in the whole file.
+  /// Copy-backed views cannot release pages (the anonymous mapping is
+  /// the only copy of fetched data); for them this is prefetch only.
+  katana::Result<void> AdviseWindow(uint64_t begin, uint64_t end);
+
   bool Valid() const { return bound_; }
 
   katana::Result<void> Unbind();
@@ -156,6 +190,20 @@ private:
   // @start and @size give the location and range of the previous read
   katana::Result<void> PreFetch(int64_t start, int64_t size);
 
+  // Try to map the file itself read-only rather than reserving anonymous
+  // memory and copying into it. Returns true and leaves the view bound on
+  // success; returns false when the zero-copy path does not apply (not
+  // enabled, not a local file, empty file) so Bind can fall back to the
+  // copying path.
+  katana::Result<bool> TryBindMapped(
+      uint64_t file_size, uint64_t begin, uint64_t end);
+
+  // Fetch a whole compressed frame (see BlockCompression.h), decompress it
+  // in parallel into anonymous memory, and leave the view bound over the
+  // uncompressed bytes. Compressed artifacts give up lazy filling; they are
+  // intermediate files that are read in full anyway.
+  katana::Result<void> BindCompressed(uint64_t compressed_size);
+
   struct FillingRange {
     uint64_t first_page;
     uint64_t last_page;
@@ -167,8 +215,16 @@ private:
   uint8_t page_shift_{0};
   int64_t cursor_{0};
   int64_t mem_start_{0};
+  // Fetches are widened to at least this many bytes; 0 disables coalescing.
+  uint64_t min_fill_size_{0};
+  // Resident window set by the last AdviseWindow call; empty when none.
+  uint64_t advised_begin_{0};
+  uint64_t advised_end_{0};
   std::string filename_;
   bool bound_{false};
+  // The mapping is backed by the file rather than anonymous memory; all
+  // pages are treated as filled and no fetches are ever outstanding.
+  bool file_mapped_{false};
   std::vector<uint64_t> filling_;
   std::unique_ptr<std::vector<FillingRange>> fetches_;
 };
@@ -28,6 +28,19 @@ public:
     /// are not chunked
     bool make_canonical{true};
 
+    /// if true (default) decode a file's row groups and columns in parallel
+    /// on arrow's CPU thread pool, so the reads for a whole table are in
+    /// flight together rather than column by column
+    bool use_threads{true};
+
+    /// if true, keep string and binary columns dictionary encoded in memory
+    /// instead of decoding them to flat arrays. For low-cardinality category
+    /// columns this cuts memory by roughly the average value length and lets
+    /// callers compare the integer dictionary codes instead of the strings
+    /// (see katana::DictionaryPropertyReadOnlyView). Off by default because
+    /// most of the code base expects flat (large) string columns.
+    bool read_dictionary{false};
+
     static ReadOpts Defaults() { return ReadOpts{}; }
   };
 
@@ -77,7 +90,10 @@ public:
   katana::Result<std::vector<std::string>> GetFiles(const katana::URI& uri);
 
 private:
-  ParquetReader(bool make_canonical) : make_canonical_{make_canonical} {}
+  ParquetReader(bool make_canonical, bool use_threads, bool read_dictionary)
+      : make_canonical_{make_canonical},
+        use_threads_{use_threads},
+        read_dictionary_{read_dictionary} {}
 
   katana::Result<std::shared_ptr<arrow::Table>> ReadFromUriSliced(
       const katana::URI& uri);
@@ -89,6 +105,8 @@ private:
       const std::shared_ptr<arrow::Schema>& schema);
 
   bool make_canonical_;
+  bool use_threads_;
+  bool read_dictionary_;
 };
 
 }  // namespace katana
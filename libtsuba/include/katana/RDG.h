@@ -18,6 +18,7 @@
 #include "katana/FileView.h"
 #include "katana/NUMAArray.h"
 #include "katana/PartitionMetadata.h"
+#include "katana/RDGAdjacencyFilter.h"
 #include "katana/RDGLineage.h"
 #include "katana/RDGStorageFormatVersion.h"
 #include "katana/RDGTopology.h"
@@ -333,6 +334,12 @@ public:
   katana::Result<void> WriteRDKSubstructureIndexPrimitive(
       katana::RDKSubstructureIndexPrimitive& index);
 
+  // Returns std::nullopt if no adjacency filter has been stored for this RDG
+  katana::Result<std::optional<katana::RDGAdjacencyFilter>>
+  LoadAdjacencyFilter();
+
+  katana::Result<void> WriteAdjacencyFilter(katana::RDGAdjacencyFilter& filter);
+
 private:
   std::string view_type_;
   RDG(std::unique_ptr<RDGCore>&& core);
@@ -0,0 +1,155 @@
+#ifndef KATANA_LIBTSUBA_KATANA_RDGADJACENCYFILTER_H_
+#define KATANA_LIBTSUBA_KATANA_RDGADJACENCYFILTER_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "katana/ErrorCode.h"
+#include "katana/FileFrame.h"
+#include "katana/FileView.h"
+#include "katana/JSON.h"
+#include "katana/Logging.h"
+#include "katana/RDGOptionalDatastructure.h"
+#include "katana/Result.h"
+#include "katana/URI.h"
+#include "katana/config.h"
+#include "katana/tsuba.h"
+
+namespace katana {
+
+const std::string kOptionalDatastructureAdjacencyFilter =
+    "kg.v1.adjacency_filter";
+const std::string kOptionalDatastructureAdjacencyFilterFilename =
+    "adjacency_filter_manifest";
+
+/// Storage form of the per-node adjacency bloom filter sidecar
+/// (katana::AdjacencyBloomFilter in libgraph).
+///
+/// The manifest holds the filter geometry; the two flat uint64_t arrays
+/// are dumped to their own files and tracked through paths_ so they move
+/// with the RDG, like any other optional datastructure. block_offsets has
+/// num_nodes + 1 entries giving each node's range of 512-bit blocks in
+/// words.
+class KATANA_EXPORT RDGAdjacencyFilter
+    : private katana::RDGOptionalDatastructure {
+public:
+  static katana::Result<RDGAdjacencyFilter> Load(
+      const katana::URI& rdg_dir_path, const std::string& path) {
+    RDGAdjacencyFilter filter =
+        KATANA_CHECKED(LoadJson(rdg_dir_path.Join(path).string()));
+    KATANA_CHECKED(filter.LoadArray(
+        rdg_dir_path, kBlockOffsetsFileName, &filter.block_offsets_));
+    KATANA_CHECKED(filter.LoadArray(rdg_dir_path, kWordsFileName, &filter.words_));
+    return filter;
+  }
+
+  katana::Result<std::string> Write(katana::URI rdg_dir_path) {
+    KATANA_CHECKED(
+        WriteArray(rdg_dir_path, kBlockOffsetsFileName, block_offsets_));
+    KATANA_CHECKED(WriteArray(rdg_dir_path, kWordsFileName, words_));
+
+    // Write out our json manifest
+    katana::URI manifest_path =
+        rdg_dir_path.RandFile(kOptionalDatastructureAdjacencyFilterFilename);
+    KATANA_CHECKED(WriteManifest(manifest_path.string()));
+    return manifest_path.BaseName();
+  }
+
+  uint64_t num_nodes() const { return num_nodes_; }
+  void set_num_nodes(uint64_t num) { num_nodes_ = num; }
+
+  uint64_t bits_per_edge() const { return bits_per_edge_; }
+  void set_bits_per_edge(uint64_t bits) { bits_per_edge_ = bits; }
+
+  uint64_t probes_per_edge() const { return probes_per_edge_; }
+  void set_probes_per_edge(uint64_t probes) { probes_per_edge_ = probes; }
+
+  std::vector<uint64_t>& block_offsets() { return block_offsets_; }
+  void set_block_offsets(std::vector<uint64_t> offsets) {
+    block_offsets_ = std::move(offsets);
+  }
+
+  std::vector<uint64_t>& words() { return words_; }
+  void set_words(std::vector<uint64_t> words) { words_ = std::move(words); }
+
+  friend void to_json(nlohmann::json& j, const RDGAdjacencyFilter& filter);
+  friend void from_json(const nlohmann::json& j, RDGAdjacencyFilter& filter);
+
+private:
+  static constexpr const char* kBlockOffsetsFileName =
+      "adjacency_filter_block_offsets";
+  static constexpr const char* kWordsFileName = "adjacency_filter_words";
+
+  uint64_t num_nodes_{0};
+  uint64_t bits_per_edge_{0};
+  uint64_t probes_per_edge_{0};
+
+  /// data structures dumped to their own files
+
+  std::vector<uint64_t> block_offsets_;
+  std::vector<uint64_t> words_;
+
+  static katana::Result<RDGAdjacencyFilter> LoadJson(const std::string& path) {
+    katana::FileView fv;
+    KATANA_CHECKED(fv.Bind(path, true));
+
+    if (fv.size() == 0) {
+      return RDGAdjacencyFilter();
+    }
+
+    RDGAdjacencyFilter filter;
+    KATANA_CHECKED(katana::JsonParse<RDGAdjacencyFilter>(fv, &filter));
+
+    return filter;
+  }
+
+  katana::Result<void> LoadArray(
+      const katana::URI& rdg_dir_path, const std::string& name,
+      std::vector<uint64_t>* out) const {
+    auto it = paths_.find(name);
+    if (it == paths_.end()) {
+      return KATANA_ERROR(
+          katana::ErrorCode::InvalidArgument,
+          "adjacency filter manifest is missing the {} file", name);
+    }
+    katana::FileView fv;
+    KATANA_CHECKED(fv.Bind(rdg_dir_path.Join(it->second).string(), true));
+    const auto* data = fv.ptr<uint64_t>();
+    out->assign(data, data + fv.size() / sizeof(uint64_t));
+    KATANA_CHECKED(fv.Unbind());
+    return katana::ResultSuccess();
+  }
+
+  katana::Result<void> WriteArray(
+      const katana::URI& rdg_dir_path, const std::string& name,
+      const std::vector<uint64_t>& data) {
+    katana::URI path = rdg_dir_path.RandFile(name);
+    KATANA_CHECKED(katana::FileStore(
+        path.string(), reinterpret_cast<const uint8_t*>(data.data()),
+        data.size() * sizeof(uint64_t)));
+    paths_[name] = path.BaseName();
+    return katana::ResultSuccess();
+  }
+
+  katana::Result<void> WriteManifest(const std::string& path) const {
+    std::string serialized = KATANA_CHECKED(katana::JsonDump(*this));
+    // POSIX files end with newlines
+    serialized = serialized + "\n";
+
+    auto ff = std::make_unique<katana::FileFrame>();
+    KATANA_CHECKED(ff->Init(serialized.size()));
+    if (auto res = ff->Write(serialized.data(), serialized.size()); !res.ok()) {
+      return KATANA_ERROR(
+          katana::ArrowToKatana(res.code()), "arrow error: {}", res);
+    }
+    ff->Bind(path);
+    // persist now
+    KATANA_CHECKED(ff->Persist());
+
+    return katana::ResultSuccess();
+  }
+};
+
+}  // namespace katana
+
+#endif
@@ -2,6 +2,7 @@
 #define KATANA_LIBTSUBA_KATANA_RDGLINEAGE_H_
 
 #include <string>
+#include <vector>
 
 #include "katana/JSON.h"
 
@@ -9,10 +10,22 @@ namespace katana {
 
 class RDGLineage {
   std::string command_line_{};
+  // Names of the property files the producing commit actually rewrote.
+  // Unchanged properties are carried over from the parent version by
+  // reference, so together with the manifest's previous_version this
+  // describes the delta from the parent snapshot without reading either
+  // version's part header.
+  std::vector<std::string> written_properties_{};
 
 public:
   const std::string& command_line() { return command_line_; }
+  const std::vector<std::string>& written_properties() const {
+    return written_properties_;
+  }
   void AddCommandLine(const std::string& cmd);
+  /// Record the set of property files rewritten by the current commit,
+  /// replacing whatever the previous commit recorded.
+  void SetWrittenProperties(std::vector<std::string> names);
   void ClearLineage();
 
   friend void to_json(nlohmann::json& j, const RDGLineage& lineage);
@@ -2,6 +2,7 @@
 #define KATANA_LIBTSUBA_KATANA_RDGSLICE_H_
 
 #include <cstdint>
+#include <future>
 #include <memory>
 #include <string>
 #include <utility>
@@ -56,6 +57,18 @@ public:
       const std::optional<std::vector<std::string>>& node_props = std::nullopt,
       const std::optional<std::vector<std::string>>& edge_props = std::nullopt);
 
+  /// Start loading a slice in the background and return a future that
+  /// resolves to the loaded RDGSlice. Pipelines that sweep over a partition
+  /// slice by slice can call this for slice N+1 before processing slice N so
+  /// the topology and property I/O for the next slice overlaps the current
+  /// slice's computation.
+  ///
+  /// \p handle must remain open until the returned future has resolved.
+  static std::future<katana::CopyableResult<RDGSlice>> Prefetch(
+      RDGHandle handle, const SliceArg& slice, uint32_t partition_id = 0,
+      const std::optional<std::vector<std::string>>& node_props = std::nullopt,
+      const std::optional<std::vector<std::string>>& edge_props = std::nullopt);
+
   /// Returns two vectors (one for nodes and one for edges), each with one entry
   /// per partition in the graph pointed to by handle. Each entry is the number
   /// of nodes or edges owned by the corresponding partitions.
@@ -239,6 +239,17 @@ public:
   /// defined by FileGraph.cpp
   katana::Result<void> Map();
 
+  /// Shift the file store's resident window to the out_dests entries for
+  /// edges in [edge_begin, edge_end). Requires the topology to be bound
+  /// and mapped.
+  ///
+  /// Loops that walk the graph one contiguous edge range at a time can
+  /// advise each range before iterating it; the destination array for
+  /// the rest of the graph is then released instead of accumulating in
+  /// memory. The header, out_indices and the optional maps stay resident
+  /// since they are touched from every range.
+  katana::Result<void> AdviseEdgeRange(uint64_t edge_begin, uint64_t edge_end);
+
   /// Map a topology file and extract its metadata
   /// this only loads the topology metadata into the PartitionTopologyMetadataEntry
   /// *ONLY USE THIS FOR BACKWARDS COMPATIBILITY*
@@ -56,6 +56,19 @@ FileStore(const std::string& uri, const ContigContainer& container) {
       container.size() * sizeof(typename ContigContainer::value_type));
 }
 
+/// Streaming stores build the file chunk by chunk so the caller only ever
+/// holds one chunk in memory. Begin opens the stream, Append adds bytes in
+/// order, Finish makes the file visible. All three must be called for one
+/// uri from a single thread. Only some storage backends support this;
+/// check FileStreamingStoreSupported and fall back to FileStore otherwise.
+KATANA_EXPORT bool FileStreamingStoreSupported(const std::string& uri);
+KATANA_EXPORT katana::Result<void> FileStreamingStoreBegin(
+    const std::string& uri);
+KATANA_EXPORT katana::Result<void> FileStreamingStoreAppend(
+    const std::string& uri, const void* data, uint64_t size);
+KATANA_EXPORT katana::Result<void> FileStreamingStoreFinish(
+    const std::string& uri);
+
 /// Copy a slice of a file from source_uri into dest_uri
 /// using a remote operation (avoiding a roundt rip through memory) if possible.
 /// The slice starts at \param begin and extends \param size bytes.
@@ -1,12 +1,20 @@
 #include "AddProperties.h"
 
+#include <functional>
+#include <future>
 #include <memory>
+#include <mutex>
 #include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include <arrow/chunked_array.h>
+#include <arrow/table.h>
 #include <arrow/type_fwd.h>
 
 #include "katana/ArrowInterchange.h"
+#include "katana/Env.h"
 #include "katana/ErrorCode.h"
 #include "katana/FileView.h"
 #include "katana/Logging.h"
@@ -19,12 +27,97 @@
 
 namespace {
 
+// When set, string columns are loaded dictionary-encoded: each distinct
+// string is stored once and rows carry integer handles, which
+// DictionaryPropertyReadOnlyView exposes to typed views. Columns of URLs
+// and account IDs shrink by their duplication factor.
+bool
+InternStringsEnabled() {
+  static bool enabled = katana::GetEnv("KATANA_INTERN_STRINGS");
+  return enabled;
+}
+
+// When set, a freshly loaded column whose contents match a column already
+// live in this process (typically the same property in another open
+// version of the RDG) is dropped in favor of the existing copy.
+bool
+SharePropertiesEnabled() {
+  static bool enabled = katana::GetEnv("KATANA_SHARE_IDENTICAL_PROPERTIES");
+  return enabled;
+}
+
+uint64_t
+HashArrayData(const arrow::ArrayData& data, uint64_t hash) {
+  constexpr uint64_t kFnvPrime = 1099511628211UL;
+  auto mix = [&](const uint8_t* bytes, int64_t size) {
+    for (int64_t i = 0; i < size; ++i) {
+      hash = (hash ^ bytes[i]) * kFnvPrime;
+    }
+  };
+  mix(reinterpret_cast<const uint8_t*>(&data.length), sizeof(data.length));
+  for (const std::shared_ptr<arrow::Buffer>& buf : data.buffers) {
+    if (buf != nullptr) {
+      mix(buf->data(), buf->size());
+    }
+  }
+  for (const std::shared_ptr<arrow::ArrayData>& child : data.child_data) {
+    hash = HashArrayData(*child, hash);
+  }
+  return hash;
+}
+
+// Registry of live property columns by content hash. Equality is verified
+// before sharing, so a hash collision costs a comparison, never a wrong
+// column.
+std::shared_ptr<arrow::Table>
+DeduplicateProperty(const std::shared_ptr<arrow::Table>& table) {
+  static std::mutex registry_mutex;
+  static std::unordered_multimap<uint64_t, std::weak_ptr<arrow::Table>>
+      registry;
+
+  uint64_t hash = 14695981039346656037UL;
+  for (const std::shared_ptr<arrow::Array>& chunk :
+       table->column(0)->chunks()) {
+    hash = HashArrayData(*chunk->data(), hash);
+  }
+
+  std::lock_guard<std::mutex> lock(registry_mutex);
+  auto [begin, end] = registry.equal_range(hash);
+  for (auto it = begin; it != end;) {
+    std::shared_ptr<arrow::Table> existing = it->second.lock();
+    if (!existing) {
+      it = registry.erase(it);
+      continue;
+    }
+    if (existing->schema()->Equals(*table->schema()) &&
+        existing->Equals(*table)) {
+      return existing;
+    }
+    ++it;
+  }
+  registry.emplace(hash, table);
+  return table;
+}
+
+// Full Arrow validation walks every buffer, so it is opt-in. It runs here,
+// inside the per-column load task, so that with many columns validation
+// overlaps across columns and with reads still in flight instead of
+// serializing on the thread that assembles the table.
+bool
+ValidatePropertiesEnabled() {
+  static bool enabled = katana::GetEnv("KATANA_VALIDATE_PROPERTIES");
+  return enabled;
+}
+
 katana::Result<std::shared_ptr<arrow::Table>>
 DoLoadProperties(
     const std::string& expected_name, const katana::URI& file_path,
     std::optional<katana::ParquetReader::Slice> slice = std::nullopt) {
+  katana::ParquetReader::ReadOpts opts =
+      katana::ParquetReader::ReadOpts::Defaults();
+  opts.read_dictionary = InternStringsEnabled();
   std::unique_ptr<katana::ParquetReader> reader =
-      KATANA_CHECKED(katana::ParquetReader::Make());
+      KATANA_CHECKED(katana::ParquetReader::Make(opts));
 
   std::shared_ptr<arrow::Table> out =
       KATANA_CHECKED(reader->ReadTable(file_path, slice));
@@ -41,6 +134,47 @@ DoLoadProperties(
         katana::ErrorCode::InvalidArgument, "expected {} found {} instead",
         expected_name, schema->field(0)->name());
   }
+
+  if (ValidatePropertiesEnabled()) {
+    KATANA_CHECKED_CONTEXT(
+        out->ValidateFull(), "validating {}", std::quoted(expected_name));
+  }
+
+  // Typed property views require a single chunk per column so that inner
+  // loop accesses are raw pointer loads; enforce that here rather than
+  // relying on reader options. Binary and string columns can legitimately
+  // stay chunked when they exceed the 2^31 offset limit; those cannot back
+  // a flat view regardless.
+  if (out->column(0)->num_chunks() > 1) {
+    auto combine_res = out->CombineChunks(arrow::default_memory_pool());
+    if (combine_res.ok()) {
+      out = combine_res.ValueOrDie();
+    }
+  }
+
+  if (SharePropertiesEnabled()) {
+    std::shared_ptr<arrow::Table> shared = DeduplicateProperty(out);
+    if (shared != out && !slice.has_value()) {
+      // The bytes just read duplicate a column already live in this process
+      // (typically the same property in a branched RDG). Beyond dropping
+      // our copy for the shared one, remember this file's URI in the
+      // property cache: the next handle that opens this branch then gets
+      // the shared column from the cache instead of re-reading and
+      // re-decoding the file first.
+      PropertyManager* pm =
+          katana::MemorySupervisor::Get().GetPropertyManager();
+      if (pm != nullptr) {
+        pm->PutProperty(file_path, shared);
+      }
+      katana::GetTracer().GetActiveSpan().Log(
+          "property deduplicated against live copy",
+          {
+              {"name", expected_name},
+              {"path", file_path.string()},
+          });
+    }
+    out = shared;
+  }
   return out;
 }
 
@@ -77,6 +211,14 @@ katana::AddProperties(
     const std::vector<katana::PropStorageInfo*>& properties, ReadGroup* grp,
     const std::function<katana::Result<void>(std::shared_ptr<arrow::Table>)>&
         add_fn) {
+  // Loads that cannot be handed to a ReadGroup are collected here and
+  // resolved only after every read has been issued, so that columns overlap
+  // in flight instead of loading one at a time.
+  std::vector<std::pair<
+      std::future<katana::CopyableResult<std::shared_ptr<arrow::Table>>>,
+      std::function<katana::CopyableResult<void>(
+          const std::shared_ptr<arrow::Table>&)>>>
+      pending;
   for (katana::PropStorageInfo* prop : properties) {
     if (!prop->IsAbsent()) {
       return KATANA_ERROR(
@@ -109,7 +251,7 @@ katana::AddProperties(
                                  cache_stats.get_hit_percentage(),
                                  cache_stats.insert_hit_percentage())},
             });
-        return katana::ResultSuccess();
+        continue;
       }
     }
     katana::GetTracer().GetActiveSpan().Log(
@@ -151,6 +293,10 @@ katana::AddProperties(
           std::move(future), path.string(), on_complete);
       continue;
     }
+    pending.emplace_back(std::move(future), on_complete);
+  }
+
+  for (auto& [future, on_complete] : pending) {
     auto read_res = KATANA_CHECKED(future.get());
 
     KATANA_CHECKED(on_complete(read_res));
@@ -168,6 +314,12 @@ katana::AddPropertySlice(
         add_fn) {
   uint64_t begin = range.first;
   uint64_t size = range.second > range.first ? range.second - range.first : 0;
+  // As in AddProperties: issue every read before waiting on any of them.
+  std::vector<std::pair<
+      std::future<katana::CopyableResult<std::shared_ptr<arrow::Table>>>,
+      std::function<katana::CopyableResult<void>(
+          const std::shared_ptr<arrow::Table>&)>>>
+      pending;
   for (katana::PropStorageInfo* prop : properties) {
     if (!prop->IsAbsent()) {
       return KATANA_ERROR(
@@ -206,6 +358,10 @@ katana::AddPropertySlice(
           std::move(future), path.string(), on_complete);
       continue;
     }
+    pending.emplace_back(std::move(future), on_complete);
+  }
+
+  for (auto& [future, on_complete] : pending) {
     std::shared_ptr<arrow::Table> props = KATANA_CHECKED(future.get());
     KATANA_CHECKED(on_complete(props));
   }
@@ -0,0 +1,99 @@
+#include "katana/ArrowIPCWriter.h"
+
+#include <future>
+
+#include <arrow/io/api.h>
+#include <arrow/ipc/api.h>
+
+#include "katana/ErrorCode.h"
+#include "katana/FaultTest.h"
+#include "katana/FileFrame.h"
+#include "katana/Result.h"
+
+template <typename T>
+using Result = katana::Result<T>;
+
+namespace {
+
+katana::CopyableResult<void>
+WriteIPCStream(
+    const arrow::Table& table,
+    const std::shared_ptr<arrow::io::OutputStream>& sink) {
+  auto writer_result = arrow::ipc::MakeStreamWriter(sink, table.schema());
+  if (!writer_result.ok()) {
+    return KATANA_ERROR(
+        katana::ErrorCode::ArrowError, "arrow error: {}",
+        writer_result.status());
+  }
+  std::shared_ptr<arrow::ipc::RecordBatchWriter> writer =
+      writer_result.ValueOrDie();
+  if (auto st = writer->WriteTable(table); !st.ok()) {
+    return KATANA_ERROR(katana::ErrorCode::ArrowError, "arrow error: {}", st);
+  }
+  if (auto st = writer->Close(); !st.ok()) {
+    return KATANA_ERROR(katana::ErrorCode::ArrowError, "arrow error: {}", st);
+  }
+  return katana::CopyableResultSuccess();
+}
+
+}  // namespace
+
+Result<std::unique_ptr<katana::ArrowIPCWriter>>
+katana::ArrowIPCWriter::Make(std::shared_ptr<arrow::Table> table) {
+  if (!table || table->num_columns() == 0) {
+    return KATANA_ERROR(
+        katana::ErrorCode::InvalidArgument,
+        "IPC export requires a table with at least one column");
+  }
+  return std::unique_ptr<ArrowIPCWriter>(new ArrowIPCWriter(std::move(table)));
+}
+
+Result<std::shared_ptr<arrow::Buffer>>
+katana::ArrowIPCWriter::ToBuffer() {
+  auto sink_result = arrow::io::BufferOutputStream::Create();
+  if (!sink_result.ok()) {
+    return KATANA_ERROR(
+        katana::ErrorCode::ArrowError, "arrow error: {}", sink_result.status());
+  }
+  std::shared_ptr<arrow::io::BufferOutputStream> sink =
+      sink_result.ValueOrDie();
+  KATANA_CHECKED(WriteIPCStream(*table_, sink));
+  auto buf_result = sink->Finish();
+  if (!buf_result.ok()) {
+    return KATANA_ERROR(
+        katana::ErrorCode::ArrowError, "arrow error: {}", buf_result.status());
+  }
+  return buf_result.ValueOrDie();
+}
+
+katana::Result<void>
+katana::ArrowIPCWriter::WriteToUri(const katana::URI& uri, WriteGroup* group) {
+  auto ff = std::make_shared<katana::FileFrame>();
+  KATANA_CHECKED(ff->Init());
+  ff->Bind(uri.string());
+
+  auto future = std::async(
+      std::launch::async,
+      [table = table_, ff = std::move(ff),
+       group]() mutable -> katana::CopyableResult<void> {
+        KATANA_CHECKED(WriteIPCStream(*table, ff));
+        table.reset();
+
+        if (group) {
+          group->AddToOutstanding(ff->map_size());
+        }
+
+        TSUBA_PTP(katana::internal::FaultSensitivity::Normal);
+        KATANA_CHECKED(ff->Persist());
+
+        return katana::CopyableResultSuccess();
+      });
+
+  if (!group) {
+    KATANA_CHECKED(future.get());
+    return katana::ResultSuccess();
+  }
+
+  group->AddOp(std::move(future), uri.string());
+  return katana::ResultSuccess();
+}
@@ -0,0 +1,50 @@
+#include "katana/AsyncIOService.h"
+
+#include "katana/ThreadPool.h"
+
+katana::AsyncIOService&
+katana::AsyncIOService::Get() {
+  // Leaked intentionally: the dedicated thread lives until the thread pool
+  // shuts down at process exit, and must never observe a destroyed queue.
+  static AsyncIOService* service = new AsyncIOService();
+  return *service;
+}
+
+katana::AsyncIOService::AsyncIOService() {
+  static std::function<void(void)> body = [this]() { Run(); };
+  katana::GetThreadPool().runDedicated(body);
+}
+
+std::future<katana::CopyableResult<void>>
+katana::AsyncIOService::Submit(Op op) {
+  std::packaged_task<katana::CopyableResult<void>()> task(std::move(op));
+  std::future<katana::CopyableResult<void>> fut = task.get_future();
+
+  {
+    std::lock_guard<std::mutex> guard(lock_);
+    pending_.emplace_back(std::move(task));
+  }
+  work_ready_.notify_one();
+
+  return fut;
+}
+
+size_t
+katana::AsyncIOService::NumPending() {
+  std::lock_guard<std::mutex> guard(lock_);
+  return pending_.size();
+}
+
+void
+katana::AsyncIOService::Run() {
+  while (true) {
+    std::packaged_task<katana::CopyableResult<void>()> task;
+    {
+      std::unique_lock<std::mutex> guard(lock_);
+      work_ready_.wait(guard, [this]() { return !pending_.empty(); });
+      task = std::move(pending_.front());
+      pending_.pop_front();
+    }
+    task();
+  }
+}
@@ -0,0 +1,241 @@
+#include "BlockCompression.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <string>
+
+#include <arrow/util/compression.h>
+
+#include "katana/Env.h"
+#include "katana/ErrorCode.h"
+#include "katana/Logging.h"
+#include "katana/Loops.h"
+#include "katana/Result.h"
+
+namespace {
+
+// Uncompressed bytes per block. Large enough that the codec sees real
+// redundancy and per-block overhead is noise, small enough that a frame
+// splits into plenty of independent blocks for the ThreadPool.
+constexpr uint64_t kBlockSize = UINT64_C(4) << 20;
+
+constexpr char kMagic[4] = {'K', 'Z', 'B', 'C'};
+constexpr uint8_t kVersion = 1;
+
+// Codec ids stored in the header; decoupled from arrow's enum values so the
+// on-disk format does not depend on the arrow version.
+constexpr uint8_t kCodecZstd = 1;
+constexpr uint8_t kCodecLz4 = 2;
+
+struct FrameHeader {
+  char magic[4];
+  uint8_t version;
+  uint8_t codec;
+  uint8_t reserved[2];
+  uint64_t uncompressed_size;
+  uint64_t block_size;
+  uint64_t num_blocks;
+};
+static_assert(
+    sizeof(FrameHeader) == katana::kCompressedFrameHeaderSize,
+    "frame header layout must match kCompressedFrameHeaderSize");
+
+/// The codec selected by KATANA_FILEFRAME_COMPRESSION, or 0 when unset or
+/// unrecognized. Read once; the setting cannot change mid-process without
+/// leaving unreadable artifacts behind.
+uint8_t
+SelectedCodec() {
+  static uint8_t codec = []() -> uint8_t {
+    std::string name;
+    if (!katana::GetEnv("KATANA_FILEFRAME_COMPRESSION", &name)) {
+      return 0;
+    }
+    if (name == "zstd") {
+      return kCodecZstd;
+    }
+    if (name == "lz4") {
+      return kCodecLz4;
+    }
+    KATANA_LOG_WARN(
+        "unknown KATANA_FILEFRAME_COMPRESSION codec {}; compression "
+        "disabled",
+        name);
+    return 0;
+  }();
+  return codec;
+}
+
+katana::Result<std::unique_ptr<arrow::util::Codec>>
+MakeCodec(uint8_t codec_id) {
+  switch (codec_id) {
+  case kCodecZstd:
+    return KATANA_CHECKED(
+        arrow::util::Codec::Create(arrow::Compression::ZSTD));
+  case kCodecLz4:
+    return KATANA_CHECKED(arrow::util::Codec::Create(arrow::Compression::LZ4));
+  default:
+    return KATANA_ERROR(
+        katana::ErrorCode::InvalidArgument, "unknown frame codec id {}",
+        codec_id);
+  }
+}
+
+katana::Result<const FrameHeader*>
+CheckedHeader(const uint8_t* data, uint64_t size) {
+  if (!katana::IsCompressedFrame(data, size)) {
+    return KATANA_ERROR(
+        katana::ErrorCode::InvalidArgument, "not a compressed frame");
+  }
+  const auto* header = reinterpret_cast<const FrameHeader*>(data);
+  uint64_t table_end =
+      sizeof(FrameHeader) + header->num_blocks * sizeof(uint64_t);
+  if (header->version != kVersion || header->block_size == 0 ||
+      size < table_end) {
+    return KATANA_ERROR(
+        katana::ErrorCode::InvalidArgument, "corrupt compressed frame header");
+  }
+  return header;
+}
+
+}  // namespace
+
+bool
+katana::FrameCompressionEnabled() {
+  return SelectedCodec() != 0;
+}
+
+bool
+katana::IsCompressedFrame(const uint8_t* data, uint64_t size) {
+  return size >= sizeof(FrameHeader) &&
+         memcmp(data, kMagic, sizeof(kMagic)) == 0;
+}
+
+katana::Result<std::vector<uint8_t>>
+katana::CompressFrame(const uint8_t* data, uint64_t size) {
+  uint8_t codec_id = SelectedCodec();
+  if (codec_id == 0) {
+    return KATANA_ERROR(
+        katana::ErrorCode::InvalidArgument, "frame compression not enabled");
+  }
+  uint64_t num_blocks = (size + kBlockSize - 1) / kBlockSize;
+
+  // Compress the blocks independently; sizes are only known afterwards, so
+  // assembly into the contiguous frame is a second pass.
+  std::vector<std::vector<uint8_t>> blocks(num_blocks);
+  std::atomic<bool> failed = false;
+  katana::do_all(
+      katana::iterate(uint64_t{0}, num_blocks),
+      [&](uint64_t b) {
+        uint64_t offset = b * kBlockSize;
+        int64_t raw = std::min(kBlockSize, size - offset);
+        auto codec_res = MakeCodec(codec_id);
+        if (!codec_res) {
+          failed = true;
+          return;
+        }
+        auto& codec = codec_res.value();
+        blocks[b].resize(codec->MaxCompressedLen(raw, data + offset));
+        auto len_res = codec->Compress(
+            raw, data + offset, blocks[b].size(), blocks[b].data());
+        if (!len_res.ok()) {
+          failed = true;
+          return;
+        }
+        blocks[b].resize(len_res.ValueUnsafe());
+      },
+      katana::steal(), katana::no_stats());
+  if (failed) {
+    return KATANA_ERROR(
+        katana::ErrorCode::ArrowError, "block compression failed");
+  }
+
+  uint64_t table_bytes = num_blocks * sizeof(uint64_t);
+  uint64_t payload_bytes = 0;
+  for (const auto& block : blocks) {
+    payload_bytes += block.size();
+  }
+  std::vector<uint8_t> frame(
+      sizeof(FrameHeader) + table_bytes + payload_bytes);
+
+  auto* header = reinterpret_cast<FrameHeader*>(frame.data());
+  memcpy(header->magic, kMagic, sizeof(kMagic));
+  header->version = kVersion;
+  header->codec = codec_id;
+  header->reserved[0] = 0;
+  header->reserved[1] = 0;
+  header->uncompressed_size = size;
+  header->block_size = kBlockSize;
+  header->num_blocks = num_blocks;
+
+  auto* table = reinterpret_cast<uint64_t*>(frame.data() + sizeof(FrameHeader));
+  uint64_t offset = sizeof(FrameHeader) + table_bytes;
+  std::vector<uint64_t> offsets(num_blocks);
+  for (uint64_t b = 0; b < num_blocks; ++b) {
+    table[b] = blocks[b].size();
+    offsets[b] = offset;
+    offset += blocks[b].size();
+  }
+  katana::do_all(
+      katana::iterate(uint64_t{0}, num_blocks),
+      [&](uint64_t b) {
+        memcpy(frame.data() + offsets[b], blocks[b].data(), blocks[b].size());
+      },
+      katana::no_stats());
+
+  return frame;
+}
+
+katana::Result<uint64_t>
+katana::DecompressedFrameSize(const uint8_t* data, uint64_t size) {
+  const FrameHeader* header = KATANA_CHECKED(CheckedHeader(data, size));
+  return header->uncompressed_size;
+}
+
+katana::Result<void>
+katana::DecompressFrame(const uint8_t* data, uint64_t size, uint8_t* out) {
+  const FrameHeader* header = KATANA_CHECKED(CheckedHeader(data, size));
+  uint64_t num_blocks = header->num_blocks;
+  const auto* table =
+      reinterpret_cast<const uint64_t*>(data + sizeof(FrameHeader));
+
+  std::vector<uint64_t> offsets(num_blocks);
+  uint64_t offset = sizeof(FrameHeader) + num_blocks * sizeof(uint64_t);
+  for (uint64_t b = 0; b < num_blocks; ++b) {
+    offsets[b] = offset;
+    offset += table[b];
+  }
+  if (offset > size) {
+    return KATANA_ERROR(
+        katana::ErrorCode::InvalidArgument,
+        "compressed frame truncated: blocks end at {} but frame has {} "
+        "bytes",
+        offset, size);
+  }
+
+  std::atomic<bool> failed = false;
+  katana::do_all(
+      katana::iterate(uint64_t{0}, num_blocks),
+      [&](uint64_t b) {
+        uint64_t raw_offset = b * header->block_size;
+        int64_t raw = std::min(
+            header->block_size, header->uncompressed_size - raw_offset);
+        auto codec_res = MakeCodec(header->codec);
+        if (!codec_res) {
+          failed = true;
+          return;
+        }
+        auto decompressed = codec_res.value()->Decompress(
+            table[b], data + offsets[b], raw, out + raw_offset);
+        if (!decompressed.ok() || decompressed.ValueUnsafe() != raw) {
+          failed = true;
+        }
+      },
+      katana::steal(), katana::no_stats());
+  if (failed) {
+    return KATANA_ERROR(
+        katana::ErrorCode::ArrowError, "block decompression failed");
+  }
+  return katana::ResultSuccess();
+}
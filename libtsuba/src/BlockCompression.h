@@ -0,0 +1,42 @@
+#ifndef KATANA_LIBTSUBA_BLOCKCOMPRESSION_H_
+#define KATANA_LIBTSUBA_BLOCKCOMPRESSION_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "katana/Result.h"
+
+namespace katana {
+
+/// Size of the fixed header that opens a compressed frame; IsCompressedFrame
+/// needs at least this many bytes to decide.
+constexpr uint64_t kCompressedFrameHeaderSize = 32;
+
+/// True when KATANA_FILEFRAME_COMPRESSION selects a codec ("zstd" or
+/// "lz4"). Both writers (FileFrame::Persist) and readers (FileView::Bind)
+/// consult this, so a job that writes compressed intermediate artifacts can
+/// read them back; readers probe the header and still accept raw files.
+bool FrameCompressionEnabled();
+
+/// True when data opens with a compressed-frame header.
+bool IsCompressedFrame(const uint8_t* data, uint64_t size);
+
+/// Compress size bytes into a self-describing frame: a fixed header, a
+/// table of per-block compressed sizes, then the blocks back to back.
+/// Blocks are fixed-size slices of the input compressed independently and
+/// in parallel on the ThreadPool, so large frames compress at aggregate
+/// core bandwidth rather than single-stream speed.
+Result<std::vector<uint8_t>> CompressFrame(
+    const uint8_t* data, uint64_t size);
+
+/// The uncompressed payload size recorded in a compressed frame's header.
+Result<uint64_t> DecompressedFrameSize(const uint8_t* data, uint64_t size);
+
+/// Decompress a frame produced by CompressFrame into out, which must hold
+/// DecompressedFrameSize bytes. Blocks decompress in parallel.
+Result<void> DecompressFrame(
+    const uint8_t* data, uint64_t size, uint8_t* out);
+
+}  // namespace katana
+
+#endif
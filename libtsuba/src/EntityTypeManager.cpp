@@ -1,6 +1,9 @@
 #include "katana/EntityTypeManager.h"
 
+#include <algorithm>
+
 #include "katana/Logging.h"
+#include "katana/Loops.h"
 #include "katana/Result.h"
 
 //TODO(emcginnis): while this logic works and technically saves cycles by avoiding
@@ -90,20 +93,38 @@ katana::EntityTypeManager::DoAssignEntityTypeIDsFromProperties(
 
   // NB: cannot use unordered_set without defining a hash function for vectors;
   // performance is not affected here because the set is very small (<=256)
+  //
+  // The scan over the rows is the expensive part on big graphs, so it is
+  // chunked and parallel: each chunk collects the combinations it sees into
+  // its own (small) set and the per-chunk sets are unioned serially after.
   using FieldEntityTypeSet = std::set<TypeProperties::FieldEntity>;
   FieldEntityTypeSet type_combinations;
-  for (int64_t row = 0, num_rows = properties->num_rows(); row < num_rows;
-       ++row) {
-    TypeProperties::FieldEntity field_indices;
-    for (auto uint8_property : type_properties.uint8_properties) {
-      if (uint8_property.array->IsValid(row) &&
-          uint8_property.array->Value(row)) {
-        field_indices.emplace_back(uint8_property.field_index);
-      }
-    }
-    if (field_indices.size() > 1) {
-      type_combinations.emplace(field_indices);
-    }
+  int64_t num_rows = properties->num_rows();
+  constexpr int64_t kRowsPerChunk = 64 * 1024;
+  int64_t num_chunks = (num_rows + kRowsPerChunk - 1) / kRowsPerChunk;
+  std::vector<FieldEntityTypeSet> chunk_combinations(num_chunks);
+  katana::do_all(
+      katana::iterate(int64_t{0}, num_chunks),
+      [&](int64_t chunk) {
+        FieldEntityTypeSet& local = chunk_combinations[chunk];
+        int64_t chunk_end = std::min(num_rows, (chunk + 1) * kRowsPerChunk);
+        TypeProperties::FieldEntity field_indices;
+        for (int64_t row = chunk * kRowsPerChunk; row < chunk_end; ++row) {
+          field_indices.clear();
+          for (const auto& uint8_property : type_properties.uint8_properties) {
+            if (uint8_property.array->IsValid(row) &&
+                uint8_property.array->Value(row)) {
+              field_indices.emplace_back(uint8_property.field_index);
+            }
+          }
+          if (field_indices.size() > 1) {
+            local.emplace(field_indices);
+          }
+        }
+      },
+      katana::no_stats());
+  for (FieldEntityTypeSet& local : chunk_combinations) {
+    type_combinations.merge(local);
   }
 
   // assign a new ID to each unique combination of types
@@ -139,6 +160,32 @@ katana::EntityTypeManager::DoAssignEntityTypeIDsFromProperties(
   return type_properties;
 }
 
+void
+katana::EntityTypeManager::MapRowsToEntityTypeIDs(
+    const TypeProperties& type_properties, int64_t num_rows,
+    EntityTypeID* entity_type_ids) {
+  // Rows are independent and the combination map is read-only here, so
+  // concurrent lookups are safe.
+  katana::do_all(
+      katana::iterate(int64_t{0}, num_rows),
+      [&](int64_t row) {
+        TypeProperties::FieldEntity field_indices;
+        for (const auto& uint8_property : type_properties.uint8_properties) {
+          if (uint8_property.array->IsValid(row) &&
+              uint8_property.array->Value(row)) {
+            field_indices.emplace_back(uint8_property.field_index);
+          }
+        }
+        if (field_indices.empty()) {
+          entity_type_ids[row] = katana::kUnknownEntityType;
+        } else {
+          entity_type_ids[row] =
+              type_properties.type_field_indices_to_id.at(field_indices);
+        }
+      },
+      katana::steal(), katana::no_stats());
+}
+
 katana::Result<katana::EntityTypeID>
 katana::EntityTypeManager::AddNonAtomicEntityType(
     const katana::SetOfEntityTypeIDs& type_id_set) {
@@ -2,6 +2,8 @@
 
 #include <sys/mman.h>
 
+#include "BlockCompression.h"
+#include "katana/Env.h"
 #include "katana/ErrorCode.h"
 #include "katana/Logging.h"
 #include "katana/Platform.h"
@@ -16,6 +18,14 @@ katana::FileFrame::~FileFrame() {
 
 katana::Result<void>
 katana::FileFrame::Destroy() {
+  if (streaming_) {
+    // Close the stream so the backend does not leak it; the partial file is
+    // abandoned just like a buffered frame that was never persisted.
+    if (auto res = FileStreamingStoreFinish(path_); !res) {
+      KATANA_LOG_ERROR("closing abandoned streaming store: {}", res.error());
+    }
+    streaming_ = false;
+  }
   if (valid_) {
     int err = munmap(map_start_, map_size_);
     valid_ = false;
@@ -44,12 +54,34 @@ katana::FileFrame::Init(uint64_t reserved_size) {
   synced_ = false;
   valid_ = true;
   cursor_ = 0;
+  streaming_chunk_ = 0;
+  flushed_ = 0;
   return katana::ResultSuccess();
 }
 
 void
 katana::FileFrame::Bind(std::string_view filename) {
   path_ = filename;
+  streaming_chunk_ = 0;
+  flushed_ = 0;
+  streaming_ = false;
+  int chunk_mb = 0;
+  if (GetEnv("KATANA_STREAMING_WRITE_CHUNK_MB", &chunk_mb) && chunk_mb > 0 &&
+      FileStreamingStoreSupported(path_)) {
+    streaming_chunk_ = static_cast<uint64_t>(chunk_mb) << 20;
+  }
+}
+
+katana::Result<void>
+katana::FileFrame::FlushChunk() {
+  if (!streaming_) {
+    KATANA_CHECKED(FileStreamingStoreBegin(path_));
+    streaming_ = true;
+  }
+  KATANA_CHECKED(FileStreamingStoreAppend(path_, map_start_, cursor_));
+  flushed_ += cursor_;
+  cursor_ = 0;
+  return katana::ResultSuccess();
 }
 
 katana::Result<void>
@@ -111,6 +143,27 @@ katana::FileFrame::Persist() {
   if (path_.empty()) {
     return KATANA_ERROR(katana::ErrorCode::InvalidArgument, "no path provided");
   }
+  if (streaming_) {
+    // Most of the file already went out chunk by chunk; send the tail and
+    // make the file visible.
+    if (cursor_ > 0) {
+      KATANA_CHECKED(FlushChunk());
+    }
+    KATANA_CHECKED(FileStreamingStoreFinish(path_));
+    streaming_ = false;
+    return katana::ResultSuccess();
+  }
+  if (FrameCompressionEnabled()) {
+    // Compression trades cores for bytes on the wire: blocks compress in
+    // parallel on the ThreadPool and the store pushes the smaller frame.
+    // Streaming frames are exempt above; their chunks already left raw.
+    compressed_ = KATANA_CHECKED_CONTEXT(
+        CompressFrame(map_start_, cursor_), "compressing frame for {}", path_);
+    KATANA_CHECKED(
+        katana::FileStore(path_, compressed_.data(), compressed_.size()));
+    compressed_ = std::vector<uint8_t>();
+    return katana::ResultSuccess();
+  }
   KATANA_CHECKED(katana::FileStore(path_, map_start_, cursor_));
 
   return katana::ResultSuccess();
@@ -130,11 +183,45 @@ katana::FileFrame::PersistAsync() {
           return KATANA_ERROR(ErrorCode::InvalidArgument, "no path provided");
         });
   }
+  if (streaming_) {
+    // Only the tail chunk and the finish are left; the caller keeps this
+    // frame alive until the future resolves, as with the buffered path.
+    return std::async(
+        std::launch::deferred, [this]() -> katana::CopyableResult<void> {
+          if (auto res = Persist(); !res) {
+            return katana::CopyableErrorInfo{res.error()};
+          }
+          return katana::CopyableResultSuccess();
+        });
+  }
+  if (FrameCompressionEnabled()) {
+    // Compress on the calling thread (in parallel) so only the store is
+    // deferred; the compressed bytes live in this frame until the caller
+    // resolves the future, which it already must do before destroying us.
+    auto compress_res = CompressFrame(map_start_, cursor_);
+    if (!compress_res) {
+      auto error = katana::CopyableErrorInfo{compress_res.error()};
+      return std::async(
+          std::launch::deferred, [error]() -> katana::CopyableResult<void> {
+            return error;
+          });
+    }
+    compressed_ = std::move(compress_res.value());
+    return katana::FileStoreAsync(
+        path_, compressed_.data(), compressed_.size());
+  }
   return katana::FileStoreAsync(path_, map_start_, cursor_);
 }
 
 katana::Result<void>
 katana::FileFrame::SetCursor(uint64_t new_cursor) {
+  if (new_cursor < flushed_) {
+    return KATANA_ERROR(
+        ErrorCode::InvalidArgument,
+        "cannot move cursor to {}: {} bytes were already flushed to storage",
+        new_cursor, flushed_);
+  }
+  new_cursor -= flushed_;
   if (new_cursor > map_size_) {
     KATANA_CHECKED(GrowBuffer(new_cursor - map_size_));
   }
@@ -157,7 +244,7 @@ katana::FileFrame::Tell() const {
   if (!valid_) {
     return -1;
   }
-  return cursor_;
+  return flushed_ + cursor_;
 }
 
 bool
@@ -183,6 +270,12 @@ katana::FileFrame::Write(const void* data, int64_t nbytes) {
   }
   memcpy(map_start_ + cursor_, data, nbytes);
   cursor_ += nbytes;
+  if (streaming_chunk_ > 0 && cursor_ >= streaming_chunk_) {
+    if (auto res = FlushChunk(); !res) {
+      return arrow::Status(
+          arrow::StatusCode::IOError, "FileFrame could not flush chunk");
+    }
+  }
   return arrow::Status::OK();
 }
 
@@ -1,9 +1,32 @@
 #include "katana/FileStorage.h"
 
 #include "FileStorage_internal.h"
+#include "katana/ErrorCode.h"
 
 katana::FileStorage::~FileStorage() = default;
 
+katana::Result<void>
+katana::FileStorage::PutStreamingBegin(const std::string& uri) {
+  return KATANA_ERROR(
+      ErrorCode::NotImplemented, "{} does not support streaming puts ({})",
+      uri_scheme(), uri);
+}
+
+katana::Result<void>
+katana::FileStorage::PutStreamingAppend(
+    const std::string& uri, const uint8_t* /*data*/, uint64_t /*size*/) {
+  return KATANA_ERROR(
+      ErrorCode::NotImplemented, "{} does not support streaming puts ({})",
+      uri_scheme(), uri);
+}
+
+katana::Result<void>
+katana::FileStorage::PutStreamingFinish(const std::string& uri) {
+  return KATANA_ERROR(
+      ErrorCode::NotImplemented, "{} does not support streaming puts ({})",
+      uri_scheme(), uri);
+}
+
 std::vector<katana::FileStorage*>&
 katana::GetRegisteredFileStorages() {
   static std::vector<FileStorage*> fs;
@@ -1,15 +1,22 @@
 #include "katana/FileView.h"
 
+#include <fcntl.h>
 #include <sys/mman.h>
 #include <unistd.h>
 
 #include <cassert>
+#include <cerrno>
 #include <cstdio>
+#include <cstring>
 #include <string>
+#include <vector>
 
+#include "BlockCompression.h"
+#include "katana/Env.h"
 #include "katana/ErrorCode.h"
 #include "katana/Logging.h"
 #include "katana/Result.h"
+#include "katana/URI.h"
 #include "katana/file.h"
 
 /*
@@ -53,15 +60,83 @@ katana::FileView::Unbind() {
     page_shift_ = 0;
     cursor_ = 0;
     mem_start_ = 0;
+    min_fill_size_ = 0;
+    advised_begin_ = 0;
+    advised_end_ = 0;
     filename_ = "";
     filling_ = std::vector<uint64_t>();
     KATANA_LOG_DEBUG_ASSERT(fetches_->empty());
 
     bound_ = false;
+    file_mapped_ = false;
   }
   return katana::ResultSuccess();
 }
 
+katana::Result<bool>
+katana::FileView::TryBindMapped(
+    uint64_t file_size, uint64_t begin, uint64_t end) {
+  if (!GetEnv("KATANA_MMAP_LOCAL_FILES")) {
+    return false;
+  }
+  URI uri = KATANA_CHECKED(URI::Make(filename_));
+  if (uri.scheme() != URI::kFileScheme) {
+    return false;
+  }
+  if (file_size == 0) {
+    // Nothing to map; the copying path handles empty files.
+    return false;
+  }
+
+  // Unbind clears filename_ when this view was already bound; keep the name
+  // this Bind was given.
+  std::string saved_filename = filename_;
+
+  int fd = open(uri.path().c_str(), O_RDONLY);
+  if (fd < 0) {
+    return KATANA_ERROR(katana::ResultErrno(), "opening {}", uri.path());
+  }
+  void* tmp = mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  if (tmp == MAP_FAILED) {
+    auto map_error = KATANA_ERROR(
+        katana::ResultErrno(), "mapping {} bytes of {}", file_size, uri.path());
+    close(fd);
+    return map_error;
+  }
+  // The mapping holds its own reference to the file.
+  close(fd);
+
+  KATANA_CHECKED(Unbind());
+
+  filename_ = std::move(saved_filename);
+  map_start_ = static_cast<uint8_t*>(tmp);
+  file_size_ = file_size;
+  page_shift_ = 20; /* match Bind; only the filled bitmap granularity */
+  mem_start_ = 0;
+  filling_.clear();
+  filling_.resize(page_number(file_size) / 64 + 1, 0);
+  fetches_ = std::make_unique<std::vector<FillingRange>>();
+  // Every page is backed by the file; Fill and Resolve never have work to do.
+  KATANA_CHECKED(MarkFilled(&filling_[0], 0, page_number(file_size_ - 1)));
+
+  // Nudge readahead for the range the caller asked for; faults are served
+  // from the page cache either way, so failure here only costs latency.
+  uint64_t in_end = std::min<uint64_t>(end, file_size);
+  if (in_end > begin) {
+    uint64_t page_mask = static_cast<uint64_t>(sysconf(_SC_PAGESIZE)) - 1;
+    uint64_t advise_begin = begin & ~page_mask;
+    if (madvise(
+            map_start_ + advise_begin, in_end - advise_begin, MADV_WILLNEED)) {
+      KATANA_LOG_DEBUG("madvise({}): {}", filename_, strerror(errno));
+    }
+  }
+
+  cursor_ = 0;
+  bound_ = true;
+  file_mapped_ = true;
+  return true;
+}
+
 katana::Result<void>
 katana::FileView::Bind(
     std::string_view filename, uint64_t begin, uint64_t end, bool resolve) {
@@ -78,6 +153,25 @@ katana::FileView::Bind(
         begin, end, buf.size);
   }
 
+  // Frames written with KATANA_FILEFRAME_COMPRESSION open with a
+  // self-describing header; probe for it and decompress eagerly when found.
+  // The probe costs one small read, so it only runs when the job has
+  // compression switched on; raw files still pass through untouched.
+  if (FrameCompressionEnabled() &&
+      static_cast<uint64_t>(buf.size) >= kCompressedFrameHeaderSize) {
+    uint8_t header[kCompressedFrameHeaderSize];
+    KATANA_CHECKED(FileGet(filename_, header, 0, sizeof(header)));
+    if (IsCompressedFrame(header, sizeof(header))) {
+      return BindCompressed(buf.size);
+    }
+  }
+
+  // Zero-copy path for local files: map the file itself and skip the
+  // reserve-and-copy machinery below entirely.
+  if (KATANA_CHECKED(TryBindMapped(buf.size, begin, in_end))) {
+    return katana::ResultSuccess();
+  }
+
   // SCB 2020-07-23: Given that page_shift_ is treated as a compile-time
   // constant, it seems silly to have it be a member of this class. But I can
   // imagine one day wanting to set it dynamically based on file type, file
@@ -100,6 +194,10 @@ katana::FileView::Bind(
 
   map_start_ = static_cast<uint8_t*>(tmp);
   mem_start_ = -1;
+  if (int min_read_mb = 0;
+      GetEnv("KATANA_MIN_READ_SIZE_MB", &min_read_mb) && min_read_mb > 0) {
+    min_fill_size_ = static_cast<uint64_t>(min_read_mb) << 20;
+  }
   filling_.clear();
   filling_.resize(page_number(buf.size) / 64 + 1, 0);
   file_size_ = buf.size;
@@ -113,10 +211,63 @@ katana::FileView::Bind(
   return katana::ResultSuccess();
 }
 
+katana::Result<void>
+katana::FileView::BindCompressed(uint64_t compressed_size) {
+  // Unbind clears filename_ when this view was already bound; keep the name
+  // this Bind was given.
+  std::string saved_filename = filename_;
+
+  std::vector<uint8_t> compressed(compressed_size);
+  KATANA_CHECKED(FileGet(filename_, compressed.data(), 0, compressed_size));
+  uint64_t raw_size = KATANA_CHECKED(
+      DecompressedFrameSize(compressed.data(), compressed_size));
+
+  void* tmp = nullptr;
+  if (raw_size > 0) {
+    tmp = mmap(
+        nullptr, raw_size, PROT_READ | PROT_WRITE,
+        MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (tmp == MAP_FAILED) {
+      return KATANA_ERROR(
+          katana::ResultErrno(), "reserving contiguous range {}", raw_size);
+    }
+  }
+
+  KATANA_CHECKED(Unbind());
+
+  filename_ = std::move(saved_filename);
+  map_start_ = static_cast<uint8_t*>(tmp);
+  file_size_ = raw_size;
+  page_shift_ = 20; /* match Bind; only the filled bitmap granularity */
+  mem_start_ = raw_size > 0 ? 0 : -1;
+  filling_.clear();
+  filling_.resize(page_number(raw_size) / 64 + 1, 0);
+  fetches_ = std::make_unique<std::vector<FillingRange>>();
+  if (raw_size > 0) {
+    KATANA_CHECKED(DecompressFrame(
+        compressed.data(), compressed_size, map_start_));
+    // Everything is resident; Fill and Resolve never have work to do.
+    KATANA_CHECKED(MarkFilled(&filling_[0], 0, page_number(file_size_ - 1)));
+  }
+
+  cursor_ = 0;
+  bound_ = true;
+  return katana::ResultSuccess();
+}
+
 katana::Result<void>
 katana::FileView::Fill(uint64_t begin, uint64_t end, bool resolve) {
   uint64_t in_end = std::min<uint64_t>(end, file_size_);
   uint64_t in_begin = std::min<uint64_t>(begin, in_end);
+  if (min_fill_size_ > 0 && in_begin < in_end &&
+      in_end - in_begin < min_fill_size_) {
+    // Coalesce small reads into one large range request. The neighboring
+    // pages are very likely to be asked for next (parquet readers walk
+    // column chunk by column chunk) and on high-latency storage a bigger
+    // request costs far less than another round trip.
+    in_end =
+        std::min<uint64_t>(in_begin + min_fill_size_, (uint64_t)file_size_);
+  }
   uint64_t first_page = 0;
   uint64_t last_page = 0;
   bool found_empty = false;
@@ -166,6 +317,62 @@ katana::FileView::Fill(uint64_t begin, uint64_t end, bool resolve) {
   return katana::ResultSuccess();
 }
 
+katana::Result<void>
+katana::FileView::AdviseWindow(uint64_t begin, uint64_t end) {
+  if (!bound_) {
+    return KATANA_ERROR(ErrorCode::InvalidArgument, "not bound");
+  }
+  uint64_t in_end = std::min<uint64_t>(end, file_size_);
+  uint64_t in_begin = std::min<uint64_t>(begin, in_end);
+
+  if (!file_mapped_) {
+    // The anonymous mapping is the only copy of fetched data, so nothing
+    // can be released; start fetching the window and let the fill
+    // machinery skip whatever is already resident.
+    if (in_end > in_begin) {
+      KATANA_CHECKED(Fill(in_begin, in_end, false));
+    }
+    advised_begin_ = in_begin;
+    advised_end_ = in_end;
+    return katana::ResultSuccess();
+  }
+
+  uint64_t page_mask = static_cast<uint64_t>(sysconf(_SC_PAGESIZE)) - 1;
+
+  // Release whole pages of the old window that lie outside the new one.
+  // The mapping is read-only and file-backed, so MADV_DONTNEED only
+  // drops our reference to clean page-cache pages; touching one later
+  // simply faults it back in.
+  auto drop = [&](uint64_t drop_begin, uint64_t drop_end) {
+    drop_begin = (drop_begin + page_mask) & ~page_mask;
+    drop_end = drop_end & ~page_mask;
+    if (drop_end <= drop_begin) {
+      return;
+    }
+    if (madvise(
+            map_start_ + drop_begin, drop_end - drop_begin, MADV_DONTNEED)) {
+      KATANA_LOG_DEBUG(
+          "madvise(DONTNEED, {}): {}", filename_, strerror(errno));
+    }
+  };
+  if (advised_end_ > advised_begin_) {
+    drop(advised_begin_, std::min(in_begin, advised_end_));
+    drop(std::max(in_end, advised_begin_), advised_end_);
+  }
+
+  if (in_end > in_begin) {
+    uint64_t advise_begin = in_begin & ~page_mask;
+    if (madvise(
+            map_start_ + advise_begin, in_end - advise_begin, MADV_WILLNEED)) {
+      KATANA_LOG_DEBUG("madvise({}): {}", filename_, strerror(errno));
+    }
+  }
+
+  advised_begin_ = in_begin;
+  advised_end_ = in_end;
+  return katana::ResultSuccess();
+}
+
 bool
 katana::FileView::Equals(const FileView& other) const {
   if (!bound_ || !other.bound_) {
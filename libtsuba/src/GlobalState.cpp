@@ -32,6 +32,26 @@ katana::GlobalState::FS(std::string_view uri) const {
   return GetDefaultFS();
 }
 
+std::optional<std::string>
+katana::GlobalState::GetMetadataFile(
+    const URI& uri, uint64_t expected_size) const {
+  std::lock_guard<std::mutex> lock(metadata_cache_mutex_);
+  std::optional<std::string> contents = metadata_cache_.Get(uri);
+  if (contents && contents->size() != expected_size) {
+    // The file changed out from under us; forget what we knew.
+    metadata_cache_.GetAndEvict(uri);
+    return std::nullopt;
+  }
+  return contents;
+}
+
+void
+katana::GlobalState::PutMetadataFile(
+    const URI& uri, const std::string& contents) const {
+  std::lock_guard<std::mutex> lock(metadata_cache_mutex_);
+  metadata_cache_.Insert(uri, contents);
+}
+
 katana::Result<void>
 katana::GlobalState::Init(katana::CommBackend* comm) {
   KATANA_LOG_DEBUG_ASSERT(ref_ == nullptr);
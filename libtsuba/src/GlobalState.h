@@ -2,9 +2,13 @@
 #define KATANA_LIBTSUBA_GLOBALSTATE_H_
 
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
 #include <vector>
 
 #include "LocalStorage.h"
+#include "katana/Cache.h"
 #include "katana/CommBackend.h"
 #include "katana/FileStorage.h"
 #include "katana/Logging.h"
@@ -13,6 +17,11 @@
 namespace katana {
 
 class GlobalState {
+  // Metadata files (manifests and partition headers) are small but re-read
+  // from storage on every Open; cap the cache by bytes so a service that
+  // opens many distinct RDGs cannot grow it without bound.
+  static constexpr int64_t kMetadataCacheBytes = INT64_C(64) << 20;
+
   static std::unique_ptr<GlobalState> ref_;
 
   std::vector<FileStorage*> file_stores_;
@@ -20,6 +29,14 @@ class GlobalState {
 
   katana::LocalStorage local_storage_;
 
+  // Cache is single threaded by design; guard it since Opens can race.
+  mutable std::mutex metadata_cache_mutex_;
+  mutable Cache<std::string> metadata_cache_{
+      kMetadataCacheBytes,
+      [](const std::string& contents) {
+        return static_cast<int64_t>(contents.size());
+      }};
+
   GlobalState(katana::CommBackend* comm) : comm_(comm) {
     file_stores_.emplace_back(&local_storage_);
   }
@@ -46,6 +63,18 @@ public:
   /// {no scheme} -> LocalStore
   FileStorage* FS(std::string_view uri) const;
 
+  /// Return the cached contents of the metadata file at \p uri, or
+  /// std::nullopt on a miss. An entry only hits if its size matches
+  /// \p expected_size from a fresh Stat of the file; a mismatch drops the
+  /// entry so an overwritten file is re-read from storage. Manifest and
+  /// partition header names embed the RDG version, so re-opening a
+  /// versioned RDG hits without any storage round trip beyond the Stat.
+  std::optional<std::string> GetMetadataFile(
+      const URI& uri, uint64_t expected_size) const;
+
+  /// Remember \p contents as the contents of the metadata file at \p uri.
+  void PutMetadataFile(const URI& uri, const std::string& contents) const;
+
   static katana::Result<void> Init(katana::CommBackend* comm);
   static katana::Result<void> Fini();
   static const GlobalState& Get();
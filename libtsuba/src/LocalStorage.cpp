@@ -7,6 +7,8 @@
 #include <unistd.h>
 
 #include <algorithm>
+#include <cstdlib>
+#include <cstring>
 #include <fstream>
 #include <iterator>
 #include <system_error>
@@ -15,6 +17,9 @@
 #include <boost/system/error_code.hpp>
 
 #include "GlobalState.h"
+#include "UringIOBackend.h"
+#include "katana/AsyncIOService.h"
+#include "katana/Env.h"
 #include "katana/ErrorCode.h"
 #include "katana/Logging.h"
 #include "katana/Result.h"
@@ -67,6 +72,94 @@ katana::LocalStorage::WriteFile(
   return katana::ResultSuccess();
 }
 
+std::future<katana::CopyableResult<void>>
+katana::LocalStorage::PutAsync(
+    const std::string& uri, const uint8_t* data, uint64_t size) {
+  UringIOBackend& uring = UringIOBackend::Get();
+  if (uring.Available()) {
+    // directory creation is cheap synchronous metadata work; only the data
+    // transfer goes through the ring
+    if (auto path_res = GetPath(uri); path_res) {
+      if (auto dir_res = EnsureDirectories(path_res.value()); dir_res) {
+        return uring.SubmitWrite(path_res.value(), data, size);
+      }
+    }
+    // fall through: let the synchronous path report the error
+  }
+  return AsyncIOService::Get().Submit([=]() -> katana::CopyableResult<void> {
+    if (auto write_res = WriteFile(uri, data, size); !write_res) {
+      return katana::CopyableErrorInfo{write_res.error()};
+    }
+    return katana::CopyableResultSuccess();
+  });
+}
+
+std::future<katana::CopyableResult<void>>
+katana::LocalStorage::GetAsync(
+    const std::string& uri, uint64_t start, uint64_t size,
+    uint8_t* result_buf) {
+  UringIOBackend& uring = UringIOBackend::Get();
+  if (uring.Available()) {
+    if (auto path_res = GetPath(uri); path_res) {
+      return uring.SubmitRead(path_res.value(), start, size, result_buf);
+    }
+  }
+  return AsyncIOService::Get().Submit([=]() -> katana::CopyableResult<void> {
+    if (auto read_res = ReadFile(uri, start, size, result_buf); !read_res) {
+      return katana::CopyableErrorInfo{read_res.error()};
+    }
+    return katana::CopyableResultSuccess();
+  });
+}
+
+katana::Result<void>
+katana::LocalStorage::PutStreamingBegin(const std::string& uri) {
+  std::string path = KATANA_CHECKED(GetPath(uri));
+  KATANA_CHECKED(EnsureDirectories(path));
+
+  std::ofstream ofile(path, std::ios_base::binary | std::ios_base::trunc);
+  if (!ofile.good()) {
+    return KATANA_ERROR(
+        ErrorCode::LocalStorageError, "opening file: {}", strerror(errno));
+  }
+  std::lock_guard<std::mutex> lock(streams_mutex_);
+  streams_[uri] = std::move(ofile);
+  return katana::ResultSuccess();
+}
+
+katana::Result<void>
+katana::LocalStorage::PutStreamingAppend(
+    const std::string& uri, const uint8_t* data, uint64_t size) {
+  std::lock_guard<std::mutex> lock(streams_mutex_);
+  auto it = streams_.find(uri);
+  if (it == streams_.end()) {
+    return KATANA_ERROR(
+        ErrorCode::InvalidArgument, "no streaming put in progress for {}", uri);
+  }
+  it->second.write(reinterpret_cast<const char*>(data), size); /* NOLINT */
+  if (!it->second.good()) {
+    return KATANA_ERROR(ErrorCode::LocalStorageError, "writing file");
+  }
+  return katana::ResultSuccess();
+}
+
+katana::Result<void>
+katana::LocalStorage::PutStreamingFinish(const std::string& uri) {
+  std::lock_guard<std::mutex> lock(streams_mutex_);
+  auto it = streams_.find(uri);
+  if (it == streams_.end()) {
+    return KATANA_ERROR(
+        ErrorCode::InvalidArgument, "no streaming put in progress for {}", uri);
+  }
+  it->second.close();
+  bool failed = it->second.fail();
+  streams_.erase(it);
+  if (failed) {
+    return KATANA_ERROR(ErrorCode::LocalStorageError, "closing file");
+  }
+  return katana::ResultSuccess();
+}
+
 katana::Result<void>
 katana::LocalStorage::RemoteCopyFile(
     const std::string& source_uri, const std::string& dest_uri, uint64_t begin,
@@ -95,10 +188,126 @@ katana::LocalStorage::RemoteCopyFile(
   return katana::ResultSuccess();
 }
 
+katana::Result<void>
+katana::LocalStorage::Fini() {
+  std::lock_guard<std::mutex> lock(direct_buffers_mutex_);
+  for (void* buf : direct_buffers_) {
+    free(buf);
+  }
+  direct_buffers_.clear();
+  return katana::ResultSuccess();
+}
+
+katana::Result<void*>
+katana::LocalStorage::AcquireDirectBuffer() {
+  {
+    std::lock_guard<std::mutex> lock(direct_buffers_mutex_);
+    if (!direct_buffers_.empty()) {
+      void* buf = direct_buffers_.back();
+      direct_buffers_.pop_back();
+      return buf;
+    }
+  }
+  void* buf = nullptr;
+  if (int err = posix_memalign(&buf, kDirectAlignment, kDirectBufferSize);
+      err != 0) {
+    return KATANA_ERROR(
+        std::error_code(err, std::generic_category()),
+        "allocating aligned buffer");
+  }
+  return buf;
+}
+
+void
+katana::LocalStorage::ReleaseDirectBuffer(void* buf) {
+  std::lock_guard<std::mutex> lock(direct_buffers_mutex_);
+  direct_buffers_.emplace_back(buf);
+}
+
+katana::Result<bool>
+katana::LocalStorage::DirectReadFile(
+    const std::string& path, uint64_t start, uint64_t size, uint8_t* data) {
+#ifndef O_DIRECT
+  (void)path;
+  (void)start;
+  (void)size;
+  (void)data;
+  return false;
+#else
+  int fd = open(path.c_str(), O_RDONLY | O_DIRECT);
+  if (fd < 0) {
+    if (errno == EINVAL) {
+      // this file system does not support O_DIRECT; use the buffered path
+      return false;
+    }
+    return KATANA_ERROR(
+        katana::ResultErrno(), "failed to open source file {}",
+        std::quoted(path));
+  }
+
+  auto buf_res = AcquireDirectBuffer();
+  if (!buf_res) {
+    close(fd);
+    return buf_res.error();
+  }
+  void* buf = buf_res.value();
+
+  // O_DIRECT requires the file offset to be block aligned, so round the
+  // start down and skip the leading slack when copying out of the bounce
+  // buffer; pread returns block multiples except at end of file
+  uint64_t aligned_off = start & ~(kDirectAlignment - 1);
+  uint64_t skip = start - aligned_off;
+  uint64_t copied = 0;
+  std::error_code read_error;
+  while (copied < size) {
+    ssize_t got = pread(fd, buf, kDirectBufferSize, aligned_off);
+    if (got < 0) {
+      read_error = katana::ResultErrno();
+      break;
+    }
+    if (got == 0) {
+      break;
+    }
+    aligned_off += got;
+    if (static_cast<uint64_t>(got) <= skip) {
+      skip -= got;
+      continue;
+    }
+    uint64_t useful =
+        std::min<uint64_t>(static_cast<uint64_t>(got) - skip, size - copied);
+    memcpy(data + copied, static_cast<uint8_t*>(buf) + skip, useful);
+    copied += useful;
+    skip = 0;
+  }
+  ReleaseDirectBuffer(buf);
+  close(fd);
+
+  if (read_error) {
+    return KATANA_ERROR(
+        read_error, "failed to read {}: {}", std::quoted(path),
+        read_error.message());
+  }
+  // as in ReadFile, tolerate coming up short by less than a block when the
+  // file size isn't well aligned
+  if (size - copied > kBlockSize) {
+    return ErrorCode::LocalStorageError;
+  }
+  return true;
+#endif
+}
+
 katana::Result<void>
 katana::LocalStorage::ReadFile(
     const std::string& uri, uint64_t start, uint64_t size, uint8_t* data) {
   std::string path = KATANA_CHECKED(GetPath(uri));
+
+  if (size >= kDirectIOThreshold && katana::GetEnv("KATANA_DIRECT_IO")) {
+    if (KATANA_CHECKED(DirectReadFile(path, start, size, data))) {
+      return katana::ResultSuccess();
+    }
+    // fall through to the buffered path when O_DIRECT is unsupported
+  }
+
   std::ifstream ifile(path, std::ios_base::binary);
   if (!ifile) {
     return KATANA_ERROR(
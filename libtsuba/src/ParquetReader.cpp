@@ -58,8 +58,8 @@ HandleBadParquetTypes(std::shared_ptr<arrow::Field> old_field) {
 
 Result<std::unique_ptr<parquet::arrow::FileReader>>
 BuildReader(
-    const std::string& uri, bool preload,
-    std::shared_ptr<katana::FileView>* fv) {
+    const std::string& uri, bool preload, bool use_threads,
+    bool read_dictionary, std::shared_ptr<katana::FileView>* fv) {
   auto fv_tmp = std::make_shared<katana::FileView>();
   uint64_t end = preload ? std::numeric_limits<uint64_t>::max() : 0;
   KATANA_CHECKED_CONTEXT(
@@ -68,8 +68,30 @@ BuildReader(
   *fv = fv_tmp;
 
   std::unique_ptr<parquet::arrow::FileReader> reader;
-  KATANA_CHECKED(
-      parquet::arrow::OpenFile(fv_tmp, arrow::default_memory_pool(), &reader));
+  if (read_dictionary) {
+    // Decoding to dictionary must be requested per column before the reader
+    // is built, so go through FileReaderBuilder and mark every byte-array
+    // column; numeric columns are unaffected.
+    parquet::arrow::FileReaderBuilder builder;
+    KATANA_CHECKED(builder.Open(fv_tmp));
+    parquet::ArrowReaderProperties properties =
+        parquet::default_arrow_reader_properties();
+    const parquet::SchemaDescriptor* schema =
+        builder.raw_reader()->metadata()->schema();
+    for (int i = 0, num_columns = schema->num_columns(); i < num_columns; ++i) {
+      if (schema->Column(i)->physical_type() == parquet::Type::BYTE_ARRAY) {
+        properties.set_read_dictionary(i, true);
+      }
+    }
+    builder.properties(properties);
+    KATANA_CHECKED(builder.Build(&reader));
+  } else {
+    KATANA_CHECKED(parquet::arrow::OpenFile(
+        fv_tmp, arrow::default_memory_pool(), &reader));
+  }
+  // Fan row-group and column decodes out over arrow's CPU thread pool so
+  // every requested chunk's read is in flight at once.
+  reader->set_use_threads(use_threads);
 
   return std::unique_ptr<parquet::arrow::FileReader>(std::move(reader));
 }
@@ -130,9 +152,11 @@ public:
   /// "s3://example_file/table.parquet.part_000000000" and rows 10-end are
   /// in "s3://example_file/table.parquet.part_000000001"
   static Result<std::unique_ptr<BlockedParquetReader>> Make(
-      const katana::URI& uri, bool preload) {
+      const katana::URI& uri, bool preload, bool use_threads = true,
+      bool read_dictionary = false) {
     std::shared_ptr<katana::FileView> fv;
-    auto builder_res = BuildReader(uri.string(), preload, &fv);
+    auto builder_res =
+        BuildReader(uri.string(), preload, use_threads, read_dictionary, &fv);
 
     if (builder_res) {
       std::vector<std::unique_ptr<parquet::arrow::FileReader>> readers;
@@ -141,7 +165,8 @@ public:
       fvs.emplace_back(std::move(fv));
 
       return std::unique_ptr<BlockedParquetReader>(new BlockedParquetReader(
-          uri.string(), std::move(fvs), std::move(readers), {0}));
+          uri.string(), use_threads, read_dictionary, std::move(fvs),
+          std::move(readers), {0}));
     }
 
     if (builder_res.error() != katana::ErrorCode::InvalidArgument) {
@@ -168,8 +193,8 @@ public:
     std::vector<std::shared_ptr<katana::FileView>> fvs(row_offsets.size());
 
     std::unique_ptr<BlockedParquetReader> bpr(new BlockedParquetReader(
-        uri.string(), std::move(fvs), std::move(readers),
-        std::move(row_offsets)));
+        uri.string(), use_threads, read_dictionary, std::move(fvs),
+        std::move(readers), std::move(row_offsets)));
 
     if (preload) {
       for (size_t i = 0, num_files = bpr->row_offsets_.size(); i < num_files;
@@ -332,10 +357,13 @@ public:
 
 private:
   BlockedParquetReader(
-      std::string prefix, std::vector<std::shared_ptr<katana::FileView>>&& fvs,
+      std::string prefix, bool use_threads, bool read_dictionary,
+      std::vector<std::shared_ptr<katana::FileView>>&& fvs,
       std::vector<std::unique_ptr<parquet::arrow::FileReader>>&& readers,
       std::vector<int64_t>&& row_offsets)
       : prefix_(std::move(prefix)),
+        use_threads_(use_threads),
+        read_dictionary_(read_dictionary),
         fvs_(std::move(fvs)),
         readers_(std::move(readers)),
         row_offsets_(std::move(row_offsets)) {}
@@ -346,12 +374,15 @@ private:
       return katana::ResultSuccess();
     }
     readers_[idx] = KATANA_CHECKED(BuildReader(
-        fmt::format("{}.part_{:09}", prefix_, idx), preload, &fvs_[idx]));
+        fmt::format("{}.part_{:09}", prefix_, idx), preload, use_threads_,
+        read_dictionary_, &fvs_[idx]));
 
     return katana::ResultSuccess();
   }
 
   std::string prefix_;
+  bool use_threads_;
+  bool read_dictionary_;
   std::vector<std::shared_ptr<katana::FileView>> fvs_;
   std::vector<std::unique_ptr<parquet::arrow::FileReader>> readers_;
   std::vector<int64_t> row_offsets_;
@@ -361,7 +392,9 @@ private:
 
 Result<std::unique_ptr<katana::ParquetReader>>
 katana::ParquetReader::Make(ReadOpts opts) {
-  return std::unique_ptr<ParquetReader>(new ParquetReader(opts.make_canonical));
+  return std::unique_ptr<ParquetReader>(
+      new ParquetReader(
+          opts.make_canonical, opts.use_threads, opts.read_dictionary));
 }
 
 Result<std::shared_ptr<arrow::Table>>
@@ -377,19 +410,19 @@ katana::ParquetReader::ReadTable(
     preload = false;
   }
 
-  auto bpr = KATANA_CHECKED(BlockedParquetReader::Make(uri, preload));
+  auto bpr = KATANA_CHECKED(BlockedParquetReader::Make(uri, preload, use_threads_, read_dictionary_));
   return FixTable(KATANA_CHECKED(bpr->ReadTable(slice)));
 }
 
 katana::Result<std::shared_ptr<arrow::Schema>>
 katana::ParquetReader::GetSchema(const katana::URI& uri) {
-  auto bpr = KATANA_CHECKED(BlockedParquetReader::Make(uri, false));
+  auto bpr = KATANA_CHECKED(BlockedParquetReader::Make(uri, false, use_threads_, read_dictionary_));
   return FixSchema(KATANA_CHECKED(bpr->ReadSchema()));
 }
 
 Result<std::shared_ptr<arrow::Table>>
 katana::ParquetReader::ReadColumn(const katana::URI& uri, int32_t column_idx) {
-  auto bpr = KATANA_CHECKED(BlockedParquetReader::Make(uri, false));
+  auto bpr = KATANA_CHECKED(BlockedParquetReader::Make(uri, false, use_threads_, read_dictionary_));
   return FixTable(KATANA_CHECKED(bpr->ReadTable({column_idx})));
 }
 
@@ -397,23 +430,23 @@ Result<std::shared_ptr<arrow::Table>>
 katana::ParquetReader::ReadTable(
     const katana::URI& uri, const std::vector<int32_t>& column_indexes,
     std::optional<katana::ParquetReader::Slice> slice) {
-  auto bpr = KATANA_CHECKED(BlockedParquetReader::Make(uri, false));
+  auto bpr = KATANA_CHECKED(BlockedParquetReader::Make(uri, false, use_threads_, read_dictionary_));
   return FixTable(KATANA_CHECKED(bpr->ReadTable(column_indexes, slice)));
 }
 
 Result<int32_t>
 katana::ParquetReader::NumColumns(const katana::URI& uri) {
-  return KATANA_CHECKED(BlockedParquetReader::Make(uri, false))->NumColumns();
+  return KATANA_CHECKED(BlockedParquetReader::Make(uri, false, use_threads_, read_dictionary_))->NumColumns();
 }
 
 Result<int64_t>
 katana::ParquetReader::NumRows(const katana::URI& uri) {
-  return KATANA_CHECKED(BlockedParquetReader::Make(uri, false))->NumRows();
+  return KATANA_CHECKED(BlockedParquetReader::Make(uri, false, use_threads_, read_dictionary_))->NumRows();
 }
 
 Result<std::vector<std::string>>
 katana::ParquetReader::GetFiles(const katana::URI& uri) {
-  return KATANA_CHECKED(BlockedParquetReader::Make(uri, false))->GetFiles();
+  return KATANA_CHECKED(BlockedParquetReader::Make(uri, false, use_threads_, read_dictionary_))->GetFiles();
 }
 
 Result<std::shared_ptr<arrow::Schema>>
@@ -61,7 +61,8 @@ StoreArrowArrayAtName(
 katana::Result<void>
 WriteProperties(
     const arrow::Table& props, std::vector<katana::PropStorageInfo*> prop_info,
-    const katana::URI& dir, katana::WriteGroup* desc) {
+    const katana::URI& dir, katana::WriteGroup* desc,
+    std::vector<std::string>* written_props) {
   const auto& schema = props.schema();
 
   std::vector<std::string> next_paths;
@@ -75,6 +76,7 @@ WriteProperties(
         KATANA_CHECKED(StoreArrowArrayAtName(props.column(i), dir, name, desc));
 
     prop_info[i]->WasWritten(path);
+    written_props->emplace_back(name);
   }
   TSUBA_PTP(katana::internal::FaultSensitivity::Normal);
 
@@ -317,10 +319,14 @@ katana::RDG::DoStore(
   std::vector<PropStorageInfo*> node_props_to_store = KATANA_CHECKED(
       core_->part_header().SelectNodeProperties(node_prop_names));
 
+  // properties actually rewritten by this commit; recorded in the lineage so
+  // the delta from the previous version is visible without diffing headers
+  std::vector<std::string> written_props;
+
   // writing node properties
   KATANA_CHECKED(WriteProperties(
       *core_->node_properties(), node_props_to_store,
-      handle.impl_->rdg_manifest().dir(), write_group.get()));
+      handle.impl_->rdg_manifest().dir(), write_group.get(), &written_props));
 
   std::vector<std::string> edge_prop_names;
   for (const auto& field : core_->edge_properties()->fields()) {
@@ -333,7 +339,7 @@ katana::RDG::DoStore(
   // writing edge properties
   KATANA_CHECKED(WriteProperties(
       *core_->edge_properties(), edge_props_to_store,
-      handle.impl_->rdg_manifest().dir(), write_group.get()));
+      handle.impl_->rdg_manifest().dir(), write_group.get(), &written_props));
 
   // writing partition metadata
   core_->part_header().set_part_prop_info_list(KATANA_CHECKED(
@@ -352,6 +358,7 @@ katana::RDG::DoStore(
 
   // Update lineage and commit
   core_->AddCommandLine(command_line);
+  core_->SetWrittenProperties(std::move(written_props));
 
   KATANA_CHECKED(SetTnxContextManifest(
       handle, core_->part_header().metadata().policy_id_,
@@ -1103,6 +1110,30 @@ katana::RDG::WriteRDKLSHIndexPrimitive(katana::RDKLSHIndexPrimitive& index) {
   return katana::ResultSuccess();
 }
 
+katana::Result<std::optional<katana::RDGAdjacencyFilter>>
+katana::RDG::LoadAdjacencyFilter() {
+  std::optional<std::string> res =
+      KATANA_CHECKED(core_->part_header().OptionalDatastructureManifest(
+          kOptionalDatastructureAdjacencyFilter));
+  if (!res) {
+    return std::nullopt;
+  }
+
+  katana::RDGAdjacencyFilter filter = KATANA_CHECKED_CONTEXT(
+      katana::RDGAdjacencyFilter::Load(rdg_dir(), res.value()),
+      "Failed to load RDGAdjacencyFilter located at {}", res.value());
+  return filter;
+}
+
+katana::Result<void>
+katana::RDG::WriteAdjacencyFilter(katana::RDGAdjacencyFilter& filter) {
+  std::string path = KATANA_CHECKED(filter.Write(rdg_dir()));
+  core_->part_header().AppendOptionalDatastructureManifest(
+      kOptionalDatastructureAdjacencyFilter, path);
+
+  return katana::ResultSuccess();
+}
+
 katana::Result<std::optional<katana::RDKSubstructureIndexPrimitive>>
 katana::RDG::LoadRDKSubstructureIndexPrimitive() {
   std::optional<std::string> res =
@@ -284,6 +284,10 @@ public:
     lineage_.AddCommandLine(command_line);
   }
 
+  void SetWrittenProperties(std::vector<std::string> names) {
+    lineage_.SetWrittenProperties(std::move(names));
+  }
+
 private:
   void InitEmptyProperties();
 
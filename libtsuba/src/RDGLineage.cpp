@@ -13,17 +13,30 @@ katana::RDGLineage::AddCommandLine(const std::string& cmd) {
   command_line_ = cmd;
 }
 
+void
+katana::RDGLineage::SetWrittenProperties(std::vector<std::string> names) {
+  written_properties_ = std::move(names);
+}
+
 void
 katana::RDGLineage::ClearLineage() {
   command_line_.clear();
+  written_properties_.clear();
 }
 
 void
 katana::to_json(json& j, const katana::RDGLineage& lineage) {
-  j = json{{"command_line", lineage.command_line_}};
+  j = json{
+      {"command_line", lineage.command_line_},
+      {"written_properties", lineage.written_properties_},
+  };
 }
 
 void
 katana::from_json(const json& j, katana::RDGLineage& lineage) {
   j.at("command_line").get_to(lineage.command_line_);
+  // written_properties is absent in lineage written by older versions
+  if (auto it = j.find("written_properties"); it != j.end()) {
+    it->get_to(lineage.written_properties_);
+  }
 }
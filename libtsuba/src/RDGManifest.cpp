@@ -13,6 +13,7 @@
 #include "katana/ParquetReader.h"
 #include "katana/RDGOptionalDatastructure.h"
 #include "katana/Result.h"
+#include "katana/file.h"
 #include "katana/tsuba.h"
 
 using json = nlohmann::json;
@@ -50,12 +51,26 @@ const std::regex katana::RDGManifest::kManifestVersion(
 
 katana::Result<katana::RDGManifest>
 katana::RDGManifest::MakeFromStorage(const katana::URI& uri) {
-  katana::FileView fv;
-
-  KATANA_CHECKED(fv.Bind(uri.string(), true));
+  // Manifest names embed the RDG version, so re-opens of a versioned RDG
+  // can be served from the metadata cache; the Stat both validates the
+  // cached entry and sizes the read on a miss.
+  katana::StatBuf stat_buf;
+  KATANA_CHECKED_CONTEXT(FileStat(uri.string(), &stat_buf), "{}", uri.string());
+
+  std::string contents;
+  if (auto cached = GlobalState::Get().GetMetadataFile(uri, stat_buf.size);
+      cached) {
+    contents = std::move(cached.value());
+  } else {
+    katana::FileView fv;
+    KATANA_CHECKED(fv.Bind(uri.string(), true));
+    contents.assign(fv.ptr<char>(), fv.size());
+    GlobalState::Get().PutMetadataFile(uri, contents);
+  }
 
   katana::RDGManifest manifest(uri.DirName());
-  auto manifest_res = katana::JsonParse<katana::RDGManifest>(fv, &manifest);
+  auto manifest_res =
+      katana::JsonParse<katana::RDGManifest>(contents, &manifest);
 
   if (!manifest_res) {
     return manifest_res.error().WithContext("cannot parse {}", uri.string());
@@ -18,6 +18,7 @@
 #include "katana/RDGStorageFormatVersion.h"
 #include "katana/RDGTopology.h"
 #include "katana/Result.h"
+#include "katana/file.h"
 
 using json = nlohmann::json;
 
@@ -105,15 +106,31 @@ const int kPartitionMatchHostIndex = 3;
 
 katana::Result<katana::RDGPartHeader>
 katana::RDGPartHeader::MakeJson(const katana::URI& partition_path) {
-  katana::FileView fv;
-  KATANA_CHECKED(fv.Bind(partition_path.string(), true));
-
-  if (fv.size() == 0) {
+  // Partition header names embed the RDG version, so repeated opens of the
+  // same versioned RDG are served from the metadata cache; the Stat
+  // validates the cached entry against the file on storage.
+  katana::StatBuf stat_buf;
+  KATANA_CHECKED_CONTEXT(
+      FileStat(partition_path.string(), &stat_buf), "{}",
+      partition_path.string());
+  if (stat_buf.size == 0) {
     return katana::RDGPartHeader();
   }
 
+  std::string contents;
+  if (auto cached =
+          GlobalState::Get().GetMetadataFile(partition_path, stat_buf.size);
+      cached) {
+    contents = std::move(cached.value());
+  } else {
+    katana::FileView fv;
+    KATANA_CHECKED(fv.Bind(partition_path.string(), true));
+    contents.assign(fv.ptr<char>(), fv.size());
+    GlobalState::Get().PutMetadataFile(partition_path, contents);
+  }
+
   katana::RDGPartHeader header;
-  KATANA_CHECKED(katana::JsonParse<katana::RDGPartHeader>(fv, &header));
+  KATANA_CHECKED(katana::JsonParse<katana::RDGPartHeader>(contents, &header));
 
   return header;
 }
@@ -731,6 +748,23 @@ katana::to_json(
       {"paths", index.paths_}};
 }
 
+void
+katana::from_json(const nlohmann::json& j, katana::RDGAdjacencyFilter& filter) {
+  j.at("num_nodes").get_to(filter.num_nodes_);
+  j.at("bits_per_edge").get_to(filter.bits_per_edge_);
+  j.at("probes_per_edge").get_to(filter.probes_per_edge_);
+  j.at("paths").get_to(filter.paths_);
+}
+
+void
+katana::to_json(nlohmann::json& j, const katana::RDGAdjacencyFilter& filter) {
+  j = nlohmann::json{
+      {"num_nodes", filter.num_nodes_},
+      {"bits_per_edge", filter.bits_per_edge_},
+      {"probes_per_edge", filter.probes_per_edge_},
+      {"paths", filter.paths_}};
+}
+
 void
 katana::from_json(
     const nlohmann::json& j, katana::RDGOptionalDatastructure& data) {
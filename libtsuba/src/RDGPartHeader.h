@@ -19,6 +19,7 @@
 #include "katana/Logging.h"
 #include "katana/PartitionMetadata.h"
 #include "katana/RDG.h"
+#include "katana/RDGAdjacencyFilter.h"
 #include "katana/RDGStorageFormatVersion.h"
 #include "katana/RDGTopology.h"
 #include "katana/RDKLSHIndexPrimitive.h"
@@ -605,6 +606,9 @@ void from_json(const nlohmann::json& j, RDKLSHIndexPrimitive& index);
 void to_json(nlohmann::json& j, const RDKSubstructureIndexPrimitive& index);
 void from_json(const nlohmann::json& j, RDKSubstructureIndexPrimitive& index);
 
+void to_json(nlohmann::json& j, const RDGAdjacencyFilter& filter);
+void from_json(const nlohmann::json& j, RDGAdjacencyFilter& filter);
+
 void to_json(nlohmann::json& j, const RDGOptionalDatastructure& data);
 void from_json(const nlohmann::json& j, RDGOptionalDatastructure& data);
 
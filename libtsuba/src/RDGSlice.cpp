@@ -323,6 +323,26 @@ katana::RDGSlice::Make(
   return RDGSlice(std::move(rdg_slice));
 }
 
+std::future<katana::CopyableResult<katana::RDGSlice>>
+katana::RDGSlice::Prefetch(
+    RDGHandle handle, const SliceArg& slice, const uint32_t partition_id,
+    const std::optional<std::vector<std::string>>& node_props,
+    const std::optional<std::vector<std::string>>& edge_props) {
+  // Make already overlaps the reads for one slice with each other through
+  // ReadGroup; running it on its own thread additionally overlaps all of this
+  // slice's I/O (and parquet decode) with whatever the caller is computing.
+  return std::async(
+      std::launch::async,
+      [handle, slice, partition_id, node_props,
+       edge_props]() -> katana::CopyableResult<RDGSlice> {
+        auto res = Make(handle, slice, partition_id, node_props, edge_props);
+        if (!res) {
+          return katana::CopyableErrorInfo{res.error()};
+        }
+        return std::move(res.value());
+      });
+}
+
 katana::Result<std::pair<std::vector<size_t>, std::vector<size_t>>>
 katana::RDGSlice::GetPerPartitionCounts(RDGHandle handle) {
   katana::URI part_0_part_file =
@@ -233,6 +233,26 @@ katana::RDGTopology::Map() {
   return katana::ResultSuccess();
 }
 
+katana::Result<void>
+katana::RDGTopology::AdviseEdgeRange(uint64_t edge_begin, uint64_t edge_end) {
+  if (!file_store_bound_ || !file_store_mapped_) {
+    return KATANA_ERROR(
+        ErrorCode::InvalidArgument,
+        "topology must be bound and mapped before advising edge ranges");
+  }
+  if (edge_begin > edge_end || edge_end > num_edges_) {
+    return KATANA_ERROR(
+        ErrorCode::InvalidArgument,
+        "invalid edge range [{}, {}) for a topology with {} edges", edge_begin,
+        edge_end, num_edges_);
+  }
+
+  const uint8_t* base = file_storage_.ptr<uint8_t>();
+  uint64_t begin = reinterpret_cast<const uint8_t*>(dests_ + edge_begin) - base;
+  uint64_t end = reinterpret_cast<const uint8_t*>(dests_ + edge_end) - base;
+  return file_storage_.AdviseWindow(begin, end);
+}
+
 katana::Result<void>
 katana::RDGTopology::MapMetadataExtract(
     uint64_t num_nodes, uint64_t num_edges, bool storage_valid) {
@@ -0,0 +1,214 @@
+#include "UringIOBackend.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <functional>
+#include <mutex>
+
+#include "katana/ErrorCode.h"
+#include "katana/Logging.h"
+#include "katana/ThreadPool.h"
+
+#ifdef KATANA_HAVE_LIBURING
+
+#include <liburing.h>
+
+namespace {
+
+// Entries in the submission queue; in-flight operations beyond this block
+// in Submit until completions drain.
+constexpr unsigned kQueueDepth = 256;
+
+// io_uring caps a single read/write at INT_MAX anyway; resubmitting in
+// bounded steps also handles short transfers uniformly.
+constexpr uint64_t kMaxTransfer = UINT64_C(1) << 30;
+
+/// One in-flight operation; owned by the ring (as sqe user data) between
+/// submission and completion.
+struct Request {
+  std::promise<katana::CopyableResult<void>> promise;
+  int fd;
+  bool write;
+  uint8_t* buf;
+  uint64_t offset;
+  uint64_t remaining;
+
+  void Fail(katana::ErrorInfo&& error) {
+    close(fd);
+    promise.set_value(katana::CopyableErrorInfo{std::move(error)});
+  }
+
+  void Finish() {
+    close(fd);
+    promise.set_value(katana::CopyableResultSuccess());
+  }
+};
+
+}  // namespace
+
+struct katana::UringIOBackend::Impl {
+  io_uring ring;
+  // serializes submission queue access between compute threads and the
+  // reaper's resubmissions
+  std::mutex submit_lock;
+
+  /// Queue the next step of req on the ring. Takes ownership of req.
+  void Submit(std::unique_ptr<Request> req) {
+    std::lock_guard<std::mutex> guard(submit_lock);
+    io_uring_sqe* sqe = io_uring_get_sqe(&ring);
+    if (sqe == nullptr) {
+      // submission queue full: flush it and retry; completions are consumed
+      // by the reaper so this cannot livelock
+      io_uring_submit(&ring);
+      while ((sqe = io_uring_get_sqe(&ring)) == nullptr) {
+        io_uring_submit(&ring);
+      }
+    }
+    unsigned step = static_cast<unsigned>(
+        std::min(req->remaining, kMaxTransfer));
+    if (req->write) {
+      io_uring_prep_write(sqe, req->fd, req->buf, step, req->offset);
+    } else {
+      io_uring_prep_read(sqe, req->fd, req->buf, step, req->offset);
+    }
+    io_uring_sqe_set_data(sqe, req.release());
+    io_uring_submit(&ring);
+  }
+
+  /// Body of the reaper thread: wait on the completion queue forever,
+  /// resubmitting short transfers and fulfilling finished promises.
+  void Run() {
+    while (true) {
+      io_uring_cqe* cqe = nullptr;
+      int rc = io_uring_wait_cqe(&ring, &cqe);
+      if (rc < 0) {
+        if (rc == -EINTR) {
+          continue;
+        }
+        KATANA_LOG_FATAL(
+            "waiting on io_uring completion queue: {}", strerror(-rc));
+      }
+      std::unique_ptr<Request> req(
+          static_cast<Request*>(io_uring_cqe_get_data(cqe)));
+      int res = cqe->res;
+      io_uring_cqe_seen(&ring, cqe);
+
+      if (res < 0) {
+        req->Fail(KATANA_ERROR(
+            katana::ErrorCode::LocalStorageError, "{}: {}",
+            req->write ? "async write" : "async read", strerror(-res)));
+        continue;
+      }
+      if (res == 0 && req->remaining > 0) {
+        req->Fail(KATANA_ERROR(
+            katana::ErrorCode::LocalStorageError,
+            "async read ended {} bytes early", req->remaining));
+        continue;
+      }
+      req->buf += res;
+      req->offset += res;
+      req->remaining -= res;
+      if (req->remaining > 0) {
+        Submit(std::move(req));
+        continue;
+      }
+      req->Finish();
+    }
+  }
+};
+
+katana::UringIOBackend::UringIOBackend() {
+  auto impl = std::make_unique<Impl>();
+  if (int rc = io_uring_queue_init(kQueueDepth, &impl->ring, 0); rc < 0) {
+    KATANA_LOG_DEBUG(
+        "io_uring unavailable, storage falls back to the dedicated I/O "
+        "thread: {}",
+        strerror(-rc));
+    return;
+  }
+  impl_ = impl.release();
+  static std::function<void(void)> body = [this]() { impl_->Run(); };
+  katana::GetThreadPool().runDedicated(body);
+}
+
+std::future<katana::CopyableResult<void>>
+katana::UringIOBackend::SubmitRead(
+    const std::string& path, uint64_t start, uint64_t size,
+    uint8_t* result_buf) {
+  auto req = std::make_unique<Request>();
+  std::future<katana::CopyableResult<void>> fut = req->promise.get_future();
+  int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    req->promise.set_value(katana::CopyableErrorInfo{KATANA_ERROR(
+        katana::ErrorCode::LocalStorageError, "opening {}: {}", path,
+        strerror(errno))});
+    return fut;
+  }
+  req->fd = fd;
+  req->write = false;
+  req->buf = result_buf;
+  req->offset = start;
+  req->remaining = size;
+  if (size == 0) {
+    req->Finish();
+    return fut;
+  }
+  impl_->Submit(std::move(req));
+  return fut;
+}
+
+std::future<katana::CopyableResult<void>>
+katana::UringIOBackend::SubmitWrite(
+    const std::string& path, const uint8_t* data, uint64_t size) {
+  auto req = std::make_unique<Request>();
+  std::future<katana::CopyableResult<void>> fut = req->promise.get_future();
+  int fd =
+      open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+  if (fd < 0) {
+    req->promise.set_value(katana::CopyableErrorInfo{KATANA_ERROR(
+        katana::ErrorCode::LocalStorageError, "opening {}: {}", path,
+        strerror(errno))});
+    return fut;
+  }
+  req->fd = fd;
+  req->write = true;
+  // the ring only reads from write buffers
+  req->buf = const_cast<uint8_t*>(data);
+  req->offset = 0;
+  req->remaining = size;
+  if (size == 0) {
+    req->Finish();
+    return fut;
+  }
+  impl_->Submit(std::move(req));
+  return fut;
+}
+
+#else  // !KATANA_HAVE_LIBURING
+
+katana::UringIOBackend::UringIOBackend() = default;
+
+std::future<katana::CopyableResult<void>>
+katana::UringIOBackend::SubmitRead(
+    const std::string&, uint64_t, uint64_t, uint8_t*) {
+  KATANA_LOG_FATAL("SubmitRead called without liburing support");
+}
+
+std::future<katana::CopyableResult<void>>
+katana::UringIOBackend::SubmitWrite(const std::string&, const uint8_t*, uint64_t) {
+  KATANA_LOG_FATAL("SubmitWrite called without liburing support");
+}
+
+#endif  // KATANA_HAVE_LIBURING
+
+katana::UringIOBackend&
+katana::UringIOBackend::Get() {
+  // Leaked intentionally, like AsyncIOService: the reaper thread waits on
+  // the ring until process exit and must never observe it destroyed.
+  static UringIOBackend* backend = new UringIOBackend();
+  return *backend;
+}
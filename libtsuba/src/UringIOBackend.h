@@ -0,0 +1,64 @@
+#ifndef KATANA_LIBTSUBA_URINGIOBACKEND_H_
+#define KATANA_LIBTSUBA_URINGIOBACKEND_H_
+
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <string>
+
+#include "katana/Result.h"
+
+namespace katana {
+
+/// Asynchronous local file reads and writes over a kernel
+/// submission/completion queue pair (io_uring).
+///
+/// The AsyncIOService path hides storage latency by parking operations on a
+/// dedicated thread that blocks in pread, so concurrency is limited to one
+/// operation at a time per thread. This backend instead queues each
+/// operation as a submission entry on a shared ring; the kernel services
+/// many of them in flight at once, and a single reaper thread waits on the
+/// completion queue and fulfills the promises. Dozens of overlapping reads
+/// cost one thread instead of dozens.
+///
+/// When liburing is not available at build time, or ring setup fails at
+/// runtime (old kernel, locked-memory limits), Available() is false and
+/// callers keep using AsyncIOService.
+class UringIOBackend {
+public:
+  UringIOBackend(const UringIOBackend&) = delete;
+  UringIOBackend& operator=(const UringIOBackend&) = delete;
+
+  /// Get the process-wide backend, setting up the ring and starting the
+  /// reaper thread on first use.
+  static UringIOBackend& Get();
+
+  /// True when the ring is usable; the Submit functions may only be called
+  /// when this is true.
+  bool Available() const { return impl_ != nullptr; }
+
+  /// Read size bytes at start from the file at path into result_buf. The
+  /// returned future becomes ready when the read completes; result_buf must
+  /// stay live until then.
+  std::future<CopyableResult<void>> SubmitRead(
+      const std::string& path, uint64_t start, uint64_t size,
+      uint8_t* result_buf);
+
+  /// Create (or truncate) the file at path with the given bytes. Parent
+  /// directories must already exist. data must stay live until the returned
+  /// future is ready.
+  std::future<CopyableResult<void>> SubmitWrite(
+      const std::string& path, const uint8_t* data, uint64_t size);
+
+private:
+  UringIOBackend();
+
+  struct Impl;
+  // Leaked with the singleton: the reaper thread waits on the ring until
+  // process exit and must never observe it destroyed.
+  Impl* impl_ = nullptr;
+};
+
+}  // namespace katana
+
+#endif
@@ -31,6 +31,28 @@ katana::FileStoreAsync(
   return FS(uri)->PutAsync(uri, static_cast<const uint8_t*>(data), size);
 }
 
+bool
+katana::FileStreamingStoreSupported(const std::string& uri) {
+  return FS(uri)->SupportsStreamingPut();
+}
+
+katana::Result<void>
+katana::FileStreamingStoreBegin(const std::string& uri) {
+  return FS(uri)->PutStreamingBegin(uri);
+}
+
+katana::Result<void>
+katana::FileStreamingStoreAppend(
+    const std::string& uri, const void* data, uint64_t size) {
+  return FS(uri)->PutStreamingAppend(
+      uri, static_cast<const uint8_t*>(data), size);
+}
+
+katana::Result<void>
+katana::FileStreamingStoreFinish(const std::string& uri) {
+  return FS(uri)->PutStreamingFinish(uri);
+}
+
 katana::Result<void>
 katana::FileGet(
     const std::string& uri, void* result_buffer, uint64_t begin,
@@ -0,0 +1,295 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <vector>
+
+#include <katana/JSON.h>
+#include <katana/JSONTracer.h>
+#include <katana/analytics/bfs/bfs.h>
+#include <katana/analytics/cdlp/cdlp.h>
+#include <katana/analytics/connected_components/connected_components.h>
+#include <katana/analytics/k_core/k_core.h>
+#include <katana/analytics/pagerank/pagerank.h>
+#include <katana/analytics/sssp/sssp.h>
+#include <katana/analytics/triangle_count/triangle_count.h>
+
+#include "Lonestar/BoilerPlate.h"
+
+using namespace katana::analytics;
+
+namespace cll = llvm::cl;
+
+static const char* name = "Analytics Benchmark Harness";
+
+static const char* desc =
+    "Runs a declared matrix of analytics over a list of input graphs, emits "
+    "machine-readable JSON with per-phase timers and memory high-water, and "
+    "optionally compares against a stored baseline to flag regressions";
+
+static const char* url = nullptr;
+
+static cll::list<std::string> inputFiles(
+    cll::Positional, cll::desc("<input files>"), cll::OneOrMore);
+
+static cll::opt<std::string> analytics(
+    "analytics",
+    cll::desc("Comma separated list of analytics to run (default "
+              "bfs,sssp,cc,pagerank,triangles,kcore,cdlp)"),
+    cll::init("bfs,sssp,cc,pagerank,triangles,kcore,cdlp"));
+
+static cll::opt<unsigned int> startNode(
+    "startNode",
+    cll::desc("Source node for traversal analytics (default value 0)"),
+    cll::init(0));
+
+static cll::opt<std::string> resultsFile(
+    "resultsFile",
+    cll::desc("File to write the JSON results document to; written to stdout "
+              "when unset"));
+
+static cll::opt<std::string> baselineFile(
+    "baselineFile",
+    cll::desc("JSON results document from an earlier run to compare against; "
+              "the harness exits non-zero when any analytic regresses"));
+
+static cll::opt<double> tolerance(
+    "tolerance",
+    cll::desc("Fraction by which a run may exceed its baseline time before it "
+              "counts as a regression (default value 0.10)"),
+    cll::init(0.10));
+
+namespace {
+
+/// One cell of the benchmark matrix: an analytic run on an input, with its
+/// phase timings in microseconds and the process memory high-water after it.
+struct BenchResult {
+  std::string input;
+  std::string analytic;
+  uint64_t load_usec{0};
+  uint64_t run_usec{0};
+  long max_mem_kb{0};
+};
+
+void
+to_json(nlohmann::json& j, const BenchResult& r) {
+  j = nlohmann::json{
+      {"input", r.input},
+      {"analytic", r.analytic},
+      {"load_usec", r.load_usec},
+      {"run_usec", r.run_usec},
+      {"max_mem_kb", r.max_mem_kb},
+  };
+}
+
+void
+from_json(const nlohmann::json& j, BenchResult& r) {
+  j.at("input").get_to(r.input);
+  j.at("analytic").get_to(r.analytic);
+  j.at("load_usec").get_to(r.load_usec);
+  j.at("run_usec").get_to(r.run_usec);
+  j.at("max_mem_kb").get_to(r.max_mem_kb);
+}
+
+std::vector<std::string>
+SplitCommaList(const std::string& list) {
+  std::vector<std::string> names;
+  std::istringstream str(list);
+  std::string token;
+  while (std::getline(str, token, ',')) {
+    if (!token.empty()) {
+      names.emplace_back(token);
+    }
+  }
+  return names;
+}
+
+katana::Result<void>
+RunAnalytic(
+    const std::string& analytic, katana::PropertyGraph* pg,
+    katana::TxnContext* txn_ctx) {
+  const std::string prop = "bench-" + analytic;
+  if (analytic == "bfs") {
+    return Bfs(pg, startNode, prop, txn_ctx);
+  }
+  if (analytic == "sssp") {
+    return Sssp(pg, startNode, edge_property_name, prop, txn_ctx);
+  }
+  if (analytic == "cc") {
+    return ConnectedComponents(pg, prop, txn_ctx, symmetricGraph);
+  }
+  if (analytic == "pagerank") {
+    return Pagerank(pg, prop, txn_ctx);
+  }
+  if (analytic == "triangles") {
+    KATANA_CHECKED(TriangleCount(pg));
+    return katana::ResultSuccess();
+  }
+  if (analytic == "kcore") {
+    return KCoreDecomposition(pg, prop, txn_ctx, symmetricGraph);
+  }
+  if (analytic == "cdlp") {
+    return Cdlp(pg, prop, CdlpPlan::kMaxIterations, txn_ctx, symmetricGraph);
+  }
+  return KATANA_ERROR(
+      katana::ErrorCode::InvalidArgument, "unknown analytic: {}", analytic);
+}
+
+/// Compare this run against a stored results document. Returns the number of
+/// cells whose run time exceeds the baseline by more than the tolerance;
+/// cells absent from the baseline are reported but do not count.
+size_t
+CompareAgainstBaseline(
+    const std::vector<BenchResult>& results,
+    const std::vector<BenchResult>& baseline) {
+  std::map<std::pair<std::string, std::string>, uint64_t> baseline_usec;
+  for (const BenchResult& r : baseline) {
+    baseline_usec[{r.input, r.analytic}] = r.run_usec;
+  }
+
+  size_t regressions = 0;
+  for (const BenchResult& r : results) {
+    auto it = baseline_usec.find({r.input, r.analytic});
+    if (it == baseline_usec.end()) {
+      std::cout << "no baseline for " << r.analytic << " on " << r.input
+                << "\n";
+      continue;
+    }
+    double allowed = static_cast<double>(it->second) * (1.0 + tolerance);
+    if (static_cast<double>(r.run_usec) > allowed) {
+      std::cout << "REGRESSION: " << r.analytic << " on " << r.input << " took "
+                << r.run_usec << " usec, baseline " << it->second
+                << " usec (tolerance " << tolerance << ")\n";
+      regressions++;
+    }
+  }
+  return regressions;
+}
+
+}  // namespace
+
+int
+main(int argc, char** argv) {
+  std::unique_ptr<katana::SharedMemSys> G =
+      LonestarStart(argc, argv, name, desc, url, nullptr);
+
+  katana::ProgressTracer::Set(katana::JSONTracer::Make());
+  auto& tracer = katana::ProgressTracer::Get();
+
+  std::vector<std::string> analytic_names = SplitCommaList(analytics);
+  std::vector<BenchResult> results;
+
+  for (const std::string& input_file : inputFiles) {
+    auto uri_res = katana::URI::Make(input_file);
+    if (!uri_res) {
+      KATANA_LOG_FATAL("input file {} error: {}", input_file, uri_res.error());
+    }
+
+    katana::StatTimer load_time("BenchLoad");
+    load_time.start();
+    std::unique_ptr<katana::PropertyGraph> pg =
+        MakeFileGraph(uri_res.value(), edge_property_name);
+    std::unique_ptr<katana::PropertyGraph> pg_view =
+        ProjectPropertyGraphForArguments(pg);
+    load_time.stop();
+
+    for (const std::string& analytic : analytic_names) {
+      katana::ProgressScope scope =
+          tracer.StartActiveSpan("bench " + analytic + " " + input_file);
+      scope.span().SetTags(
+          {{"input", input_file},
+           {"analytic", analytic},
+           {"threads", static_cast<uint32_t>(numThreads)}});
+
+      katana::TxnContext txn_ctx;
+      katana::StatTimer run_time("BenchRun");
+      run_time.start();
+      auto r = RunAnalytic(analytic, pg_view.get(), &txn_ctx);
+      run_time.stop();
+      if (!r) {
+        KATANA_LOG_FATAL(
+            "failed to run {} on {}: {}", analytic, input_file, r.error());
+      }
+
+      BenchResult result;
+      result.input = input_file;
+      result.analytic = analytic;
+      result.load_usec = load_time.get_usec();
+      result.run_usec = run_time.get_usec();
+      result.max_mem_kb = katana::ProgressTracer::GetMaxMem();
+      results.push_back(result);
+
+      scope.span().Log(
+          "bench result", {{"run_usec", result.run_usec},
+                           {"load_usec", result.load_usec}});
+    }
+  }
+
+  katana::HostStats host_stats = katana::ProgressTracer::GetHostStats();
+  nlohmann::json doc{
+      {"host",
+       {{"hostname", host_stats.hostname},
+        {"nprocs", host_stats.nprocs},
+        {"ram_gb", host_stats.ram_gb}}},
+      {"threads", static_cast<unsigned>(numThreads)},
+      {"results", results},
+  };
+
+  auto dump = katana::JsonDump(doc);
+  if (!dump) {
+    KATANA_LOG_FATAL("failed to serialize results: {}", dump.error());
+  }
+  if (resultsFile.getValue().empty()) {
+    std::cout << dump.value() << "\n";
+  } else {
+    std::ofstream out(resultsFile);
+    if (!out.good()) {
+      KATANA_LOG_FATAL("failed to open results file: {}", resultsFile);
+    }
+    out << dump.value() << "\n";
+  }
+
+  if (!baselineFile.getValue().empty()) {
+    std::ifstream in(baselineFile);
+    if (!in.good()) {
+      KATANA_LOG_FATAL("failed to open baseline file: {}", baselineFile);
+    }
+    std::string contents(
+        (std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    nlohmann::json baseline_doc;
+    if (auto parsed = katana::JsonParse(contents, &baseline_doc); !parsed) {
+      KATANA_LOG_FATAL(
+          "failed to parse baseline file {}: {}", baselineFile, parsed.error());
+    }
+    std::vector<BenchResult> baseline =
+        baseline_doc.at("results").get<std::vector<BenchResult>>();
+    size_t regressions = CompareAgainstBaseline(results, baseline);
+    if (regressions > 0) {
+      std::cout << regressions << " regression(s) against " << baselineFile
+                << "\n";
+      return 1;
+    }
+    std::cout << "no regressions against " << baselineFile << "\n";
+  }
+
+  return 0;
+}
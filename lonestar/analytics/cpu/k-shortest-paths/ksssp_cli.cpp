@@ -58,7 +58,10 @@ static cll::opt<KssspPlan::Algorithm> algo(
         clEnumValN(KssspPlan::kDeltaStep, "DeltaStep", "Delta stepping"),
         clEnumValN(
             KssspPlan::kDeltaStepBarrier, "DeltaStepBarrier",
-            "Delta stepping with barrier")),
+            "Delta stepping with barrier"),
+        clEnumValN(
+            KssspPlan::kBidirectionalDijkstra, "BidirectionalDijkstra",
+            "Bidirectional point-to-point search (numPaths must be 1)")),
     cll::init(KssspPlan::kDeltaTile));
 
 static cll::opt<KssspPlan::Reachability> reachability(
@@ -84,6 +87,8 @@ AlgorithmName(KssspPlan::Algorithm algorithm) {
     return "DeltaStep";
   case KssspPlan::kDeltaStepBarrier:
     return "DeltaStepBarrier";
+  case KssspPlan::kBidirectionalDijkstra:
+    return "BidirectionalDijkstra";
   default:
     return "Unknown";
   }
@@ -160,6 +165,9 @@ main(int argc, char** argv) {
   case KssspPlan::kDeltaStepBarrier:
     plan = KssspPlan::DeltaStepBarrier(reachability, stepShift);
     break;
+  case KssspPlan::kBidirectionalDijkstra:
+    plan = KssspPlan::BidirectionalDijkstra();
+    break;
   default:
     KATANA_LOG_FATAL("Invalid algorithm selected");
   }
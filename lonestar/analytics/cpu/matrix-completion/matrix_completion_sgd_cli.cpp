@@ -102,9 +102,13 @@ static cll::opt<bool> useDetInit(
 
 static cll::opt<MatrixCompletionPlan::Algorithm> algo(
     "algo", cll::desc("Choose an algorithm:"),
-    cll::values(clEnumValN(
-        MatrixCompletionPlan::kSGDByItems, "sgdByItems",
-        "Simple SGD on Items")),
+    cll::values(
+        clEnumValN(
+            MatrixCompletionPlan::kSGDByItems, "sgdByItems",
+            "Simple SGD on Items"),
+        clEnumValN(
+            MatrixCompletionPlan::kSGDByItemsTiled, "sgdByItemsTiled",
+            "DSGD over cache-sized 2D edge tiles")),
     cll::init(MatrixCompletionPlan::kSGDByItems));
 /*
  * Commandline options for different learning functions
@@ -154,6 +158,12 @@ main(int argc, char** argv) {
         maxUpdates, updatesPerEdge, fixedRounds, useExactError, useDetInit,
         learningRateFunction);
     break;
+  case MatrixCompletionPlan::kSGDByItemsTiled:
+    plan = MatrixCompletionPlan::SGDByItemsTiled(
+        learningRate, decayRate, lambda, tolerance, useSameLatentVector,
+        maxUpdates, updatesPerEdge, fixedRounds, useExactError, useDetInit,
+        learningRateFunction);
+    break;
   default:
     KATANA_LOG_FATAL("invalid algorithm");
   }
@@ -24,6 +24,7 @@ from katana.local_native import (
     ReduceSum,
     TxnContext,
 )
+from katana.local.vertex_operator import run_vertex_operator
 from katana.native_interfacing.numpy_atomic import atomic_add, atomic_max, atomic_min, atomic_sub
 
 __all__ = [
@@ -50,6 +51,7 @@ __all__ = [
     "AtomicEntityType",
     "EntityTypeManager",
     "EntityTypeArray",
+    "run_vertex_operator",
 ]
 
 Graph.out_edges = graph_adds.out_edges
@@ -53,6 +53,8 @@ Algorithms
 
 .. automodule:: katana.local.analytics._wrappers
 
+.. automodule:: katana.local.analytics._async
+
 """
 
 
@@ -99,5 +101,24 @@ from katana.local.analytics._pagerank import PagerankPlan, PagerankStatistics, p
 from katana.local.analytics._sssp import SsspPlan, SsspStatistics, sssp, sssp_assert_valid
 from katana.local.analytics._subgraph_extraction import SubGraphExtractionPlan, subgraph_extraction
 from katana.local.analytics._triangle_count import TriangleCountPlan, triangle_count
+from katana.local.analytics._async import (
+    betweenness_centrality_async,
+    bfs_async,
+    cdlp_async,
+    connected_components_async,
+    independent_set_async,
+    jaccard_async,
+    k_core_async,
+    k_truss_async,
+    ksssp_async,
+    leiden_clustering_async,
+    local_clustering_coefficient_async,
+    louvain_clustering_async,
+    make_async,
+    pagerank_async,
+    sssp_async,
+    subgraph_extraction_async,
+    triangle_count_async,
+)
 from katana.local.analytics._wrappers import find_edge_sorted_by_dest, sort_all_edges_by_dest, sort_nodes_by_degree
 from katana.local.analytics.plan import Architecture, Plan, Statistics
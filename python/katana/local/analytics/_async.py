@@ -0,0 +1,91 @@
+"""
+Asynchronous variants of the analytics entry points.
+
+Every synchronous routine in this package releases the GIL around the
+parallel C++ execution, so running one from a worker thread leaves the
+interpreter free for other users of the process (notebook cells, RPC
+handlers). The ``*_async`` variants below do exactly that: they submit
+the synchronous routine to a private worker thread and return a
+:py:class:`concurrent.futures.Future` whose result (or exception) is
+that of the synchronous call.
+
+The worker pool has a single thread on purpose: all analytics share one
+Katana thread pool and one parallel region, so concurrent submissions
+queue behind each other rather than corrupting the runtime. The win is
+that they no longer block the submitting Python thread.
+
+.. code-block:: python
+
+    from katana.local.analytics import bfs_async
+
+    future = bfs_async(graph, start_node, "level")
+    ...  # interpreter stays responsive here
+    future.result()
+"""
+
+import functools
+from concurrent.futures import ThreadPoolExecutor
+
+from katana.local.analytics._betweenness_centrality import betweenness_centrality
+from katana.local.analytics._bfs import bfs
+from katana.local.analytics._cdlp import cdlp
+from katana.local.analytics._connected_components import connected_components
+from katana.local.analytics._independent_set import independent_set
+from katana.local.analytics._jaccard import jaccard
+from katana.local.analytics._k_core import k_core
+from katana.local.analytics._k_truss import k_truss
+from katana.local.analytics._ksssp import ksssp
+from katana.local.analytics._leiden_clustering import leiden_clustering
+from katana.local.analytics._local_clustering_coefficient import local_clustering_coefficient
+from katana.local.analytics._louvain_clustering import louvain_clustering
+from katana.local.analytics._pagerank import pagerank
+from katana.local.analytics._sssp import sssp
+from katana.local.analytics._subgraph_extraction import subgraph_extraction
+from katana.local.analytics._triangle_count import triangle_count
+
+_executor = None
+
+
+def _get_executor():
+    global _executor  # pylint: disable=global-statement
+    if _executor is None:
+        _executor = ThreadPoolExecutor(max_workers=1, thread_name_prefix="katana-analytics")
+    return _executor
+
+
+def make_async(routine):
+    """
+    Wrap an analytics routine so calling it returns a
+    :py:class:`concurrent.futures.Future` of its result instead of
+    blocking. The routine must release the GIL during execution, as all
+    routines in this package do.
+    """
+
+    @functools.wraps(routine)
+    def run_async(*args, **kwargs):
+        return _get_executor().submit(routine, *args, **kwargs)
+
+    run_async.__name__ = routine.__name__ + "_async"
+    run_async.__qualname__ = run_async.__name__
+    run_async.__doc__ = "Asynchronous variant of :py:func:`{}`: returns a Future of its result.".format(
+        routine.__name__
+    )
+    return run_async
+
+
+betweenness_centrality_async = make_async(betweenness_centrality)
+bfs_async = make_async(bfs)
+cdlp_async = make_async(cdlp)
+connected_components_async = make_async(connected_components)
+independent_set_async = make_async(independent_set)
+jaccard_async = make_async(jaccard)
+k_core_async = make_async(k_core)
+k_truss_async = make_async(k_truss)
+ksssp_async = make_async(ksssp)
+leiden_clustering_async = make_async(leiden_clustering)
+local_clustering_coefficient_async = make_async(local_clustering_coefficient)
+louvain_clustering_async = make_async(louvain_clustering)
+pagerank_async = make_async(pagerank)
+sssp_async = make_async(sssp)
+subgraph_extraction_async = make_async(subgraph_extraction)
+triangle_count_async = make_async(triangle_count)
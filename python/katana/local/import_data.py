@@ -9,11 +9,19 @@ import numba
 import numpy as np
 
 from katana.local import EntityTypeArray
-from katana.local_native import Graph, TxnContext, _from_csr_and_raw_types, from_csr, from_graphml_native
+from katana.local_native import (
+    Graph,
+    TxnContext,
+    _from_csr_and_raw_types,
+    from_arrow_tables,
+    from_csr,
+    from_graphml_native,
+)
 from katana.native_interfacing.buffer_access import to_numpy
 
 __all__ = [
     "from_graphml",
+    "from_arrow_tables",
     "from_csr",
     "from_adjacency_matrix",
     "from_edge_list_matrix",
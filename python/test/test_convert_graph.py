@@ -5,12 +5,14 @@ from typing import Any, Collection, Union
 
 import numpy as np
 import pandas
+import pyarrow
 import pytest
 
 from katana.example_data import get_misc_dataset
 from katana.local import EntityTypeArray, Graph
 from katana.local.import_data import (
     from_adjacency_matrix,
+    from_arrow_tables,
     from_csr,
     from_edge_list_arrays,
     from_edge_list_dataframe,
@@ -217,6 +219,38 @@ def test_from_csr_k3():
     assert pg.get_edge_dst(5) == 1
 
 
+def test_from_arrow_tables():
+    edges = pyarrow.table(
+        {"source": [2, 0, 1, 0], "destination": [0, 1, 2, 2], "weight": [20.0, 1.0, 12.0, 2.0]}
+    )
+    nodes = pyarrow.table({"name": ["a", "b", "c"]})
+    pg = from_arrow_tables(edges, nodes)
+    assert pg.num_nodes() == 3
+    assert pg.num_edges() == 4
+    # Edges are grouped by source; properties follow the edges into CSR order.
+    assert sorted(pg.get_edge_dst(i) for i in range(2)) == [1, 2]
+    assert pg.get_edge_dst(2) == 2
+    assert pg.get_edge_dst(3) == 0
+    weight = pg.get_edge_property("weight")
+    assert sorted((pg.get_edge_dst(e), weight[e].as_py()) for e in range(2)) == [(1, 1.0), (2, 2.0)]
+    assert weight[2].as_py() == 12.0
+    assert weight[3].as_py() == 20.0
+    assert pg.get_node_property("name")[2].as_py() == "c"
+
+
+def test_from_arrow_tables_infers_nodes():
+    pg = from_arrow_tables(pandas.DataFrame({"source": [0, 4], "destination": [4, 0]}))
+    assert pg.num_nodes() == 5
+    assert pg.num_edges() == 2
+
+
+def test_from_arrow_tables_rejects_out_of_range():
+    edges = pyarrow.table({"source": [0, 3], "destination": [1, 0]})
+    nodes = pyarrow.table({"name": ["a", "b"]})
+    with pytest.raises(ValueError):
+        from_arrow_tables(edges, nodes)
+
+
 @pytest.mark.required_env("KATANA_TEST_DATASETS")
 def test_load_graphml():
     input_file = Path(get_misc_dataset("graph-convert/movies.graphml"))
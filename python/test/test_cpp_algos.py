@@ -28,6 +28,7 @@ from katana.local.analytics import (
     betweenness_centrality,
     bfs,
     bfs_assert_valid,
+    bfs_async,
     cdlp,
     connected_components,
     connected_components_assert_valid,
@@ -53,6 +54,7 @@ from katana.local.analytics import (
     sssp_assert_valid,
     subgraph_extraction,
     triangle_count,
+    triangle_count_async,
 )
 
 NODES_TO_SAMPLE = 10
@@ -489,3 +491,15 @@ def test_busy_wait(graph: Graph):
     # Verify with numba implementation of verifier as well
     verify_bfs(graph, start_node, property_name)
     set_busy_wait(0)
+
+
+def test_async_variants(graph: Graph):
+    property_name = "NewPropAsync"
+    start_node = 0
+
+    future = bfs_async(graph, start_node, property_name)
+    assert future.result() is None
+    bfs_assert_valid(graph, start_node, property_name)
+
+    n = triangle_count_async(graph).result()
+    assert n == 282617
@@ -413,3 +413,65 @@ def test_in_edges(graph):
     out = np.zeros(shape=(5,), dtype=int)
     do_all(range(0, 1), f(graph.with_in_edges().with_edge_type_lookup(), out))
     assert all(out)
+
+
+def test_get_node_property_numpy_zero_copy(graph):
+    graph.add_node_property(numpy_prop=np.arange(graph.num_nodes(), dtype=np.int64))
+    view = graph.get_node_property_numpy("numpy_prop")
+    assert view.dtype == np.int64
+    assert len(view) == graph.num_nodes()
+    assert view[17] == 17
+    # A view, not a copy: it shares the arrow buffer and is read-only.
+    arrow_buf = graph.get_node_property("numpy_prop").chunk(0).buffers()[1]
+    assert view.ctypes.data == arrow_buf.address
+    with pytest.raises(ValueError):
+        view[0] = 1
+
+
+def test_get_node_property_numpy_rejects_nulls(graph):
+    graph.add_node_property(
+        nullable_prop=pyarrow.array([1] + [None] * (graph.num_nodes() - 1), type=pyarrow.int64())
+    )
+    with pytest.raises(ValueError):
+        graph.get_node_property_numpy("nullable_prop")
+
+
+def test_get_edge_property_numpy_zero_copy(graph):
+    graph.add_edge_property(numpy_prop=np.arange(graph.num_edges(), dtype=np.float64))
+    view = graph.get_edge_property_numpy("numpy_prop")
+    assert view.dtype == np.float64
+    assert len(view) == graph.num_edges()
+    assert view[42] == 42.0
+
+
+def test_topology_numpy_views(graph):
+    dsts = graph.out_edge_dsts_numpy()
+    indices = graph.out_edge_indices_numpy()
+    assert dsts.dtype == np.uint32
+    assert indices.dtype == np.uint64
+    assert len(dsts) == graph.num_edges()
+    assert len(indices) == graph.num_nodes()
+    assert dsts[0] == graph.get_edge_dst(0)
+    assert indices[-1] == graph.num_edges()
+    with pytest.raises(ValueError):
+        dsts[0] = 0
+
+
+def test_run_vertex_operator(graph):
+    from katana.local import run_vertex_operator
+
+    graph.add_node_property(vop_rank=np.ones(graph.num_nodes(), dtype=np.float64))
+
+    @do_all_operator()
+    def sum_neighbor_ranks(adj_indices, dests, rank, out, node):
+        start = adj_indices[node - 1] if node > 0 else 0
+        total = 0.0
+        for e in range(start, adj_indices[node]):
+            total += rank[dests[e]]
+        out[node] = total
+
+    out = np.zeros(graph.num_nodes(), dtype=np.float64)
+    run_vertex_operator(graph, sum_neighbor_ranks, out, node_properties=["vop_rank"])
+    # All ranks are 1, so each node's sum is its out-degree.
+    assert out[0] == graph.out_degree(0)
+    assert out.sum() == graph.num_edges()
@@ -0,0 +1,79 @@
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include "katana/PropertyGraph.h"
+#include "katana/SharedMemSys.h"
+#include "katana/SharedTopologyCache.h"
+#include "katana/Timer.h"
+#include "llvm/Support/CommandLine.h"
+
+namespace cll = llvm::cl;
+
+namespace {
+
+enum CacheCommand { publish, attach, drop, status };
+
+cll::opt<CacheCommand> command(
+    cll::Positional, cll::desc("<command>"), cll::Required,
+    cll::values(
+        clEnumVal(publish, "Load the graph and publish its topology"),
+        clEnumVal(attach, "Attach the published topology and report timing"),
+        clEnumVal(drop, "Unlink the published topology"),
+        clEnumVal(status, "Report whether a topology is published")));
+
+cll::opt<std::string> inputFilename(
+    cll::Positional, cll::desc("<rdg directory>"), cll::Required);
+
+katana::Result<void>
+Run() {
+  switch (command) {
+  case publish: {
+    katana::TxnContext txn_ctx;
+    auto uri = KATANA_CHECKED(katana::URI::Make(inputFilename));
+    std::unique_ptr<katana::PropertyGraph> pg =
+        KATANA_CHECKED(katana::PropertyGraph::Make(uri, &txn_ctx));
+    KATANA_CHECKED(katana::SharedTopologyCache::Publish(
+        inputFilename, pg->topology()));
+    std::cout << "published " << pg->topology().NumNodes() << " nodes, "
+              << pg->topology().NumEdges() << " edges as "
+              << katana::SharedTopologyCache::SegmentName(inputFilename)
+              << "\n";
+    break;
+  }
+  case attach: {
+    katana::Timer timer;
+    timer.start();
+    katana::GraphTopology topo =
+        KATANA_CHECKED(katana::SharedTopologyCache::Attach(inputFilename));
+    timer.stop();
+    std::cout << "attached " << topo.NumNodes() << " nodes, "
+              << topo.NumEdges() << " edges in " << timer.get_usec()
+              << " us\n";
+    break;
+  }
+  case drop:
+    KATANA_CHECKED(katana::SharedTopologyCache::Drop(inputFilename));
+    break;
+  case status:
+    std::cout << (katana::SharedTopologyCache::Contains(inputFilename)
+                      ? "published"
+                      : "not published")
+              << "\n";
+    break;
+  }
+  return katana::ResultSuccess();
+}
+
+}  // namespace
+
+int
+main(int argc, char** argv) {
+  katana::SharedMemSys sys;
+  cll::ParseCommandLineOptions(argc, argv);
+
+  if (auto res = Run(); !res) {
+    KATANA_LOG_FATAL("graph-cache failed: {}", res.error());
+  }
+  return 0;
+}
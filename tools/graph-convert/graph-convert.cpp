@@ -21,11 +21,14 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <cstdio>
 #include <cstdlib>
 #include <deque>
 #include <fstream>
 #include <iostream>
 #include <limits>
+#include <memory>
+#include <queue>
 #include <random>
 #include <string>
 #include <vector>
@@ -38,6 +41,7 @@
 #include "katana/FileGraph.h"
 #include "katana/Galois.h"
 #include "katana/NUMAArray.h"
+#include "katana/ParallelSTL.h"
 #include "katana/RDGManifest.h"
 #include "katana/RDGPrefix.h"
 #include "katana/SharedMemSys.h"
@@ -228,6 +232,12 @@ static cll::opt<int> minValue(
     cll::init(1));
 static cll::opt<size_t> maxDegree(
     "maxDegree", cll::desc("maximum degree to keep"), cll::init(2 * 1024));
+static cll::opt<size_t> memoryBudgetMB(
+    "memBudgetMB",
+    cll::desc("edge buffer memory budget in MB for edgelist conversions; "
+              "when set, edges are sorted in external memory via spilled "
+              "runs instead of being held in memory all at once"),
+    cll::init(0));
 
 struct Conversion {};
 struct HasOnlyVoidSpecialization {};
@@ -379,6 +389,249 @@ skipLine(std::ifstream& infile) {
   infile.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
 }
 
+/**
+ * External-memory variant of convertEdgelist, used when -memBudgetMB is
+ * set. Edges are buffered up to the budget, sorted by (src, dst) and
+ * spilled as binary runs beside the output file; a k-way merge then
+ * streams the runs back in source order and writes the version 1 gr file
+ * incrementally. Peak memory is bounded by the budget plus one uint64_t
+ * per node for the degree array.
+ */
+template <typename EdgeTy>
+void
+convertEdgelistExternal(
+    const std::string& infilename, const std::string& outfilename,
+    const bool skipFirstLine, std::optional<char> delim) {
+  constexpr bool kHasValue = !std::is_same<EdgeTy, void>::value;
+  using StoredEdgeTy =
+      typename boost::mpl::if_c<kHasValue, EdgeTy, char>::type;
+
+  struct Record {
+    uint64_t src;
+    uint32_t dst;
+    StoredEdgeTy data;
+  };
+
+  const bool hasDelim = static_cast<bool>(delim);
+  auto parseLine = [&](const std::string& line, Record* rec) -> bool {
+    std::stringstream iss(line);
+    char readDelim;
+    size_t src;
+    size_t dst;
+    if (!(iss >> src)) {
+      return false;
+    }
+    if (hasDelim && (!(iss >> readDelim) || readDelim != delim)) {
+      return false;
+    }
+    if (!(iss >> dst)) {
+      return false;
+    }
+    if constexpr (kHasValue) {
+      if (hasDelim && (!(iss >> readDelim) || readDelim != delim)) {
+        return false;
+      }
+      if (!(iss >> rec->data)) {
+        return false;
+      }
+    }
+    rec->src = src;
+    rec->dst = static_cast<uint32_t>(dst);
+    return true;
+  };
+
+  auto writeLE64 = [](std::ofstream& out, uint64_t value) {
+    value = katana::convert_htole64(value);
+    out.write(reinterpret_cast<char*>(&value), sizeof(value));
+  };
+  auto writeLE32 = [](std::ofstream& out, uint32_t value) {
+    value = katana::convert_htole32(value);
+    out.write(reinterpret_cast<char*>(&value), sizeof(value));
+  };
+
+  // half the budget buffers the current run; the rest covers the merge
+  // read buffers and the degree array
+  size_t runCapacity = std::max<size_t>(
+      (memoryBudgetMB << 20) / sizeof(Record) / 2, 1024 * 1024);
+
+  std::ifstream infile(infilename.c_str());
+  size_t lineNumber = 0;
+  if (skipFirstLine) {
+    katana::gWarn(
+        "first line is assumed to contain labels and will be ignored\n");
+    skipLine(infile);
+    ++lineNumber;
+  }
+
+  std::vector<Record> run;
+  run.reserve(runCapacity);
+  std::vector<std::string> runFiles;
+  std::vector<uint64_t> degree;
+  uint64_t numNodes = 0;
+  uint64_t numEdges = 0;
+  std::optional<size_t> skippedLine;
+
+  auto spillRun = [&]() {
+    if (run.empty()) {
+      return;
+    }
+    katana::ParallelSTL::sort(
+        run.begin(), run.end(), [](const Record& a, const Record& b) {
+          return a.src != b.src ? a.src < b.src : a.dst < b.dst;
+        });
+    std::string path =
+        outfilename + ".run" + std::to_string(runFiles.size());
+    std::ofstream out(path.c_str(), std::ios::binary);
+    out.write(
+        reinterpret_cast<const char*>(run.data()),
+        run.size() * sizeof(Record));
+    if (!out) {
+      KATANA_DIE("failed to write spill run ", path);
+    }
+    runFiles.emplace_back(std::move(path));
+    run.clear();
+  };
+
+  std::string line;
+  for (; std::getline(infile, line); ++lineNumber) {
+    Record rec{};
+    if (!parseLine(line, &rec)) {
+      skippedLine = lineNumber;
+      continue;
+    }
+    if (rec.src >= degree.size()) {
+      degree.resize(std::max<size_t>(rec.src + 1, degree.size() * 2), 0);
+    }
+    ++degree[rec.src];
+    ++numEdges;
+    numNodes = std::max<uint64_t>(
+        numNodes, std::max<uint64_t>(rec.src, rec.dst) + 1);
+    run.emplace_back(rec);
+    if (run.size() >= runCapacity) {
+      spillRun();
+    }
+  }
+  spillRun();
+  infile.close();
+
+  if (skippedLine) {
+    katana::gWarn(
+        "ignored at least one line (line ", *skippedLine,
+        ") because it did not match the expected format\n");
+  }
+  if (numNodes > std::numeric_limits<uint32_t>::max()) {
+    KATANA_DIE(
+        "version 1 gr files store node ids in 32 bits; graph has ", numNodes,
+        " nodes");
+  }
+
+  // header and the cumulative adjacency index stream straight out; only
+  // the degree array is consulted
+  std::ofstream out(outfilename.c_str(), std::ios::binary);
+  writeLE64(out, 1);
+  writeLE64(out, kHasValue ? sizeof(StoredEdgeTy) : 0);
+  writeLE64(out, numNodes);
+  writeLE64(out, numEdges);
+  uint64_t cumulative = 0;
+  for (uint64_t n = 0; n < numNodes; ++n) {
+    cumulative += n < degree.size() ? degree[n] : 0;
+    writeLE64(out, cumulative);
+  }
+
+  // k-way merge of the sorted runs; destinations stream into the file in
+  // source order and edge data goes to a side file appended afterwards
+  class RunReader {
+  public:
+    RunReader(const std::string& path, size_t bufferRecords)
+        : in_(path.c_str(), std::ios::binary),
+          capacity_(std::max<size_t>(bufferRecords, 1024)) {}
+
+    bool next(Record* rec) {
+      if (pos_ == buffer_.size() && !refill()) {
+        return false;
+      }
+      *rec = buffer_[pos_++];
+      return true;
+    }
+
+  private:
+    bool refill() {
+      buffer_.resize(capacity_);
+      in_.read(
+          reinterpret_cast<char*>(buffer_.data()),
+          capacity_ * sizeof(Record));
+      size_t got = static_cast<size_t>(in_.gcount()) / sizeof(Record);
+      buffer_.resize(got);
+      pos_ = 0;
+      return got > 0;
+    }
+
+    std::ifstream in_;
+    size_t capacity_;
+    std::vector<Record> buffer_;
+    size_t pos_{0};
+  };
+
+  size_t mergeBuffer = std::max<size_t>(
+      runCapacity / std::max<size_t>(runFiles.size(), 1) / 2, 1024);
+  std::vector<std::unique_ptr<RunReader>> readers;
+  using HeapItem = std::pair<Record, size_t>;
+  auto heapGreater = [](const HeapItem& a, const HeapItem& b) {
+    return a.first.src != b.first.src ? a.first.src > b.first.src
+                                      : a.first.dst > b.first.dst;
+  };
+  std::priority_queue<HeapItem, std::vector<HeapItem>, decltype(heapGreater)>
+      heap(heapGreater);
+  for (size_t i = 0; i < runFiles.size(); ++i) {
+    readers.emplace_back(std::make_unique<RunReader>(runFiles[i], mergeBuffer));
+    Record rec;
+    if (readers.back()->next(&rec)) {
+      heap.emplace(rec, i);
+    }
+  }
+
+  std::string dataPath = outfilename + ".edgedata";
+  std::ofstream dataOut;
+  if constexpr (kHasValue) {
+    dataOut.open(dataPath.c_str(), std::ios::binary);
+  }
+
+  while (!heap.empty()) {
+    HeapItem item = heap.top();
+    heap.pop();
+    writeLE32(out, item.first.dst);
+    if constexpr (kHasValue) {
+      dataOut.write(
+          reinterpret_cast<char*>(&item.first.data), sizeof(item.first.data));
+    }
+    Record rec;
+    if (readers[item.second]->next(&rec)) {
+      heap.emplace(rec, item.second);
+    }
+  }
+  if (numEdges % 2 != 0) {
+    writeLE32(out, 0);  // re-align to 64 bits
+  }
+
+  if constexpr (kHasValue) {
+    dataOut.close();
+    std::ifstream dataIn(dataPath.c_str(), std::ios::binary);
+    out << dataIn.rdbuf();
+    dataIn.close();
+    std::remove(dataPath.c_str());
+  }
+  readers.clear();
+  for (const std::string& path : runFiles) {
+    std::remove(path.c_str());
+  }
+
+  if (!out) {
+    KATANA_DIE("failed to write ", outfilename);
+  }
+  out.close();
+  printStatus(numNodes, numEdges);
+}
+
 /**
  * Common parsing for edgelist style text files.
  *
@@ -393,6 +646,12 @@ void
 convertEdgelist(
     const std::string& infilename, const std::string& outfilename,
     const bool skipFirstLine, std::optional<char> delim) {
+  if (memoryBudgetMB > 0) {
+    convertEdgelistExternal<EdgeTy>(
+        infilename, outfilename, skipFirstLine, delim);
+    return;
+  }
+
   typedef katana::FileGraphWriter Writer;
   typedef katana::NUMAArray<EdgeTy> EdgeData;
   typedef typename EdgeData::value_type edge_value_type;
@@ -3,6 +3,7 @@
 #include <llvm/Support/CommandLine.h>
 
 #include "Transforms.h"
+#include "katana/EdgeListImport.h"
 #include "katana/ErrorCode.h"
 #include "katana/Galois.h"
 #include "katana/GraphML.h"
@@ -39,7 +40,13 @@ cll::opt<katana::SourceType> type(
             "source file is of type GraphML"),
         clEnumValN(
             katana::SourceType::kKatana, "katana",
-            "source file is of type Katana")),
+            "source file is of type Katana"),
+        clEnumValN(
+            katana::SourceType::kCsv, "csv",
+            "source file is a CSV edge list"),
+        clEnumValN(
+            katana::SourceType::kJsonl, "jsonl",
+            "source file is a JSONL edge list")),
     cll::init(katana::SourceType::kGraphml));
 cll::opt<katana::SourceDatabase> database(
     cll::desc("Database the data is from:"),
@@ -161,6 +168,23 @@ ParseWild(katana::TxnContext* txn_ctx) {
       KATANA_LOG_FATAL("Failed to convert property graph: {}", r.error());
     }
     return;
+  case katana::SourceType::kCsv:
+  case katana::SourceType::kJsonl: {
+    auto components_result = katana::ConvertEdgeList(
+        input_filename,
+        type == katana::SourceType::kCsv ? katana::EdgeListFormat::kCsv
+                                         : katana::EdgeListFormat::kJsonl,
+        true);
+    if (!components_result) {
+      KATANA_LOG_FATAL("Error converting graph: {}", components_result.error());
+    }
+    if (auto r = katana::WritePropertyGraph(
+            std::move(components_result.value()), output_uri, txn_ctx);
+        !r) {
+      KATANA_LOG_FATAL("Failed to convert property graph: {}", r.error());
+    }
+    return;
+  }
   default:
     KATANA_LOG_ERROR("Unsupported input type {}", type);
   }
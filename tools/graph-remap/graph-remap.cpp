@@ -17,9 +17,18 @@
  * Documentation, or loss or inaccuracy of data of any kind.
  */
 
+#include <cctype>
+#include <limits>
+#include <vector>
+
 #include "katana/BufferedGraph.h"
 #include "katana/FileGraph.h"
+#include "katana/FileView.h"
+#include "katana/Loops.h"
+#include "katana/NUMAArray.h"
+#include "katana/Reduction.h"
 #include "katana/SharedMemSys.h"
+#include "katana/Threads.h"
 #include "llvm/Support/CommandLine.h"
 
 namespace cll = llvm::cl;
@@ -33,44 +42,113 @@ static cll::opt<std::string> outputFilename(
 
 using Writer = katana::FileGraphWriter;
 
+//! Sentinel for nodes that do not appear in the mapping file
+constexpr uint32_t kUnmapped = std::numeric_limits<uint32_t>::max();
+
+struct NodeMap {
+  //! Dense old-ID-indexed array of new IDs; kUnmapped for dropped nodes
+  katana::NUMAArray<uint32_t> newID;
+  //! Number of nodes in the remapped graph (lines in the mapping file)
+  size_t numNewNodes{0};
+};
+
 /**
  * Create node map from file
+ *
+ * The mapping file is mmap'd through FileView and parsed in parallel:
+ * one pass counts entries and finds the largest old ID per chunk, a
+ * prefix sum over chunk counts recovers each entry's line number (its
+ * new ID), and a second pass scatters into a dense array. Unlike the
+ * previous std::map-based reader this does not require the mapping to
+ * list old IDs in increasing order.
  */
-std::map<uint32_t, uint32_t>
+NodeMap
 createNodeMap() {
   katana::gInfo("Creating node map");
-  // read new mapping
-  std::ifstream mapFile(mappingFilename);
-  mapFile.seekg(0, std::ios_base::end);
-
-  int64_t endOfFile = mapFile.tellg();
-  if (!mapFile) {
-    KATANA_DIE("failed to read file");
+  katana::FileView mapView;
+  if (auto res = mapView.Bind(mappingFilename, true); !res) {
+    KATANA_DIE("failed to read mapping file: ", res.error());
   }
-
-  mapFile.seekg(0, std::ios_base::beg);
-  if (!mapFile) {
-    KATANA_DIE("failed to read file");
+  const char* buf = mapView.begin();
+  const size_t size = mapView.size();
+
+  // chunk the file on line boundaries
+  size_t numChunks = std::min<size_t>(
+      std::max<size_t>(size / 4096, 1), katana::getActiveThreads() * 4);
+  std::vector<size_t> chunkBegin(numChunks + 1, size);
+  chunkBegin[0] = 0;
+  for (size_t c = 1; c < numChunks; ++c) {
+    size_t pos = size / numChunks * c;
+    while (pos < size && buf[pos] != '\n') {
+      ++pos;
+    }
+    chunkBegin[c] = pos < size ? pos + 1 : size;
   }
 
-  // remap node listed on line n in the mapping to node n
-  std::map<uint32_t, uint32_t> remapper;
-  uint64_t counter = 0;
-  while (((int64_t)mapFile.tellg() + 1) != endOfFile) {
-    uint64_t nodeID;
-    mapFile >> nodeID;
-    if (!mapFile) {
-      KATANA_DIE("failed to read file");
+  auto forEachID = [&](size_t chunk, auto&& fn) {
+    size_t pos = chunkBegin[chunk];
+    const size_t end = chunkBegin[chunk + 1];
+    while (pos < end) {
+      while (pos < end && !isdigit(static_cast<unsigned char>(buf[pos]))) {
+        ++pos;
+      }
+      if (pos >= end) {
+        break;
+      }
+      uint64_t id = 0;
+      while (pos < end && isdigit(static_cast<unsigned char>(buf[pos]))) {
+        id = id * 10 + (buf[pos] - '0');
+        ++pos;
+      }
+      fn(id);
     }
-    remapper[nodeID] = counter++;
+  };
+
+  // pass 1: entries per chunk and the largest old ID
+  std::vector<size_t> chunkCount(numChunks, 0);
+  katana::GReduceMax<uint64_t> maxOldID;
+  katana::do_all(
+      katana::iterate(size_t{0}, numChunks),
+      [&](size_t chunk) {
+        size_t count = 0;
+        forEachID(chunk, [&](uint64_t id) {
+          maxOldID.update(id);
+          ++count;
+        });
+        chunkCount[chunk] = count;
+      },
+      katana::loopname("CountMappingEntries"));
+
+  size_t counter = 0;
+  std::vector<size_t> chunkStart(numChunks, 0);
+  for (size_t c = 0; c < numChunks; ++c) {
+    chunkStart[c] = counter;
+    counter += chunkCount[c];
+  }
+  if (counter == 0) {
+    KATANA_DIE("mapping file contains no node IDs");
   }
-
-  KATANA_LOG_ASSERT(remapper.size() == counter);
   katana::gInfo("Remapping ", counter, " nodes");
 
+  NodeMap map;
+  map.numNewNodes = counter;
+  map.newID.allocateInterleaved(maxOldID.reduce() + 1);
+  katana::do_all(
+      katana::iterate(size_t{0}, map.newID.size()),
+      [&](size_t i) { map.newID[i] = kUnmapped; });
+
+  // pass 2: remap node listed on line n in the mapping to node n
+  katana::do_all(
+      katana::iterate(size_t{0}, numChunks),
+      [&](size_t chunk) {
+        size_t next = chunkStart[chunk];
+        forEachID(chunk, [&](uint64_t id) { map.newID[id] = next++; });
+      },
+      katana::loopname("ScatterMappingEntries"));
+
   katana::gInfo("Node map created");
 
-  return remapper;
+  return map;
 }
 
 int
@@ -78,7 +156,7 @@ main(int argc, char** argv) {
   katana::SharedMemSys G;
   llvm::cl::ParseCommandLineOptions(argc, argv);
 
-  std::map<uint32_t, uint32_t> remapper = createNodeMap();
+  NodeMap map = createNodeMap();
 
   katana::gInfo("Loading graph to remap");
   katana::BufferedGraph<void> graphToRemap;
@@ -86,45 +164,49 @@ main(int argc, char** argv) {
   katana::gInfo("Graph loaded");
 
   Writer graphWriter;
-  graphWriter.setNumNodes(remapper.size());
+  graphWriter.setNumNodes(map.numNewNodes);
   graphWriter.setNumEdges(graphToRemap.sizeEdges());
 
+  // Distinct old nodes map to distinct new nodes, so both phases can
+  // run node-parallel without synchronization: every writer slot is
+  // touched by exactly one old node.
+
   // phase 1: count degrees
   graphWriter.phase1();
   katana::gInfo("Starting degree counting");
   size_t prevNumNodes = graphToRemap.size();
-  size_t nodeIDCounter = 0;
-  for (size_t i = 0; i < prevNumNodes; i++) {
-    // see if current node is to be remapped, i.e. exists in the map
-    if (remapper.find(i) != remapper.end()) {
-      KATANA_LOG_ASSERT(nodeIDCounter == remapper[i]);
-      for (auto e = graphToRemap.edgeBegin(i); e < graphToRemap.edgeEnd(i);
-           e++) {
-        graphWriter.incrementDegree(nodeIDCounter);
-      }
-      nodeIDCounter++;
-    }
-  }
-  KATANA_LOG_ASSERT(nodeIDCounter == remapper.size());
+  katana::do_all(
+      katana::iterate(size_t{0}, prevNumNodes),
+      [&](size_t i) {
+        // see if current node is to be remapped, i.e. exists in the map
+        if (i >= map.newID.size() || map.newID[i] == kUnmapped) {
+          return;
+        }
+        graphWriter.incrementDegree(
+            map.newID[i], static_cast<int>(
+                              graphToRemap.edgeEnd(i) -
+                              graphToRemap.edgeBegin(i)));
+      },
+      katana::steal(), katana::loopname("CountRemappedDegrees"));
 
   // phase 2: edge construction
   graphWriter.phase2();
   katana::gInfo("Starting edge construction");
-  nodeIDCounter = 0;
-  for (size_t i = 0; i < prevNumNodes; i++) {
-    // see if current node is to be remapped, i.e. exists in the map
-    if (remapper.find(i) != remapper.end()) {
-      KATANA_LOG_ASSERT(nodeIDCounter == remapper[i]);
-      for (auto e = graphToRemap.edgeBegin(i); e < graphToRemap.edgeEnd(i);
-           e++) {
-        uint32_t dst = graphToRemap.edgeDestination(*e);
-        KATANA_LOG_ASSERT(remapper.find(dst) != remapper.end());
-        graphWriter.addNeighbor(nodeIDCounter, remapper[dst]);
-      }
-      nodeIDCounter++;
-    }
-  }
-  KATANA_LOG_ASSERT(nodeIDCounter == remapper.size());
+  katana::do_all(
+      katana::iterate(size_t{0}, prevNumNodes),
+      [&](size_t i) {
+        if (i >= map.newID.size() || map.newID[i] == kUnmapped) {
+          return;
+        }
+        for (auto e = graphToRemap.edgeBegin(i); e < graphToRemap.edgeEnd(i);
+             e++) {
+          uint64_t dst = graphToRemap.edgeDestination(*e);
+          KATANA_LOG_ASSERT(
+              dst < map.newID.size() && map.newID[dst] != kUnmapped);
+          graphWriter.addNeighbor(map.newID[i], map.newID[dst]);
+        }
+      },
+      katana::steal(), katana::loopname("ConstructRemappedEdges"));
 
   katana::gInfo("Finishing up: outputting graph shortly");
 
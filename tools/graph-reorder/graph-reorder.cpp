@@ -0,0 +1,219 @@
+/*
+ * This file belongs to the Galois project, a C++ library for exploiting
+ * parallelism. The code is being released under the terms of the 3-Clause BSD
+ * License (a copy is located in LICENSE.txt at the top-level directory).
+ *
+ * Copyright (C) 2018, The University of Texas at Austin. All rights reserved.
+ * UNIVERSITY EXPRESSLY DISCLAIMS ANY AND ALL WARRANTIES CONCERNING THIS
+ * SOFTWARE AND DOCUMENTATION, INCLUDING ANY WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR ANY PARTICULAR PURPOSE, NON-INFRINGEMENT AND WARRANTIES OF
+ * PERFORMANCE, AND ANY WARRANTY THAT MIGHT OTHERWISE ARISE FROM COURSE OF
+ * DEALING OR USAGE OF TRADE.  NO WARRANTY IS EITHER EXPRESS OR IMPLIED WITH
+ * RESPECT TO THE USE OF THE SOFTWARE OR DOCUMENTATION. Under no circumstances
+ * shall University be liable for incidental, special, indirect, direct or
+ * consequential damages or loss of profits, interruption of business, or
+ * related expenses which may arise from use of Software or Documentation,
+ * including but not limited to those resulting from defects in Software and/or
+ * Documentation, or loss or inaccuracy of data of any kind.
+ */
+
+#include <fstream>
+#include <limits>
+#include <string>
+
+#include <arrow/api.h>
+
+#include "katana/Logging.h"
+#include "katana/Loops.h"
+#include "katana/NUMAArray.h"
+#include "katana/PropertyGraph.h"
+#include "katana/Result.h"
+#include "katana/SharedMemSys.h"
+#include "katana/TxnContext.h"
+#include "katana/URI.h"
+#include "katana/gIO.h"
+#include "llvm/Support/CommandLine.h"
+
+namespace cll = llvm::cl;
+
+namespace {
+
+enum class Ordering {
+  degree,
+  rcm,
+  affinity,
+  mapping,
+};
+
+cll::opt<std::string> InputURI(
+    cll::Positional, cll::desc("<input rdg>"), cll::Required);
+
+cll::opt<std::string> OutputURI(
+    cll::Positional, cll::desc("<output rdg>"), cll::Required);
+
+cll::opt<Ordering> OrderingKind(
+    "ordering", cll::desc("Node ordering to apply:"),
+    cll::values(
+        clEnumValN(
+            Ordering::degree, "degree", "Sort nodes by descending degree"),
+        clEnumValN(
+            Ordering::rcm, "rcm",
+            "Reverse Cuthill-McKee (bandwidth reduction; symmetric inputs)"),
+        clEnumValN(
+            Ordering::affinity, "affinity",
+            "Gorder-style sliding-window neighbor affinity"),
+        clEnumValN(
+            Ordering::mapping, "mapping",
+            "Apply an externally computed ordering (e.g. a METIS partition "
+            "order) from --mapping-file")),
+    cll::init(Ordering::degree));
+
+cll::opt<std::string> MappingFile(
+    "mapping-file",
+    cll::desc("Text file listing old node IDs; the node on line n becomes "
+              "node n (must be a full permutation)"));
+
+cll::opt<unsigned> AffinityWindow(
+    "affinity-window", cll::desc("Window size for --ordering=affinity"),
+    cll::init(8));
+
+cll::opt<std::string> PermutationProperty(
+    "permutation-property",
+    cll::desc("Name of the node property on the output graph holding each "
+              "node's ID in the input graph (empty to omit)"),
+    cll::init("original_node_id"));
+
+/// Read a full permutation from a mapping file, one old node ID per line.
+katana::Result<katana::NUMAArray<uint32_t>>
+ReadMappingFile(const std::string& path, uint64_t num_nodes) {
+  std::ifstream in(path);
+  if (!in) {
+    return KATANA_ERROR(
+        katana::ErrorCode::NotFound, "cannot open mapping file {}", path);
+  }
+
+  constexpr uint32_t kUnassigned = std::numeric_limits<uint32_t>::max();
+  katana::NUMAArray<uint32_t> old_to_new;
+  old_to_new.allocateInterleaved(num_nodes);
+  katana::do_all(
+      katana::iterate(uint64_t{0}, num_nodes),
+      [&](uint64_t i) { old_to_new[i] = kUnassigned; });
+
+  uint64_t new_id = 0;
+  uint64_t old_id = 0;
+  while (in >> old_id) {
+    if (old_id >= num_nodes) {
+      return KATANA_ERROR(
+          katana::ErrorCode::InvalidArgument,
+          "mapping file lists node {} but the graph has {} nodes", old_id,
+          num_nodes);
+    }
+    if (old_to_new[old_id] != kUnassigned) {
+      return KATANA_ERROR(
+          katana::ErrorCode::InvalidArgument,
+          "mapping file lists node {} twice", old_id);
+    }
+    old_to_new[old_id] = new_id++;
+  }
+  if (new_id != num_nodes) {
+    return KATANA_ERROR(
+        katana::ErrorCode::InvalidArgument,
+        "mapping file lists {} nodes but the graph has {}; reordering must "
+        "keep every node",
+        new_id, num_nodes);
+  }
+  return old_to_new;
+}
+
+katana::Result<katana::NUMAArray<uint32_t>>
+ComputeOrder(const katana::PropertyGraph* pg) {
+  switch (OrderingKind) {
+  case Ordering::degree:
+    return katana::ComputeDegreeOrder(pg);
+  case Ordering::rcm:
+    return katana::ComputeRCMOrder(pg);
+  case Ordering::affinity:
+    return katana::ComputeWindowAffinityOrder(pg, AffinityWindow);
+  case Ordering::mapping:
+    if (MappingFile.empty()) {
+      return KATANA_ERROR(
+          katana::ErrorCode::InvalidArgument,
+          "--ordering=mapping requires --mapping-file");
+    }
+    return ReadMappingFile(MappingFile, pg->NumNodes());
+  }
+  return KATANA_ERROR(katana::ErrorCode::InvalidArgument, "unknown ordering");
+}
+
+/// Record each output node's ID in the input graph so results computed on
+/// the reordered graph can be mapped back.
+katana::Result<void>
+AddPermutationProperty(
+    katana::PropertyGraph* relabeled,
+    const katana::NUMAArray<uint32_t>& old_to_new,
+    katana::TxnContext* txn_ctx) {
+  const uint64_t num_nodes = old_to_new.size();
+  katana::NUMAArray<uint64_t> new_to_old;
+  new_to_old.allocateInterleaved(num_nodes);
+  katana::do_all(katana::iterate(uint64_t{0}, num_nodes), [&](uint64_t old_id) {
+    new_to_old[old_to_new[old_id]] = old_id;
+  });
+
+  arrow::UInt64Builder builder;
+  KATANA_CHECKED(builder.AppendValues(new_to_old.data(), num_nodes));
+  std::shared_ptr<arrow::Array> column = KATANA_CHECKED(builder.Finish());
+
+  auto table = arrow::Table::Make(
+      arrow::schema({arrow::field(PermutationProperty, arrow::uint64())}),
+      {column});
+  return relabeled->AddNodeProperties(table, txn_ctx);
+}
+
+katana::Result<void>
+Run(const std::string& command_line) {
+  katana::TxnContext txn_ctx;
+  katana::URI input_uri = KATANA_CHECKED(katana::URI::Make(InputURI));
+  std::unique_ptr<katana::PropertyGraph> pg =
+      KATANA_CHECKED(katana::PropertyGraph::Make(input_uri, &txn_ctx));
+
+  katana::gInfo(
+      "computing ordering over ", pg->NumNodes(), " nodes and ",
+      pg->NumEdges(), " edges");
+  katana::NUMAArray<uint32_t> old_to_new =
+      KATANA_CHECKED(ComputeOrder(pg.get()));
+
+  katana::gInfo("relabeling graph");
+  std::unique_ptr<katana::PropertyGraph> relabeled = KATANA_CHECKED(
+      katana::CreateRelabeledGraph(pg.get(), old_to_new, &txn_ctx));
+
+  if (!PermutationProperty.empty()) {
+    KATANA_CHECKED(
+        AddPermutationProperty(relabeled.get(), old_to_new, &txn_ctx));
+  }
+
+  katana::URI output_uri = KATANA_CHECKED(katana::URI::Make(OutputURI));
+  katana::gInfo("writing reordered graph to ", OutputURI.getValue());
+  KATANA_CHECKED(relabeled->Write(output_uri, command_line, &txn_ctx));
+  return katana::ResultSuccess();
+}
+
+}  // namespace
+
+int
+main(int argc, char** argv) {
+  katana::SharedMemSys sys;
+  llvm::cl::ParseCommandLineOptions(argc, argv);
+
+  std::string command_line;
+  for (int i = 0; i < argc; ++i) {
+    command_line += argv[i];
+    if (i != argc - 1) {
+      command_line += " ";
+    }
+  }
+
+  if (auto res = Run(command_line); !res) {
+    KATANA_LOG_FATAL("graph-reorder: {}", res.error());
+  }
+  return 0;
+}
@@ -17,13 +17,22 @@
  * Documentation, or loss or inaccuracy of data of any kind.
  */
 
+#include <array>
+#include <cmath>
 #include <cstdlib>
 #include <iostream>
+#include <memory>
 #include <vector>
 
 #include "katana/Galois.h"
+#include "katana/JSONTracer.h"
 #include "katana/LCGraph.h"
 #include "katana/OfflineGraph.h"
+#include "katana/PerThreadStorage.h"
+#include "katana/ProgressTracer.h"
+#include "katana/PropertyGraph.h"
+#include "katana/Reduction.h"
+#include "katana/SharedMemSys.h"
 #include "llvm/Support/CommandLine.h"
 
 namespace cll = llvm::cl;
@@ -36,7 +45,8 @@ enum StatMode {
   indegreehist,
   sortedlogoffsethist,
   sparsityPattern,
-  summary
+  summary,
+  pgsummary
 };
 
 static cll::opt<std::string> inputfilename(
@@ -56,7 +66,12 @@ static cll::list<StatMode> statModeList(
             sparsityPattern,
             "Pattern of non-zeros when graph is "
             "interpreted as a sparse matrix"),
-        clEnumVal(summary, "Graph summary")));
+        clEnumVal(summary, "Graph summary"),
+        clEnumVal(
+            pgsummary,
+            "Parallel summary with approximate degree quantiles and "
+            "distinct destination counts; input must be an RDG "
+            "directory")));
 static cll::opt<int> numBins(
     "numBins", cll::desc("Number of bins"), cll::init(-1));
 static cll::opt<int> columns(
@@ -251,34 +266,213 @@ doDestinationHistogram(Graph& graph) {
   printHistogram("DestinationBin", hist);
 }
 
+/// HyperLogLog cardinality sketch with 2^12 single-byte registers
+/// (roughly 1.6% standard error). Sketches from different threads can be
+/// combined with Merge because registers only ever take the maximum.
+class HyperLogLog {
+  static constexpr int kLogBuckets = 12;
+  static constexpr size_t kBuckets = size_t{1} << kLogBuckets;
+
+  std::array<uint8_t, kBuckets> registers_{};
+
+  // splitmix64 finalizer; node IDs are sequential so they need mixing
+  // before the high bits can be used as a bucket index
+  static uint64_t hash(uint64_t x) {
+    x += UINT64_C(0x9e3779b97f4a7c15);
+    x = (x ^ (x >> 30)) * UINT64_C(0xbf58476d1ce4e5b9);
+    x = (x ^ (x >> 27)) * UINT64_C(0x94d049bb133111eb);
+    return x ^ (x >> 31);
+  }
+
+public:
+  void Add(uint64_t value) {
+    uint64_t h = hash(value);
+    size_t bucket = h >> (64 - kLogBuckets);
+    uint64_t rest = h << kLogBuckets;
+    uint8_t rank =
+        rest == 0 ? (64 - kLogBuckets + 1) : (__builtin_clzll(rest) + 1);
+    if (registers_[bucket] < rank) {
+      registers_[bucket] = rank;
+    }
+  }
+
+  void Merge(const HyperLogLog& other) {
+    for (size_t i = 0; i < kBuckets; ++i) {
+      registers_[i] = std::max(registers_[i], other.registers_[i]);
+    }
+  }
+
+  double Estimate() const {
+    constexpr double alpha = 0.7213 / (1.0 + 1.079 / kBuckets);
+    double sum = 0.0;
+    size_t zeros = 0;
+    for (uint8_t r : registers_) {
+      sum += std::ldexp(1.0, -r);
+      if (r == 0) {
+        ++zeros;
+      }
+    }
+    double estimate = alpha * kBuckets * kBuckets / sum;
+    if (estimate <= 2.5 * kBuckets && zeros > 0) {
+      // linear counting for small cardinalities
+      estimate = kBuckets * std::log(static_cast<double>(kBuckets) / zeros);
+    }
+    return estimate;
+  }
+};
+
+/// Streaming approximate quantiles over non-negative integers using a
+/// log-scaled histogram: 16 linear sub-buckets per power of two, so the
+/// relative error of any quantile is bounded by 1/16. Mergeable across
+/// threads by adding counts.
+class ApproxQuantiles {
+  static constexpr int kSubBuckets = 16;
+  static constexpr size_t kNumBuckets = 64 * kSubBuckets;
+
+  std::array<uint64_t, kNumBuckets> counts_{};
+  uint64_t total_{0};
+
+  static size_t bucketOf(uint64_t value) {
+    if (value < kSubBuckets) {
+      return value;
+    }
+    int log2 = 63 - __builtin_clzll(value);
+    return log2 * kSubBuckets + ((value >> (log2 - 4)) & (kSubBuckets - 1));
+  }
+
+  // lower bound of the value range mapped to a bucket
+  static uint64_t representative(size_t bucket) {
+    if (bucket < kSubBuckets) {
+      return bucket;
+    }
+    uint64_t log2 = bucket / kSubBuckets;
+    uint64_t sub = bucket % kSubBuckets;
+    return (uint64_t{1} << log2) | (sub << (log2 - 4));
+  }
+
+public:
+  void Add(uint64_t value) {
+    ++counts_[bucketOf(value)];
+    ++total_;
+  }
+
+  void Merge(const ApproxQuantiles& other) {
+    for (size_t i = 0; i < kNumBuckets; ++i) {
+      counts_[i] += other.counts_[i];
+    }
+    total_ += other.total_;
+  }
+
+  uint64_t Quantile(double q) const {
+    if (total_ == 0) {
+      return 0;
+    }
+    uint64_t rank = static_cast<uint64_t>(q * (total_ - 1));
+    uint64_t seen = 0;
+    for (size_t i = 0; i < kNumBuckets; ++i) {
+      seen += counts_[i];
+      if (seen > rank) {
+        return representative(i);
+      }
+    }
+    return representative(kNumBuckets - 1);
+  }
+};
+
+void
+doPropertyGraphSummary(const std::string& rdg_dir) {
+  katana::SharedMemSys sys;
+  katana::ProgressTracer::Set(katana::JSONTracer::Make());
+  auto scope = katana::GetTracer().StartActiveSpan("graph-stats");
+
+  auto uri_res = katana::URI::Make(rdg_dir);
+  if (!uri_res) {
+    KATANA_LOG_FATAL("input {} error: {}", rdg_dir, uri_res.error());
+  }
+  katana::TxnContext txn_ctx;
+  auto pg_res = katana::PropertyGraph::Make(
+      uri_res.value(), &txn_ctx, katana::RDGLoadOptions());
+  if (!pg_res) {
+    KATANA_LOG_FATAL("failed to load {}: {}", rdg_dir, pg_res.error());
+  }
+  std::unique_ptr<katana::PropertyGraph> pg = std::move(pg_res.value());
+  const katana::GraphTopology& topo = pg->topology();
+
+  katana::PerThreadStorage<HyperLogLog> dst_sketches;
+  katana::PerThreadStorage<ApproxQuantiles> degree_sketches;
+  katana::GReduceMax<uint64_t> max_degree;
+  katana::do_all(
+      katana::iterate(topo.Nodes()),
+      [&](katana::GraphTopology::Node node) {
+        uint64_t degree = topo.OutDegree(node);
+        degree_sketches.getLocal()->Add(degree);
+        max_degree.update(degree);
+        HyperLogLog* dsts = dst_sketches.getLocal();
+        for (auto edge : topo.OutEdges(node)) {
+          dsts->Add(topo.OutEdgeDst(edge));
+        }
+      },
+      katana::steal(), katana::loopname("ComputeGraphStats"));
+
+  HyperLogLog distinct_dsts;
+  ApproxQuantiles degree_dist;
+  for (unsigned i = 0; i < dst_sketches.size(); ++i) {
+    distinct_dsts.Merge(*dst_sketches.getRemote(i));
+    degree_dist.Merge(*degree_sketches.getRemote(i));
+  }
+
+  uint64_t num_nodes = topo.NumNodes();
+  uint64_t num_edges = topo.NumEdges();
+  scope.span().Log(
+      "summary",
+      {
+          {"num_nodes", num_nodes},
+          {"num_edges", num_edges},
+          {"mean_degree",
+           num_nodes == 0 ? 0.0 : static_cast<double>(num_edges) / num_nodes},
+          {"max_degree", max_degree.reduce()},
+          {"approx_degree_p50", degree_dist.Quantile(0.5)},
+          {"approx_degree_p90", degree_dist.Quantile(0.9)},
+          {"approx_degree_p99", degree_dist.Quantile(0.99)},
+          {"approx_distinct_destinations", distinct_dsts.Estimate()},
+      });
+}
+
 int
 main(int argc, char** argv) {
   llvm::cl::ParseCommandLineOptions(argc, argv);
   try {
-    Graph graph(inputfilename);
+    // pgsummary reads an RDG rather than a .gr file, so only open the
+    // input as an OfflineGraph when another stat needs it
+    std::unique_ptr<Graph> graph;
+    for (unsigned i = 0; i != statModeList.size(); ++i) {
+      if (statModeList[i] != pgsummary && !graph) {
+        graph = std::make_unique<Graph>(inputfilename);
+      }
+    }
     for (unsigned i = 0; i != statModeList.size(); ++i) {
       switch (statModeList[i]) {
       case degreehist:
-        doDegreeHistogram(graph);
+        doDegreeHistogram(*graph);
         break;
       case degrees:
-        doDegrees(graph);
+        doDegrees(*graph);
         break;
       case maxDegreeNode:
-        findMaxDegreeNode(graph);
+        findMaxDegreeNode(*graph);
         break;
       case dsthist:
-        doDestinationHistogram(graph);
+        doDestinationHistogram(*graph);
         break;
       case indegreehist:
-        doInDegreeHistogram(graph);
+        doInDegreeHistogram(*graph);
         break;
       case sortedlogoffsethist:
-        doSortedLogOffsetHistogram(graph);
+        doSortedLogOffsetHistogram(*graph);
         break;
       case sparsityPattern: {
         unsigned lastrow = ~0;
-        doSparsityPattern(graph, [&lastrow](unsigned, unsigned y, bool val) {
+        doSparsityPattern(*graph, [&lastrow](unsigned, unsigned y, bool val) {
           if (y != lastrow) {
             lastrow = y;
             std::cout << '\n';
@@ -289,7 +483,10 @@ main(int argc, char** argv) {
         break;
       }
       case summary:
-        doSummary(graph);
+        doSummary(*graph);
+        break;
+      case pgsummary:
+        doPropertyGraphSummary(inputfilename);
         break;
       default:
         std::cerr << "Unknown stat requested\n";